@@ -9,6 +9,8 @@ module Error : sig
     | AuthenticationFailure
     | InvalidIVLength
     | DecodeError
+    | MaximumLengthExceeded
+    | InvalidState
   type 'a result =
     | Success of 'a
     | Error of error_code
@@ -22,6 +22,8 @@ let print_error = function
   | AuthenticationFailure -> "Authentication failure"
   | InvalidIVLength -> "Invalid IV length"
   | DecodeError -> "Decode error"
+  | MaximumLengthExceeded -> "Maximum length exceeded"
+  | InvalidState -> "Invalid state"
 
 let init_bytes len =
   let buf = Bytes.create len in
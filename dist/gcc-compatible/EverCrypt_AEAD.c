@@ -27,6 +27,7 @@
 typedef struct EverCrypt_AEAD_state_s_s
 {
   Spec_Cipher_Expansion_impl impl;
+  Spec_Agile_AEAD_alg alg;
   uint8_t *ek;
 }
 EverCrypt_AEAD_state_s;
@@ -42,6 +43,12 @@ EverCrypt_AEAD___proj__Ek__item__impl(Spec_Agile_AEAD_alg a, EverCrypt_AEAD_stat
   return projectee.impl;
 }
 
+Spec_Agile_AEAD_alg
+EverCrypt_AEAD___proj__Ek__item__alg(Spec_Agile_AEAD_alg a, EverCrypt_AEAD_state_s projectee)
+{
+  return projectee.alg;
+}
+
 uint8_t
 *EverCrypt_AEAD___proj__Ek__item__ek(Spec_Agile_AEAD_alg a, EverCrypt_AEAD_state_s projectee)
 {
@@ -51,27 +58,8 @@ uint8_t
 Spec_Agile_AEAD_alg EverCrypt_AEAD_alg_of_state(EverCrypt_AEAD_state_s *s)
 {
   EverCrypt_AEAD_state_s scrut = *s;
-  Spec_Cipher_Expansion_impl impl = scrut.impl;
-  switch (impl)
-  {
-    case Spec_Cipher_Expansion_Hacl_CHACHA20:
-      {
-        return Spec_Agile_AEAD_CHACHA20_POLY1305;
-      }
-    case Spec_Cipher_Expansion_Vale_AES128:
-      {
-        return Spec_Agile_AEAD_AES128_GCM;
-      }
-    case Spec_Cipher_Expansion_Vale_AES256:
-      {
-        return Spec_Agile_AEAD_AES256_GCM;
-      }
-    default:
-      {
-        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
-        KRML_HOST_EXIT(253U);
-      }
-  }
+  Spec_Agile_AEAD_alg a = scrut.alg;
+  return a;
 }
 
 static EverCrypt_Error_error_code
@@ -80,7 +68,33 @@ create_in_chacha20_poly1305(EverCrypt_AEAD_state_s **dst, uint8_t *k)
   uint8_t *ek = KRML_HOST_CALLOC((uint32_t)32U, sizeof (uint8_t));
   KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
   EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
-  p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_CHACHA20, .ek = ek });
+  p[0U] =
+    (
+      (EverCrypt_AEAD_state_s){
+        .impl = Spec_Cipher_Expansion_Hacl_CHACHA20,
+        .alg = Spec_Agile_AEAD_CHACHA20_POLY1305,
+        .ek = ek
+      }
+    );
+  memcpy(ek, k, (uint32_t)32U * sizeof (uint8_t));
+  dst[0U] = p;
+  return EverCrypt_Error_Success;
+}
+
+static EverCrypt_Error_error_code
+create_in_xchacha20_poly1305(EverCrypt_AEAD_state_s **dst, uint8_t *k)
+{
+  uint8_t *ek = KRML_HOST_CALLOC((uint32_t)32U, sizeof (uint8_t));
+  KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
+  EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
+  p[0U] =
+    (
+      (EverCrypt_AEAD_state_s){
+        .impl = Spec_Cipher_Expansion_Hacl_CHACHA20,
+        .alg = Spec_Agile_AEAD_XCHACHA20_POLY1305,
+        .ek = ek
+      }
+    );
   memcpy(ek, k, (uint32_t)32U * sizeof (uint8_t));
   dst[0U] = p;
   return EverCrypt_Error_Success;
@@ -104,12 +118,36 @@ create_in_aes128_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
     uint64_t scrut0 = aes128_keyhash_init(keys_b, hkeys_b);
     KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
     EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
-    p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Vale_AES128, .ek = ek });
+    p[0U] =
+      (
+        (EverCrypt_AEAD_state_s){
+          .impl = Spec_Cipher_Expansion_Vale_AES128,
+          .alg = Spec_Agile_AEAD_AES128_GCM,
+          .ek = ek
+        }
+      );
     *dst = p;
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  uint8_t *ek = KRML_HOST_CALLOC((uint32_t)720U, sizeof (uint8_t));
+  uint8_t zero[16U] = { 0U };
+  uint8_t *keys_b = ek;
+  uint8_t *h_b = ek + (uint32_t)704U;
+  Hacl_AES_BitSlice_aes128_key_expansion(keys_b, k);
+  Hacl_AES_BitSlice_aes128_encrypt_block(h_b, zero, keys_b);
+  KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
+  EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
+  p[0U] =
+    (
+      (EverCrypt_AEAD_state_s){
+        .impl = Spec_Cipher_Expansion_Hacl_AES128,
+        .alg = Spec_Agile_AEAD_AES128_GCM,
+        .ek = ek
+      }
+    );
+  *dst = p;
+  return EverCrypt_Error_Success;
 }
 
 static EverCrypt_Error_error_code
@@ -130,7 +168,95 @@ create_in_aes256_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
     uint64_t scrut0 = aes256_keyhash_init(keys_b, hkeys_b);
     KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
     EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
-    p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Vale_AES256, .ek = ek });
+    p[0U] =
+      (
+        (EverCrypt_AEAD_state_s){
+          .impl = Spec_Cipher_Expansion_Vale_AES256,
+          .alg = Spec_Agile_AEAD_AES256_GCM,
+          .ek = ek
+        }
+      );
+    *dst = p;
+    return EverCrypt_Error_Success;
+  }
+  #endif
+  uint8_t *ek = KRML_HOST_CALLOC((uint32_t)976U, sizeof (uint8_t));
+  uint8_t zero[16U] = { 0U };
+  uint8_t *keys_b = ek;
+  uint8_t *h_b = ek + (uint32_t)960U;
+  Hacl_AES_BitSlice_aes256_key_expansion(keys_b, k);
+  Hacl_AES_BitSlice_aes256_encrypt_block(h_b, zero, keys_b);
+  KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
+  EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
+  p[0U] =
+    (
+      (EverCrypt_AEAD_state_s){
+        .impl = Spec_Cipher_Expansion_Hacl_AES256,
+        .alg = Spec_Agile_AEAD_AES256_GCM,
+        .ek = ek
+      }
+    );
+  *dst = p;
+  return EverCrypt_Error_Success;
+}
+
+static EverCrypt_Error_error_code
+create_in_aes128_gcm_siv(EverCrypt_AEAD_state_s **dst, uint8_t *k)
+{
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+  bool has_avx = EverCrypt_AutoConfig2_has_avx();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse)
+  {
+    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)304U, sizeof (uint8_t));
+    uint8_t *keys_b = ek;
+    uint8_t *hkeys_b = ek + (uint32_t)176U;
+    uint64_t scrut = aes128_key_expansion(k, keys_b);
+    uint64_t scrut0 = aes128_keyhash_init(keys_b, hkeys_b);
+    KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
+    EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
+    p[0U] =
+      (
+        (EverCrypt_AEAD_state_s){
+          .impl = Spec_Cipher_Expansion_Vale_AES128,
+          .alg = Spec_Agile_AEAD_AES128_GCM_SIV,
+          .ek = ek
+        }
+      );
+    *dst = p;
+    return EverCrypt_Error_Success;
+  }
+  #endif
+  return EverCrypt_Error_UnsupportedAlgorithm;
+}
+
+static EverCrypt_Error_error_code
+create_in_aes256_gcm_siv(EverCrypt_AEAD_state_s **dst, uint8_t *k)
+{
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+  bool has_avx = EverCrypt_AutoConfig2_has_avx();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse)
+  {
+    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)368U, sizeof (uint8_t));
+    uint8_t *keys_b = ek;
+    uint8_t *hkeys_b = ek + (uint32_t)240U;
+    uint64_t scrut = aes256_key_expansion(k, keys_b);
+    uint64_t scrut0 = aes256_keyhash_init(keys_b, hkeys_b);
+    KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
+    EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
+    p[0U] =
+      (
+        (EverCrypt_AEAD_state_s){
+          .impl = Spec_Cipher_Expansion_Vale_AES256,
+          .alg = Spec_Agile_AEAD_AES256_GCM_SIV,
+          .ek = ek
+        }
+      );
     *dst = p;
     return EverCrypt_Error_Success;
   }
@@ -155,6 +281,18 @@ EverCrypt_AEAD_create_in(Spec_Agile_AEAD_alg a, EverCrypt_AEAD_state_s **dst, ui
       {
         return create_in_chacha20_poly1305(dst, k);
       }
+    case Spec_Agile_AEAD_AES128_GCM_SIV:
+      {
+        return create_in_aes128_gcm_siv(dst, k);
+      }
+    case Spec_Agile_AEAD_AES256_GCM_SIV:
+      {
+        return create_in_aes256_gcm_siv(dst, k);
+      }
+    case Spec_Agile_AEAD_XCHACHA20_POLY1305:
+      {
+        return create_in_xchacha20_poly1305(dst, k);
+      }
     default:
       {
         return EverCrypt_Error_UnsupportedAlgorithm;
@@ -410,6 +548,404 @@ encrypt_aes256_gcm(
   #endif
 }
 
+static void
+aes_ctr32_le(
+  Spec_Cipher_Expansion_impl i,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint8_t *keys_b,
+  uint8_t *ctr_block
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        Hacl_AES_NI_aes128_ctr32_le(len, out, text, keys_b, ctr_block);
+        break;
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        Hacl_AES_NI_aes256_ctr32_le(len, out, text, keys_b, ctr_block);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+static void
+aes_encrypt_block(Spec_Cipher_Expansion_impl i, uint8_t *out, uint8_t *text, uint8_t *keys_b)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        Hacl_AES_NI_aes128_encrypt_block(out, text, keys_b);
+        break;
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        Hacl_AES_NI_aes256_encrypt_block(out, text, keys_b);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+/* The per-nonce keys of RFC 8452: the first halves of AES(K, le32(j) || iv),
+   for j = 0, 1 (authentication key) and j = 2 .. 3 (resp. 5) (encryption
+   key). The blocks are the key stream of the 32-bit little-endian counter
+   mode, starting from le32(0) || iv. */
+static void
+gcm_siv_derive_keys(
+  Spec_Cipher_Expansion_impl i,
+  uint8_t *keys_b,
+  uint8_t *iv,
+  uint8_t *auth_key,
+  uint8_t *enc_keys_b
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  uint8_t ctr_block[16U] = { 0U };
+  uint8_t zeroes[96U] = { 0U };
+  uint8_t blocks[96U] = { 0U };
+  uint8_t enc_key[32U] = { 0U };
+  memcpy(ctr_block + (uint32_t)4U, iv, (uint32_t)12U * sizeof (uint8_t));
+  uint32_t key_len;
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        key_len = (uint32_t)16U;
+        break;
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        key_len = (uint32_t)32U;
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+  uint32_t n = (uint32_t)2U + key_len / (uint32_t)8U;
+  aes_ctr32_le(i, n * (uint32_t)16U, blocks, zeroes, keys_b, ctr_block);
+  memcpy(auth_key, blocks, (uint32_t)8U * sizeof (uint8_t));
+  memcpy(auth_key + (uint32_t)8U, blocks + (uint32_t)16U, (uint32_t)8U * sizeof (uint8_t));
+  for (uint32_t j = (uint32_t)0U; j < key_len / (uint32_t)8U; j++)
+  {
+    memcpy(enc_key + j * (uint32_t)8U,
+      blocks + (j + (uint32_t)2U) * (uint32_t)16U,
+      (uint32_t)8U * sizeof (uint8_t));
+  }
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        uint64_t scrut = aes128_key_expansion(enc_key, enc_keys_b);
+        break;
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        uint64_t scrut = aes256_key_expansion(enc_key, enc_keys_b);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+/* tag = AES(enc_key, POLYVAL(auth_key, ad || plain || lengths) ^ iv), with
+   the most significant bit of the last byte cleared. */
+static void
+gcm_siv_tag(
+  Spec_Cipher_Expansion_impl i,
+  uint8_t *auth_key,
+  uint8_t *enc_keys_b,
+  uint8_t *iv,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *tag
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  Lib_IntVector_Intrinsics_vec128 ctx[9U];
+  for (uint32_t _i = 0U; _i < (uint32_t)9U; ++_i)
+    ctx[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  uint8_t len_block[16U] = { 0U };
+  uint8_t s[16U] = { 0U };
+  store64_le(len_block, (uint64_t)ad_len * (uint64_t)8U);
+  store64_le(len_block + (uint32_t)8U, (uint64_t)plain_len * (uint64_t)8U);
+  Hacl_Gf128_NI_polyval_init(ctx, auth_key);
+  Hacl_Gf128_NI_polyval_update_blocks(ctx, ad_len, ad);
+  Hacl_Gf128_NI_polyval_update_blocks(ctx, plain_len, plain);
+  Hacl_Gf128_NI_polyval_update_blocks(ctx, (uint32_t)16U, len_block);
+  Hacl_Gf128_NI_polyval_emit(s, ctx);
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)12U; j++)
+  {
+    s[j] = s[j] ^ iv[j];
+  }
+  s[15U] = s[15U] & (uint8_t)0x7fU;
+  aes_encrypt_block(i, tag, s, enc_keys_b);
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+static EverCrypt_Error_error_code
+encrypt_aes_gcm_siv(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  if (iv_len != (uint32_t)12U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl i = scrut.impl;
+  uint8_t *ek = scrut.ek;
+  uint8_t auth_key[16U] = { 0U };
+  uint8_t enc_keys_b[240U] = { 0U };
+  uint8_t ctr_block[16U] = { 0U };
+  gcm_siv_derive_keys(i, ek, iv, auth_key, enc_keys_b);
+  gcm_siv_tag(i, auth_key, enc_keys_b, iv, ad, ad_len, plain, plain_len, tag);
+  memcpy(ctr_block, tag, (uint32_t)16U * sizeof (uint8_t));
+  ctr_block[15U] = ctr_block[15U] | (uint8_t)0x80U;
+  aes_ctr32_le(i, plain_len, cipher, plain, enc_keys_b, ctr_block);
+  return EverCrypt_Error_Success;
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+static void
+hacl_aes_ctr32_be(
+  Spec_Cipher_Expansion_impl i,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint8_t *keys_b,
+  uint8_t *ctr_block
+)
+{
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        Hacl_AES_BitSlice_aes128_ctr32_be(len, out, text, keys_b, ctr_block);
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        Hacl_AES_BitSlice_aes256_ctr32_be(len, out, text, keys_b, ctr_block);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+static void
+hacl_aes_encrypt_block(
+  Spec_Cipher_Expansion_impl i,
+  uint8_t *out,
+  uint8_t *text,
+  uint8_t *keys_b
+)
+{
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        Hacl_AES_BitSlice_aes128_encrypt_block(out, text, keys_b);
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        Hacl_AES_BitSlice_aes256_encrypt_block(out, text, keys_b);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+static uint32_t hacl_keys_len(Spec_Cipher_Expansion_impl i)
+{
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        return (uint32_t)704U;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        return (uint32_t)960U;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+/* The pre-counter block J0 of NIST SP 800-38D: the IV followed by a counter of
+   one for 96-bit IVs, the GHASH of the padded IV and its bit length
+   otherwise. */
+static void gcm_hacl_j0(uint8_t *h, uint8_t *iv, uint32_t iv_len, uint8_t *j0)
+{
+  if (iv_len == (uint32_t)12U)
+  {
+    memcpy(j0, iv, (uint32_t)12U * sizeof (uint8_t));
+    store32_be(j0 + (uint32_t)12U, (uint32_t)1U);
+    return;
+  }
+  uint64_t ctx[8U] = { 0U };
+  uint8_t len_block[16U] = { 0U };
+  store64_be(len_block + (uint32_t)8U, (uint64_t)iv_len * (uint64_t)8U);
+  Hacl_Gf128_CT64_gcm_init(ctx, h);
+  Hacl_Gf128_CT64_gcm_update_blocks(ctx, iv_len, iv);
+  Hacl_Gf128_CT64_gcm_update_blocks(ctx, (uint32_t)16U, len_block);
+  Hacl_Gf128_CT64_gcm_emit(j0, ctx);
+}
+
+static void
+gcm_hacl_tag(
+  Spec_Cipher_Expansion_impl i,
+  uint8_t *keys_b,
+  uint8_t *h,
+  uint8_t *j0,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag
+)
+{
+  uint64_t ctx[8U] = { 0U };
+  uint8_t len_block[16U] = { 0U };
+  uint8_t s[16U] = { 0U };
+  uint8_t ek0[16U] = { 0U };
+  store64_be(len_block, (uint64_t)ad_len * (uint64_t)8U);
+  store64_be(len_block + (uint32_t)8U, (uint64_t)cipher_len * (uint64_t)8U);
+  Hacl_Gf128_CT64_gcm_init(ctx, h);
+  Hacl_Gf128_CT64_gcm_update_blocks(ctx, ad_len, ad);
+  Hacl_Gf128_CT64_gcm_update_blocks(ctx, cipher_len, cipher);
+  Hacl_Gf128_CT64_gcm_update_blocks(ctx, (uint32_t)16U, len_block);
+  Hacl_Gf128_CT64_gcm_emit(s, ctx);
+  hacl_aes_encrypt_block(i, ek0, j0, keys_b);
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)16U; j++)
+  {
+    tag[j] = s[j] ^ ek0[j];
+  }
+}
+
+/* AES-GCM on the portable, constant-time implementations, for machines without
+   AES-NI or PCLMULQDQ. The expanded key is the bitsliced round keys followed by
+   the hash key H. */
+static EverCrypt_Error_error_code
+encrypt_aes_gcm_hacl(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  if (iv_len == (uint32_t)0U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl i = scrut.impl;
+  uint8_t *ek = scrut.ek;
+  uint8_t *keys_b = ek;
+  uint8_t *h = ek + hacl_keys_len(i);
+  uint8_t j0[16U] = { 0U };
+  uint8_t ctr_block[16U] = { 0U };
+  gcm_hacl_j0(h, iv, iv_len, j0);
+  memcpy(ctr_block, j0, (uint32_t)16U * sizeof (uint8_t));
+  store32_be(ctr_block + (uint32_t)12U, load32_be(j0 + (uint32_t)12U) + (uint32_t)1U);
+  hacl_aes_ctr32_be(i, plain_len, cipher, plain, keys_b, ctr_block);
+  gcm_hacl_tag(i, keys_b, h, j0, ad, ad_len, cipher, plain_len, tag);
+  return EverCrypt_Error_Success;
+}
+
 EverCrypt_Error_error_code
 EverCrypt_AEAD_encrypt(
   EverCrypt_AEAD_state_s *s,
@@ -429,18 +965,27 @@ EverCrypt_AEAD_encrypt(
   }
   EverCrypt_AEAD_state_s scrut = *s;
   Spec_Cipher_Expansion_impl i = scrut.impl;
+  Spec_Agile_AEAD_alg a = scrut.alg;
   uint8_t *ek = scrut.ek;
-  switch (i)
+  switch (a)
   {
-    case Spec_Cipher_Expansion_Vale_AES128:
+    case Spec_Agile_AEAD_AES128_GCM:
       {
+        if (i == Spec_Cipher_Expansion_Hacl_AES128)
+        {
+          return encrypt_aes_gcm_hacl(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+        }
         return encrypt_aes128_gcm(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
       }
-    case Spec_Cipher_Expansion_Vale_AES256:
+    case Spec_Agile_AEAD_AES256_GCM:
       {
+        if (i == Spec_Cipher_Expansion_Hacl_AES256)
+        {
+          return encrypt_aes_gcm_hacl(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+        }
         return encrypt_aes256_gcm(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
       }
-    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+    case Spec_Agile_AEAD_CHACHA20_POLY1305:
       {
         if (iv_len != (uint32_t)12U)
         {
@@ -449,6 +994,30 @@ EverCrypt_AEAD_encrypt(
         EverCrypt_Chacha20Poly1305_aead_encrypt(ek, iv, ad_len, ad, plain_len, plain, cipher, tag);
         return EverCrypt_Error_Success;
       }
+    case Spec_Agile_AEAD_AES128_GCM_SIV:
+      {
+        return encrypt_aes_gcm_siv(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+      }
+    case Spec_Agile_AEAD_AES256_GCM_SIV:
+      {
+        return encrypt_aes_gcm_siv(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+      }
+    case Spec_Agile_AEAD_XCHACHA20_POLY1305:
+      {
+        if (iv_len != (uint32_t)24U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        EverCrypt_Chacha20Poly1305_xaead_encrypt(ek,
+          iv,
+          ad_len,
+          ad,
+          plain_len,
+          plain,
+          cipher,
+          tag);
+        return EverCrypt_Error_Success;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -483,7 +1052,13 @@ EverCrypt_AEAD_encrypt_expand_aes128_gcm(
     uint8_t *hkeys_b0 = ek + (uint32_t)176U;
     uint64_t scrut0 = aes128_key_expansion(k, keys_b0);
     uint64_t scrut1 = aes128_keyhash_init(keys_b0, hkeys_b0);
-    EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Vale_AES128, .ek = ek };
+    EverCrypt_AEAD_state_s
+    p =
+      {
+        .impl = Spec_Cipher_Expansion_Vale_AES128,
+        .alg = Spec_Agile_AEAD_AES128_GCM,
+        .ek = ek
+      };
     EverCrypt_AEAD_state_s *s = &p;
     EverCrypt_Error_error_code r;
     if (s == NULL)
@@ -593,7 +1168,20 @@ EverCrypt_AEAD_encrypt_expand_aes128_gcm(
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  uint8_t ek[720U] = { 0U };
+  uint8_t zero[16U] = { 0U };
+  uint8_t *keys_b = ek;
+  uint8_t *h_b = ek + (uint32_t)704U;
+  Hacl_AES_BitSlice_aes128_key_expansion(keys_b, k);
+  Hacl_AES_BitSlice_aes128_encrypt_block(h_b, zero, keys_b);
+  EverCrypt_AEAD_state_s
+  p =
+    {
+      .impl = Spec_Cipher_Expansion_Hacl_AES128,
+      .alg = Spec_Agile_AEAD_AES128_GCM,
+      .ek = ek
+    };
+  return encrypt_aes_gcm_hacl(&p, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
 }
 
 EverCrypt_Error_error_code
@@ -622,7 +1210,13 @@ EverCrypt_AEAD_encrypt_expand_aes256_gcm(
     uint8_t *hkeys_b0 = ek + (uint32_t)240U;
     uint64_t scrut0 = aes256_key_expansion(k, keys_b0);
     uint64_t scrut1 = aes256_keyhash_init(keys_b0, hkeys_b0);
-    EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Vale_AES256, .ek = ek };
+    EverCrypt_AEAD_state_s
+    p =
+      {
+        .impl = Spec_Cipher_Expansion_Vale_AES256,
+        .alg = Spec_Agile_AEAD_AES256_GCM,
+        .ek = ek
+      };
     EverCrypt_AEAD_state_s *s = &p;
     EverCrypt_Error_error_code r;
     if (s == NULL)
@@ -732,7 +1326,20 @@ EverCrypt_AEAD_encrypt_expand_aes256_gcm(
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  uint8_t ek[976U] = { 0U };
+  uint8_t zero[16U] = { 0U };
+  uint8_t *keys_b = ek;
+  uint8_t *h_b = ek + (uint32_t)960U;
+  Hacl_AES_BitSlice_aes256_key_expansion(keys_b, k);
+  Hacl_AES_BitSlice_aes256_encrypt_block(h_b, zero, keys_b);
+  EverCrypt_AEAD_state_s
+  p =
+    {
+      .impl = Spec_Cipher_Expansion_Hacl_AES256,
+      .alg = Spec_Agile_AEAD_AES256_GCM,
+      .ek = ek
+    };
+  return encrypt_aes_gcm_hacl(&p, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
 }
 
 EverCrypt_Error_error_code
@@ -749,7 +1356,13 @@ EverCrypt_AEAD_encrypt_expand_chacha20_poly1305(
 )
 {
   uint8_t ek[32U] = { 0U };
-  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_CHACHA20, .ek = ek };
+  EverCrypt_AEAD_state_s
+  p =
+    {
+      .impl = Spec_Cipher_Expansion_Hacl_CHACHA20,
+      .alg = Spec_Agile_AEAD_CHACHA20_POLY1305,
+      .ek = ek
+    };
   memcpy(ek, k, (uint32_t)32U * sizeof (uint8_t));
   EverCrypt_AEAD_state_s *s = &p;
   EverCrypt_AEAD_state_s scrut = *s;
@@ -758,6 +1371,113 @@ EverCrypt_AEAD_encrypt_expand_chacha20_poly1305(
   return EverCrypt_Error_Success;
 }
 
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_expand_aes128_gcm_siv(
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+  bool has_avx = EverCrypt_AutoConfig2_has_avx();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse)
+  {
+    uint8_t ek[304U] = { 0U };
+    uint8_t *keys_b = ek;
+    uint8_t *hkeys_b = ek + (uint32_t)176U;
+    uint64_t scrut = aes128_key_expansion(k, keys_b);
+    uint64_t scrut0 = aes128_keyhash_init(keys_b, hkeys_b);
+    EverCrypt_AEAD_state_s
+    p =
+      {
+        .impl = Spec_Cipher_Expansion_Vale_AES128,
+        .alg = Spec_Agile_AEAD_AES128_GCM_SIV,
+        .ek = ek
+      };
+    EverCrypt_AEAD_state_s *s = &p;
+    return encrypt_aes_gcm_siv(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+  }
+  #endif
+  return EverCrypt_Error_UnsupportedAlgorithm;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_expand_aes256_gcm_siv(
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+  bool has_avx = EverCrypt_AutoConfig2_has_avx();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse)
+  {
+    uint8_t ek[368U] = { 0U };
+    uint8_t *keys_b = ek;
+    uint8_t *hkeys_b = ek + (uint32_t)240U;
+    uint64_t scrut = aes256_key_expansion(k, keys_b);
+    uint64_t scrut0 = aes256_keyhash_init(keys_b, hkeys_b);
+    EverCrypt_AEAD_state_s
+    p =
+      {
+        .impl = Spec_Cipher_Expansion_Vale_AES256,
+        .alg = Spec_Agile_AEAD_AES256_GCM_SIV,
+        .ek = ek
+      };
+    EverCrypt_AEAD_state_s *s = &p;
+    return encrypt_aes_gcm_siv(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+  }
+  #endif
+  return EverCrypt_Error_UnsupportedAlgorithm;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_expand_xchacha20_poly1305(
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  uint8_t ek[32U] = { 0U };
+  EverCrypt_AEAD_state_s
+  p =
+    {
+      .impl = Spec_Cipher_Expansion_Hacl_CHACHA20,
+      .alg = Spec_Agile_AEAD_XCHACHA20_POLY1305,
+      .ek = ek
+    };
+  memcpy(ek, k, (uint32_t)32U * sizeof (uint8_t));
+  EverCrypt_AEAD_state_s *s = &p;
+  EverCrypt_AEAD_state_s scrut = *s;
+  uint8_t *ek0 = scrut.ek;
+  EverCrypt_Chacha20Poly1305_xaead_encrypt(ek0, iv, ad_len, ad, plain_len, plain, cipher, tag);
+  return EverCrypt_Error_Success;
+}
+
 EverCrypt_Error_error_code
 EverCrypt_AEAD_encrypt_expand(
   Spec_Agile_AEAD_alg a,
@@ -777,7 +1497,33 @@ EverCrypt_AEAD_encrypt_expand(
     case Spec_Agile_AEAD_AES128_GCM:
       {
         return
-          EverCrypt_AEAD_encrypt_expand_aes128_gcm(k,
+          EverCrypt_AEAD_encrypt_expand_aes128_gcm(k,
+            iv,
+            iv_len,
+            ad,
+            ad_len,
+            plain,
+            plain_len,
+            cipher,
+            tag);
+      }
+    case Spec_Agile_AEAD_AES256_GCM:
+      {
+        return
+          EverCrypt_AEAD_encrypt_expand_aes256_gcm(k,
+            iv,
+            iv_len,
+            ad,
+            ad_len,
+            plain,
+            plain_len,
+            cipher,
+            tag);
+      }
+    case Spec_Agile_AEAD_CHACHA20_POLY1305:
+      {
+        return
+          EverCrypt_AEAD_encrypt_expand_chacha20_poly1305(k,
             iv,
             iv_len,
             ad,
@@ -787,10 +1533,10 @@ EverCrypt_AEAD_encrypt_expand(
             cipher,
             tag);
       }
-    case Spec_Agile_AEAD_AES256_GCM:
+    case Spec_Agile_AEAD_AES128_GCM_SIV:
       {
         return
-          EverCrypt_AEAD_encrypt_expand_aes256_gcm(k,
+          EverCrypt_AEAD_encrypt_expand_aes128_gcm_siv(k,
             iv,
             iv_len,
             ad,
@@ -800,10 +1546,23 @@ EverCrypt_AEAD_encrypt_expand(
             cipher,
             tag);
       }
-    case Spec_Agile_AEAD_CHACHA20_POLY1305:
+    case Spec_Agile_AEAD_AES256_GCM_SIV:
       {
         return
-          EverCrypt_AEAD_encrypt_expand_chacha20_poly1305(k,
+          EverCrypt_AEAD_encrypt_expand_aes256_gcm_siv(k,
+            iv,
+            iv_len,
+            ad,
+            ad_len,
+            plain,
+            plain_len,
+            cipher,
+            tag);
+      }
+    case Spec_Agile_AEAD_XCHACHA20_POLY1305:
+      {
+        return
+          EverCrypt_AEAD_encrypt_expand_xchacha20_poly1305(k,
             iv,
             iv_len,
             ad,
@@ -945,6 +1704,7 @@ decrypt_aes128_gcm(
   {
     return EverCrypt_Error_Success;
   }
+  memset(dst, 0U, cipher_len * sizeof (uint8_t));
   return EverCrypt_Error_AuthenticationFailure;
   #else
   KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
@@ -1079,6 +1839,7 @@ decrypt_aes256_gcm(
   {
     return EverCrypt_Error_Success;
   }
+  memset(dst, 0U, cipher_len * sizeof (uint8_t));
   return EverCrypt_Error_AuthenticationFailure;
   #else
   KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
@@ -1118,6 +1879,147 @@ decrypt_chacha20_poly1305(
   {
     return EverCrypt_Error_Success;
   }
+  memset(dst, 0U, cipher_len * sizeof (uint8_t));
+  return EverCrypt_Error_AuthenticationFailure;
+}
+
+static EverCrypt_Error_error_code
+decrypt_xchacha20_poly1305(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  if (iv_len != (uint32_t)24U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  uint8_t *ek = scrut.ek;
+  uint32_t
+  r = EverCrypt_Chacha20Poly1305_xaead_decrypt(ek, iv, ad_len, ad, cipher_len, dst, cipher, tag);
+  if (r == (uint32_t)0U)
+  {
+    return EverCrypt_Error_Success;
+  }
+  memset(dst, 0U, cipher_len * sizeof (uint8_t));
+  return EverCrypt_Error_AuthenticationFailure;
+}
+
+static EverCrypt_Error_error_code
+decrypt_aes_gcm_siv(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  if (iv_len != (uint32_t)12U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl i = scrut.impl;
+  uint8_t *ek = scrut.ek;
+  uint8_t auth_key[16U] = { 0U };
+  uint8_t enc_keys_b[240U] = { 0U };
+  uint8_t ctr_block[16U] = { 0U };
+  uint8_t computed_tag[16U] = { 0U };
+  gcm_siv_derive_keys(i, ek, iv, auth_key, enc_keys_b);
+  memcpy(ctr_block, tag, (uint32_t)16U * sizeof (uint8_t));
+  ctr_block[15U] = ctr_block[15U] | (uint8_t)0x80U;
+  aes_ctr32_le(i, cipher_len, dst, cipher, enc_keys_b, ctr_block);
+  gcm_siv_tag(i, auth_key, enc_keys_b, iv, ad, ad_len, dst, cipher_len, computed_tag);
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)16U; j++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed_tag[j], tag[j]);
+    res = uu____0 & res;
+  }
+  uint8_t z = res;
+  if (z == (uint8_t)255U)
+  {
+    return EverCrypt_Error_Success;
+  }
+  memset(dst, 0U, cipher_len * sizeof (uint8_t));
+  return EverCrypt_Error_AuthenticationFailure;
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+/* The tag is checked before decrypting, so that nothing is released on
+   failure. */
+static EverCrypt_Error_error_code
+decrypt_aes_gcm_hacl(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  if (iv_len == (uint32_t)0U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl i = scrut.impl;
+  uint8_t *ek = scrut.ek;
+  uint8_t *keys_b = ek;
+  uint8_t *h = ek + hacl_keys_len(i);
+  uint8_t j0[16U] = { 0U };
+  uint8_t ctr_block[16U] = { 0U };
+  uint8_t computed_tag[16U] = { 0U };
+  gcm_hacl_j0(h, iv, iv_len, j0);
+  gcm_hacl_tag(i, keys_b, h, j0, ad, ad_len, cipher, cipher_len, computed_tag);
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)16U; j++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed_tag[j], tag[j]);
+    res = uu____0 & res;
+  }
+  uint8_t z = res;
+  if (z == (uint8_t)255U)
+  {
+    memcpy(ctr_block, j0, (uint32_t)16U * sizeof (uint8_t));
+    store32_be(ctr_block + (uint32_t)12U, load32_be(j0 + (uint32_t)12U) + (uint32_t)1U);
+    hacl_aes_ctr32_be(i, cipher_len, dst, cipher, keys_b, ctr_block);
+    return EverCrypt_Error_Success;
+  }
+  memset(dst, 0U, cipher_len * sizeof (uint8_t));
   return EverCrypt_Error_AuthenticationFailure;
 }
 
@@ -1140,20 +2042,42 @@ EverCrypt_AEAD_decrypt(
   }
   EverCrypt_AEAD_state_s scrut = *s;
   Spec_Cipher_Expansion_impl i = scrut.impl;
-  switch (i)
+  Spec_Agile_AEAD_alg a = scrut.alg;
+  switch (a)
   {
-    case Spec_Cipher_Expansion_Vale_AES128:
+    case Spec_Agile_AEAD_AES128_GCM:
       {
+        if (i == Spec_Cipher_Expansion_Hacl_AES128)
+        {
+          return decrypt_aes_gcm_hacl(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+        }
         return decrypt_aes128_gcm(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
       }
-    case Spec_Cipher_Expansion_Vale_AES256:
+    case Spec_Agile_AEAD_AES256_GCM:
       {
+        if (i == Spec_Cipher_Expansion_Hacl_AES256)
+        {
+          return decrypt_aes_gcm_hacl(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+        }
         return decrypt_aes256_gcm(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
       }
-    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+    case Spec_Agile_AEAD_CHACHA20_POLY1305:
       {
         return decrypt_chacha20_poly1305(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
       }
+    case Spec_Agile_AEAD_AES128_GCM_SIV:
+      {
+        return decrypt_aes_gcm_siv(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+      }
+    case Spec_Agile_AEAD_AES256_GCM_SIV:
+      {
+        return decrypt_aes_gcm_siv(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+      }
+    case Spec_Agile_AEAD_XCHACHA20_POLY1305:
+      {
+        return
+          decrypt_xchacha20_poly1305(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -1188,7 +2112,13 @@ EverCrypt_AEAD_decrypt_expand_aes128_gcm(
     uint8_t *hkeys_b0 = ek + (uint32_t)176U;
     uint64_t scrut = aes128_key_expansion(k, keys_b0);
     uint64_t scrut0 = aes128_keyhash_init(keys_b0, hkeys_b0);
-    EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Vale_AES128, .ek = ek };
+    EverCrypt_AEAD_state_s
+    p =
+      {
+        .impl = Spec_Cipher_Expansion_Vale_AES128,
+        .alg = Spec_Agile_AEAD_AES128_GCM,
+        .ek = ek
+      };
     EverCrypt_AEAD_state_s *s = &p;
     if (s == NULL)
     {
@@ -1304,12 +2234,26 @@ EverCrypt_AEAD_decrypt_expand_aes128_gcm(
       }
       else
       {
+        memset(dst, 0U, cipher_len * sizeof (uint8_t));
         return EverCrypt_Error_AuthenticationFailure;
       }
     }
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  uint8_t ek[720U] = { 0U };
+  uint8_t zero[16U] = { 0U };
+  uint8_t *keys_b = ek;
+  uint8_t *h_b = ek + (uint32_t)704U;
+  Hacl_AES_BitSlice_aes128_key_expansion(keys_b, k);
+  Hacl_AES_BitSlice_aes128_encrypt_block(h_b, zero, keys_b);
+  EverCrypt_AEAD_state_s
+  p =
+    {
+      .impl = Spec_Cipher_Expansion_Hacl_AES128,
+      .alg = Spec_Agile_AEAD_AES128_GCM,
+      .ek = ek
+    };
+  return decrypt_aes_gcm_hacl(&p, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
 }
 
 EverCrypt_Error_error_code
@@ -1338,7 +2282,13 @@ EverCrypt_AEAD_decrypt_expand_aes256_gcm(
     uint8_t *hkeys_b0 = ek + (uint32_t)240U;
     uint64_t scrut = aes256_key_expansion(k, keys_b0);
     uint64_t scrut0 = aes256_keyhash_init(keys_b0, hkeys_b0);
-    EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Vale_AES256, .ek = ek };
+    EverCrypt_AEAD_state_s
+    p =
+      {
+        .impl = Spec_Cipher_Expansion_Vale_AES256,
+        .alg = Spec_Agile_AEAD_AES256_GCM,
+        .ek = ek
+      };
     EverCrypt_AEAD_state_s *s = &p;
     if (s == NULL)
     {
@@ -1454,12 +2404,26 @@ EverCrypt_AEAD_decrypt_expand_aes256_gcm(
       }
       else
       {
+        memset(dst, 0U, cipher_len * sizeof (uint8_t));
         return EverCrypt_Error_AuthenticationFailure;
       }
     }
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  uint8_t ek[976U] = { 0U };
+  uint8_t zero[16U] = { 0U };
+  uint8_t *keys_b = ek;
+  uint8_t *h_b = ek + (uint32_t)960U;
+  Hacl_AES_BitSlice_aes256_key_expansion(keys_b, k);
+  Hacl_AES_BitSlice_aes256_encrypt_block(h_b, zero, keys_b);
+  EverCrypt_AEAD_state_s
+  p =
+    {
+      .impl = Spec_Cipher_Expansion_Hacl_AES256,
+      .alg = Spec_Agile_AEAD_AES256_GCM,
+      .ek = ek
+    };
+  return decrypt_aes_gcm_hacl(&p, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
 }
 
 EverCrypt_Error_error_code
@@ -1476,7 +2440,13 @@ EverCrypt_AEAD_decrypt_expand_chacha20_poly1305(
 )
 {
   uint8_t ek[32U] = { 0U };
-  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_CHACHA20, .ek = ek };
+  EverCrypt_AEAD_state_s
+  p =
+    {
+      .impl = Spec_Cipher_Expansion_Hacl_CHACHA20,
+      .alg = Spec_Agile_AEAD_CHACHA20_POLY1305,
+      .ek = ek
+    };
   memcpy(ek, k, (uint32_t)32U * sizeof (uint8_t));
   EverCrypt_AEAD_state_s *s = &p;
   EverCrypt_Error_error_code
@@ -1484,6 +2454,112 @@ EverCrypt_AEAD_decrypt_expand_chacha20_poly1305(
   return r;
 }
 
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_expand_aes128_gcm_siv(
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+  bool has_avx = EverCrypt_AutoConfig2_has_avx();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse)
+  {
+    uint8_t ek[304U] = { 0U };
+    uint8_t *keys_b = ek;
+    uint8_t *hkeys_b = ek + (uint32_t)176U;
+    uint64_t scrut = aes128_key_expansion(k, keys_b);
+    uint64_t scrut0 = aes128_keyhash_init(keys_b, hkeys_b);
+    EverCrypt_AEAD_state_s
+    p =
+      {
+        .impl = Spec_Cipher_Expansion_Vale_AES128,
+        .alg = Spec_Agile_AEAD_AES128_GCM_SIV,
+        .ek = ek
+      };
+    EverCrypt_AEAD_state_s *s = &p;
+    return decrypt_aes_gcm_siv(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+  }
+  #endif
+  return EverCrypt_Error_UnsupportedAlgorithm;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_expand_aes256_gcm_siv(
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+  bool has_avx = EverCrypt_AutoConfig2_has_avx();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse)
+  {
+    uint8_t ek[368U] = { 0U };
+    uint8_t *keys_b = ek;
+    uint8_t *hkeys_b = ek + (uint32_t)240U;
+    uint64_t scrut = aes256_key_expansion(k, keys_b);
+    uint64_t scrut0 = aes256_keyhash_init(keys_b, hkeys_b);
+    EverCrypt_AEAD_state_s
+    p =
+      {
+        .impl = Spec_Cipher_Expansion_Vale_AES256,
+        .alg = Spec_Agile_AEAD_AES256_GCM_SIV,
+        .ek = ek
+      };
+    EverCrypt_AEAD_state_s *s = &p;
+    return decrypt_aes_gcm_siv(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+  }
+  #endif
+  return EverCrypt_Error_UnsupportedAlgorithm;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_expand_xchacha20_poly1305(
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  uint8_t ek[32U] = { 0U };
+  EverCrypt_AEAD_state_s
+  p =
+    {
+      .impl = Spec_Cipher_Expansion_Hacl_CHACHA20,
+      .alg = Spec_Agile_AEAD_XCHACHA20_POLY1305,
+      .ek = ek
+    };
+  memcpy(ek, k, (uint32_t)32U * sizeof (uint8_t));
+  EverCrypt_AEAD_state_s *s = &p;
+  EverCrypt_Error_error_code
+  r = decrypt_xchacha20_poly1305(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+  return r;
+}
+
 EverCrypt_Error_error_code
 EverCrypt_AEAD_decrypt_expand(
   Spec_Agile_AEAD_alg a,
@@ -1539,6 +2615,45 @@ EverCrypt_AEAD_decrypt_expand(
             tag,
             dst);
       }
+    case Spec_Agile_AEAD_AES128_GCM_SIV:
+      {
+        return
+          EverCrypt_AEAD_decrypt_expand_aes128_gcm_siv(k,
+            iv,
+            iv_len,
+            ad,
+            ad_len,
+            cipher,
+            cipher_len,
+            tag,
+            dst);
+      }
+    case Spec_Agile_AEAD_AES256_GCM_SIV:
+      {
+        return
+          EverCrypt_AEAD_decrypt_expand_aes256_gcm_siv(k,
+            iv,
+            iv_len,
+            ad,
+            ad_len,
+            cipher,
+            cipher_len,
+            tag,
+            dst);
+      }
+    case Spec_Agile_AEAD_XCHACHA20_POLY1305:
+      {
+        return
+          EverCrypt_AEAD_decrypt_expand_xchacha20_poly1305(k,
+            iv,
+            iv_len,
+            ad,
+            ad_len,
+            cipher,
+            cipher_len,
+            tag,
+            dst);
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
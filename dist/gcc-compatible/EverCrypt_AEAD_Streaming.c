@@ -0,0 +1,1071 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "EverCrypt_AEAD_Streaming.h"
+
+#define EverCrypt_AEAD_Streaming_GHash_s 0
+#define EverCrypt_AEAD_Streaming_Poly1305_32_s 1
+#define EverCrypt_AEAD_Streaming_Poly1305_128_s 2
+
+typedef uint8_t EverCrypt_AEAD_Streaming_mac_state_tags;
+
+typedef struct EverCrypt_AEAD_Streaming_mac_state_s
+{
+  EverCrypt_AEAD_Streaming_mac_state_tags tag;
+  union {
+    Lib_IntVector_Intrinsics_vec128 *case_GHash_s;
+    uint64_t *case_Poly1305_32_s;
+    Lib_IntVector_Intrinsics_vec128 *case_Poly1305_128_s;
+  }
+  ;
+}
+EverCrypt_AEAD_Streaming_mac_state;
+
+#define EverCrypt_AEAD_Streaming_Idle 0
+#define EverCrypt_AEAD_Streaming_Aad 1
+#define EverCrypt_AEAD_Streaming_Data 2
+
+typedef uint8_t EverCrypt_AEAD_Streaming_phase;
+
+typedef struct EverCrypt_AEAD_Streaming_state_s_s
+{
+  Spec_Cipher_Expansion_impl impl;
+  uint8_t *ek;
+  EverCrypt_AEAD_Streaming_mac_state mac;
+  uint8_t *iv;
+  uint8_t *mac_key;
+  uint8_t *ks;
+  uint8_t *buf;
+  EverCrypt_AEAD_Streaming_phase phase;
+  uint64_t aad_len;
+  uint64_t msg_len;
+}
+EverCrypt_AEAD_Streaming_state_s;
+
+Spec_Agile_AEAD_alg EverCrypt_AEAD_Streaming_alg_of_state(EverCrypt_AEAD_Streaming_state_s *s)
+{
+  EverCrypt_AEAD_Streaming_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl impl = scrut.impl;
+  switch (impl)
+  {
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        return Spec_Agile_AEAD_CHACHA20_POLY1305;
+      }
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        return Spec_Agile_AEAD_AES128_GCM;
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        return Spec_Agile_AEAD_AES256_GCM;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        return Spec_Agile_AEAD_AES128_GCM;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        return Spec_Agile_AEAD_AES256_GCM;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+static uint32_t block_len(Spec_Cipher_Expansion_impl i)
+{
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        return (uint32_t)64U;
+      }
+    default:
+      {
+        return (uint32_t)16U;
+      }
+  }
+}
+
+static uint64_t max_msg_len(Spec_Cipher_Expansion_impl i)
+{
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        return (uint64_t)274877906880U;
+      }
+    default:
+      {
+        return (uint64_t)68719476704U;
+      }
+  }
+}
+
+static uint64_t max_aad_len(Spec_Cipher_Expansion_impl i)
+{
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        return (uint64_t)0xffffffffffffffffU;
+      }
+    default:
+      {
+        return (uint64_t)0x1fffffffffffffffU;
+      }
+  }
+}
+
+/* The vectorized Poly1305 state lives on the heap across calls, where only
+   16-byte alignment is guaranteed: the 256-bit implementation is not used. */
+static EverCrypt_AEAD_Streaming_mac_state alloc_poly1305()
+{
+  bool avx = EverCrypt_AutoConfig2_has_avx();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx)
+  {
+    Lib_IntVector_Intrinsics_vec128
+    *ctx = KRML_HOST_CALLOC((uint32_t)25U, sizeof (Lib_IntVector_Intrinsics_vec128));
+    return
+      (
+        (EverCrypt_AEAD_Streaming_mac_state){
+          .tag = EverCrypt_AEAD_Streaming_Poly1305_128_s,
+          { .case_Poly1305_128_s = ctx }
+        }
+      );
+  }
+  #endif
+  uint64_t *ctx = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+  return
+    (
+      (EverCrypt_AEAD_Streaming_mac_state){
+        .tag = EverCrypt_AEAD_Streaming_Poly1305_32_s,
+        { .case_Poly1305_32_s = ctx }
+      }
+    );
+}
+
+static void mac_init(EverCrypt_AEAD_Streaming_mac_state mac, uint8_t *key)
+{
+  switch (mac.tag)
+  {
+    case EverCrypt_AEAD_Streaming_GHash_s:
+      {
+        #if EVERCRYPT_TARGETCONFIG_X64
+        Hacl_Gf128_NI_gcm_init(mac.case_GHash_s, key);
+        #endif
+        break;
+      }
+    case EverCrypt_AEAD_Streaming_Poly1305_32_s:
+      {
+        Hacl_Poly1305_32_poly1305_init(mac.case_Poly1305_32_s, key);
+        break;
+      }
+    case EverCrypt_AEAD_Streaming_Poly1305_128_s:
+      {
+        #if EVERCRYPT_TARGETCONFIG_X64
+        Hacl_Poly1305_128_poly1305_init(mac.case_Poly1305_128_s, key);
+        #endif
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+/* len is a multiple of 16 */
+static void
+mac_update_blocks(EverCrypt_AEAD_Streaming_mac_state mac, uint32_t len, uint8_t *text)
+{
+  switch (mac.tag)
+  {
+    case EverCrypt_AEAD_Streaming_GHash_s:
+      {
+        #if EVERCRYPT_TARGETCONFIG_X64
+        Hacl_Gf128_NI_gcm_update_blocks(mac.case_GHash_s, len, text);
+        #endif
+        break;
+      }
+    case EverCrypt_AEAD_Streaming_Poly1305_32_s:
+      {
+        Hacl_Poly1305_32_poly1305_update(mac.case_Poly1305_32_s, len, text);
+        break;
+      }
+    case EverCrypt_AEAD_Streaming_Poly1305_128_s:
+      {
+        #if EVERCRYPT_TARGETCONFIG_X64
+        Hacl_Poly1305_128_poly1305_update(mac.case_Poly1305_128_s, len, text);
+        #endif
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+static void mac_free(EverCrypt_AEAD_Streaming_mac_state mac)
+{
+  switch (mac.tag)
+  {
+    case EverCrypt_AEAD_Streaming_GHash_s:
+      {
+        KRML_HOST_FREE(mac.case_GHash_s);
+        break;
+      }
+    case EverCrypt_AEAD_Streaming_Poly1305_32_s:
+      {
+        KRML_HOST_FREE(mac.case_Poly1305_32_s);
+        break;
+      }
+    case EverCrypt_AEAD_Streaming_Poly1305_128_s:
+      {
+        KRML_HOST_FREE(mac.case_Poly1305_128_s);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+/* Vale's GCTR takes the counter block byte-reversed, so that the 32-bit
+   counter of GCM is the little-endian word at offset 0. */
+static void gcm_counter(uint8_t *ctr, uint8_t *j0, uint32_t n)
+{
+  memcpy(ctr, j0, (uint32_t)16U * sizeof (uint8_t));
+  uint32_t c = load32_le(ctr);
+  store32_le(ctr, c + n);
+}
+
+static void
+gctr_bytes(
+  Spec_Cipher_Expansion_impl i,
+  uint8_t *keys_b,
+  uint8_t *ctr_b,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *in
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  uint8_t inout_b[16U] = { 0U };
+  uint64_t num_blocks = (uint64_t)(len / (uint32_t)16U);
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        uint64_t
+        scrut = gctr128_bytes(in, (uint64_t)len, out, inout_b, keys_b, ctr_b, num_blocks);
+        break;
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        uint64_t
+        scrut = gctr256_bytes(in, (uint64_t)len, out, inout_b, keys_b, ctr_b, num_blocks);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+/* Encrypts len bytes (a multiple of the block length) starting at block blk of
+   the message. */
+static void
+ctr_blocks(EverCrypt_AEAD_Streaming_state_s *s, uint64_t blk, uint32_t len, uint8_t *out, uint8_t *in)
+{
+  EverCrypt_AEAD_Streaming_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl i = scrut.impl;
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        EverCrypt_Cipher_chacha20(len, out, in, scrut.ek, scrut.iv, (uint32_t)blk + (uint32_t)1U);
+        break;
+      }
+    default:
+      {
+        uint8_t ctr_b[16U] = { 0U };
+        gcm_counter(ctr_b, scrut.iv, (uint32_t)blk + (uint32_t)1U);
+        gctr_bytes(i, scrut.ek, ctr_b, len, out, in);
+      }
+  }
+}
+
+static void
+cipher_update(EverCrypt_AEAD_Streaming_state_s *s, uint32_t len, uint8_t *out, uint8_t *in)
+{
+  EverCrypt_AEAD_Streaming_state_s scrut = *s;
+  uint8_t *ks = scrut.ks;
+  uint32_t bl = block_len(scrut.impl);
+  uint32_t off = (uint32_t)(scrut.msg_len % (uint64_t)bl);
+  uint32_t n0 = (uint32_t)0U;
+  if (off > (uint32_t)0U)
+  {
+    if (len < bl - off)
+    {
+      n0 = len;
+    }
+    else
+    {
+      n0 = bl - off;
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < n0; i++)
+  {
+    out[i] = in[i] ^ ks[off + i];
+  }
+  uint64_t blk = (scrut.msg_len + (uint64_t)n0) / (uint64_t)bl;
+  uint32_t len1 = len - n0;
+  uint32_t nb = len1 / bl;
+  uint32_t rem = len1 % bl;
+  uint8_t *out1 = out + n0;
+  uint8_t *in1 = in + n0;
+  if (nb > (uint32_t)0U)
+  {
+    ctr_blocks(s, blk, nb * bl, out1, in1);
+  }
+  if (rem > (uint32_t)0U)
+  {
+    uint8_t *out2 = out1 + nb * bl;
+    uint8_t *in2 = in1 + nb * bl;
+    uint8_t zeros[64U] = { 0U };
+    ctr_blocks(s, blk + (uint64_t)nb, bl, ks, zeros);
+    for (uint32_t i = (uint32_t)0U; i < rem; i++)
+    {
+      out2[i] = in2[i] ^ ks[i];
+    }
+  }
+}
+
+/* Feeds len bytes of MAC input, total bytes of the current segment (AAD or
+   ciphertext) having been fed so far. */
+static void
+mac_absorb(EverCrypt_AEAD_Streaming_state_s *s, uint64_t total, uint32_t len, uint8_t *text)
+{
+  EverCrypt_AEAD_Streaming_state_s scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint32_t sz = (uint32_t)(total % (uint64_t)16U);
+  uint32_t n0 = (uint32_t)0U;
+  if (sz > (uint32_t)0U)
+  {
+    if (len < (uint32_t)16U - sz)
+    {
+      n0 = len;
+    }
+    else
+    {
+      n0 = (uint32_t)16U - sz;
+    }
+    memcpy(buf + sz, text, n0 * sizeof (uint8_t));
+    if (sz + n0 == (uint32_t)16U)
+    {
+      mac_update_blocks(scrut.mac, (uint32_t)16U, buf);
+    }
+  }
+  uint32_t len1 = len - n0;
+  uint32_t full = len1 / (uint32_t)16U * (uint32_t)16U;
+  if (full > (uint32_t)0U)
+  {
+    mac_update_blocks(scrut.mac, full, text + n0);
+  }
+  memcpy(buf, text + n0 + full, (len1 - full) * sizeof (uint8_t));
+}
+
+/* Zero-pads the current segment to a multiple of 16 bytes. */
+static void mac_pad(EverCrypt_AEAD_Streaming_state_s *s, uint64_t total)
+{
+  EverCrypt_AEAD_Streaming_state_s scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint32_t sz = (uint32_t)(total % (uint64_t)16U);
+  if (sz > (uint32_t)0U)
+  {
+    memset(buf + sz, 0U, ((uint32_t)16U - sz) * sizeof (uint8_t));
+    mac_update_blocks(scrut.mac, (uint32_t)16U, buf);
+  }
+}
+
+static EverCrypt_Error_error_code
+create_in_(
+  Spec_Cipher_Expansion_impl i,
+  EverCrypt_AEAD_Streaming_mac_state mac,
+  uint8_t *ek,
+  EverCrypt_AEAD_Streaming_state_s **dst
+)
+{
+  uint8_t *iv = KRML_HOST_CALLOC((uint32_t)16U, sizeof (uint8_t));
+  uint8_t *mac_key = KRML_HOST_CALLOC((uint32_t)32U, sizeof (uint8_t));
+  uint8_t *ks = KRML_HOST_CALLOC((uint32_t)64U, sizeof (uint8_t));
+  uint8_t *buf = KRML_HOST_CALLOC((uint32_t)16U, sizeof (uint8_t));
+  KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_Streaming_state_s), (uint32_t)1U);
+  EverCrypt_AEAD_Streaming_state_s
+  *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_Streaming_state_s));
+  p[0U]
+  =
+    (
+      (EverCrypt_AEAD_Streaming_state_s){
+        .impl = i,
+        .ek = ek,
+        .mac = mac,
+        .iv = iv,
+        .mac_key = mac_key,
+        .ks = ks,
+        .buf = buf,
+        .phase = EverCrypt_AEAD_Streaming_Idle,
+        .aad_len = (uint64_t)0U,
+        .msg_len = (uint64_t)0U
+      }
+    );
+  *dst = p;
+  return EverCrypt_Error_Success;
+}
+
+static EverCrypt_Error_error_code
+create_in_chacha20_poly1305(EverCrypt_AEAD_Streaming_state_s **dst, uint8_t *k)
+{
+  uint8_t *ek = KRML_HOST_CALLOC((uint32_t)32U, sizeof (uint8_t));
+  memcpy(ek, k, (uint32_t)32U * sizeof (uint8_t));
+  EverCrypt_AEAD_Streaming_mac_state mac = alloc_poly1305();
+  return create_in_(Spec_Cipher_Expansion_Hacl_CHACHA20, mac, ek, dst);
+}
+
+static EverCrypt_Error_error_code
+create_in_aes128_gcm(EverCrypt_AEAD_Streaming_state_s **dst, uint8_t *k)
+{
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+  bool has_avx = EverCrypt_AutoConfig2_has_avx();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  {
+    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)304U, sizeof (uint8_t));
+    uint8_t *keys_b = ek;
+    uint8_t *hkeys_b = ek + (uint32_t)176U;
+    uint64_t scrut = aes128_key_expansion(k, keys_b);
+    uint64_t scrut0 = aes128_keyhash_init(keys_b, hkeys_b);
+    Lib_IntVector_Intrinsics_vec128
+    *ctx = KRML_HOST_CALLOC((uint32_t)9U, sizeof (Lib_IntVector_Intrinsics_vec128));
+    EverCrypt_AEAD_Streaming_mac_state
+    mac = { .tag = EverCrypt_AEAD_Streaming_GHash_s, { .case_GHash_s = ctx } };
+    uint8_t zeros[16U] = { 0U };
+    uint8_t ctr0[16U] = { 0U };
+    uint8_t h[16U] = { 0U };
+    gctr_bytes(Spec_Cipher_Expansion_Vale_AES128, keys_b, ctr0, (uint32_t)16U, h, zeros);
+    mac_init(mac, h);
+    return create_in_(Spec_Cipher_Expansion_Vale_AES128, mac, ek, dst);
+  }
+  #endif
+  return EverCrypt_Error_UnsupportedAlgorithm;
+}
+
+static EverCrypt_Error_error_code
+create_in_aes256_gcm(EverCrypt_AEAD_Streaming_state_s **dst, uint8_t *k)
+{
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+  bool has_avx = EverCrypt_AutoConfig2_has_avx();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  {
+    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)368U, sizeof (uint8_t));
+    uint8_t *keys_b = ek;
+    uint8_t *hkeys_b = ek + (uint32_t)240U;
+    uint64_t scrut = aes256_key_expansion(k, keys_b);
+    uint64_t scrut0 = aes256_keyhash_init(keys_b, hkeys_b);
+    Lib_IntVector_Intrinsics_vec128
+    *ctx = KRML_HOST_CALLOC((uint32_t)9U, sizeof (Lib_IntVector_Intrinsics_vec128));
+    EverCrypt_AEAD_Streaming_mac_state
+    mac = { .tag = EverCrypt_AEAD_Streaming_GHash_s, { .case_GHash_s = ctx } };
+    uint8_t zeros[16U] = { 0U };
+    uint8_t ctr0[16U] = { 0U };
+    uint8_t h[16U] = { 0U };
+    gctr_bytes(Spec_Cipher_Expansion_Vale_AES256, keys_b, ctr0, (uint32_t)16U, h, zeros);
+    mac_init(mac, h);
+    return create_in_(Spec_Cipher_Expansion_Vale_AES256, mac, ek, dst);
+  }
+  #endif
+  return EverCrypt_Error_UnsupportedAlgorithm;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Streaming_create_in(
+  Spec_Agile_AEAD_alg a,
+  EverCrypt_AEAD_Streaming_state_s **dst,
+  uint8_t *k
+)
+{
+  switch (a)
+  {
+    case Spec_Agile_AEAD_AES128_GCM:
+      {
+        return create_in_aes128_gcm(dst, k);
+      }
+    case Spec_Agile_AEAD_AES256_GCM:
+      {
+        return create_in_aes256_gcm(dst, k);
+      }
+    case Spec_Agile_AEAD_CHACHA20_POLY1305:
+      {
+        return create_in_chacha20_poly1305(dst, k);
+      }
+    default:
+      {
+        return EverCrypt_Error_UnsupportedAlgorithm;
+      }
+  }
+}
+
+static void init_aes_gcm(EverCrypt_AEAD_Streaming_state_s *s, uint8_t *iv, uint32_t iv_len)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  EverCrypt_AEAD_Streaming_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl i = scrut.impl;
+  uint8_t *keys_b = scrut.ek;
+  uint8_t *hkeys_b;
+  if (i == Spec_Cipher_Expansion_Vale_AES128)
+  {
+    hkeys_b = scrut.ek + (uint32_t)176U;
+  }
+  else
+  {
+    hkeys_b = scrut.ek + (uint32_t)240U;
+  }
+  uint8_t tmp_iv[16U] = { 0U };
+  uint32_t len = iv_len / (uint32_t)16U;
+  uint32_t bytes_len = len * (uint32_t)16U;
+  uint8_t *iv_b = iv;
+  memcpy(tmp_iv, iv + bytes_len, iv_len % (uint32_t)16U * sizeof (uint8_t));
+  uint64_t
+  uu____0 = compute_iv_stdcall(iv_b, (uint64_t)iv_len, (uint64_t)len, tmp_iv, tmp_iv, hkeys_b);
+  memcpy(scrut.iv, tmp_iv, (uint32_t)16U * sizeof (uint8_t));
+  uint8_t zeros[16U] = { 0U };
+  gctr_bytes(i, keys_b, tmp_iv, (uint32_t)16U, scrut.mac_key, zeros);
+  EverCrypt_AEAD_Streaming_mac_state mac = scrut.mac;
+  if (mac.tag == EverCrypt_AEAD_Streaming_GHash_s)
+  {
+    Hacl_Gf128_NI_gcm_reset(mac.case_GHash_s);
+  }
+  else
+  {
+    KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+      __FILE__,
+      __LINE__,
+      "unreachable (pattern matches are exhaustive in F*)");
+    KRML_HOST_EXIT(255U);
+  }
+  #endif
+}
+
+static void init_chacha20_poly1305(EverCrypt_AEAD_Streaming_state_s *s, uint8_t *iv)
+{
+  EverCrypt_AEAD_Streaming_state_s scrut = *s;
+  memcpy(scrut.iv, iv, (uint32_t)12U * sizeof (uint8_t));
+  uint8_t tmp[64U] = { 0U };
+  EverCrypt_Cipher_chacha20((uint32_t)64U, tmp, tmp, scrut.ek, scrut.iv, (uint32_t)0U);
+  memcpy(scrut.mac_key, tmp, (uint32_t)32U * sizeof (uint8_t));
+  mac_init(scrut.mac, scrut.mac_key);
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Streaming_init(
+  EverCrypt_AEAD_Streaming_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  EverCrypt_AEAD_Streaming_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl i = scrut.impl;
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        if (iv_len != (uint32_t)12U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        init_chacha20_poly1305(s, iv);
+        break;
+      }
+    default:
+      {
+        if (iv_len == (uint32_t)0U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        init_aes_gcm(s, iv, iv_len);
+      }
+  }
+  s[0U]
+  =
+    (
+      (EverCrypt_AEAD_Streaming_state_s){
+        .impl = scrut.impl,
+        .ek = scrut.ek,
+        .mac = scrut.mac,
+        .iv = scrut.iv,
+        .mac_key = scrut.mac_key,
+        .ks = scrut.ks,
+        .buf = scrut.buf,
+        .phase = EverCrypt_AEAD_Streaming_Aad,
+        .aad_len = (uint64_t)0U,
+        .msg_len = (uint64_t)0U
+      }
+    );
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Streaming_update_aad(
+  EverCrypt_AEAD_Streaming_state_s *s,
+  uint8_t *ad,
+  uint32_t ad_len
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  EverCrypt_AEAD_Streaming_state_s scrut = *s;
+  if (scrut.phase != EverCrypt_AEAD_Streaming_Aad)
+  {
+    return EverCrypt_Error_InvalidState;
+  }
+  if ((uint64_t)ad_len > max_aad_len(scrut.impl) - scrut.aad_len)
+  {
+    return EverCrypt_Error_MaximumLengthExceeded;
+  }
+  mac_absorb(s, scrut.aad_len, ad_len, ad);
+  s[0U]
+  =
+    (
+      (EverCrypt_AEAD_Streaming_state_s){
+        .impl = scrut.impl,
+        .ek = scrut.ek,
+        .mac = scrut.mac,
+        .iv = scrut.iv,
+        .mac_key = scrut.mac_key,
+        .ks = scrut.ks,
+        .buf = scrut.buf,
+        .phase = scrut.phase,
+        .aad_len = scrut.aad_len + (uint64_t)ad_len,
+        .msg_len = scrut.msg_len
+      }
+    );
+  return EverCrypt_Error_Success;
+}
+
+/* Checks that len more bytes of message may be processed, and closes the AAD
+   segment if this is the first chunk of message. */
+static EverCrypt_Error_error_code
+update_pre(EverCrypt_AEAD_Streaming_state_s *s, uint32_t len)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  EverCrypt_AEAD_Streaming_state_s scrut = *s;
+  if (scrut.phase == EverCrypt_AEAD_Streaming_Idle)
+  {
+    return EverCrypt_Error_InvalidState;
+  }
+  if ((uint64_t)len > max_msg_len(scrut.impl) - scrut.msg_len)
+  {
+    return EverCrypt_Error_MaximumLengthExceeded;
+  }
+  if (scrut.phase == EverCrypt_AEAD_Streaming_Aad)
+  {
+    mac_pad(s, scrut.aad_len);
+    s[0U]
+    =
+      (
+        (EverCrypt_AEAD_Streaming_state_s){
+          .impl = scrut.impl,
+          .ek = scrut.ek,
+          .mac = scrut.mac,
+          .iv = scrut.iv,
+          .mac_key = scrut.mac_key,
+          .ks = scrut.ks,
+          .buf = scrut.buf,
+          .phase = EverCrypt_AEAD_Streaming_Data,
+          .aad_len = scrut.aad_len,
+          .msg_len = scrut.msg_len
+        }
+      );
+  }
+  return EverCrypt_Error_Success;
+}
+
+static void incr_msg_len(EverCrypt_AEAD_Streaming_state_s *s, uint32_t len)
+{
+  EverCrypt_AEAD_Streaming_state_s scrut = *s;
+  s[0U]
+  =
+    (
+      (EverCrypt_AEAD_Streaming_state_s){
+        .impl = scrut.impl,
+        .ek = scrut.ek,
+        .mac = scrut.mac,
+        .iv = scrut.iv,
+        .mac_key = scrut.mac_key,
+        .ks = scrut.ks,
+        .buf = scrut.buf,
+        .phase = scrut.phase,
+        .aad_len = scrut.aad_len,
+        .msg_len = scrut.msg_len + (uint64_t)len
+      }
+    );
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Streaming_encrypt_update(
+  EverCrypt_AEAD_Streaming_state_s *s,
+  uint8_t *plain,
+  uint32_t len,
+  uint8_t *cipher
+)
+{
+  EverCrypt_Error_error_code r = update_pre(s, len);
+  if (r != EverCrypt_Error_Success)
+  {
+    return r;
+  }
+  EverCrypt_AEAD_Streaming_state_s scrut = *s;
+  cipher_update(s, len, cipher, plain);
+  mac_absorb(s, scrut.msg_len, len, cipher);
+  incr_msg_len(s, len);
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Streaming_decrypt_update(
+  EverCrypt_AEAD_Streaming_state_s *s,
+  uint8_t *cipher,
+  uint32_t len,
+  uint8_t *plain
+)
+{
+  EverCrypt_Error_error_code r = update_pre(s, len);
+  if (r != EverCrypt_Error_Success)
+  {
+    return r;
+  }
+  EverCrypt_AEAD_Streaming_state_s scrut = *s;
+  mac_absorb(s, scrut.msg_len, len, cipher);
+  cipher_update(s, len, plain, cipher);
+  incr_msg_len(s, len);
+  return EverCrypt_Error_Success;
+}
+
+static void finish_(EverCrypt_AEAD_Streaming_state_s *s, uint8_t *tag)
+{
+  EverCrypt_AEAD_Streaming_state_s scrut = *s;
+  if (scrut.phase == EverCrypt_AEAD_Streaming_Aad)
+  {
+    mac_pad(s, scrut.aad_len);
+  }
+  else
+  {
+    mac_pad(s, scrut.msg_len);
+  }
+  uint8_t block[16U] = { 0U };
+  EverCrypt_AEAD_Streaming_mac_state mac = scrut.mac;
+  switch (mac.tag)
+  {
+    case EverCrypt_AEAD_Streaming_GHash_s:
+      {
+        #if EVERCRYPT_TARGETCONFIG_X64
+        store64_be(block, scrut.aad_len * (uint64_t)8U);
+        store64_be(block + (uint32_t)8U, scrut.msg_len * (uint64_t)8U);
+        Hacl_Gf128_NI_gcm_update_blocks(mac.case_GHash_s, (uint32_t)16U, block);
+        Hacl_Gf128_NI_gcm_emit(tag, mac.case_GHash_s);
+        for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+        {
+          tag[i] = tag[i] ^ scrut.mac_key[i];
+        }
+        #endif
+        break;
+      }
+    case EverCrypt_AEAD_Streaming_Poly1305_32_s:
+      {
+        store64_le(block, scrut.aad_len);
+        store64_le(block + (uint32_t)8U, scrut.msg_len);
+        Hacl_Poly1305_32_poly1305_update(mac.case_Poly1305_32_s, (uint32_t)16U, block);
+        Hacl_Poly1305_32_poly1305_finish(tag, scrut.mac_key, mac.case_Poly1305_32_s);
+        break;
+      }
+    case EverCrypt_AEAD_Streaming_Poly1305_128_s:
+      {
+        #if EVERCRYPT_TARGETCONFIG_X64
+        store64_le(block, scrut.aad_len);
+        store64_le(block + (uint32_t)8U, scrut.msg_len);
+        Hacl_Poly1305_128_poly1305_update(mac.case_Poly1305_128_s, (uint32_t)16U, block);
+        Hacl_Poly1305_128_poly1305_finish(tag, scrut.mac_key, mac.case_Poly1305_128_s);
+        #endif
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+  s[0U]
+  =
+    (
+      (EverCrypt_AEAD_Streaming_state_s){
+        .impl = scrut.impl,
+        .ek = scrut.ek,
+        .mac = scrut.mac,
+        .iv = scrut.iv,
+        .mac_key = scrut.mac_key,
+        .ks = scrut.ks,
+        .buf = scrut.buf,
+        .phase = EverCrypt_AEAD_Streaming_Idle,
+        .aad_len = scrut.aad_len,
+        .msg_len = scrut.msg_len
+      }
+    );
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Streaming_encrypt_finish(EverCrypt_AEAD_Streaming_state_s *s, uint8_t *tag)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  EverCrypt_AEAD_Streaming_state_s scrut = *s;
+  if (scrut.phase == EverCrypt_AEAD_Streaming_Idle)
+  {
+    return EverCrypt_Error_InvalidState;
+  }
+  finish_(s, tag);
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Streaming_decrypt_finish(EverCrypt_AEAD_Streaming_state_s *s, uint8_t *tag)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  EverCrypt_AEAD_Streaming_state_s scrut = *s;
+  if (scrut.phase == EverCrypt_AEAD_Streaming_Idle)
+  {
+    return EverCrypt_Error_InvalidState;
+  }
+  uint8_t computed_tag[16U] = { 0U };
+  finish_(s, computed_tag);
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed_tag[i], tag[i]);
+    res = uu____0 & res;
+  }
+  uint8_t z = res;
+  if (z == (uint8_t)255U)
+  {
+    return EverCrypt_Error_Success;
+  }
+  return EverCrypt_Error_AuthenticationFailure;
+}
+
+static EverCrypt_Error_error_code
+update_aad_iov(
+  EverCrypt_AEAD_Streaming_state_s *s,
+  EverCrypt_AEAD_Streaming_iovec *ad,
+  uint32_t ad_cnt
+)
+{
+  EverCrypt_Error_error_code res = EverCrypt_Error_Success;
+  for (uint32_t i = (uint32_t)0U; i < ad_cnt; i++)
+  {
+    EverCrypt_AEAD_Streaming_iovec v = ad[i];
+    if (res == EverCrypt_Error_Success)
+    {
+      res = EverCrypt_AEAD_Streaming_update_aad(s, v.iov_base, v.iov_len);
+    }
+  }
+  return res;
+}
+
+/* Total length of the fragments, or MaximumLengthExceeded if it does not fit
+   in 32 bits. */
+static EverCrypt_Error_error_code
+iov_len(EverCrypt_AEAD_Streaming_iovec *v, uint32_t cnt, uint32_t *len)
+{
+  EverCrypt_Error_error_code res = EverCrypt_Error_Success;
+  uint32_t total = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < cnt; i++)
+  {
+    uint32_t l = v[i].iov_len;
+    if (l > (uint32_t)0xffffffffU - total)
+    {
+      res = EverCrypt_Error_MaximumLengthExceeded;
+    }
+    else
+    {
+      total = total + l;
+    }
+  }
+  len[0U] = total;
+  return res;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Streaming_encrypt_iov(
+  EverCrypt_AEAD_Streaming_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  EverCrypt_AEAD_Streaming_iovec *ad,
+  uint32_t ad_cnt,
+  EverCrypt_AEAD_Streaming_iovec *plain,
+  uint32_t plain_cnt,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  uint32_t len = (uint32_t)0U;
+  EverCrypt_Error_error_code r0 = iov_len(plain, plain_cnt, &len);
+  if (r0 != EverCrypt_Error_Success)
+  {
+    return r0;
+  }
+  EverCrypt_Error_error_code r1 = EverCrypt_AEAD_Streaming_init(s, iv, iv_len);
+  if (r1 != EverCrypt_Error_Success)
+  {
+    return r1;
+  }
+  EverCrypt_Error_error_code r2 = update_aad_iov(s, ad, ad_cnt);
+  if (r2 != EverCrypt_Error_Success)
+  {
+    return r2;
+  }
+  EverCrypt_Error_error_code res = EverCrypt_Error_Success;
+  uint32_t off = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < plain_cnt; i++)
+  {
+    EverCrypt_AEAD_Streaming_iovec v = plain[i];
+    if (res == EverCrypt_Error_Success)
+    {
+      res = EverCrypt_AEAD_Streaming_encrypt_update(s, v.iov_base, v.iov_len, cipher + off);
+      off = off + v.iov_len;
+    }
+  }
+  if (res != EverCrypt_Error_Success)
+  {
+    return res;
+  }
+  return EverCrypt_AEAD_Streaming_encrypt_finish(s, tag);
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Streaming_decrypt_iov(
+  EverCrypt_AEAD_Streaming_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  EverCrypt_AEAD_Streaming_iovec *ad,
+  uint32_t ad_cnt,
+  EverCrypt_AEAD_Streaming_iovec *cipher,
+  uint32_t cipher_cnt,
+  uint8_t *plain,
+  uint8_t *tag
+)
+{
+  uint32_t len = (uint32_t)0U;
+  EverCrypt_Error_error_code r0 = iov_len(cipher, cipher_cnt, &len);
+  if (r0 != EverCrypt_Error_Success)
+  {
+    return r0;
+  }
+  EverCrypt_Error_error_code res = EverCrypt_AEAD_Streaming_init(s, iv, iv_len);
+  if (res == EverCrypt_Error_Success)
+  {
+    res = update_aad_iov(s, ad, ad_cnt);
+  }
+  uint32_t off = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < cipher_cnt; i++)
+  {
+    EverCrypt_AEAD_Streaming_iovec v = cipher[i];
+    if (res == EverCrypt_Error_Success)
+    {
+      res = EverCrypt_AEAD_Streaming_decrypt_update(s, v.iov_base, v.iov_len, plain + off);
+      off = off + v.iov_len;
+    }
+  }
+  if (res == EverCrypt_Error_Success)
+  {
+    res = EverCrypt_AEAD_Streaming_decrypt_finish(s, tag);
+  }
+  if (res != EverCrypt_Error_Success)
+  {
+    memset(plain, 0U, len * sizeof (uint8_t));
+  }
+  return res;
+}
+
+void EverCrypt_AEAD_Streaming_free(EverCrypt_AEAD_Streaming_state_s *s)
+{
+  EverCrypt_AEAD_Streaming_state_s scrut = *s;
+  mac_free(scrut.mac);
+  KRML_HOST_FREE(scrut.ek);
+  KRML_HOST_FREE(scrut.iv);
+  KRML_HOST_FREE(scrut.mac_key);
+  KRML_HOST_FREE(scrut.ks);
+  KRML_HOST_FREE(scrut.buf);
+  KRML_HOST_FREE(s);
+}
+
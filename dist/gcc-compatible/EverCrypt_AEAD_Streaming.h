@@ -0,0 +1,191 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __EverCrypt_AEAD_Streaming_H
+#define __EverCrypt_AEAD_Streaming_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Poly1305_32.h"
+#include "Hacl_Poly1305_128.h"
+#include "Hacl_Kremlib.h"
+#include "Hacl_Gf128_NI.h"
+#include "EverCrypt_Cipher.h"
+#include "Vale.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Error.h"
+#include "Hacl_Spec.h"
+
+/*
+A streaming (incremental) interface for AES-GCM and ChaCha20-Poly1305.
+
+A state holds an expanded key and is used for any number of messages. Each
+message is processed as follows:
+- `init` with a fresh IV;
+- any number of `update_aad` calls;
+- any number of `encrypt_update` (resp. `decrypt_update`) calls;
+- `encrypt_finish` (resp. `decrypt_finish`), which returns to the initial
+  state; a new IV must be provided before processing the next message.
+
+Calls that do not follow this protocol return `InvalidState`. Inputs may be
+split at arbitrary byte boundaries; the result is the same as for
+`EverCrypt_AEAD_encrypt` over the concatenated inputs.
+
+WARNING: `decrypt_update` releases plaintext before it has been authenticated.
+The tag is only verified by `decrypt_finish`; callers must not act on the
+plaintext of a message until `decrypt_finish` has returned `Success`.
+*/
+typedef struct EverCrypt_AEAD_Streaming_state_s_s EverCrypt_AEAD_Streaming_state_s;
+
+Spec_Agile_AEAD_alg EverCrypt_AEAD_Streaming_alg_of_state(EverCrypt_AEAD_Streaming_state_s *s);
+
+/*
+Allocate a state for algorithm `a` with key `k`. Returns `UnsupportedAlgorithm`
+if no implementation of `a` is available on this CPU.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Streaming_create_in(
+  Spec_Agile_AEAD_alg a,
+  EverCrypt_AEAD_Streaming_state_s **dst,
+  uint8_t *k
+);
+
+/*
+Start a new message with nonce `iv`, discarding any message in progress.
+ChaCha20-Poly1305 requires a 12-byte nonce; AES-GCM accepts any non-zero length.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Streaming_init(
+  EverCrypt_AEAD_Streaming_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len
+);
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Streaming_update_aad(
+  EverCrypt_AEAD_Streaming_state_s *s,
+  uint8_t *ad,
+  uint32_t ad_len
+);
+
+/*
+Encrypt `len` bytes of `plain` into `cipher`. The two buffers may be equal.
+Returns `MaximumLengthExceeded` if the total length of the message would exceed
+the limit of the algorithm, in which case nothing is written.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Streaming_encrypt_update(
+  EverCrypt_AEAD_Streaming_state_s *s,
+  uint8_t *plain,
+  uint32_t len,
+  uint8_t *cipher
+);
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Streaming_encrypt_finish(EverCrypt_AEAD_Streaming_state_s *s, uint8_t *tag);
+
+/*
+Decrypt `len` bytes of `cipher` into `plain`. The two buffers may be equal.
+The resulting plaintext is NOT authenticated; see the warning above.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Streaming_decrypt_update(
+  EverCrypt_AEAD_Streaming_state_s *s,
+  uint8_t *cipher,
+  uint32_t len,
+  uint8_t *plain
+);
+
+/*
+Check `tag` against the message processed since `init`. Returns
+`AuthenticationFailure` on mismatch; the plaintext released by
+`decrypt_update` must then be discarded.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Streaming_decrypt_finish(EverCrypt_AEAD_Streaming_state_s *s, uint8_t *tag);
+
+typedef struct EverCrypt_AEAD_Streaming_iovec_s
+{
+  uint8_t *iov_base;
+  uint32_t iov_len;
+}
+EverCrypt_AEAD_Streaming_iovec;
+
+/*
+One-shot encryption of a message given as `plain_cnt` fragments, with AAD given
+as `ad_cnt` fragments. The fragments are processed where they lie; `cipher`
+receives their concatenation, encrypted, and must not overlap them.
+Equivalent to `init`, then `update_aad` and `encrypt_update` on each fragment,
+then `encrypt_finish`.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Streaming_encrypt_iov(
+  EverCrypt_AEAD_Streaming_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  EverCrypt_AEAD_Streaming_iovec *ad,
+  uint32_t ad_cnt,
+  EverCrypt_AEAD_Streaming_iovec *plain,
+  uint32_t plain_cnt,
+  uint8_t *cipher,
+  uint8_t *tag
+);
+
+/*
+One-shot decryption of a ciphertext given as `cipher_cnt` fragments into the
+contiguous buffer `plain`. Unlike `decrypt_update`, this function has the
+semantics of `EverCrypt_AEAD_decrypt`: if it does not return `Success`, `plain`
+is zeroed.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Streaming_decrypt_iov(
+  EverCrypt_AEAD_Streaming_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  EverCrypt_AEAD_Streaming_iovec *ad,
+  uint32_t ad_cnt,
+  EverCrypt_AEAD_Streaming_iovec *cipher,
+  uint32_t cipher_cnt,
+  uint8_t *plain,
+  uint8_t *tag
+);
+
+void EverCrypt_AEAD_Streaming_free(EverCrypt_AEAD_Streaming_state_s *s);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __EverCrypt_AEAD_Streaming_H_DEFINED
+#endif
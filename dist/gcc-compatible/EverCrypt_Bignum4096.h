@@ -0,0 +1,146 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __EverCrypt_Bignum4096_H
+#define __EverCrypt_Bignum4096_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "EverCrypt_AutoConfig2.h"
+#include "Hacl_Bignum4096_ADX.h"
+#include "Hacl_Bignum4096.h"
+#include "Hacl_Bignum.h"
+
+/*
+Write `a * 2 ^ 4096 mod n` in `aM`, i.e. convert `a` to the Montgomery domain.
+
+  This function is *UNSAFE* and requires C clients to observe that a < n.
+*/
+void
+EverCrypt_Bignum4096_to_mont_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint64_t *aM
+);
+
+/*
+Write `aM * 2 ^ (-4096) mod n` in `a`, i.e. convert `aM` from the Montgomery domain.
+
+  This function is *UNSAFE* and requires C clients to observe that aM < n.
+*/
+void
+EverCrypt_Bignum4096_from_mont_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *aM,
+  uint64_t *a
+);
+
+/*
+Write `aM * bM * 2 ^ (-4096) mod n` in `resM`.
+
+  This function is *UNSAFE* and requires C clients to observe that aM < n and bM < n.
+*/
+void
+EverCrypt_Bignum4096_mont_mul_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *aM,
+  uint64_t *bM,
+  uint64_t *resM
+);
+
+/*
+Write `aM * aM * 2 ^ (-4096) mod n` in `resM`.
+
+  This function is *UNSAFE* and requires C clients to observe that aM < n.
+*/
+void
+EverCrypt_Bignum4096_mont_sqr_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *aM,
+  uint64_t *resM
+);
+
+/*
+Write `a * b mod n` in `res`.
+
+  This function is *UNSAFE* and requires C clients to observe that a < n and b < n.
+*/
+void
+EverCrypt_Bignum4096_mod_mul_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint64_t *b,
+  uint64_t *res
+);
+
+/*
+Write `a ^ b mod n` in `res`.
+
+  The function is *NOT* constant-time on the argument b.
+
+  This function is *UNSAFE* and requires C clients to observe bn_mod_exp_pre
+  from Hacl.Spec.Bignum.ExpBM.fsti.
+*/
+void
+EverCrypt_Bignum4096_mod_exp_raw_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+);
+
+/*
+Write `a ^ b mod n` in `res`.
+
+  This function is constant-time over its argument b.
+
+  This function is *UNSAFE* and requires C clients to observe bn_mod_exp_pre
+  from Hacl.Spec.Bignum.ExpBM.fsti.
+*/
+void
+EverCrypt_Bignum4096_mod_exp_ct_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __EverCrypt_Bignum4096_H_DEFINED
+#endif
@@ -166,7 +166,29 @@ EverCrypt_CTR_create_in(
           return EverCrypt_Error_Success;
         }
         #endif
-        return EverCrypt_Error_UnsupportedAlgorithm;
+        uint8_t *ek = KRML_HOST_CALLOC((uint32_t)720U, sizeof (uint8_t));
+        uint8_t zero[16U] = { 0U };
+        uint8_t *keys_b = ek;
+        uint8_t *h_b = ek + (uint32_t)704U;
+        Hacl_AES_BitSlice_aes128_key_expansion(keys_b, k);
+        Hacl_AES_BitSlice_aes128_encrypt_block(h_b, zero, keys_b);
+        uint8_t *iv_ = KRML_HOST_CALLOC((uint32_t)16U, sizeof (uint8_t));
+        memcpy(iv_, iv, iv_len * sizeof (uint8_t));
+        KRML_CHECK_SIZE(sizeof (EverCrypt_CTR_state_s), (uint32_t)1U);
+        EverCrypt_CTR_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_CTR_state_s));
+        p[0U]
+        =
+          (
+            (EverCrypt_CTR_state_s){
+              .i = Spec_Cipher_Expansion_Hacl_AES128,
+              .iv = iv_,
+              .iv_len = iv_len,
+              .xkey = ek,
+              .ctr = c
+            }
+          );
+        *dst = p;
+        return EverCrypt_Error_Success;
       }
     case Spec_Agile_Cipher_AES256:
       {
@@ -205,7 +227,29 @@ EverCrypt_CTR_create_in(
           return EverCrypt_Error_Success;
         }
         #endif
-        return EverCrypt_Error_UnsupportedAlgorithm;
+        uint8_t *ek = KRML_HOST_CALLOC((uint32_t)976U, sizeof (uint8_t));
+        uint8_t zero[16U] = { 0U };
+        uint8_t *keys_b = ek;
+        uint8_t *h_b = ek + (uint32_t)960U;
+        Hacl_AES_BitSlice_aes256_key_expansion(keys_b, k);
+        Hacl_AES_BitSlice_aes256_encrypt_block(h_b, zero, keys_b);
+        uint8_t *iv_ = KRML_HOST_CALLOC((uint32_t)16U, sizeof (uint8_t));
+        memcpy(iv_, iv, iv_len * sizeof (uint8_t));
+        KRML_CHECK_SIZE(sizeof (EverCrypt_CTR_state_s), (uint32_t)1U);
+        EverCrypt_CTR_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_CTR_state_s));
+        p[0U]
+        =
+          (
+            (EverCrypt_CTR_state_s){
+              .i = Spec_Cipher_Expansion_Hacl_AES256,
+              .iv = iv_,
+              .iv_len = iv_len,
+              .xkey = ek,
+              .ctr = c
+            }
+          );
+        *dst = p;
+        return EverCrypt_Error_Success;
       }
     case Spec_Agile_Cipher_CHACHA20:
       {
@@ -279,6 +323,24 @@ EverCrypt_CTR_init(
         memcpy(ek, k, (uint32_t)32U * sizeof (uint8_t));
         break;
       }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        uint8_t zero[16U] = { 0U };
+        uint8_t *keys_b = ek;
+        uint8_t *h_b = ek + (uint32_t)704U;
+        Hacl_AES_BitSlice_aes128_key_expansion(keys_b, k);
+        Hacl_AES_BitSlice_aes128_encrypt_block(h_b, zero, keys_b);
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        uint8_t zero[16U] = { 0U };
+        uint8_t *keys_b = ek;
+        uint8_t *h_b = ek + (uint32_t)960U;
+        Hacl_AES_BitSlice_aes256_key_expansion(keys_b, k);
+        Hacl_AES_BitSlice_aes256_encrypt_block(h_b, zero, keys_b);
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -288,6 +350,95 @@ EverCrypt_CTR_init(
   *p = ((EverCrypt_CTR_state_s){ .i = i, .iv = iv_, .iv_len = iv_len, .xkey = ek, .ctr = c });
 }
 
+/* The bitsliced implementation, like Vale's, only increments the low 32 bits
+   of the counter block, but takes them big-endian and handles a final partial
+   block itself. */
+static void
+gctr_hacl(
+  Spec_Cipher_Expansion_impl i,
+  uint8_t *ek,
+  uint8_t *ctr_block,
+  uint32_t len,
+  uint8_t *dst,
+  uint8_t *src
+)
+{
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        Hacl_AES_BitSlice_aes128_ctr32_be(len, dst, src, ek, ctr_block);
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        Hacl_AES_BitSlice_aes256_ctr32_be(len, dst, src, ek, ctr_block);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+static void
+update_blocks_hacl(
+  Spec_Cipher_Expansion_impl i,
+  EverCrypt_CTR_state_s *p,
+  uint8_t *dst,
+  uint8_t *src,
+  uint32_t len
+)
+{
+  EverCrypt_CTR_state_s scrut = *p;
+  uint8_t *iv = scrut.iv;
+  uint32_t iv_len = scrut.iv_len;
+  uint8_t *ek = scrut.xkey;
+  uint32_t c0 = scrut.ctr;
+  uint8_t ctr_block[16U] = { 0U };
+  memcpy(ctr_block, iv, iv_len * sizeof (uint8_t));
+  FStar_UInt128_uint128 uu____0 = load128_be(ctr_block);
+  FStar_UInt128_uint128
+  c = FStar_UInt128_add_mod(uu____0, FStar_UInt128_uint64_to_uint128((uint64_t)c0));
+  uint32_t ite;
+  if (len % (uint32_t)16U == (uint32_t)0U)
+  {
+    ite = (uint32_t)0U;
+  }
+  else
+  {
+    ite = (uint32_t)1U;
+  }
+  uint32_t n = len / (uint32_t)16U + ite;
+  uint64_t lo = FStar_UInt128_uint128_to_uint64(c) & (uint64_t)0xffffffffU;
+  uint64_t n0 = (uint64_t)0x100000000U - lo;
+  uint32_t len0;
+  if ((uint64_t)n <= n0)
+  {
+    len0 = len;
+  }
+  else
+  {
+    len0 = (uint32_t)n0 * (uint32_t)16U;
+  }
+  store128_be(ctr_block, c);
+  gctr_hacl(i, ek, ctr_block, len0, dst, src);
+  if (len0 < len)
+  {
+    FStar_UInt128_uint128
+    c1 =
+      FStar_UInt128_add_mod(c,
+        FStar_UInt128_uint64_to_uint128((uint64_t)(len0 / (uint32_t)16U)));
+    store128_be(ctr_block, c1);
+    uint32_t len1 = len - len0;
+    gctr_hacl(i, ek, ctr_block, len1, dst + len0, src + len0);
+  }
+  uint32_t c2 = c0 + n;
+  *p = ((EverCrypt_CTR_state_s){ .i = i, .iv = iv, .iv_len = iv_len, .xkey = ek, .ctr = c2 });
+}
+
 void EverCrypt_CTR_update_block(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t *src)
 {
   EverCrypt_CTR_state_s scrut = *p;
@@ -404,6 +555,205 @@ void EverCrypt_CTR_update_block(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t
         Hacl_Impl_Chacha20_chacha20_encrypt_block(ctx, dst, c0, src);
         break;
       }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        update_blocks_hacl(Spec_Cipher_Expansion_Hacl_AES128, p, dst, src, (uint32_t)16U);
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        update_blocks_hacl(Spec_Cipher_Expansion_Hacl_AES256, p, dst, src, (uint32_t)16U);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+/* Vale's CTR loop handles a final partial block itself, by way of a 16-byte
+   scratch buffer. */
+static void
+gctr_vale(
+  Spec_Cipher_Expansion_impl i,
+  uint8_t *ek,
+  uint8_t *ctr_block,
+  uint32_t len,
+  uint8_t *dst,
+  uint8_t *src
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  uint8_t inout_b[16U] = { 0U };
+  uint32_t num_blocks = (uint32_t)(uint64_t)len / (uint32_t)16U;
+  uint32_t num_bytes_ = num_blocks * (uint32_t)16U;
+  uint8_t *in_b_ = src;
+  uint8_t *out_b_ = dst;
+  memcpy(inout_b, src + num_bytes_, (uint32_t)(uint64_t)len % (uint32_t)16U * sizeof (uint8_t));
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        uint64_t
+        scrut =
+          gctr128_bytes(in_b_,
+            (uint64_t)len,
+            out_b_,
+            inout_b,
+            ek,
+            ctr_block,
+            (uint64_t)num_blocks);
+        break;
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        uint64_t
+        scrut =
+          gctr256_bytes(in_b_,
+            (uint64_t)len,
+            out_b_,
+            inout_b,
+            ek,
+            ctr_block,
+            (uint64_t)num_blocks);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+  memcpy(dst + num_bytes_, inout_b, (uint32_t)(uint64_t)len % (uint32_t)16U * sizeof (uint8_t));
+  #else
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+static void
+update_blocks_vale(
+  Spec_Cipher_Expansion_impl i,
+  EverCrypt_CTR_state_s *p,
+  uint8_t *dst,
+  uint8_t *src,
+  uint32_t len
+)
+{
+  EverCrypt_CTR_state_s scrut = *p;
+  uint8_t *iv = scrut.iv;
+  uint32_t iv_len = scrut.iv_len;
+  uint8_t *ek = scrut.xkey;
+  uint32_t c0 = scrut.ctr;
+  uint8_t ctr_block[16U] = { 0U };
+  memcpy(ctr_block, iv, iv_len * sizeof (uint8_t));
+  FStar_UInt128_uint128 uu____0 = load128_be(ctr_block);
+  FStar_UInt128_uint128
+  c = FStar_UInt128_add_mod(uu____0, FStar_UInt128_uint64_to_uint128((uint64_t)c0));
+  uint32_t ite;
+  if (len % (uint32_t)16U == (uint32_t)0U)
+  {
+    ite = (uint32_t)0U;
+  }
+  else
+  {
+    ite = (uint32_t)1U;
+  }
+  uint32_t n = len / (uint32_t)16U + ite;
+  uint64_t lo = FStar_UInt128_uint128_to_uint64(c) & (uint64_t)0xffffffffU;
+  uint64_t n0 = (uint64_t)0x100000000U - lo;
+  uint32_t len0;
+  if ((uint64_t)n <= n0)
+  {
+    len0 = len;
+  }
+  else
+  {
+    len0 = (uint32_t)n0 * (uint32_t)16U;
+  }
+  store128_le(ctr_block, c);
+  gctr_vale(i, ek, ctr_block, len0, dst, src);
+  if (len0 < len)
+  {
+    FStar_UInt128_uint128
+    c1 =
+      FStar_UInt128_add_mod(c,
+        FStar_UInt128_uint64_to_uint128((uint64_t)(len0 / (uint32_t)16U)));
+    store128_le(ctr_block, c1);
+    uint32_t len1 = len - len0;
+    gctr_vale(i, ek, ctr_block, len1, dst + len0, src + len0);
+  }
+  uint32_t c2 = c0 + n;
+  *p = ((EverCrypt_CTR_state_s){ .i = i, .iv = iv, .iv_len = iv_len, .xkey = ek, .ctr = c2 });
+}
+
+void
+EverCrypt_CTR_update_blocks(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t *src, uint32_t len)
+{
+  EverCrypt_CTR_state_s scrut = *p;
+  Spec_Cipher_Expansion_impl i = scrut.i;
+  uint8_t *iv = scrut.iv;
+  uint32_t iv_len = scrut.iv_len;
+  uint8_t *ek = scrut.xkey;
+  uint32_t c0 = scrut.ctr;
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        #if EVERCRYPT_TARGETCONFIG_X64
+        update_blocks_vale(Spec_Cipher_Expansion_Vale_AES128, p, dst, src, len);
+        #endif
+        break;
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        #if EVERCRYPT_TARGETCONFIG_X64
+        update_blocks_vale(Spec_Cipher_Expansion_Vale_AES256, p, dst, src, len);
+        #endif
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        EverCrypt_Cipher_chacha20(len, dst, src, ek, iv, c0);
+        uint32_t ite;
+        if (len % (uint32_t)64U == (uint32_t)0U)
+        {
+          ite = (uint32_t)0U;
+        }
+        else
+        {
+          ite = (uint32_t)1U;
+        }
+        uint32_t n = len / (uint32_t)64U + ite;
+        uint32_t c = c0 + n;
+        *p
+        =
+          (
+            (EverCrypt_CTR_state_s){
+              .i = Spec_Cipher_Expansion_Hacl_CHACHA20,
+              .iv = iv,
+              .iv_len = iv_len,
+              .xkey = ek,
+              .ctr = c
+            }
+          );
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        update_blocks_hacl(Spec_Cipher_Expansion_Hacl_AES128, p, dst, src, len);
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        update_blocks_hacl(Spec_Cipher_Expansion_Hacl_AES256, p, dst, src, len);
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -37,7 +37,9 @@ extern "C" {
 #include "kremlin/internal/target.h"
 
 
+#include "EverCrypt_Cipher.h"
 #include "Hacl_Chacha20.h"
+#include "Hacl_AES_BitSlice.h"
 #include "Hacl_Kremlib.h"
 #include "Vale.h"
 #include "EverCrypt_AutoConfig2.h"
@@ -108,6 +110,9 @@ EverCrypt_CTR_init(
 
 void EverCrypt_CTR_update_block(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t *src);
 
+void
+EverCrypt_CTR_update_blocks(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t *src, uint32_t len);
+
 void EverCrypt_CTR_free(EverCrypt_CTR_state_s *p);
 
 #if defined(__cplusplus)
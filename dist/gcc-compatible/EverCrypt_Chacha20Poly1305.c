@@ -36,9 +36,17 @@ EverCrypt_Chacha20Poly1305_aead_encrypt(
   uint8_t *tag
 )
 {
+  bool avx512 = EverCrypt_AutoConfig2_has_avx512();
   bool avx2 = EverCrypt_AutoConfig2_has_avx2();
   bool avx = EverCrypt_AutoConfig2_has_avx();
   #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx512)
+  {
+    Hacl_Chacha20Poly1305_512_aead_encrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+    return;
+  }
+  #endif
+  #if EVERCRYPT_TARGETCONFIG_X64
   if (avx2)
   {
     Hacl_Chacha20Poly1305_256_aead_encrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
@@ -67,9 +75,16 @@ EverCrypt_Chacha20Poly1305_aead_decrypt(
   uint8_t *tag
 )
 {
+  bool avx512 = EverCrypt_AutoConfig2_has_avx512();
   bool avx2 = EverCrypt_AutoConfig2_has_avx2();
   bool avx = EverCrypt_AutoConfig2_has_avx();
   #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx512)
+  {
+    return Hacl_Chacha20Poly1305_512_aead_decrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+  }
+  #endif
+  #if EVERCRYPT_TARGETCONFIG_X64
   if (avx2)
   {
     return Hacl_Chacha20Poly1305_256_aead_decrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
@@ -84,3 +99,78 @@ EverCrypt_Chacha20Poly1305_aead_decrypt(
   return Hacl_Chacha20Poly1305_32_aead_decrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
 }
 
+void
+EverCrypt_Chacha20Poly1305_xaead_encrypt(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  bool avx512 = EverCrypt_AutoConfig2_has_avx512();
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  bool avx = EverCrypt_AutoConfig2_has_avx();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx512)
+  {
+    Hacl_Chacha20Poly1305_512_xaead_encrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+    return;
+  }
+  #endif
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2)
+  {
+    Hacl_Chacha20Poly1305_256_xaead_encrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+    return;
+  }
+  #endif
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx)
+  {
+    Hacl_Chacha20Poly1305_128_xaead_encrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+    return;
+  }
+  #endif
+  Hacl_Chacha20Poly1305_32_xaead_encrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+}
+
+uint32_t
+EverCrypt_Chacha20Poly1305_xaead_decrypt(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  bool avx512 = EverCrypt_AutoConfig2_has_avx512();
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  bool avx = EverCrypt_AutoConfig2_has_avx();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx512)
+  {
+    return Hacl_Chacha20Poly1305_512_xaead_decrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+  }
+  #endif
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2)
+  {
+    return Hacl_Chacha20Poly1305_256_xaead_decrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+  }
+  #endif
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx)
+  {
+    return Hacl_Chacha20Poly1305_128_xaead_decrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+  }
+  #endif
+  return Hacl_Chacha20Poly1305_32_xaead_decrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+}
+
@@ -34,8 +34,34 @@ EverCrypt_Cipher_chacha20(
   uint32_t ctr
 )
 {
-  uint32_t ctx[16U] = { 0U };
-  Hacl_Impl_Chacha20_chacha20_init(ctx, key, iv, ctr);
-  Hacl_Impl_Chacha20_chacha20_update(ctx, len, dst, src);
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  bool avx = EverCrypt_AutoConfig2_has_avx();
+  uint32_t len0 = (uint32_t)0U;
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2)
+  {
+    len0 = len / (uint32_t)512U * (uint32_t)512U;
+    if (len0 > (uint32_t)0U)
+    {
+      Hacl_Chacha20_Vec256_chacha20_encrypt_256(len0, dst, src, key, iv, ctr);
+    }
+  }
+  #endif
+  uint32_t len1 = len - len0;
+  uint8_t *dst1 = dst + len0;
+  uint8_t *src1 = src + len0;
+  uint32_t ctr1 = ctr + len0 / (uint32_t)64U;
+  if (len1 == (uint32_t)0U)
+  {
+    return;
+  }
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx && len1 > (uint32_t)64U)
+  {
+    Hacl_Chacha20_Vec128_chacha20_encrypt_128(len1, dst1, src1, key, iv, ctr1);
+    return;
+  }
+  #endif
+  Hacl_Chacha20_chacha20_encrypt(len1, dst1, src1, key, iv, ctr1);
 }
 
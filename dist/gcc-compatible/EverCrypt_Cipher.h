@@ -37,6 +37,9 @@ extern "C" {
 #include "kremlin/internal/target.h"
 
 
+#include "EverCrypt_AutoConfig2.h"
+#include "Hacl_Chacha20_Vec256.h"
+#include "Hacl_Chacha20_Vec128.h"
 #include "Hacl_Chacha20.h"
 
 void
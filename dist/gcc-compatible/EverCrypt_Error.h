@@ -45,6 +45,8 @@ extern "C" {
 #define EverCrypt_Error_AuthenticationFailure 3
 #define EverCrypt_Error_InvalidIVLength 4
 #define EverCrypt_Error_DecodeError 5
+#define EverCrypt_Error_MaximumLengthExceeded 6
+#define EverCrypt_Error_InvalidState 7
 
 typedef uint8_t EverCrypt_Error_error_code;
 
@@ -60,6 +62,10 @@ bool EverCrypt_Error_uu___is_InvalidIVLength(EverCrypt_Error_error_code projecte
 
 bool EverCrypt_Error_uu___is_DecodeError(EverCrypt_Error_error_code projectee);
 
+bool EverCrypt_Error_uu___is_MaximumLengthExceeded(EverCrypt_Error_error_code projectee);
+
+bool EverCrypt_Error_uu___is_InvalidState(EverCrypt_Error_error_code projectee);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -848,3 +848,323 @@ EverCrypt_HMAC_compute(
   }
 }
 
+static void
+pad_state(EverCrypt_Hash_state_s *s, uint8_t *key_block, uint8_t pad, uint8_t *empty)
+{
+  Spec_Hash_Definitions_hash_alg a = EverCrypt_Hash_alg_of_state(s);
+  uint32_t l = EverCrypt_Hash_Incremental_block_len(a);
+  KRML_CHECK_SIZE(sizeof (uint8_t), l);
+  uint8_t p[l];
+  memset(p, pad, l * sizeof (uint8_t));
+  for (uint32_t i = (uint32_t)0U; i < l; i++)
+  {
+    uint8_t xi = p[i];
+    uint8_t yi = key_block[i];
+    p[i] = xi ^ yi;
+  }
+  EverCrypt_Hash_init(s);
+  EverCrypt_Hash_update_multi2(s, (uint64_t)0U, p, l);
+  if (!(empty == NULL))
+  {
+    EverCrypt_Hash_hash(a, empty, p, l);
+  }
+  Lib_Memzero0_memzero(p, l * sizeof (p[0U]));
+}
+
+EverCrypt_HMAC_key_s
+*EverCrypt_HMAC_create_key(Spec_Hash_Definitions_hash_alg a, uint8_t *key, uint32_t keylen)
+{
+  EverCrypt_Hash_state_s *inner = EverCrypt_Hash_create_in(a);
+  EverCrypt_Hash_state_s *outer = EverCrypt_Hash_create_in(a);
+  KRML_CHECK_SIZE(sizeof (uint8_t), EverCrypt_Hash_Incremental_hash_len(a));
+  uint8_t *inner_empty = KRML_HOST_CALLOC(EverCrypt_Hash_Incremental_hash_len(a), sizeof (uint8_t));
+  uint32_t l = EverCrypt_Hash_Incremental_block_len(a);
+  KRML_CHECK_SIZE(sizeof (uint8_t), l);
+  uint8_t key_block[l];
+  memset(key_block, 0U, l * sizeof (uint8_t));
+  if (keylen <= l)
+  {
+    memcpy(key_block, key, keylen * sizeof (uint8_t));
+  }
+  else
+  {
+    EverCrypt_Hash_hash(a, key_block, key, keylen);
+  }
+  pad_state(inner, key_block, (uint8_t)0x36U, inner_empty);
+  pad_state(outer, key_block, (uint8_t)0x5cU, NULL);
+  Lib_Memzero0_memzero(key_block, l * sizeof (key_block[0U]));
+  KRML_CHECK_SIZE(sizeof (EverCrypt_HMAC_key_s), (uint32_t)1U);
+  EverCrypt_HMAC_key_s *k = KRML_HOST_MALLOC(sizeof (EverCrypt_HMAC_key_s));
+  k[0U] = ((EverCrypt_HMAC_key_s){ .inner = inner, .outer = outer, .inner_empty = inner_empty });
+  return k;
+}
+
+void EverCrypt_HMAC_free_key(EverCrypt_HMAC_key_s *k)
+{
+  EverCrypt_HMAC_key_s s = *k;
+  EverCrypt_Hash_init(s.inner);
+  EverCrypt_Hash_init(s.outer);
+  Lib_Memzero0_memzero(s.inner_empty,
+    EverCrypt_Hash_Incremental_hash_len(EverCrypt_Hash_alg_of_state(s.inner))
+    * sizeof (s.inner_empty[0U]));
+  EverCrypt_Hash_free(s.inner);
+  EverCrypt_Hash_free(s.outer);
+  KRML_HOST_FREE(s.inner_empty);
+  KRML_HOST_FREE(k);
+}
+
+static void
+update_last_finish(
+  EverCrypt_Hash_state_s *s,
+  uint64_t prev_len,
+  uint8_t *data,
+  uint32_t len,
+  uint8_t *dst
+)
+{
+  uint32_t l = EverCrypt_Hash_Incremental_block_len(EverCrypt_Hash_alg_of_state(s));
+  uint32_t n;
+  if (len == (uint32_t)0U)
+  {
+    n = (uint32_t)0U;
+  }
+  else
+  {
+    n = (len - (uint32_t)1U) / l;
+  }
+  if (n > (uint32_t)0U)
+  {
+    EverCrypt_Hash_update_multi2(s, prev_len, data, n * l);
+  }
+  EverCrypt_Hash_update_last2(s, prev_len + (uint64_t)(n * l), data + n * l, len - n * l);
+  EverCrypt_Hash_finish(s, dst);
+}
+
+static void outer_finish(EverCrypt_HMAC_key_s *k, EverCrypt_Hash_state_s *s, uint8_t *tag)
+{
+  EverCrypt_HMAC_key_s ks = *k;
+  Spec_Hash_Definitions_hash_alg a = EverCrypt_Hash_alg_of_state(ks.outer);
+  EverCrypt_Hash_copy(ks.outer, s);
+  update_last_finish(s,
+    (uint64_t)EverCrypt_Hash_Incremental_block_len(a),
+    tag,
+    EverCrypt_Hash_Incremental_hash_len(a),
+    tag);
+}
+
+static EverCrypt_Hash_state_s
+alloca_state(Spec_Hash_Definitions_hash_alg a, uint32_t *buf32, uint64_t *buf64)
+{
+  switch (a)
+  {
+    case Spec_Hash_Definitions_MD5:
+      {
+        return ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_MD5_s, { .case_MD5_s = buf32 } });
+      }
+    case Spec_Hash_Definitions_SHA1:
+      {
+        return ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA1_s, { .case_SHA1_s = buf32 } });
+      }
+    case Spec_Hash_Definitions_SHA2_224:
+      {
+        return
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA2_224_s, { .case_SHA2_224_s = buf32 } });
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        return
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA2_256_s, { .case_SHA2_256_s = buf32 } });
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+      {
+        return
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA2_384_s, { .case_SHA2_384_s = buf64 } });
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        return
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA2_512_s, { .case_SHA2_512_s = buf64 } });
+      }
+    case Spec_Hash_Definitions_Blake2S:
+      {
+        return
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_Blake2S_s, { .case_Blake2S_s = buf32 } });
+      }
+    case Spec_Hash_Definitions_Blake2B:
+      {
+        return
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_Blake2B_s, { .case_Blake2B_s = buf64 } });
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        return
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA3_224_s, { .case_SHA3_224_s = buf64 } });
+      }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        return
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA3_256_s, { .case_SHA3_256_s = buf64 } });
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        return
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA3_384_s, { .case_SHA3_384_s = buf64 } });
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        return
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA3_512_s, { .case_SHA3_512_s = buf64 } });
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+void
+EverCrypt_HMAC_compute_with_key(
+  EverCrypt_HMAC_key_s *k,
+  uint8_t *tag,
+  uint8_t *data,
+  uint32_t datalen
+)
+{
+  EverCrypt_HMAC_key_s ks = *k;
+  Spec_Hash_Definitions_hash_alg a = EverCrypt_Hash_alg_of_state(ks.inner);
+  uint32_t buf32[16U] = { 0U };
+  uint64_t buf64[25U] = { 0U };
+  EverCrypt_Hash_state_s s = alloca_state(a, buf32, buf64);
+  if (datalen == (uint32_t)0U)
+  {
+    memcpy(tag, ks.inner_empty, EverCrypt_Hash_Incremental_hash_len(a) * sizeof (uint8_t));
+  }
+  else
+  {
+    EverCrypt_Hash_copy(ks.inner, &s);
+    update_last_finish(&s,
+      (uint64_t)EverCrypt_Hash_Incremental_block_len(a),
+      data,
+      datalen,
+      tag);
+  }
+  outer_finish(k, &s, tag);
+}
+
+void EverCrypt_HMAC_init(EverCrypt_HMAC_state_s *s)
+{
+  EverCrypt_HMAC_state_s st = *s;
+  EverCrypt_Hash_copy(st.key->inner, st.block_state);
+  s->total_len = (uint64_t)0U;
+}
+
+EverCrypt_HMAC_state_s *EverCrypt_HMAC_create_in(EverCrypt_HMAC_key_s *k)
+{
+  EverCrypt_HMAC_key_s ks = *k;
+  Spec_Hash_Definitions_hash_alg a = EverCrypt_Hash_alg_of_state(ks.inner);
+  EverCrypt_Hash_state_s *block_state = EverCrypt_Hash_create_in(a);
+  KRML_CHECK_SIZE(sizeof (uint8_t), EverCrypt_Hash_Incremental_block_len(a));
+  uint8_t *buf = KRML_HOST_CALLOC(EverCrypt_Hash_Incremental_block_len(a), sizeof (uint8_t));
+  KRML_CHECK_SIZE(sizeof (EverCrypt_HMAC_state_s), (uint32_t)1U);
+  EverCrypt_HMAC_state_s *s = KRML_HOST_MALLOC(sizeof (EverCrypt_HMAC_state_s));
+  s[0U]
+  =
+    (
+      (EverCrypt_HMAC_state_s){
+        .key = k,
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = (uint64_t)0U
+      }
+    );
+  EverCrypt_HMAC_init(s);
+  return s;
+}
+
+static uint32_t buffered(uint32_t l, uint64_t total_len)
+{
+  if (total_len % (uint64_t)l == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    return l;
+  }
+  return (uint32_t)(total_len % (uint64_t)l);
+}
+
+void EverCrypt_HMAC_update(EverCrypt_HMAC_state_s *s, uint8_t *data, uint32_t len)
+{
+  EverCrypt_HMAC_state_s st = *s;
+  Spec_Hash_Definitions_hash_alg a = EverCrypt_Hash_alg_of_state(st.block_state);
+  uint32_t l = EverCrypt_Hash_Incremental_block_len(a);
+  uint32_t sz = buffered(l, st.total_len);
+  if (len <= l - sz)
+  {
+    memcpy(st.buf + sz, data, len * sizeof (uint8_t));
+    s->total_len = st.total_len + (uint64_t)len;
+    return;
+  }
+  uint32_t take;
+  if (sz == (uint32_t)0U)
+  {
+    take = (uint32_t)0U;
+  }
+  else
+  {
+    take = l - sz;
+  }
+  memcpy(st.buf + sz, data, take * sizeof (uint8_t));
+  uint64_t prev0 = (uint64_t)l + st.total_len - (uint64_t)sz;
+  if (!(sz == (uint32_t)0U))
+  {
+    EverCrypt_Hash_update_multi2(st.block_state, prev0, st.buf, l);
+  }
+  uint64_t prev;
+  if (sz == (uint32_t)0U)
+  {
+    prev = prev0;
+  }
+  else
+  {
+    prev = prev0 + (uint64_t)l;
+  }
+  uint32_t rest = len - take;
+  uint32_t n = (rest - (uint32_t)1U) / l;
+  EverCrypt_Hash_update_multi2(st.block_state, prev, data + take, n * l);
+  uint32_t tail = rest - n * l;
+  memcpy(st.buf, data + take + n * l, tail * sizeof (uint8_t));
+  s->total_len = st.total_len + (uint64_t)len;
+}
+
+void EverCrypt_HMAC_finish(EverCrypt_HMAC_state_s *s, uint8_t *tag)
+{
+  EverCrypt_HMAC_state_s st = *s;
+  Spec_Hash_Definitions_hash_alg a = EverCrypt_Hash_alg_of_state(st.block_state);
+  uint32_t l = EverCrypt_Hash_Incremental_block_len(a);
+  uint32_t sz = buffered(l, st.total_len);
+  uint32_t buf32[16U] = { 0U };
+  uint64_t buf64[25U] = { 0U };
+  EverCrypt_Hash_state_s tmp = alloca_state(a, buf32, buf64);
+  if (st.total_len == (uint64_t)0U)
+  {
+    memcpy(tag, st.key->inner_empty, EverCrypt_Hash_Incremental_hash_len(a) * sizeof (uint8_t));
+  }
+  else
+  {
+    EverCrypt_Hash_copy(st.block_state, &tmp);
+    EverCrypt_Hash_update_last2(&tmp, (uint64_t)l + st.total_len - (uint64_t)sz, st.buf, sz);
+    EverCrypt_Hash_finish(&tmp, tag);
+  }
+  outer_finish(st.key, &tmp, tag);
+}
+
+void EverCrypt_HMAC_free(EverCrypt_HMAC_state_s *s)
+{
+  EverCrypt_HMAC_state_s st = *s;
+  Spec_Hash_Definitions_hash_alg a = EverCrypt_Hash_alg_of_state(st.block_state);
+  EverCrypt_Hash_init(st.block_state);
+  Lib_Memzero0_memzero(st.buf, EverCrypt_Hash_Incremental_block_len(a) * sizeof (st.buf[0U]));
+  EverCrypt_Hash_free(st.block_state);
+  KRML_HOST_FREE(st.buf);
+  KRML_HOST_FREE(s);
+}
+
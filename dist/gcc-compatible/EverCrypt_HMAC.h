@@ -43,6 +43,7 @@ extern "C" {
 #include "Hacl_Hash.h"
 #include "Hacl_Spec.h"
 #include "EverCrypt_Hash.h"
+#include "Lib_Memzero0.h"
 
 void
 EverCrypt_HMAC_compute_sha1(
@@ -112,6 +113,53 @@ EverCrypt_HMAC_compute(
   uint32_t datalen
 );
 
+typedef struct EverCrypt_HMAC_key_s_s
+{
+  EverCrypt_Hash_state_s *inner;
+  EverCrypt_Hash_state_s *outer;
+  uint8_t *inner_empty;
+}
+EverCrypt_HMAC_key_s;
+
+EverCrypt_HMAC_key_s
+*EverCrypt_HMAC_create_key(Spec_Hash_Definitions_hash_alg a, uint8_t *key, uint32_t keylen);
+
+/*
+  The hash states are reset to the initial state, which does not depend on
+  the key, before they are freed.
+*/
+void EverCrypt_HMAC_free_key(EverCrypt_HMAC_key_s *k);
+
+void
+EverCrypt_HMAC_compute_with_key(
+  EverCrypt_HMAC_key_s *k,
+  uint8_t *tag,
+  uint8_t *data,
+  uint32_t datalen
+);
+
+typedef struct EverCrypt_HMAC_state_s_s
+{
+  EverCrypt_HMAC_key_s *key;
+  EverCrypt_Hash_state_s *block_state;
+  uint8_t *buf;
+  uint64_t total_len;
+}
+EverCrypt_HMAC_state_s;
+
+EverCrypt_HMAC_state_s *EverCrypt_HMAC_create_in(EverCrypt_HMAC_key_s *k);
+
+void EverCrypt_HMAC_init(EverCrypt_HMAC_state_s *s);
+
+void EverCrypt_HMAC_update(EverCrypt_HMAC_state_s *s, uint8_t *data, uint32_t len);
+
+/*
+  Does not consume the state: more data can be added after a finish.
+*/
+void EverCrypt_HMAC_finish(EverCrypt_HMAC_state_s *s, uint8_t *tag);
+
+void EverCrypt_HMAC_free(EverCrypt_HMAC_state_s *s);
+
 #if defined(__cplusplus)
 }
 #endif
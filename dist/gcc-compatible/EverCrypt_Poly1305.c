@@ -54,10 +54,18 @@ static void poly1305_vale(uint8_t *dst, uint8_t *src, uint32_t len, uint8_t *key
 
 void EverCrypt_Poly1305_poly1305(uint8_t *dst, uint8_t *src, uint32_t len, uint8_t *key)
 {
+  bool avx512 = EverCrypt_AutoConfig2_has_avx512();
   bool avx2 = EverCrypt_AutoConfig2_has_avx2();
   bool avx = EverCrypt_AutoConfig2_has_avx();
   bool vale = EverCrypt_AutoConfig2_wants_vale();
   #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx512)
+  {
+    Hacl_Poly1305_512_poly1305_mac(dst, len, src, key);
+    return;
+  }
+  #endif
+  #if EVERCRYPT_TARGETCONFIG_X64
   if (avx2)
   {
     Hacl_Poly1305_256_poly1305_mac(dst, len, src, key);
@@ -41,6 +41,7 @@ extern "C" {
 #include "EverCrypt_AutoConfig2.h"
 #include "Hacl_Poly1305_32.h"
 #include "Hacl_Poly1305_256.h"
+#include "Hacl_Poly1305_512.h"
 #include "Hacl_Poly1305_128.h"
 
 void EverCrypt_Poly1305_poly1305(uint8_t *dst, uint8_t *src, uint32_t len, uint8_t *key);
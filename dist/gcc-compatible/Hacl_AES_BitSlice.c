@@ -0,0 +1,479 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+
+#include "Hacl_AES_BitSlice.h"
+
+static inline void swap_bits(uint64_t *st, uint32_t i, uint32_t j, uint64_t m, uint32_t s)
+{
+  uint64_t a = st[i];
+  uint64_t b = st[j];
+  st[i] = (a & m) | (b & m) << s;
+  st[j] = (a & ~m) >> s | (b & ~m);
+}
+
+static inline void transpose_state(uint64_t *st)
+{
+  swap_bits(st, (uint32_t)0U, (uint32_t)1U, (uint64_t)0x5555555555555555U, (uint32_t)1U);
+  swap_bits(st, (uint32_t)2U, (uint32_t)3U, (uint64_t)0x5555555555555555U, (uint32_t)1U);
+  swap_bits(st, (uint32_t)4U, (uint32_t)5U, (uint64_t)0x5555555555555555U, (uint32_t)1U);
+  swap_bits(st, (uint32_t)6U, (uint32_t)7U, (uint64_t)0x5555555555555555U, (uint32_t)1U);
+  swap_bits(st, (uint32_t)0U, (uint32_t)2U, (uint64_t)0x3333333333333333U, (uint32_t)2U);
+  swap_bits(st, (uint32_t)1U, (uint32_t)3U, (uint64_t)0x3333333333333333U, (uint32_t)2U);
+  swap_bits(st, (uint32_t)4U, (uint32_t)6U, (uint64_t)0x3333333333333333U, (uint32_t)2U);
+  swap_bits(st, (uint32_t)5U, (uint32_t)7U, (uint64_t)0x3333333333333333U, (uint32_t)2U);
+  swap_bits(st, (uint32_t)0U, (uint32_t)4U, (uint64_t)0x0f0f0f0f0f0f0f0fU, (uint32_t)4U);
+  swap_bits(st, (uint32_t)1U, (uint32_t)5U, (uint64_t)0x0f0f0f0f0f0f0f0fU, (uint32_t)4U);
+  swap_bits(st, (uint32_t)2U, (uint32_t)6U, (uint64_t)0x0f0f0f0f0f0f0f0fU, (uint32_t)4U);
+  swap_bits(st, (uint32_t)3U, (uint32_t)7U, (uint64_t)0x0f0f0f0f0f0f0f0fU, (uint32_t)4U);
+}
+
+static inline uint64_t spread_bytes(uint32_t w)
+{
+  uint64_t x = (uint64_t)w;
+  uint64_t x1 = (x | x << (uint32_t)16U) & (uint64_t)0x0000ffff0000ffffU;
+  return (x1 | x1 << (uint32_t)8U) & (uint64_t)0x00ff00ff00ff00ffU;
+}
+
+static inline uint32_t gather_bytes(uint64_t x)
+{
+  uint64_t x0 = x & (uint64_t)0x00ff00ff00ff00ffU;
+  uint64_t x1 = (x0 | x0 >> (uint32_t)8U) & (uint64_t)0x0000ffff0000ffffU;
+  return (uint32_t)x1 | (uint32_t)(x1 >> (uint32_t)16U);
+}
+
+static inline void load_state(uint64_t *st, uint8_t *b)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint8_t *bi = b + i * (uint32_t)16U;
+    uint32_t w0 = load32_le(bi);
+    uint32_t w1 = load32_le(bi + (uint32_t)4U);
+    uint32_t w2 = load32_le(bi + (uint32_t)8U);
+    uint32_t w3 = load32_le(bi + (uint32_t)12U);
+    st[i] = spread_bytes(w0) | spread_bytes(w2) << (uint32_t)8U;
+    st[i + (uint32_t)4U] = spread_bytes(w1) | spread_bytes(w3) << (uint32_t)8U;
+  }
+  transpose_state(st);
+}
+
+static inline void store_state(uint8_t *b, uint64_t *st)
+{
+  transpose_state(st);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint8_t *bi = b + i * (uint32_t)16U;
+    uint64_t q0 = st[i];
+    uint64_t q1 = st[i + (uint32_t)4U];
+    store32_le(bi, gather_bytes(q0));
+    store32_le(bi + (uint32_t)4U, gather_bytes(q1));
+    store32_le(bi + (uint32_t)8U, gather_bytes(q0 >> (uint32_t)8U));
+    store32_le(bi + (uint32_t)12U, gather_bytes(q1 >> (uint32_t)8U));
+  }
+}
+
+static void sub_bytes(uint64_t *st)
+{
+  uint64_t x0 = st[7U];
+  uint64_t x1 = st[6U];
+  uint64_t x2 = st[5U];
+  uint64_t x3 = st[4U];
+  uint64_t x4 = st[3U];
+  uint64_t x5 = st[2U];
+  uint64_t x6 = st[1U];
+  uint64_t x7 = st[0U];
+  uint64_t y14 = x3 ^ x5;
+  uint64_t y13 = x0 ^ x6;
+  uint64_t y9 = x0 ^ x3;
+  uint64_t y8 = x0 ^ x5;
+  uint64_t t0 = x1 ^ x2;
+  uint64_t y1 = t0 ^ x7;
+  uint64_t y4 = y1 ^ x3;
+  uint64_t y12 = y13 ^ y14;
+  uint64_t y2 = y1 ^ x0;
+  uint64_t y5 = y1 ^ x6;
+  uint64_t y3 = y5 ^ y8;
+  uint64_t t1 = x4 ^ y12;
+  uint64_t y15 = t1 ^ x5;
+  uint64_t y20 = t1 ^ x1;
+  uint64_t y6 = y15 ^ x7;
+  uint64_t y10 = y15 ^ t0;
+  uint64_t y11 = y20 ^ y9;
+  uint64_t y7 = x7 ^ y11;
+  uint64_t y17 = y10 ^ y11;
+  uint64_t y19 = y10 ^ y8;
+  uint64_t y16 = t0 ^ y11;
+  uint64_t y21 = y13 ^ y16;
+  uint64_t y18 = x0 ^ y16;
+  uint64_t t2 = y12 & y15;
+  uint64_t t3 = y3 & y6;
+  uint64_t t4 = t3 ^ t2;
+  uint64_t t5 = y4 & x7;
+  uint64_t t6 = t5 ^ t2;
+  uint64_t t7 = y13 & y16;
+  uint64_t t8 = y5 & y1;
+  uint64_t t9 = t8 ^ t7;
+  uint64_t t10 = y2 & y7;
+  uint64_t t11 = t10 ^ t7;
+  uint64_t t12 = y9 & y11;
+  uint64_t t13 = y14 & y17;
+  uint64_t t14 = t13 ^ t12;
+  uint64_t t15 = y8 & y10;
+  uint64_t t16 = t15 ^ t12;
+  uint64_t t17 = t4 ^ t14;
+  uint64_t t18 = t6 ^ t16;
+  uint64_t t19 = t9 ^ t14;
+  uint64_t t20 = t11 ^ t16;
+  uint64_t t21 = t17 ^ y20;
+  uint64_t t22 = t18 ^ y19;
+  uint64_t t23 = t19 ^ y21;
+  uint64_t t24 = t20 ^ y18;
+  uint64_t t25 = t21 ^ t22;
+  uint64_t t26 = t21 & t23;
+  uint64_t t27 = t24 ^ t26;
+  uint64_t t28 = t25 & t27;
+  uint64_t t29 = t28 ^ t22;
+  uint64_t t30 = t23 ^ t24;
+  uint64_t t31 = t22 ^ t26;
+  uint64_t t32 = t31 & t30;
+  uint64_t t33 = t32 ^ t24;
+  uint64_t t34 = t23 ^ t33;
+  uint64_t t35 = t27 ^ t33;
+  uint64_t t36 = t24 & t35;
+  uint64_t t37 = t36 ^ t34;
+  uint64_t t38 = t27 ^ t36;
+  uint64_t t39 = t29 & t38;
+  uint64_t t40 = t25 ^ t39;
+  uint64_t t41 = t40 ^ t37;
+  uint64_t t42 = t29 ^ t33;
+  uint64_t t43 = t29 ^ t40;
+  uint64_t t44 = t33 ^ t37;
+  uint64_t t45 = t42 ^ t41;
+  uint64_t z0 = t44 & y15;
+  uint64_t z1 = t37 & y6;
+  uint64_t z2 = t33 & x7;
+  uint64_t z3 = t43 & y16;
+  uint64_t z4 = t40 & y1;
+  uint64_t z5 = t29 & y7;
+  uint64_t z6 = t42 & y11;
+  uint64_t z7 = t45 & y17;
+  uint64_t z8 = t41 & y10;
+  uint64_t z9 = t44 & y12;
+  uint64_t z10 = t37 & y3;
+  uint64_t z11 = t33 & y4;
+  uint64_t z12 = t43 & y13;
+  uint64_t z13 = t40 & y5;
+  uint64_t z14 = t29 & y2;
+  uint64_t z15 = t42 & y9;
+  uint64_t z16 = t45 & y14;
+  uint64_t z17 = t41 & y8;
+  uint64_t t46 = z15 ^ z16;
+  uint64_t t47 = z10 ^ z11;
+  uint64_t t48 = z5 ^ z13;
+  uint64_t t49 = z9 ^ z10;
+  uint64_t t50 = z2 ^ z12;
+  uint64_t t51 = z2 ^ z5;
+  uint64_t t52 = z7 ^ z8;
+  uint64_t t53 = z0 ^ z3;
+  uint64_t t54 = z6 ^ z7;
+  uint64_t t55 = z16 ^ z17;
+  uint64_t t56 = z12 ^ t48;
+  uint64_t t57 = t50 ^ t53;
+  uint64_t t58 = z4 ^ t46;
+  uint64_t t59 = z3 ^ t54;
+  uint64_t t60 = t46 ^ t57;
+  uint64_t t61 = z14 ^ t57;
+  uint64_t t62 = t52 ^ t58;
+  uint64_t t63 = t49 ^ t58;
+  uint64_t t64 = z4 ^ t59;
+  uint64_t t65 = t61 ^ t62;
+  uint64_t t66 = z1 ^ t63;
+  uint64_t s0 = t59 ^ t63;
+  uint64_t s6 = t56 ^ ~t62;
+  uint64_t s7 = t48 ^ ~t60;
+  uint64_t t67 = t64 ^ t65;
+  uint64_t s3 = t53 ^ t66;
+  uint64_t s4 = t51 ^ t66;
+  uint64_t s5 = t47 ^ t65;
+  uint64_t s1 = t64 ^ ~s3;
+  uint64_t s2 = t55 ^ ~t67;
+  st[7U] = s0;
+  st[6U] = s1;
+  st[5U] = s2;
+  st[4U] = s3;
+  st[3U] = s4;
+  st[2U] = s5;
+  st[1U] = s6;
+  st[0U] = s7;
+}
+
+static inline void shift_rows(uint64_t *st)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint64_t x = st[i];
+    st[i] =
+      (x & (uint64_t)0x000000000000ffffU)
+      | (x & (uint64_t)0x00000000fff00000U) >> (uint32_t)4U
+      | (x & (uint64_t)0x00000000000f0000U) << (uint32_t)12U
+      | (x & (uint64_t)0x0000ff0000000000U) >> (uint32_t)8U
+      | (x & (uint64_t)0x000000ff00000000U) << (uint32_t)8U
+      | (x & (uint64_t)0xf000000000000000U) >> (uint32_t)12U
+      | (x & (uint64_t)0x0fff000000000000U) << (uint32_t)4U;
+  }
+}
+
+static inline uint64_t rotr16(uint64_t x)
+{
+  return x >> (uint32_t)16U | x << (uint32_t)48U;
+}
+
+static inline uint64_t rotr32(uint64_t x)
+{
+  return x >> (uint32_t)32U | x << (uint32_t)32U;
+}
+
+static inline void mix_columns(uint64_t *st)
+{
+  uint64_t q0 = st[0U];
+  uint64_t q1 = st[1U];
+  uint64_t q2 = st[2U];
+  uint64_t q3 = st[3U];
+  uint64_t q4 = st[4U];
+  uint64_t q5 = st[5U];
+  uint64_t q6 = st[6U];
+  uint64_t q7 = st[7U];
+  uint64_t r0 = rotr16(q0);
+  uint64_t r1 = rotr16(q1);
+  uint64_t r2 = rotr16(q2);
+  uint64_t r3 = rotr16(q3);
+  uint64_t r4 = rotr16(q4);
+  uint64_t r5 = rotr16(q5);
+  uint64_t r6 = rotr16(q6);
+  uint64_t r7 = rotr16(q7);
+  st[0U] = q7 ^ r7 ^ r0 ^ rotr32(q0 ^ r0);
+  st[1U] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ rotr32(q1 ^ r1);
+  st[2U] = q1 ^ r1 ^ r2 ^ rotr32(q2 ^ r2);
+  st[3U] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ rotr32(q3 ^ r3);
+  st[4U] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ rotr32(q4 ^ r4);
+  st[5U] = q4 ^ r4 ^ r5 ^ rotr32(q5 ^ r5);
+  st[6U] = q5 ^ r5 ^ r6 ^ rotr32(q6 ^ r6);
+  st[7U] = q6 ^ r6 ^ r7 ^ rotr32(q7 ^ r7);
+}
+
+static inline void xor_key(uint64_t *st, uint8_t *key)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    st[i] = st[i] ^ load64_le(key + i * (uint32_t)8U);
+  }
+}
+
+static void encrypt_state(uint32_t nr, uint64_t *st, uint8_t *keys)
+{
+  xor_key(st, keys);
+  for (uint32_t i = (uint32_t)1U; i < nr; i++)
+  {
+    sub_bytes(st);
+    shift_rows(st);
+    mix_columns(st);
+    xor_key(st, keys + i * (uint32_t)64U);
+  }
+  sub_bytes(st);
+  shift_rows(st);
+  xor_key(st, keys + nr * (uint32_t)64U);
+}
+
+static uint32_t sub_word(uint32_t w)
+{
+  uint64_t st[8U] = { 0U };
+  st[0U] = (uint64_t)w;
+  transpose_state(st);
+  sub_bytes(st);
+  transpose_state(st);
+  return (uint32_t)st[0U];
+}
+
+static const
+uint32_t
+rcon[10U] =
+  {
+    (uint32_t)0x01U, (uint32_t)0x02U, (uint32_t)0x04U, (uint32_t)0x08U, (uint32_t)0x10U,
+    (uint32_t)0x20U, (uint32_t)0x40U, (uint32_t)0x80U, (uint32_t)0x1bU, (uint32_t)0x36U
+  };
+
+/* The NIST key schedule on little-endian words, followed by the bitslicing of
+   each round key, replicated in the four block slots. */
+static void key_expansion(uint32_t nk, uint32_t nr, uint8_t *keys, uint8_t *key)
+{
+  uint32_t w[60U] = { 0U };
+  uint64_t st[8U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < nk; i++)
+  {
+    w[i] = load32_le(key + i * (uint32_t)4U);
+  }
+  for (uint32_t i = nk; i < (nr + (uint32_t)1U) * (uint32_t)4U; i++)
+  {
+    uint32_t tmp = w[i - (uint32_t)1U];
+    uint32_t tmp1;
+    if (i % nk == (uint32_t)0U)
+    {
+      tmp1 =
+        sub_word(tmp >> (uint32_t)8U | tmp << (uint32_t)24U)
+        ^ rcon[i / nk - (uint32_t)1U];
+    }
+    else if (nk == (uint32_t)8U && i % nk == (uint32_t)4U)
+    {
+      tmp1 = sub_word(tmp);
+    }
+    else
+    {
+      tmp1 = tmp;
+    }
+    w[i] = w[i - nk] ^ tmp1;
+  }
+  for (uint32_t i = (uint32_t)0U; i < nr + (uint32_t)1U; i++)
+  {
+    uint32_t *wi = w + i * (uint32_t)4U;
+    uint64_t q0 = spread_bytes(wi[0U]) | spread_bytes(wi[2U]) << (uint32_t)8U;
+    uint64_t q1 = spread_bytes(wi[1U]) | spread_bytes(wi[3U]) << (uint32_t)8U;
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+    {
+      st[j] = q0;
+      st[j + (uint32_t)4U] = q1;
+    }
+    transpose_state(st);
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      store64_le(keys + i * (uint32_t)64U + j * (uint32_t)8U, st[j]);
+    }
+  }
+}
+
+static void encrypt_block(uint32_t nr, uint8_t *out, uint8_t *inp, uint8_t *keys)
+{
+  uint64_t st[8U] = { 0U };
+  uint8_t b[64U] = { 0U };
+  memcpy(b, inp, (uint32_t)16U * sizeof (uint8_t));
+  load_state(st, b);
+  encrypt_state(nr, st, keys);
+  store_state(b, st);
+  memcpy(out, b, (uint32_t)16U * sizeof (uint8_t));
+}
+
+/* Four consecutive counter blocks, starting from the counter value c. */
+static inline void counter_blocks(uint8_t *ctrs, uint8_t *ctr_block, uint32_t c)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint8_t *b = ctrs + i * (uint32_t)16U;
+    memcpy(b, ctr_block, (uint32_t)12U * sizeof (uint8_t));
+    store32_be(b + (uint32_t)12U, c + i);
+  }
+}
+
+/* CTR mode with a 32-bit big-endian counter in the last four bytes of
+   ctr_block, wrapping around modulo 2^32; out and inp may be equal. */
+static void
+ctr32_be(uint32_t nr, uint32_t len, uint8_t *out, uint8_t *inp, uint8_t *keys, uint8_t *ctr_block)
+{
+  uint64_t st[8U] = { 0U };
+  uint8_t ctrs[64U] = { 0U };
+  uint8_t kb[64U] = { 0U };
+  uint32_t c0 = load32_be(ctr_block + (uint32_t)12U);
+  uint32_t nb = len / (uint32_t)64U;
+  uint32_t rem = len % (uint32_t)64U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    uint8_t *ob = out + i * (uint32_t)64U;
+    uint8_t *ib = inp + i * (uint32_t)64U;
+    counter_blocks(ctrs, ctr_block, c0 + i * (uint32_t)4U);
+    load_state(st, ctrs);
+    encrypt_state(nr, st, keys);
+    store_state(kb, st);
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)64U; j++)
+    {
+      ob[j] = ib[j] ^ kb[j];
+    }
+  }
+  if (rem > (uint32_t)0U)
+  {
+    uint8_t *ob = out + nb * (uint32_t)64U;
+    uint8_t *ib = inp + nb * (uint32_t)64U;
+    counter_blocks(ctrs, ctr_block, c0 + nb * (uint32_t)4U);
+    load_state(st, ctrs);
+    encrypt_state(nr, st, keys);
+    store_state(kb, st);
+    for (uint32_t j = (uint32_t)0U; j < rem; j++)
+    {
+      ob[j] = ib[j] ^ kb[j];
+    }
+  }
+}
+
+void Hacl_AES_BitSlice_aes128_key_expansion(uint8_t *keys, uint8_t *key)
+{
+  key_expansion((uint32_t)4U, (uint32_t)10U, keys, key);
+}
+
+void Hacl_AES_BitSlice_aes256_key_expansion(uint8_t *keys, uint8_t *key)
+{
+  key_expansion((uint32_t)8U, (uint32_t)14U, keys, key);
+}
+
+void Hacl_AES_BitSlice_aes128_encrypt_block(uint8_t *out, uint8_t *inp, uint8_t *keys)
+{
+  encrypt_block((uint32_t)10U, out, inp, keys);
+}
+
+void Hacl_AES_BitSlice_aes256_encrypt_block(uint8_t *out, uint8_t *inp, uint8_t *keys)
+{
+  encrypt_block((uint32_t)14U, out, inp, keys);
+}
+
+void
+Hacl_AES_BitSlice_aes128_ctr32_be(
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *inp,
+  uint8_t *keys,
+  uint8_t *ctr_block
+)
+{
+  ctr32_be((uint32_t)10U, len, out, inp, keys, ctr_block);
+}
+
+void
+Hacl_AES_BitSlice_aes256_ctr32_be(
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *inp,
+  uint8_t *keys,
+  uint8_t *ctr_block
+)
+{
+  ctr32_be((uint32_t)14U, len, out, inp, keys, ctr_block);
+}
+
@@ -0,0 +1,182 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+
+#include "Hacl_AES_NI.h"
+
+static inline void
+aes_enc_rounds(
+  uint32_t nr,
+  uint32_t n,
+  Lib_IntVector_Intrinsics_vec128 *st,
+  uint8_t *keys
+)
+{
+  Lib_IntVector_Intrinsics_vec128 k0 = Lib_IntVector_Intrinsics_vec128_load_le(keys);
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    st[i] = Lib_IntVector_Intrinsics_vec128_xor(st[i], k0);
+  }
+  for (uint32_t i0 = (uint32_t)0U; i0 < nr - (uint32_t)1U; i0++)
+  {
+    Lib_IntVector_Intrinsics_vec128
+    k = Lib_IntVector_Intrinsics_vec128_load_le(keys + (i0 + (uint32_t)1U) * (uint32_t)16U);
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      st[i] = Lib_IntVector_Intrinsics_ni_aes_enc(st[i], k);
+    }
+  }
+  Lib_IntVector_Intrinsics_vec128
+  kn = Lib_IntVector_Intrinsics_vec128_load_le(keys + nr * (uint32_t)16U);
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    st[i] = Lib_IntVector_Intrinsics_ni_aes_enc_last(st[i], kn);
+  }
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+counter_block(Lib_IntVector_Intrinsics_vec128 c0, uint32_t i)
+{
+  return
+    Lib_IntVector_Intrinsics_vec128_add32(c0,
+      Lib_IntVector_Intrinsics_vec128_load32s(i, (uint32_t)0U, (uint32_t)0U, (uint32_t)0U));
+}
+
+static inline void encrypt_block(uint32_t nr, uint8_t *out, uint8_t *inp, uint8_t *keys)
+{
+  Lib_IntVector_Intrinsics_vec128 st[1U];
+  for (uint32_t _i = 0U; _i < (uint32_t)1U; ++_i)
+    st[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  st[0U] = Lib_IntVector_Intrinsics_vec128_load_le(inp);
+  aes_enc_rounds(nr, (uint32_t)1U, st, keys);
+  Lib_IntVector_Intrinsics_vec128_store_le(out, st[0U]);
+}
+
+static inline void
+ctr32_le(
+  uint32_t nr,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *inp,
+  uint8_t *keys,
+  uint8_t *ctr_block
+)
+{
+  Lib_IntVector_Intrinsics_vec128 st[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    st[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 c0 = Lib_IntVector_Intrinsics_vec128_load_le(ctr_block);
+  uint32_t nb8 = len / (uint32_t)128U;
+  for (uint32_t i0 = (uint32_t)0U; i0 < nb8; i0++)
+  {
+    uint8_t *ib = inp + i0 * (uint32_t)128U;
+    uint8_t *ob = out + i0 * (uint32_t)128U;
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      st[i] = counter_block(c0, i0 * (uint32_t)8U + i);
+    }
+    aes_enc_rounds(nr, (uint32_t)8U, st, keys);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      Lib_IntVector_Intrinsics_vec128
+      b = Lib_IntVector_Intrinsics_vec128_load_le(ib + i * (uint32_t)16U);
+      Lib_IntVector_Intrinsics_vec128_store_le(ob + i * (uint32_t)16U,
+        Lib_IntVector_Intrinsics_vec128_xor(b, st[i]));
+    }
+  }
+  uint32_t len1 = len - nb8 * (uint32_t)128U;
+  uint8_t *ib = inp + nb8 * (uint32_t)128U;
+  uint8_t *ob = out + nb8 * (uint32_t)128U;
+  uint32_t nb = len1 / (uint32_t)16U;
+  uint32_t rem = len1 % (uint32_t)16U;
+  uint32_t ite;
+  if (rem == (uint32_t)0U)
+  {
+    ite = (uint32_t)0U;
+  }
+  else
+  {
+    ite = (uint32_t)1U;
+  }
+  uint32_t n = nb + ite;
+  if (n > (uint32_t)0U)
+  {
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      st[i] = counter_block(c0, nb8 * (uint32_t)8U + i);
+    }
+    aes_enc_rounds(nr, n, st, keys);
+    for (uint32_t i = (uint32_t)0U; i < nb; i++)
+    {
+      Lib_IntVector_Intrinsics_vec128
+      b = Lib_IntVector_Intrinsics_vec128_load_le(ib + i * (uint32_t)16U);
+      Lib_IntVector_Intrinsics_vec128_store_le(ob + i * (uint32_t)16U,
+        Lib_IntVector_Intrinsics_vec128_xor(b, st[i]));
+    }
+    if (rem > (uint32_t)0U)
+    {
+      uint8_t last[16U] = { 0U };
+      memcpy(last, ib + nb * (uint32_t)16U, rem * sizeof (uint8_t));
+      Lib_IntVector_Intrinsics_vec128 b = Lib_IntVector_Intrinsics_vec128_load_le(last);
+      Lib_IntVector_Intrinsics_vec128_store_le(last, Lib_IntVector_Intrinsics_vec128_xor(b, st[nb]));
+      memcpy(ob + nb * (uint32_t)16U, last, rem * sizeof (uint8_t));
+    }
+  }
+}
+
+void Hacl_AES_NI_aes128_encrypt_block(uint8_t *out, uint8_t *inp, uint8_t *keys)
+{
+  encrypt_block((uint32_t)10U, out, inp, keys);
+}
+
+void Hacl_AES_NI_aes256_encrypt_block(uint8_t *out, uint8_t *inp, uint8_t *keys)
+{
+  encrypt_block((uint32_t)14U, out, inp, keys);
+}
+
+void
+Hacl_AES_NI_aes128_ctr32_le(
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *inp,
+  uint8_t *keys,
+  uint8_t *ctr_block
+)
+{
+  ctr32_le((uint32_t)10U, len, out, inp, keys, ctr_block);
+}
+
+void
+Hacl_AES_NI_aes256_ctr32_le(
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *inp,
+  uint8_t *keys,
+  uint8_t *ctr_block
+)
+{
+  ctr32_le((uint32_t)14U, len, out, inp, keys, ctr_block);
+}
+
@@ -0,0 +1,77 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+
+#ifndef __Hacl_AES_NI_H
+#define __Hacl_AES_NI_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+
+
+/* AES encryption with AES-NI. The keys are expanded by Vale
+   (aes128_key_expansion, aes256_key_expansion): 11 (resp. 15) round keys. */
+
+void Hacl_AES_NI_aes128_encrypt_block(uint8_t *out, uint8_t *inp, uint8_t *keys);
+
+void Hacl_AES_NI_aes256_encrypt_block(uint8_t *out, uint8_t *inp, uint8_t *keys);
+
+/* CTR mode with a 32-bit little-endian counter in the first four bytes of the
+   counter block, which wraps around modulo 2^32 (as in AES-GCM-SIV). Eight
+   blocks are encrypted at a time. */
+void
+Hacl_AES_NI_aes128_ctr32_le(
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *inp,
+  uint8_t *keys,
+  uint8_t *ctr_block
+);
+
+void
+Hacl_AES_NI_aes256_ctr32_le(
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *inp,
+  uint8_t *keys,
+  uint8_t *ctr_block
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_AES_NI_H_DEFINED
+#endif
@@ -922,6 +922,292 @@ Hacl_Bignum_Exponentiation_bn_mod_exp_fw_ct_precompr2_u64(
   Hacl_Bignum_Montgomery_bn_mont_reduction_u64(len, n, mu, tmp, res);
 }
 
+static inline void
+Hacl_Bignum_ExpFixedBase_bn_fb_precomp_table_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint64_t *a,
+  uint32_t tBits,
+  uint32_t l,
+  uint64_t *table
+)
+{
+  uint32_t d = (tBits - (uint32_t)1U) / l + (uint32_t)1U;
+  uint32_t table_len = (uint32_t)1U << l;
+  memset(table, 0U, table_len * len * sizeof (uint64_t));
+  uint64_t *oneM = table;
+  uint64_t *aM = table + len;
+  KRML_CHECK_SIZE(sizeof (uint64_t), len);
+  uint64_t one[len];
+  memset(one, 0U, len * sizeof (uint64_t));
+  memset(one, 0U, len * sizeof (uint64_t));
+  one[0U] = (uint64_t)1U;
+  KRML_CHECK_SIZE(sizeof (uint64_t), len + len);
+  uint64_t c0[len + len];
+  memset(c0, 0U, (len + len) * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)4U * len);
+  uint64_t tmp1[(uint32_t)4U * len];
+  memset(tmp1, 0U, (uint32_t)4U * len * sizeof (uint64_t));
+  Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint64(len, one, r2, tmp1, c0);
+  Hacl_Bignum_Montgomery_bn_mont_reduction_u64(len, n, mu, c0, oneM);
+  KRML_CHECK_SIZE(sizeof (uint64_t), len + len);
+  uint64_t c2[len + len];
+  memset(c2, 0U, (len + len) * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)4U * len);
+  uint64_t tmp3[(uint32_t)4U * len];
+  memset(tmp3, 0U, (uint32_t)4U * len * sizeof (uint64_t));
+  Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint64(len, a, r2, tmp3, c2);
+  Hacl_Bignum_Montgomery_bn_mont_reduction_u64(len, n, mu, c2, aM);
+  for (uint32_t i0 = (uint32_t)0U; i0 < l - (uint32_t)1U; i0++)
+  {
+    uint32_t k1 = (uint32_t)1U << (i0 + (uint32_t)1U);
+    uint64_t *t1 = table + (k1 >> (uint32_t)1U) * len;
+    uint64_t *t2 = table + k1 * len;
+    memcpy(t2, t1, len * sizeof (uint64_t));
+    for (uint32_t i = (uint32_t)0U; i < d; i++)
+    {
+      KRML_CHECK_SIZE(sizeof (uint64_t), len + len);
+      uint64_t c4[len + len];
+      memset(c4, 0U, (len + len) * sizeof (uint64_t));
+      KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)4U * len);
+      uint64_t tmp5[(uint32_t)4U * len];
+      memset(tmp5, 0U, (uint32_t)4U * len * sizeof (uint64_t));
+      Hacl_Bignum_Karatsuba_bn_karatsuba_sqr_uint64(len, t2, tmp5, c4);
+      Hacl_Bignum_Montgomery_bn_mont_reduction_u64(len, n, mu, c4, t2);
+    }
+    for (uint32_t i = (uint32_t)0U; i < k1 - (uint32_t)1U; i++)
+    {
+      uint64_t *ti = table + (i + (uint32_t)1U) * len;
+      uint64_t *tj = table + (k1 + i + (uint32_t)1U) * len;
+      KRML_CHECK_SIZE(sizeof (uint64_t), len + len);
+      uint64_t c6[len + len];
+      memset(c6, 0U, (len + len) * sizeof (uint64_t));
+      KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)4U * len);
+      uint64_t tmp7[(uint32_t)4U * len];
+      memset(tmp7, 0U, (uint32_t)4U * len * sizeof (uint64_t));
+      Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint64(len, ti, t2, tmp7, c6);
+      Hacl_Bignum_Montgomery_bn_mont_reduction_u64(len, n, mu, c6, tj);
+    }
+  }
+}
+
+static inline void
+Hacl_Bignum_ExpFixedBase_bn_mod_exp_fb_raw_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint32_t tBits,
+  uint32_t l,
+  uint64_t *table,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  uint32_t d = (tBits - (uint32_t)1U) / l + (uint32_t)1U;
+  KRML_CHECK_SIZE(sizeof (uint64_t), len);
+  uint64_t accM[len];
+  memset(accM, 0U, len * sizeof (uint64_t));
+  uint64_t x0[1U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < l; i++)
+  {
+    uint32_t k = i * d + d - (uint32_t)1U;
+    uint64_t ite;
+    if (k < bBits)
+    {
+      uint32_t i1 = k / (uint32_t)64U;
+      uint32_t j = k % (uint32_t)64U;
+      uint64_t tmp = b[i1];
+      ite = tmp >> j & (uint64_t)1U;
+    }
+    else
+    {
+      ite = (uint64_t)0U;
+    }
+    uint64_t bit = ite;
+    x0[0U] = x0[0U] | bit << i;
+  }
+  uint64_t bits_l0 = x0[0U];
+  uint32_t bits_l320 = (uint32_t)bits_l0;
+  memcpy(accM, table + bits_l320 * len, len * sizeof (uint64_t));
+  for (uint32_t i0 = (uint32_t)0U; i0 < d - (uint32_t)1U; i0++)
+  {
+    KRML_CHECK_SIZE(sizeof (uint64_t), len + len);
+    uint64_t c0[len + len];
+    memset(c0, 0U, (len + len) * sizeof (uint64_t));
+    KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)4U * len);
+    uint64_t tmp1[(uint32_t)4U * len];
+    memset(tmp1, 0U, (uint32_t)4U * len * sizeof (uint64_t));
+    Hacl_Bignum_Karatsuba_bn_karatsuba_sqr_uint64(len, accM, tmp1, c0);
+    Hacl_Bignum_Montgomery_bn_mont_reduction_u64(len, n, mu, c0, accM);
+    uint64_t x[1U] = { 0U };
+    for (uint32_t i = (uint32_t)0U; i < l; i++)
+    {
+      uint32_t k = i * d + d - i0 - (uint32_t)2U;
+      uint64_t ite;
+      if (k < bBits)
+      {
+        uint32_t i1 = k / (uint32_t)64U;
+        uint32_t j = k % (uint32_t)64U;
+        uint64_t tmp = b[i1];
+        ite = tmp >> j & (uint64_t)1U;
+      }
+      else
+      {
+        ite = (uint64_t)0U;
+      }
+      uint64_t bit = ite;
+      x[0U] = x[0U] | bit << i;
+    }
+    uint64_t bits_l = x[0U];
+    uint32_t bits_l32 = (uint32_t)bits_l;
+    uint64_t *a_bits_l = table + bits_l32 * len;
+    KRML_CHECK_SIZE(sizeof (uint64_t), len + len);
+    uint64_t c2[len + len];
+    memset(c2, 0U, (len + len) * sizeof (uint64_t));
+    KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)4U * len);
+    uint64_t tmp3[(uint32_t)4U * len];
+    memset(tmp3, 0U, (uint32_t)4U * len * sizeof (uint64_t));
+    Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint64(len, accM, a_bits_l, tmp3, c2);
+    Hacl_Bignum_Montgomery_bn_mont_reduction_u64(len, n, mu, c2, accM);
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), len + len);
+  uint64_t tmp4[len + len];
+  memset(tmp4, 0U, (len + len) * sizeof (uint64_t));
+  memcpy(tmp4, accM, len * sizeof (uint64_t));
+  Hacl_Bignum_Montgomery_bn_mont_reduction_u64(len, n, mu, tmp4, res);
+}
+
+static inline void
+Hacl_Bignum_ExpFixedBase_bn_mod_exp_fb_ct_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint32_t tBits,
+  uint32_t l,
+  uint64_t *table,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  uint32_t d = (tBits - (uint32_t)1U) / l + (uint32_t)1U;
+  KRML_CHECK_SIZE(sizeof (uint64_t), len);
+  uint64_t accM[len];
+  memset(accM, 0U, len * sizeof (uint64_t));
+  uint64_t x0[1U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < l; i++)
+  {
+    uint32_t k = i * d + d - (uint32_t)1U;
+    uint64_t ite;
+    if (k < bBits)
+    {
+      uint32_t i1 = k / (uint32_t)64U;
+      uint32_t j = k % (uint32_t)64U;
+      uint64_t tmp = b[i1];
+      ite = tmp >> j & (uint64_t)1U;
+    }
+    else
+    {
+      ite = (uint64_t)0U;
+    }
+    uint64_t bit = ite;
+    x0[0U] = x0[0U] | bit << i;
+  }
+  uint64_t bits_l0 = x0[0U];
+  memcpy(accM, table, len * sizeof (uint64_t));
+  for (uint32_t i1 = (uint32_t)0U; i1 < ((uint32_t)1U << l) - (uint32_t)1U; i1++)
+  {
+    uint64_t c = FStar_UInt64_eq_mask(bits_l0, (uint64_t)(i1 + (uint32_t)1U));
+    uint64_t *res_j = table + (i1 + (uint32_t)1U) * len;
+    for (uint32_t i = (uint32_t)0U; i < len; i++)
+    {
+      uint64_t *os = accM;
+      uint64_t x = (c & res_j[i]) | (~c & accM[i]);
+      os[i] = x;
+    }
+  }
+  for (uint32_t i0 = (uint32_t)0U; i0 < d - (uint32_t)1U; i0++)
+  {
+    KRML_CHECK_SIZE(sizeof (uint64_t), len + len);
+    uint64_t c0[len + len];
+    memset(c0, 0U, (len + len) * sizeof (uint64_t));
+    KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)4U * len);
+    uint64_t tmp1[(uint32_t)4U * len];
+    memset(tmp1, 0U, (uint32_t)4U * len * sizeof (uint64_t));
+    Hacl_Bignum_Karatsuba_bn_karatsuba_sqr_uint64(len, accM, tmp1, c0);
+    Hacl_Bignum_Montgomery_bn_mont_reduction_u64(len, n, mu, c0, accM);
+    uint64_t x[1U] = { 0U };
+    for (uint32_t i = (uint32_t)0U; i < l; i++)
+    {
+      uint32_t k = i * d + d - i0 - (uint32_t)2U;
+      uint64_t ite;
+      if (k < bBits)
+      {
+        uint32_t i1 = k / (uint32_t)64U;
+        uint32_t j = k % (uint32_t)64U;
+        uint64_t tmp = b[i1];
+        ite = tmp >> j & (uint64_t)1U;
+      }
+      else
+      {
+        ite = (uint64_t)0U;
+      }
+      uint64_t bit = ite;
+      x[0U] = x[0U] | bit << i;
+    }
+    uint64_t bits_l = x[0U];
+    KRML_CHECK_SIZE(sizeof (uint64_t), len);
+    uint64_t a_bits_l[len];
+    memset(a_bits_l, 0U, len * sizeof (uint64_t));
+    memcpy(a_bits_l, table, len * sizeof (uint64_t));
+    for (uint32_t i1 = (uint32_t)0U; i1 < ((uint32_t)1U << l) - (uint32_t)1U; i1++)
+    {
+      uint64_t c = FStar_UInt64_eq_mask(bits_l, (uint64_t)(i1 + (uint32_t)1U));
+      uint64_t *res_j = table + (i1 + (uint32_t)1U) * len;
+      for (uint32_t i = (uint32_t)0U; i < len; i++)
+      {
+        uint64_t *os = a_bits_l;
+        uint64_t x1 = (c & res_j[i]) | (~c & a_bits_l[i]);
+        os[i] = x1;
+      }
+    }
+    KRML_CHECK_SIZE(sizeof (uint64_t), len + len);
+    uint64_t c2[len + len];
+    memset(c2, 0U, (len + len) * sizeof (uint64_t));
+    KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)4U * len);
+    uint64_t tmp3[(uint32_t)4U * len];
+    memset(tmp3, 0U, (uint32_t)4U * len * sizeof (uint64_t));
+    Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint64(len, accM, a_bits_l, tmp3, c2);
+    Hacl_Bignum_Montgomery_bn_mont_reduction_u64(len, n, mu, c2, accM);
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), len + len);
+  uint64_t tmp4[len + len];
+  memset(tmp4, 0U, (len + len) * sizeof (uint64_t));
+  memcpy(tmp4, accM, len * sizeof (uint64_t));
+  Hacl_Bignum_Montgomery_bn_mont_reduction_u64(len, n, mu, tmp4, res);
+}
+
+typedef struct Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64_s
+{
+  uint32_t len;
+  uint64_t *n;
+  uint64_t mu;
+  uint64_t *r2;
+}
+Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64;
+
+typedef struct Hacl_Bignum_ExpFixedBase_bn_fb_table_u64_s
+{
+  uint32_t len;
+  uint32_t tBits;
+  uint32_t l;
+  uint64_t *table;
+}
+Hacl_Bignum_ExpFixedBase_bn_fb_table_u64;
+
 #if defined(__cplusplus)
 }
 #endif
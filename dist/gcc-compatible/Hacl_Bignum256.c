@@ -372,6 +372,35 @@ static inline void reduction(uint64_t *n, uint64_t nInv, uint64_t *c, uint64_t *
   }
 }
 
+static inline void to(uint64_t *n, uint64_t nInv, uint64_t *r2, uint64_t *a, uint64_t *aM)
+{
+  uint64_t c[8U] = { 0U };
+  Hacl_Bignum256_mul(a, r2, c);
+  reduction(n, nInv, c, aM);
+}
+
+static inline void from(uint64_t *n, uint64_t nInv_u64, uint64_t *aM, uint64_t *a)
+{
+  uint64_t tmp[8U] = { 0U };
+  memcpy(tmp, aM, (uint32_t)4U * sizeof (uint64_t));
+  reduction(n, nInv_u64, tmp, a);
+}
+
+static inline void
+mont_mul(uint64_t *n, uint64_t nInv_u64, uint64_t *aM, uint64_t *bM, uint64_t *resM)
+{
+  uint64_t c[8U] = { 0U };
+  Hacl_Bignum256_mul(aM, bM, c);
+  reduction(n, nInv_u64, c, resM);
+}
+
+static inline void mont_sqr(uint64_t *n, uint64_t nInv_u64, uint64_t *aM, uint64_t *resM)
+{
+  uint64_t c[8U] = { 0U };
+  sqr(aM, c);
+  reduction(n, nInv_u64, c, resM);
+}
+
 /*
 Write `a mod n` in `res` if a < n * n.
 
@@ -928,6 +957,451 @@ bool Hacl_Bignum256_mod_inv_prime_raw(uint64_t *n, uint64_t *a, uint64_t *res)
   return is_valid_m == (uint64_t)0xFFFFFFFFFFFFFFFFU;
 }
 
+static inline void
+mod_exp_fw_raw_precomp(
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint32_t l,
+  uint64_t *res
+)
+{
+  uint64_t aM[4U] = { 0U };
+  to(n, mu, r2, a, aM);
+  uint64_t resM[4U] = { 0U };
+  uint32_t bLen = (bBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint64_t one[4U] = { 0U };
+  memset(one, 0U, (uint32_t)4U * sizeof (uint64_t));
+  one[0U] = (uint64_t)1U;
+  to(n, mu, r2, one, resM);
+  uint32_t table_len = (uint32_t)1U << l;
+  KRML_CHECK_SIZE(sizeof (uint64_t), table_len * (uint32_t)4U);
+  uint64_t table[table_len * (uint32_t)4U];
+  memset(table, 0U, table_len * (uint32_t)4U * sizeof (uint64_t));
+  memcpy(table, resM, (uint32_t)4U * sizeof (uint64_t));
+  memcpy(table + (uint32_t)4U, aM, (uint32_t)4U * sizeof (uint64_t));
+  for (uint32_t i = (uint32_t)0U; i < table_len - (uint32_t)2U; i++)
+  {
+    uint64_t *t1 = table + (i + (uint32_t)1U) * (uint32_t)4U;
+    uint64_t *t2 = table + (i + (uint32_t)2U) * (uint32_t)4U;
+    mont_mul(n, mu, t1, aM, t2);
+  }
+  uint32_t it = bBits / l;
+  for (uint32_t i0 = (uint32_t)0U; i0 < it; i0++)
+  {
+    uint64_t mask_l = ((uint64_t)1U << l) - (uint64_t)1U;
+    uint32_t i1 = (bBits - l * i0 - l) / (uint32_t)64U;
+    uint32_t j = (bBits - l * i0 - l) % (uint32_t)64U;
+    uint64_t p1 = b[i1] >> j;
+    uint64_t ite;
+    if (i1 + (uint32_t)1U < bLen && (uint32_t)0U < j)
+    {
+      ite = p1 | b[i1 + (uint32_t)1U] << ((uint32_t)64U - j);
+    }
+    else
+    {
+      ite = p1;
+    }
+    uint64_t bits_l = ite & mask_l;
+    uint32_t bits_l32 = (uint32_t)bits_l;
+    uint64_t *a_powbits_l = table + bits_l32 * (uint32_t)4U;
+    for (uint32_t i = (uint32_t)0U; i < l; i++)
+    {
+      mont_sqr(n, mu, resM, resM);
+    }
+    mont_mul(n, mu, resM, a_powbits_l, resM);
+  }
+  if (!(bBits % l == (uint32_t)0U))
+  {
+    uint32_t c = bBits % l;
+    for (uint32_t i = (uint32_t)0U; i < c; i++)
+    {
+      mont_sqr(n, mu, resM, resM);
+    }
+    uint32_t c10 = bBits % l;
+    uint64_t mask_l = ((uint64_t)1U << c10) - (uint64_t)1U;
+    uint32_t i0 = (uint32_t)0U;
+    uint32_t j = (uint32_t)0U;
+    uint64_t p1 = b[i0] >> j;
+    uint64_t ite;
+    if (i0 + (uint32_t)1U < bLen && (uint32_t)0U < j)
+    {
+      ite = p1 | b[i0 + (uint32_t)1U] << ((uint32_t)64U - j);
+    }
+    else
+    {
+      ite = p1;
+    }
+    uint64_t bits_c = ite & mask_l;
+    uint64_t bits_c0 = bits_c;
+    uint32_t bits_c32 = (uint32_t)bits_c0;
+    uint64_t *a_powbits_l = table + bits_c32 * (uint32_t)4U;
+    mont_mul(n, mu, resM, a_powbits_l, resM);
+  }
+  from(n, mu, resM, res);
+}
+
+static inline void
+mod_exp_fw_ct_precomp(
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint32_t l,
+  uint64_t *res
+)
+{
+  uint64_t aM[4U] = { 0U };
+  to(n, mu, r2, a, aM);
+  uint64_t resM[4U] = { 0U };
+  uint32_t bLen = (bBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint64_t one[4U] = { 0U };
+  memset(one, 0U, (uint32_t)4U * sizeof (uint64_t));
+  one[0U] = (uint64_t)1U;
+  to(n, mu, r2, one, resM);
+  uint32_t table_len = (uint32_t)1U << l;
+  KRML_CHECK_SIZE(sizeof (uint64_t), table_len * (uint32_t)4U);
+  uint64_t table[table_len * (uint32_t)4U];
+  memset(table, 0U, table_len * (uint32_t)4U * sizeof (uint64_t));
+  memcpy(table, resM, (uint32_t)4U * sizeof (uint64_t));
+  memcpy(table + (uint32_t)4U, aM, (uint32_t)4U * sizeof (uint64_t));
+  for (uint32_t i = (uint32_t)0U; i < table_len - (uint32_t)2U; i++)
+  {
+    uint64_t *t1 = table + (i + (uint32_t)1U) * (uint32_t)4U;
+    uint64_t *t2 = table + (i + (uint32_t)2U) * (uint32_t)4U;
+    mont_mul(n, mu, t1, aM, t2);
+  }
+  uint32_t it = bBits / l;
+  for (uint32_t i0 = (uint32_t)0U; i0 < it; i0++)
+  {
+    uint64_t mask_l = ((uint64_t)1U << l) - (uint64_t)1U;
+    uint32_t i1 = (bBits - l * i0 - l) / (uint32_t)64U;
+    uint32_t j = (bBits - l * i0 - l) % (uint32_t)64U;
+    uint64_t p1 = b[i1] >> j;
+    uint64_t ite;
+    if (i1 + (uint32_t)1U < bLen && (uint32_t)0U < j)
+    {
+      ite = p1 | b[i1 + (uint32_t)1U] << ((uint32_t)64U - j);
+    }
+    else
+    {
+      ite = p1;
+    }
+    uint64_t bits_l = ite & mask_l;
+    uint64_t a_powbits_l[4U] = { 0U };
+    memcpy(a_powbits_l, table, (uint32_t)4U * sizeof (uint64_t));
+    for (uint32_t i2 = (uint32_t)0U; i2 < table_len - (uint32_t)1U; i2++)
+    {
+      uint64_t c = FStar_UInt64_eq_mask(bits_l, (uint64_t)(i2 + (uint32_t)1U));
+      uint64_t *res_j = table + (i2 + (uint32_t)1U) * (uint32_t)4U;
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+      {
+        uint64_t *os = a_powbits_l;
+        uint64_t x = (c & res_j[i]) | (~c & a_powbits_l[i]);
+        os[i] = x;
+      }
+    }
+    for (uint32_t i = (uint32_t)0U; i < l; i++)
+    {
+      mont_sqr(n, mu, resM, resM);
+    }
+    mont_mul(n, mu, resM, a_powbits_l, resM);
+  }
+  if (!(bBits % l == (uint32_t)0U))
+  {
+    uint32_t c = bBits % l;
+    for (uint32_t i = (uint32_t)0U; i < c; i++)
+    {
+      mont_sqr(n, mu, resM, resM);
+    }
+    uint32_t c10 = bBits % l;
+    uint64_t mask_l = ((uint64_t)1U << c10) - (uint64_t)1U;
+    uint32_t i0 = (uint32_t)0U;
+    uint32_t j = (uint32_t)0U;
+    uint64_t p1 = b[i0] >> j;
+    uint64_t ite;
+    if (i0 + (uint32_t)1U < bLen && (uint32_t)0U < j)
+    {
+      ite = p1 | b[i0 + (uint32_t)1U] << ((uint32_t)64U - j);
+    }
+    else
+    {
+      ite = p1;
+    }
+    uint64_t bits_c = ite & mask_l;
+    uint64_t bits_c0 = bits_c;
+    uint64_t a_powbits_c[4U] = { 0U };
+    memcpy(a_powbits_c, table, (uint32_t)4U * sizeof (uint64_t));
+    for (uint32_t i2 = (uint32_t)0U; i2 < table_len - (uint32_t)1U; i2++)
+    {
+      uint64_t c = FStar_UInt64_eq_mask(bits_c0, (uint64_t)(i2 + (uint32_t)1U));
+      uint64_t *res_j = table + (i2 + (uint32_t)1U) * (uint32_t)4U;
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+      {
+        uint64_t *os = a_powbits_c;
+        uint64_t x = (c & res_j[i]) | (~c & a_powbits_c[i]);
+        os[i] = x;
+      }
+    }
+    mont_mul(n, mu, resM, a_powbits_c, resM);
+  }
+  from(n, mu, resM, res);
+}
+
+
+/**************************************************/
+/* Arithmetic functions with a Montgomery context */
+/**************************************************/
+
+
+/*
+Heap-allocate and initialize a montgomery context.
+
+  The argument n is meant to be a 256-bit bignum, i.e. uint64_t[4].
+
+  The context holds a copy of n, the constant r2 = 2 ^ 512 mod n and the
+  Montgomery constant mu = -n ^ (-1) mod 2 ^ 64, so that the *_ctx functions
+  below do not recompute them on every call.
+
+  The function returns NULL if:
+  • the allocation failed, or
+  • n % 2 = 1 && 1 < n does not hold
+
+  If the return value is non-null, clients must eventually call
+  Hacl_Bignum256_mont_ctx_free on it to avoid memory leaks.
+*/
+Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *Hacl_Bignum256_mont_ctx_init(uint64_t *n)
+{
+  uint64_t is_valid_m = mont_check(n);
+  if (!(is_valid_m == (uint64_t)0xFFFFFFFFFFFFFFFFU))
+  {
+    return NULL;
+  }
+  uint64_t *n1 = KRML_HOST_CALLOC((uint32_t)4U, sizeof (uint64_t));
+  if (n1 == NULL)
+  {
+    return NULL;
+  }
+  uint64_t *r2 = KRML_HOST_CALLOC((uint32_t)4U, sizeof (uint64_t));
+  if (r2 == NULL)
+  {
+    KRML_HOST_FREE(n1);
+    return NULL;
+  }
+  uint64_t *n11 = n1;
+  uint64_t *r21 = r2;
+  memcpy(n11, n, (uint32_t)4U * sizeof (uint64_t));
+  uint32_t
+  nBits = (uint32_t)64U * (uint32_t)Hacl_Bignum_Lib_bn_get_top_index_u64((uint32_t)4U, n);
+  precomp(nBits, n, r21);
+  uint64_t mu = Hacl_Bignum_ModInvLimb_mod_inv_uint64(n[0U]);
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64
+  res = { .len = (uint32_t)4U, .n = n11, .mu = mu, .r2 = r21 };
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64
+  *buf = KRML_HOST_MALLOC(sizeof (Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64));
+  if (buf == NULL)
+  {
+    KRML_HOST_FREE(n11);
+    KRML_HOST_FREE(r21);
+    return NULL;
+  }
+  buf[0U] = res;
+  return buf;
+}
+
+/*
+Deallocate the memory previously allocated by Hacl_Bignum256_mont_ctx_init.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum256_mont_ctx_init.
+*/
+void Hacl_Bignum256_mont_ctx_free(Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  uint64_t *n = k1.n;
+  uint64_t *r2 = k1.r2;
+  KRML_HOST_FREE(n);
+  KRML_HOST_FREE(r2);
+  KRML_HOST_FREE(k);
+}
+
+/*
+Write `a * 2 ^ 256 mod n` in `aM`, i.e. convert `a` to the Montgomery domain.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum256_mont_ctx_init.
+  The argument a and the outparam aM are meant to be 256-bit bignums, i.e. uint64_t[4].
+
+  This function is *UNSAFE* and requires C clients to observe that a < n.
+*/
+void
+Hacl_Bignum256_to_mont_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint64_t *aM
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  to(k1.n, k1.mu, k1.r2, a, aM);
+}
+
+/*
+Write `aM * 2 ^ (-256) mod n` in `a`, i.e. convert `aM` from the Montgomery domain.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum256_mont_ctx_init.
+  The argument aM and the outparam a are meant to be 256-bit bignums, i.e. uint64_t[4].
+
+  This function is *UNSAFE* and requires C clients to observe that aM < n.
+*/
+void
+Hacl_Bignum256_from_mont_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *aM,
+  uint64_t *a
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  from(k1.n, k1.mu, aM, a);
+}
+
+/*
+Write `aM * bM * 2 ^ (-256) mod n` in `resM`.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum256_mont_ctx_init.
+  The arguments aM, bM and the outparam resM are meant to be 256-bit bignums, i.e. uint64_t[4].
+  The arguments aM and bM are meant to be in the Montgomery domain, see
+  Hacl_Bignum256_to_mont_ctx, and so is the result. The outparam resM may alias aM or bM.
+
+  This function is *UNSAFE* and requires C clients to observe that aM < n and bM < n.
+*/
+void
+Hacl_Bignum256_mont_mul_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *aM,
+  uint64_t *bM,
+  uint64_t *resM
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  mont_mul(k1.n, k1.mu, aM, bM, resM);
+}
+
+/*
+Write `aM * aM * 2 ^ (-256) mod n` in `resM`.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum256_mont_ctx_init.
+  The argument aM and the outparam resM are meant to be 256-bit bignums, i.e. uint64_t[4].
+  The argument aM is meant to be in the Montgomery domain, see
+  Hacl_Bignum256_to_mont_ctx, and so is the result. The outparam resM may alias aM.
+
+  This function is *UNSAFE* and requires C clients to observe that aM < n.
+*/
+void
+Hacl_Bignum256_mont_sqr_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *aM,
+  uint64_t *resM
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  mont_sqr(k1.n, k1.mu, aM, resM);
+}
+
+/*
+Write `a * b mod n` in `res`.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum256_mont_ctx_init.
+  The arguments a, b and the outparam res are meant to be 256-bit bignums, i.e. uint64_t[4].
+
+  This function is *UNSAFE* and requires C clients to observe that a < n and b < n.
+*/
+void
+Hacl_Bignum256_mod_mul_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  uint64_t tmp[4U] = { 0U };
+  mont_mul(k1.n, k1.mu, a, b, tmp);
+  mont_mul(k1.n, k1.mu, tmp, k1.r2, res);
+}
+
+/*
+Write `a ^ b mod n` in `res`.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum256_mont_ctx_init.
+  The argument a and the outparam res are meant to be 256-bit bignums, i.e. uint64_t[4].
+  The argument b is a bignum of any size, and bBits is an upper bound on the
+  number of significant bits of b. A tighter bound results in faster execution
+  time. When in doubt, the number of bits for the bignum size is always a safe
+  default, e.g. if b is a 256-bit bignum, bBits should be 256.
+
+  The function is *NOT* constant-time on the argument b. See the
+  mod_exp_ct_* functions for constant-time variants.
+
+  This function is *UNSAFE* and requires C clients to observe bn_mod_exp_pre
+  from Hacl.Spec.Bignum.ExpBM.fsti, which amounts to:
+  • 0 < b
+  • b < pow2 bBits
+  • a < n
+
+  This function uses a fixed window of 4 bits and the constants of the context,
+  and is notably faster than mod_exp_raw_precompr2.
+*/
+void
+Hacl_Bignum256_mod_exp_raw_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  mod_exp_fw_raw_precomp(k1.n, k1.mu, k1.r2, a, bBits, b, (uint32_t)4U, res);
+}
+
+/*
+Write `a ^ b mod n` in `res`.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum256_mont_ctx_init.
+  The argument a and the outparam res are meant to be 256-bit bignums, i.e. uint64_t[4].
+  The argument b is a bignum of any size, and bBits is an upper bound on the
+  number of significant bits of b. A tighter bound results in faster execution
+  time. When in doubt, the number of bits for the bignum size is always a safe
+  default, e.g. if b is a 256-bit bignum, bBits should be 256.
+
+  This function is constant-time over its argument b, at the cost of a slower
+  execution time than mod_exp_raw_ctx.
+
+  This function is *UNSAFE* and requires C clients to observe bn_mod_exp_pre
+  from Hacl.Spec.Bignum.ExpBM.fsti, which amounts to:
+  • 0 < b
+  • b < pow2 bBits
+  • a < n
+
+  This function uses a fixed window of 4 bits and the constants of the context,
+  and is notably faster than mod_exp_ct_precompr2.
+*/
+void
+Hacl_Bignum256_mod_exp_ct_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  mod_exp_fw_ct_precomp(k1.n, k1.mu, k1.r2, a, bBits, b, (uint32_t)4U, res);
+}
+
 
 /********************/
 /* Loads and stores */
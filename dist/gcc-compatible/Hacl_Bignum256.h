@@ -259,6 +259,180 @@ Write `a ^ (-1) mod n` in `res`.
 bool Hacl_Bignum256_mod_inv_prime_raw(uint64_t *n, uint64_t *a, uint64_t *res);
 
 
+/**************************************************/
+/* Arithmetic functions with a Montgomery context */
+/**************************************************/
+
+
+/*
+Heap-allocate and initialize a montgomery context.
+
+  The argument n is meant to be a 256-bit bignum, i.e. uint64_t[4].
+
+  The context holds a copy of n, the constant r2 = 2 ^ 512 mod n and the
+  Montgomery constant mu = -n ^ (-1) mod 2 ^ 64, so that the *_ctx functions
+  below do not recompute them on every call.
+
+  The function returns NULL if:
+  • the allocation failed, or
+  • n % 2 = 1 && 1 < n does not hold
+
+  If the return value is non-null, clients must eventually call
+  Hacl_Bignum256_mont_ctx_free on it to avoid memory leaks.
+*/
+Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *Hacl_Bignum256_mont_ctx_init(uint64_t *n);
+
+/*
+Deallocate the memory previously allocated by Hacl_Bignum256_mont_ctx_init.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum256_mont_ctx_init.
+*/
+void Hacl_Bignum256_mont_ctx_free(Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k);
+
+/*
+Write `a * 2 ^ 256 mod n` in `aM`, i.e. convert `a` to the Montgomery domain.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum256_mont_ctx_init.
+  The argument a and the outparam aM are meant to be 256-bit bignums, i.e. uint64_t[4].
+
+  This function is *UNSAFE* and requires C clients to observe that a < n.
+*/
+void
+Hacl_Bignum256_to_mont_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint64_t *aM
+);
+
+/*
+Write `aM * 2 ^ (-256) mod n` in `a`, i.e. convert `aM` from the Montgomery domain.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum256_mont_ctx_init.
+  The argument aM and the outparam a are meant to be 256-bit bignums, i.e. uint64_t[4].
+
+  This function is *UNSAFE* and requires C clients to observe that aM < n.
+*/
+void
+Hacl_Bignum256_from_mont_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *aM,
+  uint64_t *a
+);
+
+/*
+Write `aM * bM * 2 ^ (-256) mod n` in `resM`.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum256_mont_ctx_init.
+  The arguments aM, bM and the outparam resM are meant to be 256-bit bignums, i.e. uint64_t[4].
+  The arguments aM and bM are meant to be in the Montgomery domain, see
+  Hacl_Bignum256_to_mont_ctx, and so is the result. The outparam resM may alias aM or bM.
+
+  This function is *UNSAFE* and requires C clients to observe that aM < n and bM < n.
+*/
+void
+Hacl_Bignum256_mont_mul_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *aM,
+  uint64_t *bM,
+  uint64_t *resM
+);
+
+/*
+Write `aM * aM * 2 ^ (-256) mod n` in `resM`.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum256_mont_ctx_init.
+  The argument aM and the outparam resM are meant to be 256-bit bignums, i.e. uint64_t[4].
+  The argument aM is meant to be in the Montgomery domain, see
+  Hacl_Bignum256_to_mont_ctx, and so is the result. The outparam resM may alias aM.
+
+  This function is *UNSAFE* and requires C clients to observe that aM < n.
+*/
+void
+Hacl_Bignum256_mont_sqr_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *aM,
+  uint64_t *resM
+);
+
+/*
+Write `a * b mod n` in `res`.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum256_mont_ctx_init.
+  The arguments a, b and the outparam res are meant to be 256-bit bignums, i.e. uint64_t[4].
+
+  This function is *UNSAFE* and requires C clients to observe that a < n and b < n.
+*/
+void
+Hacl_Bignum256_mod_mul_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint64_t *b,
+  uint64_t *res
+);
+
+/*
+Write `a ^ b mod n` in `res`.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum256_mont_ctx_init.
+  The argument a and the outparam res are meant to be 256-bit bignums, i.e. uint64_t[4].
+  The argument b is a bignum of any size, and bBits is an upper bound on the
+  number of significant bits of b. A tighter bound results in faster execution
+  time. When in doubt, the number of bits for the bignum size is always a safe
+  default, e.g. if b is a 256-bit bignum, bBits should be 256.
+
+  The function is *NOT* constant-time on the argument b. See the
+  mod_exp_ct_* functions for constant-time variants.
+
+  This function is *UNSAFE* and requires C clients to observe bn_mod_exp_pre
+  from Hacl.Spec.Bignum.ExpBM.fsti, which amounts to:
+  • 0 < b
+  • b < pow2 bBits
+  • a < n
+
+  This function uses a fixed window of 4 bits and the constants of the context,
+  and is notably faster than mod_exp_raw_precompr2.
+*/
+void
+Hacl_Bignum256_mod_exp_raw_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+);
+
+/*
+Write `a ^ b mod n` in `res`.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum256_mont_ctx_init.
+  The argument a and the outparam res are meant to be 256-bit bignums, i.e. uint64_t[4].
+  The argument b is a bignum of any size, and bBits is an upper bound on the
+  number of significant bits of b. A tighter bound results in faster execution
+  time. When in doubt, the number of bits for the bignum size is always a safe
+  default, e.g. if b is a 256-bit bignum, bBits should be 256.
+
+  This function is constant-time over its argument b, at the cost of a slower
+  execution time than mod_exp_raw_ctx.
+
+  This function is *UNSAFE* and requires C clients to observe bn_mod_exp_pre
+  from Hacl.Spec.Bignum.ExpBM.fsti, which amounts to:
+  • 0 < b
+  • b < pow2 bBits
+  • a < n
+
+  This function uses a fixed window of 4 bits and the constants of the context,
+  and is notably faster than mod_exp_ct_precompr2.
+*/
+void
+Hacl_Bignum256_mod_exp_ct_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+);
+
+
 /********************/
 /* Loads and stores */
 /********************/
@@ -376,6 +376,35 @@ static inline void reduction(uint64_t *n, uint64_t nInv, uint64_t *c, uint64_t *
   }
 }
 
+static inline void to(uint64_t *n, uint64_t nInv, uint64_t *r2, uint64_t *a, uint64_t *aM)
+{
+  uint64_t c[128U] = { 0U };
+  Hacl_Bignum4096_mul(a, r2, c);
+  reduction(n, nInv, c, aM);
+}
+
+static inline void from(uint64_t *n, uint64_t nInv_u64, uint64_t *aM, uint64_t *a)
+{
+  uint64_t tmp[128U] = { 0U };
+  memcpy(tmp, aM, (uint32_t)64U * sizeof (uint64_t));
+  reduction(n, nInv_u64, tmp, a);
+}
+
+static inline void
+mont_mul(uint64_t *n, uint64_t nInv_u64, uint64_t *aM, uint64_t *bM, uint64_t *resM)
+{
+  uint64_t c[128U] = { 0U };
+  Hacl_Bignum4096_mul(aM, bM, c);
+  reduction(n, nInv_u64, c, resM);
+}
+
+static inline void mont_sqr(uint64_t *n, uint64_t nInv_u64, uint64_t *aM, uint64_t *resM)
+{
+  uint64_t c[128U] = { 0U };
+  sqr(aM, c);
+  reduction(n, nInv_u64, c, resM);
+}
+
 /*
 Write `a mod n` in `res` if a < n * n.
 
@@ -938,6 +967,956 @@ bool Hacl_Bignum4096_mod_inv_prime_raw(uint64_t *n, uint64_t *a, uint64_t *res)
   return is_valid_m == (uint64_t)0xFFFFFFFFFFFFFFFFU;
 }
 
+static inline void
+mod_exp_fw_raw_precomp(
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint32_t l,
+  uint64_t *res
+)
+{
+  uint64_t aM[64U] = { 0U };
+  to(n, mu, r2, a, aM);
+  uint64_t resM[64U] = { 0U };
+  uint32_t bLen = (bBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint64_t one[64U] = { 0U };
+  memset(one, 0U, (uint32_t)64U * sizeof (uint64_t));
+  one[0U] = (uint64_t)1U;
+  to(n, mu, r2, one, resM);
+  uint32_t table_len = (uint32_t)1U << l;
+  KRML_CHECK_SIZE(sizeof (uint64_t), table_len * (uint32_t)64U);
+  uint64_t table[table_len * (uint32_t)64U];
+  memset(table, 0U, table_len * (uint32_t)64U * sizeof (uint64_t));
+  memcpy(table, resM, (uint32_t)64U * sizeof (uint64_t));
+  memcpy(table + (uint32_t)64U, aM, (uint32_t)64U * sizeof (uint64_t));
+  for (uint32_t i = (uint32_t)0U; i < table_len - (uint32_t)2U; i++)
+  {
+    uint64_t *t1 = table + (i + (uint32_t)1U) * (uint32_t)64U;
+    uint64_t *t2 = table + (i + (uint32_t)2U) * (uint32_t)64U;
+    mont_mul(n, mu, t1, aM, t2);
+  }
+  uint32_t it = bBits / l;
+  for (uint32_t i0 = (uint32_t)0U; i0 < it; i0++)
+  {
+    uint64_t mask_l = ((uint64_t)1U << l) - (uint64_t)1U;
+    uint32_t i1 = (bBits - l * i0 - l) / (uint32_t)64U;
+    uint32_t j = (bBits - l * i0 - l) % (uint32_t)64U;
+    uint64_t p1 = b[i1] >> j;
+    uint64_t ite;
+    if (i1 + (uint32_t)1U < bLen && (uint32_t)0U < j)
+    {
+      ite = p1 | b[i1 + (uint32_t)1U] << ((uint32_t)64U - j);
+    }
+    else
+    {
+      ite = p1;
+    }
+    uint64_t bits_l = ite & mask_l;
+    uint32_t bits_l32 = (uint32_t)bits_l;
+    uint64_t *a_powbits_l = table + bits_l32 * (uint32_t)64U;
+    for (uint32_t i = (uint32_t)0U; i < l; i++)
+    {
+      mont_sqr(n, mu, resM, resM);
+    }
+    mont_mul(n, mu, resM, a_powbits_l, resM);
+  }
+  if (!(bBits % l == (uint32_t)0U))
+  {
+    uint32_t c = bBits % l;
+    for (uint32_t i = (uint32_t)0U; i < c; i++)
+    {
+      mont_sqr(n, mu, resM, resM);
+    }
+    uint32_t c10 = bBits % l;
+    uint64_t mask_l = ((uint64_t)1U << c10) - (uint64_t)1U;
+    uint32_t i0 = (uint32_t)0U;
+    uint32_t j = (uint32_t)0U;
+    uint64_t p1 = b[i0] >> j;
+    uint64_t ite;
+    if (i0 + (uint32_t)1U < bLen && (uint32_t)0U < j)
+    {
+      ite = p1 | b[i0 + (uint32_t)1U] << ((uint32_t)64U - j);
+    }
+    else
+    {
+      ite = p1;
+    }
+    uint64_t bits_c = ite & mask_l;
+    uint64_t bits_c0 = bits_c;
+    uint32_t bits_c32 = (uint32_t)bits_c0;
+    uint64_t *a_powbits_l = table + bits_c32 * (uint32_t)64U;
+    mont_mul(n, mu, resM, a_powbits_l, resM);
+  }
+  from(n, mu, resM, res);
+}
+
+static inline void
+mod_exp_fw_ct_precomp(
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint32_t l,
+  uint64_t *res
+)
+{
+  uint64_t aM[64U] = { 0U };
+  to(n, mu, r2, a, aM);
+  uint64_t resM[64U] = { 0U };
+  uint32_t bLen = (bBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint64_t one[64U] = { 0U };
+  memset(one, 0U, (uint32_t)64U * sizeof (uint64_t));
+  one[0U] = (uint64_t)1U;
+  to(n, mu, r2, one, resM);
+  uint32_t table_len = (uint32_t)1U << l;
+  KRML_CHECK_SIZE(sizeof (uint64_t), table_len * (uint32_t)64U);
+  uint64_t table[table_len * (uint32_t)64U];
+  memset(table, 0U, table_len * (uint32_t)64U * sizeof (uint64_t));
+  memcpy(table, resM, (uint32_t)64U * sizeof (uint64_t));
+  memcpy(table + (uint32_t)64U, aM, (uint32_t)64U * sizeof (uint64_t));
+  for (uint32_t i = (uint32_t)0U; i < table_len - (uint32_t)2U; i++)
+  {
+    uint64_t *t1 = table + (i + (uint32_t)1U) * (uint32_t)64U;
+    uint64_t *t2 = table + (i + (uint32_t)2U) * (uint32_t)64U;
+    mont_mul(n, mu, t1, aM, t2);
+  }
+  uint32_t it = bBits / l;
+  for (uint32_t i0 = (uint32_t)0U; i0 < it; i0++)
+  {
+    uint64_t mask_l = ((uint64_t)1U << l) - (uint64_t)1U;
+    uint32_t i1 = (bBits - l * i0 - l) / (uint32_t)64U;
+    uint32_t j = (bBits - l * i0 - l) % (uint32_t)64U;
+    uint64_t p1 = b[i1] >> j;
+    uint64_t ite;
+    if (i1 + (uint32_t)1U < bLen && (uint32_t)0U < j)
+    {
+      ite = p1 | b[i1 + (uint32_t)1U] << ((uint32_t)64U - j);
+    }
+    else
+    {
+      ite = p1;
+    }
+    uint64_t bits_l = ite & mask_l;
+    uint64_t a_powbits_l[64U] = { 0U };
+    memcpy(a_powbits_l, table, (uint32_t)64U * sizeof (uint64_t));
+    for (uint32_t i2 = (uint32_t)0U; i2 < table_len - (uint32_t)1U; i2++)
+    {
+      uint64_t c = FStar_UInt64_eq_mask(bits_l, (uint64_t)(i2 + (uint32_t)1U));
+      uint64_t *res_j = table + (i2 + (uint32_t)1U) * (uint32_t)64U;
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+      {
+        uint64_t *os = a_powbits_l;
+        uint64_t x = (c & res_j[i]) | (~c & a_powbits_l[i]);
+        os[i] = x;
+      }
+    }
+    for (uint32_t i = (uint32_t)0U; i < l; i++)
+    {
+      mont_sqr(n, mu, resM, resM);
+    }
+    mont_mul(n, mu, resM, a_powbits_l, resM);
+  }
+  if (!(bBits % l == (uint32_t)0U))
+  {
+    uint32_t c = bBits % l;
+    for (uint32_t i = (uint32_t)0U; i < c; i++)
+    {
+      mont_sqr(n, mu, resM, resM);
+    }
+    uint32_t c10 = bBits % l;
+    uint64_t mask_l = ((uint64_t)1U << c10) - (uint64_t)1U;
+    uint32_t i0 = (uint32_t)0U;
+    uint32_t j = (uint32_t)0U;
+    uint64_t p1 = b[i0] >> j;
+    uint64_t ite;
+    if (i0 + (uint32_t)1U < bLen && (uint32_t)0U < j)
+    {
+      ite = p1 | b[i0 + (uint32_t)1U] << ((uint32_t)64U - j);
+    }
+    else
+    {
+      ite = p1;
+    }
+    uint64_t bits_c = ite & mask_l;
+    uint64_t bits_c0 = bits_c;
+    uint64_t a_powbits_c[64U] = { 0U };
+    memcpy(a_powbits_c, table, (uint32_t)64U * sizeof (uint64_t));
+    for (uint32_t i2 = (uint32_t)0U; i2 < table_len - (uint32_t)1U; i2++)
+    {
+      uint64_t c = FStar_UInt64_eq_mask(bits_c0, (uint64_t)(i2 + (uint32_t)1U));
+      uint64_t *res_j = table + (i2 + (uint32_t)1U) * (uint32_t)64U;
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+      {
+        uint64_t *os = a_powbits_c;
+        uint64_t x = (c & res_j[i]) | (~c & a_powbits_c[i]);
+        os[i] = x;
+      }
+    }
+    mont_mul(n, mu, resM, a_powbits_c, resM);
+  }
+  from(n, mu, resM, res);
+}
+
+
+/**************************************************/
+/* Arithmetic functions with a Montgomery context */
+/**************************************************/
+
+
+/*
+Heap-allocate and initialize a montgomery context.
+
+  The argument n is meant to be a 4096-bit bignum, i.e. uint64_t[64].
+
+  The context holds a copy of n, the constant r2 = 2 ^ 8192 mod n and the
+  Montgomery constant mu = -n ^ (-1) mod 2 ^ 64, so that the *_ctx functions
+  below do not recompute them on every call.
+
+  The function returns NULL if:
+  • the allocation failed, or
+  • n % 2 = 1 && 1 < n does not hold
+
+  If the return value is non-null, clients must eventually call
+  Hacl_Bignum4096_mont_ctx_free on it to avoid memory leaks.
+*/
+Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *Hacl_Bignum4096_mont_ctx_init(uint64_t *n)
+{
+  uint64_t is_valid_m = mont_check(n);
+  if (!(is_valid_m == (uint64_t)0xFFFFFFFFFFFFFFFFU))
+  {
+    return NULL;
+  }
+  uint64_t *n1 = KRML_HOST_CALLOC((uint32_t)64U, sizeof (uint64_t));
+  if (n1 == NULL)
+  {
+    return NULL;
+  }
+  uint64_t *r2 = KRML_HOST_CALLOC((uint32_t)64U, sizeof (uint64_t));
+  if (r2 == NULL)
+  {
+    KRML_HOST_FREE(n1);
+    return NULL;
+  }
+  uint64_t *n11 = n1;
+  uint64_t *r21 = r2;
+  memcpy(n11, n, (uint32_t)64U * sizeof (uint64_t));
+  uint32_t
+  nBits = (uint32_t)64U * (uint32_t)Hacl_Bignum_Lib_bn_get_top_index_u64((uint32_t)64U, n);
+  precomp(nBits, n, r21);
+  uint64_t mu = Hacl_Bignum_ModInvLimb_mod_inv_uint64(n[0U]);
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64
+  res = { .len = (uint32_t)64U, .n = n11, .mu = mu, .r2 = r21 };
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64
+  *buf = KRML_HOST_MALLOC(sizeof (Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64));
+  if (buf == NULL)
+  {
+    KRML_HOST_FREE(n11);
+    KRML_HOST_FREE(r21);
+    return NULL;
+  }
+  buf[0U] = res;
+  return buf;
+}
+
+/*
+Deallocate the memory previously allocated by Hacl_Bignum4096_mont_ctx_init.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+*/
+void Hacl_Bignum4096_mont_ctx_free(Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  uint64_t *n = k1.n;
+  uint64_t *r2 = k1.r2;
+  KRML_HOST_FREE(n);
+  KRML_HOST_FREE(r2);
+  KRML_HOST_FREE(k);
+}
+
+/*
+Write `a * 2 ^ 4096 mod n` in `aM`, i.e. convert `a` to the Montgomery domain.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+  The argument a and the outparam aM are meant to be 4096-bit bignums, i.e. uint64_t[64].
+
+  This function is *UNSAFE* and requires C clients to observe that a < n.
+*/
+void
+Hacl_Bignum4096_to_mont_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint64_t *aM
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  to(k1.n, k1.mu, k1.r2, a, aM);
+}
+
+/*
+Write `aM * 2 ^ (-4096) mod n` in `a`, i.e. convert `aM` from the Montgomery domain.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+  The argument aM and the outparam a are meant to be 4096-bit bignums, i.e. uint64_t[64].
+
+  This function is *UNSAFE* and requires C clients to observe that aM < n.
+*/
+void
+Hacl_Bignum4096_from_mont_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *aM,
+  uint64_t *a
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  from(k1.n, k1.mu, aM, a);
+}
+
+/*
+Write `aM * bM * 2 ^ (-4096) mod n` in `resM`.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+  The arguments aM, bM and the outparam resM are meant to be 4096-bit bignums, i.e. uint64_t[64].
+  The arguments aM and bM are meant to be in the Montgomery domain, see
+  Hacl_Bignum4096_to_mont_ctx, and so is the result. The outparam resM may alias aM or bM.
+
+  This function is *UNSAFE* and requires C clients to observe that aM < n and bM < n.
+*/
+void
+Hacl_Bignum4096_mont_mul_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *aM,
+  uint64_t *bM,
+  uint64_t *resM
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  mont_mul(k1.n, k1.mu, aM, bM, resM);
+}
+
+/*
+Write `aM * aM * 2 ^ (-4096) mod n` in `resM`.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+  The argument aM and the outparam resM are meant to be 4096-bit bignums, i.e. uint64_t[64].
+  The argument aM is meant to be in the Montgomery domain, see
+  Hacl_Bignum4096_to_mont_ctx, and so is the result. The outparam resM may alias aM.
+
+  This function is *UNSAFE* and requires C clients to observe that aM < n.
+*/
+void
+Hacl_Bignum4096_mont_sqr_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *aM,
+  uint64_t *resM
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  mont_sqr(k1.n, k1.mu, aM, resM);
+}
+
+/*
+Write `a * b mod n` in `res`.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+  The arguments a, b and the outparam res are meant to be 4096-bit bignums, i.e. uint64_t[64].
+
+  This function is *UNSAFE* and requires C clients to observe that a < n and b < n.
+*/
+void
+Hacl_Bignum4096_mod_mul_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  uint64_t tmp[64U] = { 0U };
+  mont_mul(k1.n, k1.mu, a, b, tmp);
+  mont_mul(k1.n, k1.mu, tmp, k1.r2, res);
+}
+
+/*
+Write `a ^ b mod n` in `res`.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+  The argument a and the outparam res are meant to be 4096-bit bignums, i.e. uint64_t[64].
+  The argument b is a bignum of any size, and bBits is an upper bound on the
+  number of significant bits of b. A tighter bound results in faster execution
+  time. When in doubt, the number of bits for the bignum size is always a safe
+  default, e.g. if b is a 4096-bit bignum, bBits should be 4096.
+
+  The function is *NOT* constant-time on the argument b. See the
+  mod_exp_ct_* functions for constant-time variants.
+
+  This function is *UNSAFE* and requires C clients to observe bn_mod_exp_pre
+  from Hacl.Spec.Bignum.ExpBM.fsti, which amounts to:
+  • 0 < b
+  • b < pow2 bBits
+  • a < n
+
+  This function uses a fixed window of 4 bits and the constants of the context,
+  and is notably faster than mod_exp_raw_precompr2.
+*/
+void
+Hacl_Bignum4096_mod_exp_raw_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  mod_exp_fw_raw_precomp(k1.n, k1.mu, k1.r2, a, bBits, b, (uint32_t)4U, res);
+}
+
+/*
+Write `a ^ b mod n` in `res`.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+  The argument a and the outparam res are meant to be 4096-bit bignums, i.e. uint64_t[64].
+  The argument b is a bignum of any size, and bBits is an upper bound on the
+  number of significant bits of b. A tighter bound results in faster execution
+  time. When in doubt, the number of bits for the bignum size is always a safe
+  default, e.g. if b is a 4096-bit bignum, bBits should be 4096.
+
+  This function is constant-time over its argument b, at the cost of a slower
+  execution time than mod_exp_raw_ctx.
+
+  This function is *UNSAFE* and requires C clients to observe bn_mod_exp_pre
+  from Hacl.Spec.Bignum.ExpBM.fsti, which amounts to:
+  • 0 < b
+  • b < pow2 bBits
+  • a < n
+
+  This function uses a fixed window of 4 bits and the constants of the context,
+  and is notably faster than mod_exp_ct_precompr2.
+*/
+void
+Hacl_Bignum4096_mod_exp_ct_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  mod_exp_fw_ct_precomp(k1.n, k1.mu, k1.r2, a, bBits, b, (uint32_t)4U, res);
+}
+
+static inline void
+mod_exp_multi_fw_raw_precomp(
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint32_t nBases,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint32_t l,
+  uint64_t *res
+)
+{
+  uint32_t bLen = (bBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint64_t accM[64U] = { 0U };
+  uint64_t one[64U] = { 0U };
+  memset(one, 0U, (uint32_t)64U * sizeof (uint64_t));
+  one[0U] = (uint64_t)1U;
+  to(n, mu, r2, one, accM);
+  uint32_t table_len = (uint32_t)1U << l;
+  KRML_CHECK_SIZE(sizeof (uint64_t), nBases * (table_len * (uint32_t)64U));
+  uint64_t tables[nBases * (table_len * (uint32_t)64U)];
+  memset(tables, 0U, nBases * (table_len * (uint32_t)64U) * sizeof (uint64_t));
+  for (uint32_t i0 = (uint32_t)0U; i0 < nBases; i0++)
+  {
+    uint64_t *a_i = a + i0 * (uint32_t)64U;
+    uint64_t *table = tables + i0 * (table_len * (uint32_t)64U);
+    uint64_t aM[64U] = { 0U };
+    to(n, mu, r2, a_i, aM);
+    memcpy(table, accM, (uint32_t)64U * sizeof (uint64_t));
+    memcpy(table + (uint32_t)64U, aM, (uint32_t)64U * sizeof (uint64_t));
+    for (uint32_t i = (uint32_t)0U; i < table_len - (uint32_t)2U; i++)
+    {
+      uint64_t *t1 = table + (i + (uint32_t)1U) * (uint32_t)64U;
+      uint64_t *t2 = table + (i + (uint32_t)2U) * (uint32_t)64U;
+      mont_mul(n, mu, t1, aM, t2);
+    }
+  }
+  uint32_t it = bBits / l;
+  for (uint32_t i0 = (uint32_t)0U; i0 < it; i0++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < l; i++)
+    {
+      mont_sqr(n, mu, accM, accM);
+    }
+    for (uint32_t i = (uint32_t)0U; i < nBases; i++)
+    {
+      uint64_t *b_j = b + i * bLen;
+      uint64_t mask_l = ((uint64_t)1U << l) - (uint64_t)1U;
+      uint32_t i1 = (bBits - l * i0 - l) / (uint32_t)64U;
+      uint32_t j = (bBits - l * i0 - l) % (uint32_t)64U;
+      uint64_t p1 = b_j[i1] >> j;
+      uint64_t ite;
+      if (i1 + (uint32_t)1U < bLen && (uint32_t)0U < j)
+      {
+        ite = p1 | b_j[i1 + (uint32_t)1U] << ((uint32_t)64U - j);
+      }
+      else
+      {
+        ite = p1;
+      }
+      uint64_t bits_l = ite & mask_l;
+      if (!(bits_l == (uint64_t)0U))
+      {
+        uint32_t bits_l32 = (uint32_t)bits_l;
+        uint64_t *a_powbits_l = tables + i * (table_len * (uint32_t)64U) + bits_l32 * (uint32_t)64U;
+        mont_mul(n, mu, accM, a_powbits_l, accM);
+      }
+    }
+  }
+  if (!(bBits % l == (uint32_t)0U))
+  {
+    uint32_t c = bBits % l;
+    for (uint32_t i = (uint32_t)0U; i < c; i++)
+    {
+      mont_sqr(n, mu, accM, accM);
+    }
+    for (uint32_t i = (uint32_t)0U; i < nBases; i++)
+    {
+      uint64_t *b_j = b + i * bLen;
+      uint32_t c10 = bBits % l;
+      uint64_t mask_l = ((uint64_t)1U << c10) - (uint64_t)1U;
+      uint32_t i0 = (uint32_t)0U;
+      uint32_t j = (uint32_t)0U;
+      uint64_t p1 = b_j[i0] >> j;
+      uint64_t ite;
+      if (i0 + (uint32_t)1U < bLen && (uint32_t)0U < j)
+      {
+        ite = p1 | b_j[i0 + (uint32_t)1U] << ((uint32_t)64U - j);
+      }
+      else
+      {
+        ite = p1;
+      }
+      uint64_t bits_c = ite & mask_l;
+      uint64_t bits_c0 = bits_c;
+      if (!(bits_c0 == (uint64_t)0U))
+      {
+        uint32_t bits_l32 = (uint32_t)bits_c0;
+        uint64_t *a_powbits_l = tables + i * (table_len * (uint32_t)64U) + bits_l32 * (uint32_t)64U;
+        mont_mul(n, mu, accM, a_powbits_l, accM);
+      }
+    }
+  }
+  from(n, mu, accM, res);
+}
+
+/*
+Write `a_0 ^ b_0 * a_1 ^ b_1 * ... * a_{nBases-1} ^ b_{nBases-1} mod n` in `res`.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+  The argument a points to nBases 4096-bit bignums stored one after another,
+  i.e. uint64_t[64 * nBases], and the outparam res is meant to be a 4096-bit
+  bignum, i.e. uint64_t[64].
+  The argument b points to nBases exponents stored one after another, each of
+  them on (bBits - 1) / 64 + 1 limbs, where bBits is an upper bound on the
+  number of significant bits of every exponent.
+
+  The squarings are shared by all the bases (Straus' method), so that e.g.
+  g ^ a * h ^ b * K ^ c takes about as many squarings as a single call to
+  mod_exp_raw_ctx. A window of 4 bits is used for every base, i.e. a table of
+  16 powers (8 KiB) per base on the stack, and at most 64 KiB in total.
+
+  The function is *NOT* constant-time on the argument b.
+
+  The function returns false, and leaves res unchanged, if
+  0 < nBases && nBases <= 8 does not hold; it returns true otherwise.
+
+  This function is *UNSAFE* and requires C clients to observe bn_mod_exp_multi_pre
+  from Hacl.Spec.Bignum.MultiExp.fsti, which amounts to:
+  • b_i < pow2 bBits for every i
+  • a_i < n for every i
+*/
+bool
+Hacl_Bignum4096_mod_exp_multi_raw_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint32_t nBases,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  if (nBases == (uint32_t)0U || nBases > (uint32_t)8U)
+  {
+    return false;
+  }
+  mod_exp_multi_fw_raw_precomp(k1.n, k1.mu, k1.r2, nBases, a, bBits, b, (uint32_t)4U, res);
+  return true;
+}
+
+static inline void
+fb_precomp_table(
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint64_t *a,
+  uint32_t tBits,
+  uint32_t l,
+  uint64_t *table
+)
+{
+  uint32_t d = (tBits - (uint32_t)1U) / l + (uint32_t)1U;
+  uint32_t table_len = (uint32_t)1U << l;
+  memset(table, 0U, table_len * (uint32_t)64U * sizeof (uint64_t));
+  uint64_t *oneM = table;
+  uint64_t *aM = table + (uint32_t)64U;
+  uint64_t one[64U] = { 0U };
+  memset(one, 0U, (uint32_t)64U * sizeof (uint64_t));
+  one[0U] = (uint64_t)1U;
+  to(n, mu, r2, one, oneM);
+  to(n, mu, r2, a, aM);
+  for (uint32_t i0 = (uint32_t)0U; i0 < l - (uint32_t)1U; i0++)
+  {
+    uint32_t k1 = (uint32_t)1U << (i0 + (uint32_t)1U);
+    uint64_t *t1 = table + (k1 >> (uint32_t)1U) * (uint32_t)64U;
+    uint64_t *t2 = table + k1 * (uint32_t)64U;
+    memcpy(t2, t1, (uint32_t)64U * sizeof (uint64_t));
+    for (uint32_t i = (uint32_t)0U; i < d; i++)
+    {
+      mont_sqr(n, mu, t2, t2);
+    }
+    for (uint32_t i = (uint32_t)0U; i < k1 - (uint32_t)1U; i++)
+    {
+      uint64_t *ti = table + (i + (uint32_t)1U) * (uint32_t)64U;
+      uint64_t *tj = table + (k1 + i + (uint32_t)1U) * (uint32_t)64U;
+      mont_mul(n, mu, ti, t2, tj);
+    }
+  }
+}
+
+static inline void
+mod_exp_fb_raw(
+  uint64_t *n,
+  uint64_t mu,
+  uint32_t tBits,
+  uint32_t l,
+  uint64_t *table,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  uint32_t d = (tBits - (uint32_t)1U) / l + (uint32_t)1U;
+  uint64_t accM[64U] = { 0U };
+  uint64_t x0[1U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < l; i++)
+  {
+    uint32_t k = i * d + d - (uint32_t)1U;
+    uint64_t ite;
+    if (k < bBits)
+    {
+      uint32_t i1 = k / (uint32_t)64U;
+      uint32_t j = k % (uint32_t)64U;
+      uint64_t tmp = b[i1];
+      ite = tmp >> j & (uint64_t)1U;
+    }
+    else
+    {
+      ite = (uint64_t)0U;
+    }
+    uint64_t bit = ite;
+    x0[0U] = x0[0U] | bit << i;
+  }
+  uint64_t bits_l0 = x0[0U];
+  uint32_t bits_l320 = (uint32_t)bits_l0;
+  memcpy(accM, table + bits_l320 * (uint32_t)64U, (uint32_t)64U * sizeof (uint64_t));
+  for (uint32_t i0 = (uint32_t)0U; i0 < d - (uint32_t)1U; i0++)
+  {
+    mont_sqr(n, mu, accM, accM);
+    uint64_t x[1U] = { 0U };
+    for (uint32_t i = (uint32_t)0U; i < l; i++)
+    {
+      uint32_t k = i * d + d - i0 - (uint32_t)2U;
+      uint64_t ite;
+      if (k < bBits)
+      {
+        uint32_t i1 = k / (uint32_t)64U;
+        uint32_t j = k % (uint32_t)64U;
+        uint64_t tmp = b[i1];
+        ite = tmp >> j & (uint64_t)1U;
+      }
+      else
+      {
+        ite = (uint64_t)0U;
+      }
+      uint64_t bit = ite;
+      x[0U] = x[0U] | bit << i;
+    }
+    uint64_t bits_l = x[0U];
+    uint32_t bits_l32 = (uint32_t)bits_l;
+    uint64_t *a_bits_l = table + bits_l32 * (uint32_t)64U;
+    mont_mul(n, mu, accM, a_bits_l, accM);
+  }
+  from(n, mu, accM, res);
+}
+
+static inline void
+mod_exp_fb_ct(
+  uint64_t *n,
+  uint64_t mu,
+  uint32_t tBits,
+  uint32_t l,
+  uint64_t *table,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  uint32_t d = (tBits - (uint32_t)1U) / l + (uint32_t)1U;
+  uint64_t accM[64U] = { 0U };
+  uint64_t x0[1U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < l; i++)
+  {
+    uint32_t k = i * d + d - (uint32_t)1U;
+    uint64_t ite;
+    if (k < bBits)
+    {
+      uint32_t i1 = k / (uint32_t)64U;
+      uint32_t j = k % (uint32_t)64U;
+      uint64_t tmp = b[i1];
+      ite = tmp >> j & (uint64_t)1U;
+    }
+    else
+    {
+      ite = (uint64_t)0U;
+    }
+    uint64_t bit = ite;
+    x0[0U] = x0[0U] | bit << i;
+  }
+  uint64_t bits_l0 = x0[0U];
+  memcpy(accM, table, (uint32_t)64U * sizeof (uint64_t));
+  for (uint32_t i1 = (uint32_t)0U; i1 < ((uint32_t)1U << l) - (uint32_t)1U; i1++)
+  {
+    uint64_t c = FStar_UInt64_eq_mask(bits_l0, (uint64_t)(i1 + (uint32_t)1U));
+    uint64_t *res_j = table + (i1 + (uint32_t)1U) * (uint32_t)64U;
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+    {
+      uint64_t *os = accM;
+      uint64_t x = (c & res_j[i]) | (~c & accM[i]);
+      os[i] = x;
+    }
+  }
+  for (uint32_t i0 = (uint32_t)0U; i0 < d - (uint32_t)1U; i0++)
+  {
+    mont_sqr(n, mu, accM, accM);
+    uint64_t x[1U] = { 0U };
+    for (uint32_t i = (uint32_t)0U; i < l; i++)
+    {
+      uint32_t k = i * d + d - i0 - (uint32_t)2U;
+      uint64_t ite;
+      if (k < bBits)
+      {
+        uint32_t i1 = k / (uint32_t)64U;
+        uint32_t j = k % (uint32_t)64U;
+        uint64_t tmp = b[i1];
+        ite = tmp >> j & (uint64_t)1U;
+      }
+      else
+      {
+        ite = (uint64_t)0U;
+      }
+      uint64_t bit = ite;
+      x[0U] = x[0U] | bit << i;
+    }
+    uint64_t bits_l = x[0U];
+    uint64_t a_bits_l[64U] = { 0U };
+    memcpy(a_bits_l, table, (uint32_t)64U * sizeof (uint64_t));
+    for (uint32_t i1 = (uint32_t)0U; i1 < ((uint32_t)1U << l) - (uint32_t)1U; i1++)
+    {
+      uint64_t c = FStar_UInt64_eq_mask(bits_l, (uint64_t)(i1 + (uint32_t)1U));
+      uint64_t *res_j = table + (i1 + (uint32_t)1U) * (uint32_t)64U;
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+      {
+        uint64_t *os = a_bits_l;
+        uint64_t x1 = (c & res_j[i]) | (~c & a_bits_l[i]);
+        os[i] = x1;
+      }
+    }
+    mont_mul(n, mu, accM, a_bits_l, accM);
+  }
+  from(n, mu, accM, res);
+}
+
+
+/******************************************************/
+/* Fixed-base exponentiation with a precomputed table */
+/******************************************************/
+
+
+/*
+Heap-allocate and initialize the table of a base a for fixed-base exponentiation.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+  The argument a is meant to be a 4096-bit bignum, i.e. uint64_t[64].
+  The argument tBits is an upper bound on the number of bits of the exponents
+  that the table will be used with, e.g. 256 for exponents modulo a 256-bit
+  group order, or 4096 for exponents of the size of the modulus.
+
+  The table is a comb of 8 teeth: it holds 256 precomputed powers of a, i.e.
+  128 KiB, and an exponentiation against it takes about tBits / 8 squarings and
+  tBits / 8 multiplications, against about tBits squarings and tBits / 4
+  multiplications for mod_exp_ct_ctx. It pays off from a few exponentiations of
+  the same base on, e.g. for a generator or for a long-term public key.
+
+  The function returns NULL if:
+  • the allocation failed, or
+  • 0 < tBits && tBits <= 4096 does not hold, or
+  • a < n does not hold
+
+  If the return value is non-null, clients must eventually call
+  Hacl_Bignum4096_mod_exp_fb_table_free on it to avoid memory leaks.
+*/
+Hacl_Bignum_ExpFixedBase_bn_fb_table_u64
+*Hacl_Bignum4096_mod_exp_fb_table_init(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint32_t tBits
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  uint64_t *n = k1.n;
+  uint64_t *r2 = k1.r2;
+  uint64_t acc = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+  {
+    uint64_t beq = FStar_UInt64_eq_mask(a[i], n[i]);
+    uint64_t blt = ~FStar_UInt64_gte_mask(a[i], n[i]);
+    acc = (beq & acc) | (~beq & ((blt & (uint64_t)0xFFFFFFFFFFFFFFFFU) | (~blt & (uint64_t)0U)));
+  }
+  uint64_t is_valid_a = acc;
+  if
+  (
+    !
+    (
+      (uint32_t)0U
+      < tBits
+      && tBits <= (uint32_t)4096U
+      && (uint32_t)64U <= (uint32_t)0xffffffffU >> (uint32_t)8U
+    )
+    || !(is_valid_a == (uint64_t)0xFFFFFFFFFFFFFFFFU)
+  )
+  {
+    return NULL;
+  }
+  uint32_t table_len = ((uint32_t)1U << (uint32_t)8U) * (uint32_t)64U;
+  KRML_CHECK_SIZE(sizeof (uint64_t), table_len);
+  uint64_t *table = KRML_HOST_CALLOC(table_len, sizeof (uint64_t));
+  if (table == NULL)
+  {
+    return NULL;
+  }
+  uint64_t *table1 = table;
+  fb_precomp_table(n, k1.mu, r2, a, tBits, (uint32_t)8U, table1);
+  Hacl_Bignum_ExpFixedBase_bn_fb_table_u64
+  res = { .len = (uint32_t)64U, .tBits = tBits, .l = (uint32_t)8U, .table = table1 };
+  Hacl_Bignum_ExpFixedBase_bn_fb_table_u64
+  *buf = KRML_HOST_MALLOC(sizeof (Hacl_Bignum_ExpFixedBase_bn_fb_table_u64));
+  if (buf == NULL)
+  {
+    KRML_HOST_FREE(table1);
+    return NULL;
+  }
+  buf[0U] = res;
+  return buf;
+}
+
+/*
+Deallocate the memory previously allocated by Hacl_Bignum4096_mod_exp_fb_table_init.
+
+  The argument tb is a table obtained through Hacl_Bignum4096_mod_exp_fb_table_init.
+*/
+void Hacl_Bignum4096_mod_exp_fb_table_free(Hacl_Bignum_ExpFixedBase_bn_fb_table_u64 *tb)
+{
+  Hacl_Bignum_ExpFixedBase_bn_fb_table_u64 t1 = *tb;
+  uint64_t *table = t1.table;
+  KRML_HOST_FREE(table);
+  KRML_HOST_FREE(tb);
+}
+
+/*
+Write `a ^ b mod n` in `res`, where a is the base of the table tb.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+  The argument tb is a table obtained through Hacl_Bignum4096_mod_exp_fb_table_init
+  for the same context k.
+  The outparam res is meant to be a 4096-bit bignum, i.e. uint64_t[64].
+  The argument b is a bignum of any size, and bBits is an upper bound on the
+  number of significant bits of b.
+
+  The function is *NOT* constant-time on the argument b. See the
+  mod_exp_fb_ct_ctx function for a constant-time variant.
+
+  This function is *UNSAFE* and requires C clients to observe that:
+  • 0 < b
+  • b < pow2 bBits
+  • bBits <= tBits, where tBits is the bound given to the table
+*/
+void
+Hacl_Bignum4096_mod_exp_fb_raw_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  Hacl_Bignum_ExpFixedBase_bn_fb_table_u64 *tb,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  Hacl_Bignum_ExpFixedBase_bn_fb_table_u64 t1 = *tb;
+  mod_exp_fb_raw(k1.n, k1.mu, t1.tBits, t1.l, t1.table, bBits, b, res);
+}
+
+/*
+Write `a ^ b mod n` in `res`, where a is the base of the table tb.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+  The argument tb is a table obtained through Hacl_Bignum4096_mod_exp_fb_table_init
+  for the same context k.
+  The outparam res is meant to be a 4096-bit bignum, i.e. uint64_t[64].
+  The argument b is a bignum of any size, and bBits is an upper bound on the
+  number of significant bits of b.
+
+  This function is constant-time over its argument b: every table lookup reads
+  the whole table.
+
+  This function is *UNSAFE* and requires C clients to observe that:
+  • 0 < b
+  • b < pow2 bBits
+  • bBits <= tBits, where tBits is the bound given to the table
+*/
+void
+Hacl_Bignum4096_mod_exp_fb_ct_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  Hacl_Bignum_ExpFixedBase_bn_fb_table_u64 *tb,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  Hacl_Bignum_ExpFixedBase_bn_fb_table_u64 t1 = *tb;
+  mod_exp_fb_ct(k1.n, k1.mu, t1.tBits, t1.l, t1.table, bBits, b, res);
+}
+
 
 /********************/
 /* Loads and stores */
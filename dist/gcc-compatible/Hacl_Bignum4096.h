@@ -269,6 +269,313 @@ Write `a ^ (-1) mod n` in `res`.
 bool Hacl_Bignum4096_mod_inv_prime_raw(uint64_t *n, uint64_t *a, uint64_t *res);
 
 
+/**************************************************/
+/* Arithmetic functions with a Montgomery context */
+/**************************************************/
+
+
+/*
+Heap-allocate and initialize a montgomery context.
+
+  The argument n is meant to be a 4096-bit bignum, i.e. uint64_t[64].
+
+  The context holds a copy of n, the constant r2 = 2 ^ 8192 mod n and the
+  Montgomery constant mu = -n ^ (-1) mod 2 ^ 64, so that the *_ctx functions
+  below do not recompute them on every call.
+
+  The function returns NULL if:
+  • the allocation failed, or
+  • n % 2 = 1 && 1 < n does not hold
+
+  If the return value is non-null, clients must eventually call
+  Hacl_Bignum4096_mont_ctx_free on it to avoid memory leaks.
+*/
+Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *Hacl_Bignum4096_mont_ctx_init(uint64_t *n);
+
+/*
+Deallocate the memory previously allocated by Hacl_Bignum4096_mont_ctx_init.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+*/
+void Hacl_Bignum4096_mont_ctx_free(Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k);
+
+/*
+Write `a * 2 ^ 4096 mod n` in `aM`, i.e. convert `a` to the Montgomery domain.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+  The argument a and the outparam aM are meant to be 4096-bit bignums, i.e. uint64_t[64].
+
+  This function is *UNSAFE* and requires C clients to observe that a < n.
+*/
+void
+Hacl_Bignum4096_to_mont_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint64_t *aM
+);
+
+/*
+Write `aM * 2 ^ (-4096) mod n` in `a`, i.e. convert `aM` from the Montgomery domain.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+  The argument aM and the outparam a are meant to be 4096-bit bignums, i.e. uint64_t[64].
+
+  This function is *UNSAFE* and requires C clients to observe that aM < n.
+*/
+void
+Hacl_Bignum4096_from_mont_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *aM,
+  uint64_t *a
+);
+
+/*
+Write `aM * bM * 2 ^ (-4096) mod n` in `resM`.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+  The arguments aM, bM and the outparam resM are meant to be 4096-bit bignums, i.e. uint64_t[64].
+  The arguments aM and bM are meant to be in the Montgomery domain, see
+  Hacl_Bignum4096_to_mont_ctx, and so is the result. The outparam resM may alias aM or bM.
+
+  This function is *UNSAFE* and requires C clients to observe that aM < n and bM < n.
+*/
+void
+Hacl_Bignum4096_mont_mul_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *aM,
+  uint64_t *bM,
+  uint64_t *resM
+);
+
+/*
+Write `aM * aM * 2 ^ (-4096) mod n` in `resM`.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+  The argument aM and the outparam resM are meant to be 4096-bit bignums, i.e. uint64_t[64].
+  The argument aM is meant to be in the Montgomery domain, see
+  Hacl_Bignum4096_to_mont_ctx, and so is the result. The outparam resM may alias aM.
+
+  This function is *UNSAFE* and requires C clients to observe that aM < n.
+*/
+void
+Hacl_Bignum4096_mont_sqr_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *aM,
+  uint64_t *resM
+);
+
+/*
+Write `a * b mod n` in `res`.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+  The arguments a, b and the outparam res are meant to be 4096-bit bignums, i.e. uint64_t[64].
+
+  This function is *UNSAFE* and requires C clients to observe that a < n and b < n.
+*/
+void
+Hacl_Bignum4096_mod_mul_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint64_t *b,
+  uint64_t *res
+);
+
+/*
+Write `a ^ b mod n` in `res`.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+  The argument a and the outparam res are meant to be 4096-bit bignums, i.e. uint64_t[64].
+  The argument b is a bignum of any size, and bBits is an upper bound on the
+  number of significant bits of b. A tighter bound results in faster execution
+  time. When in doubt, the number of bits for the bignum size is always a safe
+  default, e.g. if b is a 4096-bit bignum, bBits should be 4096.
+
+  The function is *NOT* constant-time on the argument b. See the
+  mod_exp_ct_* functions for constant-time variants.
+
+  This function is *UNSAFE* and requires C clients to observe bn_mod_exp_pre
+  from Hacl.Spec.Bignum.ExpBM.fsti, which amounts to:
+  • 0 < b
+  • b < pow2 bBits
+  • a < n
+
+  This function uses a fixed window of 4 bits and the constants of the context,
+  and is notably faster than mod_exp_raw_precompr2.
+*/
+void
+Hacl_Bignum4096_mod_exp_raw_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+);
+
+/*
+Write `a ^ b mod n` in `res`.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+  The argument a and the outparam res are meant to be 4096-bit bignums, i.e. uint64_t[64].
+  The argument b is a bignum of any size, and bBits is an upper bound on the
+  number of significant bits of b. A tighter bound results in faster execution
+  time. When in doubt, the number of bits for the bignum size is always a safe
+  default, e.g. if b is a 4096-bit bignum, bBits should be 4096.
+
+  This function is constant-time over its argument b, at the cost of a slower
+  execution time than mod_exp_raw_ctx.
+
+  This function is *UNSAFE* and requires C clients to observe bn_mod_exp_pre
+  from Hacl.Spec.Bignum.ExpBM.fsti, which amounts to:
+  • 0 < b
+  • b < pow2 bBits
+  • a < n
+
+  This function uses a fixed window of 4 bits and the constants of the context,
+  and is notably faster than mod_exp_ct_precompr2.
+*/
+void
+Hacl_Bignum4096_mod_exp_ct_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+);
+
+/*
+Write `a_0 ^ b_0 * a_1 ^ b_1 * ... * a_{nBases-1} ^ b_{nBases-1} mod n` in `res`.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+  The argument a points to nBases 4096-bit bignums stored one after another,
+  i.e. uint64_t[64 * nBases], and the outparam res is meant to be a 4096-bit
+  bignum, i.e. uint64_t[64].
+  The argument b points to nBases exponents stored one after another, each of
+  them on (bBits - 1) / 64 + 1 limbs, where bBits is an upper bound on the
+  number of significant bits of every exponent.
+
+  The squarings are shared by all the bases (Straus' method), so that e.g.
+  g ^ a * h ^ b * K ^ c takes about as many squarings as a single call to
+  mod_exp_raw_ctx. A window of 4 bits is used for every base, i.e. a table of
+  16 powers (8 KiB) per base on the stack, and at most 64 KiB in total.
+
+  The function is *NOT* constant-time on the argument b.
+
+  The function returns false, and leaves res unchanged, if
+  0 < nBases && nBases <= 8 does not hold; it returns true otherwise.
+
+  This function is *UNSAFE* and requires C clients to observe bn_mod_exp_multi_pre
+  from Hacl.Spec.Bignum.MultiExp.fsti, which amounts to:
+  • b_i < pow2 bBits for every i
+  • a_i < n for every i
+*/
+bool
+Hacl_Bignum4096_mod_exp_multi_raw_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint32_t nBases,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+);
+
+
+/******************************************************/
+/* Fixed-base exponentiation with a precomputed table */
+/******************************************************/
+
+
+/*
+Heap-allocate and initialize the table of a base a for fixed-base exponentiation.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+  The argument a is meant to be a 4096-bit bignum, i.e. uint64_t[64].
+  The argument tBits is an upper bound on the number of bits of the exponents
+  that the table will be used with, e.g. 256 for exponents modulo a 256-bit
+  group order, or 4096 for exponents of the size of the modulus.
+
+  The table is a comb of 8 teeth: it holds 256 precomputed powers of a, i.e.
+  128 KiB, and an exponentiation against it takes about tBits / 8 squarings and
+  tBits / 8 multiplications, against about tBits squarings and tBits / 4
+  multiplications for mod_exp_ct_ctx. It pays off from a few exponentiations of
+  the same base on, e.g. for a generator or for a long-term public key.
+
+  The function returns NULL if:
+  • the allocation failed, or
+  • 0 < tBits && tBits <= 4096 does not hold, or
+  • a < n does not hold
+
+  If the return value is non-null, clients must eventually call
+  Hacl_Bignum4096_mod_exp_fb_table_free on it to avoid memory leaks.
+*/
+Hacl_Bignum_ExpFixedBase_bn_fb_table_u64
+*Hacl_Bignum4096_mod_exp_fb_table_init(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint32_t tBits
+);
+
+/*
+Deallocate the memory previously allocated by Hacl_Bignum4096_mod_exp_fb_table_init.
+
+  The argument tb is a table obtained through Hacl_Bignum4096_mod_exp_fb_table_init.
+*/
+void Hacl_Bignum4096_mod_exp_fb_table_free(Hacl_Bignum_ExpFixedBase_bn_fb_table_u64 *tb);
+
+/*
+Write `a ^ b mod n` in `res`, where a is the base of the table tb.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+  The argument tb is a table obtained through Hacl_Bignum4096_mod_exp_fb_table_init
+  for the same context k.
+  The outparam res is meant to be a 4096-bit bignum, i.e. uint64_t[64].
+  The argument b is a bignum of any size, and bBits is an upper bound on the
+  number of significant bits of b.
+
+  The function is *NOT* constant-time on the argument b. See the
+  mod_exp_fb_ct_ctx function for a constant-time variant.
+
+  This function is *UNSAFE* and requires C clients to observe that:
+  • 0 < b
+  • b < pow2 bBits
+  • bBits <= tBits, where tBits is the bound given to the table
+*/
+void
+Hacl_Bignum4096_mod_exp_fb_raw_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  Hacl_Bignum_ExpFixedBase_bn_fb_table_u64 *tb,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+);
+
+/*
+Write `a ^ b mod n` in `res`, where a is the base of the table tb.
+
+  The argument k is a montgomery context obtained through Hacl_Bignum4096_mont_ctx_init.
+  The argument tb is a table obtained through Hacl_Bignum4096_mod_exp_fb_table_init
+  for the same context k.
+  The outparam res is meant to be a 4096-bit bignum, i.e. uint64_t[64].
+  The argument b is a bignum of any size, and bBits is an upper bound on the
+  number of significant bits of b.
+
+  This function is constant-time over its argument b: every table lookup reads
+  the whole table.
+
+  This function is *UNSAFE* and requires C clients to observe that:
+  • 0 < b
+  • b < pow2 bBits
+  • bBits <= tBits, where tBits is the bound given to the table
+*/
+void
+Hacl_Bignum4096_mod_exp_fb_ct_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  Hacl_Bignum_ExpFixedBase_bn_fb_table_u64 *tb,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+);
+
+
 /********************/
 /* Loads and stores */
 /********************/
@@ -0,0 +1,473 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Bignum4096_ADX.h"
+
+static inline void mul(uint64_t *a, uint64_t *b, uint64_t *res)
+{
+  uint32_t resLen = (uint32_t)128U;
+  memset(res, 0U, resLen * sizeof (uint64_t));
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)64U; i0++)
+  {
+    uint64_t uu____0 = b[i0];
+    uint64_t *res_ = res + i0;
+    uint64_t r = bn_mul1_add_adx((uint32_t)64U, a, uu____0, res_);
+    res[(uint32_t)64U + i0] = r;
+  }
+}
+
+static inline void sqr(uint64_t *a, uint64_t *res)
+{
+  uint32_t resLen = (uint32_t)128U;
+  memset(res, 0U, resLen * sizeof (uint64_t));
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)64U; i0++)
+  {
+    uint64_t uu____0 = a[i0];
+    uint64_t *res_ = res + i0;
+    uint64_t r = bn_mul1_add_adx((uint32_t)64U, a, uu____0, res_);
+    res[(uint32_t)64U + i0] = r;
+  }
+}
+
+static inline void reduction(uint64_t *n, uint64_t nInv, uint64_t *c, uint64_t *res)
+{
+  uint64_t c0 = (uint64_t)0U;
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)64U; i0++)
+  {
+    uint64_t qj = nInv * c[i0];
+    uint64_t *res_ = c + i0;
+    uint64_t r = bn_mul1_add_adx((uint32_t)64U, n, qj, res_);
+    uint64_t c10 = r;
+    c0 =
+      Lib_IntTypes_Intrinsics_add_carry_u64(c0,
+        c10,
+        c[(uint32_t)64U + i0],
+        c + (uint32_t)64U + i0);
+  }
+  memcpy(res, c + (uint32_t)64U, (uint32_t)64U * sizeof (uint64_t));
+  uint64_t uu____0 = c0;
+  uint64_t tmp[64U] = { 0U };
+  uint64_t c1 = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    uint64_t t1 = res[(uint32_t)4U * i];
+    uint64_t t20 = n[(uint32_t)4U * i];
+    c1 = Lib_IntTypes_Intrinsics_sub_borrow_u64(c1, t1, t20, tmp + (uint32_t)4U * i);
+    uint64_t t10 = res[(uint32_t)4U * i + (uint32_t)1U];
+    uint64_t t21 = n[(uint32_t)4U * i + (uint32_t)1U];
+    c1 =
+      Lib_IntTypes_Intrinsics_sub_borrow_u64(c1,
+        t10,
+        t21,
+        tmp + (uint32_t)4U * i + (uint32_t)1U);
+    uint64_t t11 = res[(uint32_t)4U * i + (uint32_t)2U];
+    uint64_t t22 = n[(uint32_t)4U * i + (uint32_t)2U];
+    c1 =
+      Lib_IntTypes_Intrinsics_sub_borrow_u64(c1,
+        t11,
+        t22,
+        tmp + (uint32_t)4U * i + (uint32_t)2U);
+    uint64_t t12 = res[(uint32_t)4U * i + (uint32_t)3U];
+    uint64_t t2 = n[(uint32_t)4U * i + (uint32_t)3U];
+    c1 = Lib_IntTypes_Intrinsics_sub_borrow_u64(c1, t12, t2, tmp + (uint32_t)4U * i + (uint32_t)3U);
+  }
+  for (uint32_t i = (uint32_t)64U; i < (uint32_t)64U; i++)
+  {
+    uint64_t t1 = res[i];
+    uint64_t t2 = n[i];
+    c1 = Lib_IntTypes_Intrinsics_sub_borrow_u64(c1, t1, t2, tmp + i);
+  }
+  uint64_t c10 = c1;
+  uint64_t c2 = uu____0 - c10;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+  {
+    uint64_t *os = res;
+    uint64_t x = (c2 & res[i]) | (~c2 & tmp[i]);
+    os[i] = x;
+  }
+}
+
+static inline void to(uint64_t *n, uint64_t nInv, uint64_t *r2, uint64_t *a, uint64_t *aM)
+{
+  uint64_t c[128U] = { 0U };
+  mul(a, r2, c);
+  reduction(n, nInv, c, aM);
+}
+
+static inline void from(uint64_t *n, uint64_t nInv_u64, uint64_t *aM, uint64_t *a)
+{
+  uint64_t tmp[128U] = { 0U };
+  memcpy(tmp, aM, (uint32_t)64U * sizeof (uint64_t));
+  reduction(n, nInv_u64, tmp, a);
+}
+
+static inline void
+mont_mul(uint64_t *n, uint64_t nInv_u64, uint64_t *aM, uint64_t *bM, uint64_t *resM)
+{
+  uint64_t c[128U] = { 0U };
+  mul(aM, bM, c);
+  reduction(n, nInv_u64, c, resM);
+}
+
+static inline void mont_sqr(uint64_t *n, uint64_t nInv_u64, uint64_t *aM, uint64_t *resM)
+{
+  uint64_t c[128U] = { 0U };
+  sqr(aM, c);
+  reduction(n, nInv_u64, c, resM);
+}
+
+static inline void
+mod_exp_fw_raw_precomp(
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint32_t l,
+  uint64_t *res
+)
+{
+  uint64_t aM[64U] = { 0U };
+  to(n, mu, r2, a, aM);
+  uint64_t resM[64U] = { 0U };
+  uint32_t bLen = (bBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint64_t one[64U] = { 0U };
+  memset(one, 0U, (uint32_t)64U * sizeof (uint64_t));
+  one[0U] = (uint64_t)1U;
+  to(n, mu, r2, one, resM);
+  uint32_t table_len = (uint32_t)1U << l;
+  KRML_CHECK_SIZE(sizeof (uint64_t), table_len * (uint32_t)64U);
+  uint64_t table[table_len * (uint32_t)64U];
+  memset(table, 0U, table_len * (uint32_t)64U * sizeof (uint64_t));
+  memcpy(table, resM, (uint32_t)64U * sizeof (uint64_t));
+  memcpy(table + (uint32_t)64U, aM, (uint32_t)64U * sizeof (uint64_t));
+  for (uint32_t i = (uint32_t)0U; i < table_len - (uint32_t)2U; i++)
+  {
+    uint64_t *t1 = table + (i + (uint32_t)1U) * (uint32_t)64U;
+    uint64_t *t2 = table + (i + (uint32_t)2U) * (uint32_t)64U;
+    mont_mul(n, mu, t1, aM, t2);
+  }
+  uint32_t it = bBits / l;
+  for (uint32_t i0 = (uint32_t)0U; i0 < it; i0++)
+  {
+    uint64_t mask_l = ((uint64_t)1U << l) - (uint64_t)1U;
+    uint32_t i1 = (bBits - l * i0 - l) / (uint32_t)64U;
+    uint32_t j = (bBits - l * i0 - l) % (uint32_t)64U;
+    uint64_t p1 = b[i1] >> j;
+    uint64_t ite;
+    if (i1 + (uint32_t)1U < bLen && (uint32_t)0U < j)
+    {
+      ite = p1 | b[i1 + (uint32_t)1U] << ((uint32_t)64U - j);
+    }
+    else
+    {
+      ite = p1;
+    }
+    uint64_t bits_l = ite & mask_l;
+    uint32_t bits_l32 = (uint32_t)bits_l;
+    uint64_t *a_powbits_l = table + bits_l32 * (uint32_t)64U;
+    for (uint32_t i = (uint32_t)0U; i < l; i++)
+    {
+      mont_sqr(n, mu, resM, resM);
+    }
+    mont_mul(n, mu, resM, a_powbits_l, resM);
+  }
+  if (!(bBits % l == (uint32_t)0U))
+  {
+    uint32_t c = bBits % l;
+    for (uint32_t i = (uint32_t)0U; i < c; i++)
+    {
+      mont_sqr(n, mu, resM, resM);
+    }
+    uint32_t c10 = bBits % l;
+    uint64_t mask_l = ((uint64_t)1U << c10) - (uint64_t)1U;
+    uint32_t i0 = (uint32_t)0U;
+    uint32_t j = (uint32_t)0U;
+    uint64_t p1 = b[i0] >> j;
+    uint64_t ite;
+    if (i0 + (uint32_t)1U < bLen && (uint32_t)0U < j)
+    {
+      ite = p1 | b[i0 + (uint32_t)1U] << ((uint32_t)64U - j);
+    }
+    else
+    {
+      ite = p1;
+    }
+    uint64_t bits_c = ite & mask_l;
+    uint64_t bits_c0 = bits_c;
+    uint32_t bits_c32 = (uint32_t)bits_c0;
+    uint64_t *a_powbits_l = table + bits_c32 * (uint32_t)64U;
+    mont_mul(n, mu, resM, a_powbits_l, resM);
+  }
+  from(n, mu, resM, res);
+}
+
+static inline void
+mod_exp_fw_ct_precomp(
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint32_t l,
+  uint64_t *res
+)
+{
+  uint64_t aM[64U] = { 0U };
+  to(n, mu, r2, a, aM);
+  uint64_t resM[64U] = { 0U };
+  uint32_t bLen = (bBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint64_t one[64U] = { 0U };
+  memset(one, 0U, (uint32_t)64U * sizeof (uint64_t));
+  one[0U] = (uint64_t)1U;
+  to(n, mu, r2, one, resM);
+  uint32_t table_len = (uint32_t)1U << l;
+  KRML_CHECK_SIZE(sizeof (uint64_t), table_len * (uint32_t)64U);
+  uint64_t table[table_len * (uint32_t)64U];
+  memset(table, 0U, table_len * (uint32_t)64U * sizeof (uint64_t));
+  memcpy(table, resM, (uint32_t)64U * sizeof (uint64_t));
+  memcpy(table + (uint32_t)64U, aM, (uint32_t)64U * sizeof (uint64_t));
+  for (uint32_t i = (uint32_t)0U; i < table_len - (uint32_t)2U; i++)
+  {
+    uint64_t *t1 = table + (i + (uint32_t)1U) * (uint32_t)64U;
+    uint64_t *t2 = table + (i + (uint32_t)2U) * (uint32_t)64U;
+    mont_mul(n, mu, t1, aM, t2);
+  }
+  uint32_t it = bBits / l;
+  for (uint32_t i0 = (uint32_t)0U; i0 < it; i0++)
+  {
+    uint64_t mask_l = ((uint64_t)1U << l) - (uint64_t)1U;
+    uint32_t i1 = (bBits - l * i0 - l) / (uint32_t)64U;
+    uint32_t j = (bBits - l * i0 - l) % (uint32_t)64U;
+    uint64_t p1 = b[i1] >> j;
+    uint64_t ite;
+    if (i1 + (uint32_t)1U < bLen && (uint32_t)0U < j)
+    {
+      ite = p1 | b[i1 + (uint32_t)1U] << ((uint32_t)64U - j);
+    }
+    else
+    {
+      ite = p1;
+    }
+    uint64_t bits_l = ite & mask_l;
+    uint64_t a_powbits_l[64U] = { 0U };
+    memcpy(a_powbits_l, table, (uint32_t)64U * sizeof (uint64_t));
+    for (uint32_t i2 = (uint32_t)0U; i2 < table_len - (uint32_t)1U; i2++)
+    {
+      uint64_t c = FStar_UInt64_eq_mask(bits_l, (uint64_t)(i2 + (uint32_t)1U));
+      uint64_t *res_j = table + (i2 + (uint32_t)1U) * (uint32_t)64U;
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+      {
+        uint64_t *os = a_powbits_l;
+        uint64_t x = (c & res_j[i]) | (~c & a_powbits_l[i]);
+        os[i] = x;
+      }
+    }
+    for (uint32_t i = (uint32_t)0U; i < l; i++)
+    {
+      mont_sqr(n, mu, resM, resM);
+    }
+    mont_mul(n, mu, resM, a_powbits_l, resM);
+  }
+  if (!(bBits % l == (uint32_t)0U))
+  {
+    uint32_t c = bBits % l;
+    for (uint32_t i = (uint32_t)0U; i < c; i++)
+    {
+      mont_sqr(n, mu, resM, resM);
+    }
+    uint32_t c10 = bBits % l;
+    uint64_t mask_l = ((uint64_t)1U << c10) - (uint64_t)1U;
+    uint32_t i0 = (uint32_t)0U;
+    uint32_t j = (uint32_t)0U;
+    uint64_t p1 = b[i0] >> j;
+    uint64_t ite;
+    if (i0 + (uint32_t)1U < bLen && (uint32_t)0U < j)
+    {
+      ite = p1 | b[i0 + (uint32_t)1U] << ((uint32_t)64U - j);
+    }
+    else
+    {
+      ite = p1;
+    }
+    uint64_t bits_c = ite & mask_l;
+    uint64_t bits_c0 = bits_c;
+    uint64_t a_powbits_c[64U] = { 0U };
+    memcpy(a_powbits_c, table, (uint32_t)64U * sizeof (uint64_t));
+    for (uint32_t i2 = (uint32_t)0U; i2 < table_len - (uint32_t)1U; i2++)
+    {
+      uint64_t c = FStar_UInt64_eq_mask(bits_c0, (uint64_t)(i2 + (uint32_t)1U));
+      uint64_t *res_j = table + (i2 + (uint32_t)1U) * (uint32_t)64U;
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+      {
+        uint64_t *os = a_powbits_c;
+        uint64_t x = (c & res_j[i]) | (~c & a_powbits_c[i]);
+        os[i] = x;
+      }
+    }
+    mont_mul(n, mu, resM, a_powbits_c, resM);
+  }
+  from(n, mu, resM, res);
+}
+
+/*******************************************************************************
+
+The arithmetic functions with a Montgomery context of Hacl_Bignum4096, where the
+rows of the multiplication and of the Montgomery reduction use MULX, ADCX and
+ADOX.
+
+All the functions below require BMI2 and ADX. They take a context obtained
+through Hacl_Bignum4096_mont_ctx_init and compute the same result as the
+function of the same name in Hacl_Bignum4096. EverCrypt_Bignum4096 picks between
+the two at run-time.
+
+*******************************************************************************/
+
+/*
+Write `a * 2 ^ 4096 mod n` in `aM`, i.e. convert `a` to the Montgomery domain.
+
+  This function is *UNSAFE* and requires C clients to observe that a < n.
+*/
+void
+Hacl_Bignum4096_ADX_to_mont_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint64_t *aM
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  to(k1.n, k1.mu, k1.r2, a, aM);
+}
+
+/*
+Write `aM * 2 ^ (-4096) mod n` in `a`, i.e. convert `aM` from the Montgomery domain.
+
+  This function is *UNSAFE* and requires C clients to observe that aM < n.
+*/
+void
+Hacl_Bignum4096_ADX_from_mont_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *aM,
+  uint64_t *a
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  from(k1.n, k1.mu, aM, a);
+}
+
+/*
+Write `aM * bM * 2 ^ (-4096) mod n` in `resM`.
+
+  This function is *UNSAFE* and requires C clients to observe that aM < n and bM < n.
+*/
+void
+Hacl_Bignum4096_ADX_mont_mul_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *aM,
+  uint64_t *bM,
+  uint64_t *resM
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  mont_mul(k1.n, k1.mu, aM, bM, resM);
+}
+
+/*
+Write `aM * aM * 2 ^ (-4096) mod n` in `resM`.
+
+  This function is *UNSAFE* and requires C clients to observe that aM < n.
+*/
+void
+Hacl_Bignum4096_ADX_mont_sqr_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *aM,
+  uint64_t *resM
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  mont_sqr(k1.n, k1.mu, aM, resM);
+}
+
+/*
+Write `a * b mod n` in `res`.
+
+  This function is *UNSAFE* and requires C clients to observe that a < n and b < n.
+*/
+void
+Hacl_Bignum4096_ADX_mod_mul_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  uint64_t tmp[64U] = { 0U };
+  mont_mul(k1.n, k1.mu, a, b, tmp);
+  mont_mul(k1.n, k1.mu, tmp, k1.r2, res);
+}
+
+/*
+Write `a ^ b mod n` in `res`.
+
+  The function is *NOT* constant-time on the argument b.
+
+  This function is *UNSAFE* and requires C clients to observe bn_mod_exp_pre
+  from Hacl.Spec.Bignum.ExpBM.fsti.
+*/
+void
+Hacl_Bignum4096_ADX_mod_exp_raw_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  mod_exp_fw_raw_precomp(k1.n, k1.mu, k1.r2, a, bBits, b, (uint32_t)4U, res);
+}
+
+/*
+Write `a ^ b mod n` in `res`.
+
+  This function is constant-time over its argument b.
+
+  This function is *UNSAFE* and requires C clients to observe bn_mod_exp_pre
+  from Hacl.Spec.Bignum.ExpBM.fsti.
+*/
+void
+Hacl_Bignum4096_ADX_mod_exp_ct_ctx(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  mod_exp_fw_ct_precomp(k1.n, k1.mu, k1.r2, a, bBits, b, (uint32_t)4U, res);
+}
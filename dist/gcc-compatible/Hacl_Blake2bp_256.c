@@ -0,0 +1,435 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Blake2bp_256.h"
+
+static inline void
+blake2bp_mix(
+  Lib_IntVector_Intrinsics_vec256 *wv,
+  uint32_t a,
+  uint32_t b,
+  uint32_t c,
+  uint32_t d,
+  Lib_IntVector_Intrinsics_vec256 x,
+  Lib_IntVector_Intrinsics_vec256 y
+)
+{
+  wv[a] =
+    Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(wv[a], wv[b]),
+      x);
+  wv[d] =
+    Lib_IntVector_Intrinsics_vec256_rotate_right64(Lib_IntVector_Intrinsics_vec256_xor(wv[d],
+        wv[a]),
+      (uint32_t)32U);
+  wv[c] = Lib_IntVector_Intrinsics_vec256_add64(wv[c], wv[d]);
+  wv[b] =
+    Lib_IntVector_Intrinsics_vec256_rotate_right64(Lib_IntVector_Intrinsics_vec256_xor(wv[b],
+        wv[c]),
+      (uint32_t)24U);
+  wv[a] =
+    Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(wv[a], wv[b]),
+      y);
+  wv[d] =
+    Lib_IntVector_Intrinsics_vec256_rotate_right64(Lib_IntVector_Intrinsics_vec256_xor(wv[d],
+        wv[a]),
+      (uint32_t)16U);
+  wv[c] = Lib_IntVector_Intrinsics_vec256_add64(wv[c], wv[d]);
+  wv[b] =
+    Lib_IntVector_Intrinsics_vec256_rotate_right64(Lib_IntVector_Intrinsics_vec256_xor(wv[b],
+        wv[c]),
+      (uint32_t)63U);
+}
+
+static inline void
+blake2bp_compress(
+  Lib_IntVector_Intrinsics_vec256 *hash,
+  Lib_IntVector_Intrinsics_vec256 *m,
+  Lib_IntVector_Intrinsics_vec256 t0,
+  Lib_IntVector_Intrinsics_vec256 t1,
+  Lib_IntVector_Intrinsics_vec256 f0,
+  Lib_IntVector_Intrinsics_vec256 f1
+)
+{
+  Lib_IntVector_Intrinsics_vec256 wv[16U];
+  for (uint32_t _i = 0U; _i < (uint32_t)16U; ++_i)
+    wv[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  memcpy(wv, hash, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    wv[(uint32_t)8U + i] =
+      Lib_IntVector_Intrinsics_vec256_load64(Hacl_Impl_Blake2_Constants_ivTable_B[i]);
+  }
+  wv[12U] = Lib_IntVector_Intrinsics_vec256_xor(wv[12U], t0);
+  wv[13U] = Lib_IntVector_Intrinsics_vec256_xor(wv[13U], t1);
+  wv[14U] = Lib_IntVector_Intrinsics_vec256_xor(wv[14U], f0);
+  wv[15U] = Lib_IntVector_Intrinsics_vec256_xor(wv[15U], f1);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)12U; i++)
+  {
+    uint32_t start_idx = i % (uint32_t)10U * (uint32_t)16U;
+    uint32_t s0 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx];
+    uint32_t s1 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)1U];
+    uint32_t s2 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)2U];
+    uint32_t s3 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)3U];
+    uint32_t s4 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)4U];
+    uint32_t s5 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)5U];
+    uint32_t s6 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)6U];
+    uint32_t s7 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)7U];
+    uint32_t s8 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)8U];
+    uint32_t s9 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)9U];
+    uint32_t s10 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)10U];
+    uint32_t s11 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)11U];
+    uint32_t s12 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)12U];
+    uint32_t s13 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)13U];
+    uint32_t s14 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)14U];
+    uint32_t s15 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)15U];
+    blake2bp_mix(wv, (uint32_t)0U, (uint32_t)4U, (uint32_t)8U, (uint32_t)12U, m[s0], m[s1]);
+    blake2bp_mix(wv, (uint32_t)1U, (uint32_t)5U, (uint32_t)9U, (uint32_t)13U, m[s2], m[s3]);
+    blake2bp_mix(wv, (uint32_t)2U, (uint32_t)6U, (uint32_t)10U, (uint32_t)14U, m[s4], m[s5]);
+    blake2bp_mix(wv, (uint32_t)3U, (uint32_t)7U, (uint32_t)11U, (uint32_t)15U, m[s6], m[s7]);
+    blake2bp_mix(wv, (uint32_t)0U, (uint32_t)5U, (uint32_t)10U, (uint32_t)15U, m[s8], m[s9]);
+    blake2bp_mix(wv, (uint32_t)1U, (uint32_t)6U, (uint32_t)11U, (uint32_t)12U, m[s10], m[s11]);
+    blake2bp_mix(wv, (uint32_t)2U, (uint32_t)7U, (uint32_t)8U, (uint32_t)13U, m[s12], m[s13]);
+    blake2bp_mix(wv, (uint32_t)3U, (uint32_t)4U, (uint32_t)9U, (uint32_t)14U, m[s14], m[s15]);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    hash[i] =
+      Lib_IntVector_Intrinsics_vec256_xor(hash[i],
+        Lib_IntVector_Intrinsics_vec256_xor(wv[i], wv[(uint32_t)8U + i]));
+  }
+}
+
+static inline void blake2bp_load_stripe(Lib_IntVector_Intrinsics_vec256 *m, uint8_t *b)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    v0 = Lib_IntVector_Intrinsics_vec256_load_le(b + i * (uint32_t)32U);
+    Lib_IntVector_Intrinsics_vec256
+    v1 = Lib_IntVector_Intrinsics_vec256_load_le(b + (uint32_t)128U + i * (uint32_t)32U);
+    Lib_IntVector_Intrinsics_vec256
+    v2 = Lib_IntVector_Intrinsics_vec256_load_le(b + (uint32_t)256U + i * (uint32_t)32U);
+    Lib_IntVector_Intrinsics_vec256
+    v3 = Lib_IntVector_Intrinsics_vec256_load_le(b + (uint32_t)384U + i * (uint32_t)32U);
+    Lib_IntVector_Intrinsics_vec256 v0_ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0, v1);
+    Lib_IntVector_Intrinsics_vec256 v1_ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0, v1);
+    Lib_IntVector_Intrinsics_vec256 v2_ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v2, v3);
+    Lib_IntVector_Intrinsics_vec256 v3_ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v2, v3);
+    m[(uint32_t)4U * i + (uint32_t)0U] =
+      Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_, v2_);
+    m[(uint32_t)4U * i + (uint32_t)1U] =
+      Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_, v3_);
+    m[(uint32_t)4U * i + (uint32_t)2U] =
+      Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_, v2_);
+    m[(uint32_t)4U * i + (uint32_t)3U] =
+      Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_, v3_);
+  }
+}
+
+static inline void blake2bp_store_lanes(uint8_t *b, Lib_IntVector_Intrinsics_vec256 *hash)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)2U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 v0 = hash[(uint32_t)4U * i];
+    Lib_IntVector_Intrinsics_vec256 v1 = hash[(uint32_t)4U * i + (uint32_t)1U];
+    Lib_IntVector_Intrinsics_vec256 v2 = hash[(uint32_t)4U * i + (uint32_t)2U];
+    Lib_IntVector_Intrinsics_vec256 v3 = hash[(uint32_t)4U * i + (uint32_t)3U];
+    Lib_IntVector_Intrinsics_vec256 v0_ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0, v1);
+    Lib_IntVector_Intrinsics_vec256 v1_ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0, v1);
+    Lib_IntVector_Intrinsics_vec256 v2_ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v2, v3);
+    Lib_IntVector_Intrinsics_vec256 v3_ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v2, v3);
+    Lib_IntVector_Intrinsics_vec256_store_le(b + i * (uint32_t)32U,
+      Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_, v2_));
+    Lib_IntVector_Intrinsics_vec256_store_le(b + (uint32_t)64U + i * (uint32_t)32U,
+      Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_, v3_));
+    Lib_IntVector_Intrinsics_vec256_store_le(b + (uint32_t)128U + i * (uint32_t)32U,
+      Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_, v2_));
+    Lib_IntVector_Intrinsics_vec256_store_le(b + (uint32_t)192U + i * (uint32_t)32U,
+      Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_, v3_));
+  }
+}
+
+void
+Hacl_Blake2bp_256_blake2bp_init(Lib_IntVector_Intrinsics_vec256 *hash, uint32_t kk, uint32_t nn)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    hash[i] = Lib_IntVector_Intrinsics_vec256_load64(Hacl_Impl_Blake2_Constants_ivTable_B[i]);
+  }
+  uint64_t p0 = (uint64_t)0x02040000U ^ (uint64_t)kk << (uint32_t)8U ^ (uint64_t)nn;
+  hash[0U] =
+    Lib_IntVector_Intrinsics_vec256_xor(hash[0U],
+      Lib_IntVector_Intrinsics_vec256_load64(p0));
+  hash[1U] =
+    Lib_IntVector_Intrinsics_vec256_xor(hash[1U],
+      Lib_IntVector_Intrinsics_vec256_load64s((uint64_t)0U,
+        (uint64_t)1U,
+        (uint64_t)2U,
+        (uint64_t)3U));
+  hash[2U] =
+    Lib_IntVector_Intrinsics_vec256_xor(hash[2U],
+      Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x4000U));
+}
+
+void
+Hacl_Blake2bp_256_blake2bp_update_multi(
+  Lib_IntVector_Intrinsics_vec256 *hash,
+  uint64_t prev,
+  uint8_t *blocks,
+  uint32_t nb
+)
+{
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 m[16U];
+    for (uint32_t _i = 0U; _i < (uint32_t)16U; ++_i)
+      m[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+    blake2bp_load_stripe(m, blocks + i * (uint32_t)512U);
+    uint64_t totlen = prev + (uint64_t)(i + (uint32_t)1U) * (uint64_t)(uint32_t)128U;
+    blake2bp_compress(hash,
+      m,
+      Lib_IntVector_Intrinsics_vec256_load64(totlen),
+      Lib_IntVector_Intrinsics_vec256_zero,
+      Lib_IntVector_Intrinsics_vec256_zero,
+      Lib_IntVector_Intrinsics_vec256_zero);
+  }
+}
+
+void
+Hacl_Blake2bp_256_blake2bp_update_last(
+  Lib_IntVector_Intrinsics_vec256 *hash,
+  uint64_t prev,
+  uint32_t rem,
+  uint8_t *d
+)
+{
+  Lib_IntVector_Intrinsics_vec256 m[16U];
+  for (uint32_t _i = 0U; _i < (uint32_t)16U; ++_i)
+    m[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  if (rem > (uint32_t)512U)
+  {
+    Lib_IntVector_Intrinsics_vec256 tmp[8U];
+    for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+      tmp[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+    memcpy(tmp, hash, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+    blake2bp_load_stripe(m, d);
+    blake2bp_compress(tmp,
+      m,
+      Lib_IntVector_Intrinsics_vec256_load64(prev + (uint64_t)(uint32_t)128U),
+      Lib_IntVector_Intrinsics_vec256_zero,
+      Lib_IntVector_Intrinsics_vec256_zero,
+      Lib_IntVector_Intrinsics_vec256_zero);
+    uint64_t mask[4U] = { 0U };
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      uint64_t ite;
+      if (rem - (uint32_t)512U > i * (uint32_t)128U)
+      {
+        ite = (uint64_t)0xFFFFFFFFFFFFFFFFU;
+      }
+      else
+      {
+        ite = (uint64_t)0U;
+      }
+      mask[i] = ite;
+    }
+    Lib_IntVector_Intrinsics_vec256
+    mask_v = Lib_IntVector_Intrinsics_vec256_load64s(mask[0U], mask[1U], mask[2U], mask[3U]);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      hash[i] =
+        Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_and(tmp[i], mask_v),
+          Lib_IntVector_Intrinsics_vec256_and(hash[i],
+            Lib_IntVector_Intrinsics_vec256_lognot(mask_v)));
+    }
+  }
+  uint8_t last[512U] = { 0U };
+  uint64_t totlen[4U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint32_t start;
+    if (rem > (uint32_t)512U + i * (uint32_t)128U)
+    {
+      start = (uint32_t)512U + i * (uint32_t)128U;
+    }
+    else
+    {
+      start = i * (uint32_t)128U;
+    }
+    uint32_t len;
+    if (rem <= start)
+    {
+      len = (uint32_t)0U;
+    }
+    else if (rem - start >= (uint32_t)128U)
+    {
+      len = (uint32_t)128U;
+    }
+    else
+    {
+      len = rem - start;
+    }
+    memcpy(last + i * (uint32_t)128U, d + start, len * sizeof (uint8_t));
+    uint64_t ite;
+    if (start >= (uint32_t)512U)
+    {
+      ite = prev + (uint64_t)(uint32_t)128U + (uint64_t)len;
+    }
+    else
+    {
+      ite = prev + (uint64_t)len;
+    }
+    totlen[i] = ite;
+  }
+  blake2bp_load_stripe(m, last);
+  blake2bp_compress(hash,
+    m,
+    Lib_IntVector_Intrinsics_vec256_load64s(totlen[0U], totlen[1U], totlen[2U], totlen[3U]),
+    Lib_IntVector_Intrinsics_vec256_zero,
+    Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0xFFFFFFFFFFFFFFFFU),
+    Lib_IntVector_Intrinsics_vec256_load64s((uint64_t)0U,
+      (uint64_t)0U,
+      (uint64_t)0U,
+      (uint64_t)0xFFFFFFFFFFFFFFFFU));
+  Lib_Memzero0_memzero(last, (uint32_t)512U * sizeof (last[0U]));
+}
+
+void
+Hacl_Blake2bp_256_blake2bp_finish(
+  uint32_t nn,
+  uint8_t *output,
+  uint32_t kk,
+  Lib_IntVector_Intrinsics_vec256 *hash
+)
+{
+  uint8_t leaves[256U] = { 0U };
+  blake2bp_store_lanes(leaves, hash);
+  Lib_IntVector_Intrinsics_vec256 root[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    root[i] = Lib_IntVector_Intrinsics_vec256_load64(Hacl_Impl_Blake2_Constants_ivTable_B[i]);
+  }
+  uint64_t p0 = (uint64_t)0x02040000U ^ (uint64_t)kk << (uint32_t)8U ^ (uint64_t)nn;
+  root[0U] =
+    Lib_IntVector_Intrinsics_vec256_xor(root[0U],
+      Lib_IntVector_Intrinsics_vec256_load64(p0));
+  root[2U] =
+    Lib_IntVector_Intrinsics_vec256_xor(root[2U],
+      Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x4001U));
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)2U; i0++)
+  {
+    Lib_IntVector_Intrinsics_vec256 m[16U];
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      uint64_t u = load64_le(leaves + i0 * (uint32_t)128U + i * (uint32_t)8U);
+      m[i] = Lib_IntVector_Intrinsics_vec256_load64(u);
+    }
+    Lib_IntVector_Intrinsics_vec256 f;
+    if (i0 == (uint32_t)1U)
+    {
+      f = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0xFFFFFFFFFFFFFFFFU);
+    }
+    else
+    {
+      f = Lib_IntVector_Intrinsics_vec256_zero;
+    }
+    blake2bp_compress(root,
+      m,
+      Lib_IntVector_Intrinsics_vec256_load64((uint64_t)(i0 + (uint32_t)1U)
+        * (uint64_t)(uint32_t)128U),
+      Lib_IntVector_Intrinsics_vec256_zero,
+      f,
+      f);
+  }
+  uint8_t full[256U] = { 0U };
+  blake2bp_store_lanes(full, root);
+  memcpy(output, full, nn * sizeof (uint8_t));
+  Lib_Memzero0_memzero(leaves, (uint32_t)256U * sizeof (leaves[0U]));
+  Lib_Memzero0_memzero(full, (uint32_t)256U * sizeof (full[0U]));
+}
+
+static void
+blake2bp_update_blocks(
+  Lib_IntVector_Intrinsics_vec256 *hash,
+  uint64_t prev,
+  uint32_t ll,
+  uint8_t *d
+)
+{
+  uint32_t nb;
+  if (ll < (uint32_t)512U)
+  {
+    nb = (uint32_t)0U;
+  }
+  else
+  {
+    nb = ll / (uint32_t)512U - (uint32_t)1U;
+  }
+  Hacl_Blake2bp_256_blake2bp_update_multi(hash, prev, d, nb);
+  Hacl_Blake2bp_256_blake2bp_update_last(hash,
+    prev + (uint64_t)nb * (uint64_t)(uint32_t)128U,
+    ll - nb * (uint32_t)512U,
+    d + nb * (uint32_t)512U);
+}
+
+void
+Hacl_Blake2bp_256_blake2bp(
+  uint32_t nn,
+  uint8_t *output,
+  uint32_t ll,
+  uint8_t *d,
+  uint32_t kk,
+  uint8_t *k
+)
+{
+  Lib_IntVector_Intrinsics_vec256 hash[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    hash[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  Hacl_Blake2bp_256_blake2bp_init(hash, kk, nn);
+  if (kk == (uint32_t)0U)
+  {
+    blake2bp_update_blocks(hash, (uint64_t)0U, ll, d);
+  }
+  else
+  {
+    uint8_t key_stripe[1024U] = { 0U };
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      memcpy(key_stripe + i * (uint32_t)128U, k, kk * sizeof (uint8_t));
+    }
+    if (ll < (uint32_t)512U)
+    {
+      memcpy(key_stripe + (uint32_t)512U, d, ll * sizeof (uint8_t));
+      Hacl_Blake2bp_256_blake2bp_update_last(hash, (uint64_t)0U, (uint32_t)512U + ll, key_stripe);
+    }
+    else
+    {
+      Hacl_Blake2bp_256_blake2bp_update_multi(hash, (uint64_t)0U, key_stripe, (uint32_t)1U);
+      blake2bp_update_blocks(hash, (uint64_t)(uint32_t)128U, ll, d);
+    }
+    Lib_Memzero0_memzero(key_stripe, (uint32_t)1024U * sizeof (key_stripe[0U]));
+  }
+  Hacl_Blake2bp_256_blake2bp_finish(nn, output, kk, hash);
+}
+
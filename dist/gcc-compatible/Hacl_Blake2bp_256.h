@@ -0,0 +1,85 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_Blake2bp_256_H
+#define __Hacl_Blake2bp_256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Lib_Memzero0.h"
+#include "Hacl_Impl_Blake2_Constants.h"
+
+void
+Hacl_Blake2bp_256_blake2bp_init(Lib_IntVector_Intrinsics_vec256 *hash, uint32_t kk, uint32_t nn);
+
+void
+Hacl_Blake2bp_256_blake2bp_update_multi(
+  Lib_IntVector_Intrinsics_vec256 *hash,
+  uint64_t prev,
+  uint8_t *blocks,
+  uint32_t nb
+);
+
+void
+Hacl_Blake2bp_256_blake2bp_update_last(
+  Lib_IntVector_Intrinsics_vec256 *hash,
+  uint64_t prev,
+  uint32_t rem,
+  uint8_t *d
+);
+
+void
+Hacl_Blake2bp_256_blake2bp_finish(
+  uint32_t nn,
+  uint8_t *output,
+  uint32_t kk,
+  Lib_IntVector_Intrinsics_vec256 *hash
+);
+
+void
+Hacl_Blake2bp_256_blake2bp(
+  uint32_t nn,
+  uint8_t *output,
+  uint32_t ll,
+  uint8_t *d,
+  uint32_t kk,
+  uint8_t *k
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Blake2bp_256_H_DEFINED
+#endif
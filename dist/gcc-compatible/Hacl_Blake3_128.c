@@ -0,0 +1,688 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Blake3_128.h"
+
+static inline void
+blake3_g4(
+  Lib_IntVector_Intrinsics_vec128 *wv,
+  uint32_t a,
+  uint32_t b,
+  uint32_t c,
+  uint32_t d,
+  Lib_IntVector_Intrinsics_vec128 x,
+  Lib_IntVector_Intrinsics_vec128 y
+)
+{
+  wv[a] = Lib_IntVector_Intrinsics_vec128_add32(Lib_IntVector_Intrinsics_vec128_add32(wv[a], wv[b]), x);
+  wv[d] = Lib_IntVector_Intrinsics_vec128_rotate_right32(Lib_IntVector_Intrinsics_vec128_xor(wv[d], wv[a]), (uint32_t)16U);
+  wv[c] = Lib_IntVector_Intrinsics_vec128_add32(wv[c], wv[d]);
+  wv[b] = Lib_IntVector_Intrinsics_vec128_rotate_right32(Lib_IntVector_Intrinsics_vec128_xor(wv[b], wv[c]), (uint32_t)12U);
+  wv[a] = Lib_IntVector_Intrinsics_vec128_add32(Lib_IntVector_Intrinsics_vec128_add32(wv[a], wv[b]), y);
+  wv[d] = Lib_IntVector_Intrinsics_vec128_rotate_right32(Lib_IntVector_Intrinsics_vec128_xor(wv[d], wv[a]), (uint32_t)8U);
+  wv[c] = Lib_IntVector_Intrinsics_vec128_add32(wv[c], wv[d]);
+  wv[b] = Lib_IntVector_Intrinsics_vec128_rotate_right32(Lib_IntVector_Intrinsics_vec128_xor(wv[b], wv[c]), (uint32_t)7U);
+}
+
+static inline void
+blake3_compress4(
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 *m,
+  Lib_IntVector_Intrinsics_vec128 ctr_lo,
+  Lib_IntVector_Intrinsics_vec128 ctr_hi,
+  Lib_IntVector_Intrinsics_vec128 block_len,
+  Lib_IntVector_Intrinsics_vec128 flags
+)
+{
+  Lib_IntVector_Intrinsics_vec128 wv[16U];
+  for (uint32_t _i = 0U; _i < (uint32_t)16U; ++_i)
+    wv[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  memcpy(wv, h, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec128));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    wv[(uint32_t)8U + i] = Lib_IntVector_Intrinsics_vec128_load32(Hacl_Impl_Blake2_Constants_ivTable_S[i]);
+  }
+  wv[12U] = ctr_lo;
+  wv[13U] = ctr_hi;
+  wv[14U] = block_len;
+  wv[15U] = flags;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)7U; i++)
+  {
+    uint32_t start_idx = i * (uint32_t)16U;
+    uint32_t s0 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx];
+    uint32_t s1 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)1U];
+    uint32_t s2 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)2U];
+    uint32_t s3 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)3U];
+    uint32_t s4 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)4U];
+    uint32_t s5 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)5U];
+    uint32_t s6 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)6U];
+    uint32_t s7 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)7U];
+    uint32_t s8 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)8U];
+    uint32_t s9 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)9U];
+    uint32_t s10 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)10U];
+    uint32_t s11 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)11U];
+    uint32_t s12 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)12U];
+    uint32_t s13 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)13U];
+    uint32_t s14 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)14U];
+    uint32_t s15 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)15U];
+    blake3_g4(wv, (uint32_t)0U, (uint32_t)4U, (uint32_t)8U, (uint32_t)12U, m[s0], m[s1]);
+    blake3_g4(wv, (uint32_t)1U, (uint32_t)5U, (uint32_t)9U, (uint32_t)13U, m[s2], m[s3]);
+    blake3_g4(wv, (uint32_t)2U, (uint32_t)6U, (uint32_t)10U, (uint32_t)14U, m[s4], m[s5]);
+    blake3_g4(wv, (uint32_t)3U, (uint32_t)7U, (uint32_t)11U, (uint32_t)15U, m[s6], m[s7]);
+    blake3_g4(wv, (uint32_t)0U, (uint32_t)5U, (uint32_t)10U, (uint32_t)15U, m[s8], m[s9]);
+    blake3_g4(wv, (uint32_t)1U, (uint32_t)6U, (uint32_t)11U, (uint32_t)12U, m[s10], m[s11]);
+    blake3_g4(wv, (uint32_t)2U, (uint32_t)7U, (uint32_t)8U, (uint32_t)13U, m[s12], m[s13]);
+    blake3_g4(wv, (uint32_t)3U, (uint32_t)4U, (uint32_t)9U, (uint32_t)14U, m[s14], m[s15]);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    h[i] = Lib_IntVector_Intrinsics_vec128_xor(wv[i], wv[(uint32_t)8U + i]);
+  }
+}
+
+static inline void
+blake3_load_msg4(Lib_IntVector_Intrinsics_vec128 *m, uint8_t *b, uint32_t stride)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128
+    v0 = Lib_IntVector_Intrinsics_vec128_load_le(b + i * (uint32_t)16U);
+    Lib_IntVector_Intrinsics_vec128
+    v1 = Lib_IntVector_Intrinsics_vec128_load_le(b + stride + i * (uint32_t)16U);
+    Lib_IntVector_Intrinsics_vec128
+    v2 = Lib_IntVector_Intrinsics_vec128_load_le(b + (uint32_t)2U * stride + i * (uint32_t)16U);
+    Lib_IntVector_Intrinsics_vec128
+    v3 = Lib_IntVector_Intrinsics_vec128_load_le(b + (uint32_t)3U * stride + i * (uint32_t)16U);
+    Lib_IntVector_Intrinsics_vec128 v0_ = Lib_IntVector_Intrinsics_vec128_interleave_low32(v0, v1);
+    Lib_IntVector_Intrinsics_vec128 v1_ = Lib_IntVector_Intrinsics_vec128_interleave_high32(v0, v1);
+    Lib_IntVector_Intrinsics_vec128 v2_ = Lib_IntVector_Intrinsics_vec128_interleave_low32(v2, v3);
+    Lib_IntVector_Intrinsics_vec128 v3_ = Lib_IntVector_Intrinsics_vec128_interleave_high32(v2, v3);
+    Lib_IntVector_Intrinsics_vec128 v0__ = Lib_IntVector_Intrinsics_vec128_interleave_low64(v0_, v2_);
+    Lib_IntVector_Intrinsics_vec128 v1__ = Lib_IntVector_Intrinsics_vec128_interleave_high64(v0_, v2_);
+    Lib_IntVector_Intrinsics_vec128 v2__ = Lib_IntVector_Intrinsics_vec128_interleave_low64(v1_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v3__ = Lib_IntVector_Intrinsics_vec128_interleave_high64(v1_, v3_);
+    m[(uint32_t)4U * i + (uint32_t)0U] = v0__;
+    m[(uint32_t)4U * i + (uint32_t)1U] = v1__;
+    m[(uint32_t)4U * i + (uint32_t)2U] = v2__;
+    m[(uint32_t)4U * i + (uint32_t)3U] = v3__;
+  }
+}
+
+static inline void blake3_store_cvs4(uint8_t *b, Lib_IntVector_Intrinsics_vec128 *h)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)2U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128 v0 = h[(uint32_t)4U * i];
+    Lib_IntVector_Intrinsics_vec128 v1 = h[(uint32_t)4U * i + (uint32_t)1U];
+    Lib_IntVector_Intrinsics_vec128 v2 = h[(uint32_t)4U * i + (uint32_t)2U];
+    Lib_IntVector_Intrinsics_vec128 v3 = h[(uint32_t)4U * i + (uint32_t)3U];
+    Lib_IntVector_Intrinsics_vec128 v0_ = Lib_IntVector_Intrinsics_vec128_interleave_low32(v0, v1);
+    Lib_IntVector_Intrinsics_vec128 v1_ = Lib_IntVector_Intrinsics_vec128_interleave_high32(v0, v1);
+    Lib_IntVector_Intrinsics_vec128 v2_ = Lib_IntVector_Intrinsics_vec128_interleave_low32(v2, v3);
+    Lib_IntVector_Intrinsics_vec128 v3_ = Lib_IntVector_Intrinsics_vec128_interleave_high32(v2, v3);
+    Lib_IntVector_Intrinsics_vec128 v0__ = Lib_IntVector_Intrinsics_vec128_interleave_low64(v0_, v2_);
+    Lib_IntVector_Intrinsics_vec128 v1__ = Lib_IntVector_Intrinsics_vec128_interleave_high64(v0_, v2_);
+    Lib_IntVector_Intrinsics_vec128 v2__ = Lib_IntVector_Intrinsics_vec128_interleave_low64(v1_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v3__ = Lib_IntVector_Intrinsics_vec128_interleave_high64(v1_, v3_);
+    Lib_IntVector_Intrinsics_vec128_store_le(b + i * (uint32_t)16U, v0__);
+    Lib_IntVector_Intrinsics_vec128_store_le(b + (uint32_t)32U + i * (uint32_t)16U, v1__);
+    Lib_IntVector_Intrinsics_vec128_store_le(b + (uint32_t)64U + i * (uint32_t)16U, v2__);
+    Lib_IntVector_Intrinsics_vec128_store_le(b + (uint32_t)96U + i * (uint32_t)16U, v3__);
+  }
+}
+
+static inline void
+blake3_hash4(
+  uint8_t *input,
+  uint32_t stride,
+  uint32_t blocks,
+  uint32_t *key,
+  uint64_t counter,
+  bool increment,
+  uint32_t flags,
+  uint32_t flags_start,
+  uint32_t flags_end,
+  uint8_t *out
+)
+{
+  Lib_IntVector_Intrinsics_vec128 h[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    h[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    h[i] = Lib_IntVector_Intrinsics_vec128_load32(key[i]);
+  }
+  uint64_t inc;
+  if (increment)
+  {
+    inc = (uint64_t)1U;
+  }
+  else
+  {
+    inc = (uint64_t)0U;
+  }
+  Lib_IntVector_Intrinsics_vec128
+  ctr_lo =
+    Lib_IntVector_Intrinsics_vec128_load32s((uint32_t)(counter + (uint64_t)0U * inc),
+      (uint32_t)(counter + (uint64_t)1U * inc),
+      (uint32_t)(counter + (uint64_t)2U * inc),
+      (uint32_t)(counter + (uint64_t)3U * inc));
+  Lib_IntVector_Intrinsics_vec128
+  ctr_hi =
+    Lib_IntVector_Intrinsics_vec128_load32s((uint32_t)((counter + (uint64_t)0U * inc) >> (uint32_t)32U),
+      (uint32_t)((counter + (uint64_t)1U * inc) >> (uint32_t)32U),
+      (uint32_t)((counter + (uint64_t)2U * inc) >> (uint32_t)32U),
+      (uint32_t)((counter + (uint64_t)3U * inc) >> (uint32_t)32U));
+  Lib_IntVector_Intrinsics_vec128 block_len = Lib_IntVector_Intrinsics_vec128_load32((uint32_t)64U);
+  for (uint32_t i = (uint32_t)0U; i < blocks; i++)
+  {
+    uint32_t f0;
+    if (i == (uint32_t)0U)
+    {
+      f0 = flags | flags_start;
+    }
+    else
+    {
+      f0 = flags;
+    }
+    uint32_t f;
+    if (i == blocks - (uint32_t)1U)
+    {
+      f = f0 | flags_end;
+    }
+    else
+    {
+      f = f0;
+    }
+    Lib_IntVector_Intrinsics_vec128 m[16U];
+    for (uint32_t _i = 0U; _i < (uint32_t)16U; ++_i)
+      m[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+    blake3_load_msg4(m, input + i * (uint32_t)64U, stride);
+    blake3_compress4(h, m, ctr_lo, ctr_hi, block_len, Lib_IntVector_Intrinsics_vec128_load32(f));
+  }
+  blake3_store_cvs4(out, h);
+}
+
+void
+Hacl_Blake3_128_hash_many(
+  uint32_t n,
+  uint8_t *input,
+  uint32_t stride,
+  uint32_t blocks,
+  uint32_t *key,
+  uint64_t counter,
+  bool increment,
+  uint32_t flags,
+  uint32_t flags_start,
+  uint32_t flags_end,
+  uint8_t *out
+)
+{
+  uint32_t n1 = n / (uint32_t)4U;
+  for (uint32_t i = (uint32_t)0U; i < n1; i++)
+  {
+    uint64_t ctr;
+    if (increment)
+    {
+      ctr = counter + (uint64_t)(i * (uint32_t)4U);
+    }
+    else
+    {
+      ctr = counter;
+    }
+    blake3_hash4(input + i * (uint32_t)4U * stride,
+      stride,
+      blocks,
+      key,
+      ctr,
+      increment,
+      flags,
+      flags_start,
+      flags_end,
+      out + i * (uint32_t)128U);
+  }
+  uint64_t ctr;
+  if (increment)
+  {
+    ctr = counter + (uint64_t)(n1 * (uint32_t)4U);
+  }
+  else
+  {
+    ctr = counter;
+  }
+  Hacl_Blake3_32_hash_many(n - n1 * (uint32_t)4U,
+    input + n1 * (uint32_t)4U * stride,
+    stride,
+    blocks,
+    key,
+    ctr,
+    increment,
+    flags,
+    flags_start,
+    flags_end,
+    out + n1 * (uint32_t)128U);
+}
+
+static uint32_t
+blake3_compress_chunks_parallel(
+  uint32_t input_len,
+  uint8_t *input,
+  uint32_t *key,
+  uint64_t chunk_counter,
+  uint32_t flags,
+  uint8_t *out
+)
+{
+  uint32_t n = input_len / (uint32_t)1024U;
+  Hacl_Blake3_128_hash_many(n,
+    input,
+    (uint32_t)1024U,
+    (uint32_t)16U,
+    key,
+    chunk_counter,
+    true,
+    flags,
+    (uint32_t)1U,
+    (uint32_t)2U,
+    out);
+  uint32_t rem = input_len - n * (uint32_t)1024U;
+  if (rem > (uint32_t)0U)
+  {
+    uint32_t node[12U] = { 0U };
+    uint8_t block[64U] = { 0U };
+    Hacl_Blake3_32_chunk_node(key,
+      chunk_counter + (uint64_t)n,
+      flags,
+      rem,
+      input + n * (uint32_t)1024U,
+      node,
+      block);
+    Hacl_Blake3_32_node_cv(node, block, out + n * (uint32_t)32U);
+    return n + (uint32_t)1U;
+  }
+  return n;
+}
+
+static uint32_t
+blake3_compress_parents_parallel(
+  uint32_t num_cvs,
+  uint8_t *cvs,
+  uint32_t *key,
+  uint32_t flags,
+  uint8_t *out
+)
+{
+  uint32_t n = num_cvs / (uint32_t)2U;
+  Hacl_Blake3_128_hash_many(n,
+    cvs,
+    (uint32_t)64U,
+    (uint32_t)1U,
+    key,
+    (uint64_t)0U,
+    false,
+    flags | (uint32_t)4U,
+    (uint32_t)0U,
+    (uint32_t)0U,
+    out);
+  if (num_cvs % (uint32_t)2U == (uint32_t)1U)
+  {
+    memcpy(out + n * (uint32_t)32U, cvs + n * (uint32_t)64U, (uint32_t)32U * sizeof (uint8_t));
+    return n + (uint32_t)1U;
+  }
+  return n;
+}
+
+static uint32_t
+blake3_compress_subtree_wide(
+  uint32_t input_len,
+  uint8_t *input,
+  uint32_t *key,
+  uint64_t chunk_counter,
+  uint32_t flags,
+  uint8_t *out
+)
+{
+  if (input_len <= (uint32_t)4096U)
+  {
+    return blake3_compress_chunks_parallel(input_len, input, key, chunk_counter, flags, out);
+  }
+  uint32_t full_chunks = (input_len - (uint32_t)1U) / (uint32_t)1024U;
+  uint32_t p[1U] = { 1U };
+  while (p[0U] <= full_chunks / (uint32_t)2U)
+  {
+    p[0U] = p[0U] * (uint32_t)2U;
+  }
+  uint32_t left_len = p[0U] * (uint32_t)1024U;
+  uint64_t right_counter = chunk_counter + (uint64_t)(left_len / (uint32_t)1024U);
+  uint8_t cv_array[256U] = { 0U };
+  uint32_t degree = (uint32_t)4U;
+  uint32_t left_n = blake3_compress_subtree_wide(left_len, input, key, chunk_counter, flags, cv_array);
+  uint32_t
+  right_n =
+    blake3_compress_subtree_wide(input_len - left_len,
+      input + left_len,
+      key,
+      right_counter,
+      flags,
+      cv_array + degree * (uint32_t)32U);
+  if (left_n == (uint32_t)1U)
+  {
+    memcpy(out, cv_array, (uint32_t)64U * sizeof (uint8_t));
+    return (uint32_t)2U;
+  }
+  return blake3_compress_parents_parallel(left_n + right_n, cv_array, key, flags, out);
+}
+
+static void
+blake3_condense(uint32_t num_cvs, uint8_t *cv_array, uint32_t *key, uint32_t flags, uint8_t *out)
+{
+  uint8_t out_array[64U] = { 0U };
+  uint32_t n[1U] = { num_cvs };
+  while (n[0U] > (uint32_t)2U)
+  {
+    uint32_t n1 = blake3_compress_parents_parallel(n[0U], cv_array, key, flags, out_array);
+    memcpy(cv_array, out_array, n1 * (uint32_t)32U * sizeof (uint8_t));
+    n[0U] = n1;
+  }
+  memcpy(out, cv_array, (uint32_t)64U * sizeof (uint8_t));
+}
+
+void
+Hacl_Blake3_128_compress_subtree_to_parent_node(
+  uint32_t input_len,
+  uint8_t *input,
+  uint32_t *key,
+  uint64_t chunk_counter,
+  uint32_t flags,
+  uint8_t *out
+)
+{
+  uint8_t cv_array[128U] = { 0U };
+  uint32_t
+  n = blake3_compress_subtree_wide(input_len, input, key, chunk_counter, flags, cv_array);
+  blake3_condense(n, cv_array, key, flags, out);
+}
+
+static void
+blake3_hash_internal(
+  uint32_t *key,
+  uint32_t flags,
+  uint32_t output_len,
+  uint8_t *output,
+  uint32_t input_len,
+  uint8_t *input
+)
+{
+  uint32_t node[12U] = { 0U };
+  uint8_t block[64U] = { 0U };
+  if (input_len <= (uint32_t)1024U)
+  {
+    Hacl_Blake3_32_chunk_node(key, (uint64_t)0U, flags, input_len, input, node, block);
+  }
+  else
+  {
+    uint8_t cvs[64U] = { 0U };
+    Hacl_Blake3_128_compress_subtree_to_parent_node(input_len, input, key, (uint64_t)0U, flags, cvs);
+    Hacl_Blake3_32_parent_node(key, flags, cvs, node, block);
+  }
+  Hacl_Blake3_32_node_root(node, block, output_len, output);
+  Lib_Memzero0_memzero(node, (uint32_t)12U * sizeof (node[0U]));
+  Lib_Memzero0_memzero(block, (uint32_t)64U * sizeof (block[0U]));
+}
+
+void
+Hacl_Blake3_128_hash(uint32_t output_len, uint8_t *output, uint32_t input_len, uint8_t *input)
+{
+  uint32_t key[8U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    key[i] = Hacl_Impl_Blake2_Constants_ivTable_S[i];
+  }
+  blake3_hash_internal(key, (uint32_t)0U, output_len, output, input_len, input);
+}
+
+void
+Hacl_Blake3_128_keyed_hash(
+  uint32_t output_len,
+  uint8_t *output,
+  uint32_t input_len,
+  uint8_t *input,
+  uint8_t *key
+)
+{
+  uint32_t k[8U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint32_t *os = k;
+    uint8_t *bj = key + i * (uint32_t)4U;
+    uint32_t u = load32_le(bj);
+    uint32_t r = u;
+    uint32_t x = r;
+    os[i] = x;
+  }
+  blake3_hash_internal(k, (uint32_t)16U, output_len, output, input_len, input);
+  Lib_Memzero0_memzero(k, (uint32_t)8U * sizeof (k[0U]));
+}
+
+void
+Hacl_Blake3_128_derive_key(
+  uint32_t output_len,
+  uint8_t *output,
+  uint32_t context_len,
+  uint8_t *context,
+  uint32_t input_len,
+  uint8_t *input
+)
+{
+  uint32_t iv[8U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    iv[i] = Hacl_Impl_Blake2_Constants_ivTable_S[i];
+  }
+  uint8_t context_key[32U] = { 0U };
+  blake3_hash_internal(iv, (uint32_t)32U, (uint32_t)32U, context_key, context_len, context);
+  uint32_t k[8U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint32_t *os = k;
+    uint8_t *bj = context_key + i * (uint32_t)4U;
+    uint32_t u = load32_le(bj);
+    uint32_t r = u;
+    uint32_t x = r;
+    os[i] = x;
+  }
+  blake3_hash_internal(k, (uint32_t)64U, output_len, output, input_len, input);
+  Lib_Memzero0_memzero(context_key, (uint32_t)32U * sizeof (context_key[0U]));
+  Lib_Memzero0_memzero(k, (uint32_t)8U * sizeof (k[0U]));
+}
+
+typedef struct Hacl_Blake3_128_subtree_task_s
+{
+  void *join;
+  void *pool;
+  uint64_t input_len;
+  uint8_t *input;
+  uint32_t *key;
+  uint64_t chunk_counter;
+  uint32_t flags;
+  uint8_t *out;
+  uint32_t n;
+}
+Hacl_Blake3_128_subtree_task;
+
+static uint32_t
+blake3_compress_subtree_wide_mt(
+  void (*join)(void *x0, void (*x1)(void *x0), void *x2, void *x3),
+  void *pool,
+  uint64_t input_len,
+  uint8_t *input,
+  uint32_t *key,
+  uint64_t chunk_counter,
+  uint32_t flags,
+  uint8_t *out
+);
+
+static void blake3_subtree_task(void *t)
+{
+  Hacl_Blake3_128_subtree_task *p = (Hacl_Blake3_128_subtree_task *)t;
+  Hacl_Blake3_128_subtree_task x = p[0U];
+  void (*join)(void *x0, void (*x1)(void *x0), void *x2, void *x3) =
+    (void (*)(void *x0, void (*x1)(void *x0), void *x2, void *x3))x.join;
+  uint32_t
+  n =
+    blake3_compress_subtree_wide_mt(join,
+      x.pool,
+      x.input_len,
+      x.input,
+      x.key,
+      x.chunk_counter,
+      x.flags,
+      x.out);
+  p[0U] =
+    (
+      (Hacl_Blake3_128_subtree_task){
+        .join = x.join, .pool = x.pool, .input_len = x.input_len, .input = x.input, .key = x.key,
+        .chunk_counter = x.chunk_counter, .flags = x.flags, .out = x.out, .n = n
+      }
+    );
+}
+
+static uint32_t
+blake3_compress_subtree_wide_mt(
+  void (*join)(void *x0, void (*x1)(void *x0), void *x2, void *x3),
+  void *pool,
+  uint64_t input_len,
+  uint8_t *input,
+  uint32_t *key,
+  uint64_t chunk_counter,
+  uint32_t flags,
+  uint8_t *out
+)
+{
+  if (input_len <= (uint64_t)131072U)
+  {
+    uint32_t len = (uint32_t)input_len;
+    return blake3_compress_subtree_wide(len, input, key, chunk_counter, flags, out);
+  }
+  uint64_t full_chunks = (input_len - (uint64_t)1U) / (uint64_t)1024U;
+  uint64_t p[1U] = { (uint64_t)1U };
+  while (p[0U] <= full_chunks / (uint64_t)2U)
+  {
+    p[0U] = p[0U] * (uint64_t)2U;
+  }
+  uint64_t left_len = p[0U] * (uint64_t)1024U;
+  uint64_t right_counter = chunk_counter + left_len / (uint64_t)1024U;
+  uint8_t *right_input = Lib_Buffer64_offset(input, left_len);
+  uint8_t cv_array[256U] = { 0U };
+  Hacl_Blake3_128_subtree_task
+  left[1U] =
+    {
+      {
+        .join = (void *)join, .pool = pool, .input_len = left_len, .input = input, .key = key,
+        .chunk_counter = chunk_counter, .flags = flags, .out = cv_array, .n = (uint32_t)0U
+      }
+    };
+  Hacl_Blake3_128_subtree_task
+  right[1U] =
+    {
+      {
+        .join = (void *)join, .pool = pool, .input_len = input_len - left_len,
+        .input = right_input, .key = key, .chunk_counter = right_counter, .flags = flags,
+        .out = cv_array + (uint32_t)128U, .n = (uint32_t)0U
+      }
+    };
+  join(pool, blake3_subtree_task, (void *)left, (void *)right);
+  uint32_t left_n = left[0U].n;
+  uint32_t right_n = right[0U].n;
+  return blake3_compress_parents_parallel(left_n + right_n, cv_array, key, flags, out);
+}
+
+void
+Hacl_Blake3_128_compress_subtree_to_parent_node_mt(
+  void (*join)(void *x0, void (*x1)(void *x0), void *x2, void *x3),
+  void *pool,
+  uint32_t input_len,
+  uint8_t *input,
+  uint32_t *key,
+  uint64_t chunk_counter,
+  uint32_t flags,
+  uint8_t *out
+)
+{
+  uint8_t cv_array[128U] = { 0U };
+  uint32_t
+  n =
+    blake3_compress_subtree_wide_mt(join,
+      pool,
+      (uint64_t)input_len,
+      input,
+      key,
+      chunk_counter,
+      flags,
+      cv_array);
+  blake3_condense(n, cv_array, key, flags, out);
+}
+
+void
+Hacl_Blake3_128_hash_mt(
+  void (*join)(void *x0, void (*x1)(void *x0), void *x2, void *x3),
+  void *pool,
+  uint32_t output_len,
+  uint8_t *output,
+  uint64_t input_len,
+  uint8_t *input
+)
+{
+  uint32_t key[8U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    key[i] = Hacl_Impl_Blake2_Constants_ivTable_S[i];
+  }
+  uint32_t node[12U] = { 0U };
+  uint8_t block[64U] = { 0U };
+  if (input_len <= (uint64_t)1024U)
+  {
+    uint32_t len = (uint32_t)input_len;
+    Hacl_Blake3_32_chunk_node(key, (uint64_t)0U, (uint32_t)0U, len, input, node, block);
+  }
+  else
+  {
+    uint8_t cv_array[128U] = { 0U };
+    uint32_t
+    n =
+      blake3_compress_subtree_wide_mt(join,
+        pool,
+        input_len,
+        input,
+        key,
+        (uint64_t)0U,
+        (uint32_t)0U,
+        cv_array);
+    uint8_t cvs[64U] = { 0U };
+    blake3_condense(n, cv_array, key, (uint32_t)0U, cvs);
+    Hacl_Blake3_32_parent_node(key, (uint32_t)0U, cvs, node, block);
+  }
+  Hacl_Blake3_32_node_root(node, block, output_len, output);
+}
+
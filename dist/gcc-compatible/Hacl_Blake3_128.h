@@ -0,0 +1,159 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_Blake3_128_H
+#define __Hacl_Blake3_128_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+#include "Hacl_Blake3_32.h"
+#include "Lib_Memzero0.h"
+#include "Lib_Buffer64.h"
+#include "Hacl_Impl_Blake2_Constants.h"
+#include "Hacl_Impl_Blake3_Constants.h"
+
+/*
+  Hashes n inputs of blocks 64-byte blocks each, stride bytes apart, into n
+    chaining values. The counter of input i is counter + i if increment holds
+    and counter otherwise; flags_start and flags_end are added to the flags of
+    the first and last block.
+*/
+void
+Hacl_Blake3_128_hash_many(
+  uint32_t n,
+  uint8_t *input,
+  uint32_t stride,
+  uint32_t blocks,
+  uint32_t *key,
+  uint64_t counter,
+  bool increment,
+  uint32_t flags,
+  uint32_t flags_start,
+  uint32_t flags_end,
+  uint8_t *out
+);
+
+/*
+  Reduces input_len > 1024 bytes of input, starting at chunk chunk_counter, to
+    the two chaining values of the children of its subtree root.
+*/
+void
+Hacl_Blake3_128_compress_subtree_to_parent_node(
+  uint32_t input_len,
+  uint8_t *input,
+  uint32_t *key,
+  uint64_t chunk_counter,
+  uint32_t flags,
+  uint8_t *out
+);
+
+/*
+  Write the BLAKE3 digest of message `input` into `output`.
+
+  @param output_len Length of the extendable output, in bytes.
+  @param output Pointer to `output_len` bytes of memory where the digest is written to.
+  @param input_len Length of the input message.
+  @param input Pointer to `input_len` bytes of memory where the input message is read from.
+*/
+void Hacl_Blake3_128_hash(uint32_t output_len, uint8_t *output, uint32_t input_len, uint8_t *input);
+
+/*
+  BLAKE3 in keyed hashing mode, with the 32-byte key `key`.
+*/
+void
+Hacl_Blake3_128_keyed_hash(
+  uint32_t output_len,
+  uint8_t *output,
+  uint32_t input_len,
+  uint8_t *input,
+  uint8_t *key
+);
+
+/*
+  BLAKE3 in key derivation mode: `context` is the application-specific context
+    string and `input` the key material.
+*/
+void
+Hacl_Blake3_128_derive_key(
+  uint32_t output_len,
+  uint8_t *output,
+  uint32_t context_len,
+  uint8_t *context,
+  uint32_t input_len,
+  uint8_t *input
+);
+
+/*
+  Same as Hacl_Blake3_128_compress_subtree_to_parent_node, but subtrees of more
+    than 128 KiB are hashed by two tasks handed to `join`, as in
+    Hacl_Blake3_128_hash_mt.
+*/
+void
+Hacl_Blake3_128_compress_subtree_to_parent_node_mt(
+  void (*join)(void *x0, void (*x1)(void *x0), void *x2, void *x3),
+  void *pool,
+  uint32_t input_len,
+  uint8_t *input,
+  uint32_t *key,
+  uint64_t chunk_counter,
+  uint32_t flags,
+  uint8_t *out
+);
+
+/*
+  Same as Hacl_Blake3_128_hash, but subtrees of more than 128 KiB are hashed by
+    two tasks handed to `join`. `join(pool, task, left, right)` must run both
+    `task(left)` and `task(right)`, possibly in parallel on the threads of
+    `pool`, and return once both have completed. The result does not depend on
+    the scheduling. Unlike the other one-shot functions, the input length is
+    64-bit, so that inputs of more than 4 GiB can be hashed in one call.
+*/
+void
+Hacl_Blake3_128_hash_mt(
+  void (*join)(void *x0, void (*x1)(void *x0), void *x2, void *x3),
+  void *pool,
+  uint32_t output_len,
+  uint8_t *output,
+  uint64_t input_len,
+  uint8_t *input
+);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Blake3_128_H_DEFINED
+#endif
@@ -0,0 +1,720 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Blake3_32.h"
+
+static inline void
+blake3_g(uint32_t *st, uint32_t a, uint32_t b, uint32_t c, uint32_t d, uint32_t x, uint32_t y)
+{
+  st[a] = st[a] + st[b] + x;
+  uint32_t x1 = st[d] ^ st[a];
+  st[d] = x1 >> (uint32_t)16U | x1 << (uint32_t)16U;
+  st[c] = st[c] + st[d];
+  uint32_t x2 = st[b] ^ st[c];
+  st[b] = x2 >> (uint32_t)12U | x2 << (uint32_t)20U;
+  st[a] = st[a] + st[b] + y;
+  uint32_t x3 = st[d] ^ st[a];
+  st[d] = x3 >> (uint32_t)8U | x3 << (uint32_t)24U;
+  st[c] = st[c] + st[d];
+  uint32_t x4 = st[b] ^ st[c];
+  st[b] = x4 >> (uint32_t)7U | x4 << (uint32_t)25U;
+}
+
+static inline void
+blake3_compress_pre(
+  uint32_t *st,
+  uint32_t *cv,
+  uint8_t *block,
+  uint32_t block_len,
+  uint64_t counter,
+  uint32_t flags
+)
+{
+  uint32_t m[16U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    uint32_t *os = m;
+    uint8_t *bj = block + i * (uint32_t)4U;
+    uint32_t u = load32_le(bj);
+    uint32_t r = u;
+    uint32_t x = r;
+    os[i] = x;
+  }
+  memcpy(st, cv, (uint32_t)8U * sizeof (uint32_t));
+  st[8U] = Hacl_Impl_Blake2_Constants_ivTable_S[0U];
+  st[9U] = Hacl_Impl_Blake2_Constants_ivTable_S[1U];
+  st[10U] = Hacl_Impl_Blake2_Constants_ivTable_S[2U];
+  st[11U] = Hacl_Impl_Blake2_Constants_ivTable_S[3U];
+  st[12U] = (uint32_t)counter;
+  st[13U] = (uint32_t)(counter >> (uint32_t)32U);
+  st[14U] = block_len;
+  st[15U] = flags;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)7U; i++)
+  {
+    uint32_t start_idx = i * (uint32_t)16U;
+    uint32_t s0 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx];
+    uint32_t s1 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)1U];
+    uint32_t s2 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)2U];
+    uint32_t s3 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)3U];
+    uint32_t s4 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)4U];
+    uint32_t s5 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)5U];
+    uint32_t s6 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)6U];
+    uint32_t s7 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)7U];
+    uint32_t s8 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)8U];
+    uint32_t s9 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)9U];
+    uint32_t s10 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)10U];
+    uint32_t s11 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)11U];
+    uint32_t s12 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)12U];
+    uint32_t s13 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)13U];
+    uint32_t s14 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)14U];
+    uint32_t s15 = Hacl_Impl_Blake3_Constants_msgSchedule[start_idx + (uint32_t)15U];
+    blake3_g(st, (uint32_t)0U, (uint32_t)4U, (uint32_t)8U, (uint32_t)12U, m[s0], m[s1]);
+    blake3_g(st, (uint32_t)1U, (uint32_t)5U, (uint32_t)9U, (uint32_t)13U, m[s2], m[s3]);
+    blake3_g(st, (uint32_t)2U, (uint32_t)6U, (uint32_t)10U, (uint32_t)14U, m[s4], m[s5]);
+    blake3_g(st, (uint32_t)3U, (uint32_t)7U, (uint32_t)11U, (uint32_t)15U, m[s6], m[s7]);
+    blake3_g(st, (uint32_t)0U, (uint32_t)5U, (uint32_t)10U, (uint32_t)15U, m[s8], m[s9]);
+    blake3_g(st, (uint32_t)1U, (uint32_t)6U, (uint32_t)11U, (uint32_t)12U, m[s10], m[s11]);
+    blake3_g(st, (uint32_t)2U, (uint32_t)7U, (uint32_t)8U, (uint32_t)13U, m[s12], m[s13]);
+    blake3_g(st, (uint32_t)3U, (uint32_t)4U, (uint32_t)9U, (uint32_t)14U, m[s14], m[s15]);
+  }
+}
+
+void
+Hacl_Blake3_32_compress_in_place(
+  uint32_t *cv,
+  uint8_t *block,
+  uint32_t block_len,
+  uint64_t counter,
+  uint32_t flags
+)
+{
+  uint32_t st[16U] = { 0U };
+  blake3_compress_pre(st, cv, block, block_len, counter, flags);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint32_t *os = cv;
+    uint32_t x = st[i] ^ st[(uint32_t)8U + i];
+    os[i] = x;
+  }
+}
+
+void
+Hacl_Blake3_32_compress_xof(
+  uint32_t *cv,
+  uint8_t *block,
+  uint32_t block_len,
+  uint64_t counter,
+  uint32_t flags,
+  uint8_t *out
+)
+{
+  uint32_t st[16U] = { 0U };
+  blake3_compress_pre(st, cv, block, block_len, counter, flags);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint32_t *os = st;
+    uint32_t x = st[i] ^ st[(uint32_t)8U + i];
+    os[i] = x;
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint32_t *os = st + (uint32_t)8U;
+    uint32_t x = st[(uint32_t)8U + i] ^ cv[i];
+    os[i] = x;
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    store32_le(out + i * (uint32_t)4U, st[i]);
+  }
+}
+
+void
+Hacl_Blake3_32_chunk_node(
+  uint32_t *key,
+  uint64_t chunk_counter,
+  uint32_t flags,
+  uint32_t input_len,
+  uint8_t *input,
+  uint32_t *node,
+  uint8_t *block
+)
+{
+  uint32_t nb;
+  if (input_len == (uint32_t)0U)
+  {
+    nb = (uint32_t)0U;
+  }
+  else
+  {
+    nb = (input_len - (uint32_t)1U) / (uint32_t)64U;
+  }
+  memcpy(node, key, (uint32_t)8U * sizeof (uint32_t));
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    uint32_t f;
+    if (i == (uint32_t)0U)
+    {
+      f = flags | (uint32_t)1U;
+    }
+    else
+    {
+      f = flags;
+    }
+    Hacl_Blake3_32_compress_in_place(node, input + i * (uint32_t)64U, (uint32_t)64U, chunk_counter, f);
+  }
+  uint32_t last_len = input_len - nb * (uint32_t)64U;
+  memset(block, 0U, (uint32_t)64U * sizeof (uint8_t));
+  memcpy(block, input + nb * (uint32_t)64U, last_len * sizeof (uint8_t));
+  uint32_t start;
+  if (nb == (uint32_t)0U)
+  {
+    start = (uint32_t)1U;
+  }
+  else
+  {
+    start = (uint32_t)0U;
+  }
+  node[8U] = (uint32_t)chunk_counter;
+  node[9U] = (uint32_t)(chunk_counter >> (uint32_t)32U);
+  node[10U] = last_len;
+  node[11U] = flags | start | (uint32_t)2U;
+}
+
+void
+Hacl_Blake3_32_parent_node(
+  uint32_t *key,
+  uint32_t flags,
+  uint8_t *cvs,
+  uint32_t *node,
+  uint8_t *block
+)
+{
+  memcpy(node, key, (uint32_t)8U * sizeof (uint32_t));
+  memcpy(block, cvs, (uint32_t)64U * sizeof (uint8_t));
+  node[8U] = (uint32_t)0U;
+  node[9U] = (uint32_t)0U;
+  node[10U] = (uint32_t)64U;
+  node[11U] = flags | (uint32_t)4U;
+}
+
+void Hacl_Blake3_32_node_cv(uint32_t *node, uint8_t *block, uint8_t *out)
+{
+  uint32_t cv[8U] = { 0U };
+  memcpy(cv, node, (uint32_t)8U * sizeof (uint32_t));
+  uint64_t counter = (uint64_t)node[8U] | (uint64_t)node[9U] << (uint32_t)32U;
+  uint32_t block_len = node[10U];
+  Hacl_Blake3_32_compress_in_place(cv, block, block_len, counter, node[11U]);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    store32_le(out + i * (uint32_t)4U, cv[i]);
+  }
+}
+
+void
+Hacl_Blake3_32_node_root(uint32_t *node, uint8_t *block, uint32_t output_len, uint8_t *output)
+{
+  uint32_t nb = output_len / (uint32_t)64U;
+  uint32_t rem = output_len % (uint32_t)64U;
+  uint32_t block_len = node[10U];
+  uint32_t flags = node[11U] | (uint32_t)8U;
+  uint8_t *full = output;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    Hacl_Blake3_32_compress_xof(node, block, block_len, (uint64_t)i, flags, full + i * (uint32_t)64U);
+  }
+  if (rem > (uint32_t)0U)
+  {
+    uint8_t tmp[64U] = { 0U };
+    Hacl_Blake3_32_compress_xof(node, block, block_len, (uint64_t)nb, flags, tmp);
+    memcpy(output + nb * (uint32_t)64U, tmp, rem * sizeof (uint8_t));
+  }
+}
+
+void
+Hacl_Blake3_32_hash_many(
+  uint32_t n,
+  uint8_t *input,
+  uint32_t stride,
+  uint32_t blocks,
+  uint32_t *key,
+  uint64_t counter,
+  bool increment,
+  uint32_t flags,
+  uint32_t flags_start,
+  uint32_t flags_end,
+  uint8_t *out
+)
+{
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    uint64_t ctr;
+    if (increment)
+    {
+      ctr = counter + (uint64_t)i;
+    }
+    else
+    {
+      ctr = counter;
+    }
+    uint32_t cv[8U] = { 0U };
+    memcpy(cv, key, (uint32_t)8U * sizeof (uint32_t));
+    for (uint32_t j = (uint32_t)0U; j < blocks; j++)
+    {
+      uint32_t f0;
+      if (j == (uint32_t)0U)
+      {
+        f0 = flags | flags_start;
+      }
+      else
+      {
+        f0 = flags;
+      }
+      uint32_t f;
+      if (j == blocks - (uint32_t)1U)
+      {
+        f = f0 | flags_end;
+      }
+      else
+      {
+        f = f0;
+      }
+      Hacl_Blake3_32_compress_in_place(cv, input + i * stride + j * (uint32_t)64U, (uint32_t)64U, ctr, f);
+    }
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      store32_le(out + i * (uint32_t)32U + j * (uint32_t)4U, cv[j]);
+    }
+  }
+}
+
+static uint32_t
+blake3_compress_chunks_parallel(
+  uint32_t input_len,
+  uint8_t *input,
+  uint32_t *key,
+  uint64_t chunk_counter,
+  uint32_t flags,
+  uint8_t *out
+)
+{
+  uint32_t n = input_len / (uint32_t)1024U;
+  Hacl_Blake3_32_hash_many(n,
+    input,
+    (uint32_t)1024U,
+    (uint32_t)16U,
+    key,
+    chunk_counter,
+    true,
+    flags,
+    (uint32_t)1U,
+    (uint32_t)2U,
+    out);
+  uint32_t rem = input_len - n * (uint32_t)1024U;
+  if (rem > (uint32_t)0U)
+  {
+    uint32_t node[12U] = { 0U };
+    uint8_t block[64U] = { 0U };
+    Hacl_Blake3_32_chunk_node(key,
+      chunk_counter + (uint64_t)n,
+      flags,
+      rem,
+      input + n * (uint32_t)1024U,
+      node,
+      block);
+    Hacl_Blake3_32_node_cv(node, block, out + n * (uint32_t)32U);
+    return n + (uint32_t)1U;
+  }
+  return n;
+}
+
+static uint32_t
+blake3_compress_parents_parallel(
+  uint32_t num_cvs,
+  uint8_t *cvs,
+  uint32_t *key,
+  uint32_t flags,
+  uint8_t *out
+)
+{
+  uint32_t n = num_cvs / (uint32_t)2U;
+  Hacl_Blake3_32_hash_many(n,
+    cvs,
+    (uint32_t)64U,
+    (uint32_t)1U,
+    key,
+    (uint64_t)0U,
+    false,
+    flags | (uint32_t)4U,
+    (uint32_t)0U,
+    (uint32_t)0U,
+    out);
+  if (num_cvs % (uint32_t)2U == (uint32_t)1U)
+  {
+    memcpy(out + n * (uint32_t)32U, cvs + n * (uint32_t)64U, (uint32_t)32U * sizeof (uint8_t));
+    return n + (uint32_t)1U;
+  }
+  return n;
+}
+
+static uint32_t
+blake3_compress_subtree_wide(
+  uint32_t input_len,
+  uint8_t *input,
+  uint32_t *key,
+  uint64_t chunk_counter,
+  uint32_t flags,
+  uint8_t *out
+)
+{
+  if (input_len <= (uint32_t)1024U)
+  {
+    return blake3_compress_chunks_parallel(input_len, input, key, chunk_counter, flags, out);
+  }
+  uint32_t full_chunks = (input_len - (uint32_t)1U) / (uint32_t)1024U;
+  uint32_t p[1U] = { 1U };
+  while (p[0U] <= full_chunks / (uint32_t)2U)
+  {
+    p[0U] = p[0U] * (uint32_t)2U;
+  }
+  uint32_t left_len = p[0U] * (uint32_t)1024U;
+  uint64_t right_counter = chunk_counter + (uint64_t)(left_len / (uint32_t)1024U);
+  uint8_t cv_array[128U] = { 0U };
+  uint32_t degree;
+  if (left_len > (uint32_t)1024U)
+  {
+    degree = (uint32_t)2U;
+  }
+  else
+  {
+    degree = (uint32_t)1U;
+  }
+  uint32_t left_n = blake3_compress_subtree_wide(left_len, input, key, chunk_counter, flags, cv_array);
+  uint32_t
+  right_n =
+    blake3_compress_subtree_wide(input_len - left_len,
+      input + left_len,
+      key,
+      right_counter,
+      flags,
+      cv_array + degree * (uint32_t)32U);
+  if (left_n == (uint32_t)1U)
+  {
+    memcpy(out, cv_array, (uint32_t)64U * sizeof (uint8_t));
+    return (uint32_t)2U;
+  }
+  return blake3_compress_parents_parallel(left_n + right_n, cv_array, key, flags, out);
+}
+
+static void
+blake3_condense(uint32_t num_cvs, uint8_t *cv_array, uint32_t *key, uint32_t flags, uint8_t *out)
+{
+  uint8_t out_array[32U] = { 0U };
+  uint32_t n[1U] = { num_cvs };
+  while (n[0U] > (uint32_t)2U)
+  {
+    uint32_t n1 = blake3_compress_parents_parallel(n[0U], cv_array, key, flags, out_array);
+    memcpy(cv_array, out_array, n1 * (uint32_t)32U * sizeof (uint8_t));
+    n[0U] = n1;
+  }
+  memcpy(out, cv_array, (uint32_t)64U * sizeof (uint8_t));
+}
+
+void
+Hacl_Blake3_32_compress_subtree_to_parent_node(
+  uint32_t input_len,
+  uint8_t *input,
+  uint32_t *key,
+  uint64_t chunk_counter,
+  uint32_t flags,
+  uint8_t *out
+)
+{
+  uint8_t cv_array[64U] = { 0U };
+  uint32_t
+  n = blake3_compress_subtree_wide(input_len, input, key, chunk_counter, flags, cv_array);
+  blake3_condense(n, cv_array, key, flags, out);
+}
+
+static void
+blake3_hash_internal(
+  uint32_t *key,
+  uint32_t flags,
+  uint32_t output_len,
+  uint8_t *output,
+  uint32_t input_len,
+  uint8_t *input
+)
+{
+  uint32_t node[12U] = { 0U };
+  uint8_t block[64U] = { 0U };
+  if (input_len <= (uint32_t)1024U)
+  {
+    Hacl_Blake3_32_chunk_node(key, (uint64_t)0U, flags, input_len, input, node, block);
+  }
+  else
+  {
+    uint8_t cvs[64U] = { 0U };
+    Hacl_Blake3_32_compress_subtree_to_parent_node(input_len, input, key, (uint64_t)0U, flags, cvs);
+    Hacl_Blake3_32_parent_node(key, flags, cvs, node, block);
+  }
+  Hacl_Blake3_32_node_root(node, block, output_len, output);
+  Lib_Memzero0_memzero(node, (uint32_t)12U * sizeof (node[0U]));
+  Lib_Memzero0_memzero(block, (uint32_t)64U * sizeof (block[0U]));
+}
+
+void
+Hacl_Blake3_32_hash(uint32_t output_len, uint8_t *output, uint32_t input_len, uint8_t *input)
+{
+  uint32_t key[8U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    key[i] = Hacl_Impl_Blake2_Constants_ivTable_S[i];
+  }
+  blake3_hash_internal(key, (uint32_t)0U, output_len, output, input_len, input);
+}
+
+void
+Hacl_Blake3_32_keyed_hash(
+  uint32_t output_len,
+  uint8_t *output,
+  uint32_t input_len,
+  uint8_t *input,
+  uint8_t *key
+)
+{
+  uint32_t k[8U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint32_t *os = k;
+    uint8_t *bj = key + i * (uint32_t)4U;
+    uint32_t u = load32_le(bj);
+    uint32_t r = u;
+    uint32_t x = r;
+    os[i] = x;
+  }
+  blake3_hash_internal(k, (uint32_t)16U, output_len, output, input_len, input);
+  Lib_Memzero0_memzero(k, (uint32_t)8U * sizeof (k[0U]));
+}
+
+void
+Hacl_Blake3_32_derive_key(
+  uint32_t output_len,
+  uint8_t *output,
+  uint32_t context_len,
+  uint8_t *context,
+  uint32_t input_len,
+  uint8_t *input
+)
+{
+  uint32_t iv[8U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    iv[i] = Hacl_Impl_Blake2_Constants_ivTable_S[i];
+  }
+  uint8_t context_key[32U] = { 0U };
+  blake3_hash_internal(iv, (uint32_t)32U, (uint32_t)32U, context_key, context_len, context);
+  uint32_t k[8U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint32_t *os = k;
+    uint8_t *bj = context_key + i * (uint32_t)4U;
+    uint32_t u = load32_le(bj);
+    uint32_t r = u;
+    uint32_t x = r;
+    os[i] = x;
+  }
+  blake3_hash_internal(k, (uint32_t)64U, output_len, output, input_len, input);
+  Lib_Memzero0_memzero(context_key, (uint32_t)32U * sizeof (context_key[0U]));
+  Lib_Memzero0_memzero(k, (uint32_t)8U * sizeof (k[0U]));
+}
+
+typedef struct Hacl_Blake3_32_subtree_task_s
+{
+  void *join;
+  void *pool;
+  uint64_t input_len;
+  uint8_t *input;
+  uint32_t *key;
+  uint64_t chunk_counter;
+  uint32_t flags;
+  uint8_t *out;
+  uint32_t n;
+}
+Hacl_Blake3_32_subtree_task;
+
+static uint32_t
+blake3_compress_subtree_wide_mt(
+  void (*join)(void *x0, void (*x1)(void *x0), void *x2, void *x3),
+  void *pool,
+  uint64_t input_len,
+  uint8_t *input,
+  uint32_t *key,
+  uint64_t chunk_counter,
+  uint32_t flags,
+  uint8_t *out
+);
+
+static void blake3_subtree_task(void *t)
+{
+  Hacl_Blake3_32_subtree_task *p = (Hacl_Blake3_32_subtree_task *)t;
+  Hacl_Blake3_32_subtree_task x = p[0U];
+  void (*join)(void *x0, void (*x1)(void *x0), void *x2, void *x3) =
+    (void (*)(void *x0, void (*x1)(void *x0), void *x2, void *x3))x.join;
+  uint32_t
+  n =
+    blake3_compress_subtree_wide_mt(join,
+      x.pool,
+      x.input_len,
+      x.input,
+      x.key,
+      x.chunk_counter,
+      x.flags,
+      x.out);
+  p[0U] =
+    (
+      (Hacl_Blake3_32_subtree_task){
+        .join = x.join, .pool = x.pool, .input_len = x.input_len, .input = x.input, .key = x.key,
+        .chunk_counter = x.chunk_counter, .flags = x.flags, .out = x.out, .n = n
+      }
+    );
+}
+
+static uint32_t
+blake3_compress_subtree_wide_mt(
+  void (*join)(void *x0, void (*x1)(void *x0), void *x2, void *x3),
+  void *pool,
+  uint64_t input_len,
+  uint8_t *input,
+  uint32_t *key,
+  uint64_t chunk_counter,
+  uint32_t flags,
+  uint8_t *out
+)
+{
+  if (input_len <= (uint64_t)131072U)
+  {
+    uint32_t len = (uint32_t)input_len;
+    return blake3_compress_subtree_wide(len, input, key, chunk_counter, flags, out);
+  }
+  uint64_t full_chunks = (input_len - (uint64_t)1U) / (uint64_t)1024U;
+  uint64_t p[1U] = { (uint64_t)1U };
+  while (p[0U] <= full_chunks / (uint64_t)2U)
+  {
+    p[0U] = p[0U] * (uint64_t)2U;
+  }
+  uint64_t left_len = p[0U] * (uint64_t)1024U;
+  uint64_t right_counter = chunk_counter + left_len / (uint64_t)1024U;
+  uint8_t *right_input = Lib_Buffer64_offset(input, left_len);
+  uint8_t cv_array[128U] = { 0U };
+  Hacl_Blake3_32_subtree_task
+  left[1U] =
+    {
+      {
+        .join = (void *)join, .pool = pool, .input_len = left_len, .input = input, .key = key,
+        .chunk_counter = chunk_counter, .flags = flags, .out = cv_array, .n = (uint32_t)0U
+      }
+    };
+  Hacl_Blake3_32_subtree_task
+  right[1U] =
+    {
+      {
+        .join = (void *)join, .pool = pool, .input_len = input_len - left_len,
+        .input = right_input, .key = key, .chunk_counter = right_counter, .flags = flags,
+        .out = cv_array + (uint32_t)64U, .n = (uint32_t)0U
+      }
+    };
+  join(pool, blake3_subtree_task, (void *)left, (void *)right);
+  uint32_t left_n = left[0U].n;
+  uint32_t right_n = right[0U].n;
+  return blake3_compress_parents_parallel(left_n + right_n, cv_array, key, flags, out);
+}
+
+void
+Hacl_Blake3_32_compress_subtree_to_parent_node_mt(
+  void (*join)(void *x0, void (*x1)(void *x0), void *x2, void *x3),
+  void *pool,
+  uint32_t input_len,
+  uint8_t *input,
+  uint32_t *key,
+  uint64_t chunk_counter,
+  uint32_t flags,
+  uint8_t *out
+)
+{
+  uint8_t cv_array[64U] = { 0U };
+  uint32_t
+  n =
+    blake3_compress_subtree_wide_mt(join,
+      pool,
+      (uint64_t)input_len,
+      input,
+      key,
+      chunk_counter,
+      flags,
+      cv_array);
+  blake3_condense(n, cv_array, key, flags, out);
+}
+
+void
+Hacl_Blake3_32_hash_mt(
+  void (*join)(void *x0, void (*x1)(void *x0), void *x2, void *x3),
+  void *pool,
+  uint32_t output_len,
+  uint8_t *output,
+  uint64_t input_len,
+  uint8_t *input
+)
+{
+  uint32_t key[8U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    key[i] = Hacl_Impl_Blake2_Constants_ivTable_S[i];
+  }
+  uint32_t node[12U] = { 0U };
+  uint8_t block[64U] = { 0U };
+  if (input_len <= (uint64_t)1024U)
+  {
+    uint32_t len = (uint32_t)input_len;
+    Hacl_Blake3_32_chunk_node(key, (uint64_t)0U, (uint32_t)0U, len, input, node, block);
+  }
+  else
+  {
+    uint8_t cv_array[64U] = { 0U };
+    uint32_t
+    n =
+      blake3_compress_subtree_wide_mt(join,
+        pool,
+        input_len,
+        input,
+        key,
+        (uint64_t)0U,
+        (uint32_t)0U,
+        cv_array);
+    uint8_t cvs[64U] = { 0U };
+    blake3_condense(n, cv_array, key, (uint32_t)0U, cvs);
+    Hacl_Blake3_32_parent_node(key, (uint32_t)0U, cvs, node, block);
+  }
+  Hacl_Blake3_32_node_root(node, block, output_len, output);
+}
+
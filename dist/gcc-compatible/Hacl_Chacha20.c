@@ -204,6 +204,47 @@ Hacl_Impl_Chacha20_chacha20_update(uint32_t *ctx, uint32_t len, uint8_t *out, ui
   }
 }
 
+static void hchacha20(uint8_t *out, uint8_t *k, uint8_t *n)
+{
+  uint32_t ctx[16U] = { 0U };
+  uint32_t *uu____0 = ctx;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint32_t *os = uu____0;
+    uint32_t x = chacha20_constants[i];
+    os[i] = x;
+  }
+  uint32_t *uu____1 = ctx + (uint32_t)4U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint32_t *os = uu____1;
+    uint8_t *bj = k + i * (uint32_t)4U;
+    uint32_t u = load32_le(bj);
+    uint32_t r = u;
+    uint32_t x = r;
+    os[i] = x;
+  }
+  uint32_t *uu____2 = ctx + (uint32_t)12U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint32_t *os = uu____2;
+    uint8_t *bj = n + i * (uint32_t)4U;
+    uint32_t u = load32_le(bj);
+    uint32_t r = u;
+    uint32_t x = r;
+    os[i] = x;
+  }
+  rounds(ctx);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    store32_le(out + i * (uint32_t)4U, ctx[i]);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    store32_le(out + (uint32_t)16U + i * (uint32_t)4U, ctx[(uint32_t)12U + i]);
+  }
+}
+
 void
 Hacl_Chacha20_chacha20_encrypt(
   uint32_t len,
@@ -234,3 +275,8 @@ Hacl_Chacha20_chacha20_decrypt(
   Hacl_Impl_Chacha20_chacha20_update(ctx, len, out, cipher);
 }
 
+void Hacl_Chacha20_hchacha20(uint8_t *out, uint8_t *key, uint8_t *n)
+{
+  hchacha20(out, key, n);
+}
+
@@ -74,6 +74,8 @@ Hacl_Chacha20_chacha20_decrypt(
   uint32_t ctr
 );
 
+void Hacl_Chacha20_hchacha20(uint8_t *out, uint8_t *key, uint8_t *n);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -1184,3 +1184,43 @@ Hacl_Chacha20Poly1305_128_aead_decrypt(
   return (uint32_t)1U;
 }
 
+void
+Hacl_Chacha20Poly1305_128_xaead_encrypt(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *mac
+)
+{
+  uint8_t subkey[32U] = { 0U };
+  uint8_t nonce[12U] = { 0U };
+  Hacl_Chacha20_hchacha20(subkey, k, n);
+  memcpy(nonce + (uint32_t)4U, n + (uint32_t)16U, (uint32_t)8U * sizeof (uint8_t));
+  Hacl_Chacha20Poly1305_128_aead_encrypt(subkey, nonce, aadlen, aad, mlen, m, cipher, mac);
+}
+
+uint32_t
+Hacl_Chacha20Poly1305_128_xaead_decrypt(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *mac
+)
+{
+  uint8_t subkey[32U] = { 0U };
+  uint8_t nonce[12U] = { 0U };
+  Hacl_Chacha20_hchacha20(subkey, k, n);
+  memcpy(nonce + (uint32_t)4U, n + (uint32_t)16U, (uint32_t)8U * sizeof (uint8_t));
+  uint32_t
+  res = Hacl_Chacha20Poly1305_128_aead_decrypt(subkey, nonce, aadlen, aad, mlen, m, cipher, mac);
+  return res;
+}
+
@@ -0,0 +1,1212 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Curve25519_256.h"
+
+static inline void
+carry_wide4(
+  Lib_IntVector_Intrinsics_vec256 *out,
+  Lib_IntVector_Intrinsics_vec256 h0,
+  Lib_IntVector_Intrinsics_vec256 h1,
+  Lib_IntVector_Intrinsics_vec256 h2,
+  Lib_IntVector_Intrinsics_vec256 h3,
+  Lib_IntVector_Intrinsics_vec256 h4,
+  Lib_IntVector_Intrinsics_vec256 h5,
+  Lib_IntVector_Intrinsics_vec256 h6,
+  Lib_IntVector_Intrinsics_vec256 h7,
+  Lib_IntVector_Intrinsics_vec256 h8,
+  Lib_IntVector_Intrinsics_vec256 h9
+)
+{
+  Lib_IntVector_Intrinsics_vec256
+  mask26 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3ffffffU);
+  Lib_IntVector_Intrinsics_vec256
+  mask25 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x1ffffffU);
+  Lib_IntVector_Intrinsics_vec256
+  c0 = Lib_IntVector_Intrinsics_vec256_shift_right64(h0, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec256 h01 = Lib_IntVector_Intrinsics_vec256_and(h0, mask26);
+  Lib_IntVector_Intrinsics_vec256 h11 = Lib_IntVector_Intrinsics_vec256_add64(h1, c0);
+  Lib_IntVector_Intrinsics_vec256
+  c4 = Lib_IntVector_Intrinsics_vec256_shift_right64(h4, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec256 h41 = Lib_IntVector_Intrinsics_vec256_and(h4, mask26);
+  Lib_IntVector_Intrinsics_vec256 h51 = Lib_IntVector_Intrinsics_vec256_add64(h5, c4);
+  Lib_IntVector_Intrinsics_vec256
+  c1 = Lib_IntVector_Intrinsics_vec256_shift_right64(h11, (uint32_t)25U);
+  Lib_IntVector_Intrinsics_vec256 h12 = Lib_IntVector_Intrinsics_vec256_and(h11, mask25);
+  Lib_IntVector_Intrinsics_vec256 h21 = Lib_IntVector_Intrinsics_vec256_add64(h2, c1);
+  Lib_IntVector_Intrinsics_vec256
+  c5 = Lib_IntVector_Intrinsics_vec256_shift_right64(h51, (uint32_t)25U);
+  Lib_IntVector_Intrinsics_vec256 h52 = Lib_IntVector_Intrinsics_vec256_and(h51, mask25);
+  Lib_IntVector_Intrinsics_vec256 h61 = Lib_IntVector_Intrinsics_vec256_add64(h6, c5);
+  Lib_IntVector_Intrinsics_vec256
+  c2 = Lib_IntVector_Intrinsics_vec256_shift_right64(h21, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec256 h22 = Lib_IntVector_Intrinsics_vec256_and(h21, mask26);
+  Lib_IntVector_Intrinsics_vec256 h31 = Lib_IntVector_Intrinsics_vec256_add64(h3, c2);
+  Lib_IntVector_Intrinsics_vec256
+  c6 = Lib_IntVector_Intrinsics_vec256_shift_right64(h61, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec256 h62 = Lib_IntVector_Intrinsics_vec256_and(h61, mask26);
+  Lib_IntVector_Intrinsics_vec256 h71 = Lib_IntVector_Intrinsics_vec256_add64(h7, c6);
+  Lib_IntVector_Intrinsics_vec256
+  c3 = Lib_IntVector_Intrinsics_vec256_shift_right64(h31, (uint32_t)25U);
+  Lib_IntVector_Intrinsics_vec256 h32 = Lib_IntVector_Intrinsics_vec256_and(h31, mask25);
+  Lib_IntVector_Intrinsics_vec256 h42 = Lib_IntVector_Intrinsics_vec256_add64(h41, c3);
+  Lib_IntVector_Intrinsics_vec256
+  c7 = Lib_IntVector_Intrinsics_vec256_shift_right64(h71, (uint32_t)25U);
+  Lib_IntVector_Intrinsics_vec256 h72 = Lib_IntVector_Intrinsics_vec256_and(h71, mask25);
+  Lib_IntVector_Intrinsics_vec256 h81 = Lib_IntVector_Intrinsics_vec256_add64(h8, c7);
+  Lib_IntVector_Intrinsics_vec256
+  c41 = Lib_IntVector_Intrinsics_vec256_shift_right64(h42, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec256 h43 = Lib_IntVector_Intrinsics_vec256_and(h42, mask26);
+  Lib_IntVector_Intrinsics_vec256 h53 = Lib_IntVector_Intrinsics_vec256_add64(h52, c41);
+  Lib_IntVector_Intrinsics_vec256
+  c8 = Lib_IntVector_Intrinsics_vec256_shift_right64(h81, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec256 h82 = Lib_IntVector_Intrinsics_vec256_and(h81, mask26);
+  Lib_IntVector_Intrinsics_vec256 h91 = Lib_IntVector_Intrinsics_vec256_add64(h9, c8);
+  Lib_IntVector_Intrinsics_vec256
+  c9 = Lib_IntVector_Intrinsics_vec256_shift_right64(h91, (uint32_t)25U);
+  Lib_IntVector_Intrinsics_vec256 h92 = Lib_IntVector_Intrinsics_vec256_and(h91, mask25);
+  Lib_IntVector_Intrinsics_vec256
+  c9_19 =
+    Lib_IntVector_Intrinsics_vec256_add64(c9,
+      Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_shift_left64(c9,
+          (uint32_t)1U),
+        Lib_IntVector_Intrinsics_vec256_shift_left64(c9, (uint32_t)4U)));
+  Lib_IntVector_Intrinsics_vec256 h02 = Lib_IntVector_Intrinsics_vec256_add64(h01, c9_19);
+  Lib_IntVector_Intrinsics_vec256
+  c01 = Lib_IntVector_Intrinsics_vec256_shift_right64(h02, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec256 h03 = Lib_IntVector_Intrinsics_vec256_and(h02, mask26);
+  Lib_IntVector_Intrinsics_vec256 h13 = Lib_IntVector_Intrinsics_vec256_add64(h12, c01);
+  out[0U] = h03;
+  out[1U] = h13;
+  out[2U] = h22;
+  out[3U] = h32;
+  out[4U] = h43;
+  out[5U] = h53;
+  out[6U] = h62;
+  out[7U] = h72;
+  out[8U] = h82;
+  out[9U] = h92;
+}
+
+static inline void
+fmul4(
+  Lib_IntVector_Intrinsics_vec256 *out,
+  Lib_IntVector_Intrinsics_vec256 *f,
+  Lib_IntVector_Intrinsics_vec256 *g
+)
+{
+  Lib_IntVector_Intrinsics_vec256 f0 = f[0U];
+  Lib_IntVector_Intrinsics_vec256 f1 = f[1U];
+  Lib_IntVector_Intrinsics_vec256 f2 = f[2U];
+  Lib_IntVector_Intrinsics_vec256 f3 = f[3U];
+  Lib_IntVector_Intrinsics_vec256 f4 = f[4U];
+  Lib_IntVector_Intrinsics_vec256 f5 = f[5U];
+  Lib_IntVector_Intrinsics_vec256 f6 = f[6U];
+  Lib_IntVector_Intrinsics_vec256 f7 = f[7U];
+  Lib_IntVector_Intrinsics_vec256 f8 = f[8U];
+  Lib_IntVector_Intrinsics_vec256 f9 = f[9U];
+  Lib_IntVector_Intrinsics_vec256 g0 = g[0U];
+  Lib_IntVector_Intrinsics_vec256 g1 = g[1U];
+  Lib_IntVector_Intrinsics_vec256 g2 = g[2U];
+  Lib_IntVector_Intrinsics_vec256 g3 = g[3U];
+  Lib_IntVector_Intrinsics_vec256 g4 = g[4U];
+  Lib_IntVector_Intrinsics_vec256 g5 = g[5U];
+  Lib_IntVector_Intrinsics_vec256 g6 = g[6U];
+  Lib_IntVector_Intrinsics_vec256 g7 = g[7U];
+  Lib_IntVector_Intrinsics_vec256 g8 = g[8U];
+  Lib_IntVector_Intrinsics_vec256 g9 = g[9U];
+  Lib_IntVector_Intrinsics_vec256
+  f1_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f1, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f3_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f3, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f5_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f5, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f7_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f7, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f9_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f9, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  g1_19 = Lib_IntVector_Intrinsics_vec256_smul64(g1, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256
+  g2_19 = Lib_IntVector_Intrinsics_vec256_smul64(g2, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256
+  g3_19 = Lib_IntVector_Intrinsics_vec256_smul64(g3, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256
+  g4_19 = Lib_IntVector_Intrinsics_vec256_smul64(g4, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256
+  g5_19 = Lib_IntVector_Intrinsics_vec256_smul64(g5, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256
+  g6_19 = Lib_IntVector_Intrinsics_vec256_smul64(g6, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256
+  g7_19 = Lib_IntVector_Intrinsics_vec256_smul64(g7, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256
+  g8_19 = Lib_IntVector_Intrinsics_vec256_smul64(g8, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256
+  g9_19 = Lib_IntVector_Intrinsics_vec256_smul64(g9, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256 h00 = Lib_IntVector_Intrinsics_vec256_mul64(f0, g0);
+  Lib_IntVector_Intrinsics_vec256
+  h01 =
+    Lib_IntVector_Intrinsics_vec256_add64(h00, Lib_IntVector_Intrinsics_vec256_mul64(f1_2, g9_19));
+  Lib_IntVector_Intrinsics_vec256
+  h02 =
+    Lib_IntVector_Intrinsics_vec256_add64(h01, Lib_IntVector_Intrinsics_vec256_mul64(f2, g8_19));
+  Lib_IntVector_Intrinsics_vec256
+  h03 =
+    Lib_IntVector_Intrinsics_vec256_add64(h02, Lib_IntVector_Intrinsics_vec256_mul64(f3_2, g7_19));
+  Lib_IntVector_Intrinsics_vec256
+  h04 =
+    Lib_IntVector_Intrinsics_vec256_add64(h03, Lib_IntVector_Intrinsics_vec256_mul64(f4, g6_19));
+  Lib_IntVector_Intrinsics_vec256
+  h05 =
+    Lib_IntVector_Intrinsics_vec256_add64(h04, Lib_IntVector_Intrinsics_vec256_mul64(f5_2, g5_19));
+  Lib_IntVector_Intrinsics_vec256
+  h06 =
+    Lib_IntVector_Intrinsics_vec256_add64(h05, Lib_IntVector_Intrinsics_vec256_mul64(f6, g4_19));
+  Lib_IntVector_Intrinsics_vec256
+  h07 =
+    Lib_IntVector_Intrinsics_vec256_add64(h06, Lib_IntVector_Intrinsics_vec256_mul64(f7_2, g3_19));
+  Lib_IntVector_Intrinsics_vec256
+  h08 =
+    Lib_IntVector_Intrinsics_vec256_add64(h07, Lib_IntVector_Intrinsics_vec256_mul64(f8, g2_19));
+  Lib_IntVector_Intrinsics_vec256
+  h09 =
+    Lib_IntVector_Intrinsics_vec256_add64(h08, Lib_IntVector_Intrinsics_vec256_mul64(f9_2, g1_19));
+  Lib_IntVector_Intrinsics_vec256 h10 = Lib_IntVector_Intrinsics_vec256_mul64(f0, g1);
+  Lib_IntVector_Intrinsics_vec256
+  h11 =
+    Lib_IntVector_Intrinsics_vec256_add64(h10, Lib_IntVector_Intrinsics_vec256_mul64(f1, g0));
+  Lib_IntVector_Intrinsics_vec256
+  h12 =
+    Lib_IntVector_Intrinsics_vec256_add64(h11, Lib_IntVector_Intrinsics_vec256_mul64(f2, g9_19));
+  Lib_IntVector_Intrinsics_vec256
+  h13 =
+    Lib_IntVector_Intrinsics_vec256_add64(h12, Lib_IntVector_Intrinsics_vec256_mul64(f3, g8_19));
+  Lib_IntVector_Intrinsics_vec256
+  h14 =
+    Lib_IntVector_Intrinsics_vec256_add64(h13, Lib_IntVector_Intrinsics_vec256_mul64(f4, g7_19));
+  Lib_IntVector_Intrinsics_vec256
+  h15 =
+    Lib_IntVector_Intrinsics_vec256_add64(h14, Lib_IntVector_Intrinsics_vec256_mul64(f5, g6_19));
+  Lib_IntVector_Intrinsics_vec256
+  h16 =
+    Lib_IntVector_Intrinsics_vec256_add64(h15, Lib_IntVector_Intrinsics_vec256_mul64(f6, g5_19));
+  Lib_IntVector_Intrinsics_vec256
+  h17 =
+    Lib_IntVector_Intrinsics_vec256_add64(h16, Lib_IntVector_Intrinsics_vec256_mul64(f7, g4_19));
+  Lib_IntVector_Intrinsics_vec256
+  h18 =
+    Lib_IntVector_Intrinsics_vec256_add64(h17, Lib_IntVector_Intrinsics_vec256_mul64(f8, g3_19));
+  Lib_IntVector_Intrinsics_vec256
+  h19 =
+    Lib_IntVector_Intrinsics_vec256_add64(h18, Lib_IntVector_Intrinsics_vec256_mul64(f9, g2_19));
+  Lib_IntVector_Intrinsics_vec256 h20 = Lib_IntVector_Intrinsics_vec256_mul64(f0, g2);
+  Lib_IntVector_Intrinsics_vec256
+  h21 =
+    Lib_IntVector_Intrinsics_vec256_add64(h20, Lib_IntVector_Intrinsics_vec256_mul64(f1_2, g1));
+  Lib_IntVector_Intrinsics_vec256
+  h22 =
+    Lib_IntVector_Intrinsics_vec256_add64(h21, Lib_IntVector_Intrinsics_vec256_mul64(f2, g0));
+  Lib_IntVector_Intrinsics_vec256
+  h23 =
+    Lib_IntVector_Intrinsics_vec256_add64(h22, Lib_IntVector_Intrinsics_vec256_mul64(f3_2, g9_19));
+  Lib_IntVector_Intrinsics_vec256
+  h24 =
+    Lib_IntVector_Intrinsics_vec256_add64(h23, Lib_IntVector_Intrinsics_vec256_mul64(f4, g8_19));
+  Lib_IntVector_Intrinsics_vec256
+  h25 =
+    Lib_IntVector_Intrinsics_vec256_add64(h24, Lib_IntVector_Intrinsics_vec256_mul64(f5_2, g7_19));
+  Lib_IntVector_Intrinsics_vec256
+  h26 =
+    Lib_IntVector_Intrinsics_vec256_add64(h25, Lib_IntVector_Intrinsics_vec256_mul64(f6, g6_19));
+  Lib_IntVector_Intrinsics_vec256
+  h27 =
+    Lib_IntVector_Intrinsics_vec256_add64(h26, Lib_IntVector_Intrinsics_vec256_mul64(f7_2, g5_19));
+  Lib_IntVector_Intrinsics_vec256
+  h28 =
+    Lib_IntVector_Intrinsics_vec256_add64(h27, Lib_IntVector_Intrinsics_vec256_mul64(f8, g4_19));
+  Lib_IntVector_Intrinsics_vec256
+  h29 =
+    Lib_IntVector_Intrinsics_vec256_add64(h28, Lib_IntVector_Intrinsics_vec256_mul64(f9_2, g3_19));
+  Lib_IntVector_Intrinsics_vec256 h30 = Lib_IntVector_Intrinsics_vec256_mul64(f0, g3);
+  Lib_IntVector_Intrinsics_vec256
+  h31 =
+    Lib_IntVector_Intrinsics_vec256_add64(h30, Lib_IntVector_Intrinsics_vec256_mul64(f1, g2));
+  Lib_IntVector_Intrinsics_vec256
+  h32 =
+    Lib_IntVector_Intrinsics_vec256_add64(h31, Lib_IntVector_Intrinsics_vec256_mul64(f2, g1));
+  Lib_IntVector_Intrinsics_vec256
+  h33 =
+    Lib_IntVector_Intrinsics_vec256_add64(h32, Lib_IntVector_Intrinsics_vec256_mul64(f3, g0));
+  Lib_IntVector_Intrinsics_vec256
+  h34 =
+    Lib_IntVector_Intrinsics_vec256_add64(h33, Lib_IntVector_Intrinsics_vec256_mul64(f4, g9_19));
+  Lib_IntVector_Intrinsics_vec256
+  h35 =
+    Lib_IntVector_Intrinsics_vec256_add64(h34, Lib_IntVector_Intrinsics_vec256_mul64(f5, g8_19));
+  Lib_IntVector_Intrinsics_vec256
+  h36 =
+    Lib_IntVector_Intrinsics_vec256_add64(h35, Lib_IntVector_Intrinsics_vec256_mul64(f6, g7_19));
+  Lib_IntVector_Intrinsics_vec256
+  h37 =
+    Lib_IntVector_Intrinsics_vec256_add64(h36, Lib_IntVector_Intrinsics_vec256_mul64(f7, g6_19));
+  Lib_IntVector_Intrinsics_vec256
+  h38 =
+    Lib_IntVector_Intrinsics_vec256_add64(h37, Lib_IntVector_Intrinsics_vec256_mul64(f8, g5_19));
+  Lib_IntVector_Intrinsics_vec256
+  h39 =
+    Lib_IntVector_Intrinsics_vec256_add64(h38, Lib_IntVector_Intrinsics_vec256_mul64(f9, g4_19));
+  Lib_IntVector_Intrinsics_vec256 h40 = Lib_IntVector_Intrinsics_vec256_mul64(f0, g4);
+  Lib_IntVector_Intrinsics_vec256
+  h41 =
+    Lib_IntVector_Intrinsics_vec256_add64(h40, Lib_IntVector_Intrinsics_vec256_mul64(f1_2, g3));
+  Lib_IntVector_Intrinsics_vec256
+  h42 =
+    Lib_IntVector_Intrinsics_vec256_add64(h41, Lib_IntVector_Intrinsics_vec256_mul64(f2, g2));
+  Lib_IntVector_Intrinsics_vec256
+  h43 =
+    Lib_IntVector_Intrinsics_vec256_add64(h42, Lib_IntVector_Intrinsics_vec256_mul64(f3_2, g1));
+  Lib_IntVector_Intrinsics_vec256
+  h44 =
+    Lib_IntVector_Intrinsics_vec256_add64(h43, Lib_IntVector_Intrinsics_vec256_mul64(f4, g0));
+  Lib_IntVector_Intrinsics_vec256
+  h45 =
+    Lib_IntVector_Intrinsics_vec256_add64(h44, Lib_IntVector_Intrinsics_vec256_mul64(f5_2, g9_19));
+  Lib_IntVector_Intrinsics_vec256
+  h46 =
+    Lib_IntVector_Intrinsics_vec256_add64(h45, Lib_IntVector_Intrinsics_vec256_mul64(f6, g8_19));
+  Lib_IntVector_Intrinsics_vec256
+  h47 =
+    Lib_IntVector_Intrinsics_vec256_add64(h46, Lib_IntVector_Intrinsics_vec256_mul64(f7_2, g7_19));
+  Lib_IntVector_Intrinsics_vec256
+  h48 =
+    Lib_IntVector_Intrinsics_vec256_add64(h47, Lib_IntVector_Intrinsics_vec256_mul64(f8, g6_19));
+  Lib_IntVector_Intrinsics_vec256
+  h49 =
+    Lib_IntVector_Intrinsics_vec256_add64(h48, Lib_IntVector_Intrinsics_vec256_mul64(f9_2, g5_19));
+  Lib_IntVector_Intrinsics_vec256 h50 = Lib_IntVector_Intrinsics_vec256_mul64(f0, g5);
+  Lib_IntVector_Intrinsics_vec256
+  h51 =
+    Lib_IntVector_Intrinsics_vec256_add64(h50, Lib_IntVector_Intrinsics_vec256_mul64(f1, g4));
+  Lib_IntVector_Intrinsics_vec256
+  h52 =
+    Lib_IntVector_Intrinsics_vec256_add64(h51, Lib_IntVector_Intrinsics_vec256_mul64(f2, g3));
+  Lib_IntVector_Intrinsics_vec256
+  h53 =
+    Lib_IntVector_Intrinsics_vec256_add64(h52, Lib_IntVector_Intrinsics_vec256_mul64(f3, g2));
+  Lib_IntVector_Intrinsics_vec256
+  h54 =
+    Lib_IntVector_Intrinsics_vec256_add64(h53, Lib_IntVector_Intrinsics_vec256_mul64(f4, g1));
+  Lib_IntVector_Intrinsics_vec256
+  h55 =
+    Lib_IntVector_Intrinsics_vec256_add64(h54, Lib_IntVector_Intrinsics_vec256_mul64(f5, g0));
+  Lib_IntVector_Intrinsics_vec256
+  h56 =
+    Lib_IntVector_Intrinsics_vec256_add64(h55, Lib_IntVector_Intrinsics_vec256_mul64(f6, g9_19));
+  Lib_IntVector_Intrinsics_vec256
+  h57 =
+    Lib_IntVector_Intrinsics_vec256_add64(h56, Lib_IntVector_Intrinsics_vec256_mul64(f7, g8_19));
+  Lib_IntVector_Intrinsics_vec256
+  h58 =
+    Lib_IntVector_Intrinsics_vec256_add64(h57, Lib_IntVector_Intrinsics_vec256_mul64(f8, g7_19));
+  Lib_IntVector_Intrinsics_vec256
+  h59 =
+    Lib_IntVector_Intrinsics_vec256_add64(h58, Lib_IntVector_Intrinsics_vec256_mul64(f9, g6_19));
+  Lib_IntVector_Intrinsics_vec256 h60 = Lib_IntVector_Intrinsics_vec256_mul64(f0, g6);
+  Lib_IntVector_Intrinsics_vec256
+  h61 =
+    Lib_IntVector_Intrinsics_vec256_add64(h60, Lib_IntVector_Intrinsics_vec256_mul64(f1_2, g5));
+  Lib_IntVector_Intrinsics_vec256
+  h62 =
+    Lib_IntVector_Intrinsics_vec256_add64(h61, Lib_IntVector_Intrinsics_vec256_mul64(f2, g4));
+  Lib_IntVector_Intrinsics_vec256
+  h63 =
+    Lib_IntVector_Intrinsics_vec256_add64(h62, Lib_IntVector_Intrinsics_vec256_mul64(f3_2, g3));
+  Lib_IntVector_Intrinsics_vec256
+  h64 =
+    Lib_IntVector_Intrinsics_vec256_add64(h63, Lib_IntVector_Intrinsics_vec256_mul64(f4, g2));
+  Lib_IntVector_Intrinsics_vec256
+  h65 =
+    Lib_IntVector_Intrinsics_vec256_add64(h64, Lib_IntVector_Intrinsics_vec256_mul64(f5_2, g1));
+  Lib_IntVector_Intrinsics_vec256
+  h66 =
+    Lib_IntVector_Intrinsics_vec256_add64(h65, Lib_IntVector_Intrinsics_vec256_mul64(f6, g0));
+  Lib_IntVector_Intrinsics_vec256
+  h67 =
+    Lib_IntVector_Intrinsics_vec256_add64(h66, Lib_IntVector_Intrinsics_vec256_mul64(f7_2, g9_19));
+  Lib_IntVector_Intrinsics_vec256
+  h68 =
+    Lib_IntVector_Intrinsics_vec256_add64(h67, Lib_IntVector_Intrinsics_vec256_mul64(f8, g8_19));
+  Lib_IntVector_Intrinsics_vec256
+  h69 =
+    Lib_IntVector_Intrinsics_vec256_add64(h68, Lib_IntVector_Intrinsics_vec256_mul64(f9_2, g7_19));
+  Lib_IntVector_Intrinsics_vec256 h70 = Lib_IntVector_Intrinsics_vec256_mul64(f0, g7);
+  Lib_IntVector_Intrinsics_vec256
+  h71 =
+    Lib_IntVector_Intrinsics_vec256_add64(h70, Lib_IntVector_Intrinsics_vec256_mul64(f1, g6));
+  Lib_IntVector_Intrinsics_vec256
+  h72 =
+    Lib_IntVector_Intrinsics_vec256_add64(h71, Lib_IntVector_Intrinsics_vec256_mul64(f2, g5));
+  Lib_IntVector_Intrinsics_vec256
+  h73 =
+    Lib_IntVector_Intrinsics_vec256_add64(h72, Lib_IntVector_Intrinsics_vec256_mul64(f3, g4));
+  Lib_IntVector_Intrinsics_vec256
+  h74 =
+    Lib_IntVector_Intrinsics_vec256_add64(h73, Lib_IntVector_Intrinsics_vec256_mul64(f4, g3));
+  Lib_IntVector_Intrinsics_vec256
+  h75 =
+    Lib_IntVector_Intrinsics_vec256_add64(h74, Lib_IntVector_Intrinsics_vec256_mul64(f5, g2));
+  Lib_IntVector_Intrinsics_vec256
+  h76 =
+    Lib_IntVector_Intrinsics_vec256_add64(h75, Lib_IntVector_Intrinsics_vec256_mul64(f6, g1));
+  Lib_IntVector_Intrinsics_vec256
+  h77 =
+    Lib_IntVector_Intrinsics_vec256_add64(h76, Lib_IntVector_Intrinsics_vec256_mul64(f7, g0));
+  Lib_IntVector_Intrinsics_vec256
+  h78 =
+    Lib_IntVector_Intrinsics_vec256_add64(h77, Lib_IntVector_Intrinsics_vec256_mul64(f8, g9_19));
+  Lib_IntVector_Intrinsics_vec256
+  h79 =
+    Lib_IntVector_Intrinsics_vec256_add64(h78, Lib_IntVector_Intrinsics_vec256_mul64(f9, g8_19));
+  Lib_IntVector_Intrinsics_vec256 h80 = Lib_IntVector_Intrinsics_vec256_mul64(f0, g8);
+  Lib_IntVector_Intrinsics_vec256
+  h81 =
+    Lib_IntVector_Intrinsics_vec256_add64(h80, Lib_IntVector_Intrinsics_vec256_mul64(f1_2, g7));
+  Lib_IntVector_Intrinsics_vec256
+  h82 =
+    Lib_IntVector_Intrinsics_vec256_add64(h81, Lib_IntVector_Intrinsics_vec256_mul64(f2, g6));
+  Lib_IntVector_Intrinsics_vec256
+  h83 =
+    Lib_IntVector_Intrinsics_vec256_add64(h82, Lib_IntVector_Intrinsics_vec256_mul64(f3_2, g5));
+  Lib_IntVector_Intrinsics_vec256
+  h84 =
+    Lib_IntVector_Intrinsics_vec256_add64(h83, Lib_IntVector_Intrinsics_vec256_mul64(f4, g4));
+  Lib_IntVector_Intrinsics_vec256
+  h85 =
+    Lib_IntVector_Intrinsics_vec256_add64(h84, Lib_IntVector_Intrinsics_vec256_mul64(f5_2, g3));
+  Lib_IntVector_Intrinsics_vec256
+  h86 =
+    Lib_IntVector_Intrinsics_vec256_add64(h85, Lib_IntVector_Intrinsics_vec256_mul64(f6, g2));
+  Lib_IntVector_Intrinsics_vec256
+  h87 =
+    Lib_IntVector_Intrinsics_vec256_add64(h86, Lib_IntVector_Intrinsics_vec256_mul64(f7_2, g1));
+  Lib_IntVector_Intrinsics_vec256
+  h88 =
+    Lib_IntVector_Intrinsics_vec256_add64(h87, Lib_IntVector_Intrinsics_vec256_mul64(f8, g0));
+  Lib_IntVector_Intrinsics_vec256
+  h89 =
+    Lib_IntVector_Intrinsics_vec256_add64(h88, Lib_IntVector_Intrinsics_vec256_mul64(f9_2, g9_19));
+  Lib_IntVector_Intrinsics_vec256 h90 = Lib_IntVector_Intrinsics_vec256_mul64(f0, g9);
+  Lib_IntVector_Intrinsics_vec256
+  h91 =
+    Lib_IntVector_Intrinsics_vec256_add64(h90, Lib_IntVector_Intrinsics_vec256_mul64(f1, g8));
+  Lib_IntVector_Intrinsics_vec256
+  h92 =
+    Lib_IntVector_Intrinsics_vec256_add64(h91, Lib_IntVector_Intrinsics_vec256_mul64(f2, g7));
+  Lib_IntVector_Intrinsics_vec256
+  h93 =
+    Lib_IntVector_Intrinsics_vec256_add64(h92, Lib_IntVector_Intrinsics_vec256_mul64(f3, g6));
+  Lib_IntVector_Intrinsics_vec256
+  h94 =
+    Lib_IntVector_Intrinsics_vec256_add64(h93, Lib_IntVector_Intrinsics_vec256_mul64(f4, g5));
+  Lib_IntVector_Intrinsics_vec256
+  h95 =
+    Lib_IntVector_Intrinsics_vec256_add64(h94, Lib_IntVector_Intrinsics_vec256_mul64(f5, g4));
+  Lib_IntVector_Intrinsics_vec256
+  h96 =
+    Lib_IntVector_Intrinsics_vec256_add64(h95, Lib_IntVector_Intrinsics_vec256_mul64(f6, g3));
+  Lib_IntVector_Intrinsics_vec256
+  h97 =
+    Lib_IntVector_Intrinsics_vec256_add64(h96, Lib_IntVector_Intrinsics_vec256_mul64(f7, g2));
+  Lib_IntVector_Intrinsics_vec256
+  h98 =
+    Lib_IntVector_Intrinsics_vec256_add64(h97, Lib_IntVector_Intrinsics_vec256_mul64(f8, g1));
+  Lib_IntVector_Intrinsics_vec256
+  h99 =
+    Lib_IntVector_Intrinsics_vec256_add64(h98, Lib_IntVector_Intrinsics_vec256_mul64(f9, g0));
+  carry_wide4(out, h09, h19, h29, h39, h49, h59, h69, h79, h89, h99);
+}
+
+static inline void
+fsqr4(Lib_IntVector_Intrinsics_vec256 *out, Lib_IntVector_Intrinsics_vec256 *f)
+{
+  Lib_IntVector_Intrinsics_vec256 f0 = f[0U];
+  Lib_IntVector_Intrinsics_vec256 f1 = f[1U];
+  Lib_IntVector_Intrinsics_vec256 f2 = f[2U];
+  Lib_IntVector_Intrinsics_vec256 f3 = f[3U];
+  Lib_IntVector_Intrinsics_vec256 f4 = f[4U];
+  Lib_IntVector_Intrinsics_vec256 f5 = f[5U];
+  Lib_IntVector_Intrinsics_vec256 f6 = f[6U];
+  Lib_IntVector_Intrinsics_vec256 f7 = f[7U];
+  Lib_IntVector_Intrinsics_vec256 f8 = f[8U];
+  Lib_IntVector_Intrinsics_vec256 f9 = f[9U];
+  Lib_IntVector_Intrinsics_vec256
+  f0_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f0, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f1_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f1, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f2_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f2, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f3_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f3, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f4_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f4, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f5_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f5, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f6_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f6, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f7_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f7, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f8_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f8, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f9_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f9, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f1_4 = Lib_IntVector_Intrinsics_vec256_shift_left64(f1, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec256
+  f3_4 = Lib_IntVector_Intrinsics_vec256_shift_left64(f3, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec256
+  f5_4 = Lib_IntVector_Intrinsics_vec256_shift_left64(f5, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec256
+  f7_4 = Lib_IntVector_Intrinsics_vec256_shift_left64(f7, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec256
+  f5_19 = Lib_IntVector_Intrinsics_vec256_smul64(f5, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256
+  f6_19 = Lib_IntVector_Intrinsics_vec256_smul64(f6, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256
+  f7_19 = Lib_IntVector_Intrinsics_vec256_smul64(f7, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256
+  f8_19 = Lib_IntVector_Intrinsics_vec256_smul64(f8, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256
+  f9_19 = Lib_IntVector_Intrinsics_vec256_smul64(f9, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256 h00 = Lib_IntVector_Intrinsics_vec256_mul64(f0, f0);
+  Lib_IntVector_Intrinsics_vec256
+  h01 =
+    Lib_IntVector_Intrinsics_vec256_add64(h00, Lib_IntVector_Intrinsics_vec256_mul64(f1_4, f9_19));
+  Lib_IntVector_Intrinsics_vec256
+  h02 =
+    Lib_IntVector_Intrinsics_vec256_add64(h01, Lib_IntVector_Intrinsics_vec256_mul64(f2_2, f8_19));
+  Lib_IntVector_Intrinsics_vec256
+  h03 =
+    Lib_IntVector_Intrinsics_vec256_add64(h02, Lib_IntVector_Intrinsics_vec256_mul64(f3_4, f7_19));
+  Lib_IntVector_Intrinsics_vec256
+  h04 =
+    Lib_IntVector_Intrinsics_vec256_add64(h03, Lib_IntVector_Intrinsics_vec256_mul64(f4_2, f6_19));
+  Lib_IntVector_Intrinsics_vec256
+  h05 =
+    Lib_IntVector_Intrinsics_vec256_add64(h04, Lib_IntVector_Intrinsics_vec256_mul64(f5_2, f5_19));
+  Lib_IntVector_Intrinsics_vec256 h10 = Lib_IntVector_Intrinsics_vec256_mul64(f0_2, f1);
+  Lib_IntVector_Intrinsics_vec256
+  h11 =
+    Lib_IntVector_Intrinsics_vec256_add64(h10, Lib_IntVector_Intrinsics_vec256_mul64(f2_2, f9_19));
+  Lib_IntVector_Intrinsics_vec256
+  h12 =
+    Lib_IntVector_Intrinsics_vec256_add64(h11, Lib_IntVector_Intrinsics_vec256_mul64(f3_2, f8_19));
+  Lib_IntVector_Intrinsics_vec256
+  h13 =
+    Lib_IntVector_Intrinsics_vec256_add64(h12, Lib_IntVector_Intrinsics_vec256_mul64(f4_2, f7_19));
+  Lib_IntVector_Intrinsics_vec256
+  h14 =
+    Lib_IntVector_Intrinsics_vec256_add64(h13, Lib_IntVector_Intrinsics_vec256_mul64(f5_2, f6_19));
+  Lib_IntVector_Intrinsics_vec256 h20 = Lib_IntVector_Intrinsics_vec256_mul64(f0_2, f2);
+  Lib_IntVector_Intrinsics_vec256
+  h21 =
+    Lib_IntVector_Intrinsics_vec256_add64(h20, Lib_IntVector_Intrinsics_vec256_mul64(f1_2, f1));
+  Lib_IntVector_Intrinsics_vec256
+  h22 =
+    Lib_IntVector_Intrinsics_vec256_add64(h21, Lib_IntVector_Intrinsics_vec256_mul64(f3_4, f9_19));
+  Lib_IntVector_Intrinsics_vec256
+  h23 =
+    Lib_IntVector_Intrinsics_vec256_add64(h22, Lib_IntVector_Intrinsics_vec256_mul64(f4_2, f8_19));
+  Lib_IntVector_Intrinsics_vec256
+  h24 =
+    Lib_IntVector_Intrinsics_vec256_add64(h23, Lib_IntVector_Intrinsics_vec256_mul64(f5_4, f7_19));
+  Lib_IntVector_Intrinsics_vec256
+  h25 =
+    Lib_IntVector_Intrinsics_vec256_add64(h24, Lib_IntVector_Intrinsics_vec256_mul64(f6, f6_19));
+  Lib_IntVector_Intrinsics_vec256 h30 = Lib_IntVector_Intrinsics_vec256_mul64(f0_2, f3);
+  Lib_IntVector_Intrinsics_vec256
+  h31 =
+    Lib_IntVector_Intrinsics_vec256_add64(h30, Lib_IntVector_Intrinsics_vec256_mul64(f1_2, f2));
+  Lib_IntVector_Intrinsics_vec256
+  h32 =
+    Lib_IntVector_Intrinsics_vec256_add64(h31, Lib_IntVector_Intrinsics_vec256_mul64(f4_2, f9_19));
+  Lib_IntVector_Intrinsics_vec256
+  h33 =
+    Lib_IntVector_Intrinsics_vec256_add64(h32, Lib_IntVector_Intrinsics_vec256_mul64(f5_2, f8_19));
+  Lib_IntVector_Intrinsics_vec256
+  h34 =
+    Lib_IntVector_Intrinsics_vec256_add64(h33, Lib_IntVector_Intrinsics_vec256_mul64(f6_2, f7_19));
+  Lib_IntVector_Intrinsics_vec256 h40 = Lib_IntVector_Intrinsics_vec256_mul64(f0_2, f4);
+  Lib_IntVector_Intrinsics_vec256
+  h41 =
+    Lib_IntVector_Intrinsics_vec256_add64(h40, Lib_IntVector_Intrinsics_vec256_mul64(f1_4, f3));
+  Lib_IntVector_Intrinsics_vec256
+  h42 =
+    Lib_IntVector_Intrinsics_vec256_add64(h41, Lib_IntVector_Intrinsics_vec256_mul64(f2, f2));
+  Lib_IntVector_Intrinsics_vec256
+  h43 =
+    Lib_IntVector_Intrinsics_vec256_add64(h42, Lib_IntVector_Intrinsics_vec256_mul64(f5_4, f9_19));
+  Lib_IntVector_Intrinsics_vec256
+  h44 =
+    Lib_IntVector_Intrinsics_vec256_add64(h43, Lib_IntVector_Intrinsics_vec256_mul64(f6_2, f8_19));
+  Lib_IntVector_Intrinsics_vec256
+  h45 =
+    Lib_IntVector_Intrinsics_vec256_add64(h44, Lib_IntVector_Intrinsics_vec256_mul64(f7_2, f7_19));
+  Lib_IntVector_Intrinsics_vec256 h50 = Lib_IntVector_Intrinsics_vec256_mul64(f0_2, f5);
+  Lib_IntVector_Intrinsics_vec256
+  h51 =
+    Lib_IntVector_Intrinsics_vec256_add64(h50, Lib_IntVector_Intrinsics_vec256_mul64(f1_2, f4));
+  Lib_IntVector_Intrinsics_vec256
+  h52 =
+    Lib_IntVector_Intrinsics_vec256_add64(h51, Lib_IntVector_Intrinsics_vec256_mul64(f2_2, f3));
+  Lib_IntVector_Intrinsics_vec256
+  h53 =
+    Lib_IntVector_Intrinsics_vec256_add64(h52, Lib_IntVector_Intrinsics_vec256_mul64(f6_2, f9_19));
+  Lib_IntVector_Intrinsics_vec256
+  h54 =
+    Lib_IntVector_Intrinsics_vec256_add64(h53, Lib_IntVector_Intrinsics_vec256_mul64(f7_2, f8_19));
+  Lib_IntVector_Intrinsics_vec256 h60 = Lib_IntVector_Intrinsics_vec256_mul64(f0_2, f6);
+  Lib_IntVector_Intrinsics_vec256
+  h61 =
+    Lib_IntVector_Intrinsics_vec256_add64(h60, Lib_IntVector_Intrinsics_vec256_mul64(f1_4, f5));
+  Lib_IntVector_Intrinsics_vec256
+  h62 =
+    Lib_IntVector_Intrinsics_vec256_add64(h61, Lib_IntVector_Intrinsics_vec256_mul64(f2_2, f4));
+  Lib_IntVector_Intrinsics_vec256
+  h63 =
+    Lib_IntVector_Intrinsics_vec256_add64(h62, Lib_IntVector_Intrinsics_vec256_mul64(f3_2, f3));
+  Lib_IntVector_Intrinsics_vec256
+  h64 =
+    Lib_IntVector_Intrinsics_vec256_add64(h63, Lib_IntVector_Intrinsics_vec256_mul64(f7_4, f9_19));
+  Lib_IntVector_Intrinsics_vec256
+  h65 =
+    Lib_IntVector_Intrinsics_vec256_add64(h64, Lib_IntVector_Intrinsics_vec256_mul64(f8, f8_19));
+  Lib_IntVector_Intrinsics_vec256 h70 = Lib_IntVector_Intrinsics_vec256_mul64(f0_2, f7);
+  Lib_IntVector_Intrinsics_vec256
+  h71 =
+    Lib_IntVector_Intrinsics_vec256_add64(h70, Lib_IntVector_Intrinsics_vec256_mul64(f1_2, f6));
+  Lib_IntVector_Intrinsics_vec256
+  h72 =
+    Lib_IntVector_Intrinsics_vec256_add64(h71, Lib_IntVector_Intrinsics_vec256_mul64(f2_2, f5));
+  Lib_IntVector_Intrinsics_vec256
+  h73 =
+    Lib_IntVector_Intrinsics_vec256_add64(h72, Lib_IntVector_Intrinsics_vec256_mul64(f3_2, f4));
+  Lib_IntVector_Intrinsics_vec256
+  h74 =
+    Lib_IntVector_Intrinsics_vec256_add64(h73, Lib_IntVector_Intrinsics_vec256_mul64(f8_2, f9_19));
+  Lib_IntVector_Intrinsics_vec256 h80 = Lib_IntVector_Intrinsics_vec256_mul64(f0_2, f8);
+  Lib_IntVector_Intrinsics_vec256
+  h81 =
+    Lib_IntVector_Intrinsics_vec256_add64(h80, Lib_IntVector_Intrinsics_vec256_mul64(f1_4, f7));
+  Lib_IntVector_Intrinsics_vec256
+  h82 =
+    Lib_IntVector_Intrinsics_vec256_add64(h81, Lib_IntVector_Intrinsics_vec256_mul64(f2_2, f6));
+  Lib_IntVector_Intrinsics_vec256
+  h83 =
+    Lib_IntVector_Intrinsics_vec256_add64(h82, Lib_IntVector_Intrinsics_vec256_mul64(f3_4, f5));
+  Lib_IntVector_Intrinsics_vec256
+  h84 =
+    Lib_IntVector_Intrinsics_vec256_add64(h83, Lib_IntVector_Intrinsics_vec256_mul64(f4, f4));
+  Lib_IntVector_Intrinsics_vec256
+  h85 =
+    Lib_IntVector_Intrinsics_vec256_add64(h84, Lib_IntVector_Intrinsics_vec256_mul64(f9_2, f9_19));
+  Lib_IntVector_Intrinsics_vec256 h90 = Lib_IntVector_Intrinsics_vec256_mul64(f0_2, f9);
+  Lib_IntVector_Intrinsics_vec256
+  h91 =
+    Lib_IntVector_Intrinsics_vec256_add64(h90, Lib_IntVector_Intrinsics_vec256_mul64(f1_2, f8));
+  Lib_IntVector_Intrinsics_vec256
+  h92 =
+    Lib_IntVector_Intrinsics_vec256_add64(h91, Lib_IntVector_Intrinsics_vec256_mul64(f2_2, f7));
+  Lib_IntVector_Intrinsics_vec256
+  h93 =
+    Lib_IntVector_Intrinsics_vec256_add64(h92, Lib_IntVector_Intrinsics_vec256_mul64(f3_2, f6));
+  Lib_IntVector_Intrinsics_vec256
+  h94 =
+    Lib_IntVector_Intrinsics_vec256_add64(h93, Lib_IntVector_Intrinsics_vec256_mul64(f4_2, f5));
+  carry_wide4(out, h05, h14, h25, h34, h45, h54, h65, h74, h85, h94);
+}
+
+static inline void
+fadd4(
+  Lib_IntVector_Intrinsics_vec256 *out,
+  Lib_IntVector_Intrinsics_vec256 *f1,
+  Lib_IntVector_Intrinsics_vec256 *f2
+)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)10U; i++)
+  {
+    out[i] = Lib_IntVector_Intrinsics_vec256_add64(f1[i], f2[i]);
+  }
+}
+
+static inline void
+fsub4(
+  Lib_IntVector_Intrinsics_vec256 *out,
+  Lib_IntVector_Intrinsics_vec256 *f1,
+  Lib_IntVector_Intrinsics_vec256 *f2
+)
+{
+  out[0U] =
+    Lib_IntVector_Intrinsics_vec256_sub64(Lib_IntVector_Intrinsics_vec256_add64(f1[0U],
+        Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x7ffffdaU)),
+      f2[0U]);
+  out[1U] =
+    Lib_IntVector_Intrinsics_vec256_sub64(Lib_IntVector_Intrinsics_vec256_add64(f1[1U],
+        Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3fffffeU)),
+      f2[1U]);
+  out[2U] =
+    Lib_IntVector_Intrinsics_vec256_sub64(Lib_IntVector_Intrinsics_vec256_add64(f1[2U],
+        Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x7fffffeU)),
+      f2[2U]);
+  out[3U] =
+    Lib_IntVector_Intrinsics_vec256_sub64(Lib_IntVector_Intrinsics_vec256_add64(f1[3U],
+        Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3fffffeU)),
+      f2[3U]);
+  out[4U] =
+    Lib_IntVector_Intrinsics_vec256_sub64(Lib_IntVector_Intrinsics_vec256_add64(f1[4U],
+        Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x7fffffeU)),
+      f2[4U]);
+  out[5U] =
+    Lib_IntVector_Intrinsics_vec256_sub64(Lib_IntVector_Intrinsics_vec256_add64(f1[5U],
+        Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3fffffeU)),
+      f2[5U]);
+  out[6U] =
+    Lib_IntVector_Intrinsics_vec256_sub64(Lib_IntVector_Intrinsics_vec256_add64(f1[6U],
+        Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x7fffffeU)),
+      f2[6U]);
+  out[7U] =
+    Lib_IntVector_Intrinsics_vec256_sub64(Lib_IntVector_Intrinsics_vec256_add64(f1[7U],
+        Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3fffffeU)),
+      f2[7U]);
+  out[8U] =
+    Lib_IntVector_Intrinsics_vec256_sub64(Lib_IntVector_Intrinsics_vec256_add64(f1[8U],
+        Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x7fffffeU)),
+      f2[8U]);
+  out[9U] =
+    Lib_IntVector_Intrinsics_vec256_sub64(Lib_IntVector_Intrinsics_vec256_add64(f1[9U],
+        Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3fffffeU)),
+      f2[9U]);
+}
+
+static inline void
+fmul_a24(Lib_IntVector_Intrinsics_vec256 *out, Lib_IntVector_Intrinsics_vec256 *f)
+{
+  Lib_IntVector_Intrinsics_vec256
+  h0 = Lib_IntVector_Intrinsics_vec256_smul64(f[0U], (uint64_t)121665U);
+  Lib_IntVector_Intrinsics_vec256
+  h1 = Lib_IntVector_Intrinsics_vec256_smul64(f[1U], (uint64_t)121665U);
+  Lib_IntVector_Intrinsics_vec256
+  h2 = Lib_IntVector_Intrinsics_vec256_smul64(f[2U], (uint64_t)121665U);
+  Lib_IntVector_Intrinsics_vec256
+  h3 = Lib_IntVector_Intrinsics_vec256_smul64(f[3U], (uint64_t)121665U);
+  Lib_IntVector_Intrinsics_vec256
+  h4 = Lib_IntVector_Intrinsics_vec256_smul64(f[4U], (uint64_t)121665U);
+  Lib_IntVector_Intrinsics_vec256
+  h5 = Lib_IntVector_Intrinsics_vec256_smul64(f[5U], (uint64_t)121665U);
+  Lib_IntVector_Intrinsics_vec256
+  h6 = Lib_IntVector_Intrinsics_vec256_smul64(f[6U], (uint64_t)121665U);
+  Lib_IntVector_Intrinsics_vec256
+  h7 = Lib_IntVector_Intrinsics_vec256_smul64(f[7U], (uint64_t)121665U);
+  Lib_IntVector_Intrinsics_vec256
+  h8 = Lib_IntVector_Intrinsics_vec256_smul64(f[8U], (uint64_t)121665U);
+  Lib_IntVector_Intrinsics_vec256
+  h9 = Lib_IntVector_Intrinsics_vec256_smul64(f[9U], (uint64_t)121665U);
+  carry_wide4(out, h0, h1, h2, h3, h4, h5, h6, h7, h8, h9);
+}
+
+static inline void
+cswap4(
+  Lib_IntVector_Intrinsics_vec256 bit,
+  Lib_IntVector_Intrinsics_vec256 *p1,
+  Lib_IntVector_Intrinsics_vec256 *p2
+)
+{
+  Lib_IntVector_Intrinsics_vec256
+  mask = Lib_IntVector_Intrinsics_vec256_sub64(Lib_IntVector_Intrinsics_vec256_zero, bit);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)20U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    dummy =
+      Lib_IntVector_Intrinsics_vec256_and(mask, Lib_IntVector_Intrinsics_vec256_xor(p1[i], p2[i]));
+    p1[i] = Lib_IntVector_Intrinsics_vec256_xor(p1[i], dummy);
+    p2[i] = Lib_IntVector_Intrinsics_vec256_xor(p2[i], dummy);
+  }
+}
+
+static inline void load_felem10(uint64_t *f, uint8_t *b)
+{
+  uint64_t u0 = load64_le(b);
+  uint64_t u1 = load64_le(b + (uint32_t)8U);
+  uint64_t u2 = load64_le(b + (uint32_t)16U);
+  uint64_t u3 = load64_le(b + (uint32_t)24U) & (uint64_t)0x7fffffffffffffffU;
+  f[0U] = u0 & (uint64_t)0x3ffffffU;
+  f[1U] = u0 >> (uint32_t)26U & (uint64_t)0x1ffffffU;
+  f[2U] = (u0 >> (uint32_t)51U | u1 << (uint32_t)13U) & (uint64_t)0x3ffffffU;
+  f[3U] = u1 >> (uint32_t)13U & (uint64_t)0x1ffffffU;
+  f[4U] = u1 >> (uint32_t)38U;
+  f[5U] = u2 & (uint64_t)0x1ffffffU;
+  f[6U] = u2 >> (uint32_t)25U & (uint64_t)0x3ffffffU;
+  f[7U] = (u2 >> (uint32_t)51U | u3 << (uint32_t)13U) & (uint64_t)0x1ffffffU;
+  f[8U] = u3 >> (uint32_t)12U & (uint64_t)0x3ffffffU;
+  f[9U] = u3 >> (uint32_t)38U;
+}
+
+static inline void felem10_to_felem5(uint64_t *o, uint64_t *f)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+  {
+    o[i] = f[(uint32_t)2U * i] + (f[(uint32_t)2U * i + (uint32_t)1U] << (uint32_t)26U);
+  }
+}
+
+static inline void
+lanes_of_felem4(uint64_t *o, uint32_t lane, Lib_IntVector_Intrinsics_vec256 *f)
+{
+  uint8_t b[32U] = { 0U };
+  uint64_t f10[10U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)10U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256_store_le(b, f[i]);
+    f10[i] = load64_le(b + lane * (uint32_t)8U);
+  }
+  felem10_to_felem5(o, f10);
+}
+
+static void encode_point1(uint8_t *o, uint64_t *x, uint64_t *z)
+{
+  uint64_t tmp[5U] = { 0U };
+  uint64_t u64s[4U] = { 0U };
+  FStar_UInt128_uint128 tmp_w[10U];
+  for (uint32_t _i = 0U; _i < (uint32_t)10U; ++_i)
+    tmp_w[_i] = FStar_UInt128_uint64_to_uint128((uint64_t)0U);
+  Hacl_Curve25519_51_finv(tmp, z, tmp_w);
+  Hacl_Impl_Curve25519_Field51_fmul(tmp, tmp, x, tmp_w);
+  Hacl_Impl_Curve25519_Field51_store_felem(u64s, tmp);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    store64_le(o + i * (uint32_t)8U, u64s[i]);
+  }
+}
+
+static inline Lib_IntVector_Intrinsics_vec256
+swap_pairs(Lib_IntVector_Intrinsics_vec256 x, Lib_IntVector_Intrinsics_vec256 m02)
+{
+  Lib_IntVector_Intrinsics_vec256
+  r1 = Lib_IntVector_Intrinsics_vec256_rotate_right_lanes64(x, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  r3 = Lib_IntVector_Intrinsics_vec256_rotate_right_lanes64(x, (uint32_t)3U);
+  return
+    Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_and(r1, m02),
+      Lib_IntVector_Intrinsics_vec256_and(r3, Lib_IntVector_Intrinsics_vec256_lognot(m02)));
+}
+
+static void
+point_add_and_double1(
+  Lib_IntVector_Intrinsics_vec256 *nq,
+  Lib_IntVector_Intrinsics_vec256 *k,
+  Lib_IntVector_Intrinsics_vec256 *tmp
+)
+{
+  Lib_IntVector_Intrinsics_vec256
+  m0 =
+    Lib_IntVector_Intrinsics_vec256_load64s((uint64_t)0xffffffffffffffffU,
+      (uint64_t)0U,
+      (uint64_t)0U,
+      (uint64_t)0U);
+  Lib_IntVector_Intrinsics_vec256
+  m1 =
+    Lib_IntVector_Intrinsics_vec256_load64s((uint64_t)0U,
+      (uint64_t)0xffffffffffffffffU,
+      (uint64_t)0U,
+      (uint64_t)0U);
+  Lib_IntVector_Intrinsics_vec256
+  m2 =
+    Lib_IntVector_Intrinsics_vec256_load64s((uint64_t)0U,
+      (uint64_t)0U,
+      (uint64_t)0xffffffffffffffffU,
+      (uint64_t)0U);
+  Lib_IntVector_Intrinsics_vec256
+  m3 =
+    Lib_IntVector_Intrinsics_vec256_load64s((uint64_t)0U,
+      (uint64_t)0U,
+      (uint64_t)0U,
+      (uint64_t)0xffffffffffffffffU);
+  Lib_IntVector_Intrinsics_vec256 m02 = Lib_IntVector_Intrinsics_vec256_or(m0, m2);
+  Lib_IntVector_Intrinsics_vec256 m13 = Lib_IntVector_Intrinsics_vec256_or(m1, m3);
+  Lib_IntVector_Intrinsics_vec256
+  a24 =
+    Lib_IntVector_Intrinsics_vec256_load64s((uint64_t)0U,
+      (uint64_t)121665U,
+      (uint64_t)0U,
+      (uint64_t)0U);
+  Lib_IntVector_Intrinsics_vec256 *pu = tmp;
+  Lib_IntVector_Intrinsics_vec256 *s = tmp + (uint32_t)10U;
+  Lib_IntVector_Intrinsics_vec256 *d = tmp + (uint32_t)20U;
+  Lib_IntVector_Intrinsics_vec256 *t0 = tmp + (uint32_t)30U;
+  Lib_IntVector_Intrinsics_vec256 *t1 = tmp + (uint32_t)40U;
+  Lib_IntVector_Intrinsics_vec256 *u = tmp + (uint32_t)50U;
+  Lib_IntVector_Intrinsics_vec256 *r = tmp + (uint32_t)60U;
+  Lib_IntVector_Intrinsics_vec256 *s0 = tmp + (uint32_t)70U;
+  Lib_IntVector_Intrinsics_vec256 *s1 = tmp + (uint32_t)80U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)10U; i++)
+  {
+    pu[i] = swap_pairs(nq[i], m02);
+  }
+  fadd4(s, nq, pu);
+  fsub4(d, pu, nq);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)10U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    t =
+      Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_and(s[i], m02),
+        Lib_IntVector_Intrinsics_vec256_and(d[i], m13));
+    Lib_IntVector_Intrinsics_vec256
+    t3 = Lib_IntVector_Intrinsics_vec256_rotate_right_lanes64(t, (uint32_t)3U);
+    Lib_IntVector_Intrinsics_vec256
+    t11 = Lib_IntVector_Intrinsics_vec256_rotate_right_lanes64(t, (uint32_t)1U);
+    t0[i] = t;
+    t1[i] =
+      Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_and(t,
+          Lib_IntVector_Intrinsics_vec256_or(m0, m1)),
+        Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_and(t3, m2),
+          Lib_IntVector_Intrinsics_vec256_and(t11, m3)));
+  }
+  fmul4(u, t0, t1);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)10U; i++)
+  {
+    pu[i] = swap_pairs(u[i], m02);
+  }
+  fadd4(s, u, pu);
+  fsub4(d, pu, u);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)10U; i++)
+  {
+    t0[i] =
+      Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_and(u[i], m0),
+        Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_and(d[i], m13),
+          Lib_IntVector_Intrinsics_vec256_and(s[i], m2)));
+    t1[i] =
+      Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_and(pu[i], m0),
+        Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_and(s[i], m2),
+          Lib_IntVector_Intrinsics_vec256_and(d[i], m3)));
+  }
+  t1[0U] = Lib_IntVector_Intrinsics_vec256_or(t1[0U], a24);
+  fmul4(r, t0, t1);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)10U; i++)
+  {
+    s0[i] =
+      Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_and(r[i],
+          Lib_IntVector_Intrinsics_vec256_lognot(m1)),
+        Lib_IntVector_Intrinsics_vec256_and(t0[i], m1));
+    s1[i] =
+      Lib_IntVector_Intrinsics_vec256_or(k[i],
+        Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_add64(pu[i], r[i]),
+          m1));
+  }
+  fmul4(nq, s0, s1);
+}
+
+static inline void cswap_halves(uint64_t bit, Lib_IntVector_Intrinsics_vec256 *nq)
+{
+  Lib_IntVector_Intrinsics_vec256
+  mask = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0U - bit);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)10U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 x = nq[i];
+    Lib_IntVector_Intrinsics_vec256
+    y = Lib_IntVector_Intrinsics_vec256_rotate_right_lanes64(x, (uint32_t)2U);
+    nq[i] =
+      Lib_IntVector_Intrinsics_vec256_xor(x,
+        Lib_IntVector_Intrinsics_vec256_and(mask, Lib_IntVector_Intrinsics_vec256_xor(x, y)));
+  }
+}
+
+static void
+montgomery_ladder1(Lib_IntVector_Intrinsics_vec256 *nq, uint8_t *key, uint64_t *init)
+{
+  Lib_IntVector_Intrinsics_vec256 k[10U];
+  for (uint32_t _i = 0U; _i < (uint32_t)10U; ++_i)
+    k[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  Lib_IntVector_Intrinsics_vec256 tmp[90U];
+  for (uint32_t _i = 0U; _i < (uint32_t)90U; ++_i)
+    tmp[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  nq[0U] =
+    Lib_IntVector_Intrinsics_vec256_load64s((uint64_t)1U, (uint64_t)0U, init[0U], (uint64_t)1U);
+  k[0U] =
+    Lib_IntVector_Intrinsics_vec256_load64s((uint64_t)1U, (uint64_t)0U, (uint64_t)1U, init[0U]);
+  for (uint32_t i = (uint32_t)1U; i < (uint32_t)10U; i++)
+  {
+    nq[i] =
+      Lib_IntVector_Intrinsics_vec256_load64s((uint64_t)0U, (uint64_t)0U, init[i], (uint64_t)0U);
+    k[i] =
+      Lib_IntVector_Intrinsics_vec256_load64s((uint64_t)0U, (uint64_t)0U, (uint64_t)0U, init[i]);
+  }
+  uint64_t swap = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)255U; i++)
+  {
+    uint64_t
+    bit =
+      (uint64_t)(key[((uint32_t)254U - i)
+      / (uint32_t)8U]
+      >> ((uint32_t)254U - i) % (uint32_t)8U
+      & (uint8_t)1U);
+    uint64_t sw = swap ^ bit;
+    cswap_halves(sw, nq);
+    point_add_and_double1(nq, k, tmp);
+    swap = bit;
+  }
+  cswap_halves(swap, nq);
+}
+
+static void
+point_add_and_double4(
+  Lib_IntVector_Intrinsics_vec256 *q,
+  Lib_IntVector_Intrinsics_vec256 *p01_tmp1
+)
+{
+  Lib_IntVector_Intrinsics_vec256 *x2 = p01_tmp1;
+  Lib_IntVector_Intrinsics_vec256 *z2 = p01_tmp1 + (uint32_t)10U;
+  Lib_IntVector_Intrinsics_vec256 *x3 = p01_tmp1 + (uint32_t)20U;
+  Lib_IntVector_Intrinsics_vec256 *z3 = p01_tmp1 + (uint32_t)30U;
+  Lib_IntVector_Intrinsics_vec256 *a = p01_tmp1 + (uint32_t)40U;
+  Lib_IntVector_Intrinsics_vec256 *b = p01_tmp1 + (uint32_t)50U;
+  Lib_IntVector_Intrinsics_vec256 *c = p01_tmp1 + (uint32_t)60U;
+  Lib_IntVector_Intrinsics_vec256 *d = p01_tmp1 + (uint32_t)70U;
+  fadd4(a, x2, z2);
+  fsub4(b, x2, z2);
+  fadd4(c, x3, z3);
+  fsub4(d, x3, z3);
+  fmul4(d, d, a);
+  fmul4(c, c, b);
+  fadd4(x3, d, c);
+  fsub4(z3, d, c);
+  fsqr4(x3, x3);
+  fsqr4(z3, z3);
+  fmul4(z3, z3, q);
+  fsqr4(a, a);
+  fsqr4(b, b);
+  fmul4(x2, a, b);
+  fsub4(c, a, b);
+  fmul_a24(z2, c);
+  fadd4(z2, z2, a);
+  fmul4(z2, z2, c);
+}
+
+static void
+montgomery_ladder4(
+  Lib_IntVector_Intrinsics_vec256 *out,
+  uint8_t *key,
+  Lib_IntVector_Intrinsics_vec256 *init
+)
+{
+  Lib_IntVector_Intrinsics_vec256 p01_tmp1[80U];
+  for (uint32_t _i = 0U; _i < (uint32_t)80U; ++_i)
+    p01_tmp1[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  Lib_IntVector_Intrinsics_vec256 *nq = p01_tmp1;
+  Lib_IntVector_Intrinsics_vec256 *nq_p1 = p01_tmp1 + (uint32_t)20U;
+  nq[0U] = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)1U);
+  memcpy(nq_p1, init, (uint32_t)10U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  nq_p1[10U] = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)1U);
+  Lib_IntVector_Intrinsics_vec256 swap = Lib_IntVector_Intrinsics_vec256_zero;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)255U; i++)
+  {
+    uint32_t j = ((uint32_t)254U - i) / (uint32_t)8U;
+    uint32_t s = ((uint32_t)254U - i) % (uint32_t)8U;
+    Lib_IntVector_Intrinsics_vec256
+    bit =
+      Lib_IntVector_Intrinsics_vec256_load64s((uint64_t)(key[j] >> s & (uint8_t)1U),
+        (uint64_t)(key[(uint32_t)32U + j] >> s & (uint8_t)1U),
+        (uint64_t)(key[(uint32_t)64U + j] >> s & (uint8_t)1U),
+        (uint64_t)(key[(uint32_t)96U + j] >> s & (uint8_t)1U));
+    Lib_IntVector_Intrinsics_vec256 sw = Lib_IntVector_Intrinsics_vec256_xor(swap, bit);
+    cswap4(sw, nq, nq_p1);
+    point_add_and_double4(init, p01_tmp1);
+    swap = bit;
+  }
+  cswap4(swap, nq, nq_p1);
+  memcpy(out, nq, (uint32_t)20U * sizeof (Lib_IntVector_Intrinsics_vec256));
+}
+
+static void
+fsquare_times4(
+  Lib_IntVector_Intrinsics_vec256 *o,
+  Lib_IntVector_Intrinsics_vec256 *inp,
+  uint32_t n
+)
+{
+  fsqr4(o, inp);
+  for (uint32_t i = (uint32_t)0U; i < n - (uint32_t)1U; i++)
+  {
+    fsqr4(o, o);
+  }
+}
+
+static void finv4(Lib_IntVector_Intrinsics_vec256 *o, Lib_IntVector_Intrinsics_vec256 *i)
+{
+  Lib_IntVector_Intrinsics_vec256 t1[40U];
+  for (uint32_t _i = 0U; _i < (uint32_t)40U; ++_i)
+    t1[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  Lib_IntVector_Intrinsics_vec256 *a = t1;
+  Lib_IntVector_Intrinsics_vec256 *b = t1 + (uint32_t)10U;
+  Lib_IntVector_Intrinsics_vec256 *c = t1 + (uint32_t)20U;
+  Lib_IntVector_Intrinsics_vec256 *t0 = t1 + (uint32_t)30U;
+  fsquare_times4(a, i, (uint32_t)1U);
+  fsquare_times4(t0, a, (uint32_t)2U);
+  fmul4(b, t0, i);
+  fmul4(a, b, a);
+  fsquare_times4(t0, a, (uint32_t)1U);
+  fmul4(b, t0, b);
+  fsquare_times4(t0, b, (uint32_t)5U);
+  fmul4(b, t0, b);
+  fsquare_times4(t0, b, (uint32_t)10U);
+  fmul4(c, t0, b);
+  fsquare_times4(t0, c, (uint32_t)20U);
+  fmul4(t0, t0, c);
+  fsquare_times4(t0, t0, (uint32_t)10U);
+  fmul4(b, t0, b);
+  fsquare_times4(t0, b, (uint32_t)50U);
+  fmul4(c, t0, b);
+  fsquare_times4(t0, c, (uint32_t)100U);
+  fmul4(t0, t0, c);
+  fsquare_times4(t0, t0, (uint32_t)50U);
+  fmul4(t0, t0, b);
+  fsquare_times4(t0, t0, (uint32_t)5U);
+  fmul4(o, t0, a);
+}
+
+static void decode_scalar(uint8_t *k, uint8_t *priv)
+{
+  memcpy(k, priv, (uint32_t)32U * sizeof (uint8_t));
+  k[0U] = k[0U] & (uint8_t)248U;
+  k[31U] = (k[31U] & (uint8_t)127U) | (uint8_t)64U;
+}
+
+void Hacl_Curve25519_256_scalarmult(uint8_t *out, uint8_t *priv, uint8_t *pub)
+{
+  Lib_IntVector_Intrinsics_vec256 nq[10U];
+  for (uint32_t _i = 0U; _i < (uint32_t)10U; ++_i)
+    nq[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  uint8_t k[32U] = { 0U };
+  uint64_t init[10U] = { 0U };
+  uint64_t x[5U] = { 0U };
+  uint64_t z[5U] = { 0U };
+  decode_scalar(k, priv);
+  load_felem10(init, pub);
+  montgomery_ladder1(nq, k, init);
+  lanes_of_felem4(x, (uint32_t)0U, nq);
+  lanes_of_felem4(z, (uint32_t)1U, nq);
+  encode_point1(out, x, z);
+}
+
+void Hacl_Curve25519_256_secret_to_public(uint8_t *pub, uint8_t *priv)
+{
+  uint8_t basepoint[32U] = { 0U };
+  basepoint[0U] = (uint8_t)9U;
+  Hacl_Curve25519_256_scalarmult(pub, priv, basepoint);
+}
+
+bool Hacl_Curve25519_256_ecdh(uint8_t *out, uint8_t *priv, uint8_t *pub)
+{
+  uint8_t zeros[32U] = { 0U };
+  Hacl_Curve25519_256_scalarmult(out, priv, pub);
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(out[i], zeros[i]);
+    res = uu____0 & res;
+  }
+  uint8_t z = res;
+  bool r = z == (uint8_t)255U;
+  return !r;
+}
+
+void Hacl_Curve25519_256_scalarmult4(uint8_t *out, uint8_t *priv, uint8_t *pub)
+{
+  Lib_IntVector_Intrinsics_vec256 init[10U];
+  for (uint32_t _i = 0U; _i < (uint32_t)10U; ++_i)
+    init[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  Lib_IntVector_Intrinsics_vec256 nq[20U];
+  for (uint32_t _i = 0U; _i < (uint32_t)20U; ++_i)
+    nq[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  Lib_IntVector_Intrinsics_vec256 zinv[10U];
+  for (uint32_t _i = 0U; _i < (uint32_t)10U; ++_i)
+    zinv[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  uint8_t k[128U] = { 0U };
+  uint64_t f[40U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    decode_scalar(k + i * (uint32_t)32U, priv + i * (uint32_t)32U);
+    load_felem10(f + i * (uint32_t)10U, pub + i * (uint32_t)32U);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)10U; i++)
+  {
+    init[i] =
+      Lib_IntVector_Intrinsics_vec256_load64s(f[i],
+        f[(uint32_t)10U + i],
+        f[(uint32_t)20U + i],
+        f[(uint32_t)30U + i]);
+  }
+  montgomery_ladder4(nq, k, init);
+  finv4(zinv, nq + (uint32_t)10U);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint64_t x[5U] = { 0U };
+    uint64_t z[5U] = { 0U };
+    uint64_t u64s[4U] = { 0U };
+    FStar_UInt128_uint128 tmp_w[10U];
+    for (uint32_t _i = 0U; _i < (uint32_t)10U; ++_i)
+      tmp_w[_i] = FStar_UInt128_uint64_to_uint128((uint64_t)0U);
+    lanes_of_felem4(x, i, nq);
+    lanes_of_felem4(z, i, zinv);
+    Hacl_Impl_Curve25519_Field51_fmul(x, x, z, tmp_w);
+    Hacl_Impl_Curve25519_Field51_store_felem(u64s, x);
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+    {
+      store64_le(out + i * (uint32_t)32U + j * (uint32_t)8U, u64s[j]);
+    }
+  }
+}
+
+void Hacl_Curve25519_256_secret_to_public4(uint8_t *pub, uint8_t *priv)
+{
+  uint8_t basepoint[128U] = { 0U };
+  basepoint[0U] = (uint8_t)9U;
+  basepoint[32U] = (uint8_t)9U;
+  basepoint[64U] = (uint8_t)9U;
+  basepoint[96U] = (uint8_t)9U;
+  Hacl_Curve25519_256_scalarmult4(pub, priv, basepoint);
+}
+
+void Hacl_Curve25519_256_ecdh4(bool *res, uint8_t *out, uint8_t *priv, uint8_t *pub)
+{
+  Hacl_Curve25519_256_scalarmult4(out, priv, pub);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint8_t z = (uint8_t)255U;
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)32U; j++)
+    {
+      uint8_t uu____0 = FStar_UInt8_eq_mask(out[i * (uint32_t)32U + j], (uint8_t)0U);
+      z = uu____0 & z;
+    }
+    res[i] = !(z == (uint8_t)255U);
+  }
+}
@@ -577,7 +577,7 @@ static inline void fsqr20(uint64_t *out, uint64_t *f)
   out[9U] = o24;
 }
 
-static void store_felem(uint64_t *u64s, uint64_t *f)
+void Hacl_Impl_Curve25519_Field51_store_felem(uint64_t *u64s, uint64_t *f)
 {
   uint64_t f0 = f[0U];
   uint64_t f1 = f[1U];
@@ -843,7 +843,7 @@ static void encode_point(uint8_t *o, uint64_t *i)
     tmp_w[_i] = FStar_UInt128_uint64_to_uint128((uint64_t)0U);
   Hacl_Curve25519_51_finv(tmp, z, tmp_w);
   Hacl_Impl_Curve25519_Field51_fmul(tmp, tmp, x, tmp_w);
-  store_felem(u64s, tmp);
+  Hacl_Impl_Curve25519_Field51_store_felem(u64s, tmp);
   for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)4U; i0++)
   {
     store64_le(o + i0 * (uint32_t)8U, u64s[i0]);
@@ -383,3 +383,230 @@ bool Hacl_Curve25519_64_ecdh(uint8_t *out, uint8_t *priv, uint8_t *pub)
   return !r;
 }
 
+static void
+point_add_and_double2(
+  uint64_t *q0,
+  uint64_t *p01_tmp10,
+  uint64_t *q1,
+  uint64_t *p01_tmp11,
+  uint64_t *tmp2
+)
+{
+  uint64_t *tmp20 = tmp2;
+  uint64_t *tmp21 = tmp2 + (uint32_t)16U;
+  uint64_t *nq0 = p01_tmp10;
+  uint64_t *nq_p10 = p01_tmp10 + (uint32_t)8U;
+  uint64_t *tmp100 = p01_tmp10 + (uint32_t)16U;
+  uint64_t *nq1 = p01_tmp11;
+  uint64_t *nq_p11 = p01_tmp11 + (uint32_t)8U;
+  uint64_t *tmp101 = p01_tmp11 + (uint32_t)16U;
+  fadd0(tmp100, nq0, nq0 + (uint32_t)4U);
+  fadd0(tmp101, nq1, nq1 + (uint32_t)4U);
+  fsub0(tmp100 + (uint32_t)4U, nq0, nq0 + (uint32_t)4U);
+  fsub0(tmp101 + (uint32_t)4U, nq1, nq1 + (uint32_t)4U);
+  fadd0(tmp100 + (uint32_t)12U, nq_p10, nq_p10 + (uint32_t)4U);
+  fadd0(tmp101 + (uint32_t)12U, nq_p11, nq_p11 + (uint32_t)4U);
+  fsub0(tmp100 + (uint32_t)8U, nq_p10, nq_p10 + (uint32_t)4U);
+  fsub0(tmp101 + (uint32_t)8U, nq_p11, nq_p11 + (uint32_t)4U);
+  fmul20(tmp100 + (uint32_t)8U, tmp100 + (uint32_t)8U, tmp100, tmp20);
+  fmul20(tmp101 + (uint32_t)8U, tmp101 + (uint32_t)8U, tmp101, tmp21);
+  fadd0(nq_p10, tmp100 + (uint32_t)8U, tmp100 + (uint32_t)12U);
+  fadd0(nq_p11, tmp101 + (uint32_t)8U, tmp101 + (uint32_t)12U);
+  fsub0(nq_p10 + (uint32_t)4U, tmp100 + (uint32_t)8U, tmp100 + (uint32_t)12U);
+  fsub0(nq_p11 + (uint32_t)4U, tmp101 + (uint32_t)8U, tmp101 + (uint32_t)12U);
+  fsqr20(tmp100 + (uint32_t)8U, tmp100, tmp20);
+  fsqr20(tmp101 + (uint32_t)8U, tmp101, tmp21);
+  fsqr20(nq_p10, nq_p10, tmp20);
+  fsqr20(nq_p11, nq_p11, tmp21);
+  memcpy(tmp100, tmp100 + (uint32_t)12U, (uint32_t)4U * sizeof (uint64_t));
+  memcpy(tmp101, tmp101 + (uint32_t)12U, (uint32_t)4U * sizeof (uint64_t));
+  fsub0(tmp100 + (uint32_t)12U, tmp100 + (uint32_t)8U, tmp100 + (uint32_t)12U);
+  fsub0(tmp101 + (uint32_t)12U, tmp101 + (uint32_t)8U, tmp101 + (uint32_t)12U);
+  fmul_scalar0(tmp100 + (uint32_t)4U, tmp100 + (uint32_t)12U, (uint64_t)121665U);
+  fmul_scalar0(tmp101 + (uint32_t)4U, tmp101 + (uint32_t)12U, (uint64_t)121665U);
+  fadd0(tmp100 + (uint32_t)4U, tmp100 + (uint32_t)4U, tmp100 + (uint32_t)8U);
+  fadd0(tmp101 + (uint32_t)4U, tmp101 + (uint32_t)4U, tmp101 + (uint32_t)8U);
+  fmul20(nq0, tmp100 + (uint32_t)8U, tmp100, tmp20);
+  fmul20(nq1, tmp101 + (uint32_t)8U, tmp101, tmp21);
+  fmul0(nq_p10 + (uint32_t)4U, nq_p10 + (uint32_t)4U, q0, tmp20);
+  fmul0(nq_p11 + (uint32_t)4U, nq_p11 + (uint32_t)4U, q1, tmp21);
+}
+
+static void
+montgomery_ladder2(
+  uint64_t *out0,
+  uint64_t *out1,
+  uint8_t *key0,
+  uint8_t *key1,
+  uint64_t *init0,
+  uint64_t *init1
+)
+{
+  uint64_t tmp2[32U] = { 0U };
+  uint64_t p01_tmp1_swap0[33U] = { 0U };
+  uint64_t p01_tmp1_swap1[33U] = { 0U };
+  uint64_t *nq0 = p01_tmp1_swap0;
+  uint64_t *nq_p10 = p01_tmp1_swap0 + (uint32_t)8U;
+  uint64_t *swap0 = p01_tmp1_swap0 + (uint32_t)32U;
+  uint64_t *nq1 = p01_tmp1_swap1;
+  uint64_t *nq_p11 = p01_tmp1_swap1 + (uint32_t)8U;
+  uint64_t *swap1 = p01_tmp1_swap1 + (uint32_t)32U;
+  memcpy(nq_p10, init0, (uint32_t)8U * sizeof (uint64_t));
+  memcpy(nq_p11, init1, (uint32_t)8U * sizeof (uint64_t));
+  nq0[0U] = (uint64_t)1U;
+  nq1[0U] = (uint64_t)1U;
+  cswap20((uint64_t)1U, nq0, nq_p10);
+  cswap20((uint64_t)1U, nq1, nq_p11);
+  point_add_and_double2(init0, p01_tmp1_swap0, init1, p01_tmp1_swap1, tmp2);
+  swap0[0U] = (uint64_t)1U;
+  swap1[0U] = (uint64_t)1U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)251U; i++)
+  {
+    uint32_t j = ((uint32_t)253U - i) / (uint32_t)8U;
+    uint32_t s = ((uint32_t)253U - i) % (uint32_t)8U;
+    uint64_t bit0 = (uint64_t)(key0[j] >> s & (uint8_t)1U);
+    uint64_t bit1 = (uint64_t)(key1[j] >> s & (uint8_t)1U);
+    cswap20(swap0[0U] ^ bit0, nq0, nq_p10);
+    cswap20(swap1[0U] ^ bit1, nq1, nq_p11);
+    point_add_and_double2(init0, p01_tmp1_swap0, init1, p01_tmp1_swap1, tmp2);
+    swap0[0U] = bit0;
+    swap1[0U] = bit1;
+  }
+  cswap20(swap0[0U], nq0, nq_p10);
+  cswap20(swap1[0U], nq1, nq_p11);
+  point_double(nq0, p01_tmp1_swap0 + (uint32_t)16U, tmp2);
+  point_double(nq1, p01_tmp1_swap1 + (uint32_t)16U, tmp2 + (uint32_t)16U);
+  point_double(nq0, p01_tmp1_swap0 + (uint32_t)16U, tmp2);
+  point_double(nq1, p01_tmp1_swap1 + (uint32_t)16U, tmp2 + (uint32_t)16U);
+  point_double(nq0, p01_tmp1_swap0 + (uint32_t)16U, tmp2);
+  point_double(nq1, p01_tmp1_swap1 + (uint32_t)16U, tmp2 + (uint32_t)16U);
+  memcpy(out0, nq0, (uint32_t)8U * sizeof (uint64_t));
+  memcpy(out1, nq1, (uint32_t)8U * sizeof (uint64_t));
+}
+
+static void decode_point(uint64_t *o, uint8_t *i)
+{
+  uint64_t *x = o;
+  uint64_t *z = o + (uint32_t)4U;
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)4U; i0++)
+  {
+    x[i0] = load64_le(i + i0 * (uint32_t)8U);
+  }
+  x[3U] = x[3U] & (uint64_t)0x7fffffffffffffffU;
+  z[0U] = (uint64_t)1U;
+  z[1U] = (uint64_t)0U;
+  z[2U] = (uint64_t)0U;
+  z[3U] = (uint64_t)0U;
+}
+
+static void fix_zero_z(uint64_t *p)
+{
+  uint64_t *x = p;
+  uint64_t *z = p + (uint32_t)4U;
+  uint64_t tmp[4U] = { 0U };
+  uint64_t zc[4U] = { 0U };
+  memcpy(tmp, z, (uint32_t)4U * sizeof (uint64_t));
+  store_felem(zc, tmp);
+  uint64_t mask = FStar_UInt64_eq_mask(zc[0U] | zc[1U] | zc[2U] | zc[3U], (uint64_t)0U);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    x[i] = x[i] & ~mask;
+    z[i] = z[i] & ~mask;
+  }
+  z[0U] = z[0U] | (mask & (uint64_t)1U);
+}
+
+static void scalarmult_batch_chunk(uint32_t n, uint8_t *out, uint8_t *priv, uint8_t *pub)
+{
+  uint64_t p[256U] = { 0U };
+  uint64_t acc[128U] = { 0U };
+  uint64_t inv[4U] = { 0U };
+  uint64_t tmp[4U] = { 0U };
+  uint64_t u64s[4U] = { 0U };
+  uint64_t tmp_w[16U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    decode_point(p + i * (uint32_t)8U, pub + i * (uint32_t)32U);
+  }
+  for (uint32_t i = (uint32_t)0U; i < n / (uint32_t)2U; i++)
+  {
+    uint32_t i0 = (uint32_t)2U * i;
+    montgomery_ladder2(p + i0 * (uint32_t)8U,
+      p + (i0 + (uint32_t)1U) * (uint32_t)8U,
+      priv + i0 * (uint32_t)32U,
+      priv + (i0 + (uint32_t)1U) * (uint32_t)32U,
+      p + i0 * (uint32_t)8U,
+      p + (i0 + (uint32_t)1U) * (uint32_t)8U);
+  }
+  if (n % (uint32_t)2U == (uint32_t)1U)
+  {
+    uint64_t *pl = p + (n - (uint32_t)1U) * (uint32_t)8U;
+    montgomery_ladder(pl, priv + (n - (uint32_t)1U) * (uint32_t)32U, pl);
+  }
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    fix_zero_z(p + i * (uint32_t)8U);
+  }
+  memcpy(acc, p + (uint32_t)4U, (uint32_t)4U * sizeof (uint64_t));
+  for (uint32_t i = (uint32_t)1U; i < n; i++)
+  {
+    fmul0(acc + i * (uint32_t)4U,
+      acc + (i - (uint32_t)1U) * (uint32_t)4U,
+      p + i * (uint32_t)8U + (uint32_t)4U,
+      tmp_w);
+  }
+  finv(inv, acc + (n - (uint32_t)1U) * (uint32_t)4U, tmp_w);
+  for (uint32_t i0 = (uint32_t)0U; i0 < n; i0++)
+  {
+    uint32_t i = n - (uint32_t)1U - i0;
+    uint64_t *x = p + i * (uint32_t)8U;
+    uint64_t *z = p + i * (uint32_t)8U + (uint32_t)4U;
+    if (i == (uint32_t)0U)
+    {
+      memcpy(tmp, inv, (uint32_t)4U * sizeof (uint64_t));
+    }
+    else
+    {
+      fmul0(tmp, inv, acc + (i - (uint32_t)1U) * (uint32_t)4U, tmp_w);
+      fmul0(inv, inv, z, tmp_w);
+    }
+    fmul0(tmp, tmp, x, tmp_w);
+    store_felem(u64s, tmp);
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+    {
+      store64_le(out + i * (uint32_t)32U + j * (uint32_t)8U, u64s[j]);
+    }
+  }
+}
+
+void Hacl_Curve25519_64_scalarmult_batch(uint32_t n, uint8_t *out, uint8_t *priv, uint8_t *pub)
+{
+  for (uint32_t i = (uint32_t)0U; i < n / (uint32_t)32U; i++)
+  {
+    scalarmult_batch_chunk((uint32_t)32U,
+      out + i * (uint32_t)1024U,
+      priv + i * (uint32_t)1024U,
+      pub + i * (uint32_t)1024U);
+  }
+  uint32_t rem = n % (uint32_t)32U;
+  if (rem > (uint32_t)0U)
+  {
+    uint32_t off = n / (uint32_t)32U * (uint32_t)1024U;
+    scalarmult_batch_chunk(rem, out + off, priv + off, pub + off);
+  }
+}
+
+void Hacl_Curve25519_64_ecdh_batch(uint32_t n, bool *res, uint8_t *out, uint8_t *priv, uint8_t *pub)
+{
+  Hacl_Curve25519_64_scalarmult_batch(n, out, priv, pub);
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    uint8_t z = (uint8_t)255U;
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)32U; j++)
+    {
+      uint8_t uu____0 = FStar_UInt8_eq_mask(out[i * (uint32_t)32U + j], (uint8_t)0U);
+      z = uu____0 & z;
+    }
+    res[i] = !(z == (uint8_t)255U);
+  }
+}
@@ -47,6 +47,11 @@ void Hacl_Curve25519_64_secret_to_public(uint8_t *pub, uint8_t *priv);
 
 bool Hacl_Curve25519_64_ecdh(uint8_t *out, uint8_t *priv, uint8_t *pub);
 
+void Hacl_Curve25519_64_scalarmult_batch(uint32_t n, uint8_t *out, uint8_t *priv, uint8_t *pub);
+
+void
+Hacl_Curve25519_64_ecdh_batch(uint32_t n, bool *res, uint8_t *out, uint8_t *priv, uint8_t *pub);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -393,6 +393,34 @@ static void point_double(uint64_t *out, uint64_t *p)
   fmul0(z3, tmp4, tmp2);
 }
 
+void Hacl_Impl_Ed25519_Ladder_make_g(uint64_t *g)
+{
+  uint64_t *gx = g;
+  uint64_t *gy = g + (uint32_t)5U;
+  uint64_t *gz = g + (uint32_t)10U;
+  uint64_t *gt = g + (uint32_t)15U;
+  gx[0U] = (uint64_t)0x00062d608f25d51aU;
+  gx[1U] = (uint64_t)0x000412a4b4f6592aU;
+  gx[2U] = (uint64_t)0x00075b7171a4b31dU;
+  gx[3U] = (uint64_t)0x0001ff60527118feU;
+  gx[4U] = (uint64_t)0x000216936d3cd6e5U;
+  gy[0U] = (uint64_t)0x0006666666666658U;
+  gy[1U] = (uint64_t)0x0004ccccccccccccU;
+  gy[2U] = (uint64_t)0x0001999999999999U;
+  gy[3U] = (uint64_t)0x0003333333333333U;
+  gy[4U] = (uint64_t)0x0006666666666666U;
+  gz[0U] = (uint64_t)1U;
+  gz[1U] = (uint64_t)0U;
+  gz[2U] = (uint64_t)0U;
+  gz[3U] = (uint64_t)0U;
+  gz[4U] = (uint64_t)0U;
+  gt[0U] = (uint64_t)0x00068ab3a5b7dda3U;
+  gt[1U] = (uint64_t)0x00000eea2a5eadbbU;
+  gt[2U] = (uint64_t)0x0002af8df483c27eU;
+  gt[3U] = (uint64_t)0x000332b375274732U;
+  gt[4U] = (uint64_t)0x00067875f0fd78b7U;
+}
+
 static void
 swap_conditional_step(uint64_t *a_, uint64_t *b_, uint64_t *a, uint64_t *b, uint64_t swap)
 {
@@ -514,34 +542,119 @@ void Hacl_Impl_Ed25519_Ladder_point_mul(uint64_t *result, uint8_t *scalar, uint6
   memcpy(result, nq, (uint32_t)20U * sizeof (uint64_t));
 }
 
+static void precomp_lookup(uint64_t *r, uint32_t k, int8_t b)
+{
+  uint64_t tmp[30U] = { 0U };
+  uint64_t *x = tmp;
+  uint64_t *y = tmp + (uint32_t)5U;
+  uint64_t *t = tmp + (uint32_t)10U;
+  uint64_t *nx = tmp + (uint32_t)15U;
+  uint64_t *nt = tmp + (uint32_t)20U;
+  uint64_t *zero = tmp + (uint32_t)25U;
+  uint8_t bnegative = (uint8_t)b >> (uint32_t)7U;
+  uint8_t babs = (uint8_t)b - ((((uint8_t)0U - bnegative) & (uint8_t)b) << (uint32_t)1U);
+  y[0U] = (uint64_t)1U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint64_t mask = FStar_UInt64_eq_mask((uint64_t)babs, (uint64_t)(i + (uint32_t)1U));
+    const
+    uint64_t
+    *e =
+      Hacl_Ed25519_PrecompTable_precomp_basepoint_table
+      + ((uint32_t)8U * k + i) * (uint32_t)15U;
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)15U; j++)
+    {
+      uint64_t *os = tmp;
+      uint64_t x1 = tmp[j] ^ (mask & (tmp[j] ^ e[j]));
+      os[j] = x1;
+    }
+  }
+  memcpy(nx, x, (uint32_t)5U * sizeof (uint64_t));
+  memcpy(nt, t, (uint32_t)5U * sizeof (uint64_t));
+  Hacl_Bignum25519_fdifference(nx, zero);
+  Hacl_Bignum25519_fdifference(nt, zero);
+  Hacl_Bignum25519_reduce_513(nx);
+  Hacl_Bignum25519_reduce_513(nt);
+  uint64_t mask = (uint64_t)0U - (uint64_t)bnegative;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+  {
+    uint64_t *os = x;
+    uint64_t x1 = x[i] ^ (mask & (x[i] ^ nx[i]));
+    os[i] = x1;
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+  {
+    uint64_t *os = t;
+    uint64_t x1 = t[i] ^ (mask & (t[i] ^ nt[i]));
+    os[i] = x1;
+  }
+  uint64_t *rz = r + (uint32_t)10U;
+  memcpy(r, x, (uint32_t)5U * sizeof (uint64_t));
+  memcpy(r + (uint32_t)5U, y, (uint32_t)5U * sizeof (uint64_t));
+  rz[0U] = (uint64_t)1U;
+  rz[1U] = (uint64_t)0U;
+  rz[2U] = (uint64_t)0U;
+  rz[3U] = (uint64_t)0U;
+  rz[4U] = (uint64_t)0U;
+  memcpy(r + (uint32_t)15U, t, (uint32_t)5U * sizeof (uint64_t));
+}
+
 static void point_mul_g(uint64_t *result, uint8_t *scalar)
 {
-  uint64_t g[20U] = { 0U };
-  uint64_t *gx = g;
-  uint64_t *gy = g + (uint32_t)5U;
-  uint64_t *gz = g + (uint32_t)10U;
-  uint64_t *gt = g + (uint32_t)15U;
-  gx[0U] = (uint64_t)0x00062d608f25d51aU;
-  gx[1U] = (uint64_t)0x000412a4b4f6592aU;
-  gx[2U] = (uint64_t)0x00075b7171a4b31dU;
-  gx[3U] = (uint64_t)0x0001ff60527118feU;
-  gx[4U] = (uint64_t)0x000216936d3cd6e5U;
-  gy[0U] = (uint64_t)0x0006666666666658U;
-  gy[1U] = (uint64_t)0x0004ccccccccccccU;
-  gy[2U] = (uint64_t)0x0001999999999999U;
-  gy[3U] = (uint64_t)0x0003333333333333U;
-  gy[4U] = (uint64_t)0x0006666666666666U;
-  gz[0U] = (uint64_t)1U;
-  gz[1U] = (uint64_t)0U;
-  gz[2U] = (uint64_t)0U;
-  gz[3U] = (uint64_t)0U;
-  gz[4U] = (uint64_t)0U;
-  gt[0U] = (uint64_t)0x00068ab3a5b7dda3U;
-  gt[1U] = (uint64_t)0x00000eea2a5eadbbU;
-  gt[2U] = (uint64_t)0x0002af8df483c27eU;
-  gt[3U] = (uint64_t)0x000332b375274732U;
-  gt[4U] = (uint64_t)0x00067875f0fd78b7U;
-  Hacl_Impl_Ed25519_Ladder_point_mul(result, scalar, g);
+  int8_t e[64U] = { 0U };
+  uint64_t tmp[20U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    uint8_t si = scalar[i];
+    e[(uint32_t)2U * i] = (int8_t)(si & (uint8_t)15U);
+    e[(uint32_t)2U * i + (uint32_t)1U] = (int8_t)(si >> (uint32_t)4U & (uint8_t)15U);
+  }
+  int8_t carry = (int8_t)0;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)63U; i++)
+  {
+    int8_t ei = e[i] + carry;
+    carry = (ei + (int8_t)8) >> (uint32_t)4U;
+    e[i] = ei - carry * (int8_t)16;
+  }
+  e[63U] = e[63U] + carry;
+  uint64_t *x = result;
+  uint64_t *y = result + (uint32_t)5U;
+  uint64_t *z = result + (uint32_t)10U;
+  uint64_t *t = result + (uint32_t)15U;
+  x[0U] = (uint64_t)0U;
+  x[1U] = (uint64_t)0U;
+  x[2U] = (uint64_t)0U;
+  x[3U] = (uint64_t)0U;
+  x[4U] = (uint64_t)0U;
+  y[0U] = (uint64_t)1U;
+  y[1U] = (uint64_t)0U;
+  y[2U] = (uint64_t)0U;
+  y[3U] = (uint64_t)0U;
+  y[4U] = (uint64_t)0U;
+  z[0U] = (uint64_t)1U;
+  z[1U] = (uint64_t)0U;
+  z[2U] = (uint64_t)0U;
+  z[3U] = (uint64_t)0U;
+  z[4U] = (uint64_t)0U;
+  t[0U] = (uint64_t)0U;
+  t[1U] = (uint64_t)0U;
+  t[2U] = (uint64_t)0U;
+  t[3U] = (uint64_t)0U;
+  t[4U] = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    precomp_lookup(tmp, i, e[(uint32_t)2U * i + (uint32_t)1U]);
+    Hacl_Impl_Ed25519_PointAdd_point_add(result, result, tmp);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    point_double(result, result);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    precomp_lookup(tmp, i, e[(uint32_t)2U * i]);
+    Hacl_Impl_Ed25519_PointAdd_point_add(result, result, tmp);
+  }
 }
 
 void Hacl_Impl_Ed25519_PointCompress_point_compress(uint8_t *z, uint64_t *p)
@@ -2014,6 +2127,507 @@ bool Hacl_Impl_Ed25519_PointEqual_point_equal(uint64_t *p, uint64_t *q)
   return false;
 }
 
+static uint32_t get_window(uint8_t *k, uint32_t bit, uint32_t w)
+{
+  uint32_t q = bit >> (uint32_t)3U;
+  uint32_t r = bit & (uint32_t)7U;
+  uint32_t lo = (uint32_t)k[q];
+  uint32_t hi;
+  if (q + (uint32_t)1U < (uint32_t)32U)
+  {
+    hi = (uint32_t)k[q + (uint32_t)1U];
+  }
+  else
+  {
+    hi = (uint32_t)0U;
+  }
+  return (lo | hi << (uint32_t)8U) >> r & (((uint32_t)1U << w) - (uint32_t)1U);
+}
+
+static void point_add_or_copy(uint64_t *acc, bool *used, uint64_t *p)
+{
+  if (used[0U])
+  {
+    Hacl_Impl_Ed25519_PointAdd_point_add(acc, acc, p);
+  }
+  else
+  {
+    memcpy(acc, p, (uint32_t)20U * sizeof (uint64_t));
+    used[0U] = true;
+  }
+}
+
+static void
+point_mul_multi_vartime(uint64_t *out, uint32_t n, uint8_t *scalars, uint64_t *points)
+{
+  uint64_t buckets[620U] = { 0U };
+  uint64_t tmp[40U] = { 0U };
+  bool used[33U] = { 0U };
+  bool started[1U] = { 0U };
+  uint64_t *sum = tmp;
+  uint64_t *acc = tmp + (uint32_t)20U;
+  bool *sum_used = used + (uint32_t)31U;
+  bool *acc_used = used + (uint32_t)32U;
+  uint32_t w;
+  if (n < (uint32_t)32U)
+  {
+    w = (uint32_t)4U;
+  }
+  else
+  {
+    w = (uint32_t)5U;
+  }
+  uint32_t nb = ((uint32_t)1U << w) - (uint32_t)1U;
+  uint32_t nw = ((uint32_t)253U + w - (uint32_t)1U) / w;
+  uint64_t *x = out;
+  uint64_t *y = out + (uint32_t)5U;
+  uint64_t *z = out + (uint32_t)10U;
+  uint64_t *t = out + (uint32_t)15U;
+  x[0U] = (uint64_t)0U;
+  x[1U] = (uint64_t)0U;
+  x[2U] = (uint64_t)0U;
+  x[3U] = (uint64_t)0U;
+  x[4U] = (uint64_t)0U;
+  y[0U] = (uint64_t)1U;
+  y[1U] = (uint64_t)0U;
+  y[2U] = (uint64_t)0U;
+  y[3U] = (uint64_t)0U;
+  y[4U] = (uint64_t)0U;
+  z[0U] = (uint64_t)1U;
+  z[1U] = (uint64_t)0U;
+  z[2U] = (uint64_t)0U;
+  z[3U] = (uint64_t)0U;
+  z[4U] = (uint64_t)0U;
+  t[0U] = (uint64_t)0U;
+  t[1U] = (uint64_t)0U;
+  t[2U] = (uint64_t)0U;
+  t[3U] = (uint64_t)0U;
+  t[4U] = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < nw; i++)
+  {
+    uint32_t bit = (nw - i - (uint32_t)1U) * w;
+    if (started[0U])
+    {
+      for (uint32_t j = (uint32_t)0U; j < w; j++)
+      {
+        point_double(out, out);
+      }
+    }
+    memset(used, 0U, (uint32_t)33U * sizeof (bool));
+    for (uint32_t j = (uint32_t)0U; j < n; j++)
+    {
+      uint32_t d = get_window(scalars + (uint32_t)32U * j, bit, w);
+      if (d != (uint32_t)0U)
+      {
+        uint32_t b = d - (uint32_t)1U;
+        point_add_or_copy(buckets + (uint32_t)20U * b, used + b, points + (uint32_t)20U * j);
+      }
+    }
+    for (uint32_t j = (uint32_t)0U; j < nb; j++)
+    {
+      uint32_t b = nb - j - (uint32_t)1U;
+      if (used[b])
+      {
+        point_add_or_copy(sum, sum_used, buckets + (uint32_t)20U * b);
+      }
+      if (sum_used[0U])
+      {
+        point_add_or_copy(acc, acc_used, sum);
+      }
+    }
+    if (acc_used[0U])
+    {
+      point_add_or_copy(out, started, acc);
+    }
+  }
+}
+
+static void point_negate(uint64_t *out, uint64_t *p)
+{
+  uint64_t zero[5U] = { 0U };
+  memcpy(out, p, (uint32_t)5U * sizeof (uint64_t));
+  memcpy(out + (uint32_t)5U, p + (uint32_t)5U, (uint32_t)5U * sizeof (uint64_t));
+  memcpy(out + (uint32_t)10U, p + (uint32_t)10U, (uint32_t)5U * sizeof (uint64_t));
+  memcpy(out + (uint32_t)15U, p + (uint32_t)15U, (uint32_t)5U * sizeof (uint64_t));
+  Hacl_Bignum25519_fdifference(out, zero);
+  Hacl_Bignum25519_fdifference(out + (uint32_t)15U, zero);
+  Hacl_Bignum25519_reduce_513(out);
+  Hacl_Bignum25519_reduce_513(out + (uint32_t)15U);
+}
+
+static void wnaf(int8_t *r, uint8_t *k)
+{
+  uint32_t state[2U] = { 0U };
+  uint32_t *carry = state;
+  uint32_t *next = state + (uint32_t)1U;
+  memset(r, 0U, (uint32_t)257U * sizeof (int8_t));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
+  {
+    if (i == next[0U])
+    {
+      uint32_t window = carry[0U] + get_window(k, i, (uint32_t)5U);
+      if ((window & (uint32_t)1U) == (uint32_t)0U)
+      {
+        next[0U] = i + (uint32_t)1U;
+      }
+      else
+      {
+        if (window < (uint32_t)16U)
+        {
+          carry[0U] = (uint32_t)0U;
+          r[i] = (int8_t)(uint8_t)window;
+        }
+        else
+        {
+          carry[0U] = (uint32_t)1U;
+          r[i] = (int8_t)(uint8_t)window - (int8_t)32;
+        }
+        next[0U] = i + (uint32_t)5U;
+      }
+    }
+  }
+  r[256U] = (int8_t)(uint8_t)carry[0U];
+}
+
+static void precomp_odd(uint64_t *table, uint64_t *p)
+{
+  uint64_t p2[20U] = { 0U };
+  point_double(p2, p);
+  memcpy(table, p, (uint32_t)20U * sizeof (uint64_t));
+  for (uint32_t i = (uint32_t)1U; i < (uint32_t)8U; i++)
+  {
+    Hacl_Impl_Ed25519_PointAdd_point_add(table + (uint32_t)20U * i,
+      table + (uint32_t)20U * i - (uint32_t)20U,
+      p2);
+  }
+}
+
+static void
+point_mul_double_vartime(
+  uint64_t *out,
+  uint8_t *k1,
+  uint64_t *p1,
+  uint8_t *k2,
+  uint64_t *p2
+)
+{
+  int8_t r1[257U] = { 0U };
+  int8_t r2[257U] = { 0U };
+  uint64_t table1[160U] = { 0U };
+  uint64_t table2[160U] = { 0U };
+  uint64_t tmp[20U] = { 0U };
+  wnaf(r1, k1);
+  wnaf(r2, k2);
+  precomp_odd(table1, p1);
+  precomp_odd(table2, p2);
+  uint64_t *x = out;
+  uint64_t *y = out + (uint32_t)5U;
+  uint64_t *z = out + (uint32_t)10U;
+  uint64_t *t = out + (uint32_t)15U;
+  x[0U] = (uint64_t)0U;
+  x[1U] = (uint64_t)0U;
+  x[2U] = (uint64_t)0U;
+  x[3U] = (uint64_t)0U;
+  x[4U] = (uint64_t)0U;
+  y[0U] = (uint64_t)1U;
+  y[1U] = (uint64_t)0U;
+  y[2U] = (uint64_t)0U;
+  y[3U] = (uint64_t)0U;
+  y[4U] = (uint64_t)0U;
+  z[0U] = (uint64_t)1U;
+  z[1U] = (uint64_t)0U;
+  z[2U] = (uint64_t)0U;
+  z[3U] = (uint64_t)0U;
+  z[4U] = (uint64_t)0U;
+  t[0U] = (uint64_t)0U;
+  t[1U] = (uint64_t)0U;
+  t[2U] = (uint64_t)0U;
+  t[3U] = (uint64_t)0U;
+  t[4U] = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)257U; i++)
+  {
+    uint32_t j = (uint32_t)257U - i - (uint32_t)1U;
+    point_double(out, out);
+    int8_t d = r1[j];
+    if (d > (int8_t)0)
+    {
+      uint32_t j1 = (uint32_t)((d - (int8_t)1) / (int8_t)2);
+      Hacl_Impl_Ed25519_PointAdd_point_add(out, out, table1 + (uint32_t)20U * j1);
+    }
+    else if (d < (int8_t)0)
+    {
+      uint32_t j1 = (uint32_t)(((int8_t)0 - d - (int8_t)1) / (int8_t)2);
+      point_negate(tmp, table1 + (uint32_t)20U * j1);
+      Hacl_Impl_Ed25519_PointAdd_point_add(out, out, tmp);
+    }
+    int8_t d0 = r2[j];
+    if (d0 > (int8_t)0)
+    {
+      uint32_t j1 = (uint32_t)((d0 - (int8_t)1) / (int8_t)2);
+      Hacl_Impl_Ed25519_PointAdd_point_add(out, out, table2 + (uint32_t)20U * j1);
+    }
+    else if (d0 < (int8_t)0)
+    {
+      uint32_t j1 = (uint32_t)(((int8_t)0 - d0 - (int8_t)1) / (int8_t)2);
+      point_negate(tmp, table2 + (uint32_t)20U * j1);
+      Hacl_Impl_Ed25519_PointAdd_point_add(out, out, tmp);
+    }
+  }
+}
+
+static void point_mul_vartime(uint64_t *out, uint8_t *k, uint64_t *p)
+{
+  int8_t r[257U] = { 0U };
+  uint64_t table[160U] = { 0U };
+  uint64_t tmp[20U] = { 0U };
+  wnaf(r, k);
+  precomp_odd(table, p);
+  uint64_t *x = out;
+  uint64_t *y = out + (uint32_t)5U;
+  uint64_t *z = out + (uint32_t)10U;
+  uint64_t *t = out + (uint32_t)15U;
+  x[0U] = (uint64_t)0U;
+  x[1U] = (uint64_t)0U;
+  x[2U] = (uint64_t)0U;
+  x[3U] = (uint64_t)0U;
+  x[4U] = (uint64_t)0U;
+  y[0U] = (uint64_t)1U;
+  y[1U] = (uint64_t)0U;
+  y[2U] = (uint64_t)0U;
+  y[3U] = (uint64_t)0U;
+  y[4U] = (uint64_t)0U;
+  z[0U] = (uint64_t)1U;
+  z[1U] = (uint64_t)0U;
+  z[2U] = (uint64_t)0U;
+  z[3U] = (uint64_t)0U;
+  z[4U] = (uint64_t)0U;
+  t[0U] = (uint64_t)0U;
+  t[1U] = (uint64_t)0U;
+  t[2U] = (uint64_t)0U;
+  t[3U] = (uint64_t)0U;
+  t[4U] = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)257U; i++)
+  {
+    uint32_t j = (uint32_t)257U - i - (uint32_t)1U;
+    point_double(out, out);
+    int8_t d = r[j];
+    if (d > (int8_t)0)
+    {
+      uint32_t j1 = (uint32_t)((d - (int8_t)1) / (int8_t)2);
+      Hacl_Impl_Ed25519_PointAdd_point_add(out, out, table + (uint32_t)20U * j1);
+    }
+    else if (d < (int8_t)0)
+    {
+      uint32_t j1 = (uint32_t)(((int8_t)0 - d - (int8_t)1) / (int8_t)2);
+      point_negate(tmp, table + (uint32_t)20U * j1);
+      Hacl_Impl_Ed25519_PointAdd_point_add(out, out, tmp);
+    }
+  }
+}
+
+static bool torsion_free_vartime(uint64_t *a, uint64_t *r, uint8_t *hb)
+{
+  uint64_t tmp[80U] = { 0U };
+  uint64_t *w = tmp;
+  uint64_t *ad = tmp + (uint32_t)20U;
+  uint64_t *qw = tmp + (uint32_t)40U;
+  uint64_t *inf = tmp + (uint32_t)60U;
+  uint8_t qb[32U] = { 0U };
+  uint32_t d = (uint32_t)hb[0U];
+  memcpy(w, r, (uint32_t)20U * sizeof (uint64_t));
+  memcpy(ad, a, (uint32_t)20U * sizeof (uint64_t));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)3U; i++)
+  {
+    if ((d >> i & (uint32_t)1U) == (uint32_t)1U)
+    {
+      Hacl_Impl_Ed25519_PointAdd_point_add(w, w, ad);
+    }
+    point_double(ad, ad);
+  }
+  uint64_t q[5U] = { 0U };
+  q[0U] = (uint64_t)0x12631a5cf5d3edU;
+  q[1U] = (uint64_t)0xf9dea2f79cd658U;
+  q[2U] = (uint64_t)0x000000000014deU;
+  q[4U] = (uint64_t)0x00000010000000U;
+  store_56(qb, q);
+  point_mul_vartime(qw, qb, w);
+  uint64_t *x = inf;
+  uint64_t *y = inf + (uint32_t)5U;
+  uint64_t *z = inf + (uint32_t)10U;
+  uint64_t *t = inf + (uint32_t)15U;
+  x[0U] = (uint64_t)0U;
+  x[1U] = (uint64_t)0U;
+  x[2U] = (uint64_t)0U;
+  x[3U] = (uint64_t)0U;
+  x[4U] = (uint64_t)0U;
+  y[0U] = (uint64_t)1U;
+  y[1U] = (uint64_t)0U;
+  y[2U] = (uint64_t)0U;
+  y[3U] = (uint64_t)0U;
+  y[4U] = (uint64_t)0U;
+  z[0U] = (uint64_t)1U;
+  z[1U] = (uint64_t)0U;
+  z[2U] = (uint64_t)0U;
+  z[3U] = (uint64_t)0U;
+  z[4U] = (uint64_t)0U;
+  t[0U] = (uint64_t)0U;
+  t[1U] = (uint64_t)0U;
+  t[2U] = (uint64_t)0U;
+  t[3U] = (uint64_t)0U;
+  t[4U] = (uint64_t)0U;
+  return Hacl_Impl_Ed25519_PointEqual_point_equal(qw, inf);
+}
+
+static bool
+verify_batch_chunk(
+  uint32_t n,
+  uint8_t *pubs,
+  uint32_t *lens,
+  uint8_t **msgs,
+  uint8_t *sigs,
+  bool *res
+)
+{
+  uint64_t points[2560U] = { 0U };
+  uint8_t scalars[4096U] = { 0U };
+  uint8_t transcript[8192U] = { 0U };
+  uint64_t tmp[30U] = { 0U };
+  uint8_t tmp_[164U] = { 0U };
+  uint64_t *s = tmp;
+  uint64_t *h = tmp + (uint32_t)5U;
+  uint64_t *z = tmp + (uint32_t)10U;
+  uint64_t *zh = tmp + (uint32_t)15U;
+  uint64_t *zs = tmp + (uint32_t)20U;
+  uint64_t *sum = tmp + (uint32_t)25U;
+  uint8_t *seed = tmp_;
+  uint8_t *zhash = tmp_ + (uint32_t)68U;
+  uint8_t *sum_bytes = tmp_ + (uint32_t)132U;
+  uint32_t m[1U] = { 0U };
+  bool tf[1U] = { true };
+  m[0U] = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    uint8_t *pub = pubs + (uint32_t)32U * i;
+    uint8_t *signature = sigs + (uint32_t)64U * i;
+    uint32_t m0 = m[0U];
+    uint64_t *a_ = points + (uint32_t)40U * m0;
+    uint64_t *r_ = points + (uint32_t)40U * m0 + (uint32_t)20U;
+    uint8_t *t = transcript + (uint32_t)128U * m0;
+    uint64_t *x0 = a_;
+    uint64_t *y0 = a_ + (uint32_t)5U;
+    uint64_t *z0 = a_ + (uint32_t)10U;
+    uint64_t *t0 = a_ + (uint32_t)15U;
+    x0[0U] = (uint64_t)0U;
+    x0[1U] = (uint64_t)0U;
+    x0[2U] = (uint64_t)0U;
+    x0[3U] = (uint64_t)0U;
+    x0[4U] = (uint64_t)0U;
+    y0[0U] = (uint64_t)1U;
+    y0[1U] = (uint64_t)0U;
+    y0[2U] = (uint64_t)0U;
+    y0[3U] = (uint64_t)0U;
+    y0[4U] = (uint64_t)0U;
+    z0[0U] = (uint64_t)1U;
+    z0[1U] = (uint64_t)0U;
+    z0[2U] = (uint64_t)0U;
+    z0[3U] = (uint64_t)0U;
+    z0[4U] = (uint64_t)0U;
+    t0[0U] = (uint64_t)0U;
+    t0[1U] = (uint64_t)0U;
+    t0[2U] = (uint64_t)0U;
+    t0[3U] = (uint64_t)0U;
+    t0[4U] = (uint64_t)0U;
+    uint64_t *x1 = r_;
+    uint64_t *y1 = r_ + (uint32_t)5U;
+    uint64_t *z1 = r_ + (uint32_t)10U;
+    uint64_t *t1 = r_ + (uint32_t)15U;
+    x1[0U] = (uint64_t)0U;
+    x1[1U] = (uint64_t)0U;
+    x1[2U] = (uint64_t)0U;
+    x1[3U] = (uint64_t)0U;
+    x1[4U] = (uint64_t)0U;
+    y1[0U] = (uint64_t)1U;
+    y1[1U] = (uint64_t)0U;
+    y1[2U] = (uint64_t)0U;
+    y1[3U] = (uint64_t)0U;
+    y1[4U] = (uint64_t)0U;
+    z1[0U] = (uint64_t)1U;
+    z1[1U] = (uint64_t)0U;
+    z1[2U] = (uint64_t)0U;
+    z1[3U] = (uint64_t)0U;
+    z1[4U] = (uint64_t)0U;
+    t1[0U] = (uint64_t)0U;
+    t1[1U] = (uint64_t)0U;
+    t1[2U] = (uint64_t)0U;
+    t1[3U] = (uint64_t)0U;
+    t1[4U] = (uint64_t)0U;
+    bool b = Hacl_Impl_Ed25519_PointDecompress_point_decompress(a_, pub);
+    bool b_ = b && Hacl_Impl_Ed25519_PointDecompress_point_decompress(r_, signature);
+    bool ok;
+    if (b_)
+    {
+      load_32_bytes(s, signature + (uint32_t)32U);
+      ok = !gte_q(s);
+    }
+    else
+    {
+      ok = false;
+    }
+    if (ok)
+    {
+      sha512_modq_pre_pre2(h, signature, pub, lens[i], msgs[i]);
+      store_56(t + (uint32_t)96U, h);
+      if (torsion_free_vartime(a_, r_, t + (uint32_t)96U))
+      {
+        memcpy(t, signature, (uint32_t)64U * sizeof (uint8_t));
+        memcpy(t + (uint32_t)64U, pub, (uint32_t)32U * sizeof (uint8_t));
+        m[0U] = m0 + (uint32_t)1U;
+      }
+      else
+      {
+        tf[0U] = false;
+      }
+    }
+    res[i] = ok;
+  }
+  bool tf0 = tf[0U];
+  uint32_t m1 = m[0U];
+  if (!tf0)
+  {
+    return false;
+  }
+  if (m1 == (uint32_t)0U)
+  {
+    return true;
+  }
+  Hacl_Hash_SHA2_hash_512(transcript, (uint32_t)128U * m1, seed);
+  memset(sum, 0U, (uint32_t)5U * sizeof (uint64_t));
+  for (uint32_t i = (uint32_t)0U; i < m1; i++)
+  {
+    uint8_t *t = transcript + (uint32_t)128U * i;
+    uint8_t *ka = scalars + (uint32_t)64U * i;
+    uint8_t *kr = scalars + (uint32_t)64U * i + (uint32_t)32U;
+    store32_le(seed + (uint32_t)64U, i);
+    Hacl_Hash_SHA2_hash_512(seed, (uint32_t)68U, zhash);
+    memcpy(kr, zhash, (uint32_t)16U * sizeof (uint8_t));
+    load_32_bytes(z, kr);
+    load_32_bytes(h, t + (uint32_t)96U);
+    mul_modq(zh, z, h);
+    store_56(ka, zh);
+    load_32_bytes(s, t + (uint32_t)32U);
+    mul_modq(zs, z, s);
+    add_modq(zh, sum, zs);
+    memcpy(sum, zh, (uint32_t)5U * sizeof (uint64_t));
+  }
+  store_56(sum_bytes, sum);
+  uint64_t tmp1[40U] = { 0U };
+  uint64_t *sB = tmp1;
+  uint64_t *rhA = tmp1 + (uint32_t)20U;
+  point_mul_g(sB, sum_bytes);
+  point_mul_multi_vartime(rhA, (uint32_t)2U * m1, scalars, points);
+  return Hacl_Impl_Ed25519_PointEqual_point_equal(sB, rhA);
+}
+
 void Hacl_Ed25519_sign(uint8_t *signature, uint8_t *priv, uint32_t len, uint8_t *msg)
 {
   uint8_t tmp_bytes[352U] = { 0U };
@@ -2060,13 +2674,13 @@ bool Hacl_Ed25519_verify(uint8_t *pub, uint32_t len, uint8_t *msg, uint8_t *sign
         store_56(tmp_, r_2);
         uint8_t *uu____0 = signature + (uint32_t)32U;
         uint64_t tmp1[60U] = { 0U };
-        uint64_t *hA = tmp1;
-        uint64_t *rhA = tmp1 + (uint32_t)20U;
-        uint64_t *sB = tmp1 + (uint32_t)40U;
-        point_mul_g(sB, uu____0);
-        Hacl_Impl_Ed25519_Ladder_point_mul(hA, tmp_, a_1);
-        Hacl_Impl_Ed25519_PointAdd_point_add(rhA, r_1, hA);
-        bool b1 = Hacl_Impl_Ed25519_PointEqual_point_equal(sB, rhA);
+        uint64_t *g = tmp1;
+        uint64_t *na = tmp1 + (uint32_t)20U;
+        uint64_t *sBhA = tmp1 + (uint32_t)40U;
+        Hacl_Impl_Ed25519_Ladder_make_g(g);
+        point_negate(na, a_1);
+        point_mul_double_vartime(sBhA, uu____0, g, tmp_, na);
+        bool b1 = Hacl_Impl_Ed25519_PointEqual_point_equal(sBhA, r_1);
         bool b10 = b1;
         res = b10;
       }
@@ -2084,6 +2698,73 @@ bool Hacl_Ed25519_verify(uint8_t *pub, uint32_t len, uint8_t *msg, uint8_t *sign
   return res0;
 }
 
+static void
+verify_batch_block(
+  uint32_t n,
+  uint8_t *pubs,
+  uint32_t *lens,
+  uint8_t **msgs,
+  uint8_t *sigs,
+  bool *res
+)
+{
+  bool b = verify_batch_chunk(n, pubs, lens, msgs, sigs, res);
+  if (!b)
+  {
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      if (res[i])
+      {
+        res[i] =
+          Hacl_Ed25519_verify(pubs + (uint32_t)32U * i,
+            lens[i],
+            msgs[i],
+            sigs + (uint32_t)64U * i);
+      }
+    }
+  }
+}
+
+bool
+Hacl_Ed25519_verify_batch(
+  uint32_t n,
+  uint8_t *pubs,
+  uint32_t *lens,
+  uint8_t **msgs,
+  uint8_t *sigs,
+  bool *res
+)
+{
+  uint32_t nb = n / (uint32_t)64U;
+  uint32_t rem = n % (uint32_t)64U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    uint32_t off = (uint32_t)64U * i;
+    verify_batch_block((uint32_t)64U,
+      pubs + (uint32_t)32U * off,
+      lens + off,
+      msgs + off,
+      sigs + (uint32_t)64U * off,
+      res + off);
+  }
+  if (rem > (uint32_t)0U)
+  {
+    uint32_t off = (uint32_t)64U * nb;
+    verify_batch_block(rem,
+      pubs + (uint32_t)32U * off,
+      lens + off,
+      msgs + off,
+      sigs + (uint32_t)64U * off,
+      res + off);
+  }
+  bool ok = true;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    ok = ok && res[i];
+  }
+  return ok;
+}
+
 void Hacl_Ed25519_secret_to_public(uint8_t *pub, uint8_t *priv)
 {
   secret_to_public(pub, priv);
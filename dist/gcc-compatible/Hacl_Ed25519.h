@@ -37,6 +37,7 @@ extern "C" {
 #include "kremlin/internal/target.h"
 
 
+#include "Hacl_Ed25519_PrecompTable.h"
 #include "Hacl_Kremlib.h"
 #include "Hacl_Hash.h"
 #include "Hacl_Curve25519_51.h"
@@ -53,6 +54,8 @@ void Hacl_Bignum25519_store_51(uint8_t *output, uint64_t *input);
 
 void Hacl_Impl_Ed25519_PointAdd_point_add(uint64_t *out, uint64_t *p, uint64_t *q);
 
+void Hacl_Impl_Ed25519_Ladder_make_g(uint64_t *g);
+
 void Hacl_Impl_Ed25519_Ladder_point_mul(uint64_t *result, uint8_t *scalar, uint64_t *q);
 
 void Hacl_Impl_Ed25519_PointCompress_point_compress(uint8_t *z, uint64_t *p);
@@ -65,6 +68,16 @@ void Hacl_Ed25519_sign(uint8_t *signature, uint8_t *priv, uint32_t len, uint8_t
 
 bool Hacl_Ed25519_verify(uint8_t *pub, uint32_t len, uint8_t *msg, uint8_t *signature);
 
+bool
+Hacl_Ed25519_verify_batch(
+  uint32_t n,
+  uint8_t *pubs,
+  uint32_t *lens,
+  uint8_t **msgs,
+  uint8_t *sigs,
+  bool *res
+);
+
 void Hacl_Ed25519_secret_to_public(uint8_t *pub, uint8_t *priv);
 
 void Hacl_Ed25519_expand_keys(uint8_t *ks, uint8_t *priv);
@@ -0,0 +1,1333 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_Ed25519_PrecompTable_H
+#define __Hacl_Ed25519_PrecompTable_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+
+
+static const
+uint64_t
+Hacl_Ed25519_PrecompTable_precomp_basepoint_table[3840U] =
+  {
+    (uint64_t)0x62d608f25d51aU, (uint64_t)0x412a4b4f6592aU, (uint64_t)0x75b7171a4b31dU,
+    (uint64_t)0x1ff60527118feU, (uint64_t)0x216936d3cd6e5U, (uint64_t)0x6666666666658U,
+    (uint64_t)0x4ccccccccccccU, (uint64_t)0x1999999999999U, (uint64_t)0x3333333333333U,
+    (uint64_t)0x6666666666666U, (uint64_t)0x68ab3a5b7dda3U, (uint64_t)0xeea2a5eadbbU,
+    (uint64_t)0x2af8df483c27eU, (uint64_t)0x332b375274732U, (uint64_t)0x67875f0fd78b7U,
+    (uint64_t)0x5a14e2843ce0eU, (uint64_t)0xa2baf48bf078U, (uint64_t)0xcf9eb0203639U,
+    (uint64_t)0x2361e821dbe8cU, (uint64_t)0x36ab384c9f5a0U, (uint64_t)0x746ae6af8a3c9U,
+    (uint64_t)0x22c870a2ac1cbU, (uint64_t)0x6887d5a5ce43dU, (uint64_t)0x4e10ed12f7464U,
+    (uint64_t)0x2260cdf309232U, (uint64_t)0x23f556d69b401U, (uint64_t)0x1383ee48056e3U,
+    (uint64_t)0x40ed04d75e6b3U, (uint64_t)0x46e0ef2af8439U, (uint64_t)0x2498a7850b2f6U,
+    (uint64_t)0x2485fd3f8e25cU, (uint64_t)0x3302c4910d58cU, (uint64_t)0x36b20e98d0e60U,
+    (uint64_t)0x7a48ffa573a1fU, (uint64_t)0x67ae9c4a22928U, (uint64_t)0x3684878f5b4d4U,
+    (uint64_t)0x2ece480608058U, (uint64_t)0x9a7bde7c5bb0U, (uint64_t)0x4d5d09350c730U,
+    (uint64_t)0x1267b1d177ee6U, (uint64_t)0x108fa78b3a41aU, (uint64_t)0x17f62df8959bfU,
+    (uint64_t)0x6e4549d709cd6U, (uint64_t)0x28875f79bc1d6U, (uint64_t)0x2a4d025cb1dd9U,
+    (uint64_t)0x2a657c4c9f870U, (uint64_t)0x3279c2a8e927U, (uint64_t)0xd483e469ce7bU,
+    (uint64_t)0xa34192ea5c3dU, (uint64_t)0x203da8db56cffU, (uint64_t)0xab61ca32112fU,
+    (uint64_t)0x65d45e1fe1be7U, (uint64_t)0x355c5b133c8a0U, (uint64_t)0x2f0a3875c42c0U,
+    (uint64_t)0x47d0e827cb159U, (uint64_t)0x722f6728a1358U, (uint64_t)0x3d6dba0f94bf1U,
+    (uint64_t)0x1f0a581c6578cU, (uint64_t)0x306390a5d3563U, (uint64_t)0x22783cd8d8732U,
+    (uint64_t)0x9cc0322ef233U, (uint64_t)0x727c37c34b228U, (uint64_t)0x4b6977970a067U,
+    (uint64_t)0x43dfe77be7be8U, (uint64_t)0x49fda73eade35U, (uint64_t)0x21f83d676c8edU,
+    (uint64_t)0x15128616ba21aU, (uint64_t)0x6491998c4a0bbU, (uint64_t)0x737f016370a44U,
+    (uint64_t)0x5f4825b298feaU, (uint64_t)0x150bcf3e801d0U, (uint64_t)0xa00124d7ec83U,
+    (uint64_t)0x4db1fe6bee53aU, (uint64_t)0x6a618b0752843U, (uint64_t)0x745c562c9c593U,
+    (uint64_t)0x2741a7dcbf23dU, (uint64_t)0x4d8f6884ef07U, (uint64_t)0x428a6fa879666U,
+    (uint64_t)0xe315756606eU, (uint64_t)0x4c9797ba7a456U, (uint64_t)0x27ad0f9497ef4U,
+    (uint64_t)0xd289ad6c183aU, (uint64_t)0x53df5dfe505f0U, (uint64_t)0x4508edb84d3feU,
+    (uint64_t)0x54de3fc2886dU, (uint64_t)0x6d6c8b44ef1d2U, (uint64_t)0x28f8fb91378f9U,
+    (uint64_t)0x79f73102ebe48U, (uint64_t)0x27c142ad4ca7U, (uint64_t)0x3c32efd109aa6U,
+    (uint64_t)0x5981af50e4107U, (uint64_t)0x6777e39d2ab0aU, (uint64_t)0x476041e0fa027U,
+    (uint64_t)0x6a774f1f70ca5U, (uint64_t)0x14568685fcf4bU, (uint64_t)0x4c4b59f4062b8U,
+    (uint64_t)0xdef57e47a258U, (uint64_t)0x4dab507c220adU, (uint64_t)0x297c3e732346eU,
+    (uint64_t)0x31c563e32b47dU, (uint64_t)0x545565587ed1bU, (uint64_t)0x543d3549c8217U,
+    (uint64_t)0x756ead14a518cU, (uint64_t)0x70dcdf416e2c4U, (uint64_t)0x119e77b11d165U,
+    (uint64_t)0x7fdbc08a584c8U, (uint64_t)0x7700d31732770U, (uint64_t)0x13b3e4faceb19U,
+    (uint64_t)0xdb214316ae7cU, (uint64_t)0x6742e15f97d77U, (uint64_t)0x75ba9fc37b9b4U,
+    (uint64_t)0x78c43dc9263c5U, (uint64_t)0x22bce3e05e0f3U, (uint64_t)0x1bcb756b784b3U,
+    (uint64_t)0x21d30600c9e57U, (uint64_t)0x6f41ad41a51bfU, (uint64_t)0x5a689857eadf7U,
+    (uint64_t)0x2cf664d17c339U, (uint64_t)0x5708b04614d9cU, (uint64_t)0x2c4f59ecedf7eU,
+    (uint64_t)0xbcdd0cc2a556U, (uint64_t)0x776ac2aeda417U, (uint64_t)0x241512752d5e3U,
+    (uint64_t)0x65ff374e5e093U, (uint64_t)0x5e7e07ed4e1deU, (uint64_t)0x42031566cf6c7U,
+    (uint64_t)0x35824fb3501c2U, (uint64_t)0x74c9839f46cf6U, (uint64_t)0x13cb5faf5d540U,
+    (uint64_t)0xf55755c51f10U, (uint64_t)0x365fc2857a27eU, (uint64_t)0xc67e5bfbeb5eU,
+    (uint64_t)0x53a86b67936b6U, (uint64_t)0x33d215a262b04U, (uint64_t)0x63e8ae2c1ead5U,
+    (uint64_t)0x1333c82cd340aU, (uint64_t)0x366072c3a4a81U, (uint64_t)0x1c3509887bff6U,
+    (uint64_t)0x2399998fcf77dU, (uint64_t)0x2eecbf81b3d08U, (uint64_t)0x4f764008b93e8U,
+    (uint64_t)0x1093cdc0e9713U, (uint64_t)0x28466d9213535U, (uint64_t)0x13e20996cdba0U,
+    (uint64_t)0x54d2dc2da1378U, (uint64_t)0x522be2496053aU, (uint64_t)0x765bc6fd72749U,
+    (uint64_t)0x118733aa74460U, (uint64_t)0x1e7789e2b953aU, (uint64_t)0x752941df7a968U,
+    (uint64_t)0x6cef314cc93bbU, (uint64_t)0x554a7aa3728acU, (uint64_t)0x73636f95fab74U,
+    (uint64_t)0x71452d53d8c3cU, (uint64_t)0x70b225147463bU, (uint64_t)0x67392b18d9c02U,
+    (uint64_t)0x9bb22c14b73U, (uint64_t)0x535826851e4d0U, (uint64_t)0x200e1303393fcU,
+    (uint64_t)0x244980ded32ffU, (uint64_t)0x6afe18eca4bf4U, (uint64_t)0x602cb44b77956U,
+    (uint64_t)0x20dcf3889df68U, (uint64_t)0x6d30f3dedd7c0U, (uint64_t)0x75c542741675U,
+    (uint64_t)0x1c7d55b4a2b68U, (uint64_t)0x89655c23b22aU, (uint64_t)0x32ecdeaf3c51fU,
+    (uint64_t)0x682c8563e5b64U, (uint64_t)0x6b113a52f9f3fU, (uint64_t)0x54359f327c13dU,
+    (uint64_t)0x69eaf32d8b212U, (uint64_t)0x5467018a59657U, (uint64_t)0x73c975c6d0c02U,
+    (uint64_t)0x1aeb017159697U, (uint64_t)0x3c3e94b3a3facU, (uint64_t)0x2ccd21ea35241U,
+    (uint64_t)0x6c78dddc2e59bU, (uint64_t)0x36d2ae0442c71U, (uint64_t)0x66cb63a6e6c7cU,
+    (uint64_t)0x2fde6e9a95bd2U, (uint64_t)0x507fcc850e338U, (uint64_t)0x64101647815fbU,
+    (uint64_t)0xbcd6b508ee9cU, (uint64_t)0x661b75757abbcU, (uint64_t)0x597e42a7b09beU,
+    (uint64_t)0x2fadb6255c92fU, (uint64_t)0x601f01f443255U, (uint64_t)0x58978670117a7U,
+    (uint64_t)0x5da1ae1b5d4bU, (uint64_t)0x5ee00d9cd9f73U, (uint64_t)0x13aaa1f36bd93U,
+    (uint64_t)0x330207ec4e730U, (uint64_t)0x27c157104cbb8U, (uint64_t)0x519beaf530bc7U,
+    (uint64_t)0x23c8ab6490615U, (uint64_t)0x55862840685fdU, (uint64_t)0x196f4f8b2bf5aU,
+    (uint64_t)0x7f59da5a6f110U, (uint64_t)0x603ba4adc34a9U, (uint64_t)0x22a95c0e658bcU,
+    (uint64_t)0xda5e6f535025U, (uint64_t)0x11b1432f122f8U, (uint64_t)0x66c87d66a3570U,
+    (uint64_t)0x1fdbaf2c3482cU, (uint64_t)0x67887503d5f1bU, (uint64_t)0x421680e2c21e1U,
+    (uint64_t)0x4b0d895cfc0f8U, (uint64_t)0x66564e8b18189U, (uint64_t)0x629fa3ac3078eU,
+    (uint64_t)0x540310b391d99U, (uint64_t)0x37a2582d266d3U, (uint64_t)0x3e78cc3af5aa1U,
+    (uint64_t)0x1d22e8f0ad79dU, (uint64_t)0x3d718e644bf2dU, (uint64_t)0x63bf5a23600f9U,
+    (uint64_t)0xefe3ee501511U, (uint64_t)0x8aa2497e40abU, (uint64_t)0x20a179144089dU,
+    (uint64_t)0x320d055dbba3fU, (uint64_t)0x67099540a656U, (uint64_t)0x3eec9958b0c58U,
+    (uint64_t)0x192110f13a743U, (uint64_t)0x7d383c5d267d0U, (uint64_t)0xe52bc37ff3fdU,
+    (uint64_t)0x2bcfbbd1317f7U, (uint64_t)0x52622b668bd9aU, (uint64_t)0x318a0f6120abfU,
+    (uint64_t)0x1c5daa0fa88feU, (uint64_t)0x3c1ae7527612dU, (uint64_t)0x15a20711364eU,
+    (uint64_t)0x16c5865588a24U, (uint64_t)0x517e43e99fd7aU, (uint64_t)0x2bf5bc308b642U,
+    (uint64_t)0x51c91c3f9d7eU, (uint64_t)0x7b066bece2184U, (uint64_t)0x2a57f92c42568U,
+    (uint64_t)0x2a85941a787b1U, (uint64_t)0x29e44311e8f82U, (uint64_t)0xdaa1438fdd28U,
+    (uint64_t)0x5678a8411a565U, (uint64_t)0x68f4d089a33d3U, (uint64_t)0x1f35528e7f84U,
+    (uint64_t)0x997aa0fbce5U, (uint64_t)0x5de7faa2ee4e7U, (uint64_t)0x5e4cef854ec36U,
+    (uint64_t)0x11203adfedbf0U, (uint64_t)0x50cb64b03a2f0U, (uint64_t)0x70555c754c935U,
+    (uint64_t)0x2c9f23641e1c2U, (uint64_t)0x32c178a3d4aa1U, (uint64_t)0x4894ca1aab2e6U,
+    (uint64_t)0x7ea31aedea51cU, (uint64_t)0x44276483e390dU, (uint64_t)0x1e35c1316b640U,
+    (uint64_t)0x411b172d04f27U, (uint64_t)0x7d0291282a4e2U, (uint64_t)0x474754cb61d1U,
+    (uint64_t)0x29b991b31b014U, (uint64_t)0x74e337a01c13bU, (uint64_t)0x66796114e25f1U,
+    (uint64_t)0x35c4a7658439cU, (uint64_t)0x3cd667ecbba17U, (uint64_t)0x57cb767fd5eddU,
+    (uint64_t)0x8648f02b3a4dU, (uint64_t)0x52c87b4b311cfU, (uint64_t)0x173e079bb48baU,
+    (uint64_t)0x5f2251be4a1bdU, (uint64_t)0x58b581d945a8dU, (uint64_t)0x50076a3f864d7U,
+    (uint64_t)0x14e4390d7c290U, (uint64_t)0x7c926f3dd69bbU, (uint64_t)0x7ff2072205381U,
+    (uint64_t)0x17950cbd3d0b7U, (uint64_t)0x73ce78c748a87U, (uint64_t)0x5e13a0a0cb2caU,
+    (uint64_t)0x7a7f77532928fU, (uint64_t)0x58381c33ab994U, (uint64_t)0x7637f1cb1e5fcU,
+    (uint64_t)0x33c172e606062U, (uint64_t)0x66cd87ae85547U, (uint64_t)0x7aae0a6e28abbU,
+    (uint64_t)0x4604552facc80U, (uint64_t)0x3018448ffe42eU, (uint64_t)0xef5ed13f5f0bU,
+    (uint64_t)0x7475464f29434U, (uint64_t)0x15744114800e6U, (uint64_t)0x496e91cff5d55U,
+    (uint64_t)0x42af416580a11U, (uint64_t)0x6a6fbd51efa6aU, (uint64_t)0x206b27616d671U,
+    (uint64_t)0x7ca58789eaf3dU, (uint64_t)0x5e1c2b7874585U, (uint64_t)0x615be7c088b0eU,
+    (uint64_t)0x16f5f8529f55fU, (uint64_t)0x27228c0c839c2U, (uint64_t)0x673aed26d706bU,
+    (uint64_t)0x2aee5b39ea2fdU, (uint64_t)0x5a176b2bce933U, (uint64_t)0x653efe2ea6c90U,
+    (uint64_t)0x5532a8f320ca8U, (uint64_t)0x1bf5987794688U, (uint64_t)0x75dd2cb15d929U,
+    (uint64_t)0x5affba5f75d88U, (uint64_t)0x455d905f52d04U, (uint64_t)0x460470fe6a8b5U,
+    (uint64_t)0x594d8050a8caeU, (uint64_t)0x31e44ec7bbe6eU, (uint64_t)0x395b4de113dd8U,
+    (uint64_t)0x33dbf271d5fcU, (uint64_t)0x6f0ce50a3817dU, (uint64_t)0x398e2405b459fU,
+    (uint64_t)0xf32156bd7ac4U, (uint64_t)0x563c1ca0296ceU, (uint64_t)0x1314a3c06ce1U,
+    (uint64_t)0x4643dca20439aU, (uint64_t)0x3c0923d355e4cU, (uint64_t)0x1b6ad9d5c1952U,
+    (uint64_t)0xb9bfb82f8d48U, (uint64_t)0x584e7f2a5e367U, (uint64_t)0xfe4e547c1381U,
+    (uint64_t)0x1d81ecbb2c45fU, (uint64_t)0x3a6e210cd1cc8U, (uint64_t)0x7f4091979ede0U,
+    (uint64_t)0x2e5327982a30dU, (uint64_t)0x257c90b8df0e8U, (uint64_t)0x7655c2fcd0fc7U,
+    (uint64_t)0x4861fb552d5fcU, (uint64_t)0x4825d267c852dU, (uint64_t)0x276f25e64b1U,
+    (uint64_t)0x657c725de8fceU, (uint64_t)0x5ad57b534cccdU, (uint64_t)0x78821744738bfU,
+    (uint64_t)0x5ea70641cec63U, (uint64_t)0x7783d619f52f8U, (uint64_t)0x5cfc4600c5c4dU,
+    (uint64_t)0x34201b0471600U, (uint64_t)0x7a7aff5114eb0U, (uint64_t)0x4ff41a1091eccU,
+    (uint64_t)0x7b87c33701d60U, (uint64_t)0x6ea66aad8faf4U, (uint64_t)0x1efd79b351b86U,
+    (uint64_t)0x5435537abd786U, (uint64_t)0x631b68dd0b077U, (uint64_t)0x6d4ffaede82cU,
+    (uint64_t)0x4e0c5f69a9634U, (uint64_t)0x3d5a981c48062U, (uint64_t)0x3c6ca588dc26aU,
+    (uint64_t)0x2aa4d9961ce97U, (uint64_t)0x243eb188de73aU, (uint64_t)0x7b25b1f4ce2f6U,
+    (uint64_t)0x821039f4b055U, (uint64_t)0x2c893328b6fbcU, (uint64_t)0x16c00f5bd05bfU,
+    (uint64_t)0x3779298951f45U, (uint64_t)0x1089e775b3f98U, (uint64_t)0x4bcb86a15e4dcU,
+    (uint64_t)0x7bde0969b12c3U, (uint64_t)0x275592385f1dU, (uint64_t)0x47f8fa73cd9a1U,
+    (uint64_t)0xcf27d8d43a77U, (uint64_t)0x1bbb953ae543dU, (uint64_t)0x5095bb5e76a58U,
+    (uint64_t)0x13358e63b00aU, (uint64_t)0xaf367956af63U, (uint64_t)0x1bd2f2ba408c5U,
+    (uint64_t)0x1c96d4c55026U, (uint64_t)0x25ac2c8f76a44U, (uint64_t)0x1d9b846e94567U,
+    (uint64_t)0x21108d900134dU, (uint64_t)0x190d2c605c7afU, (uint64_t)0x227606de89978U,
+    (uint64_t)0x20b9b6aaf6f8fU, (uint64_t)0x5eb00b32efe6eU, (uint64_t)0x4f6109bb8d7dbU,
+    (uint64_t)0x7074fbae70d33U, (uint64_t)0x2d8b40fbd51bbU, (uint64_t)0x56c6d5f96c2c7U,
+    (uint64_t)0x5ad320a09a2faU, (uint64_t)0x2b760154fc5ceU, (uint64_t)0x63696afc20c02U,
+    (uint64_t)0x56d440a9c495fU, (uint64_t)0x68b3b5d8a7ecbU, (uint64_t)0x1701b9a08901fU,
+    (uint64_t)0x7dc81af96fed4U, (uint64_t)0x60c53f3fb22e0U, (uint64_t)0x4c4757a160430U,
+    (uint64_t)0x1b2bd2a8d9f2aU, (uint64_t)0x5137080fab145U, (uint64_t)0xa00274f89820U,
+    (uint64_t)0x23f36e811b9d8U, (uint64_t)0x11e3a7b995828U, (uint64_t)0x675ed453cf48fU,
+    (uint64_t)0x279d550726c46U, (uint64_t)0x4535c89311d60U, (uint64_t)0x7bf9008d63661U,
+    (uint64_t)0x2b081ed92ef54U, (uint64_t)0x201ab24dcb4cfU, (uint64_t)0x470d551051ec8U,
+    (uint64_t)0x69dd3661ba84bU, (uint64_t)0x479b938c463d8U, (uint64_t)0x49e7dd1f8a50dU,
+    (uint64_t)0x6f9746e0e0364U, (uint64_t)0x328a0865cb2bU, (uint64_t)0x753a822295546U,
+    (uint64_t)0x492c69c5bdb6bU, (uint64_t)0x70eb718b5e477U, (uint64_t)0x65212db5be90bU,
+    (uint64_t)0x69c3c2449cc31U, (uint64_t)0x67dbc33418bbcU, (uint64_t)0x7b056093af396U,
+    (uint64_t)0x1072363ca2f8dU, (uint64_t)0x1ea88943327a9U, (uint64_t)0x1982cfe4973e5U,
+    (uint64_t)0x38436fdf8589aU, (uint64_t)0x77f71f1a14956U, (uint64_t)0x11fe538475b39U,
+    (uint64_t)0x1c4f8360bd73cU, (uint64_t)0xb8041409a633U, (uint64_t)0x1ce557a72a788U,
+    (uint64_t)0x249b3ebdd1011U, (uint64_t)0x12f437b17b475U, (uint64_t)0x7173f5d884de5U,
+    (uint64_t)0x586375e7b19c4U, (uint64_t)0x69f0b68125b9aU, (uint64_t)0x37a47dc3669d6U,
+    (uint64_t)0x2ec78aa467a8dU, (uint64_t)0x78cb7f911386bU, (uint64_t)0x3a3487665627dU,
+    (uint64_t)0xd2a89a19c281U, (uint64_t)0x19491957c0200U, (uint64_t)0x5f3d6003062adU,
+    (uint64_t)0x3edb5aeb1f1c6U, (uint64_t)0x7bd15a3e2bac2U, (uint64_t)0x3d3e549f6c4ccU,
+    (uint64_t)0x55ffa5112f8ebU, (uint64_t)0x2a063fd4ce313U, (uint64_t)0x27e3d4f7f2a35U,
+    (uint64_t)0x2166846366960U, (uint64_t)0x34d9729a3945dU, (uint64_t)0x3cf404c6279b1U,
+    (uint64_t)0x66c9cec06e1b6U, (uint64_t)0x385a1c1f00554U, (uint64_t)0x1275a30aa7728U,
+    (uint64_t)0x65efef05bd03dU, (uint64_t)0x13dda03194fd0U, (uint64_t)0x6747301b7f7f5U,
+    (uint64_t)0x3843f078a3173U, (uint64_t)0x32e845d8c7ff1U, (uint64_t)0x1ffbd466cadacU,
+    (uint64_t)0x30403c96f4e4cU, (uint64_t)0xf2fcc2114b1cU, (uint64_t)0x7219fd127c222U,
+    (uint64_t)0x1414193b15434U, (uint64_t)0x271b64006d3d0U, (uint64_t)0x45df50bdd7d9U,
+    (uint64_t)0x7207dbd956650U, (uint64_t)0x7600ec14fbcb9U, (uint64_t)0xe17e3247881cU,
+    (uint64_t)0x6e0746310b9c0U, (uint64_t)0x30f02644f45dU, (uint64_t)0x7860d4d4d2a40U,
+    (uint64_t)0x173d1dbdd7b98U, (uint64_t)0x5aed7e7ea0f4fU, (uint64_t)0x48121f27758f0U,
+    (uint64_t)0x4e9bd19448479U, (uint64_t)0x515054dd8188aU, (uint64_t)0x17c89c7550e6eU,
+    (uint64_t)0x3dc59effd00eeU, (uint64_t)0x29ea44a50a4b4U, (uint64_t)0x55f63af509005U,
+    (uint64_t)0x3f2e713bc33d3U, (uint64_t)0x5aac918c2b1b0U, (uint64_t)0x5465deda5e88cU,
+    (uint64_t)0x6c775ac8ab2edU, (uint64_t)0x52966d7e75326U, (uint64_t)0x30bc2394d7728U,
+    (uint64_t)0x6a165894871eaU, (uint64_t)0x5f0f88de506b2U, (uint64_t)0x6ad4ec136213fU,
+    (uint64_t)0x797a46abc0cbbU, (uint64_t)0x20e5bcde5b262U, (uint64_t)0xca003cb02070U,
+    (uint64_t)0x462eed5ea13b4U, (uint64_t)0x4d1e116d13615U, (uint64_t)0x61efb10c9b91aU,
+    (uint64_t)0x76bd149709e89U, (uint64_t)0x4023e310fa12dU, (uint64_t)0x2db2e6289aa5aU,
+    (uint64_t)0x6d415be49d4e3U, (uint64_t)0x248db5682ed71U, (uint64_t)0x1dc7ba9000caeU,
+    (uint64_t)0xb9e21607af00U, (uint64_t)0x4617ff4f77abaU, (uint64_t)0x7a979779ff7faU,
+    (uint64_t)0x2148248127d15U, (uint64_t)0x658297a8659a8U, (uint64_t)0x3e38bb230a985U,
+    (uint64_t)0x3eedf71ca2292U, (uint64_t)0x4b5bae5a77a86U, (uint64_t)0x3b8de209a77cbU,
+    (uint64_t)0x4af7181f41b24U, (uint64_t)0x19d0bb2dabb2eU, (uint64_t)0x90cc3ad22c07U,
+    (uint64_t)0x739476e0b3847U, (uint64_t)0x3e04a58ec63f8U, (uint64_t)0x49886fc039f4eU,
+    (uint64_t)0x72644b443e4a6U, (uint64_t)0x5c6fbbeafb010U, (uint64_t)0xe40895ab3ae5U,
+    (uint64_t)0x67e5a18ecc8f9U, (uint64_t)0xf8e7374be3e2U, (uint64_t)0x20b53c6b986aeU,
+    (uint64_t)0x278281c2d3accU, (uint64_t)0x28e01e9eebe62U, (uint64_t)0x682a0a58a68c1U,
+    (uint64_t)0x6d36c8bc54f6eU, (uint64_t)0x5c412374e86d3U, (uint64_t)0x14db149d3e0d5U,
+    (uint64_t)0x34a3ef2080894U, (uint64_t)0x1a664f9bdbe3U, (uint64_t)0x50e898f4410b9U,
+    (uint64_t)0x3891d92af558U, (uint64_t)0x510a4698251c0U, (uint64_t)0x2d139c373b6eeU,
+    (uint64_t)0x33f232869fcdfU, (uint64_t)0x3be66e4877f0bU, (uint64_t)0x2a26341ac8b54U,
+    (uint64_t)0x789f0837fe7b6U, (uint64_t)0x33bfa90cc1b9dU, (uint64_t)0x5824fb2da81d9U,
+    (uint64_t)0x3a5e21302873U, (uint64_t)0x405f4b7d2b3bcU, (uint64_t)0x572cfd2fff884U,
+    (uint64_t)0x53b120db6327cU, (uint64_t)0x155c029d95cabU, (uint64_t)0xa35c7db915d2U,
+    (uint64_t)0x65d0832d6eb84U, (uint64_t)0x53e0ac979473dU, (uint64_t)0x46dae663fdc68U,
+    (uint64_t)0x70b4a1110cc99U, (uint64_t)0x77b444058d29eU, (uint64_t)0x29aecabcdb38aU,
+    (uint64_t)0x64388b7fb4166U, (uint64_t)0x6759a4f961d6aU, (uint64_t)0x43f61ecf8af35U,
+    (uint64_t)0x4c0b7c2cc6794U, (uint64_t)0xdb52c40468U, (uint64_t)0x263d92c8908b0U,
+    (uint64_t)0x7e6c7c2dca5f4U, (uint64_t)0x5c433c7226b49U, (uint64_t)0x534aa6c709c4cU,
+    (uint64_t)0x41912f8d4f5ccU, (uint64_t)0x398016e32b8a2U, (uint64_t)0x65404dba63722U,
+    (uint64_t)0x434a9ade80267U, (uint64_t)0x1b8f55022be1aU, (uint64_t)0x1339dd7aa521dU,
+    (uint64_t)0xf3c3b487024aU, (uint64_t)0x56bec70310915U, (uint64_t)0x66b33ec86fb32U,
+    (uint64_t)0x60d9f59056a25U, (uint64_t)0x5c4301739f91dU, (uint64_t)0x4666e532b5a79U,
+    (uint64_t)0x6ab2ddd075077U, (uint64_t)0x7e484bad1600cU, (uint64_t)0x14a6bf4cf32e5U,
+    (uint64_t)0x50382a526b5e6U, (uint64_t)0x32df147b9286cU, (uint64_t)0x6eb24d5673c2dU,
+    (uint64_t)0x3d6530a7c82bcU, (uint64_t)0x4f6bd651a0841U, (uint64_t)0xa7158c176b82U,
+    (uint64_t)0x33ed6f9d40bd0U, (uint64_t)0x4bbefbdc2c608U, (uint64_t)0x63f6849538107U,
+    (uint64_t)0x420e11412a081U, (uint64_t)0xf9d3deb0d51fU, (uint64_t)0x6e4bce8e72ee6U,
+    (uint64_t)0x6eb85cc89c0c2U, (uint64_t)0x77c70029190e4U, (uint64_t)0x4142f892544adU,
+    (uint64_t)0x399a4c7024240U, (uint64_t)0x5dac7acd41b67U, (uint64_t)0x1e8df616d6e54U,
+    (uint64_t)0x222bc0b9efc6U, (uint64_t)0x386b66e0e23c1U, (uint64_t)0x3da69124805eaU,
+    (uint64_t)0x6814de0caac58U, (uint64_t)0x444929347c2deU, (uint64_t)0x42aff2e1d6245U,
+    (uint64_t)0x181af64b48423U, (uint64_t)0x695f23ff0e456U, (uint64_t)0x5eb22d1928f3eU,
+    (uint64_t)0x77785ec5cbbdaU, (uint64_t)0x4690b8284e8a9U, (uint64_t)0x1b4407c48eacaU,
+    (uint64_t)0x2e02a7762575bU, (uint64_t)0x6f6b2e2755896U, (uint64_t)0x76a162d1abff7U,
+    (uint64_t)0x490fa3b4710e5U, (uint64_t)0x1eacdfd56a61fU, (uint64_t)0x6cb20ee9c3beeU,
+    (uint64_t)0x549ca19bd017fU, (uint64_t)0xf6c3a96e0032U, (uint64_t)0x479be167635aU,
+    (uint64_t)0x4d2f58f2713efU, (uint64_t)0x10893b9457875U, (uint64_t)0x33a81c525ac74U,
+    (uint64_t)0x3d4e97e286378U, (uint64_t)0x4e485e1daff38U, (uint64_t)0x527a746002890U,
+    (uint64_t)0x51c8d4c76f176U, (uint64_t)0x4310b39066deU, (uint64_t)0x28b2ebb173415U,
+    (uint64_t)0x69fade6abb440U, (uint64_t)0x55551d6694d28U, (uint64_t)0x6317458822a73U,
+    (uint64_t)0x692628efb5e89U, (uint64_t)0x3b13c71c2a90bU, (uint64_t)0x5be180d16dc54U,
+    (uint64_t)0x5f0004a4c2c86U, (uint64_t)0x23f4d0a9bdc16U, (uint64_t)0x3d95dd4133c97U,
+    (uint64_t)0x14890a7ab2481U, (uint64_t)0x4ba7562e7208aU, (uint64_t)0x4b9091e470f22U,
+    (uint64_t)0x43809ef3818c1U, (uint64_t)0x6ef5f3a007fecU, (uint64_t)0x5124d8bf03ce2U,
+    (uint64_t)0x320f5fd1d642bU, (uint64_t)0x298630e9dbbe6U, (uint64_t)0x54627423f3186U,
+    (uint64_t)0x6bc3fb34ab459U, (uint64_t)0x7983fccb8fdffU, (uint64_t)0x163226a436855U,
+    (uint64_t)0x4aaf356b5777bU, (uint64_t)0x2e94120f7867bU, (uint64_t)0x6661493ab8ed7U,
+    (uint64_t)0x3c0fcdb8f1b0cU, (uint64_t)0x1d87c4e9b20d8U, (uint64_t)0x234f6214e9262U,
+    (uint64_t)0x694396c46d896U, (uint64_t)0xf7a5029fbe0dU, (uint64_t)0x4ac845e2b5904U,
+    (uint64_t)0x6c091e388a820U, (uint64_t)0x6a3044f1576dU, (uint64_t)0x69bae0ea4a2caU,
+    (uint64_t)0x2a112c8ba6d4U, (uint64_t)0x184b48cb45500U, (uint64_t)0x24dba26e77c33U,
+    (uint64_t)0x4707f5e8a7fc6U, (uint64_t)0x603bdcd99e697U, (uint64_t)0x1d4eeb0613411U,
+    (uint64_t)0x3ee0e07a03dc3U, (uint64_t)0x4e3d85fb1c87U, (uint64_t)0xfccecd2b73dU,
+    (uint64_t)0x1ec19981a14b9U, (uint64_t)0x6bf8c0b3a434aU, (uint64_t)0x41cf3c80d1ba5U,
+    (uint64_t)0x62364b859c113U, (uint64_t)0x2a53f9591e9b0U, (uint64_t)0x6861d4b0ffd5aU,
+    (uint64_t)0x7f8ec47a30758U, (uint64_t)0x5d17bc7ae6348U, (uint64_t)0x7f1ed5765a23dU,
+    (uint64_t)0x614aa29e2f0b9U, (uint64_t)0x67865bd10140eU, (uint64_t)0x17b0b1984d6eaU,
+    (uint64_t)0x53daa8c1f0668U, (uint64_t)0x6fc078b3ece5dU, (uint64_t)0x46bbc9edf9999U,
+    (uint64_t)0x284f8519822d4U, (uint64_t)0x773955883eed9U, (uint64_t)0x76244798c6270U,
+    (uint64_t)0x747ad656376ceU, (uint64_t)0x14a7699747e90U, (uint64_t)0x1cda466130882U,
+    (uint64_t)0x364aa3e07070dU, (uint64_t)0x2d86e1368ab54U, (uint64_t)0x14429f04394f2U,
+    (uint64_t)0x353c3eee86778U, (uint64_t)0x797e122085254U, (uint64_t)0x5dcb2acc4850U,
+    (uint64_t)0xb2538616310bU, (uint64_t)0x278b9b2f84b25U, (uint64_t)0x1adbf057e54a4U,
+    (uint64_t)0x1fb426070d50fU, (uint64_t)0x228a4a3cdf9b3U, (uint64_t)0x342f399de1a30U,
+    (uint64_t)0x4369a69769d1U, (uint64_t)0xd259eb635c91U, (uint64_t)0x3966e2502aaa9U,
+    (uint64_t)0xaaba846341f8U, (uint64_t)0x5260385be8429U, (uint64_t)0x4164a69a476bdU,
+    (uint64_t)0x4c7f153c9ce4cU, (uint64_t)0x440c6a3b8e442U, (uint64_t)0x18e8239f60811U,
+    (uint64_t)0x3d894f1c3c8b5U, (uint64_t)0x5f63423c3e178U, (uint64_t)0xe7c04e05509dU,
+    (uint64_t)0xbdaf9c85e5e9U, (uint64_t)0x4e103a76fab14U, (uint64_t)0x5228fdb597f48U,
+    (uint64_t)0xe3c0fb135c34U, (uint64_t)0x6d3644b0a856fU, (uint64_t)0xf096724dfe05U,
+    (uint64_t)0x2841310cb74e9U, (uint64_t)0x5a04ae1195edfU, (uint64_t)0x31f9712c5e8b9U,
+    (uint64_t)0x5ba933287dfd0U, (uint64_t)0x29a0971654be4U, (uint64_t)0x66676743f3af8U,
+    (uint64_t)0x676667092118aU, (uint64_t)0x42d3860af76b1U, (uint64_t)0x1182ca41f6c5eU,
+    (uint64_t)0x1aa49ae2734f6U, (uint64_t)0x45206bc977d0dU, (uint64_t)0x3c714137c974fU,
+    (uint64_t)0x799fbc504fd52U, (uint64_t)0x685c319f7d1cU, (uint64_t)0x3dd367b6677bcU,
+    (uint64_t)0x4a2cde61767c0U, (uint64_t)0x52a837bc7a7bcU, (uint64_t)0x691478a411196U,
+    (uint64_t)0x22c6a8f5b56dfU, (uint64_t)0x2a6321814d453U, (uint64_t)0x1272a42f91f9bU,
+    (uint64_t)0x50d6460185d89U, (uint64_t)0x107b74acdb012U, (uint64_t)0x61abba8e471b4U,
+    (uint64_t)0x23270f5447242U, (uint64_t)0x7a21d2357bdfdU, (uint64_t)0x7d1965c77671fU,
+    (uint64_t)0x1e64086f3cd53U, (uint64_t)0x348b97ad2a847U, (uint64_t)0x1a4c92d172080U,
+    (uint64_t)0x5e3a31057d882U, (uint64_t)0x3f30ee695b236U, (uint64_t)0x55dbc0478370U,
+    (uint64_t)0x9eada30f7501U, (uint64_t)0x1823128308168U, (uint64_t)0x72aaab207d757U,
+    (uint64_t)0x414231531dd52U, (uint64_t)0x764617391058fU, (uint64_t)0x4c54348ee07cU,
+    (uint64_t)0x4d57770c3157cU, (uint64_t)0x72705c5a46a13U, (uint64_t)0x68a3708fe7912U,
+    (uint64_t)0x278966b88fccaU, (uint64_t)0x15f79b907161U, (uint64_t)0x746d3bdfe36d9U,
+    (uint64_t)0x16164ba51661fU, (uint64_t)0x4fbfdbab00559U, (uint64_t)0x265662d061c93U,
+    (uint64_t)0x4e01fa312f480U, (uint64_t)0x6ff073bb00eafU, (uint64_t)0x672d2a989fc1bU,
+    (uint64_t)0x68ffb955a83a0U, (uint64_t)0x3cb9885777938U, (uint64_t)0x6baed3382a74dU,
+    (uint64_t)0xe670fa94a30U, (uint64_t)0x46f8434c68cfeU, (uint64_t)0x4047938508e64U,
+    (uint64_t)0x5307d306de6e4U, (uint64_t)0x57f9f30ef1846U, (uint64_t)0x4bb6196df0d69U,
+    (uint64_t)0x5096e630652e3U, (uint64_t)0xebc38c54fd6aU, (uint64_t)0x3f23886763ce2U,
+    (uint64_t)0x49eb1af02c58fU, (uint64_t)0x282149b6f6856U, (uint64_t)0x7ed9f18eeeabU,
+    (uint64_t)0x4b3a1d9f2ef4U, (uint64_t)0x2bffe721fe54bU, (uint64_t)0x7b8a10d45dd14U,
+    (uint64_t)0x3a91e1fff0ce2U, (uint64_t)0x61f7cea74ef44U, (uint64_t)0x6aea2a856fa0eU,
+    (uint64_t)0x185647241a6acU, (uint64_t)0x1dfa014c2f526U, (uint64_t)0x4e2b92c1faa0cU,
+    (uint64_t)0x59a456a15db2bU, (uint64_t)0x14c053b040dfeU, (uint64_t)0xeb9cd0eed3c0U,
+    (uint64_t)0x1f8ef9fc8fe85U, (uint64_t)0x5673222a1e56eU, (uint64_t)0x39bcbf3e94e33U,
+    (uint64_t)0x7ec77091bc605U, (uint64_t)0x3f42495822383U, (uint64_t)0x1e3bac426f911U,
+    (uint64_t)0x2a1f1bd257e82U, (uint64_t)0x1c1a5d09f6c20U, (uint64_t)0x48fc0507690a9U,
+    (uint64_t)0x743240d99fd8bU, (uint64_t)0x9f4fac3d7fcdU, (uint64_t)0x6acd80f4e86b9U,
+    (uint64_t)0x23e152fe96ebU, (uint64_t)0x6518baedfba8eU, (uint64_t)0x674b4a4f04a46U,
+    (uint64_t)0x2239e6860b4f3U, (uint64_t)0xca1d534c759aU, (uint64_t)0x1d108fdfdb2beU,
+    (uint64_t)0x7388f7538996U, (uint64_t)0x7bca976c72c5U, (uint64_t)0x57aa3241160baU,
+    (uint64_t)0x5b2a72d22ff1U, (uint64_t)0x27d0377ec46f0U, (uint64_t)0x7de8b6c2630d9U,
+    (uint64_t)0x5c77bb5d37d53U, (uint64_t)0x18c108d565a62U, (uint64_t)0x488bfbbe1f5a9U,
+    (uint64_t)0x3aca7117c6198U, (uint64_t)0x78ad307ea1d91U, (uint64_t)0x55e212791a2dU,
+    (uint64_t)0x2f1d7a2ea683cU, (uint64_t)0x5011ef683123eU, (uint64_t)0x1283fe95fe601U,
+    (uint64_t)0x601b077b6cb16U, (uint64_t)0x76cb6b24ae3b4U, (uint64_t)0x6e228726ebd9U,
+    (uint64_t)0x2406e0ddac8fcU, (uint64_t)0x55e8daed3e58bU, (uint64_t)0x3d178feb4f27U,
+    (uint64_t)0x21058e60e49dbU, (uint64_t)0x546efb6bb4a4fU, (uint64_t)0x731f39e284f9U,
+    (uint64_t)0x6c67dbeed9192U, (uint64_t)0x3b75696730dc8U, (uint64_t)0x46016166deaa9U,
+    (uint64_t)0x151888330ec1eU, (uint64_t)0x5becfa2dU, (uint64_t)0x4e7f7cfcf532aU,
+    (uint64_t)0x34d031744cd2dU, (uint64_t)0x146254758179bU, (uint64_t)0x5731e56b6f739U,
+    (uint64_t)0x5b4f28e9ae5eU, (uint64_t)0x2f91383a4c25eU, (uint64_t)0xe843c13fb394U,
+    (uint64_t)0x31eebdf40de4U, (uint64_t)0x295b0c2597da2U, (uint64_t)0x42f0cc8de40bfU,
+    (uint64_t)0x600d242cbf639U, (uint64_t)0x71dd75fe35761U, (uint64_t)0x1533e9f88a411U,
+    (uint64_t)0x3775efc03676dU, (uint64_t)0x172d57e053ab6U, (uint64_t)0x71a1bc333df57U,
+    (uint64_t)0x39674a4532078U, (uint64_t)0x64f036287034fU, (uint64_t)0x3ba3e77409488U,
+    (uint64_t)0x6a99bc552d193U, (uint64_t)0x486151c8cefa2U, (uint64_t)0x54b7045971642U,
+    (uint64_t)0x71e0320587090U, (uint64_t)0x638ab1379164cU, (uint64_t)0x2320b7928b7aeU,
+    (uint64_t)0x730b85c0a6979U, (uint64_t)0x300d6b0bd6734U, (uint64_t)0x4a7bf5c55fc81U,
+    (uint64_t)0x531e97e1c57b8U, (uint64_t)0x6f2af4fea65f7U, (uint64_t)0x4863f8215c1e3U,
+    (uint64_t)0x40ca073d03431U, (uint64_t)0x45c14f2aa29f6U, (uint64_t)0x1b442f65d18b4U,
+    (uint64_t)0x16008e95533a5U, (uint64_t)0x107e6cbe0e7b1U, (uint64_t)0x19c5a9c3bddeaU,
+    (uint64_t)0x3b7ed36905232U, (uint64_t)0x4e227f866e886U, (uint64_t)0x26e92fe50d60fU,
+    (uint64_t)0x6b46c251a6794U, (uint64_t)0xceb59a95601dU, (uint64_t)0x3582b61615a85U,
+    (uint64_t)0x6f604bf141f32U, (uint64_t)0x415753f2693e5U, (uint64_t)0x676bc22136673U,
+    (uint64_t)0x1a781b6de1c34U, (uint64_t)0x75ddb29fb2429U, (uint64_t)0x3ae6942942869U,
+    (uint64_t)0x7a4ef3a1b0b45U, (uint64_t)0x65d4a43dabe3cU, (uint64_t)0x35071f8ce9984U,
+    (uint64_t)0x181168cbec8f9U, (uint64_t)0x6190b02fed2c7U, (uint64_t)0x349140f0bed60U,
+    (uint64_t)0x6141335703b29U, (uint64_t)0x42545a6a59885U, (uint64_t)0x315672c2eb507U,
+    (uint64_t)0x341e3cd307f73U, (uint64_t)0x2cb8182c4a75bU, (uint64_t)0x5edecf5134ddU,
+    (uint64_t)0x706406cdbd1ceU, (uint64_t)0x6f77cd5e9c03aU, (uint64_t)0x2f7ebd2c0f379U,
+    (uint64_t)0x3fc958e272ff1U, (uint64_t)0x1d35be483e063U, (uint64_t)0xa2d533a5de8dU,
+    (uint64_t)0x6cf68a8476ff2U, (uint64_t)0x730dca3a6c583U, (uint64_t)0x5996a3a3fe7e7U,
+    (uint64_t)0x143d193ccfb02U, (uint64_t)0x60fba0618ab41U, (uint64_t)0x7645080245d2fU,
+    (uint64_t)0x799d71734d711U, (uint64_t)0x1b4ce449fd612U, (uint64_t)0x7ff4231bd14d7U,
+    (uint64_t)0x50fee504978daU, (uint64_t)0x4a76a3f64184eU, (uint64_t)0x3e6fb7578d61eU,
+    (uint64_t)0x176243bf95955U, (uint64_t)0x2dbb3a80252a7U, (uint64_t)0x3aac54a8c82beU,
+    (uint64_t)0x78f89e18cfa41U, (uint64_t)0x2abedf1e4b904U, (uint64_t)0x1d4bdb6577be1U,
+    (uint64_t)0x7437ea227158bU, (uint64_t)0x7e97763970e96U, (uint64_t)0x7ca1146b6217U,
+    (uint64_t)0x5b4b15b0dcf3aU, (uint64_t)0x513b0ff4a4e31U, (uint64_t)0x747c600c8b746U,
+    (uint64_t)0xe85b4c08f01eU, (uint64_t)0x55dd63945053U, (uint64_t)0x405ccafceeafaU,
+    (uint64_t)0x7f497501028abU, (uint64_t)0x48d11b66b928eU, (uint64_t)0x239371214f23U,
+    (uint64_t)0x52a0b25764cb8U, (uint64_t)0x76bb5eda60567U, (uint64_t)0x11ebd9a6336e8U,
+    (uint64_t)0x4fdb604eb7a63U, (uint64_t)0x208622a2f72fU, (uint64_t)0x49cba531169f5U,
+    (uint64_t)0x6403c323153c3U, (uint64_t)0x3ed1677f04f91U, (uint64_t)0x682556c3bb6eeU,
+    (uint64_t)0x14467120e8a31U, (uint64_t)0x3cd1e140aa179U, (uint64_t)0xf041ceb99950U,
+    (uint64_t)0x33767c28a68a1U, (uint64_t)0x113bbda0667bU, (uint64_t)0xf638ca79d2e9U,
+    (uint64_t)0x711e441703a02U, (uint64_t)0x7ca9f9cd5846aU, (uint64_t)0x27ddb2c8b5f35U,
+    (uint64_t)0x5a8bb39d06710U, (uint64_t)0x6c1262e3f8a43U, (uint64_t)0x6f0d269c007fU,
+    (uint64_t)0x2d8bda0274fe9U, (uint64_t)0x5880aa13c7ec2U, (uint64_t)0x145cd46a84513U,
+    (uint64_t)0x193841cf1e0f5U, (uint64_t)0x1299d9bbc1909U, (uint64_t)0x71629c472bf67U,
+    (uint64_t)0x32c7f6728296cU, (uint64_t)0x5164a2d3a866U, (uint64_t)0x677401a6f8778U,
+    (uint64_t)0x36b8ff4eda202U, (uint64_t)0x7daa346bd67c1U, (uint64_t)0x2822a5801e36dU,
+    (uint64_t)0x4eaea25b067daU, (uint64_t)0x6222bd88bf2dfU, (uint64_t)0x6fa5782e45313U,
+    (uint64_t)0x117520560d1e3U, (uint64_t)0x6df13d5042d8U, (uint64_t)0x12eeb5ed7693U,
+    (uint64_t)0x325bb42ea4edU, (uint64_t)0x592e9b6740859U, (uint64_t)0x1d39897f0c5bfU,
+    (uint64_t)0x251580ec2af8U, (uint64_t)0x70563ccc07320U, (uint64_t)0x628b09e2c7d3aU,
+    (uint64_t)0x2aa2d8bdba597U, (uint64_t)0x337727e412228U, (uint64_t)0x682a0453a101bU,
+    (uint64_t)0x262572fd31592U, (uint64_t)0x23bc7abc84cbU, (uint64_t)0x511df0f29c9eeU,
+    (uint64_t)0x1e58c41b9ddb0U, (uint64_t)0x5c81ba413e52eU, (uint64_t)0x58a64a8101b8eU,
+    (uint64_t)0x4d2b97a739eceU, (uint64_t)0x320ab2c14539aU, (uint64_t)0x137b00f01661fU,
+    (uint64_t)0x5b6edcf358ad2U, (uint64_t)0x4243cb28d0446U, (uint64_t)0x2be24dbdd7a46U,
+    (uint64_t)0x7640e33263467U, (uint64_t)0x4d99d421b1000U, (uint64_t)0x229877cb2a32aU,
+    (uint64_t)0x20e2cd45a4e5U, (uint64_t)0x132a065edb5c4U, (uint64_t)0x5fa3e1dd7de2fU,
+    (uint64_t)0x3863fd1d4b30cU, (uint64_t)0x7973f46ce42c3U, (uint64_t)0x3c03b16b5bdc2U,
+    (uint64_t)0x534ef70a3532fU, (uint64_t)0x25b0e72ecf407U, (uint64_t)0x5e9b86d31f29eU,
+    (uint64_t)0x717e3d7ee0972U, (uint64_t)0x2d2ea94ab733aU, (uint64_t)0x13de9f98824e0U,
+    (uint64_t)0x633fbbd39d169U, (uint64_t)0x2de1deb9e1897U, (uint64_t)0x1cb211e5ff1a1U,
+    (uint64_t)0x252cc055229dbU, (uint64_t)0x6d5066cf7137bU, (uint64_t)0x347115219a417U,
+    (uint64_t)0x68445d52b6b96U, (uint64_t)0x2e0615fe54802U, (uint64_t)0x3e441d5f1ad5fU,
+    (uint64_t)0x54bb8cd82a0a8U, (uint64_t)0xead868ab7c70U, (uint64_t)0x37519f2944719U,
+    (uint64_t)0x239bc7c2a540bU, (uint64_t)0x7330e4f203f15U, (uint64_t)0x609142e130e7fU,
+    (uint64_t)0x2429c7b04c2cdU, (uint64_t)0x1f7334164ea0eU, (uint64_t)0x2e82a3d8f00c4U,
+    (uint64_t)0x49a3fac10ad3aU, (uint64_t)0x35ff8f7cdb086U, (uint64_t)0x49cbaa6ce8b8aU,
+    (uint64_t)0x2fbfc351521f8U, (uint64_t)0x6ed81ad386d5cU, (uint64_t)0x782aa34f434a9U,
+    (uint64_t)0x50e1cc6871155U, (uint64_t)0x289b38c30e3d7U, (uint64_t)0xa98bfd31710bU,
+    (uint64_t)0x6dec6dcfff0edU, (uint64_t)0x4a8cc50bd6ec3U, (uint64_t)0x330c0a7ed1b12U,
+    (uint64_t)0x2120a622e0213U, (uint64_t)0x4928e70b4255eU, (uint64_t)0x20ca395004af1U,
+    (uint64_t)0x137b5a74383cdU, (uint64_t)0x6c6365c17f4bbU, (uint64_t)0x1499e5494c782U,
+    (uint64_t)0x54c171a7d6061U, (uint64_t)0x2a7b2382370ccU, (uint64_t)0x4b4641905002bU,
+    (uint64_t)0x1c5703a9d3d1aU, (uint64_t)0x2125c8b8f0450U, (uint64_t)0x68a693333f97eU,
+    (uint64_t)0x4db1dc8b06120U, (uint64_t)0x1547ff45b5efeU, (uint64_t)0x397f5db80e233U,
+    (uint64_t)0x44c675bd887d1U, (uint64_t)0x309183c31e772U, (uint64_t)0x1f3aa0d1e7794U,
+    (uint64_t)0x2965c1800a0dfU, (uint64_t)0x68b818a50b31dU, (uint64_t)0xe4dfed398826U,
+    (uint64_t)0x2a6b5bb8ee8e5U, (uint64_t)0x5b63d0e5a1659U, (uint64_t)0x35914773a6ba9U,
+    (uint64_t)0x1e8b233ec0076U, (uint64_t)0x795099c995b42U, (uint64_t)0x350ab19851e94U,
+    (uint64_t)0x4657c36d323bfU, (uint64_t)0x14e89c4af4304U, (uint64_t)0x76724d74dba8eU,
+    (uint64_t)0x3e8be859362a9U, (uint64_t)0x285b6b601c94eU, (uint64_t)0x277aacb4ea942U,
+    (uint64_t)0x6a71a039dbb31U, (uint64_t)0x6b66159ac8702U, (uint64_t)0x61a22c8ca96c5U,
+    (uint64_t)0x644c063cebfdU, (uint64_t)0x110cae7398c22U, (uint64_t)0x282724d9d2eacU,
+    (uint64_t)0x19dd4bef38efdU, (uint64_t)0x356e7c4fdc3U, (uint64_t)0x6cce9df96746aU,
+    (uint64_t)0x231226afcf26fU, (uint64_t)0xe6a709a55008U, (uint64_t)0x667fbacce0dc3U,
+    (uint64_t)0x3ce90b2f23e9fU, (uint64_t)0x6c6fba067cc9bU, (uint64_t)0x5a6d491d9c150U,
+    (uint64_t)0x2d93a15d07e01U, (uint64_t)0x1f6a1fd8cc0e0U, (uint64_t)0x865869605e19U,
+    (uint64_t)0x3859d2657a634U, (uint64_t)0x2a19102ea1749U, (uint64_t)0x4d4d98e077c3aU,
+    (uint64_t)0x779964401ee86U, (uint64_t)0x63a6ddb180345U, (uint64_t)0x5678db00bad68U,
+    (uint64_t)0x4ecad44b3ff9eU, (uint64_t)0x3dd942354571eU, (uint64_t)0xb0009de53ceeU,
+    (uint64_t)0x35cbbfd4f326cU, (uint64_t)0x3ee294ccc91b7U, (uint64_t)0x353e636b68de4U,
+    (uint64_t)0x502fd3833e7f6U, (uint64_t)0x6f0a87af6e0f4U, (uint64_t)0x1248c6c6e36c6U,
+    (uint64_t)0x3c99a44d7cc01U, (uint64_t)0x21f30757f285dU, (uint64_t)0x13ee5e5b52174U,
+    (uint64_t)0x6b60138135059U, (uint64_t)0x7cba818f0a0c8U, (uint64_t)0x119e553f5d8a3U,
+    (uint64_t)0x6f59b8911d495U, (uint64_t)0x30ec7963d2395U, (uint64_t)0x277e75c04a57fU,
+    (uint64_t)0x6af0a0fcd15f4U, (uint64_t)0x5d8829faa2d69U, (uint64_t)0x59b2d11d2184cU,
+    (uint64_t)0x6192b3a4edb35U, (uint64_t)0x398c8c8c8e8daU, (uint64_t)0x5ef111a7459caU,
+    (uint64_t)0x743e76b873eedU, (uint64_t)0x7da788d05038fU, (uint64_t)0x132d6dfd110e8U,
+    (uint64_t)0x7fc5e88a596b4U, (uint64_t)0x25850d4b94340U, (uint64_t)0x337829774ea07U,
+    (uint64_t)0x7aa4baa035b01U, (uint64_t)0x6a9c59d10e369U, (uint64_t)0x6a01ead173188U,
+    (uint64_t)0x3134a847a0564U, (uint64_t)0x26d734dd61ed8U, (uint64_t)0x1d5d36768c9adU,
+    (uint64_t)0x6841d9eb25d62U, (uint64_t)0x1f90c7ef4610dU, (uint64_t)0x1a1c8ce3a2f7bU,
+    (uint64_t)0x6c5088246078fU, (uint64_t)0x25f03d3f7fef3U, (uint64_t)0x55cbd09e1e658U,
+    (uint64_t)0x63344ccbe4169U, (uint64_t)0x7c14da9611f84U, (uint64_t)0x535a758351a36U,
+    (uint64_t)0x6a07769f19f8fU, (uint64_t)0x39918ae86d2ddU, (uint64_t)0x5b58e9a13a3ccU,
+    (uint64_t)0x59fd686603f08U, (uint64_t)0x5ae148dbd3c5eU, (uint64_t)0x768558f36db1aU,
+    (uint64_t)0x48da4f4ae0be3U, (uint64_t)0x3d22b58c663eaU, (uint64_t)0x2b63fb03b0eb2U,
+    (uint64_t)0x73e96f8ef32e8U, (uint64_t)0x45daaf6a02597U, (uint64_t)0x39399ec5ff106U,
+    (uint64_t)0x7240c7e82ba83U, (uint64_t)0x3bad00a4ed035U, (uint64_t)0x66b25aeb67183U,
+    (uint64_t)0x7837743c8e4c2U, (uint64_t)0x4b9b4513da086U, (uint64_t)0x17d0a611501ebU,
+    (uint64_t)0x45e86f1900608U, (uint64_t)0x1fbe96f3948ecU, (uint64_t)0x6f302c3bdfd3dU,
+    (uint64_t)0x799f280c2de8dU, (uint64_t)0x6e6c09db77eedU, (uint64_t)0xeceb9c916f07U,
+    (uint64_t)0x49ea727e1b83cU, (uint64_t)0x6273e2eeb6666U, (uint64_t)0x171f72b4fc831U,
+    (uint64_t)0x5640b667ac2d7U, (uint64_t)0x2c01148e1f3e4U, (uint64_t)0x51c425711432aU,
+    (uint64_t)0x6c182e4447f6fU, (uint64_t)0x2b27cc4cc22e9U, (uint64_t)0x7f4eec076f3b8U,
+    (uint64_t)0x9339d2475746U, (uint64_t)0x64fafff9a96a0U, (uint64_t)0x64bc3ddbb71e1U,
+    (uint64_t)0x401aa64372298U, (uint64_t)0xa8728e5d7851U, (uint64_t)0x7d41cded490c8U,
+    (uint64_t)0x612647ee1199dU, (uint64_t)0x4195596834dfeU, (uint64_t)0x38151f531081cU,
+    (uint64_t)0x7ef39552f5076U, (uint64_t)0x2c8f1e0cf253dU, (uint64_t)0xb5f94d24808fU,
+    (uint64_t)0x56b1d1d6e8785U, (uint64_t)0x5aefaf367ab15U, (uint64_t)0x76ef0d6c063d5U,
+    (uint64_t)0x633092dd34e07U, (uint64_t)0x49ce7d7c1ba41U, (uint64_t)0x2b7a22c02deabU,
+    (uint64_t)0xd4941a46bd55U, (uint64_t)0x47ac42e7c5948U, (uint64_t)0x9bb58f7a8924U,
+    (uint64_t)0x6a3da0c80785eU, (uint64_t)0x6ba5d3ceca93U, (uint64_t)0x75f50ae5fe8bU,
+    (uint64_t)0x28a6c1d1356c1U, (uint64_t)0x4637d0c8db427U, (uint64_t)0x710c2f2b88baU,
+    (uint64_t)0x331ebb992a859U, (uint64_t)0x59a89c85de81U, (uint64_t)0x75614a27f57dbU,
+    (uint64_t)0x1d2b7be4610f4U, (uint64_t)0x7af44ecbd9daU, (uint64_t)0xf3d96a079370U,
+    (uint64_t)0x29a10cebd576fU, (uint64_t)0x608de273a9f6aU, (uint64_t)0x6d841f67144faU,
+    (uint64_t)0x1f09d66e26b18U, (uint64_t)0x5eaa723731e58U, (uint64_t)0x40d589897d941U,
+    (uint64_t)0x3b31d0113f98dU, (uint64_t)0x4ceecee1b44a8U, (uint64_t)0x563b7af463258U,
+    (uint64_t)0x2e04fb6ecdb7eU, (uint64_t)0x720002f0a3d51U, (uint64_t)0x41a571f633073U,
+    (uint64_t)0x3a3011634d581U, (uint64_t)0x6f27d928a5d52U, (uint64_t)0x2d7e560b44606U,
+    (uint64_t)0x31f977b27d505U, (uint64_t)0x8d1e75a33bf3U, (uint64_t)0x7b5ccae42cf1aU,
+    (uint64_t)0x4da0b6b78872eU, (uint64_t)0x449c557409d64U, (uint64_t)0x520f54e1ec44eU,
+    (uint64_t)0x47dd939350f06U, (uint64_t)0x434b14fbeb6f9U, (uint64_t)0x2db91535249cdU,
+    (uint64_t)0x3dcb0cbf75061U, (uint64_t)0x57c401033942dU, (uint64_t)0x302853df2cba5U,
+    (uint64_t)0x43f0dfd1da83eU, (uint64_t)0x4113b0ddf4e1U, (uint64_t)0x53381c4548146U,
+    (uint64_t)0x6514dd84675fbU, (uint64_t)0x4b55df555ef78U, (uint64_t)0x66e8cdcd6194dU,
+    (uint64_t)0x5ab028755a609U, (uint64_t)0x3cb9a10526f5U, (uint64_t)0x5a95174bf6017U,
+    (uint64_t)0x2faebe97416b3U, (uint64_t)0x27445acc6496U, (uint64_t)0x6782f693655e9U,
+    (uint64_t)0x6a8cd5b9861b0U, (uint64_t)0x578cccecb3c25U, (uint64_t)0x348119c5c585eU,
+    (uint64_t)0x5aa1c6d51c96fU, (uint64_t)0x5dc4287f214beU, (uint64_t)0x13b82b3f59239U,
+    (uint64_t)0x50514de60f291U, (uint64_t)0xb2fcb60a19e6U, (uint64_t)0x144a1f33239dcU,
+    (uint64_t)0xf2bf6f1878bdU, (uint64_t)0x77897a0d0d4d1U, (uint64_t)0x1c336bb5a6349U,
+    (uint64_t)0x6301b568e9c61U, (uint64_t)0x1767ba9159506U, (uint64_t)0x57df5fa7ac109U,
+    (uint64_t)0x214b365c4017eU, (uint64_t)0x765dd92ee632bU, (uint64_t)0x2b763e30bf6e3U,
+    (uint64_t)0x28dd62ec76eU, (uint64_t)0xb1d7e690987U, (uint64_t)0x6c62c01be597eU,
+    (uint64_t)0x38a7726f51b21U, (uint64_t)0x6d187e11aedfdU, (uint64_t)0x464f0c1ce745U,
+    (uint64_t)0x2ac3a1782fc5cU, (uint64_t)0x4f978c41c144bU, (uint64_t)0x620513ea91bfcU,
+    (uint64_t)0x3607198a1819dU, (uint64_t)0x10f47c2129fd3U, (uint64_t)0xa02acd47d87U,
+    (uint64_t)0x2715b707968c5U, (uint64_t)0x495a74165e473U, (uint64_t)0x16affe7f532c6U,
+    (uint64_t)0x4d99764529a1fU, (uint64_t)0x553a4cdea2103U, (uint64_t)0x3a5dfe90cce4eU,
+    (uint64_t)0x475ba8c2ecdb1U, (uint64_t)0x4db4418f87f77U, (uint64_t)0x513e93e82a813U,
+    (uint64_t)0x1bb59f9403d75U, (uint64_t)0x7b71eb1db3dfU, (uint64_t)0x540312aa76437U,
+    (uint64_t)0x5140b9860c78eU, (uint64_t)0x33a1308112a6cU, (uint64_t)0x69766b0bf7e89U,
+    (uint64_t)0x1918274226d47U, (uint64_t)0x4d45c52d519cbU, (uint64_t)0xfe52219a0caeU,
+    (uint64_t)0x31dda40465406U, (uint64_t)0x650beb1c1a888U, (uint64_t)0x123a5c9259b42U,
+    (uint64_t)0x6c6ccb8df73b6U, (uint64_t)0x6e1a9bb685adaU, (uint64_t)0x39e6aca5e83e8U,
+    (uint64_t)0x6a3e7c5796320U, (uint64_t)0x5007541e92105U, (uint64_t)0x546cf963e1f5fU,
+    (uint64_t)0x31ef82c7b281aU, (uint64_t)0xf393dba889fdU, (uint64_t)0x1fe546e404461U,
+    (uint64_t)0x3354b7213155dU, (uint64_t)0x6d454e42d3aa6U, (uint64_t)0x13efddc558a2aU,
+    (uint64_t)0x48f4c0dd3ae27U, (uint64_t)0x1f15ca78fbd46U, (uint64_t)0x6d058c362496fU,
+    (uint64_t)0x66413f5ffbad1U, (uint64_t)0xb216ceec26c5U, (uint64_t)0x7aa2a5312bac3U,
+    (uint64_t)0x5d14aaf0335aeU, (uint64_t)0x4e245bb0a1d80U, (uint64_t)0xc79262bd1fc8U,
+    (uint64_t)0x563053b0dec55U, (uint64_t)0x6b7e7fe7e3222U, (uint64_t)0x5099deb290a51U,
+    (uint64_t)0x7f3db2e46de32U, (uint64_t)0x3a4fb628f12b0U, (uint64_t)0x69755a4fb685cU,
+    (uint64_t)0x62dfd0af81ce5U, (uint64_t)0x5682fae1ebeafU, (uint64_t)0x5574666fbf845U,
+    (uint64_t)0x2b64be05f9894U, (uint64_t)0x69d98b5ecc35dU, (uint64_t)0x481f8259f4e8eU,
+    (uint64_t)0x3702a9aa1c5aaU, (uint64_t)0x23fa52f3a4a9aU, (uint64_t)0x355a270651d92U,
+    (uint64_t)0x3e26d487fbfe3U, (uint64_t)0x51d536d8afbbfU, (uint64_t)0x6f48eafebc18U,
+    (uint64_t)0x71e6450da9ce3U, (uint64_t)0x5959108dacc6dU, (uint64_t)0x5854c9f58054aU,
+    (uint64_t)0x76ad49dd4b6d9U, (uint64_t)0x7b3c20580ee15U, (uint64_t)0x1c0cc9b92b446U,
+    (uint64_t)0x3acfba0e3c49U, (uint64_t)0x62a8a839f4566U, (uint64_t)0x48b613555bf3bU,
+    (uint64_t)0x1182aa75d12e8U, (uint64_t)0x18044a657f4efU, (uint64_t)0x1e14e88e58f4bU,
+    (uint64_t)0x3d45d6c61b8a0U, (uint64_t)0x8b31465ba1bU, (uint64_t)0x2af6b660fe67U,
+    (uint64_t)0x795f0095038a9U, (uint64_t)0x2d524f77c957bU, (uint64_t)0x145a41a23df0dU,
+    (uint64_t)0x5144ba1ee3347U, (uint64_t)0x338d704ba14abU, (uint64_t)0x790cd10cc448aU,
+    (uint64_t)0x4d146bf59d4bfU, (uint64_t)0x5ff031a9e8f4aU, (uint64_t)0x27f6f65c163f9U,
+    (uint64_t)0x6aedfe81ae652U, (uint64_t)0x9bae0494b6b8U, (uint64_t)0x5582075728af7U,
+    (uint64_t)0x67c7ce2874df5U, (uint64_t)0x3cb55b5673259U, (uint64_t)0x19b53291712bU,
+    (uint64_t)0x24dc0e3139b3cU, (uint64_t)0x338f72b3aae0aU, (uint64_t)0x75ecf07c0c77dU,
+    (uint64_t)0x30dccb2500e7eU, (uint64_t)0x7bda84b6e34cdU, (uint64_t)0x6884bf3c2b2beU,
+    (uint64_t)0x1f988f46d271fU, (uint64_t)0x4e1c036204e12U, (uint64_t)0x561736f1bb1c8U,
+    (uint64_t)0x3e4af4fa1a4e7U, (uint64_t)0x93da4cbc39cdU, (uint64_t)0x53151564827ecU,
+    (uint64_t)0x6a5908d961f00U, (uint64_t)0x68512b3bc9322U, (uint64_t)0xc7707ae616b2U,
+    (uint64_t)0x65f13e8ce8b4U, (uint64_t)0x3bc8eb8780eb0U, (uint64_t)0x4357ac2eb50feU,
+    (uint64_t)0x2db65174136b3U, (uint64_t)0x781add46ba081U, (uint64_t)0xa50b0787eacdU,
+    (uint64_t)0x238301afa0ea1U, (uint64_t)0x2ec3414992964U, (uint64_t)0x33c31999aba40U,
+    (uint64_t)0x7ba81c7c73674U, (uint64_t)0x60583c9cb93f0U, (uint64_t)0x51662ae1e2a53U,
+    (uint64_t)0x2ecb17530e69eU, (uint64_t)0x7799847a8a270U, (uint64_t)0x15720dc40f8ddU,
+    (uint64_t)0x5e1d36cc21d76U, (uint64_t)0x11f994a867b01U, (uint64_t)0x70c567bd1568aU,
+    (uint64_t)0x2520ab77d56f3U, (uint64_t)0xaa1c5c41aa31U, (uint64_t)0xa4e157873e5bU,
+    (uint64_t)0x226534ec05356U, (uint64_t)0x1216d39000ebeU, (uint64_t)0xf4fa151fd1d4U,
+    (uint64_t)0x334c93c7047cfU, (uint64_t)0xc93b40ed2f43U, (uint64_t)0x1deb821d55c89U,
+    (uint64_t)0x374132be82d97U, (uint64_t)0x625c4973427faU, (uint64_t)0x77e8270d2b056U,
+    (uint64_t)0x63d7c03dfb1a9U, (uint64_t)0x692b60e7ac998U, (uint64_t)0x1ce35e30d78b5U,
+    (uint64_t)0x7f0362dedb022U, (uint64_t)0x4f58fd7218c8cU, (uint64_t)0x4160a0bb8284aU,
+    (uint64_t)0x3f301cb4c06e8U, (uint64_t)0x3cbe5d79f358cU, (uint64_t)0x6dd1a92e82034U,
+    (uint64_t)0xc1d093c5ed2dU, (uint64_t)0x2f9b316b3b557U, (uint64_t)0x1731c87ed1911U,
+    (uint64_t)0x2aaa635d3e22cU, (uint64_t)0x3c085e0b9d040U, (uint64_t)0x706958b0f90a6U,
+    (uint64_t)0x6cc9b195f148aU, (uint64_t)0x4576b3a357fd3U, (uint64_t)0x6f33204b9f2baU,
+    (uint64_t)0x8e2ff8552d6fU, (uint64_t)0x644dbbd47631eU, (uint64_t)0x79ae397fbd745U,
+    (uint64_t)0x79d24a3240869U, (uint64_t)0x7fe8906b455e9U, (uint64_t)0xb97b336976d3U,
+    (uint64_t)0x3ad6534ddce08U, (uint64_t)0x128fb06357743U, (uint64_t)0x2818101d89bf5U,
+    (uint64_t)0x1300ff9d28f13U, (uint64_t)0x1824581edecdeU, (uint64_t)0x7c07f152c58fU,
+    (uint64_t)0x566be162abb24U, (uint64_t)0x7da48c4660f60U, (uint64_t)0x1d90390cbd518U,
+    (uint64_t)0x45ceb3b5775d0U, (uint64_t)0x71709f92a0ac2U, (uint64_t)0x2a7d6afd28c7aU,
+    (uint64_t)0x64b6d414a0a90U, (uint64_t)0x51f4ff8c599b1U, (uint64_t)0x406b0d7863ac1U,
+    (uint64_t)0x700fa97a36ff0U, (uint64_t)0x14bbad2c4ba01U, (uint64_t)0xf9fb7ccd771cU,
+    (uint64_t)0x35ac9588d46e4U, (uint64_t)0x3720708d6c911U, (uint64_t)0x2b202ee9611fbU,
+    (uint64_t)0x959bfc3200c5U, (uint64_t)0x1757dc4a338d9U, (uint64_t)0x4da02f54da58fU,
+    (uint64_t)0x29b6a71bf9741U, (uint64_t)0x1dccd7f1e7d8eU, (uint64_t)0x149a0be95a5b0U,
+    (uint64_t)0x31fb1e040b0ecU, (uint64_t)0x568de690133caU, (uint64_t)0x5b123773039e8U,
+    (uint64_t)0x7e9ae87c7a37fU, (uint64_t)0x3996d0e96eb9U, (uint64_t)0x323a0ee6e219dU,
+    (uint64_t)0x4c48220992e8eU, (uint64_t)0x7dbc4170a98efU, (uint64_t)0x490c233d200dU,
+    (uint64_t)0x278c99ed09838U, (uint64_t)0x1fbc3bdd9dc86U, (uint64_t)0x4090f6ebf75e7U,
+    (uint64_t)0x206c8b59f5785U, (uint64_t)0x4df5e07e8f3f6U, (uint64_t)0x5f659be6ec6a7U,
+    (uint64_t)0x3193a84b2d27cU, (uint64_t)0x4f2f4b477f6caU, (uint64_t)0x269d9359e934U,
+    (uint64_t)0x4b847999e4a90U, (uint64_t)0x4118b05ab8e14U, (uint64_t)0x21cd0b6990453U,
+    (uint64_t)0x13115f873b8a8U, (uint64_t)0x7361dbbb4a6a6U, (uint64_t)0x5de82b4cb21faU,
+    (uint64_t)0x2507ccd64a55U, (uint64_t)0x78a18d4b37b64U, (uint64_t)0x602c6bf1bc222U,
+    (uint64_t)0x30cc4663403daU, (uint64_t)0x61f36a4978dceU, (uint64_t)0x48df3d3a54a05U,
+    (uint64_t)0x10ef7a35c4feeU, (uint64_t)0x3342c4717d552U, (uint64_t)0x5c6a85b6937c5U,
+    (uint64_t)0xcd0dcc3f9493U, (uint64_t)0x1f7499c735fa9U, (uint64_t)0x29b46aa6678fdU,
+    (uint64_t)0x50676cdf00c93U, (uint64_t)0x2b47afd50b8bbU, (uint64_t)0x6e87341ba7247U,
+    (uint64_t)0x411974b578a0U, (uint64_t)0x7ee4de1829600U, (uint64_t)0x2d3c40a10b4a4U,
+    (uint64_t)0x30fb8f1eccccbU, (uint64_t)0x283e91bedd33fU, (uint64_t)0x2235667e8bf41U,
+    (uint64_t)0x7685498387eddU, (uint64_t)0x282a400973b64U, (uint64_t)0x62dd27aa84686U,
+    (uint64_t)0x23c1862a18feaU, (uint64_t)0x31aff366b3a83U, (uint64_t)0x549acae4ff00dU,
+    (uint64_t)0x5a8a95d8ceddbU, (uint64_t)0x4bded88f6988aU, (uint64_t)0x53b47817f7390U,
+    (uint64_t)0x43a187ebc4d1bU, (uint64_t)0x585f14a833db9U, (uint64_t)0x7cfc2fe7c8d4eU,
+    (uint64_t)0x29d9ed297dbd3U, (uint64_t)0x1d030c6eca418U, (uint64_t)0x7c356254aecceU,
+    (uint64_t)0x106a1f2de6054U, (uint64_t)0x7aaf48f59f15cU, (uint64_t)0x1896bf1a58d6eU,
+    (uint64_t)0x11d1c1269b58dU, (uint64_t)0x798b78e2a3c2bU, (uint64_t)0x1c61b0a4e31dfU,
+    (uint64_t)0x2765ba6a9e766U, (uint64_t)0x86d5b16ac088U, (uint64_t)0x3194de2e85fbaU,
+    (uint64_t)0x706e16ece3444U, (uint64_t)0x510dbf955a7d1U, (uint64_t)0x3e86b7756eccdU,
+    (uint64_t)0x5979baa2329b4U, (uint64_t)0x19a93ef8737a9U, (uint64_t)0x46e5644cdd17dU,
+    (uint64_t)0x1aae72fc62ac4U, (uint64_t)0x336498fbd2b4U, (uint64_t)0x8a7c5dd5cbd8U,
+    (uint64_t)0x25ffe91b3543cU, (uint64_t)0x26c427ebf83f5U, (uint64_t)0x673f2258e1bcbU,
+    (uint64_t)0x653338b616279U, (uint64_t)0x718dd49593f4bU, (uint64_t)0x5e7c15c7bdd1eU,
+    (uint64_t)0x40921f0d3724U, (uint64_t)0x21c89d7c8cf85U, (uint64_t)0x2dfe0c21696c0U,
+    (uint64_t)0x3a45d29424d9aU, (uint64_t)0x77229b1550dedU, (uint64_t)0x48807bcdb7f49U,
+    (uint64_t)0x19eac75c6e662U, (uint64_t)0x3396978bfc50bU, (uint64_t)0xca4ac8073393U,
+    (uint64_t)0x794fbb7b5763aU, (uint64_t)0x41f332d14fab1U, (uint64_t)0x13ee5ce9adfc8U,
+    (uint64_t)0x5ccf1359113c1U, (uint64_t)0x730edb0eb0649U, (uint64_t)0x702e81737ef11U,
+    (uint64_t)0x24014668a61ecU, (uint64_t)0x25cd14e2b9c26U, (uint64_t)0x5c6b84dc5ed5aU,
+    (uint64_t)0x748aa01d5a90fU, (uint64_t)0x79743464cc509U, (uint64_t)0x26c605e0047a9U,
+    (uint64_t)0x609348312c42bU, (uint64_t)0x1924416956ea2U, (uint64_t)0x1fb8adaf021deU,
+    (uint64_t)0x3304d5919b716U, (uint64_t)0x3ae233f1f6dccU, (uint64_t)0x6e9037db7f74bU,
+    (uint64_t)0xc8e28127b7dcU, (uint64_t)0x7c2c14e41f85U, (uint64_t)0x243784111782aU,
+    (uint64_t)0x40193b41abdb3U, (uint64_t)0x5f56376f7186dU, (uint64_t)0x543fd67342dedU,
+    (uint64_t)0x2ff28ce974493U, (uint64_t)0x6937edeb88807U, (uint64_t)0x36263ee101dafU,
+    (uint64_t)0x6a4f62b81c676U, (uint64_t)0x2898ffaab663eU, (uint64_t)0x3bc46f335163dU,
+    (uint64_t)0x69f49f6d8de96U, (uint64_t)0x64d155f984e83U, (uint64_t)0x23bf3aceb5e5cU,
+    (uint64_t)0x94f3b96ab6c9U, (uint64_t)0x46e0b1dbc48d2U, (uint64_t)0x18ad36309efa0U,
+    (uint64_t)0x4214c0c701979U, (uint64_t)0x3e838aa567ceaU, (uint64_t)0x3537a8c91eeebU,
+    (uint64_t)0x6d2e98c19a76aU, (uint64_t)0x7097054a99d7fU, (uint64_t)0x49d1cf2973b62U,
+    (uint64_t)0x3d7b6d0bb4e8dU, (uint64_t)0x59de4b2305d8bU, (uint64_t)0x7e2f9f1dbe4d5U,
+    (uint64_t)0x4b382e4dd288eU, (uint64_t)0x7b29b90c5af84U, (uint64_t)0x4c227f0d32316U,
+    (uint64_t)0x4078b0875ce14U, (uint64_t)0x3ff69c641eebfU, (uint64_t)0x549ae14a1f12fU,
+    (uint64_t)0x3f8f145c40bc2U, (uint64_t)0x1881cf88a2479U, (uint64_t)0x56531dfed4c46U,
+    (uint64_t)0x14f12016bf75aU, (uint64_t)0x648f2908e182aU, (uint64_t)0x5f335dc5b006U,
+    (uint64_t)0x882eaeac87b3U, (uint64_t)0x34e2ddf511570U, (uint64_t)0x3ac585c1fd926U,
+    (uint64_t)0x741f0b87a4071U, (uint64_t)0x3361a39b5ff0cU, (uint64_t)0x38bbbaac7ba29U,
+    (uint64_t)0x1bdaea88b78ebU, (uint64_t)0x3fa9cb6a6dfe4U, (uint64_t)0x3cf1f30103d3dU,
+    (uint64_t)0x6df170acf388bU, (uint64_t)0x29d0691074eddU, (uint64_t)0x1bfbbb0b5ccc2U,
+    (uint64_t)0x1b303eaac5b05U, (uint64_t)0x4d791447cb32fU, (uint64_t)0x58b15e1815afeU,
+    (uint64_t)0x4a7e15c91a795U, (uint64_t)0x55eaf5fea101cU, (uint64_t)0x632fc1e0e6d82U,
+    (uint64_t)0x565caf3ff6523U, (uint64_t)0x213481073d8a9U, (uint64_t)0x63f189534493aU,
+    (uint64_t)0x644f4f10c2a13U, (uint64_t)0x365fd747a90e7U, (uint64_t)0xa09245f7cbe5U,
+    (uint64_t)0x73e92b6f00499U, (uint64_t)0x7ca44025bb30U, (uint64_t)0x17be9e863ebbaU,
+    (uint64_t)0x12093400eeab6U, (uint64_t)0xeb508c2d46afU, (uint64_t)0x1a7b5bddfe5b4U,
+    (uint64_t)0x5f8663b12868eU, (uint64_t)0x5726e2adc5bbdU, (uint64_t)0x57d966b0ee8cfU,
+    (uint64_t)0x21b35279a24fdU, (uint64_t)0x3be197a1262a5U, (uint64_t)0x782c4877c786bU,
+    (uint64_t)0x79735f155fd92U, (uint64_t)0x30f24bbba4be5U, (uint64_t)0x22dc1aeffa9efU,
+    (uint64_t)0x1e72e1c8150dcU, (uint64_t)0x262061299dbaaU, (uint64_t)0x519995d0c8177U,
+    (uint64_t)0x7c6b674fd1963U, (uint64_t)0x3d72f92ba5324U, (uint64_t)0x2606b6ff7387dU,
+    (uint64_t)0x7d0a2401f886fU, (uint64_t)0x2fab7584f9ebaU, (uint64_t)0x1da2698c7f981U,
+    (uint64_t)0x531652ca579ebU, (uint64_t)0x2c8dd914863b9U, (uint64_t)0x2246d7a27ad58U,
+    (uint64_t)0x27b70248f415fU, (uint64_t)0x73c1ff6c5290eU, (uint64_t)0x5aef91950bc60U,
+    (uint64_t)0x754f622235617U, (uint64_t)0x773127b360383U, (uint64_t)0x77c85c2671ce5U,
+    (uint64_t)0x69fedfe165cc8U, (uint64_t)0x154f3e97ecac4U, (uint64_t)0x3761e3297fa14U,
+    (uint64_t)0x12aac61a7674cU, (uint64_t)0x4cb56bd83d7bbU, (uint64_t)0x4a7fa15a03865U,
+    (uint64_t)0x61370d89d71f6U, (uint64_t)0x66a2ba9357a94U, (uint64_t)0x48a29adec0d4fU,
+    (uint64_t)0x5d1f6fb463251U, (uint64_t)0x79e2ed8660ad9U, (uint64_t)0x5b69da44e189bU,
+    (uint64_t)0x42f2d70bc34feU, (uint64_t)0x269bc6168b537U, (uint64_t)0x2f554ee36c10aU,
+    (uint64_t)0x1d364fc3a757bU, (uint64_t)0x26b33493bafc5U, (uint64_t)0x416cd4a9ed2fdU,
+    (uint64_t)0x1428d0b57e1d5U, (uint64_t)0x4339fa86a2324U, (uint64_t)0x5fe8a63a34b0eU,
+    (uint64_t)0x553b7a27e2b14U, (uint64_t)0x44205c101d9feU, (uint64_t)0x48b05df5dccbaU,
+    (uint64_t)0x6d07cc3462baeU, (uint64_t)0xbf15e84849dU, (uint64_t)0x72b86554f4523U,
+    (uint64_t)0x18ddba2455778U, (uint64_t)0x6a2af02f7dacU, (uint64_t)0x4dcb635e79d0bU,
+    (uint64_t)0x64e9736c701ebU, (uint64_t)0x4f74581abf576U, (uint64_t)0x29bfef3795591U,
+    (uint64_t)0x72b1cc6e98276U, (uint64_t)0x62332ee4f8ee5U, (uint64_t)0x74bc89fb8ef65U,
+    (uint64_t)0x6b25369243fb4U, (uint64_t)0x5e7ca6c2b5a08U, (uint64_t)0x7cfbf3517a3f8U,
+    (uint64_t)0x3e1bfb3c0218cU, (uint64_t)0xd3dc0daa12e8U, (uint64_t)0x3992e6be0b7e4U,
+    (uint64_t)0x78d0ffdc532feU, (uint64_t)0x6422166d53332U, (uint64_t)0x6b4c0d91dcf57U,
+    (uint64_t)0x2396aef810769U, (uint64_t)0x3272ba4e64da3U, (uint64_t)0x5df47a5a5db18U,
+    (uint64_t)0x6e6a42ff580c8U, (uint64_t)0x33287cd3c57f3U, (uint64_t)0x46fea1c371cdeU,
+    (uint64_t)0x1eac66533d582U, (uint64_t)0x4b3dd317dc0d6U, (uint64_t)0x44d98937f95fbU,
+    (uint64_t)0x70f3e2be18824U, (uint64_t)0x7dca6a6e7b2b3U, (uint64_t)0x60cb1a6504b48U,
+    (uint64_t)0x713ed3813e50U, (uint64_t)0x36d03e28c21faU, (uint64_t)0x67ec78897c972U,
+    (uint64_t)0x4d15140c88b2fU, (uint64_t)0x54553c816355U, (uint64_t)0x6fe5decbc6485U,
+    (uint64_t)0x7a79e9fb6abfbU, (uint64_t)0x7b9e0081b2e20U, (uint64_t)0x3f1fcc42b858cU,
+    (uint64_t)0x2f098844f3d15U, (uint64_t)0x7e5f69a1be8e8U, (uint64_t)0x4a6902b81b7f9U,
+    (uint64_t)0x93854716ef97U, (uint64_t)0x6f6b57e400f15U, (uint64_t)0x6af23bf13fe34U,
+    (uint64_t)0x40a70989fcce3U, (uint64_t)0x6630f507a1d7cU, (uint64_t)0x3b80b63b1d3e2U,
+    (uint64_t)0x64d47a7c2e55bU, (uint64_t)0x3c06252c62301U, (uint64_t)0x3531bc0abc846U,
+    (uint64_t)0x57ac3e1e537e1U, (uint64_t)0x1c70927aa306eU, (uint64_t)0x5654a077444f0U,
+    (uint64_t)0x24dcdd6382196U, (uint64_t)0x6d36009a3a1c3U, (uint64_t)0x19f2ae05d7a61U,
+    (uint64_t)0x2e259ec780da0U, (uint64_t)0xc542f4cb893dU, (uint64_t)0x1f237c749902eU,
+    (uint64_t)0x4ae0d47bec2eeU, (uint64_t)0x4daa47b6d570cU, (uint64_t)0x1241a6e46e774U,
+    (uint64_t)0x14989f13c72ecU, (uint64_t)0x3937f6987889cU, (uint64_t)0x30225657ad7feU,
+    (uint64_t)0x7541db44db135U, (uint64_t)0x1e22f8e8551eaU, (uint64_t)0x117e4d3609883U,
+    (uint64_t)0x665de1adb5d80U, (uint64_t)0x6ab19361681c7U, (uint64_t)0x4786c1529cc3U,
+    (uint64_t)0x121fd5fd0c3abU, (uint64_t)0x165b168a61530U, (uint64_t)0x3be5e0df7208aU,
+    (uint64_t)0x71c062fcb9b5bU, (uint64_t)0x5964763b529b7U, (uint64_t)0x6a243e5c6fd01U,
+    (uint64_t)0x62a41118f91aU, (uint64_t)0xe4448cc3464cU, (uint64_t)0x5aab3a49c1610U,
+    (uint64_t)0x3c20812138b8fU, (uint64_t)0x6237e93647e5eU, (uint64_t)0x5165245f5b2fbU,
+    (uint64_t)0x560ada6d8f2ebU, (uint64_t)0xc39412f9561cU, (uint64_t)0x7862aec0bca41U,
+    (uint64_t)0x438c3caf8e404U, (uint64_t)0x4e46d8c498822U, (uint64_t)0x1d970cbe58918U,
+    (uint64_t)0x157bc8b6af02dU, (uint64_t)0x50585711b59f6U, (uint64_t)0x27639bb44bc3U,
+    (uint64_t)0x15e2fa8742940U, (uint64_t)0x7b727de748f3fU, (uint64_t)0x221a66ab0c4cfU,
+    (uint64_t)0x148f99690bb8fU, (uint64_t)0x7ecfa6b215265U, (uint64_t)0x37da46c4720c6U,
+    (uint64_t)0x7dbe06b7d4c79U, (uint64_t)0x1081f39b60620U, (uint64_t)0x57f2abdbf300cU,
+    (uint64_t)0x10958b5cdaf36U, (uint64_t)0x54f14b851a6beU, (uint64_t)0x401fc18eff580U,
+    (uint64_t)0x2b09d8d578e28U, (uint64_t)0x75d9ef0d6a641U, (uint64_t)0x4f731b6407452U,
+    (uint64_t)0x71359b6e6424U, (uint64_t)0x6c664206679cfU, (uint64_t)0x22c56e66dcfc4U,
+    (uint64_t)0x6a7f6a6e7b496U, (uint64_t)0x4da4821314574U, (uint64_t)0x70759a40a6e65U,
+    (uint64_t)0x6cdc3e94d7e42U, (uint64_t)0x36adb918af2d7U, (uint64_t)0x1690294de49d1U,
+    (uint64_t)0x314016034673dU, (uint64_t)0x17bf6701aef73U, (uint64_t)0x5e0da0cd2d24dU,
+    (uint64_t)0x38034c6b548c7U, (uint64_t)0x439f71a0d5572U, (uint64_t)0x10616d6cef8e9U,
+    (uint64_t)0x5a1bd156d734cU, (uint64_t)0x300c481626b89U, (uint64_t)0x607fad6c71e2U,
+    (uint64_t)0x4ed332aeca1aaU, (uint64_t)0x22423cb8e8212U, (uint64_t)0x223156f08cdb4U,
+    (uint64_t)0x4fe3a3da44163U, (uint64_t)0x33a7bcd15cf1eU, (uint64_t)0x4c75b1cfb5bbbU,
+    (uint64_t)0x627dcf9be9be7U, (uint64_t)0x158b82405747fU, (uint64_t)0x5f1fd7400d8deU,
+    (uint64_t)0x1e443263a7ecdU, (uint64_t)0x56106b700df9eU, (uint64_t)0x66ec04859b42eU,
+    (uint64_t)0x1bafd72fc5b92U, (uint64_t)0x43c72af94dfbeU, (uint64_t)0x350af500fa4fdU,
+    (uint64_t)0x29f1926edec90U, (uint64_t)0x32beb4e36411fU, (uint64_t)0x1fc9e7901786U,
+    (uint64_t)0x77a0725ad54a2U, (uint64_t)0x3684d67a69b10U, (uint64_t)0x4281e5cd0730dU,
+    (uint64_t)0x425a36157c40bU, (uint64_t)0x5cc7474c2127bU, (uint64_t)0x1c03850cda86aU,
+    (uint64_t)0x6ee01b252b7a9U, (uint64_t)0x508e65ca67598U, (uint64_t)0x5698b7e0062efU,
+    (uint64_t)0x104dcab320bb4U, (uint64_t)0x32ea163c42aaaU, (uint64_t)0xae44e8d5ce26U,
+    (uint64_t)0x4e0bb7524f3ffU, (uint64_t)0x4230253b946fU, (uint64_t)0x558741d1e5afcU,
+    (uint64_t)0x2e7d2ef71f4d2U, (uint64_t)0x7bd5e98b5e4ecU, (uint64_t)0x1cf3726858122U,
+    (uint64_t)0x4db9dd92f8d9U, (uint64_t)0x334af45d936aU, (uint64_t)0x7e966dcb661b9U,
+    (uint64_t)0x79899e7910541U, (uint64_t)0x35a64a089f906U, (uint64_t)0x5dc5794033b13U,
+    (uint64_t)0x33c62b35f9f4fU, (uint64_t)0x763ca1ca9ea10U, (uint64_t)0x7328952fd0e0bU,
+    (uint64_t)0x336f7f1a11b08U, (uint64_t)0x65f711807e588U, (uint64_t)0x616d7f9d9637aU,
+    (uint64_t)0x27a164e67fa6aU, (uint64_t)0x52357e95fd6bU, (uint64_t)0x69112a118ad5fU,
+    (uint64_t)0x66f79ccc68c4U, (uint64_t)0x194b14e70e84bU, (uint64_t)0xbd3b7d9c53c5U,
+    (uint64_t)0x7e18472bbfd67U, (uint64_t)0x59b2995d25c76U, (uint64_t)0x44d6deeeca512U,
+    (uint64_t)0x2a4052f89d69aU, (uint64_t)0x649357afed0a3U, (uint64_t)0x458a2dac848a9U,
+    (uint64_t)0x123f4425ee350U, (uint64_t)0x115b217ea5058U, (uint64_t)0x4137e9279f1aU,
+    (uint64_t)0x4f53cd9217a50U, (uint64_t)0x76434fad97c1bU, (uint64_t)0x3a3cde89779beU,
+    (uint64_t)0xd6e86f3a086bU, (uint64_t)0x2833aa49e326U, (uint64_t)0xa016265371f7U,
+    (uint64_t)0x2d45f9e70d625U, (uint64_t)0x76a896974bf81U, (uint64_t)0x2289c3bda5c99U,
+    (uint64_t)0x4a0b1d181a9aaU, (uint64_t)0x2b698a3a2fda3U, (uint64_t)0x7f3967193c8cU,
+    (uint64_t)0x22ae5f667f08dU, (uint64_t)0x1e90739a6bbf8U, (uint64_t)0x5f82287b7869cU,
+    (uint64_t)0x5566279a9314U, (uint64_t)0x35a7f8324bc4aU, (uint64_t)0x165289fe924ecU,
+    (uint64_t)0x43299d9738472U, (uint64_t)0x33fa160bd0c08U, (uint64_t)0x20d603755d35dU,
+    (uint64_t)0x450c442bf68f5U, (uint64_t)0x5b782496b15a5U, (uint64_t)0x6435675cc362dU,
+    (uint64_t)0x691589756d7c0U, (uint64_t)0x60c77d3e9e13bU, (uint64_t)0x782f1750e1a0eU,
+    (uint64_t)0x54745dfbae079U, (uint64_t)0x63b06e648bf7aU, (uint64_t)0x249be08bae16U,
+    (uint64_t)0x6e11a18488b8dU, (uint64_t)0x75361fff589eeU, (uint64_t)0xdf8d967ea85bU,
+    (uint64_t)0x1b17d88ed9954U, (uint64_t)0x58c5961a52582U, (uint64_t)0x349612b4b1c83U,
+    (uint64_t)0x5f62cc80cb364U, (uint64_t)0x30ec527e5fb90U, (uint64_t)0x6771b61006b51U,
+    (uint64_t)0x47ae60b7e824U, (uint64_t)0x1385ce47cbf90U, (uint64_t)0x538a682639a17U,
+    (uint64_t)0x1964a969cc270U, (uint64_t)0x4c27afff3c45fU, (uint64_t)0x2bd114bf5a66bU,
+    (uint64_t)0x3ca349893cb77U, (uint64_t)0x30a70ea4342f8U, (uint64_t)0x43ecaf88f5b13U,
+    (uint64_t)0x5f2c99e6526dcU, (uint64_t)0x731c946f1338aU, (uint64_t)0x4ccc75b53d3cU,
+    (uint64_t)0x6492da851e192U, (uint64_t)0x17ea70ab0003U, (uint64_t)0x5a164fd0bf46U,
+    (uint64_t)0x7d1b43224e085U, (uint64_t)0x651f7f44d3f9dU, (uint64_t)0x1f5bb93da54b1U,
+    (uint64_t)0x57bd040abfbc8U, (uint64_t)0x786be30733efdU, (uint64_t)0x30712c63e2736U,
+    (uint64_t)0x7d673ad37c9d5U, (uint64_t)0x3f4211ca9f022U, (uint64_t)0x42d9a138766eaU,
+    (uint64_t)0x653a5f772f349U, (uint64_t)0x4e817719f64c8U, (uint64_t)0x2aaf757adc018U,
+    (uint64_t)0x74f63b25b13b9U, (uint64_t)0x74586c8334d2dU, (uint64_t)0x12c73ed34d313U,
+    (uint64_t)0x5ca89f193c7c7U, (uint64_t)0x190eadb296624U, (uint64_t)0x613c26eba92ebU,
+    (uint64_t)0x28e517e9d52c5U, (uint64_t)0x9c186afb8339U, (uint64_t)0x49a357f7b062fU,
+    (uint64_t)0x577daa9fe2346U, (uint64_t)0x61928780aa0a9U, (uint64_t)0x1a9c9a34ad8a4U,
+    (uint64_t)0x6137b0746027bU, (uint64_t)0x562410e8ef362U, (uint64_t)0x7e7115a47163U,
+    (uint64_t)0x63082b8bba0edU, (uint64_t)0x6c576f02a36f1U, (uint64_t)0x572c78d37f263U,
+    (uint64_t)0x22f04c2eaa13U, (uint64_t)0x57d69a3366d97U, (uint64_t)0x72376731a9341U,
+    (uint64_t)0x499efc4abc0adU, (uint64_t)0x21fee4804968aU, (uint64_t)0xd3e930901700U,
+    (uint64_t)0x7512e5846260cU, (uint64_t)0x2160ce6f694d9U, (uint64_t)0x28ea0b62ed0a8U,
+    (uint64_t)0x500b7740072cbU, (uint64_t)0xa584e1b381f8U, (uint64_t)0x2dc40f2fe1bb0U,
+    (uint64_t)0x7a252afa919c4U, (uint64_t)0x7f8344713f782U, (uint64_t)0x198588f68c188U,
+    (uint64_t)0x1e3a2b12d4f17U, (uint64_t)0x4b2e7932aa923U, (uint64_t)0x22727a3b68433U,
+    (uint64_t)0x415c09f01b2eU, (uint64_t)0x4a2e1f96eee4eU, (uint64_t)0x4b832ac846fc4U,
+    (uint64_t)0x22e66b4cc889aU, (uint64_t)0x77c36a3708a79U, (uint64_t)0x62dc64a88c45fU,
+    (uint64_t)0x6c3f24822e185U, (uint64_t)0xb2d34c797678U, (uint64_t)0x6b7b48f082a56U,
+    (uint64_t)0x320892791968aU, (uint64_t)0x130d94db67890U, (uint64_t)0x2ddebaccef8ddU,
+    (uint64_t)0x1449ec0ec3464U, (uint64_t)0x54da0a6d415e8U, (uint64_t)0x27490d51894c3U,
+    (uint64_t)0x3a33578cadec3U, (uint64_t)0x5dbd3bf95494dU, (uint64_t)0x4e1c737e25b77U,
+    (uint64_t)0x54f6f73f1826fU, (uint64_t)0x264aae68d0b38U, (uint64_t)0x5d8431e6c6054U,
+    (uint64_t)0x56f5f77776e9fU, (uint64_t)0x4643a2e2f2569U, (uint64_t)0x611669774e72U,
+    (uint64_t)0x6e17d81aef50eU, (uint64_t)0x60a92020f5168U, (uint64_t)0x5844f533bb02bU,
+    (uint64_t)0xbadc76ed5685U, (uint64_t)0x35fa4ebc2326eU, (uint64_t)0x5dc73aed63804U,
+    (uint64_t)0x1e078f96abefcU, (uint64_t)0x4b3702044575dU, (uint64_t)0x27acd289b820U,
+    (uint64_t)0x1f5f99c524904U, (uint64_t)0x581aabf8db72cU, (uint64_t)0x17a97a13d4072U,
+    (uint64_t)0x54333c50acf33U, (uint64_t)0x271da3c1535e8U, (uint64_t)0x50808b29d87a9U,
+    (uint64_t)0x11653cf3c08eU, (uint64_t)0xee45253cfdc0U, (uint64_t)0x1d1cecdf260f8U,
+    (uint64_t)0x7136e1146b3dfU, (uint64_t)0x59e3baac9c516U, (uint64_t)0x25223e30d62b6U,
+    (uint64_t)0x5b57250cc032fU, (uint64_t)0x77fe8a5d490afU, (uint64_t)0x5c5afa5f50246U,
+    (uint64_t)0x7c146a8b74daeU, (uint64_t)0x48636448ab327U, (uint64_t)0x18b45600199caU,
+    (uint64_t)0x3c530f01e039fU, (uint64_t)0x566861b52ad2cU, (uint64_t)0x752b00120dfc5U,
+    (uint64_t)0x73bad60eb6373U, (uint64_t)0x40fc2927931ffU, (uint64_t)0x25a2c58c77260U,
+    (uint64_t)0x7fd3a6196e3d6U, (uint64_t)0x284949203f37dU, (uint64_t)0x476c5437b216cU,
+    (uint64_t)0x706c3c52af457U, (uint64_t)0x7b8d2c823baafU, (uint64_t)0x14483f8af0c85U,
+    (uint64_t)0x3291ef9e8bb29U, (uint64_t)0x7868197c6d14fU, (uint64_t)0x7cdc4f68ad9e1U,
+    (uint64_t)0x1c45a557b3624U, (uint64_t)0x243e17f2697b6U, (uint64_t)0x5193306c619f8U,
+    (uint64_t)0x52ca05f976318U, (uint64_t)0x61a001a75b2f3U, (uint64_t)0x5247683ea1bdcU,
+    (uint64_t)0x51c3cd099c188U, (uint64_t)0x73201e27df68bU, (uint64_t)0x3731a5654bcdaU,
+    (uint64_t)0x679c6f128856fU, (uint64_t)0x5fa2b1dfec51bU, (uint64_t)0x9b7d23a1682eU,
+    (uint64_t)0x217e84f70ad28U, (uint64_t)0x14b5cbd03592eU, (uint64_t)0x45eb26f10d929U,
+    (uint64_t)0x3f81faa56dc38U, (uint64_t)0x79648b1b75f99U, (uint64_t)0x398a8defa7801U,
+    (uint64_t)0x594ba852306a8U, (uint64_t)0x4d5b971c1fdc1U, (uint64_t)0x59fa62b248848U,
+    (uint64_t)0x2c70bc7009528U, (uint64_t)0x63ed4991c551U, (uint64_t)0x1696a5aa08d84U,
+    (uint64_t)0x64cd2d131eacbU, (uint64_t)0x3780a1d4b6b5aU, (uint64_t)0x15fea238825feU,
+    (uint64_t)0x2cca59dedb077U, (uint64_t)0x3bcee6378c63U, (uint64_t)0x2c65b7e4f9b48U,
+    (uint64_t)0x3aa8dc131e632U, (uint64_t)0x61e216a70b5fU, (uint64_t)0x6de776b42af80U,
+    (uint64_t)0x162b5d5bdf418U, (uint64_t)0x3ff30994d6a3aU, (uint64_t)0x671d58200407U,
+    (uint64_t)0x6668a7b47fdfbU, (uint64_t)0x6fdf04c85cf33U, (uint64_t)0x4261b63dbb087U,
+    (uint64_t)0x2c3501eebe18U, (uint64_t)0x1f878c9bb777aU, (uint64_t)0x1553da8e44755U,
+    (uint64_t)0x69c15c3b56684U, (uint64_t)0x2fd62e7176fabU, (uint64_t)0x6fa0d18c49562U,
+    (uint64_t)0x59479937cae12U, (uint64_t)0x1347979dbcdc4U, (uint64_t)0x4f87f8d2d6662U,
+    (uint64_t)0x37ac81a8ace57U, (uint64_t)0x2f7aa336b752aU, (uint64_t)0x659e12450355U,
+    (uint64_t)0x5571a8e1c47ffU, (uint64_t)0x33ab17ab47cbeU, (uint64_t)0x74678e2fb0c24U,
+    (uint64_t)0x52b1f350c7eaeU, (uint64_t)0x58458308ef6c0U, (uint64_t)0x626fc2bb1c02eU,
+    (uint64_t)0x64d7ddcd0c1faU, (uint64_t)0x8c25c9d513a0U, (uint64_t)0x5bc4b24a96867U,
+    (uint64_t)0x259d664d2b336U, (uint64_t)0x29edb737d6b6cU, (uint64_t)0x348b34e92504fU,
+    (uint64_t)0x4a5a9867c7d3aU, (uint64_t)0xae6be2f31c97U, (uint64_t)0x123678f80408dU,
+    (uint64_t)0x3ff13e0665cb0U, (uint64_t)0x294f79a7ca0ecU, (uint64_t)0x401440d01f5e6U,
+    (uint64_t)0xafc7b8ce2b99U, (uint64_t)0x333f8eef2b1f7U, (uint64_t)0x7f4107b4c7b5aU,
+    (uint64_t)0x650ff8676ce10U, (uint64_t)0x7b888c25eca86U, (uint64_t)0x7d51b6b254d8cU,
+    (uint64_t)0x131883d8fc4caU, (uint64_t)0x35495a3d912e4U, (uint64_t)0x4a2321ff009c2U,
+    (uint64_t)0x280aacd6385d5U, (uint64_t)0x59fd85f0a9f8dU, (uint64_t)0xc03c46e2dff7U,
+    (uint64_t)0x622afd443ec39U, (uint64_t)0x423d5404492f3U, (uint64_t)0x4239477208a1bU,
+    (uint64_t)0x251f6c0eb46adU, (uint64_t)0x7b10e1d26d95fU, (uint64_t)0x6817ca6919549U,
+    (uint64_t)0x1a4913e350c0bU, (uint64_t)0x40ac9fda7c686U, (uint64_t)0x19ee4a0633fecU,
+    (uint64_t)0x36663875e8dd1U, (uint64_t)0x4e8a91edf58a4U, (uint64_t)0x2913d9526ec6cU,
+    (uint64_t)0x739cd949695b3U, (uint64_t)0x28507c07998aU, (uint64_t)0x57d9ebf8c914aU,
+    (uint64_t)0x5a949c163cac7U, (uint64_t)0x64c9b4fcaa8a6U, (uint64_t)0x77ab0cbdd401cU,
+    (uint64_t)0x79d5908cdac3aU, (uint64_t)0x8e60479f7f51U, (uint64_t)0x6e1fa4b22fa46U,
+    (uint64_t)0x2ecf74cff92dfU, (uint64_t)0x17e42186f9f12U, (uint64_t)0x6e6d908adfa77U,
+    (uint64_t)0x1b2b6c48c2eeaU, (uint64_t)0x28f0f792833c8U, (uint64_t)0x74137e0a79a43U,
+    (uint64_t)0x5b18fa591cadeU, (uint64_t)0x4c3bc9aab89ddU, (uint64_t)0xd0f6b8d10c3eU,
+    (uint64_t)0x778185eed3f91U, (uint64_t)0x89181a58467U, (uint64_t)0x3475a3ba7efa0U,
+    (uint64_t)0x625d74f2bac1bU, (uint64_t)0x2b556bbc070b5U, (uint64_t)0x184e1d7174d6fU,
+    (uint64_t)0x665dfb2162f1bU, (uint64_t)0x303e86cfc66d6U, (uint64_t)0x6c497006ed9b4U,
+    (uint64_t)0x7ba01332807ebU, (uint64_t)0xf3cadc018c2cU, (uint64_t)0x5f48a8b4c4768U,
+    (uint64_t)0x4c710a53d128eU, (uint64_t)0x6abe689eb3600U, (uint64_t)0x58366c2ab7fc9U,
+    (uint64_t)0x4444af406f1aU, (uint64_t)0x83da01b1e876U, (uint64_t)0x707fa3974642fU,
+    (uint64_t)0x7027c48ae62f9U, (uint64_t)0x3f5c47b490be4U, (uint64_t)0x132fef32c3bb0U,
+    (uint64_t)0x408b75547e0eeU, (uint64_t)0xe72d53aa36a1U, (uint64_t)0x10a6945f95a08U,
+    (uint64_t)0x537ce98e07428U, (uint64_t)0x20eb873b0fd8U, (uint64_t)0x7677ab4ecad6bU,
+    (uint64_t)0x1001554fc9ae9U, (uint64_t)0x45c599ecd05e9U, (uint64_t)0x5ed1f70065a08U,
+    (uint64_t)0x18fc98dc1aeb0U, (uint64_t)0x40f375deeef57U, (uint64_t)0x4ff89abd6a0f2U,
+    (uint64_t)0x59222a5f1802eU, (uint64_t)0x1e2b1d5578437U, (uint64_t)0x5a06716d6b801U,
+    (uint64_t)0x634f48b1c3722U, (uint64_t)0x27c4a2cbddcdcU, (uint64_t)0x469331b639ffaU,
+    (uint64_t)0x41c6747ff756aU, (uint64_t)0x66f1efc5aca5eU, (uint64_t)0x721b7d41dd01bU,
+    (uint64_t)0x4a13209b9bf80U, (uint64_t)0x3bc157b813d96U, (uint64_t)0x6c387efacf3deU,
+    (uint64_t)0x4dd30a8b4f85dU, (uint64_t)0x23b195a74a719U, (uint64_t)0x5cb5244c6cbe3U,
+    (uint64_t)0x325411da52b82U, (uint64_t)0x614118e22068cU, (uint64_t)0x51229478dd419U,
+    (uint64_t)0x176a8ef02360cU, (uint64_t)0x5521417ea968fU, (uint64_t)0x76115c6cb99d4U,
+    (uint64_t)0x63ebe5283599fU, (uint64_t)0x7ffe019722993U, (uint64_t)0x6b4a1cce303f7U,
+    (uint64_t)0x204ca468545d1U, (uint64_t)0x6c6a640a0f9c4U, (uint64_t)0x57fc742e19edbU,
+    (uint64_t)0x12e2aef773c8aU, (uint64_t)0x1842ec3c8d6fdU, (uint64_t)0x3cc4861ad5071U,
+    (uint64_t)0x1d842a007882bU, (uint64_t)0x233475488522fU, (uint64_t)0x56b97a812b288U,
+    (uint64_t)0x4b7bc1f58e553U, (uint64_t)0x7597adf006ac4U, (uint64_t)0x38a9f01dca3caU,
+    (uint64_t)0x37e8d773be2a4U, (uint64_t)0x65a51e2aec609U, (uint64_t)0x1d72b27e9ee13U,
+    (uint64_t)0x2a8b02d22be1cU, (uint64_t)0x5baa71c0629f8U, (uint64_t)0x7c131b100a061U,
+    (uint64_t)0x7037bcd22844cU, (uint64_t)0x471b3dc4be217U, (uint64_t)0x6a69cf343bc94U,
+    (uint64_t)0x696cd252f3afcU, (uint64_t)0x318ac05007ad4U, (uint64_t)0x3aac8823222a2U,
+    (uint64_t)0x1a3859eafe3aaU, (uint64_t)0x766da90b03c67U, (uint64_t)0x4139a3a954bbdU,
+    (uint64_t)0x6bf5a299dfb3fU, (uint64_t)0x619a7c8248798U, (uint64_t)0x6a38c51002e89U,
+    (uint64_t)0x492498bccf13U, (uint64_t)0x2dc27769df231U, (uint64_t)0x718c9556422ecU,
+    (uint64_t)0x3fccb0d152c96U, (uint64_t)0x992ba098058eU, (uint64_t)0x521be0be8427dU,
+    (uint64_t)0x4d5af7f7c5351U, (uint64_t)0x1b76bf6bdb257U, (uint64_t)0x6761efd0c3948U,
+    (uint64_t)0x5e84e4ea6cae0U, (uint64_t)0x7c0fbb51669a1U, (uint64_t)0x718798b9f1069U,
+    (uint64_t)0x502f67ac28825U, (uint64_t)0x1eb427b959a4aU, (uint64_t)0x3e180dbdf5523U,
+    (uint64_t)0x2646638863a38U, (uint64_t)0xeec95786aae3U, (uint64_t)0x640721e47d66dU,
+    (uint64_t)0x4f4d8ef3f3fb1U, (uint64_t)0x560ca0c14167fU, (uint64_t)0x902c55c148a4U,
+    (uint64_t)0x7e60c3caffc12U, (uint64_t)0x13aea1849989fU, (uint64_t)0xc101c2b81f44U,
+    (uint64_t)0x4820c00aaa326U, (uint64_t)0x49795c19cb5b2U, (uint64_t)0x5b87deedff90dU,
+    (uint64_t)0x884949c8ca12U, (uint64_t)0x7dd4f765a027eU, (uint64_t)0x15cf50eb4a496U,
+    (uint64_t)0x25d216199ac4bU, (uint64_t)0x100a56c3e63b0U, (uint64_t)0x2260a9cbdfb5eU,
+    (uint64_t)0x4341a5f3da1aU, (uint64_t)0xdd4e3cefdf85U, (uint64_t)0x1034cbb3164efU,
+    (uint64_t)0x1e6a23789d9f6U, (uint64_t)0x1cd96ef237b21U, (uint64_t)0x4a5ccd60dbe3U,
+    (uint64_t)0x18e26ce7de1e3U, (uint64_t)0x5f3b62d047daU, (uint64_t)0x5afcbbb9327afU,
+    (uint64_t)0x7a626aeb91efcU, (uint64_t)0x1dda75a4ca750U, (uint64_t)0x77e45bd12177dU,
+    (uint64_t)0x6233d9f3c7b1aU, (uint64_t)0x5604ea5dd5c4U, (uint64_t)0x6e769cd81a091U,
+    (uint64_t)0x5810897a24a18U, (uint64_t)0x7d07e19989065U, (uint64_t)0x3ed6d325437b1U,
+    (uint64_t)0x62b3325404c7dU, (uint64_t)0x275d04f2b3510U, (uint64_t)0x62e5a06b8b93bU,
+    (uint64_t)0x2347386f0587fU, (uint64_t)0x5218f6a9a707cU, (uint64_t)0x75e5316ef56cdU,
+    (uint64_t)0x57dd6527da326U, (uint64_t)0x137c301aa4eebU, (uint64_t)0x5b2038466db08U,
+    (uint64_t)0x18838c156af50U, (uint64_t)0x246f9615799a5U, (uint64_t)0x4dfc3c993e8afU,
+    (uint64_t)0x5a501bb5309c5U, (uint64_t)0x1a75986e32bc5U, (uint64_t)0x7614d69097315U,
+    (uint64_t)0x45c3cca33a9b8U, (uint64_t)0x5dc17a1192ddfU, (uint64_t)0x6f21cad653d78U,
+    (uint64_t)0x385731096c7d0U, (uint64_t)0x487b74578e2b3U, (uint64_t)0x90717cbfe980U,
+    (uint64_t)0x68538e31bee79U, (uint64_t)0x639f1d4b39be1U, (uint64_t)0x70d539b3960ceU,
+    (uint64_t)0x4879ec602fd75U, (uint64_t)0x5379a90dca8aU, (uint64_t)0x5fb9b0051910cU,
+    (uint64_t)0x42e7d31374f84U, (uint64_t)0x6ed6540f0f5b7U, (uint64_t)0xd5d53bad7ff0U,
+    (uint64_t)0x39d0c8555ef53U, (uint64_t)0x3c3b6a92efb1bU, (uint64_t)0x460396d94b23bU,
+    (uint64_t)0x6c763503cfdd5U, (uint64_t)0x514aa5015721dU, (uint64_t)0x583d89174c05cU,
+    (uint64_t)0x126d49709e40cU, (uint64_t)0x74f6271dda548U, (uint64_t)0x54645a74df59U,
+    (uint64_t)0x2af69c87b26ebU, (uint64_t)0x2eef1181154a0U, (uint64_t)0x30c7cce660084U,
+    (uint64_t)0x3883000762536U, (uint64_t)0x58d8af1db21feU, (uint64_t)0x40c920c3a655cU,
+    (uint64_t)0x2cd4c1a16f7fdU, (uint64_t)0x4962227254243U, (uint64_t)0x41925fd7ce64fU,
+    (uint64_t)0x4393bf3f965fbU, (uint64_t)0x63f4f071176fdU, (uint64_t)0x6730d561b7734U,
+    (uint64_t)0xb370634de2b0U, (uint64_t)0x714d5e69e0071U, (uint64_t)0x5acdb88bba00bU,
+    (uint64_t)0x478d6b7fd4a85U, (uint64_t)0x29c11e1973ec7U, (uint64_t)0x284468a4a7e91U,
+    (uint64_t)0x54ca8847818fdU, (uint64_t)0x62e9cb4cb2dcfU, (uint64_t)0x70544ba129867U,
+    (uint64_t)0x1aeb58a790994U, (uint64_t)0x2201bfeff7515U, (uint64_t)0x2fde64c624ba4U,
+    (uint64_t)0x7be5f903e40eeU, (uint64_t)0x6e8a9d9a1f04aU, (uint64_t)0x4050b8fd8b2faU,
+    (uint64_t)0x2af4f8c0bfb03U, (uint64_t)0x6c890063b1743U, (uint64_t)0x1e9f9667e2276U,
+    (uint64_t)0x58041a1f70529U, (uint64_t)0x5411d31d96f03U, (uint64_t)0x5b5181462933U,
+    (uint64_t)0x69e8a4550bbb3U, (uint64_t)0x55bc5555266d1U, (uint64_t)0x9571894ea475U,
+    (uint64_t)0x3285919343bbfU, (uint64_t)0x13e4b9507e542U, (uint64_t)0x2d4bb274a03d8U,
+    (uint64_t)0x22d5abfbda6dbU, (uint64_t)0x2a96fb7475a56U, (uint64_t)0x3853cbd45cda5U,
+    (uint64_t)0x79cf2e8f8e6b9U, (uint64_t)0x444cca031d743U, (uint64_t)0x4330aaebadeffU,
+    (uint64_t)0x1c6046ce2d3a1U, (uint64_t)0x599c55e84480U, (uint64_t)0x1059bc969038bU,
+    (uint64_t)0x11de45b556055U, (uint64_t)0x4ce13eb73a98eU, (uint64_t)0xcb8a80b26a16U,
+    (uint64_t)0x583d2954f6724U, (uint64_t)0x3cde77866cc73U, (uint64_t)0x7437e967a18f7U,
+    (uint64_t)0x656c9df8ab52aU, (uint64_t)0x74d4b5f93c801U, (uint64_t)0x263b8fb42db69U,
+    (uint64_t)0x79f2b3d77f3f4U, (uint64_t)0x2a84b4b9ccfcaU, (uint64_t)0x5e5d0832c9459U,
+    (uint64_t)0x2f99b1500f926U, (uint64_t)0x32daff8575fefU, (uint64_t)0x273f1c9748beeU,
+    (uint64_t)0x3945652014031U, (uint64_t)0x31dca5551450bU, (uint64_t)0x2aad73634142bU,
+    (uint64_t)0x5fbc3dbd51c17U, (uint64_t)0x543d84cb04fb2U, (uint64_t)0x32ba4de59ef20U,
+    (uint64_t)0x293485d85cdd2U, (uint64_t)0xac9d611bd0b7U, (uint64_t)0x24f349ec1c78cU,
+    (uint64_t)0x358fdc5b63edU, (uint64_t)0x7264a03982220U, (uint64_t)0x3bbe31ab4fcb8U,
+    (uint64_t)0x3803239a9578aU, (uint64_t)0x1361e4d03539eU, (uint64_t)0x45a56cc3f4b7U,
+    (uint64_t)0xe1fb4f605ea1U, (uint64_t)0x68129eaa3ed4eU, (uint64_t)0x60718d8ce56U,
+    (uint64_t)0x25a521392830cU, (uint64_t)0x2ac4c0386a42U, (uint64_t)0x74860d7de3877U,
+    (uint64_t)0x4aa9ff50e9e00U, (uint64_t)0x487eddffd0cc3U, (uint64_t)0x2f23583d97f83U,
+    (uint64_t)0x1a36c19fc30eU, (uint64_t)0x5551a500be480U, (uint64_t)0x636985d007050U,
+    (uint64_t)0x59c2be51d679dU, (uint64_t)0x2349ed6864d33U, (uint64_t)0x234e14931e343U,
+    (uint64_t)0x3a6db62a039e9U, (uint64_t)0x7947312005e76U, (uint64_t)0xb93d668de230U,
+    (uint64_t)0x74f0a829607a2U, (uint64_t)0x2d2dd667a240fU, (uint64_t)0x791506554dd1U,
+    (uint64_t)0x22b97071b6eddU, (uint64_t)0x6fc323592bbf4U, (uint64_t)0x42913dd36a31cU,
+    (uint64_t)0x377bd9db79c5dU, (uint64_t)0xc4b30e63981U, (uint64_t)0x4b76b2079ba8cU,
+    (uint64_t)0x25d24e32a5d8dU, (uint64_t)0x702584d356bf5U, (uint64_t)0x4c799521ae006U,
+    (uint64_t)0x283d3ac2cc513U, (uint64_t)0x14a0bee52f90U, (uint64_t)0x75bd156187ed8U,
+    (uint64_t)0x5cdb2e84c8617U, (uint64_t)0x2816f8430d466U, (uint64_t)0x1b17e74b47f1eU,
+    (uint64_t)0xcc956b4309f1U, (uint64_t)0x319ab821d177cU, (uint64_t)0x51c1a92648778U,
+    (uint64_t)0x5452c4b45430eU, (uint64_t)0x4039e4bb35752U, (uint64_t)0x43d10ed4a847dU,
+    (uint64_t)0xf3a80964e003U, (uint64_t)0x435d9272dbac6U, (uint64_t)0x464a3c75fd0d8U,
+    (uint64_t)0x46a6fba4bbef3U, (uint64_t)0x7f7379b4035b8U, (uint64_t)0x582fec791fd1eU,
+    (uint64_t)0x2d67d8ac3c282U, (uint64_t)0x1caeba6f06a2cU, (uint64_t)0x56a7be98d85b8U,
+    (uint64_t)0x18d77ab3a72cU, (uint64_t)0x977146a47b06U, (uint64_t)0x2bba507e77aa1U,
+    (uint64_t)0x65fcdc11e7ea7U, (uint64_t)0x6f393ba689749U, (uint64_t)0x53abe60e56f32U,
+    (uint64_t)0x3453c96232737U, (uint64_t)0x3d9c16193ea5bU, (uint64_t)0x2176013a4fcc3U,
+    (uint64_t)0xf5d51935a5c7U, (uint64_t)0x4a699191958aU, (uint64_t)0x374259f1ae7a4U,
+    (uint64_t)0x77a6462756390U, (uint64_t)0x60c2952bf5adU, (uint64_t)0x4b4205427f5bU,
+    (uint64_t)0x636039548e695U, (uint64_t)0x7ef77cacb315U, (uint64_t)0x124bbe329edd8U,
+    (uint64_t)0x10ef5d4944825U, (uint64_t)0xdb40cfce84b6U, (uint64_t)0x1f3c964781cfdU,
+    (uint64_t)0x197fada71d8c4U, (uint64_t)0x6ce479e17af52U, (uint64_t)0x6db3fc3417d36U,
+    (uint64_t)0x537b4701f0c00U, (uint64_t)0x22b2dd12588b4U, (uint64_t)0x1d947e640b8d6U,
+    (uint64_t)0x4aa8b50afee60U, (uint64_t)0x5d41698923f4eU, (uint64_t)0x64780eef8bc11U,
+    (uint64_t)0x64fba820ef8a6U, (uint64_t)0x60a63f7922bb8U, (uint64_t)0x1745f6d6f5785U,
+    (uint64_t)0x2d92794a28e9fU, (uint64_t)0x3a9406d690b66U, (uint64_t)0x10a8a9ffa469bU,
+    (uint64_t)0xd7c767e1e086U, (uint64_t)0x642ef970f976dU, (uint64_t)0x35d5103f2785U,
+    (uint64_t)0x489c13fdc9fe9U, (uint64_t)0x7f2183c84ee88U, (uint64_t)0x7d337b8f29d2bU,
+    (uint64_t)0x40b31bfca128eU, (uint64_t)0xcc495fe64bc4U, (uint64_t)0x606036e75198bU,
+    (uint64_t)0x27c71834ded4bU, (uint64_t)0x50deae783c8a3U, (uint64_t)0x3bf7f6069f334U,
+    (uint64_t)0x42138e7b6cab9U, (uint64_t)0x464e4dbb7e189U, (uint64_t)0x153c4db078639U,
+    (uint64_t)0x1c441fd6d5b5cU, (uint64_t)0x83c104268acdU, (uint64_t)0x3d0ac8da66332U,
+    (uint64_t)0x4570a141e648aU, (uint64_t)0x1803372cb9b5aU, (uint64_t)0x423f8c22efd9dU,
+    (uint64_t)0x84ebd46a86edU, (uint64_t)0x7efb45d3a2851U, (uint64_t)0x18acd0c28cdaU,
+    (uint64_t)0x3b4643a86ca5dU, (uint64_t)0x5c7e2dde4895fU, (uint64_t)0x7ab433848e34eU,
+    (uint64_t)0xfe1198b11a1bU, (uint64_t)0x16b61e8ac6200U, (uint64_t)0x114bd44f6ac84U,
+    (uint64_t)0x6074058795c06U, (uint64_t)0x5d1eaf5ca51ceU, (uint64_t)0x437eeafeefe29U,
+    (uint64_t)0x6918f2c983218U, (uint64_t)0x79e7d519e0255U, (uint64_t)0x6cbb5a79176e4U,
+    (uint64_t)0x6290b675e8c23U, (uint64_t)0x5d5225a5e2235U, (uint64_t)0x6bc4e5de7b1b9U,
+    (uint64_t)0x3304ef028177dU, (uint64_t)0x56eafbb1ad6acU, (uint64_t)0x6c69a454931b5U,
+    (uint64_t)0x7ec9e5494feecU, (uint64_t)0x1a128ca0e3484U, (uint64_t)0x1dda2fbc04a39U,
+    (uint64_t)0x683602f169a70U, (uint64_t)0x4790972a8ffe7U, (uint64_t)0xab9bfbedf022U,
+    (uint64_t)0x2c3cd228bac21U, (uint64_t)0x75bd7af0bdd33U, (uint64_t)0x42505d6feaeb6U,
+    (uint64_t)0x7d8493ed22c62U, (uint64_t)0x6db3c0d1a1f27U, (uint64_t)0x6ba7775d04f62U,
+    (uint64_t)0x5f25b171aeeeeU, (uint64_t)0x4713b58f4d261U, (uint64_t)0x6d9f89747f807U,
+    (uint64_t)0x7b499ecb9b1bU, (uint64_t)0x6100faa8dbbe4U, (uint64_t)0x145934997b839U,
+    (uint64_t)0x471b9cc9e8582U, (uint64_t)0x7a9d8806c2c83U, (uint64_t)0x57ad664a77ea9U,
+    (uint64_t)0x31d729a2e5760U, (uint64_t)0x11184866b0dcdU, (uint64_t)0x621aa263918e5U,
+    (uint64_t)0x304995ab111a8U, (uint64_t)0x6fde98f557e33U, (uint64_t)0x3f94a48002c8bU,
+    (uint64_t)0x22b7caa4d30ebU, (uint64_t)0x27380949796c7U, (uint64_t)0x55cf42209e1U,
+    (uint64_t)0x6994510fbdad7U, (uint64_t)0x7085430611bf2U, (uint64_t)0x28f3a485ecef5U,
+    (uint64_t)0x73205d7a748e7U, (uint64_t)0x7cef1244339b0U, (uint64_t)0x3c86b1f74ef30U,
+    (uint64_t)0x7c406ee8b4d5U, (uint64_t)0x63523e0ec80f6U, (uint64_t)0x351753f66f657U,
+    (uint64_t)0x7defd1a2bfc27U, (uint64_t)0x73d4d9f5b9708U, (uint64_t)0x7c7fcc669e516U,
+    (uint64_t)0x566599c6e6d42U, (uint64_t)0x340dc5ac83e94U, (uint64_t)0x705432ef8d351U,
+    (uint64_t)0x256e14cee7d41U, (uint64_t)0x6384331e497c9U, (uint64_t)0x750d2955b3177U,
+    (uint64_t)0x7b0f693890621U, (uint64_t)0x2763a46b78f53U, (uint64_t)0x109cb575a611U,
+    (uint64_t)0x743a6a211a8a9U, (uint64_t)0x2642651606a17U, (uint64_t)0x6efee68a8553bU,
+    (uint64_t)0x30981d95b51e5U, (uint64_t)0x5c3370c184b6fU, (uint64_t)0x6d7269a0ad07eU,
+    (uint64_t)0x3272066270fceU, (uint64_t)0x446ac441625b7U, (uint64_t)0x2002e9ad522eeU,
+    (uint64_t)0x292a52d9e9332U, (uint64_t)0x5c324ca268214U, (uint64_t)0x2d3ed16ae3a37U,
+    (uint64_t)0x564333fcb486U, (uint64_t)0x61d2ce2338a0eU, (uint64_t)0x2fe5b430cbe27U,
+    (uint64_t)0x709f014389c99U, (uint64_t)0x6e87f6da81f17U, (uint64_t)0x68bd2434ed7c8U,
+    (uint64_t)0x55b78a638645eU, (uint64_t)0xf9df8eef9562U, (uint64_t)0x2674eb33be730U,
+    (uint64_t)0xe86052ddbb3U, (uint64_t)0x3d3210ad427b9U, (uint64_t)0x7f21ba8dbad29U,
+    (uint64_t)0x42ddc05b73970U, (uint64_t)0x52b9dff864991U, (uint64_t)0x3193d8834bda7U,
+    (uint64_t)0x37dbe599cd6ebU, (uint64_t)0x7c573ad249584U, (uint64_t)0x6afb9ba912798U,
+    (uint64_t)0x42d25a9abdca2U, (uint64_t)0x7dce106606bf5U, (uint64_t)0x4e96cf0da57f9U,
+    (uint64_t)0x416ca8e4102e9U, (uint64_t)0x705bd9027e77dU, (uint64_t)0x6cd670c1bfec2U,
+    (uint64_t)0x73c0591ca3c1aU, (uint64_t)0x6b529073fc221U, (uint64_t)0x1d0ca65236a11U,
+    (uint64_t)0x1417fa0628ebcU, (uint64_t)0x2140e4ba65833U, (uint64_t)0x5335fd8491ac4U,
+    (uint64_t)0x659254d4e1667U, (uint64_t)0x6a76673fb4e07U, (uint64_t)0x4b41a2671f969U,
+    (uint64_t)0x6109a9afceb6aU, (uint64_t)0x3ad4783875b79U, (uint64_t)0x6b12516f11baaU,
+    (uint64_t)0x7fbf83e0920f1U, (uint64_t)0x4892cfff7f94U, (uint64_t)0x6ca461a543130U,
+    (uint64_t)0x178387c5978dcU, (uint64_t)0x68fe3bafa05d6U, (uint64_t)0x9ad3d1928e08U,
+    (uint64_t)0x3ae2aa25e2555U, (uint64_t)0x5c188dde15ed8U, (uint64_t)0x3089ef25d6896U,
+    (uint64_t)0x5ca4a72d4e1e7U, (uint64_t)0x1986a5506e3abU, (uint64_t)0x2bfc1ba4bfb99U,
+    (uint64_t)0x6098a9f1048b4U, (uint64_t)0x6ee160f5e1f4eU, (uint64_t)0x98ae114a020fU,
+    (uint64_t)0x458dd27aee251U, (uint64_t)0x60c497780d40cU, (uint64_t)0x40c7086cb1d4U,
+    (uint64_t)0x3aede616bee67U, (uint64_t)0x41d5d5cbe96c9U, (uint64_t)0x10427b6510476U,
+    (uint64_t)0x22fa44ee0eb50U, (uint64_t)0x301c5ade24705U, (uint64_t)0x193a9c19b16a4U,
+    (uint64_t)0x70db2ca405f4cU, (uint64_t)0x73fe73844395aU, (uint64_t)0x68203f466ea10U,
+    (uint64_t)0x14d528a5f7598U, (uint64_t)0x5d859b80803a1U, (uint64_t)0x8cbc81e7f544U,
+    (uint64_t)0x1dacfa9ef2851U, (uint64_t)0x7d7225dafd9c4U, (uint64_t)0x5b18d4eebfb4eU,
+    (uint64_t)0x45fe5df3dbc33U, (uint64_t)0x431f1a5dccdbcU, (uint64_t)0x57fd4977b16eeU,
+    (uint64_t)0x63e030388d50aU, (uint64_t)0x47689b7199d9fU, (uint64_t)0x4473240470af6U,
+    (uint64_t)0xaaa265615fd6U, (uint64_t)0x39df009dd14e9U, (uint64_t)0x2e2823213d484U,
+    (uint64_t)0x61904a63f000fU, (uint64_t)0x1bd716fe62caaU, (uint64_t)0x14c5a5e251f84U,
+    (uint64_t)0x3dfd95553c0fdU, (uint64_t)0x480d816072eb6U, (uint64_t)0x684a8cd33137eU,
+    (uint64_t)0x5886d75ece3caU, (uint64_t)0x6654b005abc5eU, (uint64_t)0x1dabf39c3ada4U,
+    (uint64_t)0x552d0f1d6bda4U, (uint64_t)0x29f4e5b9c675fU, (uint64_t)0x50c1e7bb68929U,
+    (uint64_t)0x731f3c382d066U, (uint64_t)0x5954b8c17982aU, (uint64_t)0x7be59978e85b5U,
+    (uint64_t)0x33f7e95221da8U, (uint64_t)0x4e0a7caf97d67U, (uint64_t)0x7d63278c8fd1dU,
+    (uint64_t)0x61125b15491dcU, (uint64_t)0x148a7d88b200dU, (uint64_t)0x2dfead4e889b4U,
+    (uint64_t)0x6aa628cb3c563U, (uint64_t)0x20f683e3e00abU, (uint64_t)0x201e3231a2df0U,
+    (uint64_t)0x4f4f0b1a20843U, (uint64_t)0x24320ce9a185dU, (uint64_t)0x1607a82cb7418U,
+    (uint64_t)0x767446415985fU, (uint64_t)0x113a780508ae4U, (uint64_t)0x71e22f24aa305U,
+    (uint64_t)0x33f84ff1f58e9U, (uint64_t)0x4ad261c396392U, (uint64_t)0x3e17c51f865d6U,
+    (uint64_t)0x54ebc546e84feU, (uint64_t)0x130130d18b59cU, (uint64_t)0x1894bc50376ffU,
+    (uint64_t)0x2b38e0b200e13U, (uint64_t)0x7f9196a244767U, (uint64_t)0x3a295aaecee77U,
+    (uint64_t)0x29c224fb2db0aU, (uint64_t)0x5cfcc804b5636U, (uint64_t)0x4daa371dc3b5cU,
+    (uint64_t)0x245b2050b5d52U, (uint64_t)0x239ac84c87c2fU, (uint64_t)0x5594399156930U,
+    (uint64_t)0x38d46484879bU, (uint64_t)0x2976e11fab93fU, (uint64_t)0x7d53cbbd946f5U,
+    (uint64_t)0x1bfe5c9fdf184U, (uint64_t)0x36c2e3fa23db3U, (uint64_t)0x13ce53eeb864dU,
+    (uint64_t)0x4e4f0eeaf8fbcU, (uint64_t)0x3bc3ac9f0bc22U, (uint64_t)0x69ac3e8c9a214U,
+    (uint64_t)0xc5c488542844U, (uint64_t)0x36b8f43d81685U, (uint64_t)0x6656aa9137ae5U,
+    (uint64_t)0x1b16ac3306b17U, (uint64_t)0x5fa99c8159b38U, (uint64_t)0x4fcfa1f7f8382U,
+    (uint64_t)0x482ac0bf80638U, (uint64_t)0x51efc120572f8U, (uint64_t)0x2419a0021b2aeU,
+    (uint64_t)0x278fc16937ba3U, (uint64_t)0x378e98824a6bcU, (uint64_t)0x23fd4b8eeb48eU,
+    (uint64_t)0x68ea7a15c0376U, (uint64_t)0x1ee4b123a88a0U, (uint64_t)0x698dc36b7307fU,
+    (uint64_t)0x114214780d621U, (uint64_t)0x59fd157be00a9U, (uint64_t)0x45eaf2ac0d10U,
+    (uint64_t)0x2c235eb610b2eU, (uint64_t)0x79e6ada8ee73aU, (uint64_t)0x43beea412351aU,
+    (uint64_t)0x2817b94e68325U, (uint64_t)0x47920a1d5d236U, (uint64_t)0x64962364b5a2U,
+    (uint64_t)0x8acb90b0b095U, (uint64_t)0xea2c846a535aU, (uint64_t)0x71b5a8b0d031bU,
+    (uint64_t)0x3e7a622de4972U, (uint64_t)0x6f860e94280ccU, (uint64_t)0x8ddd60bb5089U,
+    (uint64_t)0x3b82a8337b05fU, (uint64_t)0x298ad5efd8f96U, (uint64_t)0x63408aadfa799U,
+    (uint64_t)0x6b044c3ba8848U, (uint64_t)0x343a5a91bd506U, (uint64_t)0x3cdde28b0d964U,
+    (uint64_t)0x77dbcd25c5f3dU, (uint64_t)0x88a44da541ceU, (uint64_t)0x71a9b1b77101aU,
+    (uint64_t)0x748c3b6d6a4ebU, (uint64_t)0x561d2c1d673a0U, (uint64_t)0x5d2d4cf747afeU,
+    (uint64_t)0x46e1b7a1bc33cU, (uint64_t)0x733b3b1b799a4U, (uint64_t)0x135ee3bb51984U,
+    (uint64_t)0x2dac09925d762U, (uint64_t)0xd72c3f3b533fU, (uint64_t)0x2efd85f1c7133U,
+    (uint64_t)0x49d463afbf4c3U, (uint64_t)0x7aa95b26d208bU, (uint64_t)0x24d703f5ab01cU,
+    (uint64_t)0x33c6e4ad2af6U, (uint64_t)0x73dfbca7e8058U, (uint64_t)0xa61f4acb4073U,
+    (uint64_t)0x63dc8371bd9dU, (uint64_t)0x70231a092565fU, (uint64_t)0x10642c985a6c2U,
+    (uint64_t)0x4aa22eddc348cU, (uint64_t)0x7d48d59716dabU, (uint64_t)0x5cb2953e0a5d6U,
+    (uint64_t)0x1df8dc634575bU, (uint64_t)0xa15b45f63107U, (uint64_t)0x3045dd03e226bU,
+    (uint64_t)0x383766cf6ffb4U, (uint64_t)0x3e5b2d56e549bU, (uint64_t)0x5448b030c625dU,
+    (uint64_t)0x2dbd3eb171523U, (uint64_t)0x595723e002bc2U, (uint64_t)0x52c6fb6b33904U,
+    (uint64_t)0x344b30bedde16U, (uint64_t)0x140b6f1e4bad4U, (uint64_t)0x2d77b6bfce11U,
+    (uint64_t)0x14bb469e30449U, (uint64_t)0x35d50f849c2c1U, (uint64_t)0x7a9ee1395876cU,
+    (uint64_t)0x444eb3598ccafU, (uint64_t)0x4b8fbeb124cbdU, (uint64_t)0x5fc76b816dc24U,
+    (uint64_t)0x1e74a83a69dd8U, (uint64_t)0x2a435836410fbU, (uint64_t)0x30a00d3edde95U,
+    (uint64_t)0x652250ab38365U, (uint64_t)0x3a020ea8eaa8aU, (uint64_t)0x458f7fd3d3e51U,
+    (uint64_t)0x3dc086535d721U, (uint64_t)0x34bd49edfa2ddU, (uint64_t)0x2217edfd34c25U,
+    (uint64_t)0x340c1c16cf1a3U, (uint64_t)0x1b5323bacf59dU, (uint64_t)0x72f1bc4be26f7U,
+    (uint64_t)0x73feaa96bbe61U, (uint64_t)0x17db9c8f437a8U, (uint64_t)0x627a48d281b6cU,
+    (uint64_t)0x7e7ad719e4786U, (uint64_t)0x422b5fa79c32eU, (uint64_t)0x362b4a8723182U,
+    (uint64_t)0x28e8a83744eb5U, (uint64_t)0x442affcde176bU, (uint64_t)0x2968dd2043343U,
+    (uint64_t)0x6b0d71cc909b2U, (uint64_t)0x70d99008ffcb5U, (uint64_t)0x6c54e726c32b9U,
+    (uint64_t)0x44283befd1791U, (uint64_t)0x67e09c40e60edU, (uint64_t)0x2c997194d7c90U,
+    (uint64_t)0x56b125243a069U, (uint64_t)0x76258a82248f1U, (uint64_t)0x2a05aea316ca8U,
+    (uint64_t)0x52360c81e6f37U, (uint64_t)0x7ae136b92181eU, (uint64_t)0x2bf17b9d14788U,
+    (uint64_t)0x3abc449a3d1a4U, (uint64_t)0xa2263753947eU, (uint64_t)0x7dfc5b0b50798U,
+    (uint64_t)0x4dfc6e993065U, (uint64_t)0x7b50476b0a337U, (uint64_t)0x12a1e8baa33ccU,
+    (uint64_t)0x243b17bebcaf6U, (uint64_t)0x3c6188ed37727U, (uint64_t)0x6a1284ec80951U,
+    (uint64_t)0x2448c3ec7026fU, (uint64_t)0x2053d66c73bfdU, (uint64_t)0x2bdd1bd082a1U,
+    (uint64_t)0x6dd4c1ae4b145U, (uint64_t)0x533f5e1101c3bU, (uint64_t)0x6868a751465a0U,
+    (uint64_t)0x1b2660f617607U, (uint64_t)0x508bd980fc724U, (uint64_t)0x4d510c8a68608U,
+    (uint64_t)0x665aa2f30af09U, (uint64_t)0xa9fcf41f6ef7U, (uint64_t)0x2e6c384daf9ddU,
+    (uint64_t)0x72bb2da4493f1U, (uint64_t)0x64d5b063161bcU, (uint64_t)0x1d4691dbcdad5U,
+    (uint64_t)0x732fb4faed167U, (uint64_t)0x107cad2e01c24U, (uint64_t)0xd6938aff729aU,
+    (uint64_t)0x27197db446e19U, (uint64_t)0x6db52acb6b175U, (uint64_t)0x3e4d21b936593U,
+    (uint64_t)0x2d644c7dad28dU, (uint64_t)0x43703afa4db6fU, (uint64_t)0x1f85df5ea777bU,
+    (uint64_t)0x73e16c6821b8eU, (uint64_t)0x1bc7af1e38185U, (uint64_t)0x2f65900314833U,
+    (uint64_t)0x24c6364e1f95eU, (uint64_t)0x57701247409f8U, (uint64_t)0x797bd2f77c3bcU,
+    (uint64_t)0x61d909d855661U, (uint64_t)0x45216636c2c7U, (uint64_t)0x6cadbcfdf0a37U,
+    (uint64_t)0x47c3ef66ee3c8U, (uint64_t)0x522665b326f25U, (uint64_t)0x1a340b8054b8fU,
+    (uint64_t)0x1938218028354U, (uint64_t)0x6bb1b54fa00f3U, (uint64_t)0x6e28f67cbea25U,
+    (uint64_t)0x4b5e9141aad35U, (uint64_t)0x6bce245f8c25U, (uint64_t)0x4955188a3c065U,
+    (uint64_t)0x161bd0f1292dfU, (uint64_t)0x1d521630b2506U, (uint64_t)0x6d06495669788U,
+    (uint64_t)0x3d26989cdd0f6U, (uint64_t)0x365eb8eb94b17U, (uint64_t)0x18452cd8dbe9U,
+    (uint64_t)0xd790b46bf270U, (uint64_t)0x78813093349c2U, (uint64_t)0x7a9f6260e653aU,
+    (uint64_t)0x589041b29662fU, (uint64_t)0x1d6fbadddcfd7U, (uint64_t)0x1fff2d032c3bcU,
+    (uint64_t)0x2f7b21e1d64e1U, (uint64_t)0x7665908aaf444U, (uint64_t)0x3a00e4b704ca1U,
+    (uint64_t)0x71715f4826e10U, (uint64_t)0x40ad025948864U, (uint64_t)0x2a3670bfc0327U,
+    (uint64_t)0x4ed18a7c50da4U, (uint64_t)0x54343b9ec13bbU, (uint64_t)0x15437f0d48d06U,
+    (uint64_t)0x366c6c241874bU, (uint64_t)0x6e66e4600d1c1U, (uint64_t)0x6bb9cf0f2d4dbU,
+    (uint64_t)0x5954e6c16d4f7U, (uint64_t)0x7ca457221ebb3U, (uint64_t)0x69398c394d173U,
+    (uint64_t)0x554841a79f99dU, (uint64_t)0xa09b36eb5a04U, (uint64_t)0x2eb0fa35ed926U,
+    (uint64_t)0x49a86e7641e74U, (uint64_t)0x3b54cf41b3a7bU, (uint64_t)0x85125b7595d7U,
+    (uint64_t)0x3aa47fd60fa31U, (uint64_t)0x3b1cc6b04c053U, (uint64_t)0x13e65c5705fc4U,
+    (uint64_t)0x7f81640bc9a65U, (uint64_t)0x6ac534fc04217U, (uint64_t)0x3bd5dfb4b4648U,
+    (uint64_t)0x4d5451113735eU, (uint64_t)0x2574dcfa41233U, (uint64_t)0x55926182e858bU,
+    (uint64_t)0x6b540645ad45fU, (uint64_t)0x1c71ce37638e6U, (uint64_t)0xfee129e406cbU,
+    (uint64_t)0x7e88f52e59c7dU, (uint64_t)0x2833edf503460U, (uint64_t)0x166921edd6bcdU,
+    (uint64_t)0x7880cc1c2003bU, (uint64_t)0x30eaefc5832acU, (uint64_t)0x7bb8bc02f05U,
+    (uint64_t)0x10ee994d38e57U, (uint64_t)0xc32dd003212eU, (uint64_t)0x79030a4774645U,
+    (uint64_t)0x39e7f74cbc8d6U, (uint64_t)0x8d90a5963263U, (uint64_t)0x70b3f944839e5U,
+    (uint64_t)0x7bec4bd417c4aU, (uint64_t)0x3c607a84c1df2U, (uint64_t)0x79a86ba3cea68U,
+    (uint64_t)0x42e6340c19d4eU, (uint64_t)0x76fb861261f82U, (uint64_t)0x51d11c25d5a44U,
+    (uint64_t)0x34518ad109941U, (uint64_t)0x3c6c9e37345dU, (uint64_t)0x7081214e622b1U,
+    (uint64_t)0x60ece5ba974a8U, (uint64_t)0x179f8768deed4U, (uint64_t)0x727055e32e57U,
+    (uint64_t)0x2f417ffbe2da0U, (uint64_t)0x4d4c71c738621U, (uint64_t)0x5bbdfc4e85ff1U,
+    (uint64_t)0x6331ffc9c6eb0U, (uint64_t)0x89b6cd02000bU, (uint64_t)0x16f13e8ceb88U,
+    (uint64_t)0x4f9b762547cf1U, (uint64_t)0x72995f90f2f92U, (uint64_t)0x7ec5a1c6f7e88U,
+    (uint64_t)0x66ef7206aa36dU, (uint64_t)0x478374da76d28U, (uint64_t)0x5344ef62175f4U,
+    (uint64_t)0x78f681d66e834U, (uint64_t)0x1fda3b879848dU, (uint64_t)0xd2c585f51161U,
+    (uint64_t)0x6b2d6fc2c9fdbU, (uint64_t)0x5b0e0cf4a45c3U, (uint64_t)0x1de41b4adca18U,
+    (uint64_t)0x6b07c3d5aa1a3U, (uint64_t)0x79e9d5b60917U, (uint64_t)0x1381c04c78797U,
+    (uint64_t)0x79470b8eb0720U, (uint64_t)0x2fe8895900193U, (uint64_t)0x5229893654a28U,
+    (uint64_t)0x16512951d2240U, (uint64_t)0x1b9bb33b94e2aU, (uint64_t)0x471701c32b888U,
+    (uint64_t)0x7201f9f3e4791U, (uint64_t)0x9c9665f45f28U, (uint64_t)0x18a2cd789580bU,
+    (uint64_t)0x319170c5cbebU, (uint64_t)0x45dfa1901b262U, (uint64_t)0x4f5a78e09bfa1U,
+    (uint64_t)0x61a937098bfc8U, (uint64_t)0x5e9ac4ab2f4a3U, (uint64_t)0x6c32be5b51babU,
+    (uint64_t)0x1fcce7a160521U, (uint64_t)0x3879392f3c991U, (uint64_t)0x1e65e9799a94dU,
+    (uint64_t)0x505f00fa8aee0U, (uint64_t)0x6ddebed72a48U, (uint64_t)0x45d47b79da83bU,
+    (uint64_t)0x67c366538c980U, (uint64_t)0x75e2f5b863d40U, (uint64_t)0x4c143172068caU,
+    (uint64_t)0x4b53d220ddbf6U, (uint64_t)0x73c503e062ea2U, (uint64_t)0x6684612a688deU,
+    (uint64_t)0x54bc44a9da83U, (uint64_t)0x2e5c4ef1a1273U, (uint64_t)0x3dc4dfb54008bU,
+    (uint64_t)0x196ffe806a2f9U, (uint64_t)0x13a653b912bfaU, (uint64_t)0x1cb2e2eaa3a54U,
+    (uint64_t)0x5c1731365512aU, (uint64_t)0x53c542e8e408cU, (uint64_t)0x8e571f36624eU,
+    (uint64_t)0x44a6ce3831e3aU, (uint64_t)0x2147a6c5ddfddU, (uint64_t)0x7a288f7dc1bdbU,
+    (uint64_t)0x41f5395c68f4bU, (uint64_t)0x21527553fa46dU, (uint64_t)0x449133ccc4daeU,
+    (uint64_t)0x20ad573c8d918U, (uint64_t)0xe2606a00097aU, (uint64_t)0x150dbc87749c3U,
+    (uint64_t)0x10772f531215aU, (uint64_t)0x4ed926dacae76U, (uint64_t)0x78e59c7d6a1e8U,
+    (uint64_t)0x2dda446c4a628U, (uint64_t)0x5323f588ad35dU, (uint64_t)0x6234537298972U,
+    (uint64_t)0x7b77f428399fdU, (uint64_t)0x214cb090c49U, (uint64_t)0x66ec4f3b562daU,
+    (uint64_t)0x7f2867bef24ceU, (uint64_t)0x710efab9d0ee1U, (uint64_t)0x1ca33cabfbcb4U,
+    (uint64_t)0xb725aadb7597U, (uint64_t)0x4c6c9a0e8a4efU, (uint64_t)0x74fd1c286ea25U,
+    (uint64_t)0x2cd1ab9507d6U, (uint64_t)0x2e4153317b496U, (uint64_t)0x44139df386b6cU,
+    (uint64_t)0x26d5711ee5a1eU, (uint64_t)0x5abb79c0fde35U, (uint64_t)0x5907a27bbca26U,
+    (uint64_t)0x5933ae4579161U, (uint64_t)0x6befe0e507701U, (uint64_t)0x7537838147422U,
+    (uint64_t)0x55142c59d25f5U, (uint64_t)0x1105332feb39dU, (uint64_t)0x5a3b10bc1a673U,
+    (uint64_t)0x2fef4bf5b0200U, (uint64_t)0x6a73b1e2a603eU, (uint64_t)0x43f6ebcfaffcdU,
+    (uint64_t)0x7d7801e33722bU, (uint64_t)0x41d7ad7f6053aU, (uint64_t)0x28882b8c39aa5U,
+    (uint64_t)0x6ea5ccc1efdb4U, (uint64_t)0x6b40e7b7d3aaaU, (uint64_t)0x2ed80f45ab6d0U,
+    (uint64_t)0x1fc8596940ff7U, (uint64_t)0x7a1f8de11d710U, (uint64_t)0x73db626767879U,
+    (uint64_t)0x5224fa7c36d4eU, (uint64_t)0x6fee2cfd444c8U, (uint64_t)0x1c4a8061b718fU,
+    (uint64_t)0x798676199ae1cU, (uint64_t)0x728a71912cf9fU, (uint64_t)0x123d52809448cU,
+    (uint64_t)0x358c8b09e71f9U, (uint64_t)0x64d5f1f4bfd7aU, (uint64_t)0x507b16eb4e0d1U,
+    (uint64_t)0x4ce95d59305cdU, (uint64_t)0x3326f0aab6e52U, (uint64_t)0x4e7f20bc2b131U,
+    (uint64_t)0x4bc3e54dc55b8U, (uint64_t)0x5060e1db16a64U, (uint64_t)0x5ed6fa57f0d44U,
+    (uint64_t)0x544cb218af30cU, (uint64_t)0x348d6ce5b8f28U, (uint64_t)0x316d36d34d1d9U,
+    (uint64_t)0x1985a3b2895e8U, (uint64_t)0x5ca076f131f17U, (uint64_t)0x44971a4ebf223U,
+    (uint64_t)0x717a30b3a1a67U, (uint64_t)0x533a8b44436d8U, (uint64_t)0x441bc8bdcf71U,
+    (uint64_t)0x314d831f8052dU, (uint64_t)0x5a95bdbf4473U, (uint64_t)0x161fc5e8eecebU,
+    (uint64_t)0x451683a613716U, (uint64_t)0x38db78ff1b047U, (uint64_t)0x3de3ac6441cf3U,
+    (uint64_t)0x4d77227507e92U, (uint64_t)0x86b032cd3ac1U, (uint64_t)0x18aa9b22cd652U,
+    (uint64_t)0x1b6798a8e3743U, (uint64_t)0x599ba21b65ffbU, (uint64_t)0x250c48865a9e2U,
+    (uint64_t)0x288bedc7777fU, (uint64_t)0x737db77525f28U, (uint64_t)0x615b3cbf29f9fU,
+    (uint64_t)0x7f59b350f668U, (uint64_t)0x315c7ec09c488U, (uint64_t)0x77b82b784940aU,
+    (uint64_t)0x25b1912c493d2U, (uint64_t)0x44e6d968654d0U, (uint64_t)0x65d3b1c67481eU,
+    (uint64_t)0x723d42c9bfadbU, (uint64_t)0x4c0ed8c71458cU, (uint64_t)0x14f480f093d20U,
+    (uint64_t)0x4a3b8b2f69410U, (uint64_t)0x3328bc121616aU, (uint64_t)0x333cdfafac039U,
+    (uint64_t)0x232736ed2f8e8U, (uint64_t)0x5319c6317adcaU, (uint64_t)0x65939f2fa7808U,
+    (uint64_t)0x2bbf3f26c21b5U, (uint64_t)0x7f32b5f405db1U, (uint64_t)0x79e8dbb6f6071U,
+    (uint64_t)0x5199bc11bff31U, (uint64_t)0x6aa290ba1ea39U, (uint64_t)0x52e3fbc9dca56U,
+    (uint64_t)0x76fc37c90a733U, (uint64_t)0x542ee4cf414a2U, (uint64_t)0x7077a0c518dfbU,
+    (uint64_t)0xf9bd192096b8U, (uint64_t)0x3646a62ad82bdU, (uint64_t)0x3b8f97c6bccacU,
+    (uint64_t)0x671efba0b8111U, (uint64_t)0x4032a1b6883a9U, (uint64_t)0x4f474a6b9d6e3U,
+    (uint64_t)0x24dd06031fdaaU, (uint64_t)0xa317e4b38b2aU, (uint64_t)0x723df163376a4U,
+    (uint64_t)0xb19cd35f74d9U, (uint64_t)0x76c5c5bcac72U, (uint64_t)0x421e4b4b514c2U,
+    (uint64_t)0x3143712372646U, (uint64_t)0x5066f24482e5eU, (uint64_t)0x715c90f9b9e3eU,
+    (uint64_t)0x5bb5858157a21U, (uint64_t)0x65a10ff6a067cU, (uint64_t)0x669777c684d1bU,
+    (uint64_t)0x213883cbaabd4U, (uint64_t)0x5fbb31ae52c4dU, (uint64_t)0x65f0e5e478f14U,
+    (uint64_t)0x3607014f6a64eU, (uint64_t)0x1ed4f0d4ed2c6U, (uint64_t)0x18298a22c6bf6U,
+    (uint64_t)0x28b06939ac749U, (uint64_t)0x40aecd9d24195U, (uint64_t)0x24394e3f3b716U,
+    (uint64_t)0x52a980a61b29cU, (uint64_t)0x16cb5953ddaf4U, (uint64_t)0x61772fb88782bU,
+    (uint64_t)0x29a2bd34e07acU, (uint64_t)0x3c0c1e7beb87aU, (uint64_t)0xb50d6384bd2fU,
+    (uint64_t)0x698d273c97e14U, (uint64_t)0xbc65cffcd268U, (uint64_t)0x318c91622aa37U,
+    (uint64_t)0x74e826b2f1347U, (uint64_t)0x3e242a23dd94eU, (uint64_t)0x6cdbd4e18ed9fU,
+    (uint64_t)0x52cf7bbecde42U, (uint64_t)0xc4d1cae2dca9U, (uint64_t)0x3a488c40b771aU,
+    (uint64_t)0x748fe1a825c77U, (uint64_t)0x21514a7862c84U, (uint64_t)0x34c40dc979953U,
+    (uint64_t)0x52999cbd4a7aU, (uint64_t)0x579ac4b521848U, (uint64_t)0x2b413d28a281dU,
+    (uint64_t)0x60c9f45a12b5cU, (uint64_t)0x3f1dd08f82872U, (uint64_t)0x57e772b88cc31U,
+    (uint64_t)0x62bfb93d6971cU, (uint64_t)0x1c0980b1c3325U, (uint64_t)0x3e203a0927754U,
+    (uint64_t)0x5d686e2df38faU, (uint64_t)0x787a7756ab550U, (uint64_t)0x445bd53058b9U,
+    (uint64_t)0x19eaf801c2154U, (uint64_t)0x1be0322c74e42U, (uint64_t)0x53201cb48f8a9U,
+    (uint64_t)0x42e4f4ad023a1U, (uint64_t)0x61eee376f0dc8U, (uint64_t)0x17efbf8b38931U,
+    (uint64_t)0x3251e4b970675U, (uint64_t)0x517806e2abde0U, (uint64_t)0x629fa3a1464e3U,
+    (uint64_t)0x1f2abf8d3ed6eU, (uint64_t)0x4cad2bbbb2831U, (uint64_t)0x3c99140b4a150U,
+    (uint64_t)0xf14bcceff186U, (uint64_t)0x66a23d657c527U, (uint64_t)0x2d1acf2194ccfU,
+    (uint64_t)0x7114d8a25906cU, (uint64_t)0x4caf6d59c324aU, (uint64_t)0x390d2cfa230c3U,
+    (uint64_t)0x601e8430d6319U, (uint64_t)0x3d12191c75243U, (uint64_t)0x44e5e9acdfe83U,
+    (uint64_t)0x30c658bfb78b8U, (uint64_t)0x7ad78f301fee4U, (uint64_t)0x3c5e4cda71e2bU,
+    (uint64_t)0x467965880e34cU, (uint64_t)0xd9fc7e9e4f36U, (uint64_t)0x5293e1510e25eU,
+    (uint64_t)0x7b555bfa2bc47U, (uint64_t)0x5dbfe61ffd5c2U, (uint64_t)0x13dd2778b6c11U,
+    (uint64_t)0x44c0c6d90670aU, (uint64_t)0x2abd4f7bcd819U, (uint64_t)0x688466d633631U,
+    (uint64_t)0x29e0221d8a5ddU, (uint64_t)0x53b1cdfe23ed5U, (uint64_t)0xaf01f575fb05U,
+    (uint64_t)0x685209f8b0e47U, (uint64_t)0x1b94022899de8U, (uint64_t)0x725c6ab995e8U,
+    (uint64_t)0x5ca6df45ad963U, (uint64_t)0x2ec86a5d5f373U, (uint64_t)0x74658c955ef7aU,
+    (uint64_t)0x4bb8db4c45551U, (uint64_t)0x4245dd12f621cU, (uint64_t)0x4ce669e485beeU,
+    (uint64_t)0x49581c869b64cU, (uint64_t)0x879d26924672U, (uint64_t)0x8a70dd68f436U,
+    (uint64_t)0x6e15a6732d550U, (uint64_t)0x1074ff0267662U, (uint64_t)0x1efc7e6d5b022U,
+    (uint64_t)0x168c1b4274f6U, (uint64_t)0x25dc041f50b06U, (uint64_t)0x7614491ed2682U,
+    (uint64_t)0x299be0decb680U, (uint64_t)0x26cf566ba49ffU, (uint64_t)0x76d195c2798eeU,
+    (uint64_t)0x524546781cec2U, (uint64_t)0x2ad0a0b1ea1f6U, (uint64_t)0x72cdb0f5241f7U,
+    (uint64_t)0x62b362a42fe33U, (uint64_t)0x39916b8c86c5U, (uint64_t)0x7a09e842055aaU,
+    (uint64_t)0x4ac79473c72abU, (uint64_t)0x3e63c4ae42121U, (uint64_t)0x680caa79c9678U,
+    (uint64_t)0x3808f9630a055U, (uint64_t)0x7b6eb04996f05U, (uint64_t)0x4464642b82cd2U,
+    (uint64_t)0x3599286aac87eU, (uint64_t)0x3c232529483e8U, (uint64_t)0x6366c466c9a3U,
+    (uint64_t)0x79fe2de6f62baU, (uint64_t)0x2b9bb2d49e4f4U, (uint64_t)0x7231c6668b931U,
+    (uint64_t)0x287be2808049fU, (uint64_t)0x1b3fbc705101bU, (uint64_t)0x518bbed8b8f93U,
+    (uint64_t)0x4ea28835980c6U, (uint64_t)0x1eade2fa113b1U, (uint64_t)0x3ae0a699920a0U,
+    (uint64_t)0xb6f00c89ce14U, (uint64_t)0x1550d0d521e72U, (uint64_t)0x53254be46b6c0U,
+    (uint64_t)0x6cc8d8212e6ccU, (uint64_t)0x4751a911b11e4U, (uint64_t)0x295d0471399baU,
+    (uint64_t)0x35b4f1cf85c19U, (uint64_t)0x1931a42a79935U, (uint64_t)0x1d502ac295870U,
+    (uint64_t)0x17508ad074a91U, (uint64_t)0xcdf8765489f8U, (uint64_t)0x59ead4b3ac4f9U,
+    (uint64_t)0x6ebb635a42a04U, (uint64_t)0x31ddffcb76711U, (uint64_t)0x736f0fdfa8836U,
+    (uint64_t)0x2ba0a110e80edU, (uint64_t)0x5901cb92128e2U, (uint64_t)0x6938d00bb08cbU,
+    (uint64_t)0x221c9b9a258e4U, (uint64_t)0x2f18301cb23d6U, (uint64_t)0x3fcc1df2263c2U,
+    (uint64_t)0x3a9691492e47aU, (uint64_t)0x604b4b2b0c9dU, (uint64_t)0x5075eca6a23baU,
+    (uint64_t)0x5d57ccf82cd76U, (uint64_t)0x191ac38152a73U, (uint64_t)0x527db82fb2d30U,
+    (uint64_t)0x298d4ffa67db4U, (uint64_t)0x4af6009911d4fU, (uint64_t)0x1a6e40365167cU,
+    (uint64_t)0x2746419610dfdU, (uint64_t)0x153e95df1a57aU, (uint64_t)0x22bf1f6cf605U,
+    (uint64_t)0x1ea69bf6f0ee1U, (uint64_t)0x7ef2931f0190aU, (uint64_t)0x80a30905d02aU,
+    (uint64_t)0x2b8d51e4bc042U, (uint64_t)0x3ca1c517dfac4U, (uint64_t)0x3d4b830fd200fU,
+    (uint64_t)0x7a92bd11bba55U, (uint64_t)0x6c23a2371bcd6U, (uint64_t)0x35bcff65a49e6U,
+    (uint64_t)0x2fbfd0c597d5fU, (uint64_t)0x1ed4bfcc333a7U, (uint64_t)0x3506e47909a5fU,
+    (uint64_t)0x4d66972f03198U, (uint64_t)0x286327e683fcU, (uint64_t)0x1d118b8849c47U,
+    (uint64_t)0x73d969f556be7U, (uint64_t)0x33eac59de6037U, (uint64_t)0x255e3d531c012U,
+    (uint64_t)0x688883dd7d2bcU, (uint64_t)0x131534f09ff2dU, (uint64_t)0x63f3615389d11U,
+    (uint64_t)0x3683fcba71031U, (uint64_t)0x202c546ccb866U, (uint64_t)0x7e7b4570962dU,
+    (uint64_t)0x715e4d1647212U, (uint64_t)0x3a4ba693d760aU, (uint64_t)0x7961ef3ecbb5dU,
+    (uint64_t)0x241543ff2f21U, (uint64_t)0x8a085d8ae874U, (uint64_t)0x17e8ba6de5d32U,
+    (uint64_t)0x438b99022fc52U, (uint64_t)0x423c9a1f4d50eU, (uint64_t)0x23a5096d52e41U,
+    (uint64_t)0x76a86a9de64d9U, (uint64_t)0x6bcb921c38224U, (uint64_t)0x64b52040fc598U,
+    (uint64_t)0x6ac0f0ebd57beU, (uint64_t)0x20575ae346ecbU, (uint64_t)0x5775567b00914U,
+    (uint64_t)0x659a612e62254U, (uint64_t)0x6b265507695b3U, (uint64_t)0x32951a7d46b30U,
+    (uint64_t)0x5f0454eaf5f3cU, (uint64_t)0x75600ae647758U, (uint64_t)0x5fee54e8a8f33U,
+    (uint64_t)0x3f7f093597aceU, (uint64_t)0x5802e669e434bU, (uint64_t)0x4c30a012877cfU,
+    (uint64_t)0x219a698b0a420U, (uint64_t)0x79267db8cc90fU, (uint64_t)0x7eb2b724d0599U,
+    (uint64_t)0x3c41cb05dc3fU, (uint64_t)0x4732705808479U, (uint64_t)0x71ccb4fe555a3U,
+    (uint64_t)0x66f2e8dea7d5fU, (uint64_t)0x75d942c04210dU, (uint64_t)0x5c4874e35ab2dU,
+    (uint64_t)0x5a8f4848cf2ecU, (uint64_t)0x45cc72fce38feU, (uint64_t)0x9e47ebf162bbU,
+    (uint64_t)0x696cc14856cdcU, (uint64_t)0x1588c9993c204U, (uint64_t)0x310b07abc62b0U,
+    (uint64_t)0x7dd0ce1a13228U, (uint64_t)0x4db508b69bfe2U, (uint64_t)0x6875393b8686cU,
+    (uint64_t)0xa57b885fae14U, (uint64_t)0x48bd176421bf2U, (uint64_t)0x6483f528f0c5cU,
+    (uint64_t)0x6bb56ad0c8d30U, (uint64_t)0x6d12e0dd1cd8bU, (uint64_t)0x4a3028f70bd8eU,
+    (uint64_t)0x6fb588ceb49a4U, (uint64_t)0x15e96e043c83U, (uint64_t)0x3c01505c1b392U,
+    (uint64_t)0xd5c9e4b74fdeU, (uint64_t)0x66fd9da4da844U, (uint64_t)0x36bcc17efb8baU,
+    (uint64_t)0x67c9966e620bbU, (uint64_t)0x2e8b510b2d23fU, (uint64_t)0x3211cabda755bU,
+    (uint64_t)0x39f2d199b0017U, (uint64_t)0x689cd6da39047U, (uint64_t)0x4ee67cfea426U,
+    (uint64_t)0x44f62eac8c288U, (uint64_t)0x7d04264e36e88U, (uint64_t)0x3319ae930f866U,
+    (uint64_t)0x2b7f27fb1bc34U, (uint64_t)0x68ccfeaf09e3cU, (uint64_t)0x13fce3bbcbc54U,
+    (uint64_t)0x6cc9f269424b8U, (uint64_t)0x622632f5cf734U, (uint64_t)0x41b729f82a329U,
+    (uint64_t)0x10c6c2b8eaa2dU, (uint64_t)0x6bed58531e5ceU, (uint64_t)0x3770c16884960U,
+    (uint64_t)0x3fba21f5fd594U, (uint64_t)0x5a41f0680fc3dU, (uint64_t)0x60684b418c206U,
+    (uint64_t)0xd78588e79b4aU, (uint64_t)0x16c1556c9a2bcU, (uint64_t)0x335745ef14f36U,
+    (uint64_t)0x3d719e23ae502U, (uint64_t)0x5ced6e016ce4fU, (uint64_t)0x7c48f0cd6f5f4U,
+    (uint64_t)0x23e38cd5158b0U, (uint64_t)0x4c62395a6a828U, (uint64_t)0x46c4d62fbe1c3U,
+    (uint64_t)0x79e89f4bc2231U, (uint64_t)0x3fec90ae2a81fU, (uint64_t)0x29b8d1dc2095bU,
+    (uint64_t)0x11af2b10518f5U, (uint64_t)0x1b54232605b64U, (uint64_t)0x63b6355b3ae8cU,
+    (uint64_t)0x634abcb5fe74U, (uint64_t)0x1723bcb3e1d15U, (uint64_t)0x689807682b3eaU,
+    (uint64_t)0x769004a1eaadcU, (uint64_t)0x1faf5e2abddd7U, (uint64_t)0x591a01cc06d86U,
+    (uint64_t)0x5d4ba682e08ebU, (uint64_t)0x68fd67e2023deU, (uint64_t)0x2e9ed9bc7b243U,
+    (uint64_t)0x7f1df90e7267bU, (uint64_t)0x157278332427aU, (uint64_t)0x20cae63fed27aU,
+    (uint64_t)0x70fe618e77933U, (uint64_t)0x9554f402b26aU, (uint64_t)0x57a55d0c13effU,
+    (uint64_t)0x5807222ada534U, (uint64_t)0x456bdf4c7423eU, (uint64_t)0x50b42c46c2997U,
+    (uint64_t)0x2e6936b85381bU, (uint64_t)0x1d18e01e71f42U, (uint64_t)0x43e15d81bc772U,
+    (uint64_t)0x579782c36c68eU, (uint64_t)0x3e5303a1908edU, (uint64_t)0x223ca96fd7b4bU,
+    (uint64_t)0x3cbb225620e5fU, (uint64_t)0x1edb635aaf657U, (uint64_t)0x5dacf0f0de7cU,
+    (uint64_t)0x6a339f4412193U, (uint64_t)0x50756eb9eb0a5U, (uint64_t)0x1767916351622U,
+    (uint64_t)0x1089da2b5dd8bU, (uint64_t)0x2269a46cdf0aaU, (uint64_t)0x68f85514c514eU,
+    (uint64_t)0x7083ffbf804f6U, (uint64_t)0xb87e873a8780U, (uint64_t)0x3f90dc508ececU,
+    (uint64_t)0x489cf3771fa99U, (uint64_t)0x7104537cc4644U, (uint64_t)0x3e2bd1ee75986U,
+    (uint64_t)0x17237036bf469U, (uint64_t)0x7531eb776369dU, (uint64_t)0x66a9b0dab2743U,
+    (uint64_t)0x3804bb683be22U, (uint64_t)0x3733debc4886dU, (uint64_t)0xcee3497f2a2U,
+    (uint64_t)0x5bb4af39f15caU, (uint64_t)0x66e632db15cc9U, (uint64_t)0x2d6a6134af084U,
+    (uint64_t)0x38fdec0e8d27fU, (uint64_t)0x1239e9bd979b5U, (uint64_t)0x660c87ff50378U,
+    (uint64_t)0x534e3c9c194ccU, (uint64_t)0x4ddf8800db95U, (uint64_t)0x87757b94c4a7U,
+    (uint64_t)0x1ee594a87a541U, (uint64_t)0x6e1e26ab17c47U, (uint64_t)0x7a4def7f4f0ccU,
+    (uint64_t)0x309b7ada7ee07U, (uint64_t)0x43cb957e9c921U, (uint64_t)0x3cd9f56bf9b98U,
+    (uint64_t)0x2d3dc9be3f67U, (uint64_t)0x7511066c0e121U, (uint64_t)0x6a33ba386fcd5U,
+    (uint64_t)0x626dee17f6147U, (uint64_t)0x29c02ddc3696eU, (uint64_t)0x65e544247c46dU,
+    (uint64_t)0x604df365b8391U, (uint64_t)0x3a94bd5bcbc2fU, (uint64_t)0x619fac8d6ace9U,
+    (uint64_t)0x49513fcb27238U, (uint64_t)0x185cdb43c881fU, (uint64_t)0x3bcd60e9533cbU,
+    (uint64_t)0x1d26ae8619807U, (uint64_t)0xe30b7aa4a930U, (uint64_t)0x2b51a914548d7U,
+    (uint64_t)0x5c88c2fe4868cU, (uint64_t)0x668d5960c0b43U, (uint64_t)0x6246e53791b03U,
+    (uint64_t)0x110a12b1b2af5U, (uint64_t)0x45378ad74e89U, (uint64_t)0x58f49e437341U,
+    (uint64_t)0x7a66f757c2190U, (uint64_t)0x13d7c92bd0558U, (uint64_t)0x46d4010b9a2afU,
+    (uint64_t)0x50fa079405f35U, (uint64_t)0x400a8cd97a6fcU, (uint64_t)0x5f3e6d4330674U,
+    (uint64_t)0x2d8352e175264U, (uint64_t)0x601e11692d66cU, (uint64_t)0x4aa7039c9423U,
+    (uint64_t)0x107f06a461a90U, (uint64_t)0x158af2b748828U, (uint64_t)0x2530bd1561746U,
+    (uint64_t)0x519a6f2a4a98eU, (uint64_t)0x4ebbb5934b808U, (uint64_t)0x40ebebae7fd41U,
+    (uint64_t)0x627e7cd734b03U, (uint64_t)0x7dc5669f01dddU, (uint64_t)0x2cb0b0cafa1e3U,
+    (uint64_t)0x3d720fe91031aU, (uint64_t)0x67e8ed1ec00aU, (uint64_t)0x797150adf0663U,
+    (uint64_t)0x522d70389e30fU, (uint64_t)0x5b3d1b69953f2U, (uint64_t)0x41d648637fe5dU,
+    (uint64_t)0x3227c2f1681f7U, (uint64_t)0x5089c58085e74U, (uint64_t)0x186248653d88bU,
+    (uint64_t)0x1d8641f402a45U, (uint64_t)0x250d1eeb72e55U, (uint64_t)0x20cb7d3d5b98U,
+    (uint64_t)0x50cab959cb2b6U, (uint64_t)0x30b59df367e13U, (uint64_t)0x44c9fa894c6d2U,
+    (uint64_t)0x1d73bb2b6a8eU, (uint64_t)0x1dd0759ea2ed3U, (uint64_t)0x39c2a209ade34U,
+    (uint64_t)0x140abde7555f6U, (uint64_t)0x4ad61ed9ff36bU, (uint64_t)0x7923661b7033aU,
+    (uint64_t)0x1ca1d9b3e7636U, (uint64_t)0x7d5f6473e7c2fU, (uint64_t)0x1179993df2540U,
+    (uint64_t)0x2aef6937c200cU, (uint64_t)0x5418fd61513e1U, (uint64_t)0x17312d93ebeacU,
+    (uint64_t)0x3c49c73bc2ba8U, (uint64_t)0x74f00b58a53f6U, (uint64_t)0x2bbf59bc314c4U,
+    (uint64_t)0x17bda068eb061U, (uint64_t)0x20a0e33fcf9d5U, (uint64_t)0x5e228e1b1e1abU,
+    (uint64_t)0x24e97e3f868a1U, (uint64_t)0x621f1173b4625U, (uint64_t)0x507b0c7fb94ceU,
+    (uint64_t)0x29e4c0eedfc23U, (uint64_t)0x5dde3f530354cU, (uint64_t)0x484800427a7c8U,
+    (uint64_t)0x26e9045f15da5U, (uint64_t)0x33841231904d2U, (uint64_t)0x79b14e162e6f5U,
+    (uint64_t)0x759527498e0c4U, (uint64_t)0x66a81ef8b10e8U, (uint64_t)0x2c5c7978b126dU,
+    (uint64_t)0x7122ca7a7e681U, (uint64_t)0x40d8d008623a1U, (uint64_t)0x41294922881baU,
+    (uint64_t)0x7f4fbb4aa85b4U, (uint64_t)0xc579767ffb50U, (uint64_t)0x8213dfcd1205U,
+    (uint64_t)0x68281deb8486dU, (uint64_t)0x3d5a995a523d9U, (uint64_t)0x4b566edf58220U,
+    (uint64_t)0x55894c276321dU, (uint64_t)0x7ad74afff357dU, (uint64_t)0xd3a9a539d392U,
+    (uint64_t)0x706663d330b1dU, (uint64_t)0x133a22f640de1U, (uint64_t)0x65cc9588f9859U,
+    (uint64_t)0x45a43b2a1c67eU, (uint64_t)0x53b020b63f8adU, (uint64_t)0x790215a917ebaU,
+    (uint64_t)0x21b23789b5bc2U, (uint64_t)0x313614bf29107U, (uint64_t)0x3ffd8454db8aeU,
+    (uint64_t)0x400166213ee3U, (uint64_t)0x761affb1e0d4U, (uint64_t)0x6a170812fe6b0U,
+    (uint64_t)0xe5988f808725U, (uint64_t)0x6b25da56d2916U, (uint64_t)0x29dbe21081636U,
+    (uint64_t)0x3a6d110e60701U, (uint64_t)0x16b9b1b499715U, (uint64_t)0x4ff57aba1c1f5U,
+    (uint64_t)0x385b66acef2fbU, (uint64_t)0x435281d6122c2U, (uint64_t)0x5d6c9bb1ec4a5U,
+    (uint64_t)0x3d525e99d4787U, (uint64_t)0xb4f0bbef08fcU, (uint64_t)0x469e57d31e97aU,
+    (uint64_t)0x6ce5014595179U, (uint64_t)0x28bd38d44030dU, (uint64_t)0x41d6d78d5bbfcU,
+    (uint64_t)0x748889556933aU, (uint64_t)0x2e666d3fb606dU, (uint64_t)0x1b99d69e273e6U,
+    (uint64_t)0x552dd7405c418U, (uint64_t)0x35f5b89a6dbe4U, (uint64_t)0x6851f5995c8f8U,
+    (uint64_t)0x412fc66d6f9e4U, (uint64_t)0x7ae43f5941e7bU, (uint64_t)0x6cc234a1107dcU,
+    (uint64_t)0x7dce55f7be126U, (uint64_t)0x44884d4f42fa7U, (uint64_t)0x6d7c5f63f008cU,
+    (uint64_t)0x7baea0cbda388U, (uint64_t)0xec8fe27a51e6U, (uint64_t)0x52cefab3d11d3U,
+    (uint64_t)0x570264f87b63dU, (uint64_t)0x701ecf073e3f9U, (uint64_t)0x53fbb3adc6fb0U,
+    (uint64_t)0x3de83daf93d8aU, (uint64_t)0x791aa0e554129U, (uint64_t)0x6a23907baf00dU,
+    (uint64_t)0x3295c90831a9cU, (uint64_t)0x663e9b22448c5U, (uint64_t)0x14ae37c7970d0U,
+    (uint64_t)0x27eb68d4e5bfdU, (uint64_t)0x22d2099ddf370U, (uint64_t)0x6d54a83bffd49U,
+    (uint64_t)0x66b6f17af0bbcU, (uint64_t)0x190bb443a02d3U, (uint64_t)0x6f417484861c0U,
+    (uint64_t)0x645fd45aa2313U, (uint64_t)0x22edc528f83cbU, (uint64_t)0xaee0c0fa981dU,
+    (uint64_t)0x5a601f5562397U, (uint64_t)0x24c246b2456daU, (uint64_t)0x6519c7abc393cU,
+    (uint64_t)0x2fbe77b018afcU, (uint64_t)0x56c474318798aU, (uint64_t)0x47f03cc04f3dcU,
+    (uint64_t)0x5db6c768a89e5U, (uint64_t)0x5cb33ae4b6149U, (uint64_t)0x3eb8df0618d8dU,
+    (uint64_t)0x3d2fa46d0edf1U, (uint64_t)0x393fb3d0b216dU, (uint64_t)0x776f56c0960ceU,
+    (uint64_t)0x298f2c7500482U, (uint64_t)0x16d7bdafdcbaU, (uint64_t)0x2ed28bde9f7cbU,
+    (uint64_t)0x4e2107bc67440U, (uint64_t)0x4d19e16c81fe1U, (uint64_t)0x6ab74970cb7f4U,
+    (uint64_t)0x614fc7f5308e3U, (uint64_t)0xf885f239268eU, (uint64_t)0x51637af036999U,
+    (uint64_t)0x69d00957c9907U, (uint64_t)0x2660e070fd1e1U, (uint64_t)0x6793524f516a2U,
+    (uint64_t)0x5777daf72d122U, (uint64_t)0x30d3831392a57U, (uint64_t)0x5cc64cff559b9U,
+    (uint64_t)0x64453c75f705dU, (uint64_t)0x5800bb22610feU, (uint64_t)0x40e73ee010047U,
+    (uint64_t)0x50e644a29bc85U, (uint64_t)0x658955f472291U, (uint64_t)0x2545234028e4cU,
+    (uint64_t)0x46d3baa2e2872U, (uint64_t)0x15bfdb99cddddU, (uint64_t)0x7c10011013479U,
+    (uint64_t)0x73d7b00d6838cU, (uint64_t)0x372af3f3d7ba3U, (uint64_t)0x5fe45b35dbf2eU,
+    (uint64_t)0x2f823d692b6e4U, (uint64_t)0x18b612324ccfbU, (uint64_t)0x3d75788f5a8bfU,
+    (uint64_t)0x6c1a1a3b440aaU, (uint64_t)0x2cf4d85d1d3c5U, (uint64_t)0x63ee89401b498U,
+    (uint64_t)0x4b6dafa36309cU, (uint64_t)0x5cdfc76d8c498U, (uint64_t)0x2766f17b412b6U,
+    (uint64_t)0xbe288bb8c62bU, (uint64_t)0xebd14fb32a68U, (uint64_t)0x74b32dd64306fU,
+    (uint64_t)0x7b2eca0b600c4U, (uint64_t)0x7cc0e78963ab0U, (uint64_t)0x184246ccec92fU,
+    (uint64_t)0x3b54e750110bbU, (uint64_t)0x6e847af3ae326U, (uint64_t)0x199f7a2182148U,
+    (uint64_t)0x1bd722e8edc1bU, (uint64_t)0x6eed3a0e99d47U, (uint64_t)0x34de4aad941b2U,
+    (uint64_t)0x362ea253baea2U, (uint64_t)0x4438a7c1156fU, (uint64_t)0x5450a615813baU,
+    (uint64_t)0x68fa854ea3797U, (uint64_t)0x9b968038e14aU, (uint64_t)0x27ed44b7ad467U,
+    (uint64_t)0x2deb9216f73e9U, (uint64_t)0x4620632fd6fa4U, (uint64_t)0x63facdf1b87aaU,
+    (uint64_t)0x7073220ef2c21U, (uint64_t)0x1edff13d99073U, (uint64_t)0x20617c243adf8U,
+    (uint64_t)0x2e319b0d53c9cU, (uint64_t)0x274999d321e3U, (uint64_t)0x131536578d28cU,
+    (uint64_t)0x2e42eb00cbc19U, (uint64_t)0x4c98f03983180U, (uint64_t)0x114ba79bd01ebU,
+    (uint64_t)0x3879f2c9bbdf0U, (uint64_t)0x24c51112c9655U, (uint64_t)0x17c80741add0U,
+    (uint64_t)0x1132c34ff961fU, (uint64_t)0x677d0b1215964U, (uint64_t)0x2be5f787a79c2U,
+    (uint64_t)0x6a044a47b984bU, (uint64_t)0x5830f025f1078U, (uint64_t)0x717e25793d41eU,
+    (uint64_t)0x406aa79573bcU, (uint64_t)0xc0795b6cacbeU, (uint64_t)0x1fff337239217U,
+    (uint64_t)0x67d451752c243U, (uint64_t)0x133e47f92480bU, (uint64_t)0x5e16ced41ff62U,
+    (uint64_t)0x11ec3f2ddabc7U, (uint64_t)0x84089dba2c67U, (uint64_t)0x7ccd179cfce91U,
+    (uint64_t)0x4e15da1d9062bU, (uint64_t)0x538d34783da3eU, (uint64_t)0x36301e04c4cacU,
+    (uint64_t)0x4e4d4cf168b8bU, (uint64_t)0x19929124ab577U, (uint64_t)0x175a69ca1fb69U,
+    (uint64_t)0x88480e6c0fa9U, (uint64_t)0x41079e654284fU, (uint64_t)0x4060f4dccca41U,
+    (uint64_t)0x52c0cbef541feU, (uint64_t)0x1919dd037f7f0U, (uint64_t)0x46c95f539afaeU,
+    (uint64_t)0x79a2fafff96a5U, (uint64_t)0x590caa3a860bbU, (uint64_t)0x64ab933fc626aU,
+    (uint64_t)0x3720f2c76158fU, (uint64_t)0x54598b784e873U, (uint64_t)0x1658af745782bU,
+    (uint64_t)0x5929eccd5cb86U, (uint64_t)0x633198a5af64eU, (uint64_t)0x40de64a7b0c18U,
+    (uint64_t)0x7a060f97789b8U, (uint64_t)0x30a09a3c7b09cU, (uint64_t)0x73b47904223a0U,
+    (uint64_t)0x888e9e9da049U, (uint64_t)0x30eda28e403f4U, (uint64_t)0x27d41a639ac6bU,
+    (uint64_t)0x7b21047331706U, (uint64_t)0x41991129c809dU, (uint64_t)0x40316e927f1b8U,
+    (uint64_t)0x28737a1738914U, (uint64_t)0x345db23b9ef4dU, (uint64_t)0x673c301d3b59cU,
+    (uint64_t)0xbddf846fee99U, (uint64_t)0x849c9e6da66dU, (uint64_t)0x60ab0555edde9U,
+    (uint64_t)0x1a85cb49843bU, (uint64_t)0x313c5ea495ceaU, (uint64_t)0x1c96497d7a016U,
+    (uint64_t)0x9f4dcbc5ae50U, (uint64_t)0x5a0c66de39ef7U, (uint64_t)0x3f84d9b86cb39U,
+    (uint64_t)0x5f0d5cf58fd2aU, (uint64_t)0x65c28aa2d1993U, (uint64_t)0x7d767b87e11e7U,
+    (uint64_t)0x5cd31fd1e41bfU, (uint64_t)0x59b5fd0d0b914U, (uint64_t)0x340e41ce5965bU,
+    (uint64_t)0x66ef688d92dc4U, (uint64_t)0x1deb18e4d05b2U, (uint64_t)0x20912f604fd5fU,
+    (uint64_t)0x42b3fcd320750U, (uint64_t)0x2a01c840d23cU, (uint64_t)0x220cb51fa5db5U,
+    (uint64_t)0x4ac1d5c8cb78eU, (uint64_t)0x10862f0c3836dU, (uint64_t)0x7ca3d95f5debU,
+    (uint64_t)0x42905ccbf2747U, (uint64_t)0x4ab664f3492fcU, (uint64_t)0x5f2104dbe6c22U,
+    (uint64_t)0x86057c2be1f3U, (uint64_t)0x7d1f695a95270U, (uint64_t)0x747bf37f43265U,
+    (uint64_t)0x220899a34967fU, (uint64_t)0x1e0990d03bcf6U, (uint64_t)0x245e680d6459dU,
+    (uint64_t)0xe68b9542be95U, (uint64_t)0x58a109a328a66U, (uint64_t)0x2f5296014db3eU,
+    (uint64_t)0xea9350f1881fU, (uint64_t)0x97da145ad9c1U, (uint64_t)0x5065ee1575abfU,
+    (uint64_t)0x3a70f66e81394U, (uint64_t)0x7ea568c2acdfeU, (uint64_t)0x4162601f4748U,
+    (uint64_t)0x3d3fb9791b943U, (uint64_t)0x3d4aae98c1e45U, (uint64_t)0x1b7a57195d8e8U,
+    (uint64_t)0x4622b7eac6924U, (uint64_t)0x1cb7a40c1d8d4U, (uint64_t)0x6dbaec67ef776U,
+    (uint64_t)0x2493599c90707U, (uint64_t)0x733b30c4de9a5U, (uint64_t)0x8e9020d152b0U,
+    (uint64_t)0x2835019689be9U, (uint64_t)0x41f9a96aec874U, (uint64_t)0x3d04dd051341fU,
+    (uint64_t)0x7feac979bfac7U, (uint64_t)0x3568e249fb3d5U, (uint64_t)0x13108548efa2U,
+    (uint64_t)0x7946d7c7220e7U, (uint64_t)0x65e3c6a888a4bU, (uint64_t)0x24ab83d18dac2U,
+    (uint64_t)0x6d8bcb74eb874U, (uint64_t)0x3dec05fa937aU, (uint64_t)0x4271cc6375515U,
+    (uint64_t)0x949949e28da3U, (uint64_t)0x56bf0e5189623U, (uint64_t)0x17ab48894ff72U,
+    (uint64_t)0x15949f784d847U, (uint64_t)0x1e510afad0049U, (uint64_t)0xe7730c1d7b1U,
+    (uint64_t)0x402be75347c23U, (uint64_t)0x38a03b8b74596U, (uint64_t)0x70d685f68f859U
+  };
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Ed25519_PrecompTable_H_DEFINED
+#endif
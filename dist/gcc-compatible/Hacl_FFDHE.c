@@ -278,6 +278,77 @@ void Hacl_FFDHE_ffdhe_secret_to_public(Spec_FFDHE_ffdhe_alg a, uint8_t *sk, uint
   Hacl_FFDHE_ffdhe_secret_to_public_precomp(a, p_r2_n, sk, pk);
 }
 
+uint64_t *Hacl_FFDHE_new_ffdhe_precomp_p_g(Spec_FFDHE_ffdhe_alg a)
+{
+  uint32_t nLen = (Hacl_Impl_FFDHE_ffdhe_len(a) - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen + nLen + (uint32_t)256U * nLen);
+  uint64_t *res = KRML_HOST_CALLOC(nLen + nLen + (uint32_t)256U * nLen, sizeof (uint64_t));
+  if (res == NULL)
+  {
+    return res;
+  }
+  uint64_t *res1 = res;
+  uint64_t *res2 = res1;
+  uint64_t *p_r2_n = res2;
+  uint64_t *p_n = res2;
+  uint64_t *r2_n = res2 + nLen;
+  uint64_t *table = res2 + nLen + nLen;
+  ffdhe_precomp_p(a, p_r2_n);
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t g_n[nLen];
+  memset(g_n, 0U, nLen * sizeof (uint64_t));
+  uint8_t g = (uint8_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)1U; i++)
+  {
+    uint8_t *os = &g;
+    uint8_t x = Hacl_Impl_FFDHE_Constants_ffdhe_g2[i];
+    os[i] = x;
+  }
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64((uint32_t)1U, &g, g_n);
+  uint64_t mu = Hacl_Bignum_ModInvLimb_mod_inv_uint64(p_n[0U]);
+  Hacl_Bignum_ExpFixedBase_bn_fb_precomp_table_u64(nLen,
+    p_n,
+    mu,
+    r2_n,
+    g_n,
+    (uint32_t)64U * nLen,
+    (uint32_t)8U,
+    table);
+  return res2;
+}
+
+void
+Hacl_FFDHE_ffdhe_secret_to_public_precomp_g(
+  Spec_FFDHE_ffdhe_alg a,
+  uint64_t *p_r2_g_n,
+  uint8_t *sk,
+  uint8_t *pk
+)
+{
+  uint32_t len = Hacl_Impl_FFDHE_ffdhe_len(a);
+  uint32_t nLen = (len - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  uint64_t *p_n = p_r2_g_n;
+  uint64_t *table = p_r2_g_n + nLen + nLen;
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t sk_n[nLen];
+  memset(sk_n, 0U, nLen * sizeof (uint64_t));
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(len, sk, sk_n);
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t res_n[nLen];
+  memset(res_n, 0U, nLen * sizeof (uint64_t));
+  uint64_t mu = Hacl_Bignum_ModInvLimb_mod_inv_uint64(p_n[0U]);
+  Hacl_Bignum_ExpFixedBase_bn_mod_exp_fb_ct_u64(nLen,
+    p_n,
+    mu,
+    (uint32_t)64U * nLen,
+    (uint32_t)8U,
+    table,
+    (uint32_t)64U * nLen,
+    sk_n,
+    res_n);
+  Hacl_Bignum_Convert_bn_to_bytes_be_uint64(len, res_n, pk);
+}
+
 uint64_t
 Hacl_FFDHE_ffdhe_shared_secret_precomp(
   Spec_FFDHE_ffdhe_alg a,
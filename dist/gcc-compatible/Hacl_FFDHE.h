@@ -58,6 +58,16 @@ Hacl_FFDHE_ffdhe_secret_to_public_precomp(
 
 void Hacl_FFDHE_ffdhe_secret_to_public(Spec_FFDHE_ffdhe_alg a, uint8_t *sk, uint8_t *pk);
 
+uint64_t *Hacl_FFDHE_new_ffdhe_precomp_p_g(Spec_FFDHE_ffdhe_alg a);
+
+void
+Hacl_FFDHE_ffdhe_secret_to_public_precomp_g(
+  Spec_FFDHE_ffdhe_alg a,
+  uint64_t *p_r2_g_n,
+  uint8_t *sk,
+  uint8_t *pk
+);
+
 uint64_t
 Hacl_FFDHE_ffdhe_shared_secret_precomp(
   Spec_FFDHE_ffdhe_alg a,
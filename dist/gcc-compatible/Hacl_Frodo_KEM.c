@@ -302,34 +302,6 @@ static uint32_t crypto_publickeybytes = (uint32_t)976U;
 
 static uint32_t crypto_ciphertextbytes = (uint32_t)1096U;
 
-static inline void
-frodo_mul_add_as_plus_e_pack(uint8_t *seed_a, uint8_t *seed_e, uint8_t *b, uint8_t *s)
-{
-  uint16_t s_matrix[512U] = { 0U };
-  frodo_sample_matrix((uint32_t)64U,
-    (uint32_t)8U,
-    (uint32_t)16U,
-    seed_e,
-    (uint16_t)1U,
-    s_matrix);
-  matrix_to_lbytes((uint32_t)64U, (uint32_t)8U, s_matrix, s);
-  uint16_t b_matrix[512U] = { 0U };
-  uint16_t a_matrix[4096U] = { 0U };
-  uint16_t e_matrix[512U] = { 0U };
-  frodo_gen_matrix_cshake((uint32_t)64U, (uint32_t)16U, seed_a, a_matrix);
-  frodo_sample_matrix((uint32_t)64U,
-    (uint32_t)8U,
-    (uint32_t)16U,
-    seed_e,
-    (uint16_t)2U,
-    e_matrix);
-  matrix_mul_s((uint32_t)64U, (uint32_t)64U, (uint32_t)8U, a_matrix, s_matrix, b_matrix);
-  matrix_add((uint32_t)64U, (uint32_t)8U, b_matrix, e_matrix);
-  Lib_Memzero_clear_words_u16((uint32_t)512U, e_matrix);
-  frodo_pack((uint32_t)64U, (uint32_t)8U, (uint32_t)15U, b_matrix, b);
-  Lib_Memzero_clear_words_u16((uint32_t)512U, s_matrix);
-}
-
 static inline void frodo_key_encode(uint32_t b, uint8_t *a, uint16_t *res)
 {
   for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)8U; i0++)
@@ -394,46 +366,6 @@ frodo_mul_add_sb_plus_e_plus_mu(
   matrix_add((uint32_t)8U, (uint32_t)8U, v_matrix, mu_encode);
 }
 
-static inline void crypto_kem_enc_ct(uint8_t *pk, uint8_t *g, uint8_t *coins, uint8_t *ct)
-{
-  uint8_t *seed_a = pk;
-  uint8_t *b = pk + (uint32_t)16U;
-  uint8_t *seed_e = g;
-  uint8_t *d = g + (uint32_t)32U;
-  uint16_t sp_matrix[512U] = { 0U };
-  frodo_sample_matrix((uint32_t)8U,
-    (uint32_t)64U,
-    (uint32_t)16U,
-    seed_e,
-    (uint16_t)4U,
-    sp_matrix);
-  uint32_t c1Len = (uint32_t)960U;
-  uint32_t c2Len = (uint32_t)120U;
-  uint32_t c12Len = c1Len + c2Len;
-  uint8_t *c1 = ct;
-  uint16_t bp_matrix[512U] = { 0U };
-  uint16_t a_matrix[4096U] = { 0U };
-  uint16_t ep_matrix[512U] = { 0U };
-  frodo_gen_matrix_cshake((uint32_t)64U, (uint32_t)16U, seed_a, a_matrix);
-  frodo_sample_matrix((uint32_t)8U,
-    (uint32_t)64U,
-    (uint32_t)16U,
-    seed_e,
-    (uint16_t)5U,
-    ep_matrix);
-  matrix_mul((uint32_t)8U, (uint32_t)64U, (uint32_t)64U, sp_matrix, a_matrix, bp_matrix);
-  matrix_add((uint32_t)8U, (uint32_t)64U, bp_matrix, ep_matrix);
-  Lib_Memzero_clear_words_u16((uint32_t)512U, ep_matrix);
-  frodo_pack((uint32_t)8U, (uint32_t)64U, (uint32_t)15U, bp_matrix, c1);
-  uint8_t *c2 = ct + c1Len;
-  uint16_t v_matrix[64U] = { 0U };
-  frodo_mul_add_sb_plus_e_plus_mu(b, seed_e, coins, sp_matrix, v_matrix);
-  frodo_pack((uint32_t)8U, (uint32_t)8U, (uint32_t)15U, v_matrix, c2);
-  Lib_Memzero_clear_words_u16((uint32_t)64U, v_matrix);
-  memcpy(ct + c12Len, d, (uint32_t)16U * sizeof (uint8_t));
-  Lib_Memzero_clear_words_u16((uint32_t)512U, sp_matrix);
-}
-
 static inline void crypto_kem_enc_ss(uint8_t *g, uint8_t *ct, uint8_t *ss)
 {
   uint32_t ss_init_len = crypto_ciphertextbytes + (uint32_t)16U;
@@ -466,7 +398,29 @@ uint32_t Hacl_Frodo_KEM_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
   Hacl_Impl_SHA3_squeeze(s1, (uint32_t)168U, (uint32_t)16U, seed_a);
   uint8_t *b = pk + (uint32_t)16U;
   uint8_t *s_bytes = sk + (uint32_t)16U + crypto_publickeybytes;
-  frodo_mul_add_as_plus_e_pack(seed_a, seed_e, b, s_bytes);
+  uint16_t s_matrix[512U] = { 0U };
+  frodo_sample_matrix((uint32_t)64U,
+    (uint32_t)8U,
+    (uint32_t)16U,
+    seed_e,
+    (uint16_t)1U,
+    s_matrix);
+  matrix_to_lbytes((uint32_t)64U, (uint32_t)8U, s_matrix, s_bytes);
+  uint16_t b_matrix[512U] = { 0U };
+  uint16_t a_matrix[4096U] = { 0U };
+  uint16_t e_matrix[512U] = { 0U };
+  frodo_gen_matrix_cshake((uint32_t)64U, (uint32_t)16U, seed_a, a_matrix);
+  frodo_sample_matrix((uint32_t)64U,
+    (uint32_t)8U,
+    (uint32_t)16U,
+    seed_e,
+    (uint16_t)2U,
+    e_matrix);
+  matrix_mul_s((uint32_t)64U, (uint32_t)64U, (uint32_t)8U, a_matrix, s_matrix, b_matrix);
+  matrix_add((uint32_t)64U, (uint32_t)8U, b_matrix, e_matrix);
+  Lib_Memzero_clear_words_u16((uint32_t)512U, e_matrix);
+  frodo_pack((uint32_t)64U, (uint32_t)8U, (uint32_t)15U, b_matrix, b);
+  Lib_Memzero_clear_words_u16((uint32_t)512U, s_matrix);
   memcpy(sk, s, (uint32_t)16U * sizeof (uint8_t));
   memcpy(sk + (uint32_t)16U, pk, crypto_publickeybytes * sizeof (uint8_t));
   return (uint32_t)0U;
@@ -489,7 +443,42 @@ uint32_t Hacl_Frodo_KEM_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
     pk_coins,
     (uint8_t)0x04U);
   Hacl_Impl_SHA3_squeeze(s, (uint32_t)168U, (uint32_t)48U, g);
-  crypto_kem_enc_ct(pk, g, coins, ct);
+  uint8_t *seed_a = pk;
+  uint8_t *b = pk + (uint32_t)16U;
+  uint8_t *seed_e = g;
+  uint8_t *d = g + (uint32_t)32U;
+  uint16_t sp_matrix[512U] = { 0U };
+  frodo_sample_matrix((uint32_t)8U,
+    (uint32_t)64U,
+    (uint32_t)16U,
+    seed_e,
+    (uint16_t)4U,
+    sp_matrix);
+  uint32_t c1Len = (uint32_t)960U;
+  uint32_t c2Len = (uint32_t)120U;
+  uint32_t c12Len = c1Len + c2Len;
+  uint8_t *c1 = ct;
+  uint16_t bp_matrix[512U] = { 0U };
+  uint16_t a_matrix[4096U] = { 0U };
+  uint16_t ep_matrix[512U] = { 0U };
+  frodo_gen_matrix_cshake((uint32_t)64U, (uint32_t)16U, seed_a, a_matrix);
+  frodo_sample_matrix((uint32_t)8U,
+    (uint32_t)64U,
+    (uint32_t)16U,
+    seed_e,
+    (uint16_t)5U,
+    ep_matrix);
+  matrix_mul((uint32_t)8U, (uint32_t)64U, (uint32_t)64U, sp_matrix, a_matrix, bp_matrix);
+  matrix_add((uint32_t)8U, (uint32_t)64U, bp_matrix, ep_matrix);
+  Lib_Memzero_clear_words_u16((uint32_t)512U, ep_matrix);
+  frodo_pack((uint32_t)8U, (uint32_t)64U, (uint32_t)15U, bp_matrix, c1);
+  uint8_t *c2 = ct + c1Len;
+  uint16_t v_matrix[64U] = { 0U };
+  frodo_mul_add_sb_plus_e_plus_mu(b, seed_e, coins, sp_matrix, v_matrix);
+  frodo_pack((uint32_t)8U, (uint32_t)8U, (uint32_t)15U, v_matrix, c2);
+  Lib_Memzero_clear_words_u16((uint32_t)64U, v_matrix);
+  memcpy(ct + c12Len, d, (uint32_t)16U * sizeof (uint8_t));
+  Lib_Memzero_clear_words_u16((uint32_t)512U, sp_matrix);
   crypto_kem_enc_ss(g, ct, ss);
   Lib_Memzero_clear_words_u8((uint32_t)32U, g);
   return (uint32_t)0U;
@@ -0,0 +1,182 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+
+#include "Hacl_Gf128_CT64.h"
+
+/* The low 64 bits of the carry-less product of x and y, with integer
+   multiplications on operands with holes: with one bit in four, carries
+   cannot spill into the bits that are kept. */
+static inline uint64_t bmul64(uint64_t x, uint64_t y)
+{
+  uint64_t x0 = x & (uint64_t)0x1111111111111111U;
+  uint64_t x1 = x & (uint64_t)0x2222222222222222U;
+  uint64_t x2 = x & (uint64_t)0x4444444444444444U;
+  uint64_t x3 = x & (uint64_t)0x8888888888888888U;
+  uint64_t y0 = y & (uint64_t)0x1111111111111111U;
+  uint64_t y1 = y & (uint64_t)0x2222222222222222U;
+  uint64_t y2 = y & (uint64_t)0x4444444444444444U;
+  uint64_t y3 = y & (uint64_t)0x8888888888888888U;
+  uint64_t z0 = x0 * y0 ^ x1 * y3 ^ x2 * y2 ^ x3 * y1;
+  uint64_t z1 = x0 * y1 ^ x1 * y0 ^ x2 * y3 ^ x3 * y2;
+  uint64_t z2 = x0 * y2 ^ x1 * y1 ^ x2 * y0 ^ x3 * y3;
+  uint64_t z3 = x0 * y3 ^ x1 * y2 ^ x2 * y1 ^ x3 * y0;
+  return
+    (z0 & (uint64_t)0x1111111111111111U)
+    | (z1 & (uint64_t)0x2222222222222222U)
+    | (z2 & (uint64_t)0x4444444444444444U)
+    | (z3 & (uint64_t)0x8888888888888888U);
+}
+
+static inline uint64_t rev64(uint64_t x)
+{
+  uint64_t
+  x1 =
+    (x & (uint64_t)0x5555555555555555U) << (uint32_t)1U
+    | (x >> (uint32_t)1U & (uint64_t)0x5555555555555555U);
+  uint64_t
+  x2 =
+    (x1 & (uint64_t)0x3333333333333333U) << (uint32_t)2U
+    | (x1 >> (uint32_t)2U & (uint64_t)0x3333333333333333U);
+  uint64_t
+  x3 =
+    (x2 & (uint64_t)0x0f0f0f0f0f0f0f0fU) << (uint32_t)4U
+    | (x2 >> (uint32_t)4U & (uint64_t)0x0f0f0f0f0f0f0f0fU);
+  uint64_t
+  x4 =
+    (x3 & (uint64_t)0x00ff00ff00ff00ffU) << (uint32_t)8U
+    | (x3 >> (uint32_t)8U & (uint64_t)0x00ff00ff00ff00ffU);
+  uint64_t
+  x5 =
+    (x4 & (uint64_t)0x0000ffff0000ffffU) << (uint32_t)16U
+    | (x4 >> (uint32_t)16U & (uint64_t)0x0000ffff0000ffffU);
+  return x5 << (uint32_t)32U | x5 >> (uint32_t)32U;
+}
+
+/* pre = [h1; h0; rev h1; rev h0; h1 ^ h0; rev h1 ^ rev h0], where h1 and h0
+   are the big-endian halves of the key. */
+static inline void load_precompute(uint64_t *pre, uint8_t *key)
+{
+  uint64_t h1 = load64_be(key);
+  uint64_t h0 = load64_be(key + (uint32_t)8U);
+  uint64_t h1r = rev64(h1);
+  uint64_t h0r = rev64(h0);
+  pre[0U] = h1;
+  pre[1U] = h0;
+  pre[2U] = h1r;
+  pre[3U] = h0r;
+  pre[4U] = h1 ^ h0;
+  pre[5U] = h1r ^ h0r;
+}
+
+/* acc = (acc + b) * h, with a Karatsuba multiplication in which the high
+   halves of the 64x64-bit products are computed on bit-reversed operands, and
+   a reduction modulo x^128 + x^7 + x^2 + x + 1 in the bit-reflected
+   representation of GHASH. */
+static inline void fmul_r_add(uint64_t *acc, uint8_t *b, uint64_t *pre)
+{
+  uint64_t y1 = acc[0U] ^ load64_be(b);
+  uint64_t y0 = acc[1U] ^ load64_be(b + (uint32_t)8U);
+  uint64_t y1r = rev64(y1);
+  uint64_t y0r = rev64(y0);
+  uint64_t y2 = y0 ^ y1;
+  uint64_t y2r = y0r ^ y1r;
+  uint64_t z0 = bmul64(y0, pre[1U]);
+  uint64_t z1 = bmul64(y1, pre[0U]);
+  uint64_t z2 = bmul64(y2, pre[4U]);
+  uint64_t z0h = bmul64(y0r, pre[3U]);
+  uint64_t z1h = bmul64(y1r, pre[2U]);
+  uint64_t z2h = bmul64(y2r, pre[5U]);
+  uint64_t z21 = z2 ^ z0 ^ z1;
+  uint64_t z2h1 = z2h ^ z0h ^ z1h;
+  uint64_t z0h1 = rev64(z0h) >> (uint32_t)1U;
+  uint64_t z1h1 = rev64(z1h) >> (uint32_t)1U;
+  uint64_t z2h2 = rev64(z2h1) >> (uint32_t)1U;
+  uint64_t v0 = z0;
+  uint64_t v1 = z0h1 ^ z21;
+  uint64_t v2 = z1 ^ z2h2;
+  uint64_t v3 = z1h1;
+  uint64_t v31 = v3 << (uint32_t)1U | v2 >> (uint32_t)63U;
+  uint64_t v21 = v2 << (uint32_t)1U | v1 >> (uint32_t)63U;
+  uint64_t v11 = v1 << (uint32_t)1U | v0 >> (uint32_t)63U;
+  uint64_t v01 = v0 << (uint32_t)1U;
+  uint64_t v22 = v21 ^ v01 ^ v01 >> (uint32_t)1U ^ v01 >> (uint32_t)2U ^ v01 >> (uint32_t)7U;
+  uint64_t v12 = v11 ^ v01 << (uint32_t)63U ^ v01 << (uint32_t)62U ^ v01 << (uint32_t)57U;
+  uint64_t v32 = v31 ^ v12 ^ v12 >> (uint32_t)1U ^ v12 >> (uint32_t)2U ^ v12 >> (uint32_t)7U;
+  uint64_t v23 = v22 ^ v12 << (uint32_t)63U ^ v12 << (uint32_t)62U ^ v12 << (uint32_t)57U;
+  acc[0U] = v32;
+  acc[1U] = v23;
+}
+
+void Hacl_Gf128_CT64_gcm_init(uint64_t *ctx, uint8_t *key)
+{
+  uint64_t *acc = ctx;
+  uint64_t *pre = ctx + (uint32_t)2U;
+  acc[0U] = (uint64_t)0U;
+  acc[1U] = (uint64_t)0U;
+  load_precompute(pre, key);
+}
+
+void Hacl_Gf128_CT64_gcm_reset(uint64_t *ctx)
+{
+  uint64_t *acc = ctx;
+  acc[0U] = (uint64_t)0U;
+  acc[1U] = (uint64_t)0U;
+}
+
+void Hacl_Gf128_CT64_gcm_update_blocks(uint64_t *ctx, uint32_t len, uint8_t *text)
+{
+  uint64_t *acc = ctx;
+  uint64_t *pre = ctx + (uint32_t)2U;
+  uint32_t nb = len / (uint32_t)16U;
+  uint32_t rem = len % (uint32_t)16U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    fmul_r_add(acc, text + i * (uint32_t)16U, pre);
+  }
+  if (rem > (uint32_t)0U)
+  {
+    uint8_t *last = text + nb * (uint32_t)16U;
+    uint8_t elem[16U] = { 0U };
+    memcpy(elem, last, rem * sizeof (uint8_t));
+    fmul_r_add(acc, elem, pre);
+  }
+}
+
+void Hacl_Gf128_CT64_gcm_emit(uint8_t *tag, uint64_t *ctx)
+{
+  uint64_t *acc = ctx;
+  store64_be(tag, acc[0U]);
+  store64_be(tag + (uint32_t)8U, acc[1U]);
+}
+
+void Hacl_Gf128_CT64_ghash(uint8_t *tag, uint32_t len, uint8_t *text, uint8_t *key)
+{
+  uint64_t ctx[8U] = { 0U };
+  Hacl_Gf128_CT64_gcm_init(ctx, key);
+  Hacl_Gf128_CT64_gcm_update_blocks(ctx, len, text);
+  Hacl_Gf128_CT64_gcm_emit(tag, ctx);
+}
+
@@ -0,0 +1,297 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Gf128_NI.h"
+
+static inline void
+clmul_wide_add(
+  Lib_IntVector_Intrinsics_vec128 *acc,
+  Lib_IntVector_Intrinsics_vec128 x,
+  Lib_IntVector_Intrinsics_vec128 y
+)
+{
+  Lib_IntVector_Intrinsics_vec128 lo = Lib_IntVector_Intrinsics_ni_clmul(x, y, (uint8_t)0x00U);
+  Lib_IntVector_Intrinsics_vec128 m1 = Lib_IntVector_Intrinsics_ni_clmul(x, y, (uint8_t)0x10U);
+  Lib_IntVector_Intrinsics_vec128 m2 = Lib_IntVector_Intrinsics_ni_clmul(x, y, (uint8_t)0x01U);
+  Lib_IntVector_Intrinsics_vec128 hi = Lib_IntVector_Intrinsics_ni_clmul(x, y, (uint8_t)0x11U);
+  acc[0U] = Lib_IntVector_Intrinsics_vec128_xor(acc[0U], lo);
+  acc[1U] =
+    Lib_IntVector_Intrinsics_vec128_xor(acc[1U],
+      Lib_IntVector_Intrinsics_vec128_xor(m1, m2));
+  acc[2U] = Lib_IntVector_Intrinsics_vec128_xor(acc[2U], hi);
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+gf128_reduce(Lib_IntVector_Intrinsics_vec128 *acc)
+{
+  Lib_IntVector_Intrinsics_vec128
+  poly = Lib_IntVector_Intrinsics_vec128_load64s((uint64_t)1U, (uint64_t)0xc200000000000000U);
+  Lib_IntVector_Intrinsics_vec128
+  lo0 =
+    Lib_IntVector_Intrinsics_vec128_xor(acc[0U],
+      Lib_IntVector_Intrinsics_vec128_shift_left(acc[1U], (uint32_t)64U));
+  Lib_IntVector_Intrinsics_vec128
+  hi =
+    Lib_IntVector_Intrinsics_vec128_xor(acc[2U],
+      Lib_IntVector_Intrinsics_vec128_shift_right(acc[1U], (uint32_t)64U));
+  Lib_IntVector_Intrinsics_vec128
+  t0 = Lib_IntVector_Intrinsics_ni_clmul(lo0, poly, (uint8_t)0x10U);
+  Lib_IntVector_Intrinsics_vec128
+  lo1 =
+    Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right_lanes64(lo0,
+        (uint32_t)1U),
+      t0);
+  Lib_IntVector_Intrinsics_vec128
+  t1 = Lib_IntVector_Intrinsics_ni_clmul(lo1, poly, (uint8_t)0x10U);
+  Lib_IntVector_Intrinsics_vec128
+  lo2 =
+    Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right_lanes64(lo1,
+        (uint32_t)1U),
+      t1);
+  return Lib_IntVector_Intrinsics_vec128_xor(hi, lo2);
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+fmul(Lib_IntVector_Intrinsics_vec128 x, Lib_IntVector_Intrinsics_vec128 y)
+{
+  Lib_IntVector_Intrinsics_vec128 tmp[3U];
+  for (uint32_t _i = 0U; _i < (uint32_t)3U; ++_i)
+    tmp[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  clmul_wide_add(tmp, x, y);
+  return gf128_reduce(tmp);
+}
+
+static inline void load_precompute_r(Lib_IntVector_Intrinsics_vec128 *pre, uint8_t *key)
+{
+  uint64_t h1 = load64_be(key);
+  uint64_t h0 = load64_be(key + (uint32_t)8U);
+  uint64_t m = (uint64_t)0U - (h1 >> (uint32_t)63U);
+  uint64_t r1 = (h1 << (uint32_t)1U | h0 >> (uint32_t)63U) ^ (m & (uint64_t)0xc200000000000000U);
+  uint64_t r0 = h0 << (uint32_t)1U ^ (m & (uint64_t)1U);
+  Lib_IntVector_Intrinsics_vec128 r = Lib_IntVector_Intrinsics_vec128_load64s(r0, r1);
+  pre[7U] = r;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)7U; i++)
+  {
+    pre[(uint32_t)6U - i] = fmul(pre[(uint32_t)7U - i], r);
+  }
+}
+
+static inline void load_precompute_r_le(Lib_IntVector_Intrinsics_vec128 *pre, uint8_t *key)
+{
+  Lib_IntVector_Intrinsics_vec128 r = Lib_IntVector_Intrinsics_vec128_load_le(key);
+  pre[7U] = r;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)7U; i++)
+  {
+    pre[(uint32_t)6U - i] = fmul(pre[(uint32_t)7U - i], r);
+  }
+}
+
+static inline void
+fmul_r8_add(
+  Lib_IntVector_Intrinsics_vec128 *acc,
+  uint8_t *text,
+  Lib_IntVector_Intrinsics_vec128 *pre
+)
+{
+  Lib_IntVector_Intrinsics_vec128 tmp[3U];
+  for (uint32_t _i = 0U; _i < (uint32_t)3U; ++_i)
+    tmp[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 b0 = Lib_IntVector_Intrinsics_vec128_load_be(text);
+  clmul_wide_add(tmp, Lib_IntVector_Intrinsics_vec128_xor(acc[0U], b0), pre[0U]);
+  for (uint32_t i = (uint32_t)1U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128
+    bi = Lib_IntVector_Intrinsics_vec128_load_be(text + i * (uint32_t)16U);
+    clmul_wide_add(tmp, bi, pre[i]);
+  }
+  acc[0U] = gf128_reduce(tmp);
+}
+
+static inline void
+fmul_r_add(
+  Lib_IntVector_Intrinsics_vec128 *acc,
+  uint8_t *text,
+  Lib_IntVector_Intrinsics_vec128 *pre
+)
+{
+  Lib_IntVector_Intrinsics_vec128 b = Lib_IntVector_Intrinsics_vec128_load_be(text);
+  acc[0U] = fmul(Lib_IntVector_Intrinsics_vec128_xor(acc[0U], b), pre[7U]);
+}
+
+static inline void
+fmul_r8_add_le(
+  Lib_IntVector_Intrinsics_vec128 *acc,
+  uint8_t *text,
+  Lib_IntVector_Intrinsics_vec128 *pre
+)
+{
+  Lib_IntVector_Intrinsics_vec128 tmp[3U];
+  for (uint32_t _i = 0U; _i < (uint32_t)3U; ++_i)
+    tmp[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 b0 = Lib_IntVector_Intrinsics_vec128_load_le(text);
+  clmul_wide_add(tmp, Lib_IntVector_Intrinsics_vec128_xor(acc[0U], b0), pre[0U]);
+  for (uint32_t i = (uint32_t)1U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128
+    bi = Lib_IntVector_Intrinsics_vec128_load_le(text + i * (uint32_t)16U);
+    clmul_wide_add(tmp, bi, pre[i]);
+  }
+  acc[0U] = gf128_reduce(tmp);
+}
+
+static inline void
+fmul_r_add_le(
+  Lib_IntVector_Intrinsics_vec128 *acc,
+  uint8_t *text,
+  Lib_IntVector_Intrinsics_vec128 *pre
+)
+{
+  Lib_IntVector_Intrinsics_vec128 b = Lib_IntVector_Intrinsics_vec128_load_le(text);
+  acc[0U] = fmul(Lib_IntVector_Intrinsics_vec128_xor(acc[0U], b), pre[7U]);
+}
+
+void Hacl_Gf128_NI_gcm_init(Lib_IntVector_Intrinsics_vec128 *ctx, uint8_t *key)
+{
+  Lib_IntVector_Intrinsics_vec128 *acc = ctx;
+  Lib_IntVector_Intrinsics_vec128 *pre = ctx + (uint32_t)1U;
+  acc[0U] = Lib_IntVector_Intrinsics_vec128_zero;
+  load_precompute_r(pre, key);
+}
+
+void Hacl_Gf128_NI_gcm_reset(Lib_IntVector_Intrinsics_vec128 *ctx)
+{
+  Lib_IntVector_Intrinsics_vec128 *acc = ctx;
+  acc[0U] = Lib_IntVector_Intrinsics_vec128_zero;
+}
+
+void
+Hacl_Gf128_NI_gcm_update_blocks(
+  Lib_IntVector_Intrinsics_vec128 *ctx,
+  uint32_t len,
+  uint8_t *text
+)
+{
+  Lib_IntVector_Intrinsics_vec128 *acc = ctx;
+  Lib_IntVector_Intrinsics_vec128 *pre = ctx + (uint32_t)1U;
+  uint32_t len0 = len / (uint32_t)128U * (uint32_t)128U;
+  uint8_t *t0 = text;
+  uint32_t nb0 = len0 / (uint32_t)128U;
+  for (uint32_t i = (uint32_t)0U; i < nb0; i++)
+  {
+    uint8_t *block = t0 + i * (uint32_t)128U;
+    fmul_r8_add(acc, block, pre);
+  }
+  uint32_t len1 = len - len0;
+  uint8_t *t1 = text + len0;
+  uint32_t nb = len1 / (uint32_t)16U;
+  uint32_t rem = len1 % (uint32_t)16U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    uint8_t *block = t1 + i * (uint32_t)16U;
+    fmul_r_add(acc, block, pre);
+  }
+  if (rem > (uint32_t)0U)
+  {
+    uint8_t *last = t1 + nb * (uint32_t)16U;
+    uint8_t elem[16U] = { 0U };
+    memcpy(elem, last, rem * sizeof (uint8_t));
+    fmul_r_add(acc, elem, pre);
+  }
+}
+
+void Hacl_Gf128_NI_gcm_emit(uint8_t *tag, Lib_IntVector_Intrinsics_vec128 *ctx)
+{
+  Lib_IntVector_Intrinsics_vec128 *acc = ctx;
+  Lib_IntVector_Intrinsics_vec128_store_be(tag, acc[0U]);
+}
+
+void Hacl_Gf128_NI_ghash(uint8_t *tag, uint32_t len, uint8_t *text, uint8_t *key)
+{
+  Lib_IntVector_Intrinsics_vec128 ctx[9U];
+  for (uint32_t _i = 0U; _i < (uint32_t)9U; ++_i)
+    ctx[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  Hacl_Gf128_NI_gcm_init(ctx, key);
+  Hacl_Gf128_NI_gcm_update_blocks(ctx, len, text);
+  Hacl_Gf128_NI_gcm_emit(tag, ctx);
+}
+
+void Hacl_Gf128_NI_polyval_init(Lib_IntVector_Intrinsics_vec128 *ctx, uint8_t *key)
+{
+  Lib_IntVector_Intrinsics_vec128 *acc = ctx;
+  Lib_IntVector_Intrinsics_vec128 *pre = ctx + (uint32_t)1U;
+  acc[0U] = Lib_IntVector_Intrinsics_vec128_zero;
+  load_precompute_r_le(pre, key);
+}
+
+void
+Hacl_Gf128_NI_polyval_update_blocks(
+  Lib_IntVector_Intrinsics_vec128 *ctx,
+  uint32_t len,
+  uint8_t *text
+)
+{
+  Lib_IntVector_Intrinsics_vec128 *acc = ctx;
+  Lib_IntVector_Intrinsics_vec128 *pre = ctx + (uint32_t)1U;
+  uint32_t len0 = len / (uint32_t)128U * (uint32_t)128U;
+  uint8_t *t0 = text;
+  uint32_t nb0 = len0 / (uint32_t)128U;
+  for (uint32_t i = (uint32_t)0U; i < nb0; i++)
+  {
+    uint8_t *block = t0 + i * (uint32_t)128U;
+    fmul_r8_add_le(acc, block, pre);
+  }
+  uint32_t len1 = len - len0;
+  uint8_t *t1 = text + len0;
+  uint32_t nb = len1 / (uint32_t)16U;
+  uint32_t rem = len1 % (uint32_t)16U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    uint8_t *block = t1 + i * (uint32_t)16U;
+    fmul_r_add_le(acc, block, pre);
+  }
+  if (rem > (uint32_t)0U)
+  {
+    uint8_t *last = t1 + nb * (uint32_t)16U;
+    uint8_t elem[16U] = { 0U };
+    memcpy(elem, last, rem * sizeof (uint8_t));
+    fmul_r_add_le(acc, elem, pre);
+  }
+}
+
+void Hacl_Gf128_NI_polyval_emit(uint8_t *tag, Lib_IntVector_Intrinsics_vec128 *ctx)
+{
+  Lib_IntVector_Intrinsics_vec128 *acc = ctx;
+  Lib_IntVector_Intrinsics_vec128_store_le(tag, acc[0U]);
+}
+
+void Hacl_Gf128_NI_polyval(uint8_t *tag, uint32_t len, uint8_t *text, uint8_t *key)
+{
+  Lib_IntVector_Intrinsics_vec128 ctx[9U];
+  for (uint32_t _i = 0U; _i < (uint32_t)9U; ++_i)
+    ctx[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  Hacl_Gf128_NI_polyval_init(ctx, key);
+  Hacl_Gf128_NI_polyval_update_blocks(ctx, len, text);
+  Hacl_Gf128_NI_polyval_emit(tag, ctx);
+}
+
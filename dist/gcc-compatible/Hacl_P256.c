@@ -1377,6 +1377,50 @@ static void point_add(uint64_t *p, uint64_t *q, uint64_t *result, uint64_t *temp
   memcpy(result + (uint32_t)8U, z3_out1, (uint32_t)4U * sizeof (uint64_t));
 }
 
+static void
+point_add_complete(uint64_t *p, uint64_t *q, uint64_t *result, uint64_t *tempBuffer)
+{
+  uint64_t tmp[36U] = { 0U };
+  uint64_t *u1 = tmp;
+  uint64_t *u2 = tmp + (uint32_t)4U;
+  uint64_t *s1 = tmp + (uint32_t)8U;
+  uint64_t *s2 = tmp + (uint32_t)12U;
+  uint64_t *h = tmp + (uint32_t)16U;
+  uint64_t *r = tmp + (uint32_t)20U;
+  uint64_t *pointDouble = tmp + (uint32_t)24U;
+  uint64_t *tempBuffer16 = tempBuffer;
+  uint64_t *pX = p;
+  uint64_t *pY = p + (uint32_t)4U;
+  uint64_t *pZ = p + (uint32_t)8U;
+  uint64_t *qX = q;
+  uint64_t *qY = q + (uint32_t)4U;
+  uint64_t *qZ = q + (uint32_t)8U;
+  uint64_t *z2Square = tempBuffer16;
+  uint64_t *z1Square = tempBuffer16 + (uint32_t)4U;
+  uint64_t *z2Cube = tempBuffer16 + (uint32_t)8U;
+  uint64_t *z1Cube = tempBuffer16 + (uint32_t)12U;
+  montgomery_square_buffer(qZ, z2Square);
+  montgomery_square_buffer(pZ, z1Square);
+  montgomery_multiplication_buffer(z2Square, qZ, z2Cube);
+  montgomery_multiplication_buffer(z1Square, pZ, z1Cube);
+  montgomery_multiplication_buffer(z2Square, pX, u1);
+  montgomery_multiplication_buffer(z1Square, qX, u2);
+  montgomery_multiplication_buffer(z2Cube, pY, s1);
+  montgomery_multiplication_buffer(z1Cube, qY, s2);
+  p256_sub(u2, u1, h);
+  p256_sub(s2, s1, r);
+  uint64_t pInf = isZero_uint64_CT(p + (uint32_t)8U);
+  uint64_t qInf = isZero_uint64_CT(q + (uint32_t)8U);
+  uint64_t hZero = isZero_uint64_CT(h);
+  uint64_t rZero = isZero_uint64_CT(r);
+  uint64_t mask = (~pInf & ~qInf) & (hZero & rZero);
+  point_double(p, pointDouble, tempBuffer);
+  point_add(p, q, result, tempBuffer);
+  copy_conditional(result, pointDouble, mask);
+  copy_conditional(result + (uint32_t)4U, pointDouble + (uint32_t)4U, mask);
+  copy_conditional(result + (uint32_t)8U, pointDouble + (uint32_t)8U, mask);
+}
+
 static void pointToDomain(uint64_t *p, uint64_t *result)
 {
   uint64_t *p_x = p;
@@ -1541,72 +1585,76 @@ static void uploadBasePoint(uint64_t *p)
   p[11U] = (uint64_t)4294967294U;
 }
 
-static void
-scalarMultiplicationWithoutNorm(
-  uint64_t *p,
-  uint64_t *result,
-  uint8_t *scalar,
-  uint64_t *tempBuffer
-)
+static void precomp_lookup(uint64_t *r, uint32_t k, uint32_t b)
 {
-  uint64_t *q = tempBuffer;
-  zero_buffer(q);
-  uint64_t *buff = tempBuffer + (uint32_t)12U;
-  pointToDomain(p, result);
-  for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
+  uint64_t *rz = r + (uint32_t)8U;
+  memset(r, 0U, (uint32_t)12U * sizeof (uint64_t));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)15U; i++)
   {
-    uint32_t bit0 = (uint32_t)255U - i;
+    uint64_t mask = FStar_UInt64_eq_mask((uint64_t)b, (uint64_t)(i + (uint32_t)1U));
+    const
     uint64_t
-    bit =
-      (uint64_t)(scalar[(uint32_t)31U - bit0 / (uint32_t)8U] >> bit0 % (uint32_t)8U & (uint8_t)1U);
-    cswap(bit, q, result);
-    point_add(q, result, result, buff);
-    point_double(q, q, buff);
-    cswap(bit, q, result);
+    *e = Hacl_P256_PrecompTable_precomp_basepoint_table + ((uint32_t)15U * k + i) * (uint32_t)8U;
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      uint64_t *os = r;
+      uint64_t x = r[j] ^ (mask & (r[j] ^ e[j]));
+      os[j] = x;
+    }
+  }
+  uint64_t mask = ~FStar_UInt64_eq_mask((uint64_t)b, (uint64_t)0U);
+  rz[0U] = mask & (uint64_t)1U;
+  rz[1U] = mask & (uint64_t)18446744069414584320U;
+  rz[2U] = mask & (uint64_t)18446744073709551615U;
+  rz[3U] = mask & (uint64_t)4294967294U;
+}
+
+static void point_mul_g(uint64_t *result, uint8_t *scalar, uint64_t *tempBuffer)
+{
+  uint8_t e[64U] = { 0U };
+  uint64_t tmp[24U] = { 0U };
+  uint64_t *q = tmp;
+  uint64_t *r2 = tmp + (uint32_t)12U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    uint8_t si = scalar[(uint32_t)31U - i];
+    e[(uint32_t)2U * i] = si & (uint8_t)15U;
+    e[(uint32_t)2U * i + (uint32_t)1U] = si >> (uint32_t)4U;
   }
+  zero_buffer(result);
+  zero_buffer(r2);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    precomp_lookup(q, i, (uint32_t)e[(uint32_t)2U * i + (uint32_t)1U]);
+    point_add(q, result, result, tempBuffer);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    point_double(result, result, tempBuffer);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    precomp_lookup(q, i, (uint32_t)e[(uint32_t)2U * i]);
+    point_add(q, r2, r2, tempBuffer);
+  }
+  point_add_complete(result, r2, q, tempBuffer);
   copy_point(q, result);
 }
 
 void
 Hacl_Impl_P256_Core_secretToPublic(uint64_t *result, uint8_t *scalar, uint64_t *tempBuffer)
 {
-  uint64_t basePoint[12U] = { 0U };
-  uploadBasePoint(basePoint);
   uint64_t *q = tempBuffer;
   uint64_t *buff = tempBuffer + (uint32_t)12U;
-  zero_buffer(q);
-  for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
-  {
-    uint32_t bit0 = (uint32_t)255U - i;
-    uint64_t
-    bit =
-      (uint64_t)(scalar[(uint32_t)31U - bit0 / (uint32_t)8U] >> bit0 % (uint32_t)8U & (uint8_t)1U);
-    cswap(bit, q, basePoint);
-    point_add(q, basePoint, basePoint, buff);
-    point_double(q, q, buff);
-    cswap(bit, q, basePoint);
-  }
+  point_mul_g(q, scalar, buff);
   norm(q, result, buff);
 }
 
 static void secretToPublicWithoutNorm(uint64_t *result, uint8_t *scalar, uint64_t *tempBuffer)
 {
-  uint64_t basePoint[12U] = { 0U };
-  uploadBasePoint(basePoint);
   uint64_t *q = tempBuffer;
   uint64_t *buff = tempBuffer + (uint32_t)12U;
-  zero_buffer(q);
-  for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
-  {
-    uint32_t bit0 = (uint32_t)255U - i;
-    uint64_t
-    bit =
-      (uint64_t)(scalar[(uint32_t)31U - bit0 / (uint32_t)8U] >> bit0 % (uint32_t)8U & (uint8_t)1U);
-    cswap(bit, q, basePoint);
-    point_add(q, basePoint, basePoint, buff);
-    point_double(q, q, buff);
-    cswap(bit, q, basePoint);
-  }
+  point_mul_g(q, scalar, buff);
   copy_point(q, result);
 }
 
@@ -2057,6 +2105,217 @@ static bool compare_felem_bool(uint64_t *a, uint64_t *b)
   return a_0 == b_0 && a_1 == b_1 && a_2 == b_2 && a_3 == b_3;
 }
 
+/*
+   The input of the function is considered to be public,
+thus this code is not secret independent with respect to the operations done over the input.
+*/
+static void point_negate(uint64_t *p, uint64_t *result)
+{
+  uint64_t zero[4U] = { 0U };
+  memcpy(result, p, (uint32_t)4U * sizeof (uint64_t));
+  p256_sub(zero, p + (uint32_t)4U, result + (uint32_t)4U);
+  memcpy(result + (uint32_t)8U, p + (uint32_t)8U, (uint32_t)4U * sizeof (uint64_t));
+}
+
+/*
+   The input of the function is considered to be public,
+thus this code is not secret independent with respect to the operations done over the input.
+*/
+static bool point_add_is_double(uint64_t *p, uint64_t *q)
+{
+  uint64_t tmp[32U] = { 0U };
+  uint64_t *z2Square = tmp;
+  uint64_t *z1Square = tmp + (uint32_t)4U;
+  uint64_t *z2Cube = tmp + (uint32_t)8U;
+  uint64_t *z1Cube = tmp + (uint32_t)12U;
+  uint64_t *u1 = tmp + (uint32_t)16U;
+  uint64_t *u2 = tmp + (uint32_t)20U;
+  uint64_t *s1 = tmp + (uint32_t)24U;
+  uint64_t *s2 = tmp + (uint32_t)28U;
+  uint64_t *pX = p;
+  uint64_t *pY = p + (uint32_t)4U;
+  uint64_t *pZ = p + (uint32_t)8U;
+  uint64_t *qX = q;
+  uint64_t *qY = q + (uint32_t)4U;
+  uint64_t *qZ = q + (uint32_t)8U;
+  montgomery_square_buffer(qZ, z2Square);
+  montgomery_square_buffer(pZ, z1Square);
+  montgomery_multiplication_buffer(z2Square, qZ, z2Cube);
+  montgomery_multiplication_buffer(z1Square, pZ, z1Cube);
+  montgomery_multiplication_buffer(z2Square, pX, u1);
+  montgomery_multiplication_buffer(z1Square, qX, u2);
+  montgomery_multiplication_buffer(z2Cube, pY, s1);
+  montgomery_multiplication_buffer(z1Cube, qY, s2);
+  uint64_t *h = z2Square;
+  uint64_t *r = z1Square;
+  p256_sub(u2, u1, h);
+  p256_sub(s2, s1, r);
+  bool hZero = isZero_uint64_CT(h) == (uint64_t)0xFFFFFFFFFFFFFFFFU;
+  bool rZero = isZero_uint64_CT(r) == (uint64_t)0xFFFFFFFFFFFFFFFFU;
+  return hZero && rZero;
+}
+
+/*
+   The input of the function is considered to be public,
+thus this code is not secret independent with respect to the operations done over the input.
+*/
+static void point_add_vartime(uint64_t *p, uint64_t *q, uint64_t *result, uint64_t *tempBuffer)
+{
+  bool pInf = isPointAtInfinityPublic(p);
+  bool qInf = isPointAtInfinityPublic(q);
+  bool isDouble;
+  if (pInf || qInf)
+  {
+    isDouble = false;
+  }
+  else
+  {
+    isDouble = point_add_is_double(p, q);
+  }
+  if (isDouble)
+  {
+    point_double(p, result, tempBuffer);
+  }
+  else
+  {
+    point_add(p, q, result, tempBuffer);
+  }
+}
+
+/*
+   The input of the function is considered to be public,
+thus this code is not secret independent with respect to the operations done over the input.
+*/
+static uint32_t wnaf_window(uint64_t *k, uint32_t bit)
+{
+  uint32_t q = bit >> (uint32_t)6U;
+  uint32_t r = bit & (uint32_t)63U;
+  uint64_t lo = k[q];
+  uint64_t w;
+  if (r > (uint32_t)59U && q + (uint32_t)1U < (uint32_t)4U)
+  {
+    w = lo >> r | k[q + (uint32_t)1U] << ((uint32_t)64U - r);
+  }
+  else
+  {
+    w = lo >> r;
+  }
+  return (uint32_t)(w & (uint64_t)31U);
+}
+
+/*
+   The input of the function is considered to be public,
+thus this code is not secret independent with respect to the operations done over the input.
+*/
+static void wnaf(int8_t *r, uint64_t *k)
+{
+  uint32_t state[2U] = { 0U };
+  uint32_t *carry = state;
+  uint32_t *next = state + (uint32_t)1U;
+  memset(r, 0U, (uint32_t)257U * sizeof (int8_t));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
+  {
+    if (i == next[0U])
+    {
+      uint32_t window = carry[0U] + wnaf_window(k, i);
+      if ((window & (uint32_t)1U) == (uint32_t)0U)
+      {
+        next[0U] = i + (uint32_t)1U;
+      }
+      else
+      {
+        if (window < (uint32_t)16U)
+        {
+          carry[0U] = (uint32_t)0U;
+          r[i] = (int8_t)(uint8_t)window;
+        }
+        else
+        {
+          carry[0U] = (uint32_t)1U;
+          r[i] = (int8_t)(uint8_t)window - (int8_t)32;
+        }
+        next[0U] = i + (uint32_t)5U;
+      }
+    }
+  }
+  r[256U] = (int8_t)(uint8_t)carry[0U];
+}
+
+/*
+   The input of the function is considered to be public,
+thus this code is not secret independent with respect to the operations done over the input.
+*/
+static void precomp_odd(uint64_t *table, uint64_t *p, uint64_t *tempBuffer)
+{
+  uint64_t p2[12U] = { 0U };
+  point_double(p, p2, tempBuffer);
+  memcpy(table, p, (uint32_t)12U * sizeof (uint64_t));
+  for (uint32_t i = (uint32_t)1U; i < (uint32_t)8U; i++)
+  {
+    uint64_t *t = table + (uint32_t)12U * i;
+    memcpy(t, table + (uint32_t)12U * i - (uint32_t)12U, (uint32_t)12U * sizeof (uint64_t));
+    point_add_vartime(p2, t, t, tempBuffer);
+  }
+}
+
+/*
+   The input of the function is considered to be public,
+thus this code is not secret independent with respect to the operations done over the input.
+*/
+static void
+point_mul_double_vartime(
+  uint64_t *result,
+  uint64_t *u1,
+  uint64_t *u2,
+  uint64_t *q,
+  uint64_t *tempBuffer
+)
+{
+  int8_t r1[257U] = { 0U };
+  int8_t r2[257U] = { 0U };
+  uint64_t tables[192U] = { 0U };
+  uint64_t tmp[24U] = { 0U };
+  uint64_t *table1 = tables;
+  uint64_t *table2 = tables + (uint32_t)96U;
+  uint64_t *basePoint = tmp;
+  uint64_t *negPoint = tmp + (uint32_t)12U;
+  wnaf(r1, u1);
+  wnaf(r2, u2);
+  uploadBasePoint(basePoint);
+  precomp_odd(table1, basePoint, tempBuffer);
+  precomp_odd(table2, q, tempBuffer);
+  memset(result, 0U, (uint32_t)12U * sizeof (uint64_t));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)257U; i++)
+  {
+    uint32_t j = (uint32_t)257U - i - (uint32_t)1U;
+    point_double(result, result, tempBuffer);
+    int8_t d = r1[j];
+    if (d > (int8_t)0)
+    {
+      uint32_t j1 = (uint32_t)((d - (int8_t)1) / (int8_t)2);
+      point_add_vartime(table1 + (uint32_t)12U * j1, result, result, tempBuffer);
+    }
+    else if (d < (int8_t)0)
+    {
+      uint32_t j1 = (uint32_t)(((int8_t)0 - d - (int8_t)1) / (int8_t)2);
+      point_negate(table1 + (uint32_t)12U * j1, negPoint);
+      point_add_vartime(negPoint, result, result, tempBuffer);
+    }
+    int8_t d0 = r2[j];
+    if (d0 > (int8_t)0)
+    {
+      uint32_t j1 = (uint32_t)((d0 - (int8_t)1) / (int8_t)2);
+      point_add_vartime(table2 + (uint32_t)12U * j1, result, result, tempBuffer);
+    }
+    else if (d0 < (int8_t)0)
+    {
+      uint32_t j1 = (uint32_t)(((int8_t)0 - d0 - (int8_t)1) / (int8_t)2);
+      point_negate(table2 + (uint32_t)12U * j1, negPoint);
+      point_add_vartime(negPoint, result, result, tempBuffer);
+    }
+  }
+}
+
 /*
    The input of the function is considered to be public,
 thus this code is not secret independent with respect to the operations done over the input.
@@ -2089,9 +2348,9 @@ ecdsa_verification_(
   {
     return false;
   }
-  uint8_t tempBufferU8[64U] = { 0U };
-  uint8_t *bufferU1 = tempBufferU8;
-  uint8_t *bufferU2 = tempBufferU8 + (uint32_t)32U;
+  uint64_t tempBufferU640[8U] = { 0U };
+  uint64_t *u1 = tempBufferU640;
+  uint64_t *u2 = tempBufferU640 + (uint32_t)4U;
   uint32_t sz;
   if (alg.tag == Spec_ECDSA_NoHash)
   {
@@ -2198,54 +2457,16 @@ ecdsa_verification_(
   uint8_t *cutHash = mHash;
   Hacl_Impl_P256_LowLevel_toUint64ChangeEndian(cutHash, hashAsFelem);
   reduction_prime_2prime_order(hashAsFelem, hashAsFelem);
-  uint64_t tempBuffer1[12U] = { 0U };
-  uint64_t *inverseS = tempBuffer1;
-  uint64_t *u1 = tempBuffer1 + (uint32_t)4U;
-  uint64_t *u2 = tempBuffer1 + (uint32_t)8U;
+  uint64_t inverseS[4U] = { 0U };
   fromDomainImpl(s, inverseS);
   montgomery_ladder_exponent(inverseS);
   multPowerPartial(inverseS, hashAsFelem, u1);
   multPowerPartial(inverseS, r, u2);
-  Hacl_Impl_P256_LowLevel_changeEndian(u1);
-  Hacl_Impl_P256_LowLevel_changeEndian(u2);
-  Hacl_Impl_P256_LowLevel_toUint8(u1, bufferU1);
-  Hacl_Impl_P256_LowLevel_toUint8(u2, bufferU2);
   uint64_t pointSum[12U] = { 0U };
-  uint64_t points[24U] = { 0U };
+  uint64_t pubKeyDomain[12U] = { 0U };
   uint64_t *buff = tempBuffer + (uint32_t)12U;
-  uint64_t *pointU1G = points;
-  uint64_t *pointU2Q0 = points + (uint32_t)12U;
-  secretToPublicWithoutNorm(pointU1G, bufferU1, tempBuffer);
-  scalarMultiplicationWithoutNorm(publicKeyBuffer, pointU2Q0, bufferU2, tempBuffer);
-  uint64_t *pointU1G0 = points;
-  uint64_t *pointU2Q = points + (uint32_t)12U;
-  uint64_t tmp[112U] = { 0U };
-  uint64_t *tmpForNorm = tmp;
-  uint64_t *result0Norm = tmp + (uint32_t)88U;
-  uint64_t *result1Norm = tmp + (uint32_t)100U;
-  uint64_t *pointU1G1 = points;
-  uint64_t *pointU2Q1 = points + (uint32_t)12U;
-  norm(pointU1G1, result0Norm, tmpForNorm);
-  norm(pointU2Q1, result1Norm, tmpForNorm);
-  uint64_t *x0 = result0Norm;
-  uint64_t *y0 = result0Norm + (uint32_t)4U;
-  uint64_t *z0 = result0Norm + (uint32_t)8U;
-  uint64_t *x1 = result1Norm;
-  uint64_t *y1 = result1Norm + (uint32_t)4U;
-  uint64_t *z1 = result1Norm + (uint32_t)8U;
-  bool xEqual = compare_felem_bool(x0, x1);
-  bool yEqual = compare_felem_bool(y0, y1);
-  bool zEqual = compare_felem_bool(z0, z1);
-  bool equalX = xEqual && yEqual && zEqual;
-  bool equalX0 = equalX;
-  if (equalX0)
-  {
-    point_double(pointU1G0, pointSum, buff);
-  }
-  else
-  {
-    point_add(pointU1G0, pointU2Q, pointSum, buff);
-  }
+  pointToDomain(publicKeyBuffer, pubKeyDomain);
+  point_mul_double_vartime(pointSum, u1, u2, pubKeyDomain, buff);
   norm(pointSum, pointSum, buff);
   bool resultIsPAI = isPointAtInfinityPublic(pointSum);
   uint64_t *xCoordinateSum = pointSum;
@@ -38,6 +38,7 @@ extern "C" {
 #include "kremlin/internal/target.h"
 
 
+#include "Hacl_P256_PrecompTable.h"
 #include "Hacl_Kremlib.h"
 #include "Hacl_Hash.h"
 #include "Hacl_Spec.h"
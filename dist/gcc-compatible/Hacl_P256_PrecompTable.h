@@ -0,0 +1,1333 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_P256_PrecompTable_H
+#define __Hacl_P256_PrecompTable_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+
+
+static const
+uint64_t
+Hacl_P256_PrecompTable_precomp_basepoint_table[3840U] =
+  {
+    (uint64_t)0x79e730d418a9143cU, (uint64_t)0x75ba95fc5fedb601U, (uint64_t)0x79fb732b77622510U,
+    (uint64_t)0x18905f76a53755c6U, (uint64_t)0xddf25357ce95560aU, (uint64_t)0x8b4ab8e4ba19e45cU,
+    (uint64_t)0xd2e88688dd21f325U, (uint64_t)0x8571ff1825885d85U, (uint64_t)0x850046d410ddd64dU,
+    (uint64_t)0xaa6ae3c1a433827dU, (uint64_t)0x732205038d1490d9U, (uint64_t)0xf6bb32e43dcf3a3bU,
+    (uint64_t)0x2f3648d361bee1a5U, (uint64_t)0x152cd7cbeb236ff8U, (uint64_t)0x19a8fb0e92042dbeU,
+    (uint64_t)0x78c577510a5b8a3bU, (uint64_t)0xffac3f904eebc127U, (uint64_t)0xb027f84a087d81fbU,
+    (uint64_t)0x66ad77dd87cbbc98U, (uint64_t)0x26936a3fb6ff747eU, (uint64_t)0xb04c5c1fc983a7ebU,
+    (uint64_t)0x583e47ad0861fe1aU, (uint64_t)0x788208311a2ee98eU, (uint64_t)0xd5f06a29e587cc07U,
+    (uint64_t)0x74b0b50d46918dccU, (uint64_t)0x4650a6edc623c173U, (uint64_t)0xcdaacace8100af2U,
+    (uint64_t)0x577362f541b0176bU, (uint64_t)0x2d96f24ce4cbaba6U, (uint64_t)0x17628471fad6f447U,
+    (uint64_t)0x6b6c36dee5ddd22eU, (uint64_t)0x84b14c394c5ab863U, (uint64_t)0xbe1b8aaec45c61f5U,
+    (uint64_t)0x90ec649a94b9537dU, (uint64_t)0x941cb5aad076c20cU, (uint64_t)0xc9079605890523c8U,
+    (uint64_t)0xeb309b4ae7ba4f10U, (uint64_t)0x73c568efe5eb882bU, (uint64_t)0x3540a9877e7a1f68U,
+    (uint64_t)0x73a076bb2dd1e916U, (uint64_t)0x403947373e77664aU, (uint64_t)0x55ae744f346cee3eU,
+    (uint64_t)0xd50a961a5b17a3adU, (uint64_t)0x13074b5954213673U, (uint64_t)0x93d36220d377e44bU,
+    (uint64_t)0x299c2b53adff14b5U, (uint64_t)0xf424d44cef639f11U, (uint64_t)0xa4c9916d4a07f75fU,
+    (uint64_t)0x746354ea0173b4fU, (uint64_t)0x2bd20213d23c00f7U, (uint64_t)0xf43eaab50c23bb08U,
+    (uint64_t)0x13ba5119c3123e03U, (uint64_t)0x2847d0303f5b9d4dU, (uint64_t)0x6742f2f25da67bddU,
+    (uint64_t)0xef933bdc77c94195U, (uint64_t)0xeaedd9156e240867U, (uint64_t)0x27f14cd19499a78fU,
+    (uint64_t)0x462ab5c56f9b3455U, (uint64_t)0x8f90f02af02cfc6bU, (uint64_t)0xb763891eb265230dU,
+    (uint64_t)0xf59da3a9532d4977U, (uint64_t)0x21e3327dcf9eba15U, (uint64_t)0x123c7b84be60bbf0U,
+    (uint64_t)0x56ec12f27706df76U, (uint64_t)0x75c96e8f264e20e8U, (uint64_t)0xabe6bfed59a7a841U,
+    (uint64_t)0x2cc09c0444c8eb00U, (uint64_t)0xe05b3080f0c4e16bU, (uint64_t)0x1eb7777aa45f3314U,
+    (uint64_t)0x56af7bedce5d45e3U, (uint64_t)0x2b6e019a88b12f1aU, (uint64_t)0x86659cdfd835f9bU,
+    (uint64_t)0x2c18dbd19dc21ec8U, (uint64_t)0x98f9868a0fcf8139U, (uint64_t)0x737d2cd648250b49U,
+    (uint64_t)0xcc61c94724b3428fU, (uint64_t)0xc2b407880dd9e76U, (uint64_t)0xc43a8991383fbe08U,
+    (uint64_t)0x5f7d2d65779be5d2U, (uint64_t)0x78719a54eb3b4ab5U, (uint64_t)0xea7d260a6245e404U,
+    (uint64_t)0x9de407956e7fdfe0U, (uint64_t)0x1ff3a4158dac1ab5U, (uint64_t)0x3e7090f1649c9073U,
+    (uint64_t)0x1a7685612b944e88U, (uint64_t)0x250f939ee57f61c8U, (uint64_t)0xc0daa891ead643dU,
+    (uint64_t)0x68930023e125b88eU, (uint64_t)0x4b71aa7d2697768U, (uint64_t)0xabdedef5ca345a33U,
+    (uint64_t)0x2409d29dee37385eU, (uint64_t)0x4ee1df77cb83e156U, (uint64_t)0xcac12d91cbb5b43U,
+    (uint64_t)0x170ed2f6ca895637U, (uint64_t)0x28228cfa8ade6d66U, (uint64_t)0x7ff57c9553238acaU,
+    (uint64_t)0xccc425634b2ed709U, (uint64_t)0xe356769856fd30dU, (uint64_t)0xbcbcd43f559e9811U,
+    (uint64_t)0x738477ac5395b759U, (uint64_t)0x35752b90c00ee17fU, (uint64_t)0x68748390742ed2e3U,
+    (uint64_t)0x7cd06422bd1f5bc1U, (uint64_t)0xfbc08769c9e7b797U, (uint64_t)0xa242a35bb0cf664aU,
+    (uint64_t)0x126e48f77f9707e3U, (uint64_t)0x1717bf54c6832660U, (uint64_t)0xfaae7332fd12c72eU,
+    (uint64_t)0x27b52db7995d586bU, (uint64_t)0xbe29569e832237c2U, (uint64_t)0xe8e4193e2a65e7dbU,
+    (uint64_t)0x152706dc2eaa1bbbU, (uint64_t)0x72bcd8b7bc60055bU, (uint64_t)0x3cc23ee56e27e4bU,
+    (uint64_t)0xee337424e4819370U, (uint64_t)0xe2aa0e430ad3da09U, (uint64_t)0x40b8524f6383c45dU,
+    (uint64_t)0xd766355442a41b25U, (uint64_t)0x64efa6de778a4797U, (uint64_t)0x2042170a7079adf4U,
+    (uint64_t)0x486d8ffa696946fcU, (uint64_t)0x50fbc6d8b9cba56dU, (uint64_t)0x7e3d423e90f35a15U,
+    (uint64_t)0x7c3da195c0dd962cU, (uint64_t)0xe673fdb03cfd5d8bU, (uint64_t)0x704b7c2889dfca5U,
+    (uint64_t)0xf6ce581ff52305aaU, (uint64_t)0x399d49eb914d5e53U, (uint64_t)0x44e3811039949296U,
+    (uint64_t)0x5b63827b361db1b5U, (uint64_t)0x3e5323ed206eaff5U, (uint64_t)0x942370d2c21f4290U,
+    (uint64_t)0xf2caaf2ee0d985a1U, (uint64_t)0x192cc64b7239846dU, (uint64_t)0x7c0b8f47ae6312f8U,
+    (uint64_t)0x7dc61f9196620108U, (uint64_t)0x35d6a53eed4c3717U, (uint64_t)0x9f8240cf3d0ed2a3U,
+    (uint64_t)0x8c0d4d05e5543aa5U, (uint64_t)0x45d5bbfbdd33b4b4U, (uint64_t)0xfa04cc73137fd28eU,
+    (uint64_t)0x862ac6efc73b3ffdU, (uint64_t)0x403ff9f531f51ef2U, (uint64_t)0x34d5e0fcbc73f5a2U,
+    (uint64_t)0x4f7081e144cc3addU, (uint64_t)0xd5ffa1d687be82cfU, (uint64_t)0x89890b6c0edd6472U,
+    (uint64_t)0xada26e1a3ed17863U, (uint64_t)0x276f271563483caaU, (uint64_t)0xe6924cd92f6077fdU,
+    (uint64_t)0x5a7fe980a466e3cU, (uint64_t)0xf1c794b0b1902d1fU, (uint64_t)0x33b2385c08369a90U,
+    (uint64_t)0x2990c59b190eb4f8U, (uint64_t)0x819a6145c68eac80U, (uint64_t)0x7a786d622ec4a014U,
+    (uint64_t)0x33faadbe20ac3a8dU, (uint64_t)0x31a217815aba2d30U, (uint64_t)0x209d2742dba4f565U,
+    (uint64_t)0xdb2ce9e355aa0fbbU, (uint64_t)0xb3156bf38bd7aff1U, (uint64_t)0x1b5ee4cb1d81b146U,
+    (uint64_t)0x7ba1ac41d628a915U, (uint64_t)0x8f3a8f9cfd89699eU, (uint64_t)0x7329b9c9a0748be7U,
+    (uint64_t)0x1d391c95a92e621fU, (uint64_t)0xe51e6b214d10a837U, (uint64_t)0xd255f53a4947b435U,
+    (uint64_t)0xc4a58d474a86108U, (uint64_t)0xf8048a8fee4c5d90U, (uint64_t)0xe3c7c924e86d4c80U,
+    (uint64_t)0x28c889de056a1e60U, (uint64_t)0x57e2662eb214a040U, (uint64_t)0xe8c48e9837e10347U,
+    (uint64_t)0x8774286280ac748aU, (uint64_t)0xf1c24022186b06f2U, (uint64_t)0x3d2b24b9eb7926b8U,
+    (uint64_t)0xbff88cb3cdbe5509U, (uint64_t)0xd0f399afe4dd640bU, (uint64_t)0x3c5fe1302f76ed45U,
+    (uint64_t)0x6f3562f43764fb3dU, (uint64_t)0x7b5af3183151b62dU, (uint64_t)0xd5bd0bc7d79ce5f3U,
+    (uint64_t)0xfdaf6b20ec66890fU, (uint64_t)0xe8cbf1e5d5923359U, (uint64_t)0xdb0cea9d539b9fb0U,
+    (uint64_t)0xc5b34cf49859b98U, (uint64_t)0x5e583c56a4403cc6U, (uint64_t)0x11fc1a2dd48185b7U,
+    (uint64_t)0xc93fbc7e6e521787U, (uint64_t)0x47e7a05805105b8bU, (uint64_t)0x7b4d4d58db8260c8U,
+    (uint64_t)0xb31bd6136339c083U, (uint64_t)0x39ff8155dfb64701U, (uint64_t)0x7c3388d2e29604abU,
+    (uint64_t)0x1e19084ba6b10442U, (uint64_t)0x17cf54c0eccd47efU, (uint64_t)0x896933854a5dfb30U,
+    (uint64_t)0x69d023fb47daf9f6U, (uint64_t)0x9222840b7d91d959U, (uint64_t)0xc510610939842194U,
+    (uint64_t)0xb7e2353e49d05295U, (uint64_t)0xfc8c1d5cefb42ee0U, (uint64_t)0xe04884eb08ce811cU,
+    (uint64_t)0xf1f75d817419f40eU, (uint64_t)0x5b0ac162a995c241U, (uint64_t)0x120921bbc4c55646U,
+    (uint64_t)0x713520c28d33cf97U, (uint64_t)0x32027fe891e5d7d3U, (uint64_t)0xf14b7d1773a07678U,
+    (uint64_t)0xf88497b3c0dfdd61U, (uint64_t)0xf7c2eec02a8c4f48U, (uint64_t)0xaa5573f43756e621U,
+    (uint64_t)0xc013a2401825b948U, (uint64_t)0x1c03b34563878572U, (uint64_t)0xa0472bea653a4184U,
+    (uint64_t)0x41d04ee21726931aU, (uint64_t)0xbbbb2c83660ecfdU, (uint64_t)0xa6ef6de524818e18U,
+    (uint64_t)0xe421cc51e7d57887U, (uint64_t)0xf127d208bea87be6U, (uint64_t)0x16a475d3b1cdd682U,
+    (uint64_t)0x9db1b684439b63f7U, (uint64_t)0x5359b3dbf0f113b6U, (uint64_t)0x7b32d69bd4eff2d7U,
+    (uint64_t)0x88ae67714288b60fU, (uint64_t)0x159461b437a1e723U, (uint64_t)0x1f3d4789570aae8cU,
+    (uint64_t)0x869118c07f9871daU, (uint64_t)0x35fbda78f635e278U, (uint64_t)0x738f3641e1541dacU,
+    (uint64_t)0x6794b13ac0dae45fU, (uint64_t)0x3a5c752edcc18770U, (uint64_t)0x4baf1f2f8825c3a5U,
+    (uint64_t)0xebd63f7421b153edU, (uint64_t)0xa2383e47b2f64723U, (uint64_t)0xe7bf620a2646d19aU,
+    (uint64_t)0x56cb44ec03c83ffdU, (uint64_t)0xaf7267c94f6be9f1U, (uint64_t)0x8b2dfd7bc06bb5e9U,
+    (uint64_t)0xf0165fce3779ee3U, (uint64_t)0xe00e7f9dbd495d9eU, (uint64_t)0x1fa4efa220284e7aU,
+    (uint64_t)0x4564bade47ac6219U, (uint64_t)0x90e6312ac4708e8eU, (uint64_t)0x4f5725fba71e9adfU,
+    (uint64_t)0xe95f55ae3d684b9fU, (uint64_t)0x47f7ccb11e94b415U, (uint64_t)0x3617890361a341c1U,
+    (uint64_t)0x3604dc600cfd6142U, (uint64_t)0x22295eb8533316cU, (uint64_t)0x3dbde4ac44af2922U,
+    (uint64_t)0x898afc5d1c7eef69U, (uint64_t)0x58896805d14f4fa1U, (uint64_t)0x5002160203c21caU,
+    (uint64_t)0x6f0d1f3040ef730bU, (uint64_t)0xbd9b8b1dbe7a2af3U, (uint64_t)0xec51caa94fb74a72U,
+    (uint64_t)0xb9937a4b63879697U, (uint64_t)0x7c9a9d20ec2687d5U, (uint64_t)0x1773e44f6ef5f014U,
+    (uint64_t)0x8abcf412e90c6900U, (uint64_t)0x387bd0228142161eU, (uint64_t)0x50393755fcb6ff2aU,
+    (uint64_t)0xfabf770977f7195aU, (uint64_t)0x8ec86167adeb838fU, (uint64_t)0xea1285a8bb4f012dU,
+    (uint64_t)0xd68835039a3eab3fU, (uint64_t)0xee5d24f8309004c2U, (uint64_t)0xa96e4b7613ffe95eU,
+    (uint64_t)0xcdffe12bd223ea4U, (uint64_t)0x8f5c2ee5b6739a53U, (uint64_t)0x3d61333959145a65U,
+    (uint64_t)0xcd9bc368fa406337U, (uint64_t)0x82d11be32d8a52a0U, (uint64_t)0xf6877b2797a1c590U,
+    (uint64_t)0x837a819bf5cbdb25U, (uint64_t)0x2a4fd1d8de090249U, (uint64_t)0x622a7de774990e5fU,
+    (uint64_t)0x840fa5a07945511bU, (uint64_t)0xe58e90b36b0cf82eU, (uint64_t)0x6438d2462615b5e7U,
+    (uint64_t)0x7b1f8fc669c145aU, (uint64_t)0xb0d8b2da36f1e1cbU, (uint64_t)0x54d5dadbd9184c4dU,
+    (uint64_t)0x3dbb18d5f93d9976U, (uint64_t)0xa3e0f56d1147d47U, (uint64_t)0x2afa8c8da0a48609U,
+    (uint64_t)0x26e08c07e3533d77U, (uint64_t)0xd7222e6a2e341c99U, (uint64_t)0x9d60ec3d8d2dc4edU,
+    (uint64_t)0xbdfe0d8f7c476cf8U, (uint64_t)0x1fe59ab61d056605U, (uint64_t)0xa9ea9df686a8551fU,
+    (uint64_t)0x8489941e47fb8d8cU, (uint64_t)0xfeb874eb4a7f1b10U, (uint64_t)0xed406aa9bd763802U,
+    (uint64_t)0xc21486a065303da1U, (uint64_t)0x61ae291ec7e62ec4U, (uint64_t)0x622a0492df99333eU,
+    (uint64_t)0x7fd80c9dbb7a8ee0U, (uint64_t)0xdc2ed3bc6c01aedbU, (uint64_t)0x35c35a1208be74ecU,
+    (uint64_t)0xd540cb1a469f671fU, (uint64_t)0x9164088d977eab40U, (uint64_t)0x51f4c5b62760b390U,
+    (uint64_t)0xd238238f340dd553U, (uint64_t)0x358566c3db1d31c9U, (uint64_t)0x3a5ad69e5068f5ffU,
+    (uint64_t)0xf31435fcdaff6b06U, (uint64_t)0xae549a5bd6debff0U, (uint64_t)0x59e5f0b775e01331U,
+    (uint64_t)0x2cc5226138634818U, (uint64_t)0x501814f4b44c2e0bU, (uint64_t)0xf7e181aa54dfdba3U,
+    (uint64_t)0xcfd58ff0e759718cU, (uint64_t)0xf90cdb14d3b507a8U, (uint64_t)0x57bd478ec50bdad8U,
+    (uint64_t)0x29c197e250e5f9aaU, (uint64_t)0x4db6eef8e40bc855U, (uint64_t)0xd5d5cdd35958cd79U,
+    (uint64_t)0x3580a1b51d373114U, (uint64_t)0xa36e4c91fa935726U, (uint64_t)0xa38c534def20d760U,
+    (uint64_t)0x7088e40a2ff5845bU, (uint64_t)0xe5bb40bdbd78177fU, (uint64_t)0x4f06a7a8857f9920U,
+    (uint64_t)0xe3cc3e50e968f05dU, (uint64_t)0x2ce53c5abf776f5bU, (uint64_t)0x6f72407160357b05U,
+    (uint64_t)0xb259371771bf3f7aU, (uint64_t)0x87d2501c440c4a9fU, (uint64_t)0x440552e187b05340U,
+    (uint64_t)0xb7bf7cc821624c32U, (uint64_t)0x4155a6ce22facddbU, (uint64_t)0x5a4228cb889837efU,
+    (uint64_t)0x10595b5696a71cbaU, (uint64_t)0x944938b2fdcadeb7U, (uint64_t)0xa282da4cfccd8471U,
+    (uint64_t)0x98ec05f30d37bfe1U, (uint64_t)0xe171ce1b0698304aU, (uint64_t)0x2d69144421bdf79bU,
+    (uint64_t)0xd0cd3b741b21dec1U, (uint64_t)0x712ecd8b16a15f71U, (uint64_t)0xaad066da4d88f1ddU,
+    (uint64_t)0xc604f1657ad35deaU, (uint64_t)0x7edc07204478ca67U, (uint64_t)0xa10dfae0ba02ce06U,
+    (uint64_t)0xeceb1c76af36f4e4U, (uint64_t)0x994b2292af3f8f48U, (uint64_t)0xbf9ed77b77c8a68cU,
+    (uint64_t)0x74f544ea51744c9dU, (uint64_t)0xe89f48c85963a46eU, (uint64_t)0x658ab875a99e61c7U,
+    (uint64_t)0x6e296f874b8517b4U, (uint64_t)0x36c4fcdcfc1bc656U, (uint64_t)0xde5227a1a3906defU,
+    (uint64_t)0x9fe95f5762418945U, (uint64_t)0x20c91e81fdd96cdeU, (uint64_t)0x5adbe47eda4480deU,
+    (uint64_t)0xd9d0c8c4868af75dU, (uint64_t)0xd7325cff45c8c7eaU, (uint64_t)0xab471996cc81ecb0U,
+    (uint64_t)0xff5d55f3611824edU, (uint64_t)0xbe3145411977a0eeU, (uint64_t)0x5085c4c5722038c6U,
+    (uint64_t)0x2d5335bff94bb495U, (uint64_t)0x894ad8a6c8e2a082U, (uint64_t)0x540234b22c11bb37U,
+    (uint64_t)0x2d0366dded4c74a3U, (uint64_t)0xf9a968daeec5f25dU, (uint64_t)0x3660106867b63142U,
+    (uint64_t)0x7cd6d2c68d7b6d4U, (uint64_t)0xa8f74f090c842942U, (uint64_t)0xe27514047768b1eeU,
+    (uint64_t)0x4b5f7e89fe62aee4U, (uint64_t)0xd1e059b21994ef20U, (uint64_t)0x2a653b69638ae318U,
+    (uint64_t)0x70d5eb582f699010U, (uint64_t)0x279739f709f5f84aU, (uint64_t)0x5da4663c8b799336U,
+    (uint64_t)0xfdfdf14d203c37ebU, (uint64_t)0x32d8a9dca1dbfb2dU, (uint64_t)0xab40cff077d48f9bU,
+    (uint64_t)0xf2369f0b879fbbedU, (uint64_t)0xff0ae86da9d1869U, (uint64_t)0x5251d75956766f45U,
+    (uint64_t)0x4984d8c02be8d0fcU, (uint64_t)0x7ecc95a6d21008f0U, (uint64_t)0x29bd54a03a1a1c49U,
+    (uint64_t)0xab9828c5d26c50f3U, (uint64_t)0x32c0087c51d0d251U, (uint64_t)0xf61790abfbaf50a5U,
+    (uint64_t)0xdf55e76b684e0750U, (uint64_t)0xec516da7f176b005U, (uint64_t)0x575553bb7a2dddc7U,
+    (uint64_t)0x37c87ca3553afa73U, (uint64_t)0x315f3ffc4d55c251U, (uint64_t)0xe846442aaf3e5d35U,
+    (uint64_t)0x61b911496495ff28U, (uint64_t)0x47feeb6662b5f3afU, (uint64_t)0xcefab5610abb3734U,
+    (uint64_t)0x449de60e19f35cb1U, (uint64_t)0x39f8db14157f0eb9U, (uint64_t)0xffaecc5b3c61bfd6U,
+    (uint64_t)0xa5a4d41d41216703U, (uint64_t)0x7f8fabed224e1cc2U, (uint64_t)0xd5a8186871ad953U,
+    (uint64_t)0x4bdf3a4956f90823U, (uint64_t)0xba0f5080741d777bU, (uint64_t)0x91d71c3f38bf760U,
+    (uint64_t)0x9633d50f9b625b02U, (uint64_t)0x3ecb743b8c9de61U, (uint64_t)0xb47512545de74720U,
+    (uint64_t)0x9f9defc974ce1cb2U, (uint64_t)0x774a4f6a00bd32efU, (uint64_t)0x190d8ea601799a52U,
+    (uint64_t)0xa20cec41b86d2952U, (uint64_t)0x3062ffb27fff2a7cU, (uint64_t)0x741b32e579f19d37U,
+    (uint64_t)0xf80d81814eb57d47U, (uint64_t)0x7a2d0ed416aef06bU, (uint64_t)0x9735fb01cecb588U,
+    (uint64_t)0x1641caaac6061f5bU, (uint64_t)0x327bc002b0131e5bU, (uint64_t)0x1739e6d5cb2514d9U,
+    (uint64_t)0xc8cbdafe55a81543U, (uint64_t)0x5bb1a36ce1137243U, (uint64_t)0x205da3c517325327U,
+    (uint64_t)0xc35c1a36515a057eU, (uint64_t)0xf00f64c942925f9bU, (uint64_t)0xbd14633cb7d59f7aU,
+    (uint64_t)0xae2ad171656e8c3aU, (uint64_t)0xc0e2a4631acd0705U, (uint64_t)0x6f6a8aa0b6055cU,
+    (uint64_t)0xaf4513d72b65a26eU, (uint64_t)0x3f549e14d616d5bcU, (uint64_t)0x64ee395571253b1fU,
+    (uint64_t)0xe8b10bc1b8ce243aU, (uint64_t)0xbcbeace5913a4e77U, (uint64_t)0x47c1004341f37dbdU,
+    (uint64_t)0x96eccae36168ecf6U, (uint64_t)0x65bde59d1ca46aa3U, (uint64_t)0x38a7027ab8698ffaU,
+    (uint64_t)0xa2b89dc86dc34437U, (uint64_t)0x5a0a118d43a4153fU, (uint64_t)0x9e330a861ce22fd8U,
+    (uint64_t)0x28382af6b3bbd3bcU, (uint64_t)0x68d32256f779d6a7U, (uint64_t)0x20423b4d19e7284eU,
+    (uint64_t)0xde19aa1b38f3b153U, (uint64_t)0x73d0b6c28444f703U, (uint64_t)0x666161489c64e6a3U,
+    (uint64_t)0x99587c3737256224U, (uint64_t)0x6f5277fe61331563U, (uint64_t)0x7174ad4aa656502eU,
+    (uint64_t)0xb2e27c0d81e0271U, (uint64_t)0xa67a7596117a317cU, (uint64_t)0x17f08928a6723d99U,
+    (uint64_t)0x71a75681485310a3U, (uint64_t)0x90465462afb66ca9U, (uint64_t)0x185e97ccfbbe229dU,
+    (uint64_t)0x6a1a606addad8fc2U, (uint64_t)0x2431f316b3c797cfU, (uint64_t)0xec1ffc920133918dU,
+    (uint64_t)0x15d9bf5eb2c9ef97U, (uint64_t)0x7885b542fc6cbb9aU, (uint64_t)0x8abe64535720cf5dU,
+    (uint64_t)0x4e715dced4ec68abU, (uint64_t)0x57a67614279c24a3U, (uint64_t)0x788ed52a31bb61cfU,
+    (uint64_t)0xaba82444f437a003U, (uint64_t)0x4703401193529432U, (uint64_t)0x1f106bdd30743462U,
+    (uint64_t)0xabfb9964cd66d8caU, (uint64_t)0x934d9d5ae9bdadd5U, (uint64_t)0x5976d815908e3d22U,
+    (uint64_t)0x344a362f28e057bdU, (uint64_t)0xf92cdadc5443dfb3U, (uint64_t)0x1297adf089603bU,
+    (uint64_t)0x202886024147519aU, (uint64_t)0xd0981eac26b372f0U, (uint64_t)0xa9d4a7caa785ebc8U,
+    (uint64_t)0xd953c50ddbdf58e9U, (uint64_t)0x9d6361ccfd590f8fU, (uint64_t)0x72e9626b44e6c917U,
+    (uint64_t)0x7fd9611022eb64cfU, (uint64_t)0x863ebb7e9eb288f3U, (uint64_t)0x877b7cf5678a31b0U,
+    (uint64_t)0xd50301ae3998b620U, (uint64_t)0x734257c5c00fb396U, (uint64_t)0xf9fb18a004e672a6U,
+    (uint64_t)0xff8bd8ebe8758851U, (uint64_t)0x1e64e4c65d99ba44U, (uint64_t)0x4b8eaedf7dfd93b7U,
+    (uint64_t)0xba2f2a9804e76b8cU, (uint64_t)0xa18f07e0e90fb21eU, (uint64_t)0xfd2b80bba7fca1U,
+    (uint64_t)0x20387f2795cd67b5U, (uint64_t)0x5b89a4e7d39707f7U, (uint64_t)0x8f83ad3f894407ceU,
+    (uint64_t)0xa0025b946c226132U, (uint64_t)0xc79563c7f906c13bU, (uint64_t)0x5f548f314e7bb025U,
+    (uint64_t)0xee6d3a7c35d8794U, (uint64_t)0x42e65580356bae5U, (uint64_t)0x9f59698d643322fdU,
+    (uint64_t)0x9379ae1550a61967U, (uint64_t)0x64b9ae62fcc9981eU, (uint64_t)0xaed3d6316d2934c6U,
+    (uint64_t)0x2454b3025e4e65ebU, (uint64_t)0xab09f647f9950428U, (uint64_t)0xc1b3d3d331b85f09U,
+    (uint64_t)0xf45354aa88ae64aU, (uint64_t)0xa8b626d32fec50fdU, (uint64_t)0x1bdcfbd4e828834fU,
+    (uint64_t)0xe45a2866cd522539U, (uint64_t)0xfa9d4732810f7ab3U, (uint64_t)0xd8c1d6b4c905f293U,
+    (uint64_t)0x10ac80473461b597U, (uint64_t)0xe2c815366d91cd2cU, (uint64_t)0x40a2beeadaa3f0e4U,
+    (uint64_t)0xfb167a592441e083U, (uint64_t)0x4675e9e9240347U, (uint64_t)0x7848aaff840e446eU,
+    (uint64_t)0x9f9f258fea308f72U, (uint64_t)0x50f12899639bfad9U, (uint64_t)0x939ae63205c0af6U,
+    (uint64_t)0xbbb175146fc627e2U, (uint64_t)0xa0569bc591573a51U, (uint64_t)0xa7016d9e358243d5U,
+    (uint64_t)0xdac0c56ac1d6692U, (uint64_t)0x993833b5da590d5fU, (uint64_t)0xa8067803de817491U,
+    (uint64_t)0x65b4f2124dbf75d0U, (uint64_t)0xcc960232ccf80cfbU, (uint64_t)0xb2083a1222248accU,
+    (uint64_t)0x1f6ec0ef3264e366U, (uint64_t)0x5659b7045afdee28U, (uint64_t)0x7a823a40e6430bb5U,
+    (uint64_t)0x24592a04e1900a79U, (uint64_t)0xcde09d4ac9ee6576U, (uint64_t)0x52b6463f4b5ea54aU,
+    (uint64_t)0x1efe9ed3d3ca65a7U, (uint64_t)0x35d742806cf3d65bU, (uint64_t)0x4b7c790678b28dd9U,
+    (uint64_t)0xc4fcdd2f95e1f85fU, (uint64_t)0xcf6fb7ba591350b6U, (uint64_t)0x9f8e3287edfc26afU,
+    (uint64_t)0xe2dd9e73c2d0ed9aU, (uint64_t)0xeab5d67f24cbb703U, (uint64_t)0x60c293999a759a5aU,
+    (uint64_t)0xcf8625d7708f97cdU, (uint64_t)0xfb6c5119ea419de4U, (uint64_t)0xe8cb234dc03f9b06U,
+    (uint64_t)0x5a7822c335e23972U, (uint64_t)0x9b876319a284ff10U, (uint64_t)0xefcc49977093fdceU,
+    (uint64_t)0xdddfd62a878fe39aU, (uint64_t)0x44bfbe53910aa059U, (uint64_t)0xfb93ca3d7ca53d5fU,
+    (uint64_t)0x432649f004379cbfU, (uint64_t)0xf506113acba2ff75U, (uint64_t)0x4594ae2103718b35U,
+    (uint64_t)0x1aa6cee50d044627U, (uint64_t)0xc0e0d2b7f5c94aa2U, (uint64_t)0xbf33d3dee4dd3f5U,
+    (uint64_t)0xaca96e288477c97aU, (uint64_t)0x6487e9944a0ceffaU, (uint64_t)0xbba39edd98f54f99U,
+    (uint64_t)0x7f30dc48712240fcU, (uint64_t)0x806091713cd219ddU, (uint64_t)0xd96028d2b1b5067cU,
+    (uint64_t)0x4f6fcc1fe80c6e35U, (uint64_t)0x9dec37d65f1e3c72U, (uint64_t)0xf576db06ebf87855U,
+    (uint64_t)0x995c068e6861a713U, (uint64_t)0xa9ba339463de88dcU, (uint64_t)0xab954344689a964fU,
+    (uint64_t)0x58195aec0f5a0d6cU, (uint64_t)0xc5f207d5c98f8b50U, (uint64_t)0x6600cd280c98ccf6U,
+    (uint64_t)0x1a680fe339c3e6c2U, (uint64_t)0xa23f3931660e87c0U, (uint64_t)0x36cd2020a1559689U,
+    (uint64_t)0xa59d27a0e6133736U, (uint64_t)0xda90cee60b99e5d5U, (uint64_t)0x7a914a5651df2302U,
+    (uint64_t)0x757460d5f99a0475U, (uint64_t)0xb107314f40e49ce1U, (uint64_t)0x411c80ac910b8e30U,
+    (uint64_t)0x48e3547508069dddU, (uint64_t)0x43bc1b42c78440a1U, (uint64_t)0x9a07e22632ac6c3fU,
+    (uint64_t)0xaf3d7ba10f4bcd15U, (uint64_t)0x3ad43c9da36814c6U, (uint64_t)0xca11f742a0c9c162U,
+    (uint64_t)0xd3e06fc6c90b96ecU, (uint64_t)0xeace6e766bf2d03fU, (uint64_t)0x8bcd98e8f8032795U,
+    (uint64_t)0x889f6d65533ef217U, (uint64_t)0x7158c7e4c3ca2e87U, (uint64_t)0xfb670dfbdc2b4167U,
+    (uint64_t)0x75910a01844c257fU, (uint64_t)0xf336bf07cf88577dU, (uint64_t)0x22245250e45e2aceU,
+    (uint64_t)0x2ed92e8d7ca23d85U, (uint64_t)0x29f8be4c2b812f58U, (uint64_t)0xfbb9b2452133ffd9U,
+    (uint64_t)0x39a8b2f1830f1a20U, (uint64_t)0x484bc97dd5a1f52aU, (uint64_t)0xd6aebf56a40eddf8U,
+    (uint64_t)0x32257acb76ccdac6U, (uint64_t)0xaf4d36ec1586ff27U, (uint64_t)0x8eaa8863f8de7dd1U,
+    (uint64_t)0x45d5cf88647c16U, (uint64_t)0xc51e414351facc61U, (uint64_t)0xbaf2647de68a25bcU,
+    (uint64_t)0x8f5271a00ff872edU, (uint64_t)0x8f32ef993d2d9659U, (uint64_t)0xca12488c7593cbd4U,
+    (uint64_t)0xed266c5d02b82fabU, (uint64_t)0xa2f78ad14eb3f16U, (uint64_t)0xc34049484d47afe3U,
+    (uint64_t)0xa6f3d574c005979dU, (uint64_t)0xc2072b426a40e350U, (uint64_t)0xfca5c1568de2ecf9U,
+    (uint64_t)0xa8c8bf5ba515344eU, (uint64_t)0x97aee555114df14aU, (uint64_t)0xd4374a4dfdc5ec6bU,
+    (uint64_t)0x754cc28f2ca85418U, (uint64_t)0x71cb9e27d3c41f78U, (uint64_t)0x9c1670209470496U,
+    (uint64_t)0xa489a5edebd23815U, (uint64_t)0xc4dde4648edd4398U, (uint64_t)0x3ca7b94a80111696U,
+    (uint64_t)0x3c385d682ad636a4U, (uint64_t)0x6702702508dc5f1eU, (uint64_t)0xc1965deafa21943U,
+    (uint64_t)0x18666e16610be69eU, (uint64_t)0x6792fd350369c8e1U, (uint64_t)0x9271aa62b9dc843bU,
+    (uint64_t)0x8711a4b14d02e2abU, (uint64_t)0x2b2a3e27ee1a383U, (uint64_t)0xb226e35f0e2b379bU,
+    (uint64_t)0x3d3de39cd652ab25U, (uint64_t)0xaca6d4c93b560106U, (uint64_t)0xeced0cf4c95bd877U,
+    (uint64_t)0x45beb4ca2a604b3bU, (uint64_t)0x56f651843a616762U, (uint64_t)0xf52f5a70978b806eU,
+    (uint64_t)0x7aa3978711dc4480U, (uint64_t)0xe13fac2a0e01fabcU, (uint64_t)0x7c6ee8a5237d99f9U,
+    (uint64_t)0x251384ee05211ffeU, (uint64_t)0x4ff6976d1bc9d3ebU, (uint64_t)0x8910507903605c39U,
+    (uint64_t)0xf0843d9ea142c96cU, (uint64_t)0xf374493416923684U, (uint64_t)0x732caa2ffa0a2893U,
+    (uint64_t)0xb2e8c27061160170U, (uint64_t)0xc32788cc437fbaa3U, (uint64_t)0x39cd818ea6eda3acU,
+    (uint64_t)0xe2e942399e2b2e07U, (uint64_t)0xdde0492316e043a2U, (uint64_t)0x98a452611dd3d209U,
+    (uint64_t)0xeaf9f61bd431ebe8U, (uint64_t)0x919f4dbaf56abdU, (uint64_t)0xe42417db6d8774b1U,
+    (uint64_t)0x5fc5279c58e0e309U, (uint64_t)0x64aa40613adf81eaU, (uint64_t)0xef419edabc627c7fU,
+    (uint64_t)0x3919759239ef620fU, (uint64_t)0x9d47284074fa29c4U, (uint64_t)0x4e428fa39d416d83U,
+    (uint64_t)0xd1a7c25129f30269U, (uint64_t)0x46076e1cd746218fU, (uint64_t)0xf3ad6ee8110d967eU,
+    (uint64_t)0xfbb5f434a00ae61fU, (uint64_t)0x3cd2c01980d4c929U, (uint64_t)0xfa24d0537a4af00fU,
+    (uint64_t)0x3f938926ca294614U, (uint64_t)0xd700c183982182eU, (uint64_t)0x801334434cc59947U,
+    (uint64_t)0xf0397106ec87c925U, (uint64_t)0x62bd59fc0ed6665cU, (uint64_t)0xe8414348c7cca8b5U,
+    (uint64_t)0x574c76209f9f0a30U, (uint64_t)0x6967d39b0260e52aU, (uint64_t)0xd42585cc90653325U,
+    (uint64_t)0xd9bd60521ca7954U, (uint64_t)0x4fa2087781ed57b3U, (uint64_t)0x60c1eff8e34a0bbeU,
+    (uint64_t)0x56b0040c84f6ef64U, (uint64_t)0x28be2b24b1af8483U, (uint64_t)0xb2278163f5531614U,
+    (uint64_t)0x95be42e2bb8b6a07U, (uint64_t)0x64be74eeca23f86aU, (uint64_t)0xa73d74fd154ce470U,
+    (uint64_t)0x1c2d2857d8dc076aU, (uint64_t)0xb1fa1c575a887868U, (uint64_t)0x38df8e0b3de64818U,
+    (uint64_t)0xd88e52f9c34e8967U, (uint64_t)0x274b4f018b4cc76cU, (uint64_t)0x59c81ec2c11c208bU,
+    (uint64_t)0x240207da4e3a7234U, (uint64_t)0x4957eb80f4a089d8U, (uint64_t)0xc86960bc2137a072U,
+    (uint64_t)0xde1154fd7f1a932cU, (uint64_t)0xb517fe74d3f2fa17U, (uint64_t)0x2d5d94557111c0ebU,
+    (uint64_t)0x2aa3378980929d36U, (uint64_t)0x3f5c05b4f8b7559dU, (uint64_t)0xbe4c7acfae29200U,
+    (uint64_t)0xdd6d3ef756532accU, (uint64_t)0xf6c3ed87eea7a285U, (uint64_t)0xe463b0a8f46ec59bU,
+    (uint64_t)0x531d9b14ecea6c83U, (uint64_t)0x3d6bdbafc2dc836bU, (uint64_t)0x3ee501e92ab27f0bU,
+    (uint64_t)0xcc7a64880a750c0fU, (uint64_t)0x39bacfe34e548e83U, (uint64_t)0x3d418c760c110f05U,
+    (uint64_t)0x3e4daa4cb1f11588U, (uint64_t)0x2733e7b55ffc69ffU, (uint64_t)0x46f147bc92053127U,
+    (uint64_t)0x885b2434d722df94U, (uint64_t)0x6a444f65e6fc6b7cU, (uint64_t)0x7a1a465ac3f16ea8U,
+    (uint64_t)0x115a461db2f1d11cU, (uint64_t)0x4767dd956c68a172U, (uint64_t)0x3392f2ebd13a4698U,
+    (uint64_t)0xc7a99ccde526cdc7U, (uint64_t)0x8e537fdc22292b81U, (uint64_t)0x76d8cf69a6d39198U,
+    (uint64_t)0xffc5ff432446852dU, (uint64_t)0x6d0b16f4bdaedfbdU, (uint64_t)0x23fd326086746cedU,
+    (uint64_t)0x8bfb1d2fff4b3e17U, (uint64_t)0xc7f2ec2d019c14c8U, (uint64_t)0x3e0832f245104b0dU,
+    (uint64_t)0x5f00dafbadea2b7eU, (uint64_t)0x29e5cf6699fbfb0fU, (uint64_t)0x264f972361827cdaU,
+    (uint64_t)0x97b14f7ea90567e6U, (uint64_t)0x513257b7b6ae5cb7U, (uint64_t)0x85454a3c9f10903dU,
+    (uint64_t)0xd8d2c9ad69bc3724U, (uint64_t)0x38da93246b29cb44U, (uint64_t)0xb540a21d77c8cbacU,
+    (uint64_t)0x9bbfe43501918e42U, (uint64_t)0xfffa707a56c3614eU, (uint64_t)0x6eb1a2f3e30bc27fU,
+    (uint64_t)0xe5f0c05ab0836511U, (uint64_t)0x4d741bbf4965ab0eU, (uint64_t)0xfeec41ca83464bbdU,
+    (uint64_t)0x1aca705f99d0b09fU, (uint64_t)0xc5d6cc56f42da5faU, (uint64_t)0x49964eddcc52b931U,
+    (uint64_t)0x8ae59615c884d8d8U, (uint64_t)0xce4e3f1d4e353b7U, (uint64_t)0x62d8a14ef46b0a0U,
+    (uint64_t)0x6408d5ab574b73fdU, (uint64_t)0xbc41d1c9d3273ffdU, (uint64_t)0x3538e1e76be77800U,
+    (uint64_t)0x71fe8b37c5655031U, (uint64_t)0x1cd916216b9b331aU, (uint64_t)0xad825d0bbb388f73U,
+    (uint64_t)0xf634b57b39f8868aU, (uint64_t)0xe27f4fd475cc69afU, (uint64_t)0xa47e58cbd0d5496eU,
+    (uint64_t)0x8a26793fd323e07fU, (uint64_t)0xc61a9b72fa30f349U, (uint64_t)0x94c9d9c9b696d134U,
+    (uint64_t)0x792beca85880a6d1U, (uint64_t)0xbdcc4645af039995U, (uint64_t)0x56c2e05b1cb76219U,
+    (uint64_t)0xec0bf9171567e7eU, (uint64_t)0xe7076f8661c4c910U, (uint64_t)0xd67b085bbabc04d9U,
+    (uint64_t)0x9fb904595e93a96aU, (uint64_t)0x7526c1eafbdc249aU, (uint64_t)0xd44d367ecdd0bb7U,
+    (uint64_t)0x953999179dc0d695U, (uint64_t)0xce7ef8e58c796c3cU, (uint64_t)0x9adaae84dd66e57aU,
+    (uint64_t)0x784ae13e45227f33U, (uint64_t)0xb046c5b82a85e757U, (uint64_t)0xb7aa50aeec37631fU,
+    (uint64_t)0xbedc4fca3b300758U, (uint64_t)0xf82567e0ac9700bU, (uint64_t)0x1071d9d44ff5f8d2U,
+    (uint64_t)0x61360ee99e240d18U, (uint64_t)0x57cdcacb4b94466U, (uint64_t)0xe7667cd12fe5325cU,
+    (uint64_t)0x1fa297b521974e3bU, (uint64_t)0xfa4081e7db083d76U, (uint64_t)0x31993be6f206bd15U,
+    (uint64_t)0x8949269b14c19f8cU, (uint64_t)0x21468d72a9d92357U, (uint64_t)0xd09ef6c4e51a2811U,
+    (uint64_t)0x39f6862bb8fb66b9U, (uint64_t)0x64e77f8d22dfaa99U, (uint64_t)0x7b10504461b08aacU,
+    (uint64_t)0x71704e4c4a7df332U, (uint64_t)0xd09734342ffe015bU, (uint64_t)0xab0eaf4408d3020eU,
+    (uint64_t)0x28b1909eed63b97aU, (uint64_t)0x2ccbc583a4c506ecU, (uint64_t)0x957ed188d1acfe97U,
+    (uint64_t)0x8baed83312f1aea2U, (uint64_t)0xef2a6cb48325362dU, (uint64_t)0x130dde428e195c43U,
+    (uint64_t)0xc842025a0e6050c6U, (uint64_t)0x2da972a708686a5dU, (uint64_t)0xb52999a1e508b4a8U,
+    (uint64_t)0x2f3fa882cdadcd4fU, (uint64_t)0xa4ef68595f631995U, (uint64_t)0xe52ca2f9e531766fU,
+    (uint64_t)0x20af5c3057e2c1d3U, (uint64_t)0x1e4828f6e51e94b8U, (uint64_t)0xf900a1751a2f5d4fU,
+    (uint64_t)0xe831adb3392c58a0U, (uint64_t)0x4c5a90ca1b6e5866U, (uint64_t)0xd9f090b910a5a8bdU,
+    (uint64_t)0xca91d249096864daU, (uint64_t)0x8e6a93be3f67dbc1U, (uint64_t)0xacae6fbaf5f4764cU,
+    (uint64_t)0x1563c6e0d21411a0U, (uint64_t)0x28fa787fda0a4ad8U, (uint64_t)0xd524491c908c8030U,
+    (uint64_t)0x1257ba0e4c795f07U, (uint64_t)0x5f3dcba86182827cU, (uint64_t)0xd1a448ddbd7e7252U,
+    (uint64_t)0x2d8f96fcf493b815U, (uint64_t)0xba0a4c263b0aa95fU, (uint64_t)0x88a1514063a0007fU,
+    (uint64_t)0x9564c25e6a9c5846U, (uint64_t)0x5a4d7b0fdc0fcbcaU, (uint64_t)0x2275daa33f8a740eU,
+    (uint64_t)0xc7913e91991724f3U, (uint64_t)0x5eda799c39cbd686U, (uint64_t)0xddb595c763d4fc1eU,
+    (uint64_t)0x6b63b80bac4fed54U, (uint64_t)0x6ea0fc697e5fb516U, (uint64_t)0x737708bad0f1c964U,
+    (uint64_t)0x9628745f11a92ca5U, (uint64_t)0x61f379589a86967aU, (uint64_t)0x9af39b2caa665072U,
+    (uint64_t)0x78322fa4efd324efU, (uint64_t)0x3d153394c327bd31U, (uint64_t)0x81d5f2713129dab0U,
+    (uint64_t)0xc72e0c42f48027f5U, (uint64_t)0xaa40cdbc8536e717U, (uint64_t)0xf45a657a2d369d0fU,
+    (uint64_t)0xb03bbfc4ea7f74e6U, (uint64_t)0x46a8c4180d738dedU, (uint64_t)0x6f1a5bb0e0de5729U,
+    (uint64_t)0xf10230b98ba81675U, (uint64_t)0x32c6f30c112b33d4U, (uint64_t)0x7559129dd8fffb62U,
+    (uint64_t)0x6a281b47b459bf05U, (uint64_t)0x77c1bd3afa3b6776U, (uint64_t)0x709b3807829973aU,
+    (uint64_t)0x8c26b232a3326505U, (uint64_t)0x38d69272ee1d41bfU, (uint64_t)0x459453effe32afaU,
+    (uint64_t)0xce8143ad7cb3ea87U, (uint64_t)0x932ec1fa7e6ab666U, (uint64_t)0x6cd2d23022286264U,
+    (uint64_t)0x459a46fe6736f8edU, (uint64_t)0x50bf0d009eca85bbU, (uint64_t)0xb825852877a21ecU,
+    (uint64_t)0x300414a70f537a94U, (uint64_t)0x3f1cba4021a9a6a2U, (uint64_t)0x50824eee76943c00U,
+    (uint64_t)0xa0dbfcecf83cba5dU, (uint64_t)0xf953814893b4f3c0U, (uint64_t)0x6174416248f24dd7U,
+    (uint64_t)0x5322d64de4fb09ddU, (uint64_t)0x574473843d9325f3U, (uint64_t)0xa9bef2d0f371cb84U,
+    (uint64_t)0x77d2188ba61e36c5U, (uint64_t)0xbbd6a7d7c602df72U, (uint64_t)0xba3aa9028f61bc0bU,
+    (uint64_t)0xf49085ed6ed0b6a1U, (uint64_t)0x8bc625d6ae6e8298U, (uint64_t)0x832b0b1da2e9c01dU,
+    (uint64_t)0xa337c447f1f0ced1U, (uint64_t)0x800cc7939492dd2bU, (uint64_t)0x4b93151dbea08efaU,
+    (uint64_t)0x820cf3f8de0a741eU, (uint64_t)0xff1982dc1c0f7d13U, (uint64_t)0xef92196084dde6caU,
+    (uint64_t)0x1ad7d97245f96ee3U, (uint64_t)0x319c8dbe29dea0c7U, (uint64_t)0xd3ea38717b82b99bU,
+    (uint64_t)0x75922d4d470eb624U, (uint64_t)0x8f66ec543b95d466U, (uint64_t)0x66e673ccbee1e346U,
+    (uint64_t)0x6afe67c4b5f2b89aU, (uint64_t)0x3de9c1e6290e5cd3U, (uint64_t)0x8c278bb6310a2adaU,
+    (uint64_t)0x420fa3840bdb323bU, (uint64_t)0xae1d63b0eb919b0U, (uint64_t)0xd74ee51da74b9620U,
+    (uint64_t)0x395458d0a674290cU, (uint64_t)0x324c930f4620a510U, (uint64_t)0x2d1f4d19fbac27d4U,
+    (uint64_t)0x4086e8ca9bedeeacU, (uint64_t)0xcdd211b9b679ab8U, (uint64_t)0x5970167d7090fec4U,
+    (uint64_t)0x3420f2c9faf1fc63U, (uint64_t)0x616d333a328c8bb4U, (uint64_t)0x7d65364c57f1fe4aU,
+    (uint64_t)0x9343e87755e5c73aU, (uint64_t)0x5795176be970e78cU, (uint64_t)0xa36ccebf60533627U,
+    (uint64_t)0xfc7c738009cdfc1bU, (uint64_t)0xb39a2afeb3fec326U, (uint64_t)0xb7ff1ba16224408aU,
+    (uint64_t)0xcc856e92247cfc5eU, (uint64_t)0x1f102e7c18bc493U, (uint64_t)0x4613ab742091c727U,
+    (uint64_t)0xaa25e89cc420bf2bU, (uint64_t)0xa5317690337ec2U, (uint64_t)0xd2be9f437d025fc7U,
+    (uint64_t)0x3316fb856e6fe3dcU, (uint64_t)0x27520af59ac50814U, (uint64_t)0xfdf95e789a8e4223U,
+    (uint64_t)0xb7e7df2a56bec5a0U, (uint64_t)0xf7022f7ddf159e5dU, (uint64_t)0x93eeeab1cac1fe8fU,
+    (uint64_t)0x8040188c37451168U, (uint64_t)0x7ee8aa8ad967dce6U, (uint64_t)0xfa0e79e73abc9299U,
+    (uint64_t)0x67332cfc2064cfd1U, (uint64_t)0x339c31deb0651934U, (uint64_t)0x719b28d52a3bcbeaU,
+    (uint64_t)0xee74c82b9d6ae5c6U, (uint64_t)0x927d05ebaf28ee6U, (uint64_t)0x82cecf2c9d719028U,
+    (uint64_t)0xb0d353eddb30289U, (uint64_t)0xfe4bb977fddb2e29U, (uint64_t)0xbb5bb990640bfd9eU,
+    (uint64_t)0xd226e27782f62108U, (uint64_t)0x4bf0098502ffdd56U, (uint64_t)0x7756758a2ca1b1b5U,
+    (uint64_t)0xc32b62a35285fe91U, (uint64_t)0xedbc546a8c9cd140U, (uint64_t)0x1e47a013af5cb008U,
+    (uint64_t)0xbca7e720073ce8f2U, (uint64_t)0xe10b2ab817a91caeU, (uint64_t)0xb89aab6508e27f63U,
+    (uint64_t)0x7b3074a7dba3ddf9U, (uint64_t)0x1c20ce09330c2972U, (uint64_t)0x6b9917b45fcf7e33U,
+    (uint64_t)0xe6793743945ceb42U, (uint64_t)0x18fc22155c633d19U, (uint64_t)0xad1adb3cc7485474U,
+    (uint64_t)0x4f922fc516a0d2bbU, (uint64_t)0xd5cc16c1a623499U, (uint64_t)0x9241cf3a57c62c8bU,
+    (uint64_t)0x2f5e6961fd1b667fU, (uint64_t)0x5c15c70bf5a01797U, (uint64_t)0x3d20b44d60956192U,
+    (uint64_t)0x4911b37071fdb52U, (uint64_t)0xf648f9168d6f0f7bU, (uint64_t)0x27cc8b8fac61d9aU,
+    (uint64_t)0x7d25e062e3c6fe8aU, (uint64_t)0xe08805bfe5bff503U, (uint64_t)0x13271e6c6ff632f7U,
+    (uint64_t)0x55dca6c0232f76a5U, (uint64_t)0x8957c32d701ef426U, (uint64_t)0xee728bcba10a5178U,
+    (uint64_t)0x5ea60411b62c5173U, (uint64_t)0x4090914bb5def996U, (uint64_t)0x1cb69c83233dd1e7U,
+    (uint64_t)0xc1e9c1d39b3d5e76U, (uint64_t)0x1f3338edfccf6012U, (uint64_t)0xb1e95d0d2f5378a8U,
+    (uint64_t)0xacf4c2c72f00cd21U, (uint64_t)0x6e984240eb5fe290U, (uint64_t)0xd66c038d248088aeU,
+    (uint64_t)0x9ad5462bb4d8bc50U, (uint64_t)0x181c0b16a9195770U, (uint64_t)0xebd4fe1c78412a68U,
+    (uint64_t)0xae0341bcc0dff48cU, (uint64_t)0xb6bc45cf7003e866U, (uint64_t)0xf11a6dea8a24a41bU,
+    (uint64_t)0x5407151ad04c24c2U, (uint64_t)0x62c9d27dda5b7b68U, (uint64_t)0xd4992b30614c0900U,
+    (uint64_t)0xda98d121bd00c24bU, (uint64_t)0x7f534dc87ec4bfa1U, (uint64_t)0x4a5ff67437dc34bcU,
+    (uint64_t)0x68c196b81d7ea1d7U, (uint64_t)0x38cf289380a6d208U, (uint64_t)0xfd56cd09e3cbbd6eU,
+    (uint64_t)0xec72e27e4205a5b6U, (uint64_t)0x32865719a8afd30bU, (uint64_t)0x867983288a826dceU,
+    (uint64_t)0xdf04e891c4a8fbe0U, (uint64_t)0xbb6b6e1bebf56ad3U, (uint64_t)0xa695b11471f1ff0U,
+    (uint64_t)0xd76c3389be15baf0U, (uint64_t)0x18edb95be96c43eU, (uint64_t)0xf2beaaf490794158U,
+    (uint64_t)0xe8b97932b88756ddU, (uint64_t)0xed4e8652f17e3e61U, (uint64_t)0xc2dd14993ee1c4a4U,
+    (uint64_t)0xc0aaee17597f8c0eU, (uint64_t)0x15c4edb96c168af3U, (uint64_t)0x6563c7bfb39ae875U,
+    (uint64_t)0xadfadb6f20adb436U, (uint64_t)0xad55e8c99a042ac0U, (uint64_t)0xa50b12e523b8bf6U,
+    (uint64_t)0x8009eb5b8f910c1bU, (uint64_t)0xf535af824a167588U, (uint64_t)0xf835f9cfb2a2abdU,
+    (uint64_t)0xf59b29312afceb62U, (uint64_t)0xc797df2a169d383fU, (uint64_t)0xeb3f5fb066ac02b0U,
+    (uint64_t)0x29d4c6fdaa2d0caU, (uint64_t)0x65c29219909523c8U, (uint64_t)0xa62f648fa3a1c741U,
+    (uint64_t)0x88598d4f60c9e55aU, (uint64_t)0xbce9141b0e4f347aU, (uint64_t)0x9af97d8435f9b988U,
+    (uint64_t)0x210da62320475b6U, (uint64_t)0x3c076e229191476cU, (uint64_t)0x7520dbd944fc7834U,
+    (uint64_t)0x87a7ebd1e0a1b12aU, (uint64_t)0x1e4ef88d770ba95fU, (uint64_t)0x8c33345cdc2ae9cbU,
+    (uint64_t)0xcecf127601cc8403U, (uint64_t)0x687c012e1b39b80fU, (uint64_t)0xfd90d0ad35c33ba4U,
+    (uint64_t)0xa3ef5a675c9661c2U, (uint64_t)0x368fc88ee017429eU, (uint64_t)0x664300b07850ec06U,
+    (uint64_t)0xac5a38b97d3a10cfU, (uint64_t)0x9233188de34ab39dU, (uint64_t)0xe77057e45072cbb9U,
+    (uint64_t)0xbcf0c042b59e78dfU, (uint64_t)0x4cfc91e81d97de52U, (uint64_t)0x4661a26c3ee0ca4aU,
+    (uint64_t)0x5620a4c1fb8507bcU, (uint64_t)0xb82226052b7ce542U, (uint64_t)0xe6d4ce997472bde1U,
+    (uint64_t)0x53e16ebe09d2f4daU, (uint64_t)0x180ff42e53b92b2eU, (uint64_t)0xc59bcc022c34a1c6U,
+    (uint64_t)0x3803d6f9422c46c2U, (uint64_t)0x18aff74f5c14a8a2U, (uint64_t)0x55aebf8010a08b28U,
+    (uint64_t)0x84b9ca1504b6c5a0U, (uint64_t)0x35216f3918f0e3a3U, (uint64_t)0x3ec2d2bcbd986c00U,
+    (uint64_t)0x8bf546d9d19228feU, (uint64_t)0xd1c655a44cd623c3U, (uint64_t)0x366ce718502b8e5aU,
+    (uint64_t)0x2cfc84b4eea0bfe7U, (uint64_t)0xe01d5ceecf443e8eU, (uint64_t)0xb956970e2fdd23ccU,
+    (uint64_t)0xb80288bc5682e971U, (uint64_t)0xe6e6d91e9ae86ebcU, (uint64_t)0x564c83f8c9f1939U,
+    (uint64_t)0x551932a239560368U, (uint64_t)0xe893752b049c28e2U, (uint64_t)0xb03cee5a6a158c3U,
+    (uint64_t)0xe12d656b04964263U, (uint64_t)0xa75feacabe063f64U, (uint64_t)0x9b392f43bce47a09U,
+    (uint64_t)0xd42415091ad07acaU, (uint64_t)0x4b0c591b8d26cd0fU, (uint64_t)0x2d42ddfd92f1169aU,
+    (uint64_t)0x63aeb1ac4cbf2392U, (uint64_t)0x1de9e8770691a2afU, (uint64_t)0xebe79af7d98021daU,
+    (uint64_t)0xdb2fb5ed005832aU, (uint64_t)0x5f5efd3b91042e4fU, (uint64_t)0x8c4ffdc6ed70f8caU,
+    (uint64_t)0xe4645d0bb52da9ccU, (uint64_t)0x9596f58bc9001d1fU, (uint64_t)0x52c8f0bc4e117205U,
+    (uint64_t)0xfd4aa0d2e398a084U, (uint64_t)0x815bfe3a104f49deU, (uint64_t)0x54eb3acce548b37bU,
+    (uint64_t)0xb38e754284d40549U, (uint64_t)0x8c3daa517b341b4fU, (uint64_t)0x2f6928ec690bf7faU,
+    (uint64_t)0x496b32386ce6c41U, (uint64_t)0x1be1c5510adadcdU, (uint64_t)0xc04e67e74bb5faf9U,
+    (uint64_t)0x3cbaf678e15c9985U, (uint64_t)0x524d226ad7ab9a2dU, (uint64_t)0x9c00090d7dfae958U,
+    (uint64_t)0xba5f5398751d8c2U, (uint64_t)0x8afcbcdd3ab8262dU, (uint64_t)0x57392729e99d043bU,
+    (uint64_t)0xef51263baebc943aU, (uint64_t)0x9feace9320862935U, (uint64_t)0x639efc03b06c817bU,
+    (uint64_t)0xe839be7d341d81dcU, (uint64_t)0xcddb688932148379U, (uint64_t)0xda6211a1f7026eadU,
+    (uint64_t)0xf3b2575ff4d1cc5eU, (uint64_t)0x40cfc8f6a7a73ae6U, (uint64_t)0x83879a5e61d5b483U,
+    (uint64_t)0xc5acb1ed41a50ebcU, (uint64_t)0x59a60cc83c07d8faU, (uint64_t)0xdec98d4ac3b81990U,
+    (uint64_t)0x1cb837229e0cc8feU, (uint64_t)0xfe0b0491d2b427b9U, (uint64_t)0xf2386ace983a66cU,
+    (uint64_t)0x930c4d1eb3291213U, (uint64_t)0xa2f82b2e59a62ae4U, (uint64_t)0x77233853f93e89e3U,
+    (uint64_t)0x7f8063ac11777c7fU, (uint64_t)0x604ac97c59371000U, (uint64_t)0xe1c48c707f759c18U,
+    (uint64_t)0x3f62ecc5a5db6b65U, (uint64_t)0xa78b17338a21495U, (uint64_t)0x6be1819dbcc8ad94U,
+    (uint64_t)0x70dc04f6d89c3400U, (uint64_t)0x462557b4a6b4840aU, (uint64_t)0x544c6ade60bd21c0U,
+    (uint64_t)0x36e607cf02ff6072U, (uint64_t)0xa47d2ca98ad98cdcU, (uint64_t)0xbf471d1ef5f56609U,
+    (uint64_t)0xbcf86623f264ada0U, (uint64_t)0xb70c0687aa9e5cb6U, (uint64_t)0xc98124f217401c6cU,
+    (uint64_t)0x8189635fd4a61435U, (uint64_t)0xd28fb8afa9d98ea6U, (uint64_t)0x439530b665c7322dU,
+    (uint64_t)0xcf12cc01b3c1b3fbU, (uint64_t)0xc70b01860172f685U, (uint64_t)0xb915ee221b58391dU,
+    (uint64_t)0x9afdf03ba317db24U, (uint64_t)0x87dec65917b8ffc4U, (uint64_t)0x7f46597be4d3d050U,
+    (uint64_t)0x80a1c1ed006500e7U, (uint64_t)0x3d4da8c3017025f3U, (uint64_t)0xefcf628cfb9579b4U,
+    (uint64_t)0x5c4d00161f3716ecU, (uint64_t)0x9c27ebc46801116eU, (uint64_t)0x5eba0ea11da1767eU,
+    (uint64_t)0xfe15145247004c57U, (uint64_t)0x3ace6df68c2373b7U, (uint64_t)0x75c3dffe5dbc37acU,
+    (uint64_t)0xa2a147dba28a0749U, (uint64_t)0x246c20d6ee519165U, (uint64_t)0x5068d1b1d3810715U,
+    (uint64_t)0xb1e7018c748160b9U, (uint64_t)0x3f5b1faf380ff62U, (uint64_t)0xef7fb1ddf3cb2c1eU,
+    (uint64_t)0xeab539a8fc91a7daU, (uint64_t)0x83ddb707f3f9b561U, (uint64_t)0xb57276d980101b98U,
+    (uint64_t)0x760883fdb82f0f66U, (uint64_t)0x89d7de754bc3eff3U, (uint64_t)0x3b606435dc2ab40U,
+    (uint64_t)0xcd6e53dfe05beeacU, (uint64_t)0xf2f1e862bc3325cdU, (uint64_t)0xdd0f7921774f03c3U,
+    (uint64_t)0x97ca72214552cc1bU, (uint64_t)0xe79a4af09cec46eaU, (uint64_t)0xb15347a1658b9bc7U,
+    (uint64_t)0x6bd2796f35af2f75U, (uint64_t)0xac9579904051c435U, (uint64_t)0x2669dda3c33a655dU,
+    (uint64_t)0x5d503c2e88514aa3U, (uint64_t)0xdfa113373753dd41U, (uint64_t)0x3f0546730b754f78U,
+    (uint64_t)0x760cb3b5e224c5d7U, (uint64_t)0xfa3baf8c68616919U, (uint64_t)0x9fbca1138d142552U,
+    (uint64_t)0x1ab18bf17669ebf5U, (uint64_t)0x55e6f53e9bdf25ddU, (uint64_t)0x4cc0bf3cb6cd154U,
+    (uint64_t)0x595bef4995e89080U, (uint64_t)0xfe9459a8104a9ac1U, (uint64_t)0x49d66316a8123ef0U,
+    (uint64_t)0x73c32db4e7f95438U, (uint64_t)0x2e2ed2090d9e7854U, (uint64_t)0xf98a93299d9f0507U,
+    (uint64_t)0xc5d33cf60c6aa20aU, (uint64_t)0x9a32ba1475279bb2U, (uint64_t)0x7e3202cb774a7307U,
+    (uint64_t)0x64ed4bc4e8c42dbdU, (uint64_t)0x694b64c5abb020e8U, (uint64_t)0x3d18c18419c4eec7U,
+    (uint64_t)0x9c4673ef1c4793e5U, (uint64_t)0xc7b8aeb5056092e6U, (uint64_t)0x3aa1ca43f0f8c16bU,
+    (uint64_t)0x224ed5ecd679b2f6U, (uint64_t)0xd56eeaf55a205c9U, (uint64_t)0xbfe115ba4b8e028bU,
+    (uint64_t)0xe4050f1cf1c367caU, (uint64_t)0x9bc85a9bc90fbc7dU, (uint64_t)0xa373c4a2e1a11032U,
+    (uint64_t)0xb64232b7ad0393a9U, (uint64_t)0xf5577eb0167dad29U, (uint64_t)0x1604f30194b78ab2U,
+    (uint64_t)0xbaa94afe829348bU, (uint64_t)0x77fbd8dd41654342U, (uint64_t)0x31f14802fcf0a7fdU,
+    (uint64_t)0x42fd07895488b01eU, (uint64_t)0x71d78d6d9952b498U, (uint64_t)0x8eb572d907ac5201U,
+    (uint64_t)0xe0a2a44c4d194a88U, (uint64_t)0xd2b63fd9ba017e66U, (uint64_t)0x78efc6c8f888aefcU,
+    (uint64_t)0xb76f6bda4a881a11U, (uint64_t)0xa2f7932c68af43eeU, (uint64_t)0x5502468e703d00bdU,
+    (uint64_t)0xe5dc978f2fb061f5U, (uint64_t)0xc9a1904a28c815adU, (uint64_t)0xd3af538d470c56a4U,
+    (uint64_t)0x159abc5f193d8cedU, (uint64_t)0x2a37245f20108ef3U, (uint64_t)0xfa17081e223f7178U,
+    (uint64_t)0x1fe2a9b2b4b4b67cU, (uint64_t)0xc1d10df0e8020604U, (uint64_t)0x9d64abfcbc8058d8U,
+    (uint64_t)0x8943b9b2712a0fbbU, (uint64_t)0x90eed9143b3def04U, (uint64_t)0x85ab3aa24ce775ffU,
+    (uint64_t)0x605fd4ca7bbc9040U, (uint64_t)0x8b34a564e2c75dfbU, (uint64_t)0x5c18acf88e2f7d90U,
+    (uint64_t)0xfdbf33d777be32cdU, (uint64_t)0xa085cd7d2eb5ee9U, (uint64_t)0x2d702cfbb3201115U,
+    (uint64_t)0xb6e0ebdb85c88ce8U, (uint64_t)0x23a3ce3c1e01d617U, (uint64_t)0x3041618e567333acU,
+    (uint64_t)0x9dd0fd8f157edb6bU, (uint64_t)0xb2b2610798fa7aaaU, (uint64_t)0x41209ee4f073aa4eU,
+    (uint64_t)0xf1570359f2d6b19bU, (uint64_t)0xcbe6868cfc577cafU, (uint64_t)0x186c4bdc32c04dd3U,
+    (uint64_t)0xa6c35faecfeee397U, (uint64_t)0xb4a1b312f086c0cfU, (uint64_t)0xe0a5ccc6d9461fe2U,
+    (uint64_t)0x516ff3a36fa6110cU, (uint64_t)0x74fb1eb1fb93561fU, (uint64_t)0x6c0c90478457522bU,
+    (uint64_t)0xcfd321046bb8bdc6U, (uint64_t)0x2d6884a2cc80ad57U, (uint64_t)0x7c27fc3586a9b637U,
+    (uint64_t)0x3461baedadf4e8cdU, (uint64_t)0x1d56251a617242f0U, (uint64_t)0xb84011a9431dd80eU,
+    (uint64_t)0xeb7c7cca73306cd9U, (uint64_t)0x20fadd29d1b3b730U, (uint64_t)0x83858b5bfe37b3d3U,
+    (uint64_t)0xbf4cd193b6251d5cU, (uint64_t)0x1cca1fd31352d952U, (uint64_t)0xc66157a490fbc051U,
+    (uint64_t)0x7990a63889b98636U, (uint64_t)0x892c81a321175ec1U, (uint64_t)0x9159a505ee018109U,
+    (uint64_t)0xc70130532d8be316U, (uint64_t)0x76060c21426fa2e5U, (uint64_t)0x74d2dfc6b6f0f22U,
+    (uint64_t)0x9725fc64ca01a671U, (uint64_t)0x3f6679b92770bd8eU, (uint64_t)0x8fe6604fd7c9b3feU,
+    (uint64_t)0xce711154b6e00a84U, (uint64_t)0xd9fe7e4224890e60U, (uint64_t)0xd10bc6c34560988fU,
+    (uint64_t)0xbdc2ef526859b004U, (uint64_t)0xdcf0d868d5c890eeU, (uint64_t)0x893115e6119c47dcU,
+    (uint64_t)0xe97966fbee714567U, (uint64_t)0x117813355c85aa53U, (uint64_t)0x71d530cc73204349U,
+    (uint64_t)0xc9df473d94a0679cU, (uint64_t)0xc572f0014261e031U, (uint64_t)0x9786b71f22f135feU,
+    (uint64_t)0xed6505fa6b64e56fU, (uint64_t)0xe2fb48e905219c46U, (uint64_t)0xdbec45bedf53d71U,
+    (uint64_t)0xd7d782f2c589f406U, (uint64_t)0x350fb66b73ed0966U, (uint64_t)0x968e4b082886032bU,
+    (uint64_t)0x5a16ed6e88390493U, (uint64_t)0xa83ce84a121edbeU, (uint64_t)0x7c86fc10a3d9cda0U,
+    (uint64_t)0x5a40a6d595ce67fbU, (uint64_t)0x6cb8cda7f937dbf6U, (uint64_t)0x95b44768651f6283U,
+    (uint64_t)0x6513c8a446cd7f4U, (uint64_t)0x158c423b906d52a6U, (uint64_t)0x71503261c423866cU,
+    (uint64_t)0x4b96f57093c148eeU, (uint64_t)0x5daf9cc7239a8523U, (uint64_t)0x611b597695ac4b8bU,
+    (uint64_t)0xde3981db724bf7f6U, (uint64_t)0x7e7d0f7867afc443U, (uint64_t)0x984f101ed6fc3837U,
+    (uint64_t)0x340bf99f5e1b3a09U, (uint64_t)0xbb96036f06942626U, (uint64_t)0x7bc878ab0c7da618U,
+    (uint64_t)0xb37416441c6fb035U, (uint64_t)0xc65bd5aea182fe9fU, (uint64_t)0x1b9c2fb86cc7a67aU,
+    (uint64_t)0x8d1b19af5ce68d7dU, (uint64_t)0x3d1ab80c8ce59954U, (uint64_t)0x742c5a9478222ac0U,
+    (uint64_t)0x3ddacbf894f878ddU, (uint64_t)0xfc085117e7d54a99U, (uint64_t)0xfb0f1dfa21e38ec2U,
+    (uint64_t)0x1c7b59cb16f4ff7fU, (uint64_t)0x988752397ea888feU, (uint64_t)0x705d270cb10dc889U,
+    (uint64_t)0xa80d1db6f79588c0U, (uint64_t)0xfa52fc69b55768ccU, (uint64_t)0xb4df1ae7f54438aU,
+    (uint64_t)0xcadd1a7f9b46a4fU, (uint64_t)0xb40ea6b31803dd6fU, (uint64_t)0x488e4fa555eaae35U,
+    (uint64_t)0x9f047d55382e4e16U, (uint64_t)0xc9b5b7e02f6e0c98U, (uint64_t)0xc12738b67c4a658aU,
+    (uint64_t)0xb3c4763940e72182U, (uint64_t)0x3b77be468798e44fU, (uint64_t)0xdc047df217a7f85fU,
+    (uint64_t)0x2439d4c55e59d92dU, (uint64_t)0xcedca475e8e64d8dU, (uint64_t)0xa724cd0d87ca9b16U,
+    (uint64_t)0x35e4fd59a5540dfeU, (uint64_t)0x4b7d0e0683a7337bU, (uint64_t)0x1e3416d4ffecf249U,
+    (uint64_t)0x24840eff66a2b71fU, (uint64_t)0xd0d9a50ab37cc26dU, (uint64_t)0xe21981506fe28ef7U,
+    (uint64_t)0x3cc5ef1623324c7fU, (uint64_t)0x220f3455769b5263U, (uint64_t)0xe2ade2f1a10bf475U,
+    (uint64_t)0x9894344f3a29467aU, (uint64_t)0xde81e949c51eba6dU, (uint64_t)0xdaea066ba5e5c2f2U,
+    (uint64_t)0x3fc8a61408c8c7b3U, (uint64_t)0x7adff88f06d0de9fU, (uint64_t)0xbbc11cf53b75ce0aU,
+    (uint64_t)0x9fbb7accfbbc87d5U, (uint64_t)0xa1458e267badfde2U, (uint64_t)0x3b6c8c7dacddb7dU,
+    (uint64_t)0x92ed50047e1edcadU, (uint64_t)0xa0e46c2f54080633U, (uint64_t)0xcd37663d46dec1ceU,
+    (uint64_t)0x396984c5f365b7ccU, (uint64_t)0x294e3a2ae79bb95dU, (uint64_t)0x9aa17d7727b1d3c1U,
+    (uint64_t)0x3ffd3cfae49440f5U, (uint64_t)0x41c93e3abb830d1U, (uint64_t)0x2ad235325c2c5270U,
+    (uint64_t)0xaefd1be2ee4b259dU, (uint64_t)0x3ef267771eadd857U, (uint64_t)0x2af8f7039b0d7d86U,
+    (uint64_t)0x80f5af2d7b7e6f20U, (uint64_t)0xb5fa1d3ccec8e295U, (uint64_t)0xe73f3902f68f09f6U,
+    (uint64_t)0x26679d11399f9cf3U, (uint64_t)0x78e7a48e1e3c4394U, (uint64_t)0x8722dea0d98daf1U,
+    (uint64_t)0x37e7ed5880030ea3U, (uint64_t)0xf3731ad43c8aae72U, (uint64_t)0x7878be95ac729695U,
+    (uint64_t)0x6a643affbbc28352U, (uint64_t)0xef8b801b78759b61U, (uint64_t)0x1cb43668e039c256U,
+    (uint64_t)0x5f26fb8b7c17fd5dU, (uint64_t)0xeee426af79aa062bU, (uint64_t)0x72002d0d78fbf04U,
+    (uint64_t)0x4c9ca237e84fb7e3U, (uint64_t)0xb401d8a10c82133dU, (uint64_t)0xaaa525926d7e4181U,
+    (uint64_t)0xe943083373dbb152U, (uint64_t)0xdcdd3709b63afe75U, (uint64_t)0xad9d7f0b3f1af8ffU,
+    (uint64_t)0xdd6a8045194f4beeU, (uint64_t)0x867724cc2f7d998cU, (uint64_t)0xd51d0aa5837751beU,
+    (uint64_t)0x21d6754a959a0658U, (uint64_t)0xd2212611695f7e58U, (uint64_t)0xec4b93c2297363efU,
+    (uint64_t)0xac1c5fab6ef26cfU, (uint64_t)0xcd8ba0c5a39de8eeU, (uint64_t)0x11ba7537dd7796e0U,
+    (uint64_t)0x1215933476d58d6dU, (uint64_t)0xf51eb76f529fda4cU, (uint64_t)0x2fd9209ddedaa8a3U,
+    (uint64_t)0x555a675615efac65U, (uint64_t)0xb784c9ca7fd42fe9U, (uint64_t)0x8165ec11b9d1a70fU,
+    (uint64_t)0x1347efc384f6caeU, (uint64_t)0xe95c01a0ab7aeca9U, (uint64_t)0x459ba1c5c6c99530U,
+    (uint64_t)0x38967a635cf3416bU, (uint64_t)0x5c3761fd1e5457e2U, (uint64_t)0x43e6077af03e9df6U,
+    (uint64_t)0xb15d34628bd1c7f6U, (uint64_t)0x2f5fad1e6ee7c983U, (uint64_t)0xeb0f9d7cb41328f5U,
+    (uint64_t)0x9ba68b441d78d5f7U, (uint64_t)0xa06b3b9e35bc726fU, (uint64_t)0xa2550255593e1ff1U,
+    (uint64_t)0x552dd43ddfbec115U, (uint64_t)0x2c48a7abbba8f046U, (uint64_t)0xd4fc56a3ad0bf133U,
+    (uint64_t)0xad87d3db35a75c49U, (uint64_t)0xc69d800961af03c5U, (uint64_t)0x31aef61a3a6a6c4cU,
+    (uint64_t)0xb3292640aa10a993U, (uint64_t)0x959aae80aaee340fU, (uint64_t)0xf900528e7f381a3bU,
+    (uint64_t)0x44ecf76e853691a3U, (uint64_t)0xa081663ce749e68eU, (uint64_t)0xa6ba1683461b35ecU,
+    (uint64_t)0x3ac0f7d3b67f8058U, (uint64_t)0x4fb976f308e6ad9eU, (uint64_t)0x6c4095069c7c6f5fU,
+    (uint64_t)0xd8a175e4e9091957U, (uint64_t)0xa1716baea7e4c07aU, (uint64_t)0x3a942fbf59561de8U,
+    (uint64_t)0x9d117777939c9ccbU, (uint64_t)0x4f2782136283e34aU, (uint64_t)0x6f9fcf60fbfa315fU,
+    (uint64_t)0x224a2ab99b701364U, (uint64_t)0xb4b1b418f9fecadcU, (uint64_t)0xbf7280fe50ba1b9aU,
+    (uint64_t)0x7e68259c33f36db9U, (uint64_t)0x8ccb754e154c9fb0U, (uint64_t)0xf281adb1db2328f1U,
+    (uint64_t)0x4fe7ee31b0e63d34U, (uint64_t)0xf4600572a9e54fabU, (uint64_t)0xc0493334d5e7b5a4U,
+    (uint64_t)0x8589fb9206d54831U, (uint64_t)0xaa70f5cc6583553aU, (uint64_t)0x879094ae25649e5U,
+    (uint64_t)0xcc90450710044652U, (uint64_t)0xebb0696d02541c4fU, (uint64_t)0x758c1a3ea2dee7a6U,
+    (uint64_t)0xdcde2f3c734b2284U, (uint64_t)0xaba445d24eaba6adU, (uint64_t)0x35aaf66876cee0a7U,
+    (uint64_t)0x7e0b04a9e5aa049aU, (uint64_t)0xe74083ad91103e84U, (uint64_t)0xbeb183ce40afecc3U,
+    (uint64_t)0x6b89de9fea043f7aU, (uint64_t)0xb99f0e0399375235U, (uint64_t)0x7614c847b9917970U,
+    (uint64_t)0xfec93ce9524ec067U, (uint64_t)0xe40e7bf89b122520U, (uint64_t)0xb5670631ee4c4774U,
+    (uint64_t)0x6f03847a3b04914cU, (uint64_t)0xc96e9429dc9dd226U, (uint64_t)0x43489b6c8c57c1f8U,
+    (uint64_t)0xe299d23fe67ba66U, (uint64_t)0x9145076093cf2f34U, (uint64_t)0xf45b5ea997fcf913U,
+    (uint64_t)0x5be008438bd7dddaU, (uint64_t)0x358c3e05d53ff04dU, (uint64_t)0xbf7ccdc35de91ef7U,
+    (uint64_t)0xad684dbfb69ec1a0U, (uint64_t)0x367e7cf2801fd997U, (uint64_t)0x46ffd227cc2338fbU,
+    (uint64_t)0x89ff6fa990e26153U, (uint64_t)0xbe570779331a0076U, (uint64_t)0x43d241c506e1f3afU,
+    (uint64_t)0xfdcdb97dde9b62a3U, (uint64_t)0x6a06e984a0ae30eaU, (uint64_t)0xc9bf16804fbddf7dU,
+    (uint64_t)0x170471a2d36163c4U, (uint64_t)0xff5ba8ae3113655eU, (uint64_t)0xfa2c6e2b57b83180U,
+    (uint64_t)0x1c48271977e0eabeU, (uint64_t)0xf9f3c555337fea97U, (uint64_t)0x340f7022a42581cbU,
+    (uint64_t)0xe1de0bc218f710e3U, (uint64_t)0xee640adef62e5aa8U, (uint64_t)0x16b2389149428940U,
+    (uint64_t)0x361619e455950cc3U, (uint64_t)0xc71d665c56b66bb8U, (uint64_t)0xea034b34afac6d84U,
+    (uint64_t)0xa987f832e5e4c7e3U, (uint64_t)0xa07427727a79a6a7U, (uint64_t)0x56e5d017e26d6c23U,
+    (uint64_t)0x7e50b97638167e10U, (uint64_t)0xaa6c81efe88aa84eU, (uint64_t)0xca1f3b7b0dc8595U,
+    (uint64_t)0x27de46089f1d9f2eU, (uint64_t)0x1af3bf39badd82a7U, (uint64_t)0x79356a7965862448U,
+    (uint64_t)0xc0602345f5f9a052U, (uint64_t)0x1a8b0f89139a42f9U, (uint64_t)0xb53eee42844d40fcU,
+    (uint64_t)0x93b0bfe54e5b6368U, (uint64_t)0x473959d74d325bbfU, (uint64_t)0x2a61beec8d6114b9U,
+    (uint64_t)0x25672a94924be2eeU, (uint64_t)0xa48595dbf2c23d0cU, (uint64_t)0xe476848b6a221838U,
+    (uint64_t)0xe743e69a35c1b673U, (uint64_t)0x2ab42499d8468503U, (uint64_t)0x62aa0054e9e90ba7U,
+    (uint64_t)0x358d13f1bc482911U, (uint64_t)0x685d1971b7fa7f26U, (uint64_t)0x3e67a51d2be1aee4U,
+    (uint64_t)0xe041850998d114a9U, (uint64_t)0x59639f604e052561U, (uint64_t)0x32075c49155d0818U,
+    (uint64_t)0x2aa2343b67b64b1cU, (uint64_t)0x1b445e2967f53e6aU, (uint64_t)0xbdfb271773a904e0U,
+    (uint64_t)0x7ce1e40b28888d73U, (uint64_t)0x2e7e35f6eaa97d1bU, (uint64_t)0xd061772aa9afa097U,
+    (uint64_t)0x434ac7c47a1f7c59U, (uint64_t)0x6e21124ae79b7b9aU, (uint64_t)0x55acff3bb22ecc7U,
+    (uint64_t)0x8bfd7ac984c858d3U, (uint64_t)0x5434dd02c024789cU, (uint64_t)0x90dca9ea41b57bfcU,
+    (uint64_t)0x8aa898e2243398dfU, (uint64_t)0xf607c834894a94bbU, (uint64_t)0xbb07be97c2c99b76U,
+    (uint64_t)0x6576ba6718c29302U, (uint64_t)0x3d79efcce703a88cU, (uint64_t)0xf259ced7b6a0d106U,
+    (uint64_t)0x2fd57df59f1f68adU, (uint64_t)0x5ddcc6dbb06470c8U, (uint64_t)0x801b6451a9b47307U,
+    (uint64_t)0x6b51c8e376551bf4U, (uint64_t)0xef0bd1f7d44e1da9U, (uint64_t)0x714bcb1d4d4e600cU,
+    (uint64_t)0xc57bb9e40c6540c7U, (uint64_t)0x71bd1ec2327cc644U, (uint64_t)0xcd33b5cfd84f0aU,
+    (uint64_t)0xcfa568f74e6b0dddU, (uint64_t)0x1c694edb2d0f48f4U, (uint64_t)0x2747c7ccfeff7dd8U,
+    (uint64_t)0xcedaecadac8c24b2U, (uint64_t)0xdb29de3f0742a5e5U, (uint64_t)0xe35d8fbb3090296dU,
+    (uint64_t)0x788cabf7b11fb54aU, (uint64_t)0x9a52cf7e7f4dd81fU, (uint64_t)0xa0132be15e69c05eU,
+    (uint64_t)0x90dab7472a0f4d72U, (uint64_t)0xc142f911312d6706U, (uint64_t)0xe8d3631f8261998bU,
+    (uint64_t)0xf0f42fae615c1c94U, (uint64_t)0x2f4e948caec3fa5dU, (uint64_t)0x242ae7a8a374101eU,
+    (uint64_t)0x20d3c982cf7d62d2U, (uint64_t)0x1f36e29d23ba8150U, (uint64_t)0x48ae0bf092763f9eU,
+    (uint64_t)0x7a527e6b1d3a7007U, (uint64_t)0xb4a89097581a85e3U, (uint64_t)0x1f1a520fdc158be5U,
+    (uint64_t)0xf98db37d167d726eU, (uint64_t)0x8802786e1113e862U, (uint64_t)0xefb2149e36f09ab0U,
+    (uint64_t)0x3f163ca4a10bb5bU, (uint64_t)0xd029704506e20998U, (uint64_t)0x56f0af001b5a3babU,
+    (uint64_t)0x7af4cfec70880e0dU, (uint64_t)0x7332a66fbe3d913fU, (uint64_t)0x32e6c84a7eceb4bdU,
+    (uint64_t)0xedc4a79a9c228f55U, (uint64_t)0xf6e894d1f4c6b6ecU, (uint64_t)0x526b082718b3cd9bU,
+    (uint64_t)0x73f952a812117fbfU, (uint64_t)0x2be864b011945bf5U, (uint64_t)0x86f18ea542099b64U,
+    (uint64_t)0x2770b28a07548ce2U, (uint64_t)0x97390f28295c1c9cU, (uint64_t)0x672e6a43cb5206c3U,
+    (uint64_t)0xc37c7dd0c55c4496U, (uint64_t)0xa6a9635725bbabd2U, (uint64_t)0x5b7e63f2add7f363U,
+    (uint64_t)0x9dce37822e73f1dfU, (uint64_t)0xe1e5a16ab2b91f71U, (uint64_t)0xe44898235ba0163cU,
+    (uint64_t)0xf2759c32f6e515adU, (uint64_t)0xa5e2f1f88615eecfU, (uint64_t)0xcacce2c847c64367U,
+    (uint64_t)0x6a496b9f45af4ec0U, (uint64_t)0x2a0836f36034042cU, (uint64_t)0x14a1f3900b6c62eaU,
+    (uint64_t)0xe7fa93633ef1f540U, (uint64_t)0xd323b30a72a76d93U, (uint64_t)0xffeec8b50feae451U,
+    (uint64_t)0x4eafc172bd04ef87U, (uint64_t)0x74519be7abded551U, (uint64_t)0x3d358b8c8b74410U,
+    (uint64_t)0x4d00b10b0e10d9a9U, (uint64_t)0x6392b0b128da52b7U, (uint64_t)0x6744a2980b75c904U,
+    (uint64_t)0xc305b0aea8f7f96cU, (uint64_t)0x42e421d182cf932U, (uint64_t)0xf6fc5d509e4636caU,
+    (uint64_t)0xe4435a51b3e59b89U, (uint64_t)0x136139554133a1c9U, (uint64_t)0x87f46973440bee59U,
+    (uint64_t)0x714710f800c401e4U, (uint64_t)0xc0cf4bced6c446c9U, (uint64_t)0xe0aa7fd66c4d5368U,
+    (uint64_t)0xde5d811afc68fc37U, (uint64_t)0x61febd72b7c2a057U, (uint64_t)0x795847c9d64cc78cU,
+    (uint64_t)0x6c50621b9b6cb27bU, (uint64_t)0x7099bf8df8022abU, (uint64_t)0x48f862ebc04eda1dU,
+    (uint64_t)0xd12732ede1603c16U, (uint64_t)0x19a80e0f5c9a9450U, (uint64_t)0xe2257f54b429b4fcU,
+    (uint64_t)0x66d3b2c645460515U, (uint64_t)0x27375fe665f837e2U, (uint64_t)0x93f8c68bd882179fU,
+    (uint64_t)0x584feadc59b16187U, (uint64_t)0xe5b50be9483bc162U, (uint64_t)0x7ad9d6f1a2776625U,
+    (uint64_t)0xe9d1008004ff457bU, (uint64_t)0x5b56d322677618a6U, (uint64_t)0x36694eae3e68673U,
+    (uint64_t)0x6ca4f87e822e37beU, (uint64_t)0x73f237b4253bda4eU, (uint64_t)0xf747f3a241190aebU,
+    (uint64_t)0xf06fa36f804cf284U, (uint64_t)0xa6bbb6efc621c12U, (uint64_t)0x5d624b6440b80ec6U,
+    (uint64_t)0x4b0724257ba556f3U, (uint64_t)0x7fa0c3543e2d20a8U, (uint64_t)0x6feaffc51d8a4fd1U,
+    (uint64_t)0x59663b205f1ad208U, (uint64_t)0xefc93cef24acb46aU, (uint64_t)0x54929de05967118cU,
+    (uint64_t)0x885708009acffb1cU, (uint64_t)0x492bbf2b145639ecU, (uint64_t)0x71f495a638f0018eU,
+    (uint64_t)0xe24365dbc2792847U, (uint64_t)0xe921fa31e3229d41U, (uint64_t)0xa929c65294531bd4U,
+    (uint64_t)0x84156027a6d38209U, (uint64_t)0xf3d69f736bdb97bdU, (uint64_t)0x8906d19a16833631U,
+    (uint64_t)0x68a34c2e03d51be3U, (uint64_t)0xcb59583b0e511cd8U, (uint64_t)0x99ce6bfdfdc132a8U,
+    (uint64_t)0x4bedae86a6f29002U, (uint64_t)0x7abedb56e034457aU, (uint64_t)0x8bf3eec6179bff2aU,
+    (uint64_t)0x9d626d57390f4e6bU, (uint64_t)0x653fe0e914dd6ea3U, (uint64_t)0x7483715989bd6d08U,
+    (uint64_t)0x85fb05b4ebd9b03dU, (uint64_t)0x7dc3f2214a768bbcU, (uint64_t)0x3facdaaaffcdb463U,
+    (uint64_t)0x658bbc1a34a38b08U, (uint64_t)0x12a801f8f1a9078dU, (uint64_t)0x1567bcf96ab855deU,
+    (uint64_t)0xe08498e03572359bU, (uint64_t)0xcf0353e58659e68bU, (uint64_t)0xbb86e9c87d23807cU,
+    (uint64_t)0xbc08728d2198e8a2U, (uint64_t)0xaacc63f132b0ed8fU, (uint64_t)0x41237242bafefd2U,
+    (uint64_t)0xdf9a7987e2d2a13U, (uint64_t)0x9bd13cf9c27591fU, (uint64_t)0xaa5f5e476e1afb50U,
+    (uint64_t)0xcd146a42b66eb646U, (uint64_t)0x3f07561d1442ec3cU, (uint64_t)0x7e5471738ae8ec47U,
+    (uint64_t)0x8ce9b6bfc360e25aU, (uint64_t)0xe6425195075a1a78U, (uint64_t)0x9dc756a8481732f4U,
+    (uint64_t)0x83c0440f5432b57aU, (uint64_t)0xc670b3f1d720281fU, (uint64_t)0x2205910ed135e051U,
+    (uint64_t)0xded14b0edb052be7U, (uint64_t)0x697b3d27c568ea39U, (uint64_t)0x2e599b9afb3ff9edU,
+    (uint64_t)0x28c2e0ab17f6515cU, (uint64_t)0x1cbee4fd474da449U, (uint64_t)0x71279a44f364452U,
+    (uint64_t)0x97abff6601fbe855U, (uint64_t)0x3ee394e85fda51c4U, (uint64_t)0x190385f667597c0bU,
+    (uint64_t)0x6e9fccc6a27ee34bU, (uint64_t)0xb89de9314092ebbU, (uint64_t)0xf17256bd428e240cU,
+    (uint64_t)0xcf89a7f393d2f064U, (uint64_t)0x4f57841ee1ed3b14U, (uint64_t)0x4ee14405e708d855U,
+    (uint64_t)0x856aae7203f1c3d0U, (uint64_t)0xc8e5424fbdd7eed5U, (uint64_t)0x3333e4ef73ab4270U,
+    (uint64_t)0x3bc77adedda492f8U, (uint64_t)0xc11a3aea78297205U, (uint64_t)0x5e89a3e734931b4cU,
+    (uint64_t)0x17512e2e9f5694bbU, (uint64_t)0x5dc349f3177bf8b6U, (uint64_t)0x232ea4ba08c7ff3eU,
+    (uint64_t)0x9c4f9d16f511145dU, (uint64_t)0xccf109a333b379c3U, (uint64_t)0xe75e7a88a1f25897U,
+    (uint64_t)0x7ac6961fa1b5d4d8U, (uint64_t)0xe3e1077308f3ed5cU, (uint64_t)0x208a54ec0a892dfbU,
+    (uint64_t)0xbe826e1978660710U, (uint64_t)0xcf70a97237df2c8U, (uint64_t)0x418a7340ed704da5U,
+    (uint64_t)0xa3eeb9a908ca33fdU, (uint64_t)0x49d96233169bca96U, (uint64_t)0x4d286d42da6aafbU,
+    (uint64_t)0xc09606eca0c2fa94U, (uint64_t)0x8869d0d523ff0fb3U, (uint64_t)0xa99937e5d0150d65U,
+    (uint64_t)0xa92e2503240c14c9U, (uint64_t)0x656bf945108e2d49U, (uint64_t)0x152a733aa2f59e2bU,
+    (uint64_t)0xb4323d588434a920U, (uint64_t)0xc0af8e93622103c5U, (uint64_t)0x667518ef938dbf9aU,
+    (uint64_t)0xa184307383a9cdf2U, (uint64_t)0x350a94aa5447ab80U, (uint64_t)0xe5e5a325c75a3d61U,
+    (uint64_t)0x74ba507f68411a9eU, (uint64_t)0x10581fc1594f70c5U, (uint64_t)0x60e2857080eb24a9U,
+    (uint64_t)0x7bedfb4d488e0cfdU, (uint64_t)0x721ebbd7c259cdb8U, (uint64_t)0xb0da855bc6390a9U,
+    (uint64_t)0x2b4d04dbde314c70U, (uint64_t)0xcdbf1fbc6c32e846U, (uint64_t)0x33833eabb162fc9eU,
+    (uint64_t)0x9939b48bb0dd3ab7U, (uint64_t)0x5aaa98a7cb0c9c8cU, (uint64_t)0x75105f3081c4375cU,
+    (uint64_t)0xceee50575ef1c90fU, (uint64_t)0xb31e065fc23a17bfU, (uint64_t)0x5364d275d4b6d45aU,
+    (uint64_t)0xd363f3ad62ec8996U, (uint64_t)0xb5d212394391c65bU, (uint64_t)0x84564765ebb41b47U,
+    (uint64_t)0x20d18ecc37107c78U, (uint64_t)0xacff3b6b570c2a66U, (uint64_t)0x22f975d99bd0d845U,
+    (uint64_t)0xef0a0c46ba178fa0U, (uint64_t)0x1a41965176b6028eU, (uint64_t)0xc49ec674248612d4U,
+    (uint64_t)0x5b6ac4f27338af55U, (uint64_t)0x6145e627bee5a36U, (uint64_t)0x33e95d07e75746b5U,
+    (uint64_t)0x1c1e1f6dc40c78beU, (uint64_t)0x967833ef222ff8e2U, (uint64_t)0x4bedcf6ab49180adU,
+    (uint64_t)0x6b37e9c13d7a4c8aU, (uint64_t)0x2748887c6ddfe760U, (uint64_t)0xf7055123aa3a5bbcU,
+    (uint64_t)0x954ff2257bbb8e74U, (uint64_t)0xc42b8ab197c3dfb9U, (uint64_t)0x55a549b0cf168154U,
+    (uint64_t)0xad6748e7c1b50692U, (uint64_t)0x2775780f6fc5cbcbU, (uint64_t)0x4eab80b8e1c9d7c8U,
+    (uint64_t)0x8c69dae13fdbcd56U, (uint64_t)0x47e6b4fb9969eaceU, (uint64_t)0x2f1085a705cb5aU,
+    (uint64_t)0x4e23ca446d3fea55U, (uint64_t)0xb4ae9c86f4810568U, (uint64_t)0x47bfb91b2a62f27dU,
+    (uint64_t)0x60deb4c9d9bac28cU, (uint64_t)0xa892d8947de6c34cU, (uint64_t)0x4ee682594494587dU,
+    (uint64_t)0x914ee14e1a3f8a5bU, (uint64_t)0xbb113eaa28700385U, (uint64_t)0x81ca03b92115b4c9U,
+    (uint64_t)0x7c163d388908cad1U, (uint64_t)0xc912a118aa18179aU, (uint64_t)0xe09ed750886e3081U,
+    (uint64_t)0xa676e3fa26f516caU, (uint64_t)0x753cacf78e732f91U, (uint64_t)0x51592aea833da8b4U,
+    (uint64_t)0xc626f42f4cbea8aaU, (uint64_t)0xef9dc899a7b56eafU, (uint64_t)0xc0e52c34ef7316U,
+    (uint64_t)0x5b1e4e24fe818a86U, (uint64_t)0x9d31e20dc538be47U, (uint64_t)0x22eb932d3ed68974U,
+    (uint64_t)0xe44bbc087c4e87c4U, (uint64_t)0x4121086e0dde9aefU, (uint64_t)0x8e6b9cff134f4345U,
+    (uint64_t)0x3e0e5c9dd111f8ecU, (uint64_t)0xbcc33f8db7c4e760U, (uint64_t)0x702f9a91bd392a51U,
+    (uint64_t)0x7da4a795c132e92dU, (uint64_t)0x1a0b0ae30bb1151bU, (uint64_t)0x54febac802e32251U,
+    (uint64_t)0xea3a5082694e9e78U, (uint64_t)0xe58ffec1e4fe40b8U, (uint64_t)0xfbb8349d29c4120bU,
+    (uint64_t)0x9f94391fc0d0d915U, (uint64_t)0xc4074fa75410ba51U, (uint64_t)0xa66adbf6150a5911U,
+    (uint64_t)0xc164543c34bfca38U, (uint64_t)0xe0f27560b9e1ccfcU, (uint64_t)0x99da0f53e820219cU,
+    (uint64_t)0xe8234498c6b4997aU, (uint64_t)0x7b23c513516e19e4U, (uint64_t)0x56e2e847c5c4d593U,
+    (uint64_t)0x9f727d735ce71ef6U, (uint64_t)0x5b6304a6f79a44c5U, (uint64_t)0x6638a7363ab7e433U,
+    (uint64_t)0x1adea470fe742f83U, (uint64_t)0xe054b8545b7fc19fU, (uint64_t)0xf935381aba1d0698U,
+    (uint64_t)0xb5504f9d918e4936U, (uint64_t)0x65035ef6b2513982U, (uint64_t)0x553a0c26f4d9cb9U,
+    (uint64_t)0x6cb10d56bea85509U, (uint64_t)0x48d957b7a242da11U, (uint64_t)0x16a4d3dd672b7268U,
+    (uint64_t)0x3d7e637c8502a96bU, (uint64_t)0x27c7032b730d463bU, (uint64_t)0x55366b7d5846426fU,
+    (uint64_t)0xe7d09e89247d441dU, (uint64_t)0x510b404d736fbf48U, (uint64_t)0x7fa003d0e784bd7dU,
+    (uint64_t)0x25f7614f17fd9596U, (uint64_t)0x49e0e0a135cb98dbU, (uint64_t)0x2c65957b2e83a76aU,
+    (uint64_t)0x5d40da8dcddbe0f8U, (uint64_t)0x37f68bb4a595939dU, (uint64_t)0x355647928740217U,
+    (uint64_t)0x8e740e7c84ad7612U, (uint64_t)0xd89bc8439044695fU, (uint64_t)0xf7f3da5d85a9184dU,
+    (uint64_t)0x562563bb9fc0b074U, (uint64_t)0x6d2e6aaf88a888eU, (uint64_t)0x612d8643161fbe7cU,
+    (uint64_t)0x9fb3bba354530bb2U, (uint64_t)0xbde3ef77cb0869eaU, (uint64_t)0x89bc90460b431163U,
+    (uint64_t)0x4d03d7d2e4819a35U, (uint64_t)0x33ae4f9e43b6a782U, (uint64_t)0x216db3079c88a686U,
+    (uint64_t)0x91dd88e000ffedd9U, (uint64_t)0xb280da9f12bd4840U, (uint64_t)0x458f86913e538cd7U,
+    (uint64_t)0xa7001f6c8e08ad53U, (uint64_t)0x52b8c6e6bf5d15ffU, (uint64_t)0x548234a4011215ddU,
+    (uint64_t)0xff5a9d2d3d5b4045U, (uint64_t)0xb0ffeeb64a904190U, (uint64_t)0x55a3aca448607f8bU,
+    (uint64_t)0x8cbd665c30a0672aU, (uint64_t)0xa37f3573f37f5937U, (uint64_t)0xeb0f6c7dd1e4fca5U,
+    (uint64_t)0x2965a554ac8ab0fcU, (uint64_t)0x17fbf56c274676acU, (uint64_t)0x2e2f6bd9acf7d720U,
+    (uint64_t)0x41fc8f8810224766U, (uint64_t)0x517a14b385d53befU, (uint64_t)0xdae327a57d76a7d1U,
+    (uint64_t)0x515d5c891f5f82dcU, (uint64_t)0x9a7f67d76361079eU, (uint64_t)0xa8da81e311a35330U,
+    (uint64_t)0xe44990c44b18be1bU, (uint64_t)0xc7d5ed95af103e59U, (uint64_t)0xece8aba78dac9261U,
+    (uint64_t)0xbe82b0999394b8d3U, (uint64_t)0x6830f09a16adfe83U, (uint64_t)0x43c41ac194d7d9b1U,
+    (uint64_t)0x5bafdd82c82e7f17U, (uint64_t)0xdf0614c15fda0fcaU, (uint64_t)0x74b043a7a8ae37adU,
+    (uint64_t)0x3ba6afa19e71734cU, (uint64_t)0x15d5437e9c450f2eU, (uint64_t)0x4a5883fe67e242b1U,
+    (uint64_t)0x5143bdc22c1953c2U, (uint64_t)0xa2a9ce7c6b53f5f9U, (uint64_t)0x642465951b176d99U,
+    (uint64_t)0xb1298d36b95c081bU, (uint64_t)0x53505bb81d9a9ee6U, (uint64_t)0x3f6f9e61f2ba70b0U,
+    (uint64_t)0xd07e16c98afad453U, (uint64_t)0x9f1694bbe7eb4a6aU, (uint64_t)0xdfebced93cb0bc8eU,
+    (uint64_t)0xc676d7f2b1f3390bU, (uint64_t)0x9f7a1b8ca5b61272U, (uint64_t)0x4ebebfc9c2e127a9U,
+    (uint64_t)0x4602500c5dd997bfU, (uint64_t)0x7f09771c4711230fU, (uint64_t)0x58eb37c020f09c1U,
+    (uint64_t)0xab693d4bfee5e38bU, (uint64_t)0x9289eb1f4653cbc0U, (uint64_t)0xa44d2b391770f5a7U,
+    (uint64_t)0xe4d4d7910e44eb82U, (uint64_t)0x42e69d1e3f69712aU, (uint64_t)0xbf11c4d6ac6a820eU,
+    (uint64_t)0xb5e7f3e542c4224cU, (uint64_t)0xd6b4e81c449d941cU, (uint64_t)0x5d72bd165450e878U,
+    (uint64_t)0x6a61e28aee25ac54U, (uint64_t)0x54da9dc7ab952578U, (uint64_t)0xb5423df226e84d0bU,
+    (uint64_t)0xa8b64eeb9b872042U, (uint64_t)0xac2057825990f6dfU, (uint64_t)0x4ff696eb21f4c77aU,
+    (uint64_t)0x1a79c3e4aab273afU, (uint64_t)0x29bc922e9436b3f1U, (uint64_t)0xff807ef8d6d9a27aU,
+    (uint64_t)0x62a8c244bfe20925U, (uint64_t)0x91c19ac38fdce867U, (uint64_t)0x5a96a5d5dd387063U,
+    (uint64_t)0x61d587d421d324f6U, (uint64_t)0xe87673a2a37173eaU, (uint64_t)0x2384800853778b65U,
+    (uint64_t)0x10f8441e05bab43eU, (uint64_t)0xfa11fe124621efbeU, (uint64_t)0x23f949feb8a24a20U,
+    (uint64_t)0x17ebfed1f52ca53fU, (uint64_t)0x9b691bbebcfb4853U, (uint64_t)0x5617ff6b6278a05dU,
+    (uint64_t)0x241b34c5e3c99ebdU, (uint64_t)0xfc64242e1784156aU, (uint64_t)0x4206482f695d67dfU,
+    (uint64_t)0xb967ce0eee27c011U, (uint64_t)0xc0f734a3b2335834U, (uint64_t)0x9526205a90ef6860U,
+    (uint64_t)0xcb8be71704e2bb0dU, (uint64_t)0x2418871e02f383faU, (uint64_t)0xd71776814082c157U,
+    (uint64_t)0xcc914ad029c20073U, (uint64_t)0xf186c1ebe587e728U, (uint64_t)0x6fdb3c2261bcd5fdU,
+    (uint64_t)0xb4480f0441c23fa3U, (uint64_t)0xb4712eb0c1989a2eU, (uint64_t)0x3ccbba0f93a29ca7U,
+    (uint64_t)0x6e205c14d619428cU, (uint64_t)0x90db7957b3641686U, (uint64_t)0x432691d45ac8b4eU,
+    (uint64_t)0x7a759acf64e0350U, (uint64_t)0x514d89c9c972517U, (uint64_t)0xcc7c4c1c2cf9d7c1U,
+    (uint64_t)0x1320886aee95e5abU, (uint64_t)0xbb7b9056beae170cU, (uint64_t)0xc8a5b250dbc0d662U,
+    (uint64_t)0x4ed81432c11d2303U, (uint64_t)0x7da669121f03769fU, (uint64_t)0x3ac7a5fd84539828U,
+    (uint64_t)0x14dada943bccdd02U, (uint64_t)0x7bb4f7aaf0dcbc49U, (uint64_t)0x7de551f970bbb45bU,
+    (uint64_t)0xcfd0f3e49f2ca2e5U, (uint64_t)0xece587091f5c76efU, (uint64_t)0x32920edd167d79aeU,
+    (uint64_t)0x39df8a2fa7d7ec1U, (uint64_t)0xf46206c0bb30af91U, (uint64_t)0x1ff5e2f522676b59U,
+    (uint64_t)0x51b90651cbae2f70U, (uint64_t)0xefc4bc0593aaa8ebU, (uint64_t)0x8ecd8689dd1df499U,
+    (uint64_t)0x1aee99a822f367a5U, (uint64_t)0x95d485b9ae8274c5U, (uint64_t)0x6c14d4457d30b39cU,
+    (uint64_t)0xbafea90bbcc1ef81U, (uint64_t)0x7c5f317aa459a2edU, (uint64_t)0xe3b22c6bc4fe3c39U,
+    (uint64_t)0xba4a81536c7bebdfU, (uint64_t)0xf23ab6b725693459U, (uint64_t)0x53bc377014922b11U,
+    (uint64_t)0x4645c8ab5afc60dbU, (uint64_t)0xaa02235520b9f2a3U, (uint64_t)0x52a2954cce0fc507U,
+    (uint64_t)0x8c2731bb7ce1c2e7U, (uint64_t)0x410dc6a90deeaf52U, (uint64_t)0xb003fb024c641c15U,
+    (uint64_t)0x1384978c5bc504c4U, (uint64_t)0x37640487864a6a77U, (uint64_t)0x5991bc6222a77daU,
+    (uint64_t)0x62260a575e47eb11U, (uint64_t)0xc7af6613f21b432cU, (uint64_t)0x22f3acc9ab4953e9U,
+    (uint64_t)0x27c8919240be34e8U, (uint64_t)0xc7162b3791907f35U, (uint64_t)0x90188ec1a956702bU,
+    (uint64_t)0xca132f7ddf93769cU, (uint64_t)0x3ece44f90e2025b4U, (uint64_t)0x67aaec690c62f14cU,
+    (uint64_t)0xad74141822e3cc11U, (uint64_t)0xcf9b75c37ff9a50eU, (uint64_t)0xd0942770c24efc8U,
+    (uint64_t)0x349fd04bef737a4U, (uint64_t)0x6d1c9dd2514cdd28U, (uint64_t)0x29c135ff30da9521U,
+    (uint64_t)0xea6e4508f78b0b6fU, (uint64_t)0x176f5dd2678c143cU, (uint64_t)0x81484184be21e65U,
+    (uint64_t)0x27f7525ce7df38c4U, (uint64_t)0x5066efb6d9790ed6U, (uint64_t)0xa77a0cbca6aa793bU,
+    (uint64_t)0x1a915f3c223e042eU, (uint64_t)0x1c5def0469c5874bU, (uint64_t)0xe83007873b6c1daU,
+    (uint64_t)0x55cf85d2fcd8557aU, (uint64_t)0xf7c7c760460f3b1U, (uint64_t)0x87052acb46e58063U,
+    (uint64_t)0x9faaccf5e4652f1dU, (uint64_t)0xbd6fdd2ad56157b2U, (uint64_t)0xa4f4fb1f6261ec50U,
+    (uint64_t)0x244e55ad476bcd52U, (uint64_t)0x881c9305047d320bU, (uint64_t)0x1ca983d56181263fU,
+    (uint64_t)0x354e9a44278fb8eeU, (uint64_t)0xad2dbc0f396e4964U, (uint64_t)0x7915c5242d0a4c23U,
+    (uint64_t)0xeb5d26e46bb3cc52U, (uint64_t)0x369a9116c09e2c92U, (uint64_t)0xc527f92cf182cf8U,
+    (uint64_t)0x9e5919382aede0acU, (uint64_t)0xb29222086cc34939U, (uint64_t)0x3c9d896299a34361U,
+    (uint64_t)0x3c81836dc1905fe6U, (uint64_t)0xfce0176788a2ffe4U, (uint64_t)0xdc506a3528e169a5U,
+    (uint64_t)0xea108617af9c93aU, (uint64_t)0x1ed2436103fa0e08U, (uint64_t)0x96eaaa92a3d694e7U,
+    (uint64_t)0xc0f43b4def50bc74U, (uint64_t)0xce6aa58c64114db4U, (uint64_t)0x8218e8ea7c000fd4U,
+    (uint64_t)0xc16c236e846e364fU, (uint64_t)0x7f33527cdea50ca0U, (uint64_t)0xc48107750926b86dU,
+    (uint64_t)0x6c2a36090598e70cU, (uint64_t)0xa6755e52f024e924U, (uint64_t)0xe0fa07a49db4afcaU,
+    (uint64_t)0x15c3ce7d66831790U, (uint64_t)0x5b4ef350a6cbb0d6U, (uint64_t)0x5214c050f15dde9U,
+    (uint64_t)0xa47a76a80d5f2b82U, (uint64_t)0xbb254d3062e82b62U, (uint64_t)0x11a05fe03ec955eeU,
+    (uint64_t)0x7eaff46e9d529b36U, (uint64_t)0x55ab13018f9e3df6U, (uint64_t)0xc463e37199317698U,
+    (uint64_t)0xfd251438ccda47adU, (uint64_t)0xe2a37598a9d82abfU, (uint64_t)0x5f188ccbe6c170f5U,
+    (uint64_t)0x816822005066b087U, (uint64_t)0xda22c212c7155adaU, (uint64_t)0x151e5d3afbddb479U,
+    (uint64_t)0x4b606b846d715b99U, (uint64_t)0x4a73b54bf997cb2eU, (uint64_t)0x9a1bfe433ecd8b66U,
+    (uint64_t)0xe13122f3dbfb894eU, (uint64_t)0xbe9b79f6ce274b18U, (uint64_t)0x85a49de5ca58aadfU,
+    (uint64_t)0x2495775811487351U, (uint64_t)0x111def61bb939099U, (uint64_t)0x1d6a974a26d13694U,
+    (uint64_t)0x4474b4ced3fc253bU, (uint64_t)0x3a1485e64c5db15eU, (uint64_t)0x5afddab61430c9abU,
+    (uint64_t)0xbdd41d32238e997U, (uint64_t)0xf0947430418042aeU, (uint64_t)0x71f9addacdddc4cbU,
+    (uint64_t)0x7090c016c52dd907U, (uint64_t)0xd9bdf44d29e2047fU, (uint64_t)0xe6f1fe801b1011a6U,
+    (uint64_t)0xb63accbcd9acdc78U, (uint64_t)0x7817acab4baef62eU, (uint64_t)0x9f5a2202a85b91e8U,
+    (uint64_t)0x9666ebe66ce57610U, (uint64_t)0x32ad31f3f73bfe03U, (uint64_t)0x628330a425bcf4d6U,
+    (uint64_t)0xea950593515056e6U, (uint64_t)0x59811c89e1332156U, (uint64_t)0xc89cf1fe8c11b2d7U,
+    (uint64_t)0xad7337ac0b7eff3U, (uint64_t)0x8552225ec5e48b3cU, (uint64_t)0xe6f78b0c73f13a5fU,
+    (uint64_t)0x5e70062e82349cbeU, (uint64_t)0x6b8d5048e7073969U, (uint64_t)0x392d2a29c33cb3d2U,
+    (uint64_t)0xee4f727c4ecaa20fU, (uint64_t)0xa068c99e2ccde707U, (uint64_t)0xebde86ec1ed66f18U,
+    (uint64_t)0x225d906bd61fce43U, (uint64_t)0x5cab07d6e8bed74dU, (uint64_t)0x16e4617f27855ab7U,
+    (uint64_t)0x6568aaddb2fbc3ddU, (uint64_t)0xedb5484f8aeddf5bU, (uint64_t)0x878f20e86dcf2fadU,
+    (uint64_t)0x3516497c615f5699U, (uint64_t)0x5b826fcb1b3ec67bU, (uint64_t)0xece1b4b041356616U,
+    (uint64_t)0x7d5ce77e56a3ab4fU, (uint64_t)0xf6087f13aa212da0U, (uint64_t)0xe63015054db92129U,
+    (uint64_t)0xb8ae4c9940407d11U, (uint64_t)0x2b6de222dfab8385U, (uint64_t)0x9b323022b7d6c3b4U,
+    (uint64_t)0x57ef17a5ae6ad84U, (uint64_t)0x9feae00b293a6ae0U, (uint64_t)0xd18bb6c154266408U,
+    (uint64_t)0xd3d3e1209c8e8e48U, (uint64_t)0xba8d4ca80e94fc8fU, (uint64_t)0x80262ffc8a8ea0feU,
+    (uint64_t)0xac5b2855f71655fdU, (uint64_t)0xa348f8fae9aced89U, (uint64_t)0x60684b69a5660af3U,
+    (uint64_t)0x69aad23b9066d14bU, (uint64_t)0x4d9f9b49fa4d020aU, (uint64_t)0xafb54ec1b5cd6a4aU,
+    (uint64_t)0x2b25fe1832fd864dU, (uint64_t)0xee6945062b6b64d0U, (uint64_t)0x954a2a515001d8aaU,
+    (uint64_t)0x5e1008557082b5b3U, (uint64_t)0x5158aee8707bace2U, (uint64_t)0x458d14c6f86d1c56U,
+    (uint64_t)0x15ebf15cc1b9bee2U, (uint64_t)0xa015df660f379cc0U, (uint64_t)0xb24ceba3202ed161U,
+    (uint64_t)0x4558f687204b3df0U, (uint64_t)0x890e8eedbe264c04U, (uint64_t)0xb5b7871090de8bb7U,
+    (uint64_t)0x20ecf71cbc90eb1bU, (uint64_t)0x4234facf651c1df4U, (uint64_t)0xc720fce9e681f678U,
+    (uint64_t)0x680becdda7c007f4U, (uint64_t)0x7c08dc063181afeaU, (uint64_t)0x75c1b050a34eca91U,
+    (uint64_t)0x7d3479d54b9e2333U, (uint64_t)0xed16640af3951aa3U, (uint64_t)0xd3ae1ae29915a53aU,
+    (uint64_t)0x98358b72b717839eU, (uint64_t)0x87351551240c58d0U, (uint64_t)0xc747589cb53850e9U,
+    (uint64_t)0x5be861ba7f2a079cU, (uint64_t)0x9506982b81a53f25U, (uint64_t)0x169a2cfe64551da8U,
+    (uint64_t)0x5e36bd2e5ca003a7U, (uint64_t)0x911b596264723e54U, (uint64_t)0x34384f8c004b327cU,
+    (uint64_t)0x6ca5c61b85435f2U, (uint64_t)0x12e0cd25e2c1075cU, (uint64_t)0xa4b84cb8ac727394U,
+    (uint64_t)0x50bd720492b352c1U, (uint64_t)0xe85524a49cbd0fb4U, (uint64_t)0x10b9274be7876024U,
+    (uint64_t)0x80531fe1c63c4962U, (uint64_t)0x50541e89981fdb25U, (uint64_t)0xdc1291a1fd4c2b6bU,
+    (uint64_t)0xc0693a17a6df4fcaU, (uint64_t)0xb2c4604e0117f203U, (uint64_t)0x245f19630a99b8d0U,
+    (uint64_t)0xaedc20aac6212c44U, (uint64_t)0xb1ed4e56520f52a8U, (uint64_t)0xb5560fb6700a1acdU,
+    (uint64_t)0xe823fd73fd999681U, (uint64_t)0xda915d1f6cb4e1baU, (uint64_t)0xd0301186ebe00a3U,
+    (uint64_t)0x744fb0c989fca8cdU, (uint64_t)0x970d01dbf9da0e0bU, (uint64_t)0xad8c5647931d76fU,
+    (uint64_t)0xb15737bff659b96aU, (uint64_t)0x18f37a9c6bdf22daU, (uint64_t)0xefbc432f90dc82dfU,
+    (uint64_t)0xc52cef8e5d703651U, (uint64_t)0x82887ba0d99881a5U, (uint64_t)0x7cec9ddab920ec1dU,
+    (uint64_t)0xd0d7e8c3ec3e8d3bU, (uint64_t)0x445bc3954ca88747U, (uint64_t)0xedeaa2e09fd53535U,
+    (uint64_t)0xa12b384ece53c2d0U, (uint64_t)0x779d897d5e4606daU, (uint64_t)0xa53e47b073ec12b0U,
+    (uint64_t)0x462dbbba5756f1adU, (uint64_t)0x69fe09f2cafe37b6U, (uint64_t)0x273d1ebfecce2e17U,
+    (uint64_t)0x8ac1d5383cf607fdU, (uint64_t)0x8035f7ff12e10c25U, (uint64_t)0xb7d4cc0f296c9005U,
+    (uint64_t)0x4b9094fa7b0aebdbU, (uint64_t)0xe1bf10f1c00ec8d4U, (uint64_t)0xd807b1c4d667c101U,
+    (uint64_t)0xa9412cdfbe713383U, (uint64_t)0x435e063e81142ba1U, (uint64_t)0x984c15ecaf0a6bdcU,
+    (uint64_t)0x592c246092a3dab9U, (uint64_t)0xca442d5a2093c22aU, (uint64_t)0xebd0bd31d5703aedU,
+    (uint64_t)0x308f2afd653287b6U, (uint64_t)0x9bb88bac0d1bc8baU, (uint64_t)0xfbaf853875c1e3b2U,
+    (uint64_t)0xbd2ac950ca11447cU, (uint64_t)0x286d816cea5c4c8dU, (uint64_t)0xdc3aa80028dc3208U,
+    (uint64_t)0x9365690016e23e9dU, (uint64_t)0xcb220c6ba7cc41e1U, (uint64_t)0xb36b20c369d6245cU,
+    (uint64_t)0x2d63c348b62e9a6aU, (uint64_t)0xa3473e19cdc0bcb5U, (uint64_t)0x70f18b3f8f601b98U,
+    (uint64_t)0x8ad7a2c7cde346e4U, (uint64_t)0xae9f6ec3bd3aaa64U, (uint64_t)0x854d34c77e6c5520U,
+    (uint64_t)0xc27df9efdcb9ea58U, (uint64_t)0x405f2369d686666dU, (uint64_t)0x29d1febf0417aa85U,
+    (uint64_t)0x9846819e93470afeU, (uint64_t)0x3e6a9669e2a27f9eU, (uint64_t)0x24d008a2e31e6504U,
+    (uint64_t)0xdba7cecf9cb7680aU, (uint64_t)0x30223503274c7e1U, (uint64_t)0x61ee8c934c4b6c26U,
+    (uint64_t)0x3c4397e3199389ceU, (uint64_t)0xe0082600488757ceU, (uint64_t)0xaac3a2df06b4dafbU,
+    (uint64_t)0x45af0700ddff5b6aU, (uint64_t)0xa5974248c1d9fa0U, (uint64_t)0x1640087d391fc68bU,
+    (uint64_t)0x26a43e41d07fa53dU, (uint64_t)0x3154a78a74e35bc5U, (uint64_t)0x7b768924e0da2f8cU,
+    (uint64_t)0xba964a2b23613f9aU, (uint64_t)0x5a548d35ba1d16c4U, (uint64_t)0x2e1bfed1fb54d057U,
+    (uint64_t)0xff992136bc640205U, (uint64_t)0xf39cb9148156df29U, (uint64_t)0xf4873fcf4e5548bdU,
+    (uint64_t)0x8725da3f03ce57f0U, (uint64_t)0xd82f5c95ca953258U, (uint64_t)0xac647f127cf0747eU,
+    (uint64_t)0xff2038b02d570bd5U, (uint64_t)0xb0c2a767a13ae03fU, (uint64_t)0xebaa27cde9932d16U,
+    (uint64_t)0xa686e3fc1234e901U, (uint64_t)0xc913e64699b444adU, (uint64_t)0xddfce99dc40504c5U,
+    (uint64_t)0x58482a99d42e53dbU, (uint64_t)0x9aaf2c25d1aff537U, (uint64_t)0xee90f7962664cf67U,
+    (uint64_t)0x74ab5c99f1393e2bU, (uint64_t)0xfad0faeae6225bb0U, (uint64_t)0xc355648c2d63dd6cU,
+    (uint64_t)0x9f80435e63261eccU, (uint64_t)0x6302a62e4337d6c9U, (uint64_t)0x91916a49ca4958a0U,
+    (uint64_t)0x554958993149d5d3U, (uint64_t)0x378d020b9f91de3cU, (uint64_t)0x47b839a34dd25170U,
+    (uint64_t)0x2825854138b7f258U, (uint64_t)0xea5b14f7437e7decU, (uint64_t)0xe4e31d271d91cf9dU,
+    (uint64_t)0xcb35d4fdb377b20aU, (uint64_t)0x74de1e45055e1327U, (uint64_t)0x3298e31b28703e75U,
+    (uint64_t)0x55087237de013339U, (uint64_t)0x32cbf30123d101c6U, (uint64_t)0xc70dba22e8aab0dcU,
+    (uint64_t)0x4a52623d3d155bb9U, (uint64_t)0x74f08736b0018f44U, (uint64_t)0xf4a03417b446d0f5U,
+    (uint64_t)0x66a4aa2fa40ca6b2U, (uint64_t)0x215679f0badb60edU, (uint64_t)0x3871195a323e4eefU,
+    (uint64_t)0x8f0940c320952b16U, (uint64_t)0xfe8dac62879d5f7dU, (uint64_t)0x649cb623c1a6e875U,
+    (uint64_t)0x32670d2f7189e71fU, (uint64_t)0xc64387485ecf91e7U, (uint64_t)0x15758e57db757a21U,
+    (uint64_t)0x427d09f8290a9ce5U, (uint64_t)0x846a308f38384a7aU, (uint64_t)0xaac3acb4b0732b99U,
+    (uint64_t)0x9e94100917845819U, (uint64_t)0x95cba111a7ce5e03U, (uint64_t)0x97b7851aaaca5e9bU,
+    (uint64_t)0x518aa52156713b97U, (uint64_t)0x3357e8c7150a61f6U, (uint64_t)0x7842e7e2ec2c2b69U,
+    (uint64_t)0x8dffaf656868a548U, (uint64_t)0xd963bd82e068fc81U, (uint64_t)0x64da5c8b65917733U,
+    (uint64_t)0x927090ff7b247328U, (uint64_t)0x37a01e48a105fc8eU, (uint64_t)0x769d754a289ba48cU,
+    (uint64_t)0xc08c6fe1d51c2180U, (uint64_t)0xb032dd33b7bd1387U, (uint64_t)0x953826db020b0aa6U,
+    (uint64_t)0x5137e800664c73cU, (uint64_t)0xc66302c4660cf95dU, (uint64_t)0x99004e11b2cef28aU,
+    (uint64_t)0x214bc9a7d298c241U, (uint64_t)0xe3b697ba56807cfdU, (uint64_t)0xef1c78024564eadbU,
+    (uint64_t)0xdde8cdcfb48149c5U, (uint64_t)0x946bf0a75a4d2604U, (uint64_t)0x27154d7f6c1538afU,
+    (uint64_t)0x95cc9230de5b1fccU, (uint64_t)0xd88519e966864f82U, (uint64_t)0x1013e4f796ea6ca1U,
+    (uint64_t)0x567cdc2a1f792871U, (uint64_t)0xadb728705c658d45U, (uint64_t)0xf7c1ff4ace600e98U,
+    (uint64_t)0xa1ba86574b6cad39U, (uint64_t)0x3d58d634ba20b428U, (uint64_t)0xc0011cdea2e6fdfbU,
+    (uint64_t)0xa832367a7b18960dU, (uint64_t)0x47618c9f0e4938f7U, (uint64_t)0x58d47d69dc83719eU,
+    (uint64_t)0xd74c1a23f41a64ccU, (uint64_t)0x5d28e068b5829f66U, (uint64_t)0xd8d37529210466f6U,
+    (uint64_t)0x2af1152fc6a64ef8U, (uint64_t)0x55d4485c19ce6a7aU, (uint64_t)0x6d0bd2f5f648e2d7U,
+    (uint64_t)0x1ecc032af416448dU, (uint64_t)0x4a7e8c10ec76d971U, (uint64_t)0x854f9805b90b6eaeU,
+    (uint64_t)0xfd0b15324bed0594U, (uint64_t)0x89f71848d98b5ca3U, (uint64_t)0xd01fe5fcf039b3efU,
+    (uint64_t)0x4481332e627bda2eU, (uint64_t)0xe67cecd7a5073e41U, (uint64_t)0xb828dd1a7cb1282cU,
+    (uint64_t)0xa08d7626be46973aU, (uint64_t)0x6baf8d40e708d6b2U, (uint64_t)0x72571fa14daeb3f3U,
+    (uint64_t)0x85b1732ff22dfd98U, (uint64_t)0x87ab01a70087108dU, (uint64_t)0xaaaafea85988207aU,
+    (uint64_t)0xccc832f869f00755U, (uint64_t)0x2ab0bce94595a859U, (uint64_t)0x4d8c2da082084ee7U,
+    (uint64_t)0x21ff8be5acca3d3cU, (uint64_t)0xd8b805337827f633U, (uint64_t)0xf74e8c026becabbfU,
+    (uint64_t)0x9fae4dbefede4828U, (uint64_t)0xd3885a5b3cc46bcfU, (uint64_t)0x2d535e2b6e6ad144U,
+    (uint64_t)0x63d3444507d9e240U, (uint64_t)0x6fbadf4338cff7e6U, (uint64_t)0x8717624a959c9461U,
+    (uint64_t)0xd7d951c411fb775bU, (uint64_t)0x4049161af6fc3a2bU, (uint64_t)0xdfa2547a1a8e98dU,
+    (uint64_t)0xeca780d439c2139cU, (uint64_t)0xd8c2d8cbd73ea8efU, (uint64_t)0x3aa1974f07605b28U,
+    (uint64_t)0x4f3d82a71e296255U, (uint64_t)0xbbe5ea03b4e23f16U, (uint64_t)0x8f5c6c6b4e654193U,
+    (uint64_t)0x27181182d3e8ab01U, (uint64_t)0xc68bb231f3ba6bc2U, (uint64_t)0x90a244d820af1fd7U,
+    (uint64_t)0x605abc055b713f4fU, (uint64_t)0x964d950e36ff3bf0U, (uint64_t)0x8ad20f6ff0b34638U,
+    (uint64_t)0x4d9177b3b5d7585fU, (uint64_t)0xcf839760ef3f019fU, (uint64_t)0x582fc5b38288c545U,
+    (uint64_t)0x2f8e4e9b13116bd1U, (uint64_t)0xf91e1b2f332120efU, (uint64_t)0xcf5687242a17dd23U,
+    (uint64_t)0xca5fe19bd221991aU, (uint64_t)0x271ff066f05f400eU, (uint64_t)0x9d46ec4c9cf09896U,
+    (uint64_t)0xdcaa8dfdec4febc3U, (uint64_t)0xaa3995a0adf19d04U, (uint64_t)0xc98634239da573a6U,
+    (uint64_t)0x378058b2f2465b2bU, (uint64_t)0x20d389f9b4c31612U, (uint64_t)0x1907d767c9c8d468U,
+    (uint64_t)0xb428bd1404d61617U, (uint64_t)0x2865fc44bc0197U, (uint64_t)0x71f29f20d2d1286dU,
+    (uint64_t)0xeae96590dc5a11fcU, (uint64_t)0xa204462fcb933b4aU, (uint64_t)0x1504f0eeee742617U,
+    (uint64_t)0xec6e9a444b4cf39aU, (uint64_t)0xd7d199c7b7631c9dU, (uint64_t)0x1322c2b8bb123942U,
+    (uint64_t)0xe662b68fbe8b6848U, (uint64_t)0xc970faf2cde99b14U, (uint64_t)0x61b27134b06655e5U,
+    (uint64_t)0xadcef8f781365d89U, (uint64_t)0x917b5ab521b851aaU, (uint64_t)0x4f4472121cf694a7U,
+    (uint64_t)0xd433e50f6d3549cfU, (uint64_t)0x6f33696ffacd665eU, (uint64_t)0x695bfdacce11fcb4U,
+    (uint64_t)0x810ee252af7c9860U, (uint64_t)0x65450fe17159bb2cU, (uint64_t)0xf7dfbebe758b357bU,
+    (uint64_t)0x2b057e74d69fea72U, (uint64_t)0xd485717a92731745U, (uint64_t)0x896c42e8ee36860cU,
+    (uint64_t)0xdaf04dfd4113c22dU, (uint64_t)0x1adbb7b744104213U, (uint64_t)0xe5fd5fa11fd394eaU,
+    (uint64_t)0x68235d941a4e0551U, (uint64_t)0x6772cfbe18d10151U, (uint64_t)0x276071e309984523U,
+    (uint64_t)0xe4e879de5a56ba98U, (uint64_t)0x6c8d0aa9b898fd52U, (uint64_t)0x2fb38a57be9af1a7U,
+    (uint64_t)0xe1f2b9a93b4f03f8U, (uint64_t)0x2b1aad44c3f0cc6fU, (uint64_t)0x58b5332e7cf2c084U,
+    (uint64_t)0x1c57d96f0367d26dU, (uint64_t)0x2297eabdfa6e4a8dU, (uint64_t)0x65a947ee4a0e2b6aU,
+    (uint64_t)0xaaafafb0285b9491U, (uint64_t)0x1a0be881e4c705eU, (uint64_t)0xff1d4f5d2ad9caabU,
+    (uint64_t)0x6e349a4ac37a233fU, (uint64_t)0xcf1c12464a1c6a16U, (uint64_t)0xd99e6b6629383260U,
+    (uint64_t)0xea3d43665f6d5471U, (uint64_t)0x36974d04ff8cc89bU, (uint64_t)0xf535b616fdd5b854U,
+    (uint64_t)0x592549c85728719fU, (uint64_t)0xe231468606921cadU, (uint64_t)0x98c8ce34311b1ef8U,
+    (uint64_t)0x28b937e7e9090b36U, (uint64_t)0x67fc3ab90bf7bbb7U, (uint64_t)0x12337097a9d87974U,
+    (uint64_t)0x3e5adca1f970e3feU, (uint64_t)0xc26c49a1cfe89d80U, (uint64_t)0xb42c026dda9c8371U,
+    (uint64_t)0xca6c013adad066d2U, (uint64_t)0xfb8f722856a4f3eeU, (uint64_t)0x8b579ecd850935bU,
+    (uint64_t)0x34c1a74cd631e1b3U, (uint64_t)0xcb5fe596ac198534U, (uint64_t)0x39ff21f6e1f24f25U,
+    (uint64_t)0xcdcc68a7b3f85ff0U, (uint64_t)0xacd21cdd1a888044U, (uint64_t)0xb6719b2e05dbe894U,
+    (uint64_t)0xfae1d3d88b8260d4U, (uint64_t)0xedfedece8a1c5d92U, (uint64_t)0xbca01a94dc52077eU,
+    (uint64_t)0xc085549c16dd13edU, (uint64_t)0xdc5c3bae495ebaadU, (uint64_t)0x27f29e148f929057U,
+    (uint64_t)0x7a64ae06c0c853dfU, (uint64_t)0x256cd18358e9c5ceU, (uint64_t)0x9d9cce82ded092a5U,
+    (uint64_t)0xcc6e59796e93b7c7U, (uint64_t)0xe1e4709231bb9e27U, (uint64_t)0xb70b3083aa9e29a0U,
+    (uint64_t)0xbf181a753785e644U, (uint64_t)0xcc17063fbe7b643aU, (uint64_t)0x7872e1c846085760U,
+    (uint64_t)0x86b0fffbb4214c9eU, (uint64_t)0xb18bbc0e72bf3638U, (uint64_t)0x8b17de0c722591c9U,
+    (uint64_t)0x1edeab1948c29e0cU, (uint64_t)0x9fbfd98ef4304f20U, (uint64_t)0x2d1dbb6b9c77ffb6U,
+    (uint64_t)0xf53f2c658ead09f7U, (uint64_t)0x1335e1d59780d14dU, (uint64_t)0x69cc20e0cd1b66bcU,
+    (uint64_t)0x9b670a37bbe0bfc8U, (uint64_t)0xce53dc8128efbeedU, (uint64_t)0xc74e77c8326a6e5U,
+    (uint64_t)0x3604e0d2b88e9a63U, (uint64_t)0xbab38fca13dc2248U, (uint64_t)0x255616d3c7141771U,
+    (uint64_t)0xa86691ab2f226b66U, (uint64_t)0xda19fea4b3ca63a9U, (uint64_t)0xfc05dc42ae672f2bU,
+    (uint64_t)0xa9c6e786718ba28fU, (uint64_t)0x7b7995b9c66b984U, (uint64_t)0xf434f551b3702f2U,
+    (uint64_t)0xd6f6212fda84eeffU, (uint64_t)0x8ed6e8c85c0a3f1eU, (uint64_t)0xbcad24927c87c37fU,
+    (uint64_t)0xfdfb62bb9ee3b78dU, (uint64_t)0xeba8e477cbceba46U, (uint64_t)0x37d38cb0eeaede4bU,
+    (uint64_t)0xbc498e87976deb6U, (uint64_t)0xb2944c046b6147fbU, (uint64_t)0x8b123f35f71f9609U,
+    (uint64_t)0x4b0e7987b5b41d78U, (uint64_t)0xea7df9074bf0c4f8U, (uint64_t)0xb4d03560fab80ecdU,
+    (uint64_t)0x6cf306f6fb1db7e5U, (uint64_t)0xd59fb5689fd4773U, (uint64_t)0xab254f4000f9be33U,
+    (uint64_t)0x18a09a9277352da4U, (uint64_t)0xf81862f5641ea3efU, (uint64_t)0xa155dcc7de79dc24U,
+    (uint64_t)0xf1168a32558f69cdU, (uint64_t)0xbac215950d1850dfU, (uint64_t)0x15c8295bb204c848U,
+    (uint64_t)0xf661aa367d8184ffU, (uint64_t)0xc396228e30447bdbU, (uint64_t)0x11cd5143bde4a59eU,
+    (uint64_t)0xe3a26e3b6beab5e6U, (uint64_t)0xb59b01579f759d01U, (uint64_t)0xa2923d2f7eae4fdeU,
+    (uint64_t)0x18327757690ba8c0U, (uint64_t)0x4bf7e38b44f51443U, (uint64_t)0xb6812563b413fc26U,
+    (uint64_t)0xedb7d36379e53b36U, (uint64_t)0x4fa585c4c389f66dU, (uint64_t)0x8e1adc3154bd3416U,
+    (uint64_t)0x263a2cfb9db3b381U, (uint64_t)0x9c3a2deed4df0a4bU, (uint64_t)0x728d06e97d04e61fU,
+    (uint64_t)0x8b1adfbc42449325U, (uint64_t)0x6ec1d9397e053a1bU, (uint64_t)0xee2be5c766daf707U,
+    (uint64_t)0x80ba1e14810ac7abU, (uint64_t)0xdd2ae778f530f174U, (uint64_t)0x435d97a205b9d8bU,
+    (uint64_t)0x6eb8f064056756d4U, (uint64_t)0xd5e88a8bb6f8210eU, (uint64_t)0x70ef12dec9fd9eaU,
+    (uint64_t)0x4d8495053bcc876aU, (uint64_t)0x12a75338a7404ce3U, (uint64_t)0xd22b49e1b8a1db5eU,
+    (uint64_t)0xec1f205114bfa5adU, (uint64_t)0xadbaeb79b6828f36U, (uint64_t)0x9d7a025801bd5b9eU,
+    (uint64_t)0xeda01e0d1e844b0cU, (uint64_t)0x4b625175887edfc9U, (uint64_t)0x14109fdd9669b621U,
+    (uint64_t)0x88a2ca56f6f87b98U, (uint64_t)0xfe2eb788170df6bcU, (uint64_t)0xcea06f4ffa473f9U,
+    (uint64_t)0x43ed81b5c4e83d33U, (uint64_t)0xd9f358795efd488bU, (uint64_t)0x164a620f9deb4d0fU,
+    (uint64_t)0xc6927bdbac6a7394U, (uint64_t)0x45c28df79f9e0f03U, (uint64_t)0x2868661efcd7e1a9U,
+    (uint64_t)0x7cf4e8d0ffa348f1U, (uint64_t)0x6bd4c284398538e0U, (uint64_t)0x2618a091289a8619U,
+    (uint64_t)0xef796e606671b173U, (uint64_t)0x664e46e59090c632U, (uint64_t)0xa38062d41e66f8fbU,
+    (uint64_t)0x6c744a200573274eU, (uint64_t)0xd07b67e4a9271394U, (uint64_t)0x391223b26bdc0e20U,
+    (uint64_t)0xbe2d93f1eb0a05a7U, (uint64_t)0xf23e2e533f36d141U, (uint64_t)0xe84bb3d44dfca442U,
+    (uint64_t)0xb804a48d6b7c023aU, (uint64_t)0x1e16a8fa76431c3bU, (uint64_t)0x1b5452adddd472e0U,
+    (uint64_t)0x7d405ee70d1ee127U, (uint64_t)0x50fc6f1dffa27599U, (uint64_t)0x351ac53cbf391b35U,
+    (uint64_t)0x7efa14b84444896bU, (uint64_t)0x64974d2ff94027fbU, (uint64_t)0xefdcd0e8de84487dU,
+    (uint64_t)0x8c45b2602b48989bU, (uint64_t)0xa8fcbbc2d8463487U, (uint64_t)0xd1b2b3f73fbc476cU,
+    (uint64_t)0x21d005b7c8f443c0U, (uint64_t)0x518f2e6740c0139cU, (uint64_t)0x56036e8c06d75fc1U,
+    (uint64_t)0x2dcf7bb73249a89fU, (uint64_t)0x81dd1d3de245e7ddU, (uint64_t)0xf578dc4bebd6e2a7U,
+    (uint64_t)0x4c028903df2ce7a0U, (uint64_t)0xaee362889c39afacU, (uint64_t)0xdc847c31146404abU,
+    (uint64_t)0x6304c0d8a4e97818U, (uint64_t)0xae51dca2a91f6791U, (uint64_t)0x2abe41909baa9efcU,
+    (uint64_t)0xd9d2e2f4559c7ac1U, (uint64_t)0xe82f4b51fc9f773aU, (uint64_t)0xa77130274073e81cU,
+    (uint64_t)0xc0276facfbb596fcU, (uint64_t)0x1d819fc9a684f70cU, (uint64_t)0x29b47fddc9f7b1e0U,
+    (uint64_t)0x358de103459b1940U, (uint64_t)0xec881c595b013e93U, (uint64_t)0x51574c9349532ad3U,
+    (uint64_t)0x2db1d445b37b46deU, (uint64_t)0xc6445b87df239fd8U, (uint64_t)0xc718af75151d24eeU,
+    (uint64_t)0xaea1c4a4f43c6259U, (uint64_t)0x40c0e5d770be02f7U, (uint64_t)0x6a4590f4721b33f2U,
+    (uint64_t)0x2124f1fbfedf04eaU, (uint64_t)0xf8e53cde9745efe7U, (uint64_t)0xe7e1043265f046d9U,
+    (uint64_t)0xc3fca28ee4d0c7e6U, (uint64_t)0x847e339a87253b1bU, (uint64_t)0x9b5953483743e643U,
+    (uint64_t)0xcb6a0a0b4fd12fc5U, (uint64_t)0xfb6836c327d02dccU, (uint64_t)0x5ad009827a68bcc2U,
+    (uint64_t)0x1b24b44c005e912dU, (uint64_t)0xcc83d20f811fdcfeU, (uint64_t)0x36527ec1666fba0cU,
+    (uint64_t)0x6994819714754635U, (uint64_t)0xfcdcb1a8556da9c2U, (uint64_t)0xa593426781a732b2U,
+    (uint64_t)0xec1214eda714181dU, (uint64_t)0x609ac13b6067b341U, (uint64_t)0xff4b4c97a545df1fU,
+    (uint64_t)0xa124050134d2076bU, (uint64_t)0x6efa0c231409ca97U, (uint64_t)0x254cc1a820638c43U,
+    (uint64_t)0xd4e363afdcfb46cdU, (uint64_t)0x62c2adc303942a27U, (uint64_t)0xc67b9df056e46483U,
+    (uint64_t)0xa55abb2063736356U, (uint64_t)0xab93c098c551bc52U, (uint64_t)0x382b49f9b15fe64bU,
+    (uint64_t)0x9ec221ad4dff8d47U, (uint64_t)0x79caf615437df4d6U, (uint64_t)0x5f13dc64bb456509U,
+    (uint64_t)0xe4c589d9191f0714U, (uint64_t)0x27b6a8ab3fd40e09U, (uint64_t)0xe455842e77313ea9U,
+    (uint64_t)0x8b51d1e21f55988bU, (uint64_t)0x5716dd73062bbbfcU, (uint64_t)0x633c11e54e8bf3deU,
+    (uint64_t)0x9a0e77b61b85be3bU, (uint64_t)0x565107290911cca6U, (uint64_t)0x27e76495efa6590fU,
+    (uint64_t)0xb81d783e979f3925U, (uint64_t)0x1efd130aaf4c89a7U, (uint64_t)0x525c2144fd1bf7faU,
+    (uint64_t)0x4b2969041b265a9eU, (uint64_t)0xed8e9634b9db65b6U, (uint64_t)0x35c82e3203599d8aU,
+    (uint64_t)0xdaa7a54f403563f3U, (uint64_t)0x9df088ad022c38abU, (uint64_t)0x8d084f124237b64bU,
+    (uint64_t)0x688ebe99e3ecfd07U, (uint64_t)0x57b8a70cf6845dd8U, (uint64_t)0x808fc59c5da4a325U,
+    (uint64_t)0xa9032b2ba3585862U, (uint64_t)0xb66825d5edf29386U, (uint64_t)0xb5a5a8db431ec29bU,
+    (uint64_t)0xbb143a983a1e8dc8U, (uint64_t)0x9e93ba24f111661eU, (uint64_t)0xedced484b105eb04U,
+    (uint64_t)0x96dc9ba1f424b578U, (uint64_t)0xbf8f66b7e83e9069U, (uint64_t)0x872d4df4d7ed8216U,
+    (uint64_t)0xbf07f3778e2cbecfU, (uint64_t)0x4281d89998e73754U, (uint64_t)0xfec85fbb8aab8708U,
+    (uint64_t)0x13b5bf22765fa7d0U, (uint64_t)0x59805bf01d6a5370U, (uint64_t)0x67a5e29d4280db98U,
+    (uint64_t)0x4f53916f776b1ce3U, (uint64_t)0x714ff61f33ddf626U, (uint64_t)0x4206238ea085d103U,
+    (uint64_t)0x1c50d4b7e5809ee3U, (uint64_t)0x999f450d85f8eb1dU, (uint64_t)0x82eebe731a3a93bcU,
+    (uint64_t)0x42bbf465a21adc1aU, (uint64_t)0xc10b6fa4ef030efdU, (uint64_t)0x247aa4c787b097bbU,
+    (uint64_t)0x8b8dc632f60c77daU, (uint64_t)0x6ffbc26ac223523eU, (uint64_t)0xa4f6ff11344579cfU,
+    (uint64_t)0x5825653c980250f6U, (uint64_t)0x4bf367ba4a493b31U, (uint64_t)0x54f20a529bf7f026U,
+    (uint64_t)0xb696e0629795914bU, (uint64_t)0xcddab96d8bf236acU, (uint64_t)0x4ff2c70aed25ea13U,
+    (uint64_t)0xfa1d09eb81cbbbe7U, (uint64_t)0x88fc8c87468544c5U, (uint64_t)0x847a670d696b3317U,
+    (uint64_t)0xeda6c595d314e7bcU, (uint64_t)0x2ee7464b467899edU, (uint64_t)0x1cef423c0a1ed5d3U,
+    (uint64_t)0x217e76ea69cc7613U, (uint64_t)0x27ccce1fe7cda917U, (uint64_t)0x12d8016b8a893f16U,
+    (uint64_t)0xbcd6de849fc74f6bU, (uint64_t)0xfa5817e2f3144e61U, (uint64_t)0xb79d4cc5ac751e7bU,
+    (uint64_t)0x93f96472fd4211bdU, (uint64_t)0x8c72d3d2c8de4fc6U, (uint64_t)0x7b69cbf5df44f064U,
+    (uint64_t)0x3da90ca2f4bf94e1U, (uint64_t)0x1a5325f8f12894e2U, (uint64_t)0xa437f6c7917d60bU,
+    (uint64_t)0x9be7048696c9cb5dU, (uint64_t)0xc0b48d4e49ccd6d7U, (uint64_t)0xff8fb02c88bd5580U,
+    (uint64_t)0xc75235e907d473b2U, (uint64_t)0x4fab1ac5a2188af3U, (uint64_t)0x30fa3bc97576ec0U,
+    (uint64_t)0xe8c946e80b7e7d2fU, (uint64_t)0x40a5c9cc70305600U, (uint64_t)0x6d8260a9c8b013b4U,
+    (uint64_t)0xe6c51073615cd9e4U, (uint64_t)0x498ec047f1243c06U, (uint64_t)0x3e5a8809b17b3d8cU,
+    (uint64_t)0x5cd99e610cc565f1U, (uint64_t)0x81e312df7851dafeU, (uint64_t)0xf156f5baa79061e2U,
+    (uint64_t)0x80d62b71880c590eU, (uint64_t)0xbec9746f0a39faa1U, (uint64_t)0x2b09d2c3cfdcf7ddU,
+    (uint64_t)0x41a9fce3723fcab4U, (uint64_t)0x73d905f707f57ca3U, (uint64_t)0x80f9fb1ac8e1555U,
+    (uint64_t)0x7c088e849ba7a531U, (uint64_t)0x7d35586ed9a147fU, (uint64_t)0x602846abaf48c336U,
+    (uint64_t)0x7320fd320ccf0e79U, (uint64_t)0x1ecc8cb9d3210a04U, (uint64_t)0x6bc7d463dafb5269U,
+    (uint64_t)0x3e59b10a67c3489fU, (uint64_t)0x1769788c65641e1bU, (uint64_t)0x8a53b82dbd6cb838U,
+    (uint64_t)0x7066d6e6236d5f22U, (uint64_t)0x3aa1c616908536eU, (uint64_t)0xc971da0d66ae9809U,
+    (uint64_t)0x92eb40907f8f875dU, (uint64_t)0x9c9d754e56c26bbfU, (uint64_t)0x158cea618110bbe7U,
+    (uint64_t)0x62a6b802745f91eaU, (uint64_t)0xa79c41aac6e7394bU, (uint64_t)0x445b6a83ad57ef10U,
+    (uint64_t)0xc5277eb6ea6f40cU, (uint64_t)0x319fe96b88633365U, (uint64_t)0xcbcde2393191f4fdU,
+    (uint64_t)0x43093e16d3d6ada1U, (uint64_t)0x184579f358769606U, (uint64_t)0x2c94a8b3d236625cU,
+    (uint64_t)0x6922b9c05c437d8eU, (uint64_t)0x3d4ae423d8d9f3c8U, (uint64_t)0xf72c31c12e7090a2U,
+    (uint64_t)0x4ac3f5f3d76a55bdU, (uint64_t)0x77f84203d39b8c34U, (uint64_t)0xed8b1be63125eddbU,
+    (uint64_t)0x5bbf2441f6e39dc5U, (uint64_t)0xb00f6ee66a5d678aU, (uint64_t)0xba456ecf57d0ea99U,
+    (uint64_t)0xdcae0f5817e06c43U, (uint64_t)0x1643de40f5b4baaU, (uint64_t)0x2c324341d161b9beU,
+    (uint64_t)0xf3b7963f4c830320U, (uint64_t)0x842c7aa0903203e3U, (uint64_t)0xaf22ca0ae7327afbU,
+    (uint64_t)0x38e13092967609b6U, (uint64_t)0x73b8fb62757558f1U, (uint64_t)0x3cc3e831f7eca8c1U,
+    (uint64_t)0xe4174474f6331627U, (uint64_t)0xa77989cac3c40234U, (uint64_t)0xae8317f4b0166f7aU,
+    (uint64_t)0xfbd3e3f7ceec74e6U, (uint64_t)0xfdb516ace0874bfdU, (uint64_t)0x3d846019c681f3a3U,
+    (uint64_t)0xb12ee5c7c1620b0U, (uint64_t)0xba68b4dd2b63c501U, (uint64_t)0xac03cd326668c51eU,
+    (uint64_t)0x2a6279f74e0bcb5bU, (uint64_t)0xb32cb8b0b796d219U, (uint64_t)0xc3e95f4f34741dd9U,
+    (uint64_t)0x8721212568edf6f5U, (uint64_t)0x7a03aee4a2b9cb8eU, (uint64_t)0xcd3c376f53a89aaU,
+    (uint64_t)0xd8af9b1948a28dcU, (uint64_t)0xcf86a3f4902ab04fU, (uint64_t)0x8aacb62a7f42002dU,
+    (uint64_t)0xfd8e139f8f5fcda8U, (uint64_t)0xf3e558c4bdee5bfdU, (uint64_t)0xd76cbaf4e33f9f77U,
+    (uint64_t)0x3a4c97a471771969U, (uint64_t)0xda27e84bf6dce6a7U, (uint64_t)0xff373d9613e6c2d1U,
+    (uint64_t)0xf115193cd759a6e9U, (uint64_t)0x3f9b702563d2262cU, (uint64_t)0x9cb0ae6c252bd479U,
+    (uint64_t)0x5e0f88a12b5848fU, (uint64_t)0x78f6d2b2a5c97663U, (uint64_t)0x6f6e149bc162225cU,
+    (uint64_t)0xe602235cde601a89U, (uint64_t)0xd17bbe98f373be1fU, (uint64_t)0xcaf49a5ba8471827U,
+    (uint64_t)0x7e1a0a8518aaa116U, (uint64_t)0x12536fea87baa627U, (uint64_t)0x58c1fec1f72aa680U,
+    (uint64_t)0x6c29b637601e5dc9U, (uint64_t)0x9e3c3c1cde9e01b9U, (uint64_t)0xefc8127b2bcfe0b0U,
+    (uint64_t)0x351071022a12f50dU, (uint64_t)0x6ccd6cb14879b397U, (uint64_t)0xf792f804f8a82f21U,
+    (uint64_t)0x8b1e572235e6fc06U, (uint64_t)0x3477728f0b3e13d5U, (uint64_t)0x150c294daa8a7372U,
+    (uint64_t)0xc0291d433bfa528aU, (uint64_t)0xc6c8bc67cec5a196U, (uint64_t)0xdeeb31e45c2e8a7cU,
+    (uint64_t)0xba93e244fb6e1c51U, (uint64_t)0xb9f8b71b2e28e156U, (uint64_t)0x8c3184911a335cc8U,
+    (uint64_t)0x563459ba6a5913e4U, (uint64_t)0x1b920d61c7b32919U, (uint64_t)0x805ab8b6a02425adU,
+    (uint64_t)0x2ac512da8d006086U, (uint64_t)0x6ca4846abcf5c0fdU, (uint64_t)0xafea51d8ac2138d7U,
+    (uint64_t)0xcb647545344cd443U, (uint64_t)0x343ac0a3ee9523f0U, (uint64_t)0xbb75eab2975ea978U,
+    (uint64_t)0x1bccf332107387f4U, (uint64_t)0x790f92599ab0062eU, (uint64_t)0xf1a363ad1e4f6a5fU,
+    (uint64_t)0x6e08b8462519a50U, (uint64_t)0x609151877265f1eeU, (uint64_t)0x6a80ca3493ae985eU,
+    (uint64_t)0xa3f4f521e447f2c4U, (uint64_t)0x81b8da7a604291f0U, (uint64_t)0xd680bc467d5926deU,
+    (uint64_t)0x84f21fd534a1202fU, (uint64_t)0x1d1e31814e9df3d8U, (uint64_t)0x1ca4861a39ab8d34U,
+    (uint64_t)0x809ddeec5b19aa4aU, (uint64_t)0x59f72f7e4d329366U, (uint64_t)0x2dfb9e08be0f4492U,
+    (uint64_t)0x3ff0da03e9d5e517U, (uint64_t)0x3dbe9a1f79466a8U, (uint64_t)0xb87bcd015ea9932U,
+    (uint64_t)0xeb64fc83ab1f58abU, (uint64_t)0x6d9598da817edc8aU, (uint64_t)0x699cff661d3b67e5U,
+    (uint64_t)0x645c0f2992635853U, (uint64_t)0x9f1b2466cdedca85U, (uint64_t)0x140bb7101a09538cU,
+    (uint64_t)0xac8ae8515e11115dU, (uint64_t)0xd63ff676f03f59eU, (uint64_t)0x755e55517d234afbU,
+    (uint64_t)0x61c2db4e7e208fc1U, (uint64_t)0xaa9859cef28a4b5dU, (uint64_t)0xbdd6d4fc34af030fU,
+    (uint64_t)0xd50e57c7d7fe71f3U, (uint64_t)0x15342190bc97ce38U, (uint64_t)0x51bda2de4df07b63U,
+    (uint64_t)0xba12aeae200eb87dU, (uint64_t)0xabe135d2a9b4f8f6U, (uint64_t)0x4619d65fad6d99cU,
+    (uint64_t)0x4a6683a77994937cU, (uint64_t)0x7a778c8b6f94f09aU, (uint64_t)0x3f39e67f906151e5U,
+    (uint64_t)0xcea27f5f55e10649U, (uint64_t)0xdca1d4e1c17cf7b7U, (uint64_t)0xc326d122fe2362dU,
+    (uint64_t)0x5f7ac337dd35df3U, (uint64_t)0xc3b7639c396dbdfU, (uint64_t)0x912f5ac03b7db1cU,
+    (uint64_t)0x9dea4b705c9ed4a9U, (uint64_t)0x8dd1fb83425c6559U, (uint64_t)0x7fc00ee60af06fdaU,
+    (uint64_t)0xe98c922533d956dfU, (uint64_t)0xf1ef3354fbdc8a2U, (uint64_t)0x2abb5145b79b8ea2U,
+    (uint64_t)0x40fd2945bdbff288U, (uint64_t)0x6a814ac4d7185db7U, (uint64_t)0xc4329d6fc084609aU,
+    (uint64_t)0x56f8410ef4f8b16aU, (uint64_t)0x97241afec47b266aU, (uint64_t)0xa406b8e6d9c87c1U,
+    (uint64_t)0x803f3e02cd42ab1bU, (uint64_t)0x7f0309a804dbec69U, (uint64_t)0xa83b85f73bbad05fU,
+    (uint64_t)0xc6097273ad8e197fU, (uint64_t)0xc097440e5067adc1U, (uint64_t)0x3f747fa0b311898cU,
+    (uint64_t)0xe2a272e4cd0eac65U, (uint64_t)0x4bba5851f914d0bcU, (uint64_t)0x7a1a9660c4a43ee3U,
+    (uint64_t)0xe5a367cea1c8cde9U, (uint64_t)0x9d958ba97271abe3U, (uint64_t)0xf3ff7eb63d1615cdU,
+    (uint64_t)0xa2280dcef5ae20b0U, (uint64_t)0x266344a43794f8dcU, (uint64_t)0xdcca923a483c5c36U,
+    (uint64_t)0x2d6b6bbf3f9d10a0U, (uint64_t)0xb320c5ca81d9bdf3U, (uint64_t)0x620e28ff47b50a95U,
+    (uint64_t)0x933e3b01cef03371U, (uint64_t)0xf081bf8599100153U, (uint64_t)0x183be9a0c3a8c8d6U,
+    (uint64_t)0xb6c185c341dca566U, (uint64_t)0x7de7fedad8622aa3U, (uint64_t)0x99e84d92901b6dfbU,
+    (uint64_t)0x30a02b0e7c4ad288U, (uint64_t)0xc7c81daa2fd3cf36U, (uint64_t)0xd1319547df89e59fU,
+    (uint64_t)0xb2be8184cd496733U, (uint64_t)0xd5f449eb93d3412bU, (uint64_t)0x25470fabe085116bU,
+    (uint64_t)0x4a4337587285310U, (uint64_t)0x4e39187ee2bfd52fU, (uint64_t)0x36166b447d9ebc74U,
+    (uint64_t)0x92ad433cfd4b322cU, (uint64_t)0x726aa817ba79ab51U, (uint64_t)0xf96eacd8c1db15ebU,
+    (uint64_t)0xfaf71e910476be63U, (uint64_t)0xd74e9bdac97e6516U, (uint64_t)0x88779360c230f49eU,
+    (uint64_t)0xa6ec1de31e74ea49U, (uint64_t)0x581dcee53fb645a2U, (uint64_t)0xbaef23918f483f14U,
+    (uint64_t)0x6d2dddfcd137d13bU, (uint64_t)0x54cde50ed2743a42U, (uint64_t)0x89a34fc5e4d97e67U,
+    (uint64_t)0x72cfd2e949dee168U, (uint64_t)0x1ae052233e2af239U, (uint64_t)0x9e75be1d94066aU,
+    (uint64_t)0x6cca31c738abf413U, (uint64_t)0xb50bd61d9bc49908U, (uint64_t)0x4a9b4a8cf5e2bc1eU,
+    (uint64_t)0xeb6cc5f7946f83acU, (uint64_t)0x27da93fcebffab28U, (uint64_t)0xc492ec644cd8f64cU,
+    (uint64_t)0x58a2d790279d7b51U, (uint64_t)0xced1fc51fc75256U, (uint64_t)0x3e658aed8f433017U,
+    (uint64_t)0xb61942e05da59ebU, (uint64_t)0xba3d60a30ddc3722U, (uint64_t)0x7c311cd1742e7f87U,
+    (uint64_t)0x6473ffeef6b01b6eU, (uint64_t)0x3ce519ef76257c51U, (uint64_t)0x6f5818d318d477e7U,
+    (uint64_t)0xab022e037963edc0U, (uint64_t)0xf0403a898bd1f5f3U, (uint64_t)0xe43b8da0496033caU,
+    (uint64_t)0x994e10ea1cfdd72U, (uint64_t)0xb1ec6d20ba73c0e2U, (uint64_t)0x329c9ecb6bcfad1U,
+    (uint64_t)0xf1ff42a12c84bd9dU, (uint64_t)0x751f3ec4390c674aU, (uint64_t)0x27bb36f701e5e0caU,
+    (uint64_t)0x65dfff515caf6692U, (uint64_t)0x5df579c4cd7bbd3fU, (uint64_t)0xef8fb29785591205U,
+    (uint64_t)0x1ded7203e47ac732U, (uint64_t)0xa93dc45ccd1c331aU, (uint64_t)0xbdec338e3318d2d4U,
+    (uint64_t)0x733dd7bbbe8de963U, (uint64_t)0x61bcc3baa2c47ebdU, (uint64_t)0xa821ad1935efcbdeU,
+    (uint64_t)0x91ac668c024cdd5cU, (uint64_t)0x7ba558e4c1cdfa49U, (uint64_t)0x491d4ce0908fb4daU,
+    (uint64_t)0x7ba869f9f685bde8U, (uint64_t)0x7b2a0bcb81f41c78U, (uint64_t)0x5c522c851fd240e1U,
+    (uint64_t)0xce512e68df5ce3f6U, (uint64_t)0xa7d4b952b6d5ee13U, (uint64_t)0x8cdc0a8b31ad7eafU,
+    (uint64_t)0x165e86751b915e20U, (uint64_t)0x8e8c269b5d6477f4U, (uint64_t)0xd28d5ade44421b91U,
+    (uint64_t)0xed1b5ec279f464baU, (uint64_t)0x2d65e42c47d72e26U, (uint64_t)0x8198e5749e67f926U,
+    (uint64_t)0x4106673834747e44U, (uint64_t)0x4637acc1e37e5447U, (uint64_t)0x2cbc9ecf3e15822U,
+    (uint64_t)0x58a8e98e805aa83cU, (uint64_t)0x73facd6e5595e800U, (uint64_t)0x197cfdb332a92318U,
+    (uint64_t)0x9ebea84125ac87b6U, (uint64_t)0x4cd805f7a3510c7aU, (uint64_t)0x24df999ae06e428eU,
+    (uint64_t)0xd54dd5dc4d71459cU, (uint64_t)0x1484324f20b8a03cU, (uint64_t)0x7924f2d93174b927U,
+    (uint64_t)0x42b8acbff93ade50U, (uint64_t)0x468ff80338330507U, (uint64_t)0x6f34ddf4037a53eU,
+    (uint64_t)0x70cd1a408d6993a4U, (uint64_t)0xf85a159743e5c022U, (uint64_t)0x396fc9c2c125a67dU,
+    (uint64_t)0x3b7bebf1064bfcbU, (uint64_t)0x7c444592a9806dcbU, (uint64_t)0x1b02614b4487cd54U,
+    (uint64_t)0x25914f7881fdad90U, (uint64_t)0xcf638f560d2cf6abU, (uint64_t)0xb90bc03fcc054de5U,
+    (uint64_t)0x932811a718b06350U, (uint64_t)0x2f00b3309bbd11ffU, (uint64_t)0x76108a6fb4044974U,
+    (uint64_t)0x801bb9e0a851d266U, (uint64_t)0xdd099bebf8990c1U, (uint64_t)0x14c6dd8a58d6cd46U,
+    (uint64_t)0x9cb633b58e6634d2U, (uint64_t)0xc1305047f81bc328U, (uint64_t)0x12ede0e226a177e5U,
+    (uint64_t)0x332cca62065a6f4fU, (uint64_t)0xc3a47ecd67be487bU, (uint64_t)0x741eb1870f47ed1cU,
+    (uint64_t)0x99e66e58e7598b14U, (uint64_t)0xebd6a6777b0ac93dU, (uint64_t)0xa6e37b0d78f5e0d7U,
+    (uint64_t)0x2516c09676f5492bU, (uint64_t)0x1e4bf8889ac05f3aU, (uint64_t)0xcdb42ce04df0ba2bU,
+    (uint64_t)0x935d5cfd5062341bU, (uint64_t)0x8a30333382acac20U, (uint64_t)0x429438c45198b00eU,
+    (uint64_t)0xfb2838be67e573e0U, (uint64_t)0x5891db94084c44bU, (uint64_t)0x9131137396c1c2c5U,
+    (uint64_t)0x6aebfa3fd958444bU, (uint64_t)0xac9cdce9e56e55c1U, (uint64_t)0x7148ced32caa46d0U,
+    (uint64_t)0x2e10c7efb61fe8ebU, (uint64_t)0x9fd835daff97cf4dU, (uint64_t)0x6c626f56c1770616U,
+    (uint64_t)0x5351909e09da9a2dU, (uint64_t)0xe58e6825a3730e45U, (uint64_t)0x9d8c8bc003ef0a79U,
+    (uint64_t)0x543f78b6056becfdU, (uint64_t)0x33f13253a090b36dU, (uint64_t)0x82ad4997794432f9U,
+    (uint64_t)0x1386493c4721f502U, (uint64_t)0x3794eefa5abea82aU, (uint64_t)0x8dc611b993fe62d4U,
+    (uint64_t)0x69f1af37281ef606U, (uint64_t)0x6af546c839839e69U, (uint64_t)0x625578c7c977ec23U,
+    (uint64_t)0xa8de294cbd5c0576U, (uint64_t)0xe2ddaf0f7cd1a4c0U, (uint64_t)0x8243fc704f95f4d4U,
+    (uint64_t)0xe566f400b008733aU, (uint64_t)0xcba0697d512e1f57U, (uint64_t)0x9537c2b240509cd0U,
+    (uint64_t)0x5f989c6957353d8cU, (uint64_t)0x7dbec9724c3c2b2fU, (uint64_t)0x90e02fa8ff031fa8U,
+    (uint64_t)0xf4d15c53cfd5d11fU, (uint64_t)0xb3404fae48314dfcU, (uint64_t)0xa36da109081e9387U,
+    (uint64_t)0xfb9780d78c935828U, (uint64_t)0xd5940332e540b015U, (uint64_t)0xc9d7b51be0f466faU,
+    (uint64_t)0xfaadcd41d6d9f671U, (uint64_t)0xba6c1e28b1a2ac17U, (uint64_t)0x66a7833ed201e5fU,
+    (uint64_t)0x19d99719f90f462bU, (uint64_t)0xf02cc3a9f327a07fU, (uint64_t)0xefb27a9b4490937dU,
+    (uint64_t)0x81451e96b1b3afa5U, (uint64_t)0x67e24de891883be4U, (uint64_t)0x1ad65d4770869e54U,
+    (uint64_t)0xd36291a464a3856aU, (uint64_t)0x70a1abf7132e880U, (uint64_t)0x9511d0a30e28dfdfU,
+    (uint64_t)0xfdeed650f8d1cac4U, (uint64_t)0xeb99194b6d16bda5U, (uint64_t)0xb53b19f71cabbe46U,
+    (uint64_t)0x5f45af5039b9276cU, (uint64_t)0xd0784c6126ee9d77U, (uint64_t)0xf7a1558b0c02ca5dU,
+    (uint64_t)0xb61d6c59f032e720U, (uint64_t)0xae3ffb95470cf3f7U, (uint64_t)0x9b185facc72a4be5U,
+    (uint64_t)0xf66de2364d848089U, (uint64_t)0xba14d07c717afea9U, (uint64_t)0x25bfbfc02d551c1cU,
+    (uint64_t)0x2cef0ecd4cdf3d88U, (uint64_t)0x8cee2aa3647f73c4U, (uint64_t)0xc10a7d3d722d67f7U,
+    (uint64_t)0x90037a294564a21U, (uint64_t)0xe6567987fa9ced27U, (uint64_t)0x36b2d8842a9e5dbcU,
+    (uint64_t)0xf4bdeec6380d8e8cU, (uint64_t)0xb5e6a6b0dbc300d0U, (uint64_t)0x7ba7e9b9592bef36U,
+    (uint64_t)0x2b373c4fee81b749U, (uint64_t)0x484b5e01f0ce596bU, (uint64_t)0x7cc51c62c0bf54ccU,
+    (uint64_t)0x6ac07bb84f3815c4U, (uint64_t)0xddb9f6241aa9017eU, (uint64_t)0x31e30228ca85720aU,
+    (uint64_t)0xe59d63f57cb75838U, (uint64_t)0x69e18e777baad2d0U, (uint64_t)0x2cfdb784d42f5d73U,
+    (uint64_t)0x25dd53df5774983U, (uint64_t)0x2f80e7cee042cd52U, (uint64_t)0x4bf56bafec695bb0U,
+    (uint64_t)0x22da1ca8f13c78adU, (uint64_t)0xf9c4b131182abb0U, (uint64_t)0x2ea555aae7d249eU,
+    (uint64_t)0x868583f25e05d9e3U, (uint64_t)0xe09cdcdf70382afaU, (uint64_t)0xdf072ec787080408U,
+    (uint64_t)0xa317847cbf75658U, (uint64_t)0x43f18d7f4d6ee4abU, (uint64_t)0xd3ac8cde9570c3dcU,
+    (uint64_t)0x527e49070b8c9b2aU, (uint64_t)0x716709a7c5a4c0f1U, (uint64_t)0x930852b0916a26b1U,
+    (uint64_t)0x3cc17fcf4e071177U, (uint64_t)0x34f5e3d459694868U, (uint64_t)0xee0341aba28f655dU,
+    (uint64_t)0x75d9bc15adf7cccfU, (uint64_t)0x81a3e5d6dfa1e1b0U, (uint64_t)0x8c39e444249bc17eU,
+    (uint64_t)0xf37dccb28ea7fd43U, (uint64_t)0xda654873907fba12U, (uint64_t)0x35daa6da4a372904U,
+    (uint64_t)0x564cfc66283a6c5U, (uint64_t)0xd09fa4f64a9395bfU, (uint64_t)0x832d7080eb6b242dU,
+    (uint64_t)0xd30bd0233b71e246U, (uint64_t)0x7027991bbe31139dU, (uint64_t)0x68797e91462e4e53U,
+    (uint64_t)0x423fe20a6b4e185aU, (uint64_t)0x82f2c67e42d9b707U, (uint64_t)0x25c817684cf7811bU,
+    (uint64_t)0xbd53005e045bb95dU, (uint64_t)0xc51aa29e5cfe5c48U, (uint64_t)0x82c020ae815ee096U,
+    (uint64_t)0x7848ad827549a68aU, (uint64_t)0x7933d48960471355U, (uint64_t)0x4998d2e67c51e57U,
+    (uint64_t)0xf64020ad9944afcU, (uint64_t)0x7a299fe1a7fadac6U, (uint64_t)0x40c73ff45aefe92cU,
+    (uint64_t)0xe5f649be9d8e68fdU, (uint64_t)0xdb0f05331b044320U, (uint64_t)0xf6fde9b3e0c33398U,
+    (uint64_t)0x92f4209b66c8cfaeU, (uint64_t)0xe9d1afcc1a739d4bU, (uint64_t)0x9aea75fa28ab8deU,
+    (uint64_t)0x14375fb5eac6f1d0U, (uint64_t)0x6420b560708f7aa5U, (uint64_t)0xbf44ffc75488771aU,
+    (uint64_t)0xcb76e3f17f2f2191U, (uint64_t)0x4197bde394f86a42U, (uint64_t)0x45c25bb970641d9aU,
+    (uint64_t)0xd8a29e31f88ce6dcU, (uint64_t)0xbe2becfd4bb7ac7dU, (uint64_t)0x13094214b5670cc7U,
+    (uint64_t)0xe90a8fd560af8433U, (uint64_t)0x2d1afd5696f37750U, (uint64_t)0x25dda55791507ff2U,
+    (uint64_t)0x2b95fd4c006543edU, (uint64_t)0xf3c778d9a23c3911U, (uint64_t)0x84ccf4463b04938dU,
+    (uint64_t)0x3d9dded67eef947bU, (uint64_t)0xbed83735dae325b5U, (uint64_t)0x5ba0f75cf921455dU,
+    (uint64_t)0xecf9b8b4ebd3f02U, (uint64_t)0xa47acd9d86b770eaU, (uint64_t)0x93b84a6a2da213ceU,
+    (uint64_t)0xd760871b53e7c8cfU, (uint64_t)0x7a5f58e536e530d7U, (uint64_t)0x7abc52a51912ad51U,
+    (uint64_t)0x7ad43db02ea0252aU, (uint64_t)0x498b00ecc176b742U, (uint64_t)0x9eae499c6254dc41U,
+    (uint64_t)0x7e2939247a837e7eU, (uint64_t)0x74aec08c090524a7U, (uint64_t)0xf82b92198d6f55f2U,
+    (uint64_t)0x493c962e1402cec5U, (uint64_t)0x9f17ca17fa2f30e7U, (uint64_t)0xbcd783e8e9b879cbU,
+    (uint64_t)0xea3d8c145a6f145fU, (uint64_t)0x9ff713ef888ae17fU, (uint64_t)0x6007f68fb34b7bebU,
+    (uint64_t)0x5d2b18983b653d64U, (uint64_t)0xcbf73e91d3ca4b1bU, (uint64_t)0x4b050ad56cdfb3a1U,
+    (uint64_t)0x41bd3ec3d1f833a4U, (uint64_t)0x78d7e2ee719d7bf5U, (uint64_t)0xea4604672a27412eU,
+    (uint64_t)0x7dad6d1b42cd7900U, (uint64_t)0xb6e6b439e058f8a4U, (uint64_t)0x8836f1e662aa3bbcU,
+    (uint64_t)0xd45bf2c811142b0aU, (uint64_t)0xae324bac3c045ed1U, (uint64_t)0x372be24d270a8333U,
+    (uint64_t)0xeeda7a3a6b7c73b6U, (uint64_t)0xf6675402db49562aU, (uint64_t)0xc312ba68441e760dU,
+    (uint64_t)0x84d0d061a50e512eU, (uint64_t)0xfe764f4e4bbdd849U, (uint64_t)0xa924adcf9dadd5c0U,
+    (uint64_t)0x8685961debfe976U, (uint64_t)0xd3d846c529fba601U, (uint64_t)0x43bf8227dc3f4040U,
+    (uint64_t)0x5e767b8a49e9ff5U, (uint64_t)0xdede15e75e0dee6eU, (uint64_t)0x74f24872dc628aa2U,
+    (uint64_t)0xd3e9c4fe7861bb93U, (uint64_t)0x56d4822a6187b2e0U, (uint64_t)0xb66417cfc59826f9U,
+    (uint64_t)0xca2609692408169eU, (uint64_t)0xedf69d06c79ef885U, (uint64_t)0x31f8adc7d138fU,
+    (uint64_t)0xc4689c309953e453U, (uint64_t)0x5e355a2e1712dca5U, (uint64_t)0x1ff83c81f1cd96f7U,
+    (uint64_t)0xb06b89fb44cf56dbU, (uint64_t)0x1827705365f16e0dU, (uint64_t)0x6403b91de5618672U,
+    (uint64_t)0xba3f9475be384bc6U, (uint64_t)0x7f691cbe303ce5f3U, (uint64_t)0x63d3c6423fe56a64U,
+    (uint64_t)0x6ddc7f8d1d8d3d3cU, (uint64_t)0x6ee5220ccc596442U, (uint64_t)0xd1156a7334d8df26U,
+    (uint64_t)0xd8836fd52fab094cU, (uint64_t)0x996fad033a349c2dU, (uint64_t)0xdd8802e9c7887878U,
+    (uint64_t)0x64e797d211baed91U, (uint64_t)0x4589ba03210f4045U, (uint64_t)0xd5e7366301e8012aU,
+    (uint64_t)0x1c26052d74462ffaU, (uint64_t)0xe78f600c4f989519U, (uint64_t)0xc63ca0c97cee0b2fU,
+    (uint64_t)0xbe588573af760b5fU, (uint64_t)0x5906fc4593773cdU, (uint64_t)0xd5970fb0e322d5afU,
+    (uint64_t)0xa0158eeae457a477U, (uint64_t)0xd19857dbee6ddc05U, (uint64_t)0xb326522418c41671U,
+    (uint64_t)0x3ffdfc7e3c2c0d58U, (uint64_t)0x3a3a525426ee7cdaU, (uint64_t)0x341b0869df02c3a8U,
+    (uint64_t)0xa023bf42723bbfc8U, (uint64_t)0x3d15002a14452691U, (uint64_t)0x5ef7324c85edfa30U,
+    (uint64_t)0x2597655487d4f3daU, (uint64_t)0x352f5bc0dcb50c86U, (uint64_t)0x8f6927b04832a96cU,
+    (uint64_t)0xd08ee1ba55f2f94cU, (uint64_t)0x6a996f99344b45faU, (uint64_t)0xe133cb8da8aa455dU,
+    (uint64_t)0x5d0721ec758dc1f7U, (uint64_t)0xf3cae7e9262a3539U, (uint64_t)0x78a49d1d6670d59eU,
+    (uint64_t)0x37de0f63c1c5e1b9U, (uint64_t)0x3072c30c69cb7c1cU, (uint64_t)0x1d278a5277c850e6U,
+    (uint64_t)0x84f15f8f1f6a3de6U, (uint64_t)0x46a8bb45592ca7adU, (uint64_t)0x1912e3eee4d424b8U,
+    (uint64_t)0x6ba7a92079e5fb67U, (uint64_t)0xe1331feb70aa725eU, (uint64_t)0x5080ccf57df5d837U,
+    (uint64_t)0xe4cae01d7ff72e21U, (uint64_t)0xd9243ee60412a77dU, (uint64_t)0x6ff7cacdf449025U,
+    (uint64_t)0xbe75f7cd23ef5a31U, (uint64_t)0xbc9578220ddef7a8U, (uint64_t)0xdc988086365e668bU,
+    (uint64_t)0xada8dcdaaabda5fbU, (uint64_t)0xbc146b4c255f1fbeU, (uint64_t)0x9cfcde29cf34cfc3U,
+    (uint64_t)0xacbb453e7e85d1e4U, (uint64_t)0x9ca09679f92358b5U, (uint64_t)0x15fc2d96240823ffU,
+    (uint64_t)0x8d65adf70c11d11eU, (uint64_t)0x8cf7230cb0ce1c55U, (uint64_t)0x5b534d050bbfb607U,
+    (uint64_t)0xee1ef1130e16363bU, (uint64_t)0x27e0aa7ab4999e82U, (uint64_t)0xce1dac2d79362c41U,
+    (uint64_t)0x67920c9091bb6cb0U, (uint64_t)0x1e648d632223df24U, (uint64_t)0xf7d9eefe32e8f28U,
+    (uint64_t)0x775557f10296f4fdU, (uint64_t)0x1dca76a3ea51b436U, (uint64_t)0xf3e98f60fb950805U,
+    (uint64_t)0x31ff32ea831cf7f1U, (uint64_t)0x643e7bf18d2c714bU, (uint64_t)0x64b5c3392e9d2acaU,
+    (uint64_t)0xa9fd9ccc6adc2d23U, (uint64_t)0xfc2397eccc721b9bU, (uint64_t)0x6943f39afa833834U,
+    (uint64_t)0x22951722a6328562U, (uint64_t)0x81d63dd54170fc10U, (uint64_t)0x9f5fa58faecc2e6dU,
+    (uint64_t)0xb66c8725e77d9a3bU, (uint64_t)0x11235cea6384ebe0U, (uint64_t)0x6a8c1185845e24aU,
+    (uint64_t)0x137b286ebd093b1U, (uint64_t)0xf031182db48ec57dU, (uint64_t)0x515d32f804b233b9U,
+    (uint64_t)0x6bbb1d4093aad26U, (uint64_t)0x88a142fe0d83d1ecU, (uint64_t)0x3b95c099245c73f8U,
+    (uint64_t)0xb126d4af52edcd32U, (uint64_t)0xf8022c1e8fcb52e6U, (uint64_t)0x5a51ac4c0106d339U,
+    (uint64_t)0xc589e1ce44ace150U, (uint64_t)0xe0f8d3d94381e97cU, (uint64_t)0x59e99b1162c5a4b8U,
+    (uint64_t)0x90d262f7fd0ec9f9U, (uint64_t)0xfbc854c9283e13c9U, (uint64_t)0x2d04fde7aedc7085U,
+    (uint64_t)0x57d776547dcbecbU, (uint64_t)0x8dbdf5919a76fa5fU, (uint64_t)0xb7f70a1a7c64a054U,
+    (uint64_t)0xdc1c0df9db43e79U, (uint64_t)0x6d0a4ae251fe63d6U, (uint64_t)0xe0d5e3327f0c8abfU,
+    (uint64_t)0xff5500362b7ecee8U, (uint64_t)0x3ea0e6f75d055008U, (uint64_t)0x30deb62ff24ac84fU,
+    (uint64_t)0x936969fd5d7116b7U, (uint64_t)0xd01506950de1e578U, (uint64_t)0x2e1463e7e9f72bc6U,
+    (uint64_t)0xffa684411b39eca5U, (uint64_t)0x673c85307c037f2fU, (uint64_t)0xd0d6a600747f91daU,
+    (uint64_t)0xb08d43e1c9cb78e9U, (uint64_t)0xfc0c64427b5cef5U, (uint64_t)0x5c1d160aa60a2fd6U,
+    (uint64_t)0x2da76122617cf7fU, (uint64_t)0xd6e25d4eeee35260U, (uint64_t)0xb2fa5b0afd3533e9U,
+    (uint64_t)0xe76bb7b0b9126f88U, (uint64_t)0x692e6a9988856866U, (uint64_t)0x3fdf394f49db65caU,
+    (uint64_t)0x2529699122d8d606U, (uint64_t)0xe815bfbf3dd7c4cfU, (uint64_t)0xf98cae5328c8e13bU,
+    (uint64_t)0x375f10c4b2eddcd1U, (uint64_t)0xd4eb8b7f5cce06adU, (uint64_t)0xb4669f4580a2e1efU,
+    (uint64_t)0xd593f9d05bbd8699U, (uint64_t)0x5528a4c9e7976d13U, (uint64_t)0x3923e0951c7e28d3U,
+    (uint64_t)0xb92937903f6bb577U, (uint64_t)0x69c984ed4d844e7fU, (uint64_t)0xd354b2174a2e8a82U,
+    (uint64_t)0x25bd4addfb2c4136U, (uint64_t)0xf72df4de144b26e1U, (uint64_t)0xd0aa9db0e6101afdU,
+    (uint64_t)0x4445efaae49bd1b8U, (uint64_t)0x5dc54eee331593b2U, (uint64_t)0xfa35e3b9094bf10bU,
+    (uint64_t)0xe3417bc035d0b34aU, (uint64_t)0x440b386b8327c0a7U, (uint64_t)0x8fb7262dac0362d1U,
+    (uint64_t)0x2c41114ce0cdf943U, (uint64_t)0x2ba5cef1ad95a0b1U, (uint64_t)0xc09b37a867d54362U,
+    (uint64_t)0x26d6cdd201e486c9U, (uint64_t)0x20477abf42ff9297U, (uint64_t)0xa004dcb3292a9287U,
+    (uint64_t)0xddc15cf677b092c7U, (uint64_t)0x83a8464806c0605U, (uint64_t)0x4a68df703db997b0U,
+    (uint64_t)0x9c134e4505bf7dd0U, (uint64_t)0xa4e63d398ccf7f8cU, (uint64_t)0xa6e6517f41b5f8afU,
+    (uint64_t)0xaa8b9342ad7bc1ccU, (uint64_t)0x126f35b51e706ad9U, (uint64_t)0xb99cebb4c3a9ebdfU,
+    (uint64_t)0xa75389afbf608d90U, (uint64_t)0x76113c4fc6c89858U, (uint64_t)0x80de8eb097e2b5aaU,
+    (uint64_t)0x7e1022cc63b91304U, (uint64_t)0x3bdab6056ccc066cU, (uint64_t)0x33cbb144b2edf900U,
+    (uint64_t)0xc41764717af715d2U, (uint64_t)0xe2f7f594d0134a96U, (uint64_t)0x2c1873efa41ec956U,
+    (uint64_t)0xe4e7b4f677821304U, (uint64_t)0xe5c8ff9788d5374aU, (uint64_t)0x2b915e6380823d5bU,
+    (uint64_t)0xea6bc755b2ee8fe2U, (uint64_t)0x6657624ce7112651U, (uint64_t)0x157af101dace5acaU,
+    (uint64_t)0xc4fdbcf211a6a267U, (uint64_t)0xdaddf340c49c8609U, (uint64_t)0x97e49f52e9604a65U,
+    (uint64_t)0x9be8e790937e2ad5U, (uint64_t)0x846e2508326e17f1U, (uint64_t)0x3f38007a0bbbc0dcU,
+    (uint64_t)0xcf03603fb11e16d6U, (uint64_t)0xd6f800e07442f1d5U, (uint64_t)0x475607d166e0e3abU,
+    (uint64_t)0x82807f16b7c64047U, (uint64_t)0x8858e1e3a749883dU, (uint64_t)0x5859120b8231ee10U,
+    (uint64_t)0x1b80e7eb638a1eceU, (uint64_t)0xcb72525ac6aa73a4U, (uint64_t)0xa7cdea3d844423acU,
+    (uint64_t)0x5ed0c007f8ae7c38U, (uint64_t)0x6db07a5c3d740192U, (uint64_t)0xbe5e9c2a5fe36db3U,
+    (uint64_t)0xd5b9d57a76e95046U, (uint64_t)0x54ac32e78eba20f2U, (uint64_t)0xef11ca8f71b9a352U,
+    (uint64_t)0x305e373eff98a658U, (uint64_t)0xffe5a100823eb667U, (uint64_t)0x57477b11e51732d2U,
+    (uint64_t)0xdfd6eb282538fc0eU, (uint64_t)0x5c43b0cc3b39eec5U, (uint64_t)0x6af12778cb36cc57U,
+    (uint64_t)0x70b0852d06c425aeU, (uint64_t)0x6df92f8c5c221b9bU, (uint64_t)0x6c8d4f9ece826d9cU,
+    (uint64_t)0xf59aba7bb49359c3U, (uint64_t)0x5c8ed8d5da64309dU, (uint64_t)0x61a6de5691b30704U,
+    (uint64_t)0xd6b52f6a2f9b5808U, (uint64_t)0xeee419498c958a7U, (uint64_t)0xcddd9aab771e4caaU,
+    (uint64_t)0x83965dfd78bc21beU, (uint64_t)0x2affce3b3b504f5U, (uint64_t)0x30847a21561c8291U,
+    (uint64_t)0xd2eb2cf152bfda05U, (uint64_t)0xe0e4c4e96197b98cU, (uint64_t)0x1d35076cf8a1726fU,
+    (uint64_t)0x6c06085b2db11e3dU, (uint64_t)0x15c0c4d74463ba14U, (uint64_t)0x9d292f830030238cU,
+    (uint64_t)0x1311ee8b3727536dU, (uint64_t)0xfeea86efbeaedc1eU, (uint64_t)0xb9d18cd366131e2eU,
+    (uint64_t)0xf31d974f80fe2682U, (uint64_t)0xb6e49e0fe4160289U, (uint64_t)0x7c48ec0b08e92799U,
+    (uint64_t)0x818111d8d1989aa7U, (uint64_t)0xb34fa0aaebf926f9U, (uint64_t)0xdb5fe2f5a245474aU,
+    (uint64_t)0xf80a6ebb3c7ca756U, (uint64_t)0xa7f96054afa05dd8U, (uint64_t)0x26dfcf21fcaf119eU,
+    (uint64_t)0xe20ef2e30564bb59U, (uint64_t)0xef4dca5061cb02b8U, (uint64_t)0xcda7838a65d30672U,
+    (uint64_t)0x8b08d534fd657e86U, (uint64_t)0x4c5b439546d595c8U, (uint64_t)0x39b58725425cb836U,
+    (uint64_t)0x8ea610593de9abe3U, (uint64_t)0x404348819cdc03beU, (uint64_t)0x9b261245cfedce8cU,
+    (uint64_t)0x78c318b4cf5234a1U, (uint64_t)0x510bcf16fde24c99U, (uint64_t)0x2a77cb75a2c2ff5dU,
+    (uint64_t)0x9c895c2b27960fb4U, (uint64_t)0xd30ce975b0eda42bU, (uint64_t)0xfda853931a62cc26U,
+    (uint64_t)0x23c69b9650c0e052U, (uint64_t)0xa227df15bfc633f3U, (uint64_t)0x2ac788481bae7d48U,
+    (uint64_t)0x487878f9187d073dU, (uint64_t)0x6c2be919967f807dU, (uint64_t)0x765861d8336e6d8fU,
+    (uint64_t)0x88b8974cce528a43U, (uint64_t)0x9521177ff57d051U, (uint64_t)0x2ff38037fb6a1961U,
+    (uint64_t)0xfc0aba74a3d76ad4U, (uint64_t)0x7c76480325a7ec17U, (uint64_t)0x7532d75f48879bc8U,
+    (uint64_t)0xea7eacc058ce6bc1U, (uint64_t)0xc82176b48e896c16U, (uint64_t)0x9a30e0b22c750fedU,
+    (uint64_t)0x91213462f23f2d92U, (uint64_t)0x6cab71bd60b94078U, (uint64_t)0x6bdd0a63176cde20U,
+    (uint64_t)0x54c9b20cee4d54bcU, (uint64_t)0x3cd2d8aa9f2ac02fU, (uint64_t)0x3f8e617206eedb0U,
+    (uint64_t)0xc7f68e1693086434U, (uint64_t)0x831469c592dd3db9U, (uint64_t)0x7aa7a1583ae9c1bdU,
+    (uint64_t)0xe0af6d98e37ce240U, (uint64_t)0xe54342d928ab38b4U, (uint64_t)0xe8b750070a1c98caU,
+    (uint64_t)0xefce86afe02358f2U, (uint64_t)0x31b8b856ea921228U, (uint64_t)0x52a19120a1c67fcU,
+    (uint64_t)0xb4069ea4e3aead59U, (uint64_t)0x4a9090cde36d0757U, (uint64_t)0xf722d7b1d9a29382U,
+    (uint64_t)0xfb7fb04c04b48ddfU, (uint64_t)0x628ad2a7ebe16f43U, (uint64_t)0xcd3fbfb520226040U,
+    (uint64_t)0x6c34ecb15104b6c4U, (uint64_t)0x30c0754ec903c188U, (uint64_t)0xec336b082d23cab0U,
+    (uint64_t)0x9f51439e558df019U, (uint64_t)0x230da4baac712b27U, (uint64_t)0x518919e355185a24U,
+    (uint64_t)0x4dcefcdd84b78f50U, (uint64_t)0xa7d90fb2a47d4c5aU, (uint64_t)0x55ac9abfb30e009eU,
+    (uint64_t)0xfd2fc35974eed273U, (uint64_t)0xb72d824cdbea8fafU, (uint64_t)0xd213f923cbb13d1bU,
+    (uint64_t)0x98799f425bfb9bfeU, (uint64_t)0x1ae8ddc9701144a9U, (uint64_t)0xb8b3bb64c5595eeU,
+    (uint64_t)0xea9ef2e3ecebb21U, (uint64_t)0x17cb6c4b3671f9a7U, (uint64_t)0x47ef464f726f1d1fU,
+    (uint64_t)0x171b94846943a276U, (uint64_t)0x779b8552de7e5c19U, (uint64_t)0xfab28609c1c0256cU,
+    (uint64_t)0x64f58eeeabd4743dU, (uint64_t)0x4e8ef8387b6cc93bU, (uint64_t)0xee650d264cb1bf3dU,
+    (uint64_t)0x4c1f9d0973dedf61U, (uint64_t)0xaef7c9d7bfb70cedU, (uint64_t)0x1ec0507e1641de1eU,
+    (uint64_t)0xc9941109a607419dU, (uint64_t)0xfaa71e62bb6bca80U, (uint64_t)0x34158c1307c431f3U,
+    (uint64_t)0x594abebc992bc47aU, (uint64_t)0x6dfea691eb78399fU, (uint64_t)0x48aafb353f42cba4U,
+    (uint64_t)0xedcd65af077c04f0U, (uint64_t)0x1a29a366e884491aU, (uint64_t)0x549db2b5ef7d9289U,
+    (uint64_t)0x2480d4a8197f015aU, (uint64_t)0x61d5590bc40493b6U, (uint64_t)0x3a55b52e6f780331U,
+    (uint64_t)0x40eb8115309eadb0U, (uint64_t)0xdea7de5a92e5c625U, (uint64_t)0x64d631f0cc6a3d5aU,
+    (uint64_t)0x9d5e9d7c93e8dd61U, (uint64_t)0x7bf6a5c1f7ea25aaU, (uint64_t)0xd165e6bffbb07d5fU,
+    (uint64_t)0xe353936189e78671U, (uint64_t)0xa3fcac892bac4219U, (uint64_t)0xdfab6fd4f0baa8abU,
+    (uint64_t)0x5a4adac1e2c1c2e5U, (uint64_t)0x6cd75e3140d85849U, (uint64_t)0xce263fea19b39181U,
+    (uint64_t)0xb8d804a3315980cdU, (uint64_t)0x693bc492fa3bebf7U, (uint64_t)0x3578aeee2253c504U,
+    (uint64_t)0x158de498cd2474a2U, (uint64_t)0x1331f5c7cfda8368U, (uint64_t)0xd2d7bbb378d7177eU,
+    (uint64_t)0xdf61133af3c1e46eU, (uint64_t)0x5836ce7dd30e7be8U, (uint64_t)0xe042ece59a29a5c5U,
+    (uint64_t)0xb19b3c073b6c8402U, (uint64_t)0xc97667c719d92684U, (uint64_t)0xb5624622ebc66372U,
+    (uint64_t)0xcb96e653c04fa02U, (uint64_t)0x83a7176c8eaa39aaU, (uint64_t)0x2033561deaa1633fU,
+    (uint64_t)0x45a9d0864533df73U, (uint64_t)0x1b7a588d04c82bddU, (uint64_t)0x68005534f8319dfdU,
+    (uint64_t)0xde8a55b5d8eb9580U, (uint64_t)0x5ea886da8d5bca81U, (uint64_t)0xe8530a01252a0b4dU,
+    (uint64_t)0x1bffb4fe35eaa0a1U, (uint64_t)0x2ad828b1d8e99563U, (uint64_t)0x7de96ef595f9cd87U,
+    (uint64_t)0xa29ae9df5ece6e7cU, (uint64_t)0x603ac8f0facfb55U, (uint64_t)0xcfe85b7adda233a5U,
+    (uint64_t)0xe618919fbd75f0b8U, (uint64_t)0xf555a3d299bf1603U, (uint64_t)0x1f43afc9f184255aU,
+    (uint64_t)0xdcdaf341319a3e02U, (uint64_t)0xd3b117ef03903a39U, (uint64_t)0xd983cf8d20f8a242U,
+    (uint64_t)0x7aff5b1df22e1ad8U, (uint64_t)0x68fd11d07fc4feb3U, (uint64_t)0x5d53ae90b0f1c3e1U,
+    (uint64_t)0x50fb7905ec041803U, (uint64_t)0x85e3c97714404888U, (uint64_t)0xe67faedac628d8fU,
+    (uint64_t)0x2e8651506668532cU, (uint64_t)0xb6b82fa74d82f4c2U, (uint64_t)0x90725a606804efb3U,
+    (uint64_t)0xbc82ec46adc3425eU, (uint64_t)0xb7b805812787843eU, (uint64_t)0xdf46d91cdd1fc74cU,
+    (uint64_t)0xdc1c62cbe783a6c4U, (uint64_t)0x59d1b9f31a04cbbaU, (uint64_t)0xd87f6f7295e40764U,
+    (uint64_t)0x1083e2ea1f095615U, (uint64_t)0xa28ad7714e68c33U, (uint64_t)0x6bfc02523d8818beU,
+    (uint64_t)0xb585113af35850cdU, (uint64_t)0x7d935f0b30df8aa1U, (uint64_t)0xaddda07c4ab7e3acU,
+    (uint64_t)0x92c34299552f00cbU, (uint64_t)0xc33ed1de2909df6cU, (uint64_t)0x2dc40d483e07113cU,
+    (uint64_t)0x6e4a5d397d8b63aeU, (uint64_t)0x5582a94b79684c2bU, (uint64_t)0x932b33d4622da26cU,
+    (uint64_t)0xf534f6510dbbf08dU, (uint64_t)0x211d07c964c23a52U, (uint64_t)0xeeece0fee5bdc9bU,
+    (uint64_t)0xdf178168f7015558U, (uint64_t)0xabe7905a83cdd60eU, (uint64_t)0x50602fb5a1170184U,
+    (uint64_t)0x689886cdb023642aU, (uint64_t)0xd568d090a6e1fb00U, (uint64_t)0x5b1922c70259217fU,
+    (uint64_t)0x93831cd9c43141e4U, (uint64_t)0xdfca35870c95f86eU, (uint64_t)0xdec2057a568ae828U,
+    (uint64_t)0x568f8925913cc16dU, (uint64_t)0x18bc5b6de1a26f5aU, (uint64_t)0xdfa413bef5f499aeU,
+    (uint64_t)0xf8835decc3f0ae84U, (uint64_t)0xb6e60bd865a40ab0U, (uint64_t)0x65596439194b377eU,
+    (uint64_t)0xbcd8562592084a69U, (uint64_t)0x5ce433b94f23ede0U, (uint64_t)0x860d523d42e06189U,
+    (uint64_t)0xbf0779414e3aff13U, (uint64_t)0xb616dcac1b20650U, (uint64_t)0xe66dd6d12131300dU,
+    (uint64_t)0xd4a0fd67ff99abdeU, (uint64_t)0xc9903550c7aac50dU, (uint64_t)0x22ecf8b7c46b2d7U,
+    (uint64_t)0x3333b1e83abf92afU, (uint64_t)0xc0da65e784d6365dU, (uint64_t)0xbcb7443f8f759fb8U,
+    (uint64_t)0x35c712b17ae81930U, (uint64_t)0x80428dff4c6e08abU, (uint64_t)0xf19dafefa4faf843U,
+    (uint64_t)0xced8538dffa9855fU, (uint64_t)0x20ac409cbe3ac7ceU, (uint64_t)0x358c1fb6882da71eU,
+    (uint64_t)0xefecdef7be42a582U, (uint64_t)0xd3fc608065046be6U, (uint64_t)0xc9af13c809e8dba9U,
+    (uint64_t)0x1e6c9847641491ffU, (uint64_t)0x3b574925d30c31f7U, (uint64_t)0xb7eb72baac2a2122U,
+    (uint64_t)0x776a0dacef0859e7U, (uint64_t)0x6fec31421900942U, (uint64_t)0x324794b07e50122bU,
+    (uint64_t)0xdd744f8b4af07ca5U, (uint64_t)0x30a12f08d63fc97bU, (uint64_t)0x39650f1a76626d9dU,
+    (uint64_t)0x101b47f71fa38477U, (uint64_t)0x3d815f19d4dc124fU, (uint64_t)0x1569ae95b26eb58aU,
+    (uint64_t)0xc3cde18895fb1887U, (uint64_t)0x7ec62fbbf4737f21U, (uint64_t)0xd8dba5ab6209f5acU,
+    (uint64_t)0x24b5d7a9a5f9adbeU, (uint64_t)0x707d28f7a61dc768U, (uint64_t)0x7711460bcaa999eaU,
+    (uint64_t)0xba7b174d1c92e4ccU, (uint64_t)0x3c4bab6618d4bf2dU, (uint64_t)0xb8f0c980eb8bd279U,
+    (uint64_t)0x9d658932790691bfU, (uint64_t)0xed61058906b736aeU, (uint64_t)0x712c2f04c0d63b6eU,
+    (uint64_t)0x5cf06fd5c63d488fU, (uint64_t)0x97363facd9588e41U, (uint64_t)0x1f9bf7622b93257eU,
+    (uint64_t)0xa9d1ffc4667acaceU, (uint64_t)0x1cf4a1aa0a061ecfU, (uint64_t)0x28d675b2c0519a23U,
+    (uint64_t)0x9ebf94fe4f6952e3U, (uint64_t)0xf28bb767a2294a8aU, (uint64_t)0x85512b4dfe0af3f5U,
+    (uint64_t)0x18958ba899b16a0dU, (uint64_t)0x95c2430cba7548a7U, (uint64_t)0xb30d1b10a16be615U,
+    (uint64_t)0xe3ebbb9785bfb74cU, (uint64_t)0x7b53f5eb2e63645U, (uint64_t)0xbe57e54784c84232U,
+    (uint64_t)0xd779c2167214d5cfU, (uint64_t)0x617969cd029a3acaU, (uint64_t)0xd17668cd8a7017a0U,
+    (uint64_t)0x77b4d19abe9b7ee8U, (uint64_t)0x58fd0e939c161776U, (uint64_t)0xa8c4f4efd5968a72U,
+    (uint64_t)0x81eeb865d2fdca23U, (uint64_t)0x5a15ee08cc8ef895U, (uint64_t)0x768fa10a01905614U,
+    (uint64_t)0xeff5b8ef880ee19bU, (uint64_t)0xf0c0cabbcb1c8a0eU, (uint64_t)0x2e1ee9cdb8c838f9U,
+    (uint64_t)0x587d8b88a4a14c0U, (uint64_t)0xf6f278962ff698e5U, (uint64_t)0x519d34b3bf44da80U,
+    (uint64_t)0x283834f95ab32e66U, (uint64_t)0x6e6087976278a000U, (uint64_t)0x1e62960e627312f6U,
+    (uint64_t)0x9b87b27be6901c55U, (uint64_t)0x80e7853824fdbc1fU, (uint64_t)0xbbbc09512facc27dU,
+    (uint64_t)0x6394239ac143b5aU, (uint64_t)0x9c4b646e9e2fce99U, (uint64_t)0x68a210811e80857fU,
+    (uint64_t)0x6d54e443643b52aU, (uint64_t)0xde8d6d630d8eb843U, (uint64_t)0x7032156342146a0aU,
+    (uint64_t)0x8ba826f25eaa3622U, (uint64_t)0x227a58bd86138787U, (uint64_t)0x43b6c03c10281d37U,
+    (uint64_t)0xf306a3c8ee3c76cbU, (uint64_t)0x3cf11623d32a1f6eU, (uint64_t)0xe6d5ab646863e956U,
+    (uint64_t)0x3b8a4cbe5c005c26U, (uint64_t)0xdcd529a59ce6bb27U, (uint64_t)0xc4afaa5204d4b16fU,
+    (uint64_t)0xb0624a267923798dU, (uint64_t)0x85e56df66b307fabU, (uint64_t)0xb2330fef4e4ca463U,
+    (uint64_t)0xbcef72873566cc63U, (uint64_t)0xd161d2cacf780900U, (uint64_t)0x135dc5395b54827dU,
+    (uint64_t)0x638f052e27bf1bc6U, (uint64_t)0x10a224f007dfa06cU, (uint64_t)0xe973586d6d3321daU,
+    (uint64_t)0x8b0c573826152c8fU, (uint64_t)0x896895959884aaf7U, (uint64_t)0xb1959be307b348a6U,
+    (uint64_t)0x96250e573c147c87U, (uint64_t)0xae0efb3add0c61f8U, (uint64_t)0xed00745eca8c325eU,
+    (uint64_t)0x3c911696ecff3f70U, (uint64_t)0x73acbc65319ad41dU, (uint64_t)0x7b01a020f0b1c7efU,
+    (uint64_t)0x9910ba6b23a5d896U, (uint64_t)0x1fe19e357fe4364eU, (uint64_t)0x6e1da8c39a33c677U,
+    (uint64_t)0x15b4488b29fd9fd0U, (uint64_t)0x1f4392541a1f22bfU, (uint64_t)0x920a8a70ab8163e8U,
+    (uint64_t)0x3fd1b24907e5658eU, (uint64_t)0xf2c4f79cb6ec839bU, (uint64_t)0x262143b5224c08dcU,
+    (uint64_t)0x2bbb09b481b50c91U, (uint64_t)0xc16ed709aca8c84fU, (uint64_t)0xa6210d9db2850ca8U,
+    (uint64_t)0x6d8df67a09cb54d6U, (uint64_t)0x91eef6e0500919a4U, (uint64_t)0x90f613810f132857U,
+    (uint64_t)0x9acede47f8d5028bU, (uint64_t)0x84cea0691416a6a5U, (uint64_t)0x8f860c7943ef881cU,
+    (uint64_t)0x41311f8a38038a5dU, (uint64_t)0xe78c2ec0fc612067U, (uint64_t)0x494d2e815ad73581U,
+    (uint64_t)0xb4cc9e0059604097U, (uint64_t)0xff558aecf3612cbaU, (uint64_t)0x35beef7a9e36c39eU,
+    (uint64_t)0x45e21446de673629U, (uint64_t)0x57f7aa1e703c2d21U, (uint64_t)0xa0e99b7f98c868c7U,
+    (uint64_t)0x4e42f66d8b641676U, (uint64_t)0x602884dc91077896U, (uint64_t)0xa0d690cfc2c9885bU,
+    (uint64_t)0xfeb4da333b9a5187U, (uint64_t)0x5f789598153c87eeU, (uint64_t)0x8b5c619c76497ee8U,
+    (uint64_t)0x5d2b0ac6c717370eU, (uint64_t)0x98204cb64fcf68e1U, (uint64_t)0xbdec21162bc6792U,
+    (uint64_t)0x6973ccefa63b1011U, (uint64_t)0xf9e3fa97e0de1ac5U, (uint64_t)0x5efb693e3d0e0c8bU,
+    (uint64_t)0x37248e9d2d4fcb4U, (uint64_t)0xb19b1c4fca66eca8U, (uint64_t)0xf04a20b55663de54U,
+    (uint64_t)0x42a29a33c223b617U, (uint64_t)0x86c68d0d44827e11U, (uint64_t)0x71f90ddeadba1206U,
+    (uint64_t)0xeeffb4167a6ceeeaU, (uint64_t)0x9e302fbac543e8afU, (uint64_t)0xcf07f7471aa77b96U,
+    (uint64_t)0xcf57fca29849e95bU, (uint64_t)0x96e9793ed510053cU, (uint64_t)0x89fa443d07d3e75eU,
+    (uint64_t)0xfe2bc235e52800a0U, (uint64_t)0x1c208b8c0ac7e740U, (uint64_t)0xb5852a49e7222263U,
+    (uint64_t)0x217e4005e541e592U, (uint64_t)0xee52747dc960b0e1U, (uint64_t)0x5fd7cafb475952afU,
+    (uint64_t)0x23a6d71954a43337U, (uint64_t)0xa83a7523b1617941U, (uint64_t)0xb7f35d412b37dd4U,
+    (uint64_t)0x81ec51292ae27eafU, (uint64_t)0x7ca92fb3318169dfU, (uint64_t)0xc01bfd6078d0875aU,
+    (uint64_t)0xcc6074e3c99c436eU, (uint64_t)0xd3694e2ab20364e4U, (uint64_t)0x62699718e770b20dU,
+    (uint64_t)0x6183291b6ed77d1cU, (uint64_t)0x69aada7f6d6180a5U, (uint64_t)0x51f9054bf185509bU,
+    (uint64_t)0xfd7e845678701077U, (uint64_t)0xd6a2308a7fb96d8dU, (uint64_t)0xd53e48d228dc87eeU,
+    (uint64_t)0x4ca6bdebf57912b8U, (uint64_t)0x9a17577e98507b5aU, (uint64_t)0x8ed4ab7759e51dfcU,
+    (uint64_t)0x103b7b2a470f5a36U, (uint64_t)0xc8545ac12553321U, (uint64_t)0xab5861a760482817U,
+    (uint64_t)0xf4b5f602b9b856cfU, (uint64_t)0x609955787adf2e5fU, (uint64_t)0x3e858c2ffceac518U,
+    (uint64_t)0x94589aac6656bbe1U, (uint64_t)0x82293299cdf809afU, (uint64_t)0x1280aafbed23f0d1U,
+    (uint64_t)0xdeab0c677306e2a4U, (uint64_t)0xe010a39acfaec17fU, (uint64_t)0xd5cb00b340f02322U,
+    (uint64_t)0x9bfafcccca58cca2U, (uint64_t)0x60ce25b1ee5cb44fU, (uint64_t)0xddcc7d182c2d7598U,
+    (uint64_t)0x1765a1b301847b5cU, (uint64_t)0xf5d9c3635d0d23b7U, (uint64_t)0x42ff1ba7928b65d0U,
+    (uint64_t)0x587ac69d6148e043U, (uint64_t)0x3099be0dd320390bU, (uint64_t)0xa7b88dfc4278329fU
+  };
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_P256_PrecompTable_H_DEFINED
+#endif
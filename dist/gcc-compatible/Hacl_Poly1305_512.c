@@ -0,0 +1,2587 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Poly1305_512.h"
+
+void
+Hacl_Impl_Poly1305_Field32xN_512_load_acc8(Lib_IntVector_Intrinsics_vec512 *acc, uint8_t *b)
+{
+  Lib_IntVector_Intrinsics_vec512 e[5U];
+  for (uint32_t _i = 0U; _i < (uint32_t)5U; ++_i)
+    e[_i] = Lib_IntVector_Intrinsics_vec512_zero;
+  Lib_IntVector_Intrinsics_vec512 lo = Lib_IntVector_Intrinsics_vec512_load_le(b);
+  Lib_IntVector_Intrinsics_vec512
+  hi = Lib_IntVector_Intrinsics_vec512_load_le(b + (uint32_t)64U);
+  Lib_IntVector_Intrinsics_vec512
+  mask26 = Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU);
+  Lib_IntVector_Intrinsics_vec512
+  lo0 = Lib_IntVector_Intrinsics_vec512_interleave_low256(lo, hi);
+  Lib_IntVector_Intrinsics_vec512
+  hi0 = Lib_IntVector_Intrinsics_vec512_interleave_high256(lo, hi);
+  Lib_IntVector_Intrinsics_vec512 m0 = Lib_IntVector_Intrinsics_vec512_interleave_low128(lo0, hi0);
+  Lib_IntVector_Intrinsics_vec512
+  m1 = Lib_IntVector_Intrinsics_vec512_interleave_high128(lo0, hi0);
+  Lib_IntVector_Intrinsics_vec512
+  m2 = Lib_IntVector_Intrinsics_vec512_shift_right(m0, (uint32_t)48U);
+  Lib_IntVector_Intrinsics_vec512
+  m3 = Lib_IntVector_Intrinsics_vec512_shift_right(m1, (uint32_t)48U);
+  Lib_IntVector_Intrinsics_vec512 m4 = Lib_IntVector_Intrinsics_vec512_interleave_high64(m0, m1);
+  Lib_IntVector_Intrinsics_vec512 t0 = Lib_IntVector_Intrinsics_vec512_interleave_low64(m0, m1);
+  Lib_IntVector_Intrinsics_vec512 t3 = Lib_IntVector_Intrinsics_vec512_interleave_low64(m2, m3);
+  Lib_IntVector_Intrinsics_vec512
+  t2 = Lib_IntVector_Intrinsics_vec512_shift_right64(t3, (uint32_t)4U);
+  Lib_IntVector_Intrinsics_vec512 o20 = Lib_IntVector_Intrinsics_vec512_and(t2, mask26);
+  Lib_IntVector_Intrinsics_vec512
+  t1 = Lib_IntVector_Intrinsics_vec512_shift_right64(t0, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 o10 = Lib_IntVector_Intrinsics_vec512_and(t1, mask26);
+  Lib_IntVector_Intrinsics_vec512 o5 = Lib_IntVector_Intrinsics_vec512_and(t0, mask26);
+  Lib_IntVector_Intrinsics_vec512
+  t31 = Lib_IntVector_Intrinsics_vec512_shift_right64(t3, (uint32_t)30U);
+  Lib_IntVector_Intrinsics_vec512 o30 = Lib_IntVector_Intrinsics_vec512_and(t31, mask26);
+  Lib_IntVector_Intrinsics_vec512
+  o40 = Lib_IntVector_Intrinsics_vec512_shift_right64(m4, (uint32_t)40U);
+  Lib_IntVector_Intrinsics_vec512 o0 = o5;
+  Lib_IntVector_Intrinsics_vec512 o1 = o10;
+  Lib_IntVector_Intrinsics_vec512 o2 = o20;
+  Lib_IntVector_Intrinsics_vec512 o3 = o30;
+  Lib_IntVector_Intrinsics_vec512 o4 = o40;
+  e[0U] = o0;
+  e[1U] = o1;
+  e[2U] = o2;
+  e[3U] = o3;
+  e[4U] = o4;
+  uint64_t b1 = (uint64_t)0x1000000U;
+  Lib_IntVector_Intrinsics_vec512 mask = Lib_IntVector_Intrinsics_vec512_load64(b1);
+  Lib_IntVector_Intrinsics_vec512 f40 = e[4U];
+  e[4U] = Lib_IntVector_Intrinsics_vec512_or(f40, mask);
+  Lib_IntVector_Intrinsics_vec512 acc0 = acc[0U];
+  Lib_IntVector_Intrinsics_vec512 acc1 = acc[1U];
+  Lib_IntVector_Intrinsics_vec512 acc2 = acc[2U];
+  Lib_IntVector_Intrinsics_vec512 acc3 = acc[3U];
+  Lib_IntVector_Intrinsics_vec512 acc4 = acc[4U];
+  Lib_IntVector_Intrinsics_vec512 e0 = e[0U];
+  Lib_IntVector_Intrinsics_vec512 e1 = e[1U];
+  Lib_IntVector_Intrinsics_vec512 e2 = e[2U];
+  Lib_IntVector_Intrinsics_vec512 e3 = e[3U];
+  Lib_IntVector_Intrinsics_vec512 e4 = e[4U];
+  Lib_IntVector_Intrinsics_vec512 r0 = Lib_IntVector_Intrinsics_vec512_zero;
+  Lib_IntVector_Intrinsics_vec512 r1 = Lib_IntVector_Intrinsics_vec512_zero;
+  Lib_IntVector_Intrinsics_vec512 r2 = Lib_IntVector_Intrinsics_vec512_zero;
+  Lib_IntVector_Intrinsics_vec512 r3 = Lib_IntVector_Intrinsics_vec512_zero;
+  Lib_IntVector_Intrinsics_vec512 r4 = Lib_IntVector_Intrinsics_vec512_zero;
+  Lib_IntVector_Intrinsics_vec512
+  r01 =
+    Lib_IntVector_Intrinsics_vec512_insert64(r0,
+      Lib_IntVector_Intrinsics_vec512_extract64(acc0, (uint32_t)0U),
+      (uint32_t)0U);
+  Lib_IntVector_Intrinsics_vec512
+  r11 =
+    Lib_IntVector_Intrinsics_vec512_insert64(r1,
+      Lib_IntVector_Intrinsics_vec512_extract64(acc1, (uint32_t)0U),
+      (uint32_t)0U);
+  Lib_IntVector_Intrinsics_vec512
+  r21 =
+    Lib_IntVector_Intrinsics_vec512_insert64(r2,
+      Lib_IntVector_Intrinsics_vec512_extract64(acc2, (uint32_t)0U),
+      (uint32_t)0U);
+  Lib_IntVector_Intrinsics_vec512
+  r31 =
+    Lib_IntVector_Intrinsics_vec512_insert64(r3,
+      Lib_IntVector_Intrinsics_vec512_extract64(acc3, (uint32_t)0U),
+      (uint32_t)0U);
+  Lib_IntVector_Intrinsics_vec512
+  r41 =
+    Lib_IntVector_Intrinsics_vec512_insert64(r4,
+      Lib_IntVector_Intrinsics_vec512_extract64(acc4, (uint32_t)0U),
+      (uint32_t)0U);
+  Lib_IntVector_Intrinsics_vec512 f0 = Lib_IntVector_Intrinsics_vec512_add64(r01, e0);
+  Lib_IntVector_Intrinsics_vec512 f1 = Lib_IntVector_Intrinsics_vec512_add64(r11, e1);
+  Lib_IntVector_Intrinsics_vec512 f2 = Lib_IntVector_Intrinsics_vec512_add64(r21, e2);
+  Lib_IntVector_Intrinsics_vec512 f3 = Lib_IntVector_Intrinsics_vec512_add64(r31, e3);
+  Lib_IntVector_Intrinsics_vec512 f4 = Lib_IntVector_Intrinsics_vec512_add64(r41, e4);
+  Lib_IntVector_Intrinsics_vec512 acc01 = f0;
+  Lib_IntVector_Intrinsics_vec512 acc11 = f1;
+  Lib_IntVector_Intrinsics_vec512 acc21 = f2;
+  Lib_IntVector_Intrinsics_vec512 acc31 = f3;
+  Lib_IntVector_Intrinsics_vec512 acc41 = f4;
+  acc[0U] = acc01;
+  acc[1U] = acc11;
+  acc[2U] = acc21;
+  acc[3U] = acc31;
+  acc[4U] = acc41;
+}
+
+void
+Hacl_Impl_Poly1305_Field32xN_512_fmul_r8_normalize(
+  Lib_IntVector_Intrinsics_vec512 *out,
+  Lib_IntVector_Intrinsics_vec512 *p
+)
+{
+  Lib_IntVector_Intrinsics_vec512 *r = p;
+  Lib_IntVector_Intrinsics_vec512 *r_5 = p + (uint32_t)5U;
+  Lib_IntVector_Intrinsics_vec512 a0 = out[0U];
+  Lib_IntVector_Intrinsics_vec512 a1 = out[1U];
+  Lib_IntVector_Intrinsics_vec512 a2 = out[2U];
+  Lib_IntVector_Intrinsics_vec512 a3 = out[3U];
+  Lib_IntVector_Intrinsics_vec512 a4 = out[4U];
+  Lib_IntVector_Intrinsics_vec512 r10 = r[0U];
+  Lib_IntVector_Intrinsics_vec512 r11 = r[1U];
+  Lib_IntVector_Intrinsics_vec512 r12 = r[2U];
+  Lib_IntVector_Intrinsics_vec512 r13 = r[3U];
+  Lib_IntVector_Intrinsics_vec512 r14 = r[4U];
+  Lib_IntVector_Intrinsics_vec512 r151 = r_5[1U];
+  Lib_IntVector_Intrinsics_vec512 r152 = r_5[2U];
+  Lib_IntVector_Intrinsics_vec512 r153 = r_5[3U];
+  Lib_IntVector_Intrinsics_vec512 r154 = r_5[4U];
+  Lib_IntVector_Intrinsics_vec512 a010 = Lib_IntVector_Intrinsics_vec512_mul64(r10, r10);
+  Lib_IntVector_Intrinsics_vec512 a110 = Lib_IntVector_Intrinsics_vec512_mul64(r11, r10);
+  Lib_IntVector_Intrinsics_vec512 a210 = Lib_IntVector_Intrinsics_vec512_mul64(r12, r10);
+  Lib_IntVector_Intrinsics_vec512 a310 = Lib_IntVector_Intrinsics_vec512_mul64(r13, r10);
+  Lib_IntVector_Intrinsics_vec512 a410 = Lib_IntVector_Intrinsics_vec512_mul64(r14, r10);
+  Lib_IntVector_Intrinsics_vec512
+  a020 =
+    Lib_IntVector_Intrinsics_vec512_add64(a010,
+      Lib_IntVector_Intrinsics_vec512_mul64(r154, r11));
+  Lib_IntVector_Intrinsics_vec512
+  a120 =
+    Lib_IntVector_Intrinsics_vec512_add64(a110,
+      Lib_IntVector_Intrinsics_vec512_mul64(r10, r11));
+  Lib_IntVector_Intrinsics_vec512
+  a220 =
+    Lib_IntVector_Intrinsics_vec512_add64(a210,
+      Lib_IntVector_Intrinsics_vec512_mul64(r11, r11));
+  Lib_IntVector_Intrinsics_vec512
+  a320 =
+    Lib_IntVector_Intrinsics_vec512_add64(a310,
+      Lib_IntVector_Intrinsics_vec512_mul64(r12, r11));
+  Lib_IntVector_Intrinsics_vec512
+  a420 =
+    Lib_IntVector_Intrinsics_vec512_add64(a410,
+      Lib_IntVector_Intrinsics_vec512_mul64(r13, r11));
+  Lib_IntVector_Intrinsics_vec512
+  a030 =
+    Lib_IntVector_Intrinsics_vec512_add64(a020,
+      Lib_IntVector_Intrinsics_vec512_mul64(r153, r12));
+  Lib_IntVector_Intrinsics_vec512
+  a130 =
+    Lib_IntVector_Intrinsics_vec512_add64(a120,
+      Lib_IntVector_Intrinsics_vec512_mul64(r154, r12));
+  Lib_IntVector_Intrinsics_vec512
+  a230 =
+    Lib_IntVector_Intrinsics_vec512_add64(a220,
+      Lib_IntVector_Intrinsics_vec512_mul64(r10, r12));
+  Lib_IntVector_Intrinsics_vec512
+  a330 =
+    Lib_IntVector_Intrinsics_vec512_add64(a320,
+      Lib_IntVector_Intrinsics_vec512_mul64(r11, r12));
+  Lib_IntVector_Intrinsics_vec512
+  a430 =
+    Lib_IntVector_Intrinsics_vec512_add64(a420,
+      Lib_IntVector_Intrinsics_vec512_mul64(r12, r12));
+  Lib_IntVector_Intrinsics_vec512
+  a040 =
+    Lib_IntVector_Intrinsics_vec512_add64(a030,
+      Lib_IntVector_Intrinsics_vec512_mul64(r152, r13));
+  Lib_IntVector_Intrinsics_vec512
+  a140 =
+    Lib_IntVector_Intrinsics_vec512_add64(a130,
+      Lib_IntVector_Intrinsics_vec512_mul64(r153, r13));
+  Lib_IntVector_Intrinsics_vec512
+  a240 =
+    Lib_IntVector_Intrinsics_vec512_add64(a230,
+      Lib_IntVector_Intrinsics_vec512_mul64(r154, r13));
+  Lib_IntVector_Intrinsics_vec512
+  a340 =
+    Lib_IntVector_Intrinsics_vec512_add64(a330,
+      Lib_IntVector_Intrinsics_vec512_mul64(r10, r13));
+  Lib_IntVector_Intrinsics_vec512
+  a440 =
+    Lib_IntVector_Intrinsics_vec512_add64(a430,
+      Lib_IntVector_Intrinsics_vec512_mul64(r11, r13));
+  Lib_IntVector_Intrinsics_vec512
+  a050 =
+    Lib_IntVector_Intrinsics_vec512_add64(a040,
+      Lib_IntVector_Intrinsics_vec512_mul64(r151, r14));
+  Lib_IntVector_Intrinsics_vec512
+  a150 =
+    Lib_IntVector_Intrinsics_vec512_add64(a140,
+      Lib_IntVector_Intrinsics_vec512_mul64(r152, r14));
+  Lib_IntVector_Intrinsics_vec512
+  a250 =
+    Lib_IntVector_Intrinsics_vec512_add64(a240,
+      Lib_IntVector_Intrinsics_vec512_mul64(r153, r14));
+  Lib_IntVector_Intrinsics_vec512
+  a350 =
+    Lib_IntVector_Intrinsics_vec512_add64(a340,
+      Lib_IntVector_Intrinsics_vec512_mul64(r154, r14));
+  Lib_IntVector_Intrinsics_vec512
+  a450 =
+    Lib_IntVector_Intrinsics_vec512_add64(a440,
+      Lib_IntVector_Intrinsics_vec512_mul64(r10, r14));
+  Lib_IntVector_Intrinsics_vec512 t00 = a050;
+  Lib_IntVector_Intrinsics_vec512 t10 = a150;
+  Lib_IntVector_Intrinsics_vec512 t20 = a250;
+  Lib_IntVector_Intrinsics_vec512 t30 = a350;
+  Lib_IntVector_Intrinsics_vec512 t40 = a450;
+  Lib_IntVector_Intrinsics_vec512
+  mask260 = Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU);
+  Lib_IntVector_Intrinsics_vec512
+  z00 = Lib_IntVector_Intrinsics_vec512_shift_right64(t00, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z10 = Lib_IntVector_Intrinsics_vec512_shift_right64(t30, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x00 = Lib_IntVector_Intrinsics_vec512_and(t00, mask260);
+  Lib_IntVector_Intrinsics_vec512 x30 = Lib_IntVector_Intrinsics_vec512_and(t30, mask260);
+  Lib_IntVector_Intrinsics_vec512 x10 = Lib_IntVector_Intrinsics_vec512_add64(t10, z00);
+  Lib_IntVector_Intrinsics_vec512 x40 = Lib_IntVector_Intrinsics_vec512_add64(t40, z10);
+  Lib_IntVector_Intrinsics_vec512
+  z010 = Lib_IntVector_Intrinsics_vec512_shift_right64(x10, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z110 = Lib_IntVector_Intrinsics_vec512_shift_right64(x40, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  t5 = Lib_IntVector_Intrinsics_vec512_shift_left64(z110, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec512 z12 = Lib_IntVector_Intrinsics_vec512_add64(z110, t5);
+  Lib_IntVector_Intrinsics_vec512 x110 = Lib_IntVector_Intrinsics_vec512_and(x10, mask260);
+  Lib_IntVector_Intrinsics_vec512 x410 = Lib_IntVector_Intrinsics_vec512_and(x40, mask260);
+  Lib_IntVector_Intrinsics_vec512 x20 = Lib_IntVector_Intrinsics_vec512_add64(t20, z010);
+  Lib_IntVector_Intrinsics_vec512 x010 = Lib_IntVector_Intrinsics_vec512_add64(x00, z12);
+  Lib_IntVector_Intrinsics_vec512
+  z020 = Lib_IntVector_Intrinsics_vec512_shift_right64(x20, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z130 = Lib_IntVector_Intrinsics_vec512_shift_right64(x010, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x210 = Lib_IntVector_Intrinsics_vec512_and(x20, mask260);
+  Lib_IntVector_Intrinsics_vec512 x020 = Lib_IntVector_Intrinsics_vec512_and(x010, mask260);
+  Lib_IntVector_Intrinsics_vec512 x310 = Lib_IntVector_Intrinsics_vec512_add64(x30, z020);
+  Lib_IntVector_Intrinsics_vec512 x120 = Lib_IntVector_Intrinsics_vec512_add64(x110, z130);
+  Lib_IntVector_Intrinsics_vec512
+  z030 = Lib_IntVector_Intrinsics_vec512_shift_right64(x310, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x320 = Lib_IntVector_Intrinsics_vec512_and(x310, mask260);
+  Lib_IntVector_Intrinsics_vec512 x420 = Lib_IntVector_Intrinsics_vec512_add64(x410, z030);
+  Lib_IntVector_Intrinsics_vec512 r20 = x020;
+  Lib_IntVector_Intrinsics_vec512 r21 = x120;
+  Lib_IntVector_Intrinsics_vec512 r22 = x210;
+  Lib_IntVector_Intrinsics_vec512 r23 = x320;
+  Lib_IntVector_Intrinsics_vec512 r24 = x420;
+  Lib_IntVector_Intrinsics_vec512 a011 = Lib_IntVector_Intrinsics_vec512_mul64(r10, r20);
+  Lib_IntVector_Intrinsics_vec512 a111 = Lib_IntVector_Intrinsics_vec512_mul64(r11, r20);
+  Lib_IntVector_Intrinsics_vec512 a211 = Lib_IntVector_Intrinsics_vec512_mul64(r12, r20);
+  Lib_IntVector_Intrinsics_vec512 a311 = Lib_IntVector_Intrinsics_vec512_mul64(r13, r20);
+  Lib_IntVector_Intrinsics_vec512 a411 = Lib_IntVector_Intrinsics_vec512_mul64(r14, r20);
+  Lib_IntVector_Intrinsics_vec512
+  a021 =
+    Lib_IntVector_Intrinsics_vec512_add64(a011,
+      Lib_IntVector_Intrinsics_vec512_mul64(r154, r21));
+  Lib_IntVector_Intrinsics_vec512
+  a121 =
+    Lib_IntVector_Intrinsics_vec512_add64(a111,
+      Lib_IntVector_Intrinsics_vec512_mul64(r10, r21));
+  Lib_IntVector_Intrinsics_vec512
+  a221 =
+    Lib_IntVector_Intrinsics_vec512_add64(a211,
+      Lib_IntVector_Intrinsics_vec512_mul64(r11, r21));
+  Lib_IntVector_Intrinsics_vec512
+  a321 =
+    Lib_IntVector_Intrinsics_vec512_add64(a311,
+      Lib_IntVector_Intrinsics_vec512_mul64(r12, r21));
+  Lib_IntVector_Intrinsics_vec512
+  a421 =
+    Lib_IntVector_Intrinsics_vec512_add64(a411,
+      Lib_IntVector_Intrinsics_vec512_mul64(r13, r21));
+  Lib_IntVector_Intrinsics_vec512
+  a031 =
+    Lib_IntVector_Intrinsics_vec512_add64(a021,
+      Lib_IntVector_Intrinsics_vec512_mul64(r153, r22));
+  Lib_IntVector_Intrinsics_vec512
+  a131 =
+    Lib_IntVector_Intrinsics_vec512_add64(a121,
+      Lib_IntVector_Intrinsics_vec512_mul64(r154, r22));
+  Lib_IntVector_Intrinsics_vec512
+  a231 =
+    Lib_IntVector_Intrinsics_vec512_add64(a221,
+      Lib_IntVector_Intrinsics_vec512_mul64(r10, r22));
+  Lib_IntVector_Intrinsics_vec512
+  a331 =
+    Lib_IntVector_Intrinsics_vec512_add64(a321,
+      Lib_IntVector_Intrinsics_vec512_mul64(r11, r22));
+  Lib_IntVector_Intrinsics_vec512
+  a431 =
+    Lib_IntVector_Intrinsics_vec512_add64(a421,
+      Lib_IntVector_Intrinsics_vec512_mul64(r12, r22));
+  Lib_IntVector_Intrinsics_vec512
+  a041 =
+    Lib_IntVector_Intrinsics_vec512_add64(a031,
+      Lib_IntVector_Intrinsics_vec512_mul64(r152, r23));
+  Lib_IntVector_Intrinsics_vec512
+  a141 =
+    Lib_IntVector_Intrinsics_vec512_add64(a131,
+      Lib_IntVector_Intrinsics_vec512_mul64(r153, r23));
+  Lib_IntVector_Intrinsics_vec512
+  a241 =
+    Lib_IntVector_Intrinsics_vec512_add64(a231,
+      Lib_IntVector_Intrinsics_vec512_mul64(r154, r23));
+  Lib_IntVector_Intrinsics_vec512
+  a341 =
+    Lib_IntVector_Intrinsics_vec512_add64(a331,
+      Lib_IntVector_Intrinsics_vec512_mul64(r10, r23));
+  Lib_IntVector_Intrinsics_vec512
+  a441 =
+    Lib_IntVector_Intrinsics_vec512_add64(a431,
+      Lib_IntVector_Intrinsics_vec512_mul64(r11, r23));
+  Lib_IntVector_Intrinsics_vec512
+  a051 =
+    Lib_IntVector_Intrinsics_vec512_add64(a041,
+      Lib_IntVector_Intrinsics_vec512_mul64(r151, r24));
+  Lib_IntVector_Intrinsics_vec512
+  a151 =
+    Lib_IntVector_Intrinsics_vec512_add64(a141,
+      Lib_IntVector_Intrinsics_vec512_mul64(r152, r24));
+  Lib_IntVector_Intrinsics_vec512
+  a251 =
+    Lib_IntVector_Intrinsics_vec512_add64(a241,
+      Lib_IntVector_Intrinsics_vec512_mul64(r153, r24));
+  Lib_IntVector_Intrinsics_vec512
+  a351 =
+    Lib_IntVector_Intrinsics_vec512_add64(a341,
+      Lib_IntVector_Intrinsics_vec512_mul64(r154, r24));
+  Lib_IntVector_Intrinsics_vec512
+  a451 =
+    Lib_IntVector_Intrinsics_vec512_add64(a441,
+      Lib_IntVector_Intrinsics_vec512_mul64(r10, r24));
+  Lib_IntVector_Intrinsics_vec512 t01 = a051;
+  Lib_IntVector_Intrinsics_vec512 t11 = a151;
+  Lib_IntVector_Intrinsics_vec512 t21 = a251;
+  Lib_IntVector_Intrinsics_vec512 t31 = a351;
+  Lib_IntVector_Intrinsics_vec512 t41 = a451;
+  Lib_IntVector_Intrinsics_vec512
+  mask261 = Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU);
+  Lib_IntVector_Intrinsics_vec512
+  z04 = Lib_IntVector_Intrinsics_vec512_shift_right64(t01, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z14 = Lib_IntVector_Intrinsics_vec512_shift_right64(t31, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x03 = Lib_IntVector_Intrinsics_vec512_and(t01, mask261);
+  Lib_IntVector_Intrinsics_vec512 x33 = Lib_IntVector_Intrinsics_vec512_and(t31, mask261);
+  Lib_IntVector_Intrinsics_vec512 x13 = Lib_IntVector_Intrinsics_vec512_add64(t11, z04);
+  Lib_IntVector_Intrinsics_vec512 x43 = Lib_IntVector_Intrinsics_vec512_add64(t41, z14);
+  Lib_IntVector_Intrinsics_vec512
+  z011 = Lib_IntVector_Intrinsics_vec512_shift_right64(x13, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z111 = Lib_IntVector_Intrinsics_vec512_shift_right64(x43, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  t6 = Lib_IntVector_Intrinsics_vec512_shift_left64(z111, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec512 z120 = Lib_IntVector_Intrinsics_vec512_add64(z111, t6);
+  Lib_IntVector_Intrinsics_vec512 x111 = Lib_IntVector_Intrinsics_vec512_and(x13, mask261);
+  Lib_IntVector_Intrinsics_vec512 x411 = Lib_IntVector_Intrinsics_vec512_and(x43, mask261);
+  Lib_IntVector_Intrinsics_vec512 x22 = Lib_IntVector_Intrinsics_vec512_add64(t21, z011);
+  Lib_IntVector_Intrinsics_vec512 x011 = Lib_IntVector_Intrinsics_vec512_add64(x03, z120);
+  Lib_IntVector_Intrinsics_vec512
+  z021 = Lib_IntVector_Intrinsics_vec512_shift_right64(x22, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z131 = Lib_IntVector_Intrinsics_vec512_shift_right64(x011, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x211 = Lib_IntVector_Intrinsics_vec512_and(x22, mask261);
+  Lib_IntVector_Intrinsics_vec512 x021 = Lib_IntVector_Intrinsics_vec512_and(x011, mask261);
+  Lib_IntVector_Intrinsics_vec512 x311 = Lib_IntVector_Intrinsics_vec512_add64(x33, z021);
+  Lib_IntVector_Intrinsics_vec512 x121 = Lib_IntVector_Intrinsics_vec512_add64(x111, z131);
+  Lib_IntVector_Intrinsics_vec512
+  z031 = Lib_IntVector_Intrinsics_vec512_shift_right64(x311, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x321 = Lib_IntVector_Intrinsics_vec512_and(x311, mask261);
+  Lib_IntVector_Intrinsics_vec512 x421 = Lib_IntVector_Intrinsics_vec512_add64(x411, z031);
+  Lib_IntVector_Intrinsics_vec512 r30 = x021;
+  Lib_IntVector_Intrinsics_vec512 r31 = x121;
+  Lib_IntVector_Intrinsics_vec512 r32 = x211;
+  Lib_IntVector_Intrinsics_vec512 r33 = x321;
+  Lib_IntVector_Intrinsics_vec512 r34 = x421;
+  Lib_IntVector_Intrinsics_vec512 a0110 = Lib_IntVector_Intrinsics_vec512_mul64(r10, r30);
+  Lib_IntVector_Intrinsics_vec512 a1110 = Lib_IntVector_Intrinsics_vec512_mul64(r11, r30);
+  Lib_IntVector_Intrinsics_vec512 a2110 = Lib_IntVector_Intrinsics_vec512_mul64(r12, r30);
+  Lib_IntVector_Intrinsics_vec512 a3110 = Lib_IntVector_Intrinsics_vec512_mul64(r13, r30);
+  Lib_IntVector_Intrinsics_vec512 a4110 = Lib_IntVector_Intrinsics_vec512_mul64(r14, r30);
+  Lib_IntVector_Intrinsics_vec512
+  a0211 =
+    Lib_IntVector_Intrinsics_vec512_add64(a0110,
+      Lib_IntVector_Intrinsics_vec512_mul64(r154, r31));
+  Lib_IntVector_Intrinsics_vec512
+  a1211 =
+    Lib_IntVector_Intrinsics_vec512_add64(a1110,
+      Lib_IntVector_Intrinsics_vec512_mul64(r10, r31));
+  Lib_IntVector_Intrinsics_vec512
+  a2211 =
+    Lib_IntVector_Intrinsics_vec512_add64(a2110,
+      Lib_IntVector_Intrinsics_vec512_mul64(r11, r31));
+  Lib_IntVector_Intrinsics_vec512
+  a3211 =
+    Lib_IntVector_Intrinsics_vec512_add64(a3110,
+      Lib_IntVector_Intrinsics_vec512_mul64(r12, r31));
+  Lib_IntVector_Intrinsics_vec512
+  a4211 =
+    Lib_IntVector_Intrinsics_vec512_add64(a4110,
+      Lib_IntVector_Intrinsics_vec512_mul64(r13, r31));
+  Lib_IntVector_Intrinsics_vec512
+  a0311 =
+    Lib_IntVector_Intrinsics_vec512_add64(a0211,
+      Lib_IntVector_Intrinsics_vec512_mul64(r153, r32));
+  Lib_IntVector_Intrinsics_vec512
+  a1311 =
+    Lib_IntVector_Intrinsics_vec512_add64(a1211,
+      Lib_IntVector_Intrinsics_vec512_mul64(r154, r32));
+  Lib_IntVector_Intrinsics_vec512
+  a2311 =
+    Lib_IntVector_Intrinsics_vec512_add64(a2211,
+      Lib_IntVector_Intrinsics_vec512_mul64(r10, r32));
+  Lib_IntVector_Intrinsics_vec512
+  a3311 =
+    Lib_IntVector_Intrinsics_vec512_add64(a3211,
+      Lib_IntVector_Intrinsics_vec512_mul64(r11, r32));
+  Lib_IntVector_Intrinsics_vec512
+  a4311 =
+    Lib_IntVector_Intrinsics_vec512_add64(a4211,
+      Lib_IntVector_Intrinsics_vec512_mul64(r12, r32));
+  Lib_IntVector_Intrinsics_vec512
+  a0411 =
+    Lib_IntVector_Intrinsics_vec512_add64(a0311,
+      Lib_IntVector_Intrinsics_vec512_mul64(r152, r33));
+  Lib_IntVector_Intrinsics_vec512
+  a1411 =
+    Lib_IntVector_Intrinsics_vec512_add64(a1311,
+      Lib_IntVector_Intrinsics_vec512_mul64(r153, r33));
+  Lib_IntVector_Intrinsics_vec512
+  a2411 =
+    Lib_IntVector_Intrinsics_vec512_add64(a2311,
+      Lib_IntVector_Intrinsics_vec512_mul64(r154, r33));
+  Lib_IntVector_Intrinsics_vec512
+  a3411 =
+    Lib_IntVector_Intrinsics_vec512_add64(a3311,
+      Lib_IntVector_Intrinsics_vec512_mul64(r10, r33));
+  Lib_IntVector_Intrinsics_vec512
+  a4411 =
+    Lib_IntVector_Intrinsics_vec512_add64(a4311,
+      Lib_IntVector_Intrinsics_vec512_mul64(r11, r33));
+  Lib_IntVector_Intrinsics_vec512
+  a0511 =
+    Lib_IntVector_Intrinsics_vec512_add64(a0411,
+      Lib_IntVector_Intrinsics_vec512_mul64(r151, r34));
+  Lib_IntVector_Intrinsics_vec512
+  a1511 =
+    Lib_IntVector_Intrinsics_vec512_add64(a1411,
+      Lib_IntVector_Intrinsics_vec512_mul64(r152, r34));
+  Lib_IntVector_Intrinsics_vec512
+  a2511 =
+    Lib_IntVector_Intrinsics_vec512_add64(a2411,
+      Lib_IntVector_Intrinsics_vec512_mul64(r153, r34));
+  Lib_IntVector_Intrinsics_vec512
+  a3511 =
+    Lib_IntVector_Intrinsics_vec512_add64(a3411,
+      Lib_IntVector_Intrinsics_vec512_mul64(r154, r34));
+  Lib_IntVector_Intrinsics_vec512
+  a4511 =
+    Lib_IntVector_Intrinsics_vec512_add64(a4411,
+      Lib_IntVector_Intrinsics_vec512_mul64(r10, r34));
+  Lib_IntVector_Intrinsics_vec512 t010 = a0511;
+  Lib_IntVector_Intrinsics_vec512 t110 = a1511;
+  Lib_IntVector_Intrinsics_vec512 t210 = a2511;
+  Lib_IntVector_Intrinsics_vec512 t310 = a3511;
+  Lib_IntVector_Intrinsics_vec512 t410 = a4511;
+  Lib_IntVector_Intrinsics_vec512
+  mask2611 = Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU);
+  Lib_IntVector_Intrinsics_vec512
+  z041 = Lib_IntVector_Intrinsics_vec512_shift_right64(t010, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z141 = Lib_IntVector_Intrinsics_vec512_shift_right64(t310, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x030 = Lib_IntVector_Intrinsics_vec512_and(t010, mask2611);
+  Lib_IntVector_Intrinsics_vec512 x330 = Lib_IntVector_Intrinsics_vec512_and(t310, mask2611);
+  Lib_IntVector_Intrinsics_vec512 x130 = Lib_IntVector_Intrinsics_vec512_add64(t110, z041);
+  Lib_IntVector_Intrinsics_vec512 x430 = Lib_IntVector_Intrinsics_vec512_add64(t410, z141);
+  Lib_IntVector_Intrinsics_vec512
+  z0111 = Lib_IntVector_Intrinsics_vec512_shift_right64(x130, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z1111 = Lib_IntVector_Intrinsics_vec512_shift_right64(x430, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  t61 = Lib_IntVector_Intrinsics_vec512_shift_left64(z1111, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec512 z1200 = Lib_IntVector_Intrinsics_vec512_add64(z1111, t61);
+  Lib_IntVector_Intrinsics_vec512 x1110 = Lib_IntVector_Intrinsics_vec512_and(x130, mask2611);
+  Lib_IntVector_Intrinsics_vec512 x4110 = Lib_IntVector_Intrinsics_vec512_and(x430, mask2611);
+  Lib_IntVector_Intrinsics_vec512 x220 = Lib_IntVector_Intrinsics_vec512_add64(t210, z0111);
+  Lib_IntVector_Intrinsics_vec512 x0110 = Lib_IntVector_Intrinsics_vec512_add64(x030, z1200);
+  Lib_IntVector_Intrinsics_vec512
+  z0211 = Lib_IntVector_Intrinsics_vec512_shift_right64(x220, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z1311 = Lib_IntVector_Intrinsics_vec512_shift_right64(x0110, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x2110 = Lib_IntVector_Intrinsics_vec512_and(x220, mask2611);
+  Lib_IntVector_Intrinsics_vec512 x0210 = Lib_IntVector_Intrinsics_vec512_and(x0110, mask2611);
+  Lib_IntVector_Intrinsics_vec512 x3110 = Lib_IntVector_Intrinsics_vec512_add64(x330, z0211);
+  Lib_IntVector_Intrinsics_vec512 x1210 = Lib_IntVector_Intrinsics_vec512_add64(x1110, z1311);
+  Lib_IntVector_Intrinsics_vec512
+  z0311 = Lib_IntVector_Intrinsics_vec512_shift_right64(x3110, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x3210 = Lib_IntVector_Intrinsics_vec512_and(x3110, mask2611);
+  Lib_IntVector_Intrinsics_vec512 x4210 = Lib_IntVector_Intrinsics_vec512_add64(x4110, z0311);
+  Lib_IntVector_Intrinsics_vec512 r40 = x0210;
+  Lib_IntVector_Intrinsics_vec512 r41 = x1210;
+  Lib_IntVector_Intrinsics_vec512 r42 = x2110;
+  Lib_IntVector_Intrinsics_vec512 r43 = x3210;
+  Lib_IntVector_Intrinsics_vec512 r44 = x4210;
+  Lib_IntVector_Intrinsics_vec512
+  v12120 = Lib_IntVector_Intrinsics_vec512_interleave_low64(r20, r10);
+  Lib_IntVector_Intrinsics_vec512
+  v34340 = Lib_IntVector_Intrinsics_vec512_interleave_low64(r40, r30);
+  Lib_IntVector_Intrinsics_vec512
+  r12340 = Lib_IntVector_Intrinsics_vec512_interleave_low128(v34340, v12120);
+  Lib_IntVector_Intrinsics_vec512
+  v12121 = Lib_IntVector_Intrinsics_vec512_interleave_low64(r21, r11);
+  Lib_IntVector_Intrinsics_vec512
+  v34341 = Lib_IntVector_Intrinsics_vec512_interleave_low64(r41, r31);
+  Lib_IntVector_Intrinsics_vec512
+  r12341 = Lib_IntVector_Intrinsics_vec512_interleave_low128(v34341, v12121);
+  Lib_IntVector_Intrinsics_vec512
+  v12122 = Lib_IntVector_Intrinsics_vec512_interleave_low64(r22, r12);
+  Lib_IntVector_Intrinsics_vec512
+  v34342 = Lib_IntVector_Intrinsics_vec512_interleave_low64(r42, r32);
+  Lib_IntVector_Intrinsics_vec512
+  r12342 = Lib_IntVector_Intrinsics_vec512_interleave_low128(v34342, v12122);
+  Lib_IntVector_Intrinsics_vec512
+  v12123 = Lib_IntVector_Intrinsics_vec512_interleave_low64(r23, r13);
+  Lib_IntVector_Intrinsics_vec512
+  v34343 = Lib_IntVector_Intrinsics_vec512_interleave_low64(r43, r33);
+  Lib_IntVector_Intrinsics_vec512
+  r12343 = Lib_IntVector_Intrinsics_vec512_interleave_low128(v34343, v12123);
+  Lib_IntVector_Intrinsics_vec512
+  v12124 = Lib_IntVector_Intrinsics_vec512_interleave_low64(r24, r14);
+  Lib_IntVector_Intrinsics_vec512
+  v34344 = Lib_IntVector_Intrinsics_vec512_interleave_low64(r44, r34);
+  Lib_IntVector_Intrinsics_vec512
+  r12344 = Lib_IntVector_Intrinsics_vec512_interleave_low128(v34344, v12124);
+  Lib_IntVector_Intrinsics_vec512
+  r4_51 = Lib_IntVector_Intrinsics_vec512_smul64(r41, (uint64_t)5U);
+  Lib_IntVector_Intrinsics_vec512
+  r4_52 = Lib_IntVector_Intrinsics_vec512_smul64(r42, (uint64_t)5U);
+  Lib_IntVector_Intrinsics_vec512
+  r4_53 = Lib_IntVector_Intrinsics_vec512_smul64(r43, (uint64_t)5U);
+  Lib_IntVector_Intrinsics_vec512
+  r4_54 = Lib_IntVector_Intrinsics_vec512_smul64(r44, (uint64_t)5U);
+  Lib_IntVector_Intrinsics_vec512 a0111 = Lib_IntVector_Intrinsics_vec512_mul64(r40, r12340);
+  Lib_IntVector_Intrinsics_vec512 a1111 = Lib_IntVector_Intrinsics_vec512_mul64(r41, r12340);
+  Lib_IntVector_Intrinsics_vec512 a2111 = Lib_IntVector_Intrinsics_vec512_mul64(r42, r12340);
+  Lib_IntVector_Intrinsics_vec512 a3111 = Lib_IntVector_Intrinsics_vec512_mul64(r43, r12340);
+  Lib_IntVector_Intrinsics_vec512 a4111 = Lib_IntVector_Intrinsics_vec512_mul64(r44, r12340);
+  Lib_IntVector_Intrinsics_vec512
+  a0213 =
+    Lib_IntVector_Intrinsics_vec512_add64(a0111,
+      Lib_IntVector_Intrinsics_vec512_mul64(r4_54, r12341));
+  Lib_IntVector_Intrinsics_vec512
+  a1213 =
+    Lib_IntVector_Intrinsics_vec512_add64(a1111,
+      Lib_IntVector_Intrinsics_vec512_mul64(r40, r12341));
+  Lib_IntVector_Intrinsics_vec512
+  a2213 =
+    Lib_IntVector_Intrinsics_vec512_add64(a2111,
+      Lib_IntVector_Intrinsics_vec512_mul64(r41, r12341));
+  Lib_IntVector_Intrinsics_vec512
+  a3213 =
+    Lib_IntVector_Intrinsics_vec512_add64(a3111,
+      Lib_IntVector_Intrinsics_vec512_mul64(r42, r12341));
+  Lib_IntVector_Intrinsics_vec512
+  a4213 =
+    Lib_IntVector_Intrinsics_vec512_add64(a4111,
+      Lib_IntVector_Intrinsics_vec512_mul64(r43, r12341));
+  Lib_IntVector_Intrinsics_vec512
+  a0313 =
+    Lib_IntVector_Intrinsics_vec512_add64(a0213,
+      Lib_IntVector_Intrinsics_vec512_mul64(r4_53, r12342));
+  Lib_IntVector_Intrinsics_vec512
+  a1313 =
+    Lib_IntVector_Intrinsics_vec512_add64(a1213,
+      Lib_IntVector_Intrinsics_vec512_mul64(r4_54, r12342));
+  Lib_IntVector_Intrinsics_vec512
+  a2313 =
+    Lib_IntVector_Intrinsics_vec512_add64(a2213,
+      Lib_IntVector_Intrinsics_vec512_mul64(r40, r12342));
+  Lib_IntVector_Intrinsics_vec512
+  a3313 =
+    Lib_IntVector_Intrinsics_vec512_add64(a3213,
+      Lib_IntVector_Intrinsics_vec512_mul64(r41, r12342));
+  Lib_IntVector_Intrinsics_vec512
+  a4313 =
+    Lib_IntVector_Intrinsics_vec512_add64(a4213,
+      Lib_IntVector_Intrinsics_vec512_mul64(r42, r12342));
+  Lib_IntVector_Intrinsics_vec512
+  a0413 =
+    Lib_IntVector_Intrinsics_vec512_add64(a0313,
+      Lib_IntVector_Intrinsics_vec512_mul64(r4_52, r12343));
+  Lib_IntVector_Intrinsics_vec512
+  a1413 =
+    Lib_IntVector_Intrinsics_vec512_add64(a1313,
+      Lib_IntVector_Intrinsics_vec512_mul64(r4_53, r12343));
+  Lib_IntVector_Intrinsics_vec512
+  a2413 =
+    Lib_IntVector_Intrinsics_vec512_add64(a2313,
+      Lib_IntVector_Intrinsics_vec512_mul64(r4_54, r12343));
+  Lib_IntVector_Intrinsics_vec512
+  a3413 =
+    Lib_IntVector_Intrinsics_vec512_add64(a3313,
+      Lib_IntVector_Intrinsics_vec512_mul64(r40, r12343));
+  Lib_IntVector_Intrinsics_vec512
+  a4413 =
+    Lib_IntVector_Intrinsics_vec512_add64(a4313,
+      Lib_IntVector_Intrinsics_vec512_mul64(r41, r12343));
+  Lib_IntVector_Intrinsics_vec512
+  a0513 =
+    Lib_IntVector_Intrinsics_vec512_add64(a0413,
+      Lib_IntVector_Intrinsics_vec512_mul64(r4_51, r12344));
+  Lib_IntVector_Intrinsics_vec512
+  a1513 =
+    Lib_IntVector_Intrinsics_vec512_add64(a1413,
+      Lib_IntVector_Intrinsics_vec512_mul64(r4_52, r12344));
+  Lib_IntVector_Intrinsics_vec512
+  a2513 =
+    Lib_IntVector_Intrinsics_vec512_add64(a2413,
+      Lib_IntVector_Intrinsics_vec512_mul64(r4_53, r12344));
+  Lib_IntVector_Intrinsics_vec512
+  a3513 =
+    Lib_IntVector_Intrinsics_vec512_add64(a3413,
+      Lib_IntVector_Intrinsics_vec512_mul64(r4_54, r12344));
+  Lib_IntVector_Intrinsics_vec512
+  a4513 =
+    Lib_IntVector_Intrinsics_vec512_add64(a4413,
+      Lib_IntVector_Intrinsics_vec512_mul64(r40, r12344));
+  Lib_IntVector_Intrinsics_vec512 t011 = a0513;
+  Lib_IntVector_Intrinsics_vec512 t111 = a1513;
+  Lib_IntVector_Intrinsics_vec512 t211 = a2513;
+  Lib_IntVector_Intrinsics_vec512 t311 = a3513;
+  Lib_IntVector_Intrinsics_vec512 t411 = a4513;
+  Lib_IntVector_Intrinsics_vec512
+  mask2613 = Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU);
+  Lib_IntVector_Intrinsics_vec512
+  z043 = Lib_IntVector_Intrinsics_vec512_shift_right64(t011, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z143 = Lib_IntVector_Intrinsics_vec512_shift_right64(t311, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x031 = Lib_IntVector_Intrinsics_vec512_and(t011, mask2613);
+  Lib_IntVector_Intrinsics_vec512 x331 = Lib_IntVector_Intrinsics_vec512_and(t311, mask2613);
+  Lib_IntVector_Intrinsics_vec512 x131 = Lib_IntVector_Intrinsics_vec512_add64(t111, z043);
+  Lib_IntVector_Intrinsics_vec512 x431 = Lib_IntVector_Intrinsics_vec512_add64(t411, z143);
+  Lib_IntVector_Intrinsics_vec512
+  z0113 = Lib_IntVector_Intrinsics_vec512_shift_right64(x131, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z1113 = Lib_IntVector_Intrinsics_vec512_shift_right64(x431, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  t63 = Lib_IntVector_Intrinsics_vec512_shift_left64(z1113, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec512 z1201 = Lib_IntVector_Intrinsics_vec512_add64(z1113, t63);
+  Lib_IntVector_Intrinsics_vec512 x1111 = Lib_IntVector_Intrinsics_vec512_and(x131, mask2613);
+  Lib_IntVector_Intrinsics_vec512 x4111 = Lib_IntVector_Intrinsics_vec512_and(x431, mask2613);
+  Lib_IntVector_Intrinsics_vec512 x221 = Lib_IntVector_Intrinsics_vec512_add64(t211, z0113);
+  Lib_IntVector_Intrinsics_vec512 x0111 = Lib_IntVector_Intrinsics_vec512_add64(x031, z1201);
+  Lib_IntVector_Intrinsics_vec512
+  z0213 = Lib_IntVector_Intrinsics_vec512_shift_right64(x221, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z1313 = Lib_IntVector_Intrinsics_vec512_shift_right64(x0111, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x2111 = Lib_IntVector_Intrinsics_vec512_and(x221, mask2613);
+  Lib_IntVector_Intrinsics_vec512 x0211 = Lib_IntVector_Intrinsics_vec512_and(x0111, mask2613);
+  Lib_IntVector_Intrinsics_vec512 x3111 = Lib_IntVector_Intrinsics_vec512_add64(x331, z0213);
+  Lib_IntVector_Intrinsics_vec512 x1211 = Lib_IntVector_Intrinsics_vec512_add64(x1111, z1313);
+  Lib_IntVector_Intrinsics_vec512
+  z0313 = Lib_IntVector_Intrinsics_vec512_shift_right64(x3111, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x3211 = Lib_IntVector_Intrinsics_vec512_and(x3111, mask2613);
+  Lib_IntVector_Intrinsics_vec512 x4211 = Lib_IntVector_Intrinsics_vec512_add64(x4111, z0313);
+  Lib_IntVector_Intrinsics_vec512 r56780 = x0211;
+  Lib_IntVector_Intrinsics_vec512 r56781 = x1211;
+  Lib_IntVector_Intrinsics_vec512 r56782 = x2111;
+  Lib_IntVector_Intrinsics_vec512 r56783 = x3211;
+  Lib_IntVector_Intrinsics_vec512 r56784 = x4211;
+  Lib_IntVector_Intrinsics_vec512
+  r123456780 = Lib_IntVector_Intrinsics_vec512_interleave_low256(r56780, r12340);
+  Lib_IntVector_Intrinsics_vec512
+  r123456781 = Lib_IntVector_Intrinsics_vec512_interleave_low256(r56781, r12341);
+  Lib_IntVector_Intrinsics_vec512
+  r123456782 = Lib_IntVector_Intrinsics_vec512_interleave_low256(r56782, r12342);
+  Lib_IntVector_Intrinsics_vec512
+  r123456783 = Lib_IntVector_Intrinsics_vec512_interleave_low256(r56783, r12343);
+  Lib_IntVector_Intrinsics_vec512
+  r123456784 = Lib_IntVector_Intrinsics_vec512_interleave_low256(r56784, r12344);
+  Lib_IntVector_Intrinsics_vec512
+  r1234567851 = Lib_IntVector_Intrinsics_vec512_smul64(r123456781, (uint64_t)5U);
+  Lib_IntVector_Intrinsics_vec512
+  r1234567852 = Lib_IntVector_Intrinsics_vec512_smul64(r123456782, (uint64_t)5U);
+  Lib_IntVector_Intrinsics_vec512
+  r1234567853 = Lib_IntVector_Intrinsics_vec512_smul64(r123456783, (uint64_t)5U);
+  Lib_IntVector_Intrinsics_vec512
+  r1234567854 = Lib_IntVector_Intrinsics_vec512_smul64(r123456784, (uint64_t)5U);
+  Lib_IntVector_Intrinsics_vec512 a01 = Lib_IntVector_Intrinsics_vec512_mul64(r123456780, a0);
+  Lib_IntVector_Intrinsics_vec512 a11 = Lib_IntVector_Intrinsics_vec512_mul64(r123456781, a0);
+  Lib_IntVector_Intrinsics_vec512 a21 = Lib_IntVector_Intrinsics_vec512_mul64(r123456782, a0);
+  Lib_IntVector_Intrinsics_vec512 a31 = Lib_IntVector_Intrinsics_vec512_mul64(r123456783, a0);
+  Lib_IntVector_Intrinsics_vec512 a41 = Lib_IntVector_Intrinsics_vec512_mul64(r123456784, a0);
+  Lib_IntVector_Intrinsics_vec512
+  a02 =
+    Lib_IntVector_Intrinsics_vec512_add64(a01,
+      Lib_IntVector_Intrinsics_vec512_mul64(r1234567854, a1));
+  Lib_IntVector_Intrinsics_vec512
+  a12 =
+    Lib_IntVector_Intrinsics_vec512_add64(a11,
+      Lib_IntVector_Intrinsics_vec512_mul64(r123456780, a1));
+  Lib_IntVector_Intrinsics_vec512
+  a22 =
+    Lib_IntVector_Intrinsics_vec512_add64(a21,
+      Lib_IntVector_Intrinsics_vec512_mul64(r123456781, a1));
+  Lib_IntVector_Intrinsics_vec512
+  a32 =
+    Lib_IntVector_Intrinsics_vec512_add64(a31,
+      Lib_IntVector_Intrinsics_vec512_mul64(r123456782, a1));
+  Lib_IntVector_Intrinsics_vec512
+  a42 =
+    Lib_IntVector_Intrinsics_vec512_add64(a41,
+      Lib_IntVector_Intrinsics_vec512_mul64(r123456783, a1));
+  Lib_IntVector_Intrinsics_vec512
+  a03 =
+    Lib_IntVector_Intrinsics_vec512_add64(a02,
+      Lib_IntVector_Intrinsics_vec512_mul64(r1234567853, a2));
+  Lib_IntVector_Intrinsics_vec512
+  a13 =
+    Lib_IntVector_Intrinsics_vec512_add64(a12,
+      Lib_IntVector_Intrinsics_vec512_mul64(r1234567854, a2));
+  Lib_IntVector_Intrinsics_vec512
+  a23 =
+    Lib_IntVector_Intrinsics_vec512_add64(a22,
+      Lib_IntVector_Intrinsics_vec512_mul64(r123456780, a2));
+  Lib_IntVector_Intrinsics_vec512
+  a33 =
+    Lib_IntVector_Intrinsics_vec512_add64(a32,
+      Lib_IntVector_Intrinsics_vec512_mul64(r123456781, a2));
+  Lib_IntVector_Intrinsics_vec512
+  a43 =
+    Lib_IntVector_Intrinsics_vec512_add64(a42,
+      Lib_IntVector_Intrinsics_vec512_mul64(r123456782, a2));
+  Lib_IntVector_Intrinsics_vec512
+  a04 =
+    Lib_IntVector_Intrinsics_vec512_add64(a03,
+      Lib_IntVector_Intrinsics_vec512_mul64(r1234567852, a3));
+  Lib_IntVector_Intrinsics_vec512
+  a14 =
+    Lib_IntVector_Intrinsics_vec512_add64(a13,
+      Lib_IntVector_Intrinsics_vec512_mul64(r1234567853, a3));
+  Lib_IntVector_Intrinsics_vec512
+  a24 =
+    Lib_IntVector_Intrinsics_vec512_add64(a23,
+      Lib_IntVector_Intrinsics_vec512_mul64(r1234567854, a3));
+  Lib_IntVector_Intrinsics_vec512
+  a34 =
+    Lib_IntVector_Intrinsics_vec512_add64(a33,
+      Lib_IntVector_Intrinsics_vec512_mul64(r123456780, a3));
+  Lib_IntVector_Intrinsics_vec512
+  a44 =
+    Lib_IntVector_Intrinsics_vec512_add64(a43,
+      Lib_IntVector_Intrinsics_vec512_mul64(r123456781, a3));
+  Lib_IntVector_Intrinsics_vec512
+  a05 =
+    Lib_IntVector_Intrinsics_vec512_add64(a04,
+      Lib_IntVector_Intrinsics_vec512_mul64(r1234567851, a4));
+  Lib_IntVector_Intrinsics_vec512
+  a15 =
+    Lib_IntVector_Intrinsics_vec512_add64(a14,
+      Lib_IntVector_Intrinsics_vec512_mul64(r1234567852, a4));
+  Lib_IntVector_Intrinsics_vec512
+  a25 =
+    Lib_IntVector_Intrinsics_vec512_add64(a24,
+      Lib_IntVector_Intrinsics_vec512_mul64(r1234567853, a4));
+  Lib_IntVector_Intrinsics_vec512
+  a35 =
+    Lib_IntVector_Intrinsics_vec512_add64(a34,
+      Lib_IntVector_Intrinsics_vec512_mul64(r1234567854, a4));
+  Lib_IntVector_Intrinsics_vec512
+  a45 =
+    Lib_IntVector_Intrinsics_vec512_add64(a44,
+      Lib_IntVector_Intrinsics_vec512_mul64(r123456780, a4));
+  Lib_IntVector_Intrinsics_vec512 t0 = a05;
+  Lib_IntVector_Intrinsics_vec512 t1 = a15;
+  Lib_IntVector_Intrinsics_vec512 t2 = a25;
+  Lib_IntVector_Intrinsics_vec512 t3 = a35;
+  Lib_IntVector_Intrinsics_vec512 t4 = a45;
+  Lib_IntVector_Intrinsics_vec512
+  mask26 = Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU);
+  Lib_IntVector_Intrinsics_vec512
+  z0 = Lib_IntVector_Intrinsics_vec512_shift_right64(t0, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z1 = Lib_IntVector_Intrinsics_vec512_shift_right64(t3, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x0 = Lib_IntVector_Intrinsics_vec512_and(t0, mask26);
+  Lib_IntVector_Intrinsics_vec512 x3 = Lib_IntVector_Intrinsics_vec512_and(t3, mask26);
+  Lib_IntVector_Intrinsics_vec512 x1 = Lib_IntVector_Intrinsics_vec512_add64(t1, z0);
+  Lib_IntVector_Intrinsics_vec512 x4 = Lib_IntVector_Intrinsics_vec512_add64(t4, z1);
+  Lib_IntVector_Intrinsics_vec512
+  z01 = Lib_IntVector_Intrinsics_vec512_shift_right64(x1, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z11 = Lib_IntVector_Intrinsics_vec512_shift_right64(x4, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  t = Lib_IntVector_Intrinsics_vec512_shift_left64(z11, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec512 z121 = Lib_IntVector_Intrinsics_vec512_add64(z11, t);
+  Lib_IntVector_Intrinsics_vec512 x11 = Lib_IntVector_Intrinsics_vec512_and(x1, mask26);
+  Lib_IntVector_Intrinsics_vec512 x41 = Lib_IntVector_Intrinsics_vec512_and(x4, mask26);
+  Lib_IntVector_Intrinsics_vec512 x2 = Lib_IntVector_Intrinsics_vec512_add64(t2, z01);
+  Lib_IntVector_Intrinsics_vec512 x01 = Lib_IntVector_Intrinsics_vec512_add64(x0, z121);
+  Lib_IntVector_Intrinsics_vec512
+  z02 = Lib_IntVector_Intrinsics_vec512_shift_right64(x2, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z13 = Lib_IntVector_Intrinsics_vec512_shift_right64(x01, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x21 = Lib_IntVector_Intrinsics_vec512_and(x2, mask26);
+  Lib_IntVector_Intrinsics_vec512 x02 = Lib_IntVector_Intrinsics_vec512_and(x01, mask26);
+  Lib_IntVector_Intrinsics_vec512 x31 = Lib_IntVector_Intrinsics_vec512_add64(x3, z02);
+  Lib_IntVector_Intrinsics_vec512 x12 = Lib_IntVector_Intrinsics_vec512_add64(x11, z13);
+  Lib_IntVector_Intrinsics_vec512
+  z03 = Lib_IntVector_Intrinsics_vec512_shift_right64(x31, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x32 = Lib_IntVector_Intrinsics_vec512_and(x31, mask26);
+  Lib_IntVector_Intrinsics_vec512 x42 = Lib_IntVector_Intrinsics_vec512_add64(x41, z03);
+  Lib_IntVector_Intrinsics_vec512 o0 = x02;
+  Lib_IntVector_Intrinsics_vec512 o10 = x12;
+  Lib_IntVector_Intrinsics_vec512 o20 = x21;
+  Lib_IntVector_Intrinsics_vec512 o30 = x32;
+  Lib_IntVector_Intrinsics_vec512 o40 = x42;
+  Lib_IntVector_Intrinsics_vec512
+  v00 = Lib_IntVector_Intrinsics_vec512_interleave_high256(o0, o0);
+  Lib_IntVector_Intrinsics_vec512 v10 = Lib_IntVector_Intrinsics_vec512_add64(o0, v00);
+  Lib_IntVector_Intrinsics_vec512
+  v01 = Lib_IntVector_Intrinsics_vec512_interleave_high256(o10, o10);
+  Lib_IntVector_Intrinsics_vec512 v11 = Lib_IntVector_Intrinsics_vec512_add64(o10, v01);
+  Lib_IntVector_Intrinsics_vec512
+  v02 = Lib_IntVector_Intrinsics_vec512_interleave_high256(o20, o20);
+  Lib_IntVector_Intrinsics_vec512 v12 = Lib_IntVector_Intrinsics_vec512_add64(o20, v02);
+  Lib_IntVector_Intrinsics_vec512
+  v03 = Lib_IntVector_Intrinsics_vec512_interleave_high256(o30, o30);
+  Lib_IntVector_Intrinsics_vec512 v13 = Lib_IntVector_Intrinsics_vec512_add64(o30, v03);
+  Lib_IntVector_Intrinsics_vec512
+  v04 = Lib_IntVector_Intrinsics_vec512_interleave_high256(o40, o40);
+  Lib_IntVector_Intrinsics_vec512 v14 = Lib_IntVector_Intrinsics_vec512_add64(o40, v04);
+  Lib_IntVector_Intrinsics_vec512
+  l = Lib_IntVector_Intrinsics_vec512_add64(v10, Lib_IntVector_Intrinsics_vec512_zero);
+  Lib_IntVector_Intrinsics_vec512
+  tmp0 =
+    Lib_IntVector_Intrinsics_vec512_and(l,
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  c0 = Lib_IntVector_Intrinsics_vec512_shift_right64(l, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 l0 = Lib_IntVector_Intrinsics_vec512_add64(v11, c0);
+  Lib_IntVector_Intrinsics_vec512
+  tmp1 =
+    Lib_IntVector_Intrinsics_vec512_and(l0,
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  c1 = Lib_IntVector_Intrinsics_vec512_shift_right64(l0, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 l1 = Lib_IntVector_Intrinsics_vec512_add64(v12, c1);
+  Lib_IntVector_Intrinsics_vec512
+  tmp2 =
+    Lib_IntVector_Intrinsics_vec512_and(l1,
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  c2 = Lib_IntVector_Intrinsics_vec512_shift_right64(l1, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 l2 = Lib_IntVector_Intrinsics_vec512_add64(v13, c2);
+  Lib_IntVector_Intrinsics_vec512
+  tmp3 =
+    Lib_IntVector_Intrinsics_vec512_and(l2,
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  c3 = Lib_IntVector_Intrinsics_vec512_shift_right64(l2, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 l3 = Lib_IntVector_Intrinsics_vec512_add64(v14, c3);
+  Lib_IntVector_Intrinsics_vec512
+  tmp4 =
+    Lib_IntVector_Intrinsics_vec512_and(l3,
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  c4 = Lib_IntVector_Intrinsics_vec512_shift_right64(l3, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  v101 =
+    Lib_IntVector_Intrinsics_vec512_add64(tmp0,
+      Lib_IntVector_Intrinsics_vec512_smul64(c4, (uint64_t)5U));
+  Lib_IntVector_Intrinsics_vec512 v111 = tmp1;
+  Lib_IntVector_Intrinsics_vec512 v121 = tmp2;
+  Lib_IntVector_Intrinsics_vec512 v131 = tmp3;
+  Lib_IntVector_Intrinsics_vec512 v141 = tmp4;
+  Lib_IntVector_Intrinsics_vec512
+  v10h = Lib_IntVector_Intrinsics_vec512_interleave_high128(v101, v101);
+  Lib_IntVector_Intrinsics_vec512 v20 = Lib_IntVector_Intrinsics_vec512_add64(v101, v10h);
+  Lib_IntVector_Intrinsics_vec512
+  v20h = Lib_IntVector_Intrinsics_vec512_interleave_high64(v20, v20);
+  Lib_IntVector_Intrinsics_vec512 v30 = Lib_IntVector_Intrinsics_vec512_add64(v20, v20h);
+  Lib_IntVector_Intrinsics_vec512
+  v11h = Lib_IntVector_Intrinsics_vec512_interleave_high128(v111, v111);
+  Lib_IntVector_Intrinsics_vec512 v21 = Lib_IntVector_Intrinsics_vec512_add64(v111, v11h);
+  Lib_IntVector_Intrinsics_vec512
+  v21h = Lib_IntVector_Intrinsics_vec512_interleave_high64(v21, v21);
+  Lib_IntVector_Intrinsics_vec512 v31 = Lib_IntVector_Intrinsics_vec512_add64(v21, v21h);
+  Lib_IntVector_Intrinsics_vec512
+  v12h = Lib_IntVector_Intrinsics_vec512_interleave_high128(v121, v121);
+  Lib_IntVector_Intrinsics_vec512 v22 = Lib_IntVector_Intrinsics_vec512_add64(v121, v12h);
+  Lib_IntVector_Intrinsics_vec512
+  v22h = Lib_IntVector_Intrinsics_vec512_interleave_high64(v22, v22);
+  Lib_IntVector_Intrinsics_vec512 v32 = Lib_IntVector_Intrinsics_vec512_add64(v22, v22h);
+  Lib_IntVector_Intrinsics_vec512
+  v13h = Lib_IntVector_Intrinsics_vec512_interleave_high128(v131, v131);
+  Lib_IntVector_Intrinsics_vec512 v23 = Lib_IntVector_Intrinsics_vec512_add64(v131, v13h);
+  Lib_IntVector_Intrinsics_vec512
+  v23h = Lib_IntVector_Intrinsics_vec512_interleave_high64(v23, v23);
+  Lib_IntVector_Intrinsics_vec512 v33 = Lib_IntVector_Intrinsics_vec512_add64(v23, v23h);
+  Lib_IntVector_Intrinsics_vec512
+  v14h = Lib_IntVector_Intrinsics_vec512_interleave_high128(v141, v141);
+  Lib_IntVector_Intrinsics_vec512 v24 = Lib_IntVector_Intrinsics_vec512_add64(v141, v14h);
+  Lib_IntVector_Intrinsics_vec512
+  v24h = Lib_IntVector_Intrinsics_vec512_interleave_high64(v24, v24);
+  Lib_IntVector_Intrinsics_vec512 v34 = Lib_IntVector_Intrinsics_vec512_add64(v24, v24h);
+  Lib_IntVector_Intrinsics_vec512
+  l4 = Lib_IntVector_Intrinsics_vec512_add64(v30, Lib_IntVector_Intrinsics_vec512_zero);
+  Lib_IntVector_Intrinsics_vec512
+  tmp00 =
+    Lib_IntVector_Intrinsics_vec512_and(l4,
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  c00 = Lib_IntVector_Intrinsics_vec512_shift_right64(l4, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 l5 = Lib_IntVector_Intrinsics_vec512_add64(v31, c00);
+  Lib_IntVector_Intrinsics_vec512
+  tmp10 =
+    Lib_IntVector_Intrinsics_vec512_and(l5,
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  c10 = Lib_IntVector_Intrinsics_vec512_shift_right64(l5, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 l6 = Lib_IntVector_Intrinsics_vec512_add64(v32, c10);
+  Lib_IntVector_Intrinsics_vec512
+  tmp20 =
+    Lib_IntVector_Intrinsics_vec512_and(l6,
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  c20 = Lib_IntVector_Intrinsics_vec512_shift_right64(l6, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 l7 = Lib_IntVector_Intrinsics_vec512_add64(v33, c20);
+  Lib_IntVector_Intrinsics_vec512
+  tmp30 =
+    Lib_IntVector_Intrinsics_vec512_and(l7,
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  c30 = Lib_IntVector_Intrinsics_vec512_shift_right64(l7, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 l8 = Lib_IntVector_Intrinsics_vec512_add64(v34, c30);
+  Lib_IntVector_Intrinsics_vec512
+  tmp40 =
+    Lib_IntVector_Intrinsics_vec512_and(l8,
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  c40 = Lib_IntVector_Intrinsics_vec512_shift_right64(l8, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  o00 =
+    Lib_IntVector_Intrinsics_vec512_add64(tmp00,
+      Lib_IntVector_Intrinsics_vec512_smul64(c40, (uint64_t)5U));
+  Lib_IntVector_Intrinsics_vec512 o1 = tmp10;
+  Lib_IntVector_Intrinsics_vec512 o2 = tmp20;
+  Lib_IntVector_Intrinsics_vec512 o3 = tmp30;
+  Lib_IntVector_Intrinsics_vec512 o4 = tmp40;
+  out[0U] = o00;
+  out[1U] = o1;
+  out[2U] = o2;
+  out[3U] = o3;
+  out[4U] = o4;
+}
+
+uint32_t Hacl_Poly1305_512_blocklen = (uint32_t)16U;
+
+void Hacl_Poly1305_512_poly1305_init(Lib_IntVector_Intrinsics_vec512 *ctx, uint8_t *key)
+{
+  Lib_IntVector_Intrinsics_vec512 *acc = ctx;
+  Lib_IntVector_Intrinsics_vec512 *pre = ctx + (uint32_t)5U;
+  uint8_t *kr = key;
+  acc[0U] = Lib_IntVector_Intrinsics_vec512_zero;
+  acc[1U] = Lib_IntVector_Intrinsics_vec512_zero;
+  acc[2U] = Lib_IntVector_Intrinsics_vec512_zero;
+  acc[3U] = Lib_IntVector_Intrinsics_vec512_zero;
+  acc[4U] = Lib_IntVector_Intrinsics_vec512_zero;
+  uint64_t u0 = load64_le(kr);
+  uint64_t lo = u0;
+  uint64_t u = load64_le(kr + (uint32_t)8U);
+  uint64_t hi = u;
+  uint64_t mask0 = (uint64_t)0x0ffffffc0fffffffU;
+  uint64_t mask1 = (uint64_t)0x0ffffffc0ffffffcU;
+  uint64_t lo1 = lo & mask0;
+  uint64_t hi1 = hi & mask1;
+  Lib_IntVector_Intrinsics_vec512 *r = pre;
+  Lib_IntVector_Intrinsics_vec512 *r5 = pre + (uint32_t)5U;
+  Lib_IntVector_Intrinsics_vec512 *rn = pre + (uint32_t)10U;
+  Lib_IntVector_Intrinsics_vec512 *rn_5 = pre + (uint32_t)15U;
+  Lib_IntVector_Intrinsics_vec512 r_vec0 = Lib_IntVector_Intrinsics_vec512_load64(lo1);
+  Lib_IntVector_Intrinsics_vec512 r_vec1 = Lib_IntVector_Intrinsics_vec512_load64(hi1);
+  Lib_IntVector_Intrinsics_vec512
+  f00 =
+    Lib_IntVector_Intrinsics_vec512_and(r_vec0,
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  f15 =
+    Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_shift_right64(r_vec0,
+        (uint32_t)26U),
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  f20 =
+    Lib_IntVector_Intrinsics_vec512_or(Lib_IntVector_Intrinsics_vec512_shift_right64(r_vec0,
+        (uint32_t)52U),
+      Lib_IntVector_Intrinsics_vec512_shift_left64(Lib_IntVector_Intrinsics_vec512_and(r_vec1,
+          Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3fffU)),
+        (uint32_t)12U));
+  Lib_IntVector_Intrinsics_vec512
+  f30 =
+    Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_shift_right64(r_vec1,
+        (uint32_t)14U),
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  f40 = Lib_IntVector_Intrinsics_vec512_shift_right64(r_vec1, (uint32_t)40U);
+  Lib_IntVector_Intrinsics_vec512 f0 = f00;
+  Lib_IntVector_Intrinsics_vec512 f1 = f15;
+  Lib_IntVector_Intrinsics_vec512 f2 = f20;
+  Lib_IntVector_Intrinsics_vec512 f3 = f30;
+  Lib_IntVector_Intrinsics_vec512 f4 = f40;
+  r[0U] = f0;
+  r[1U] = f1;
+  r[2U] = f2;
+  r[3U] = f3;
+  r[4U] = f4;
+  Lib_IntVector_Intrinsics_vec512 f200 = r[0U];
+  Lib_IntVector_Intrinsics_vec512 f210 = r[1U];
+  Lib_IntVector_Intrinsics_vec512 f220 = r[2U];
+  Lib_IntVector_Intrinsics_vec512 f230 = r[3U];
+  Lib_IntVector_Intrinsics_vec512 f240 = r[4U];
+  r5[0U] = Lib_IntVector_Intrinsics_vec512_smul64(f200, (uint64_t)5U);
+  r5[1U] = Lib_IntVector_Intrinsics_vec512_smul64(f210, (uint64_t)5U);
+  r5[2U] = Lib_IntVector_Intrinsics_vec512_smul64(f220, (uint64_t)5U);
+  r5[3U] = Lib_IntVector_Intrinsics_vec512_smul64(f230, (uint64_t)5U);
+  r5[4U] = Lib_IntVector_Intrinsics_vec512_smul64(f240, (uint64_t)5U);
+  Lib_IntVector_Intrinsics_vec512 r0 = r[0U];
+  Lib_IntVector_Intrinsics_vec512 r10 = r[1U];
+  Lib_IntVector_Intrinsics_vec512 r20 = r[2U];
+  Lib_IntVector_Intrinsics_vec512 r30 = r[3U];
+  Lib_IntVector_Intrinsics_vec512 r40 = r[4U];
+  Lib_IntVector_Intrinsics_vec512 r510 = r5[1U];
+  Lib_IntVector_Intrinsics_vec512 r520 = r5[2U];
+  Lib_IntVector_Intrinsics_vec512 r530 = r5[3U];
+  Lib_IntVector_Intrinsics_vec512 r540 = r5[4U];
+  Lib_IntVector_Intrinsics_vec512 f100 = r[0U];
+  Lib_IntVector_Intrinsics_vec512 f110 = r[1U];
+  Lib_IntVector_Intrinsics_vec512 f120 = r[2U];
+  Lib_IntVector_Intrinsics_vec512 f130 = r[3U];
+  Lib_IntVector_Intrinsics_vec512 f140 = r[4U];
+  Lib_IntVector_Intrinsics_vec512 a00 = Lib_IntVector_Intrinsics_vec512_mul64(r0, f100);
+  Lib_IntVector_Intrinsics_vec512 a10 = Lib_IntVector_Intrinsics_vec512_mul64(r10, f100);
+  Lib_IntVector_Intrinsics_vec512 a20 = Lib_IntVector_Intrinsics_vec512_mul64(r20, f100);
+  Lib_IntVector_Intrinsics_vec512 a30 = Lib_IntVector_Intrinsics_vec512_mul64(r30, f100);
+  Lib_IntVector_Intrinsics_vec512 a40 = Lib_IntVector_Intrinsics_vec512_mul64(r40, f100);
+  Lib_IntVector_Intrinsics_vec512
+  a010 =
+    Lib_IntVector_Intrinsics_vec512_add64(a00,
+      Lib_IntVector_Intrinsics_vec512_mul64(r540, f110));
+  Lib_IntVector_Intrinsics_vec512
+  a110 =
+    Lib_IntVector_Intrinsics_vec512_add64(a10,
+      Lib_IntVector_Intrinsics_vec512_mul64(r0, f110));
+  Lib_IntVector_Intrinsics_vec512
+  a210 =
+    Lib_IntVector_Intrinsics_vec512_add64(a20,
+      Lib_IntVector_Intrinsics_vec512_mul64(r10, f110));
+  Lib_IntVector_Intrinsics_vec512
+  a310 =
+    Lib_IntVector_Intrinsics_vec512_add64(a30,
+      Lib_IntVector_Intrinsics_vec512_mul64(r20, f110));
+  Lib_IntVector_Intrinsics_vec512
+  a410 =
+    Lib_IntVector_Intrinsics_vec512_add64(a40,
+      Lib_IntVector_Intrinsics_vec512_mul64(r30, f110));
+  Lib_IntVector_Intrinsics_vec512
+  a020 =
+    Lib_IntVector_Intrinsics_vec512_add64(a010,
+      Lib_IntVector_Intrinsics_vec512_mul64(r530, f120));
+  Lib_IntVector_Intrinsics_vec512
+  a120 =
+    Lib_IntVector_Intrinsics_vec512_add64(a110,
+      Lib_IntVector_Intrinsics_vec512_mul64(r540, f120));
+  Lib_IntVector_Intrinsics_vec512
+  a220 =
+    Lib_IntVector_Intrinsics_vec512_add64(a210,
+      Lib_IntVector_Intrinsics_vec512_mul64(r0, f120));
+  Lib_IntVector_Intrinsics_vec512
+  a320 =
+    Lib_IntVector_Intrinsics_vec512_add64(a310,
+      Lib_IntVector_Intrinsics_vec512_mul64(r10, f120));
+  Lib_IntVector_Intrinsics_vec512
+  a420 =
+    Lib_IntVector_Intrinsics_vec512_add64(a410,
+      Lib_IntVector_Intrinsics_vec512_mul64(r20, f120));
+  Lib_IntVector_Intrinsics_vec512
+  a030 =
+    Lib_IntVector_Intrinsics_vec512_add64(a020,
+      Lib_IntVector_Intrinsics_vec512_mul64(r520, f130));
+  Lib_IntVector_Intrinsics_vec512
+  a130 =
+    Lib_IntVector_Intrinsics_vec512_add64(a120,
+      Lib_IntVector_Intrinsics_vec512_mul64(r530, f130));
+  Lib_IntVector_Intrinsics_vec512
+  a230 =
+    Lib_IntVector_Intrinsics_vec512_add64(a220,
+      Lib_IntVector_Intrinsics_vec512_mul64(r540, f130));
+  Lib_IntVector_Intrinsics_vec512
+  a330 =
+    Lib_IntVector_Intrinsics_vec512_add64(a320,
+      Lib_IntVector_Intrinsics_vec512_mul64(r0, f130));
+  Lib_IntVector_Intrinsics_vec512
+  a430 =
+    Lib_IntVector_Intrinsics_vec512_add64(a420,
+      Lib_IntVector_Intrinsics_vec512_mul64(r10, f130));
+  Lib_IntVector_Intrinsics_vec512
+  a040 =
+    Lib_IntVector_Intrinsics_vec512_add64(a030,
+      Lib_IntVector_Intrinsics_vec512_mul64(r510, f140));
+  Lib_IntVector_Intrinsics_vec512
+  a140 =
+    Lib_IntVector_Intrinsics_vec512_add64(a130,
+      Lib_IntVector_Intrinsics_vec512_mul64(r520, f140));
+  Lib_IntVector_Intrinsics_vec512
+  a240 =
+    Lib_IntVector_Intrinsics_vec512_add64(a230,
+      Lib_IntVector_Intrinsics_vec512_mul64(r530, f140));
+  Lib_IntVector_Intrinsics_vec512
+  a340 =
+    Lib_IntVector_Intrinsics_vec512_add64(a330,
+      Lib_IntVector_Intrinsics_vec512_mul64(r540, f140));
+  Lib_IntVector_Intrinsics_vec512
+  a440 =
+    Lib_IntVector_Intrinsics_vec512_add64(a430,
+      Lib_IntVector_Intrinsics_vec512_mul64(r0, f140));
+  Lib_IntVector_Intrinsics_vec512 t00 = a040;
+  Lib_IntVector_Intrinsics_vec512 t10 = a140;
+  Lib_IntVector_Intrinsics_vec512 t20 = a240;
+  Lib_IntVector_Intrinsics_vec512 t30 = a340;
+  Lib_IntVector_Intrinsics_vec512 t40 = a440;
+  Lib_IntVector_Intrinsics_vec512
+  mask260 = Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU);
+  Lib_IntVector_Intrinsics_vec512
+  z00 = Lib_IntVector_Intrinsics_vec512_shift_right64(t00, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z10 = Lib_IntVector_Intrinsics_vec512_shift_right64(t30, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x00 = Lib_IntVector_Intrinsics_vec512_and(t00, mask260);
+  Lib_IntVector_Intrinsics_vec512 x30 = Lib_IntVector_Intrinsics_vec512_and(t30, mask260);
+  Lib_IntVector_Intrinsics_vec512 x10 = Lib_IntVector_Intrinsics_vec512_add64(t10, z00);
+  Lib_IntVector_Intrinsics_vec512 x40 = Lib_IntVector_Intrinsics_vec512_add64(t40, z10);
+  Lib_IntVector_Intrinsics_vec512
+  z010 = Lib_IntVector_Intrinsics_vec512_shift_right64(x10, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z110 = Lib_IntVector_Intrinsics_vec512_shift_right64(x40, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  t5 = Lib_IntVector_Intrinsics_vec512_shift_left64(z110, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec512 z12 = Lib_IntVector_Intrinsics_vec512_add64(z110, t5);
+  Lib_IntVector_Intrinsics_vec512 x110 = Lib_IntVector_Intrinsics_vec512_and(x10, mask260);
+  Lib_IntVector_Intrinsics_vec512 x410 = Lib_IntVector_Intrinsics_vec512_and(x40, mask260);
+  Lib_IntVector_Intrinsics_vec512 x20 = Lib_IntVector_Intrinsics_vec512_add64(t20, z010);
+  Lib_IntVector_Intrinsics_vec512 x010 = Lib_IntVector_Intrinsics_vec512_add64(x00, z12);
+  Lib_IntVector_Intrinsics_vec512
+  z020 = Lib_IntVector_Intrinsics_vec512_shift_right64(x20, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z130 = Lib_IntVector_Intrinsics_vec512_shift_right64(x010, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x210 = Lib_IntVector_Intrinsics_vec512_and(x20, mask260);
+  Lib_IntVector_Intrinsics_vec512 x020 = Lib_IntVector_Intrinsics_vec512_and(x010, mask260);
+  Lib_IntVector_Intrinsics_vec512 x310 = Lib_IntVector_Intrinsics_vec512_add64(x30, z020);
+  Lib_IntVector_Intrinsics_vec512 x120 = Lib_IntVector_Intrinsics_vec512_add64(x110, z130);
+  Lib_IntVector_Intrinsics_vec512
+  z030 = Lib_IntVector_Intrinsics_vec512_shift_right64(x310, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x320 = Lib_IntVector_Intrinsics_vec512_and(x310, mask260);
+  Lib_IntVector_Intrinsics_vec512 x420 = Lib_IntVector_Intrinsics_vec512_add64(x410, z030);
+  Lib_IntVector_Intrinsics_vec512 o00 = x020;
+  Lib_IntVector_Intrinsics_vec512 o10 = x120;
+  Lib_IntVector_Intrinsics_vec512 o20 = x210;
+  Lib_IntVector_Intrinsics_vec512 o30 = x320;
+  Lib_IntVector_Intrinsics_vec512 o40 = x420;
+  rn[0U] = o00;
+  rn[1U] = o10;
+  rn[2U] = o20;
+  rn[3U] = o30;
+  rn[4U] = o40;
+  Lib_IntVector_Intrinsics_vec512 f201 = rn[0U];
+  Lib_IntVector_Intrinsics_vec512 f211 = rn[1U];
+  Lib_IntVector_Intrinsics_vec512 f221 = rn[2U];
+  Lib_IntVector_Intrinsics_vec512 f231 = rn[3U];
+  Lib_IntVector_Intrinsics_vec512 f241 = rn[4U];
+  rn_5[0U] = Lib_IntVector_Intrinsics_vec512_smul64(f201, (uint64_t)5U);
+  rn_5[1U] = Lib_IntVector_Intrinsics_vec512_smul64(f211, (uint64_t)5U);
+  rn_5[2U] = Lib_IntVector_Intrinsics_vec512_smul64(f221, (uint64_t)5U);
+  rn_5[3U] = Lib_IntVector_Intrinsics_vec512_smul64(f231, (uint64_t)5U);
+  rn_5[4U] = Lib_IntVector_Intrinsics_vec512_smul64(f241, (uint64_t)5U);
+  Lib_IntVector_Intrinsics_vec512 r00 = rn[0U];
+  Lib_IntVector_Intrinsics_vec512 r1 = rn[1U];
+  Lib_IntVector_Intrinsics_vec512 r2 = rn[2U];
+  Lib_IntVector_Intrinsics_vec512 r3 = rn[3U];
+  Lib_IntVector_Intrinsics_vec512 r4 = rn[4U];
+  Lib_IntVector_Intrinsics_vec512 r51 = rn_5[1U];
+  Lib_IntVector_Intrinsics_vec512 r52 = rn_5[2U];
+  Lib_IntVector_Intrinsics_vec512 r53 = rn_5[3U];
+  Lib_IntVector_Intrinsics_vec512 r54 = rn_5[4U];
+  Lib_IntVector_Intrinsics_vec512 f10 = rn[0U];
+  Lib_IntVector_Intrinsics_vec512 f11 = rn[1U];
+  Lib_IntVector_Intrinsics_vec512 f12 = rn[2U];
+  Lib_IntVector_Intrinsics_vec512 f13 = rn[3U];
+  Lib_IntVector_Intrinsics_vec512 f14 = rn[4U];
+  Lib_IntVector_Intrinsics_vec512 a0 = Lib_IntVector_Intrinsics_vec512_mul64(r00, f10);
+  Lib_IntVector_Intrinsics_vec512 a1 = Lib_IntVector_Intrinsics_vec512_mul64(r1, f10);
+  Lib_IntVector_Intrinsics_vec512 a2 = Lib_IntVector_Intrinsics_vec512_mul64(r2, f10);
+  Lib_IntVector_Intrinsics_vec512 a3 = Lib_IntVector_Intrinsics_vec512_mul64(r3, f10);
+  Lib_IntVector_Intrinsics_vec512 a4 = Lib_IntVector_Intrinsics_vec512_mul64(r4, f10);
+  Lib_IntVector_Intrinsics_vec512
+  a01 =
+    Lib_IntVector_Intrinsics_vec512_add64(a0,
+      Lib_IntVector_Intrinsics_vec512_mul64(r54, f11));
+  Lib_IntVector_Intrinsics_vec512
+  a11 =
+    Lib_IntVector_Intrinsics_vec512_add64(a1,
+      Lib_IntVector_Intrinsics_vec512_mul64(r00, f11));
+  Lib_IntVector_Intrinsics_vec512
+  a21 = Lib_IntVector_Intrinsics_vec512_add64(a2, Lib_IntVector_Intrinsics_vec512_mul64(r1, f11));
+  Lib_IntVector_Intrinsics_vec512
+  a31 = Lib_IntVector_Intrinsics_vec512_add64(a3, Lib_IntVector_Intrinsics_vec512_mul64(r2, f11));
+  Lib_IntVector_Intrinsics_vec512
+  a41 = Lib_IntVector_Intrinsics_vec512_add64(a4, Lib_IntVector_Intrinsics_vec512_mul64(r3, f11));
+  Lib_IntVector_Intrinsics_vec512
+  a02 =
+    Lib_IntVector_Intrinsics_vec512_add64(a01,
+      Lib_IntVector_Intrinsics_vec512_mul64(r53, f12));
+  Lib_IntVector_Intrinsics_vec512
+  a12 =
+    Lib_IntVector_Intrinsics_vec512_add64(a11,
+      Lib_IntVector_Intrinsics_vec512_mul64(r54, f12));
+  Lib_IntVector_Intrinsics_vec512
+  a22 =
+    Lib_IntVector_Intrinsics_vec512_add64(a21,
+      Lib_IntVector_Intrinsics_vec512_mul64(r00, f12));
+  Lib_IntVector_Intrinsics_vec512
+  a32 =
+    Lib_IntVector_Intrinsics_vec512_add64(a31,
+      Lib_IntVector_Intrinsics_vec512_mul64(r1, f12));
+  Lib_IntVector_Intrinsics_vec512
+  a42 =
+    Lib_IntVector_Intrinsics_vec512_add64(a41,
+      Lib_IntVector_Intrinsics_vec512_mul64(r2, f12));
+  Lib_IntVector_Intrinsics_vec512
+  a03 =
+    Lib_IntVector_Intrinsics_vec512_add64(a02,
+      Lib_IntVector_Intrinsics_vec512_mul64(r52, f13));
+  Lib_IntVector_Intrinsics_vec512
+  a13 =
+    Lib_IntVector_Intrinsics_vec512_add64(a12,
+      Lib_IntVector_Intrinsics_vec512_mul64(r53, f13));
+  Lib_IntVector_Intrinsics_vec512
+  a23 =
+    Lib_IntVector_Intrinsics_vec512_add64(a22,
+      Lib_IntVector_Intrinsics_vec512_mul64(r54, f13));
+  Lib_IntVector_Intrinsics_vec512
+  a33 =
+    Lib_IntVector_Intrinsics_vec512_add64(a32,
+      Lib_IntVector_Intrinsics_vec512_mul64(r00, f13));
+  Lib_IntVector_Intrinsics_vec512
+  a43 =
+    Lib_IntVector_Intrinsics_vec512_add64(a42,
+      Lib_IntVector_Intrinsics_vec512_mul64(r1, f13));
+  Lib_IntVector_Intrinsics_vec512
+  a04 =
+    Lib_IntVector_Intrinsics_vec512_add64(a03,
+      Lib_IntVector_Intrinsics_vec512_mul64(r51, f14));
+  Lib_IntVector_Intrinsics_vec512
+  a14 =
+    Lib_IntVector_Intrinsics_vec512_add64(a13,
+      Lib_IntVector_Intrinsics_vec512_mul64(r52, f14));
+  Lib_IntVector_Intrinsics_vec512
+  a24 =
+    Lib_IntVector_Intrinsics_vec512_add64(a23,
+      Lib_IntVector_Intrinsics_vec512_mul64(r53, f14));
+  Lib_IntVector_Intrinsics_vec512
+  a34 =
+    Lib_IntVector_Intrinsics_vec512_add64(a33,
+      Lib_IntVector_Intrinsics_vec512_mul64(r54, f14));
+  Lib_IntVector_Intrinsics_vec512
+  a44 =
+    Lib_IntVector_Intrinsics_vec512_add64(a43,
+      Lib_IntVector_Intrinsics_vec512_mul64(r00, f14));
+  Lib_IntVector_Intrinsics_vec512 t0 = a04;
+  Lib_IntVector_Intrinsics_vec512 t1 = a14;
+  Lib_IntVector_Intrinsics_vec512 t2 = a24;
+  Lib_IntVector_Intrinsics_vec512 t3 = a34;
+  Lib_IntVector_Intrinsics_vec512 t4 = a44;
+  Lib_IntVector_Intrinsics_vec512
+  mask26 = Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU);
+  Lib_IntVector_Intrinsics_vec512
+  z0 = Lib_IntVector_Intrinsics_vec512_shift_right64(t0, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z1 = Lib_IntVector_Intrinsics_vec512_shift_right64(t3, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x0 = Lib_IntVector_Intrinsics_vec512_and(t0, mask26);
+  Lib_IntVector_Intrinsics_vec512 x3 = Lib_IntVector_Intrinsics_vec512_and(t3, mask26);
+  Lib_IntVector_Intrinsics_vec512 x1 = Lib_IntVector_Intrinsics_vec512_add64(t1, z0);
+  Lib_IntVector_Intrinsics_vec512 x4 = Lib_IntVector_Intrinsics_vec512_add64(t4, z1);
+  Lib_IntVector_Intrinsics_vec512
+  z01 = Lib_IntVector_Intrinsics_vec512_shift_right64(x1, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z11 = Lib_IntVector_Intrinsics_vec512_shift_right64(x4, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  t = Lib_IntVector_Intrinsics_vec512_shift_left64(z11, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec512 z120 = Lib_IntVector_Intrinsics_vec512_add64(z11, t);
+  Lib_IntVector_Intrinsics_vec512 x11 = Lib_IntVector_Intrinsics_vec512_and(x1, mask26);
+  Lib_IntVector_Intrinsics_vec512 x41 = Lib_IntVector_Intrinsics_vec512_and(x4, mask26);
+  Lib_IntVector_Intrinsics_vec512 x2 = Lib_IntVector_Intrinsics_vec512_add64(t2, z01);
+  Lib_IntVector_Intrinsics_vec512 x01 = Lib_IntVector_Intrinsics_vec512_add64(x0, z120);
+  Lib_IntVector_Intrinsics_vec512
+  z02 = Lib_IntVector_Intrinsics_vec512_shift_right64(x2, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z13 = Lib_IntVector_Intrinsics_vec512_shift_right64(x01, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x21 = Lib_IntVector_Intrinsics_vec512_and(x2, mask26);
+  Lib_IntVector_Intrinsics_vec512 x02 = Lib_IntVector_Intrinsics_vec512_and(x01, mask26);
+  Lib_IntVector_Intrinsics_vec512 x31 = Lib_IntVector_Intrinsics_vec512_add64(x3, z02);
+  Lib_IntVector_Intrinsics_vec512 x12 = Lib_IntVector_Intrinsics_vec512_add64(x11, z13);
+  Lib_IntVector_Intrinsics_vec512
+  z03 = Lib_IntVector_Intrinsics_vec512_shift_right64(x31, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x32 = Lib_IntVector_Intrinsics_vec512_and(x31, mask26);
+  Lib_IntVector_Intrinsics_vec512 x42 = Lib_IntVector_Intrinsics_vec512_add64(x41, z03);
+  Lib_IntVector_Intrinsics_vec512 o0 = x02;
+  Lib_IntVector_Intrinsics_vec512 o1 = x12;
+  Lib_IntVector_Intrinsics_vec512 o2 = x21;
+  Lib_IntVector_Intrinsics_vec512 o3 = x32;
+  Lib_IntVector_Intrinsics_vec512 o4 = x42;
+  rn[0U] = o0;
+  rn[1U] = o1;
+  rn[2U] = o2;
+  rn[3U] = o3;
+  rn[4U] = o4;
+  Lib_IntVector_Intrinsics_vec512 f202 = rn[0U];
+  Lib_IntVector_Intrinsics_vec512 f21 = rn[1U];
+  Lib_IntVector_Intrinsics_vec512 f22 = rn[2U];
+  Lib_IntVector_Intrinsics_vec512 f23 = rn[3U];
+  Lib_IntVector_Intrinsics_vec512 f24 = rn[4U];
+  rn_5[0U] = Lib_IntVector_Intrinsics_vec512_smul64(f202, (uint64_t)5U);
+  rn_5[1U] = Lib_IntVector_Intrinsics_vec512_smul64(f21, (uint64_t)5U);
+  rn_5[2U] = Lib_IntVector_Intrinsics_vec512_smul64(f22, (uint64_t)5U);
+  rn_5[3U] = Lib_IntVector_Intrinsics_vec512_smul64(f23, (uint64_t)5U);
+  rn_5[4U] = Lib_IntVector_Intrinsics_vec512_smul64(f24, (uint64_t)5U);
+  Lib_IntVector_Intrinsics_vec512 r000 = rn[0U];
+  Lib_IntVector_Intrinsics_vec512 r11 = rn[1U];
+  Lib_IntVector_Intrinsics_vec512 r21 = rn[2U];
+  Lib_IntVector_Intrinsics_vec512 r31 = rn[3U];
+  Lib_IntVector_Intrinsics_vec512 r41 = rn[4U];
+  Lib_IntVector_Intrinsics_vec512 r511 = rn_5[1U];
+  Lib_IntVector_Intrinsics_vec512 r521 = rn_5[2U];
+  Lib_IntVector_Intrinsics_vec512 r531 = rn_5[3U];
+  Lib_IntVector_Intrinsics_vec512 r541 = rn_5[4U];
+  Lib_IntVector_Intrinsics_vec512 f101 = rn[0U];
+  Lib_IntVector_Intrinsics_vec512 f111 = rn[1U];
+  Lib_IntVector_Intrinsics_vec512 f121 = rn[2U];
+  Lib_IntVector_Intrinsics_vec512 f131 = rn[3U];
+  Lib_IntVector_Intrinsics_vec512 f141 = rn[4U];
+  Lib_IntVector_Intrinsics_vec512 a05 = Lib_IntVector_Intrinsics_vec512_mul64(r000, f101);
+  Lib_IntVector_Intrinsics_vec512 a15 = Lib_IntVector_Intrinsics_vec512_mul64(r11, f101);
+  Lib_IntVector_Intrinsics_vec512 a25 = Lib_IntVector_Intrinsics_vec512_mul64(r21, f101);
+  Lib_IntVector_Intrinsics_vec512 a35 = Lib_IntVector_Intrinsics_vec512_mul64(r31, f101);
+  Lib_IntVector_Intrinsics_vec512 a45 = Lib_IntVector_Intrinsics_vec512_mul64(r41, f101);
+  Lib_IntVector_Intrinsics_vec512
+  a012 =
+    Lib_IntVector_Intrinsics_vec512_add64(a05,
+      Lib_IntVector_Intrinsics_vec512_mul64(r541, f111));
+  Lib_IntVector_Intrinsics_vec512
+  a112 =
+    Lib_IntVector_Intrinsics_vec512_add64(a15,
+      Lib_IntVector_Intrinsics_vec512_mul64(r000, f111));
+  Lib_IntVector_Intrinsics_vec512
+  a212 = Lib_IntVector_Intrinsics_vec512_add64(a25, Lib_IntVector_Intrinsics_vec512_mul64(r11, f111));
+  Lib_IntVector_Intrinsics_vec512
+  a312 = Lib_IntVector_Intrinsics_vec512_add64(a35, Lib_IntVector_Intrinsics_vec512_mul64(r21, f111));
+  Lib_IntVector_Intrinsics_vec512
+  a412 = Lib_IntVector_Intrinsics_vec512_add64(a45, Lib_IntVector_Intrinsics_vec512_mul64(r31, f111));
+  Lib_IntVector_Intrinsics_vec512
+  a022 =
+    Lib_IntVector_Intrinsics_vec512_add64(a012,
+      Lib_IntVector_Intrinsics_vec512_mul64(r531, f121));
+  Lib_IntVector_Intrinsics_vec512
+  a122 =
+    Lib_IntVector_Intrinsics_vec512_add64(a112,
+      Lib_IntVector_Intrinsics_vec512_mul64(r541, f121));
+  Lib_IntVector_Intrinsics_vec512
+  a222 =
+    Lib_IntVector_Intrinsics_vec512_add64(a212,
+      Lib_IntVector_Intrinsics_vec512_mul64(r000, f121));
+  Lib_IntVector_Intrinsics_vec512
+  a322 =
+    Lib_IntVector_Intrinsics_vec512_add64(a312,
+      Lib_IntVector_Intrinsics_vec512_mul64(r11, f121));
+  Lib_IntVector_Intrinsics_vec512
+  a422 =
+    Lib_IntVector_Intrinsics_vec512_add64(a412,
+      Lib_IntVector_Intrinsics_vec512_mul64(r21, f121));
+  Lib_IntVector_Intrinsics_vec512
+  a032 =
+    Lib_IntVector_Intrinsics_vec512_add64(a022,
+      Lib_IntVector_Intrinsics_vec512_mul64(r521, f131));
+  Lib_IntVector_Intrinsics_vec512
+  a132 =
+    Lib_IntVector_Intrinsics_vec512_add64(a122,
+      Lib_IntVector_Intrinsics_vec512_mul64(r531, f131));
+  Lib_IntVector_Intrinsics_vec512
+  a232 =
+    Lib_IntVector_Intrinsics_vec512_add64(a222,
+      Lib_IntVector_Intrinsics_vec512_mul64(r541, f131));
+  Lib_IntVector_Intrinsics_vec512
+  a332 =
+    Lib_IntVector_Intrinsics_vec512_add64(a322,
+      Lib_IntVector_Intrinsics_vec512_mul64(r000, f131));
+  Lib_IntVector_Intrinsics_vec512
+  a432 =
+    Lib_IntVector_Intrinsics_vec512_add64(a422,
+      Lib_IntVector_Intrinsics_vec512_mul64(r11, f131));
+  Lib_IntVector_Intrinsics_vec512
+  a042 =
+    Lib_IntVector_Intrinsics_vec512_add64(a032,
+      Lib_IntVector_Intrinsics_vec512_mul64(r511, f141));
+  Lib_IntVector_Intrinsics_vec512
+  a142 =
+    Lib_IntVector_Intrinsics_vec512_add64(a132,
+      Lib_IntVector_Intrinsics_vec512_mul64(r521, f141));
+  Lib_IntVector_Intrinsics_vec512
+  a242 =
+    Lib_IntVector_Intrinsics_vec512_add64(a232,
+      Lib_IntVector_Intrinsics_vec512_mul64(r531, f141));
+  Lib_IntVector_Intrinsics_vec512
+  a342 =
+    Lib_IntVector_Intrinsics_vec512_add64(a332,
+      Lib_IntVector_Intrinsics_vec512_mul64(r541, f141));
+  Lib_IntVector_Intrinsics_vec512
+  a442 =
+    Lib_IntVector_Intrinsics_vec512_add64(a432,
+      Lib_IntVector_Intrinsics_vec512_mul64(r000, f141));
+  Lib_IntVector_Intrinsics_vec512 t01 = a042;
+  Lib_IntVector_Intrinsics_vec512 t11 = a142;
+  Lib_IntVector_Intrinsics_vec512 t21 = a242;
+  Lib_IntVector_Intrinsics_vec512 t31 = a342;
+  Lib_IntVector_Intrinsics_vec512 t41 = a442;
+  Lib_IntVector_Intrinsics_vec512
+  mask262 = Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU);
+  Lib_IntVector_Intrinsics_vec512
+  z05 = Lib_IntVector_Intrinsics_vec512_shift_right64(t01, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z15 = Lib_IntVector_Intrinsics_vec512_shift_right64(t31, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x03 = Lib_IntVector_Intrinsics_vec512_and(t01, mask262);
+  Lib_IntVector_Intrinsics_vec512 x33 = Lib_IntVector_Intrinsics_vec512_and(t31, mask262);
+  Lib_IntVector_Intrinsics_vec512 x13 = Lib_IntVector_Intrinsics_vec512_add64(t11, z05);
+  Lib_IntVector_Intrinsics_vec512 x43 = Lib_IntVector_Intrinsics_vec512_add64(t41, z15);
+  Lib_IntVector_Intrinsics_vec512
+  z012 = Lib_IntVector_Intrinsics_vec512_shift_right64(x13, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z112 = Lib_IntVector_Intrinsics_vec512_shift_right64(x43, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  t7 = Lib_IntVector_Intrinsics_vec512_shift_left64(z112, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec512 z1200 = Lib_IntVector_Intrinsics_vec512_add64(z112, t7);
+  Lib_IntVector_Intrinsics_vec512 x111 = Lib_IntVector_Intrinsics_vec512_and(x13, mask262);
+  Lib_IntVector_Intrinsics_vec512 x411 = Lib_IntVector_Intrinsics_vec512_and(x43, mask262);
+  Lib_IntVector_Intrinsics_vec512 x22 = Lib_IntVector_Intrinsics_vec512_add64(t21, z012);
+  Lib_IntVector_Intrinsics_vec512 x011 = Lib_IntVector_Intrinsics_vec512_add64(x03, z1200);
+  Lib_IntVector_Intrinsics_vec512
+  z022 = Lib_IntVector_Intrinsics_vec512_shift_right64(x22, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z132 = Lib_IntVector_Intrinsics_vec512_shift_right64(x011, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x211 = Lib_IntVector_Intrinsics_vec512_and(x22, mask262);
+  Lib_IntVector_Intrinsics_vec512 x021 = Lib_IntVector_Intrinsics_vec512_and(x011, mask262);
+  Lib_IntVector_Intrinsics_vec512 x311 = Lib_IntVector_Intrinsics_vec512_add64(x33, z022);
+  Lib_IntVector_Intrinsics_vec512 x121 = Lib_IntVector_Intrinsics_vec512_add64(x111, z132);
+  Lib_IntVector_Intrinsics_vec512
+  z032 = Lib_IntVector_Intrinsics_vec512_shift_right64(x311, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x321 = Lib_IntVector_Intrinsics_vec512_and(x311, mask262);
+  Lib_IntVector_Intrinsics_vec512 x421 = Lib_IntVector_Intrinsics_vec512_add64(x411, z032);
+  Lib_IntVector_Intrinsics_vec512 o01 = x021;
+  Lib_IntVector_Intrinsics_vec512 o11 = x121;
+  Lib_IntVector_Intrinsics_vec512 o21 = x211;
+  Lib_IntVector_Intrinsics_vec512 o31 = x321;
+  Lib_IntVector_Intrinsics_vec512 o41 = x421;
+  rn[0U] = o01;
+  rn[1U] = o11;
+  rn[2U] = o21;
+  rn[3U] = o31;
+  rn[4U] = o41;
+  Lib_IntVector_Intrinsics_vec512 f2020 = rn[0U];
+  Lib_IntVector_Intrinsics_vec512 f212 = rn[1U];
+  Lib_IntVector_Intrinsics_vec512 f222 = rn[2U];
+  Lib_IntVector_Intrinsics_vec512 f232 = rn[3U];
+  Lib_IntVector_Intrinsics_vec512 f242 = rn[4U];
+  rn_5[0U] = Lib_IntVector_Intrinsics_vec512_smul64(f2020, (uint64_t)5U);
+  rn_5[1U] = Lib_IntVector_Intrinsics_vec512_smul64(f212, (uint64_t)5U);
+  rn_5[2U] = Lib_IntVector_Intrinsics_vec512_smul64(f222, (uint64_t)5U);
+  rn_5[3U] = Lib_IntVector_Intrinsics_vec512_smul64(f232, (uint64_t)5U);
+  rn_5[4U] = Lib_IntVector_Intrinsics_vec512_smul64(f242, (uint64_t)5U);
+}
+
+void Hacl_Poly1305_512_poly1305_update1(Lib_IntVector_Intrinsics_vec512 *ctx, uint8_t *text)
+{
+  Lib_IntVector_Intrinsics_vec512 *pre = ctx + (uint32_t)5U;
+  Lib_IntVector_Intrinsics_vec512 *acc = ctx;
+  Lib_IntVector_Intrinsics_vec512 e[5U];
+  for (uint32_t _i = 0U; _i < (uint32_t)5U; ++_i)
+    e[_i] = Lib_IntVector_Intrinsics_vec512_zero;
+  uint64_t u0 = load64_le(text);
+  uint64_t lo = u0;
+  uint64_t u = load64_le(text + (uint32_t)8U);
+  uint64_t hi = u;
+  Lib_IntVector_Intrinsics_vec512 f0 = Lib_IntVector_Intrinsics_vec512_load64(lo);
+  Lib_IntVector_Intrinsics_vec512 f1 = Lib_IntVector_Intrinsics_vec512_load64(hi);
+  Lib_IntVector_Intrinsics_vec512
+  f010 =
+    Lib_IntVector_Intrinsics_vec512_and(f0,
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  f110 =
+    Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_shift_right64(f0,
+        (uint32_t)26U),
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  f20 =
+    Lib_IntVector_Intrinsics_vec512_or(Lib_IntVector_Intrinsics_vec512_shift_right64(f0,
+        (uint32_t)52U),
+      Lib_IntVector_Intrinsics_vec512_shift_left64(Lib_IntVector_Intrinsics_vec512_and(f1,
+          Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3fffU)),
+        (uint32_t)12U));
+  Lib_IntVector_Intrinsics_vec512
+  f30 =
+    Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_shift_right64(f1,
+        (uint32_t)14U),
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  f40 = Lib_IntVector_Intrinsics_vec512_shift_right64(f1, (uint32_t)40U);
+  Lib_IntVector_Intrinsics_vec512 f01 = f010;
+  Lib_IntVector_Intrinsics_vec512 f111 = f110;
+  Lib_IntVector_Intrinsics_vec512 f2 = f20;
+  Lib_IntVector_Intrinsics_vec512 f3 = f30;
+  Lib_IntVector_Intrinsics_vec512 f41 = f40;
+  e[0U] = f01;
+  e[1U] = f111;
+  e[2U] = f2;
+  e[3U] = f3;
+  e[4U] = f41;
+  uint64_t b = (uint64_t)0x1000000U;
+  Lib_IntVector_Intrinsics_vec512 mask = Lib_IntVector_Intrinsics_vec512_load64(b);
+  Lib_IntVector_Intrinsics_vec512 f4 = e[4U];
+  e[4U] = Lib_IntVector_Intrinsics_vec512_or(f4, mask);
+  Lib_IntVector_Intrinsics_vec512 *r = pre;
+  Lib_IntVector_Intrinsics_vec512 *r5 = pre + (uint32_t)5U;
+  Lib_IntVector_Intrinsics_vec512 r0 = r[0U];
+  Lib_IntVector_Intrinsics_vec512 r1 = r[1U];
+  Lib_IntVector_Intrinsics_vec512 r2 = r[2U];
+  Lib_IntVector_Intrinsics_vec512 r3 = r[3U];
+  Lib_IntVector_Intrinsics_vec512 r4 = r[4U];
+  Lib_IntVector_Intrinsics_vec512 r51 = r5[1U];
+  Lib_IntVector_Intrinsics_vec512 r52 = r5[2U];
+  Lib_IntVector_Intrinsics_vec512 r53 = r5[3U];
+  Lib_IntVector_Intrinsics_vec512 r54 = r5[4U];
+  Lib_IntVector_Intrinsics_vec512 f10 = e[0U];
+  Lib_IntVector_Intrinsics_vec512 f11 = e[1U];
+  Lib_IntVector_Intrinsics_vec512 f12 = e[2U];
+  Lib_IntVector_Intrinsics_vec512 f13 = e[3U];
+  Lib_IntVector_Intrinsics_vec512 f14 = e[4U];
+  Lib_IntVector_Intrinsics_vec512 a0 = acc[0U];
+  Lib_IntVector_Intrinsics_vec512 a1 = acc[1U];
+  Lib_IntVector_Intrinsics_vec512 a2 = acc[2U];
+  Lib_IntVector_Intrinsics_vec512 a3 = acc[3U];
+  Lib_IntVector_Intrinsics_vec512 a4 = acc[4U];
+  Lib_IntVector_Intrinsics_vec512 a01 = Lib_IntVector_Intrinsics_vec512_add64(a0, f10);
+  Lib_IntVector_Intrinsics_vec512 a11 = Lib_IntVector_Intrinsics_vec512_add64(a1, f11);
+  Lib_IntVector_Intrinsics_vec512 a21 = Lib_IntVector_Intrinsics_vec512_add64(a2, f12);
+  Lib_IntVector_Intrinsics_vec512 a31 = Lib_IntVector_Intrinsics_vec512_add64(a3, f13);
+  Lib_IntVector_Intrinsics_vec512 a41 = Lib_IntVector_Intrinsics_vec512_add64(a4, f14);
+  Lib_IntVector_Intrinsics_vec512 a02 = Lib_IntVector_Intrinsics_vec512_mul64(r0, a01);
+  Lib_IntVector_Intrinsics_vec512 a12 = Lib_IntVector_Intrinsics_vec512_mul64(r1, a01);
+  Lib_IntVector_Intrinsics_vec512 a22 = Lib_IntVector_Intrinsics_vec512_mul64(r2, a01);
+  Lib_IntVector_Intrinsics_vec512 a32 = Lib_IntVector_Intrinsics_vec512_mul64(r3, a01);
+  Lib_IntVector_Intrinsics_vec512 a42 = Lib_IntVector_Intrinsics_vec512_mul64(r4, a01);
+  Lib_IntVector_Intrinsics_vec512
+  a03 =
+    Lib_IntVector_Intrinsics_vec512_add64(a02,
+      Lib_IntVector_Intrinsics_vec512_mul64(r54, a11));
+  Lib_IntVector_Intrinsics_vec512
+  a13 =
+    Lib_IntVector_Intrinsics_vec512_add64(a12,
+      Lib_IntVector_Intrinsics_vec512_mul64(r0, a11));
+  Lib_IntVector_Intrinsics_vec512
+  a23 =
+    Lib_IntVector_Intrinsics_vec512_add64(a22,
+      Lib_IntVector_Intrinsics_vec512_mul64(r1, a11));
+  Lib_IntVector_Intrinsics_vec512
+  a33 =
+    Lib_IntVector_Intrinsics_vec512_add64(a32,
+      Lib_IntVector_Intrinsics_vec512_mul64(r2, a11));
+  Lib_IntVector_Intrinsics_vec512
+  a43 =
+    Lib_IntVector_Intrinsics_vec512_add64(a42,
+      Lib_IntVector_Intrinsics_vec512_mul64(r3, a11));
+  Lib_IntVector_Intrinsics_vec512
+  a04 =
+    Lib_IntVector_Intrinsics_vec512_add64(a03,
+      Lib_IntVector_Intrinsics_vec512_mul64(r53, a21));
+  Lib_IntVector_Intrinsics_vec512
+  a14 =
+    Lib_IntVector_Intrinsics_vec512_add64(a13,
+      Lib_IntVector_Intrinsics_vec512_mul64(r54, a21));
+  Lib_IntVector_Intrinsics_vec512
+  a24 =
+    Lib_IntVector_Intrinsics_vec512_add64(a23,
+      Lib_IntVector_Intrinsics_vec512_mul64(r0, a21));
+  Lib_IntVector_Intrinsics_vec512
+  a34 =
+    Lib_IntVector_Intrinsics_vec512_add64(a33,
+      Lib_IntVector_Intrinsics_vec512_mul64(r1, a21));
+  Lib_IntVector_Intrinsics_vec512
+  a44 =
+    Lib_IntVector_Intrinsics_vec512_add64(a43,
+      Lib_IntVector_Intrinsics_vec512_mul64(r2, a21));
+  Lib_IntVector_Intrinsics_vec512
+  a05 =
+    Lib_IntVector_Intrinsics_vec512_add64(a04,
+      Lib_IntVector_Intrinsics_vec512_mul64(r52, a31));
+  Lib_IntVector_Intrinsics_vec512
+  a15 =
+    Lib_IntVector_Intrinsics_vec512_add64(a14,
+      Lib_IntVector_Intrinsics_vec512_mul64(r53, a31));
+  Lib_IntVector_Intrinsics_vec512
+  a25 =
+    Lib_IntVector_Intrinsics_vec512_add64(a24,
+      Lib_IntVector_Intrinsics_vec512_mul64(r54, a31));
+  Lib_IntVector_Intrinsics_vec512
+  a35 =
+    Lib_IntVector_Intrinsics_vec512_add64(a34,
+      Lib_IntVector_Intrinsics_vec512_mul64(r0, a31));
+  Lib_IntVector_Intrinsics_vec512
+  a45 =
+    Lib_IntVector_Intrinsics_vec512_add64(a44,
+      Lib_IntVector_Intrinsics_vec512_mul64(r1, a31));
+  Lib_IntVector_Intrinsics_vec512
+  a06 =
+    Lib_IntVector_Intrinsics_vec512_add64(a05,
+      Lib_IntVector_Intrinsics_vec512_mul64(r51, a41));
+  Lib_IntVector_Intrinsics_vec512
+  a16 =
+    Lib_IntVector_Intrinsics_vec512_add64(a15,
+      Lib_IntVector_Intrinsics_vec512_mul64(r52, a41));
+  Lib_IntVector_Intrinsics_vec512
+  a26 =
+    Lib_IntVector_Intrinsics_vec512_add64(a25,
+      Lib_IntVector_Intrinsics_vec512_mul64(r53, a41));
+  Lib_IntVector_Intrinsics_vec512
+  a36 =
+    Lib_IntVector_Intrinsics_vec512_add64(a35,
+      Lib_IntVector_Intrinsics_vec512_mul64(r54, a41));
+  Lib_IntVector_Intrinsics_vec512
+  a46 =
+    Lib_IntVector_Intrinsics_vec512_add64(a45,
+      Lib_IntVector_Intrinsics_vec512_mul64(r0, a41));
+  Lib_IntVector_Intrinsics_vec512 t0 = a06;
+  Lib_IntVector_Intrinsics_vec512 t1 = a16;
+  Lib_IntVector_Intrinsics_vec512 t2 = a26;
+  Lib_IntVector_Intrinsics_vec512 t3 = a36;
+  Lib_IntVector_Intrinsics_vec512 t4 = a46;
+  Lib_IntVector_Intrinsics_vec512
+  mask26 = Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU);
+  Lib_IntVector_Intrinsics_vec512
+  z0 = Lib_IntVector_Intrinsics_vec512_shift_right64(t0, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z1 = Lib_IntVector_Intrinsics_vec512_shift_right64(t3, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x0 = Lib_IntVector_Intrinsics_vec512_and(t0, mask26);
+  Lib_IntVector_Intrinsics_vec512 x3 = Lib_IntVector_Intrinsics_vec512_and(t3, mask26);
+  Lib_IntVector_Intrinsics_vec512 x1 = Lib_IntVector_Intrinsics_vec512_add64(t1, z0);
+  Lib_IntVector_Intrinsics_vec512 x4 = Lib_IntVector_Intrinsics_vec512_add64(t4, z1);
+  Lib_IntVector_Intrinsics_vec512
+  z01 = Lib_IntVector_Intrinsics_vec512_shift_right64(x1, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z11 = Lib_IntVector_Intrinsics_vec512_shift_right64(x4, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  t = Lib_IntVector_Intrinsics_vec512_shift_left64(z11, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec512 z12 = Lib_IntVector_Intrinsics_vec512_add64(z11, t);
+  Lib_IntVector_Intrinsics_vec512 x11 = Lib_IntVector_Intrinsics_vec512_and(x1, mask26);
+  Lib_IntVector_Intrinsics_vec512 x41 = Lib_IntVector_Intrinsics_vec512_and(x4, mask26);
+  Lib_IntVector_Intrinsics_vec512 x2 = Lib_IntVector_Intrinsics_vec512_add64(t2, z01);
+  Lib_IntVector_Intrinsics_vec512 x01 = Lib_IntVector_Intrinsics_vec512_add64(x0, z12);
+  Lib_IntVector_Intrinsics_vec512
+  z02 = Lib_IntVector_Intrinsics_vec512_shift_right64(x2, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  z13 = Lib_IntVector_Intrinsics_vec512_shift_right64(x01, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x21 = Lib_IntVector_Intrinsics_vec512_and(x2, mask26);
+  Lib_IntVector_Intrinsics_vec512 x02 = Lib_IntVector_Intrinsics_vec512_and(x01, mask26);
+  Lib_IntVector_Intrinsics_vec512 x31 = Lib_IntVector_Intrinsics_vec512_add64(x3, z02);
+  Lib_IntVector_Intrinsics_vec512 x12 = Lib_IntVector_Intrinsics_vec512_add64(x11, z13);
+  Lib_IntVector_Intrinsics_vec512
+  z03 = Lib_IntVector_Intrinsics_vec512_shift_right64(x31, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x32 = Lib_IntVector_Intrinsics_vec512_and(x31, mask26);
+  Lib_IntVector_Intrinsics_vec512 x42 = Lib_IntVector_Intrinsics_vec512_add64(x41, z03);
+  Lib_IntVector_Intrinsics_vec512 o0 = x02;
+  Lib_IntVector_Intrinsics_vec512 o1 = x12;
+  Lib_IntVector_Intrinsics_vec512 o2 = x21;
+  Lib_IntVector_Intrinsics_vec512 o3 = x32;
+  Lib_IntVector_Intrinsics_vec512 o4 = x42;
+  acc[0U] = o0;
+  acc[1U] = o1;
+  acc[2U] = o2;
+  acc[3U] = o3;
+  acc[4U] = o4;
+}
+
+void
+Hacl_Poly1305_512_poly1305_update(
+  Lib_IntVector_Intrinsics_vec512 *ctx,
+  uint32_t len,
+  uint8_t *text
+)
+{
+  Lib_IntVector_Intrinsics_vec512 *pre = ctx + (uint32_t)5U;
+  Lib_IntVector_Intrinsics_vec512 *acc = ctx;
+  uint32_t sz_block = (uint32_t)128U;
+  uint32_t len0 = len / sz_block * sz_block;
+  uint8_t *t0 = text;
+  if (len0 > (uint32_t)0U)
+  {
+    uint32_t bs = (uint32_t)128U;
+    uint8_t *text0 = t0;
+    Hacl_Impl_Poly1305_Field32xN_512_load_acc8(acc, text0);
+    uint32_t len1 = len0 - bs;
+    uint8_t *text1 = t0 + bs;
+    uint32_t nb = len1 / bs;
+    for (uint32_t i = (uint32_t)0U; i < nb; i++)
+    {
+      uint8_t *block = text1 + i * bs;
+      Lib_IntVector_Intrinsics_vec512 e[5U];
+      for (uint32_t _i = 0U; _i < (uint32_t)5U; ++_i)
+        e[_i] = Lib_IntVector_Intrinsics_vec512_zero;
+      Lib_IntVector_Intrinsics_vec512 lo = Lib_IntVector_Intrinsics_vec512_load_le(block);
+      Lib_IntVector_Intrinsics_vec512
+      hi = Lib_IntVector_Intrinsics_vec512_load_le(block + (uint32_t)64U);
+      Lib_IntVector_Intrinsics_vec512
+      mask260 = Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU);
+      Lib_IntVector_Intrinsics_vec512
+      lo0 = Lib_IntVector_Intrinsics_vec512_interleave_low256(lo, hi);
+      Lib_IntVector_Intrinsics_vec512
+      hi0 = Lib_IntVector_Intrinsics_vec512_interleave_high256(lo, hi);
+      Lib_IntVector_Intrinsics_vec512
+      m0 = Lib_IntVector_Intrinsics_vec512_interleave_low128(lo0, hi0);
+      Lib_IntVector_Intrinsics_vec512
+      m1 = Lib_IntVector_Intrinsics_vec512_interleave_high128(lo0, hi0);
+      Lib_IntVector_Intrinsics_vec512
+      m2 = Lib_IntVector_Intrinsics_vec512_shift_right(m0, (uint32_t)48U);
+      Lib_IntVector_Intrinsics_vec512
+      m3 = Lib_IntVector_Intrinsics_vec512_shift_right(m1, (uint32_t)48U);
+      Lib_IntVector_Intrinsics_vec512
+      m4 = Lib_IntVector_Intrinsics_vec512_interleave_high64(m0, m1);
+      Lib_IntVector_Intrinsics_vec512
+      t010 = Lib_IntVector_Intrinsics_vec512_interleave_low64(m0, m1);
+      Lib_IntVector_Intrinsics_vec512
+      t30 = Lib_IntVector_Intrinsics_vec512_interleave_low64(m2, m3);
+      Lib_IntVector_Intrinsics_vec512
+      t20 = Lib_IntVector_Intrinsics_vec512_shift_right64(t30, (uint32_t)4U);
+      Lib_IntVector_Intrinsics_vec512 o20 = Lib_IntVector_Intrinsics_vec512_and(t20, mask260);
+      Lib_IntVector_Intrinsics_vec512
+      t10 = Lib_IntVector_Intrinsics_vec512_shift_right64(t010, (uint32_t)26U);
+      Lib_IntVector_Intrinsics_vec512 o10 = Lib_IntVector_Intrinsics_vec512_and(t10, mask260);
+      Lib_IntVector_Intrinsics_vec512 o5 = Lib_IntVector_Intrinsics_vec512_and(t010, mask260);
+      Lib_IntVector_Intrinsics_vec512
+      t31 = Lib_IntVector_Intrinsics_vec512_shift_right64(t30, (uint32_t)30U);
+      Lib_IntVector_Intrinsics_vec512 o30 = Lib_IntVector_Intrinsics_vec512_and(t31, mask260);
+      Lib_IntVector_Intrinsics_vec512
+      o40 = Lib_IntVector_Intrinsics_vec512_shift_right64(m4, (uint32_t)40U);
+      Lib_IntVector_Intrinsics_vec512 o00 = o5;
+      Lib_IntVector_Intrinsics_vec512 o11 = o10;
+      Lib_IntVector_Intrinsics_vec512 o21 = o20;
+      Lib_IntVector_Intrinsics_vec512 o31 = o30;
+      Lib_IntVector_Intrinsics_vec512 o41 = o40;
+      e[0U] = o00;
+      e[1U] = o11;
+      e[2U] = o21;
+      e[3U] = o31;
+      e[4U] = o41;
+      uint64_t b = (uint64_t)0x1000000U;
+      Lib_IntVector_Intrinsics_vec512 mask = Lib_IntVector_Intrinsics_vec512_load64(b);
+      Lib_IntVector_Intrinsics_vec512 f4 = e[4U];
+      e[4U] = Lib_IntVector_Intrinsics_vec512_or(f4, mask);
+      Lib_IntVector_Intrinsics_vec512 *rn = pre + (uint32_t)10U;
+      Lib_IntVector_Intrinsics_vec512 *rn5 = pre + (uint32_t)15U;
+      Lib_IntVector_Intrinsics_vec512 r0 = rn[0U];
+      Lib_IntVector_Intrinsics_vec512 r1 = rn[1U];
+      Lib_IntVector_Intrinsics_vec512 r2 = rn[2U];
+      Lib_IntVector_Intrinsics_vec512 r3 = rn[3U];
+      Lib_IntVector_Intrinsics_vec512 r4 = rn[4U];
+      Lib_IntVector_Intrinsics_vec512 r51 = rn5[1U];
+      Lib_IntVector_Intrinsics_vec512 r52 = rn5[2U];
+      Lib_IntVector_Intrinsics_vec512 r53 = rn5[3U];
+      Lib_IntVector_Intrinsics_vec512 r54 = rn5[4U];
+      Lib_IntVector_Intrinsics_vec512 f10 = acc[0U];
+      Lib_IntVector_Intrinsics_vec512 f110 = acc[1U];
+      Lib_IntVector_Intrinsics_vec512 f120 = acc[2U];
+      Lib_IntVector_Intrinsics_vec512 f130 = acc[3U];
+      Lib_IntVector_Intrinsics_vec512 f140 = acc[4U];
+      Lib_IntVector_Intrinsics_vec512 a0 = Lib_IntVector_Intrinsics_vec512_mul64(r0, f10);
+      Lib_IntVector_Intrinsics_vec512 a1 = Lib_IntVector_Intrinsics_vec512_mul64(r1, f10);
+      Lib_IntVector_Intrinsics_vec512 a2 = Lib_IntVector_Intrinsics_vec512_mul64(r2, f10);
+      Lib_IntVector_Intrinsics_vec512 a3 = Lib_IntVector_Intrinsics_vec512_mul64(r3, f10);
+      Lib_IntVector_Intrinsics_vec512 a4 = Lib_IntVector_Intrinsics_vec512_mul64(r4, f10);
+      Lib_IntVector_Intrinsics_vec512
+      a01 =
+        Lib_IntVector_Intrinsics_vec512_add64(a0,
+          Lib_IntVector_Intrinsics_vec512_mul64(r54, f110));
+      Lib_IntVector_Intrinsics_vec512
+      a11 =
+        Lib_IntVector_Intrinsics_vec512_add64(a1,
+          Lib_IntVector_Intrinsics_vec512_mul64(r0, f110));
+      Lib_IntVector_Intrinsics_vec512
+      a21 =
+        Lib_IntVector_Intrinsics_vec512_add64(a2,
+          Lib_IntVector_Intrinsics_vec512_mul64(r1, f110));
+      Lib_IntVector_Intrinsics_vec512
+      a31 =
+        Lib_IntVector_Intrinsics_vec512_add64(a3,
+          Lib_IntVector_Intrinsics_vec512_mul64(r2, f110));
+      Lib_IntVector_Intrinsics_vec512
+      a41 =
+        Lib_IntVector_Intrinsics_vec512_add64(a4,
+          Lib_IntVector_Intrinsics_vec512_mul64(r3, f110));
+      Lib_IntVector_Intrinsics_vec512
+      a02 =
+        Lib_IntVector_Intrinsics_vec512_add64(a01,
+          Lib_IntVector_Intrinsics_vec512_mul64(r53, f120));
+      Lib_IntVector_Intrinsics_vec512
+      a12 =
+        Lib_IntVector_Intrinsics_vec512_add64(a11,
+          Lib_IntVector_Intrinsics_vec512_mul64(r54, f120));
+      Lib_IntVector_Intrinsics_vec512
+      a22 =
+        Lib_IntVector_Intrinsics_vec512_add64(a21,
+          Lib_IntVector_Intrinsics_vec512_mul64(r0, f120));
+      Lib_IntVector_Intrinsics_vec512
+      a32 =
+        Lib_IntVector_Intrinsics_vec512_add64(a31,
+          Lib_IntVector_Intrinsics_vec512_mul64(r1, f120));
+      Lib_IntVector_Intrinsics_vec512
+      a42 =
+        Lib_IntVector_Intrinsics_vec512_add64(a41,
+          Lib_IntVector_Intrinsics_vec512_mul64(r2, f120));
+      Lib_IntVector_Intrinsics_vec512
+      a03 =
+        Lib_IntVector_Intrinsics_vec512_add64(a02,
+          Lib_IntVector_Intrinsics_vec512_mul64(r52, f130));
+      Lib_IntVector_Intrinsics_vec512
+      a13 =
+        Lib_IntVector_Intrinsics_vec512_add64(a12,
+          Lib_IntVector_Intrinsics_vec512_mul64(r53, f130));
+      Lib_IntVector_Intrinsics_vec512
+      a23 =
+        Lib_IntVector_Intrinsics_vec512_add64(a22,
+          Lib_IntVector_Intrinsics_vec512_mul64(r54, f130));
+      Lib_IntVector_Intrinsics_vec512
+      a33 =
+        Lib_IntVector_Intrinsics_vec512_add64(a32,
+          Lib_IntVector_Intrinsics_vec512_mul64(r0, f130));
+      Lib_IntVector_Intrinsics_vec512
+      a43 =
+        Lib_IntVector_Intrinsics_vec512_add64(a42,
+          Lib_IntVector_Intrinsics_vec512_mul64(r1, f130));
+      Lib_IntVector_Intrinsics_vec512
+      a04 =
+        Lib_IntVector_Intrinsics_vec512_add64(a03,
+          Lib_IntVector_Intrinsics_vec512_mul64(r51, f140));
+      Lib_IntVector_Intrinsics_vec512
+      a14 =
+        Lib_IntVector_Intrinsics_vec512_add64(a13,
+          Lib_IntVector_Intrinsics_vec512_mul64(r52, f140));
+      Lib_IntVector_Intrinsics_vec512
+      a24 =
+        Lib_IntVector_Intrinsics_vec512_add64(a23,
+          Lib_IntVector_Intrinsics_vec512_mul64(r53, f140));
+      Lib_IntVector_Intrinsics_vec512
+      a34 =
+        Lib_IntVector_Intrinsics_vec512_add64(a33,
+          Lib_IntVector_Intrinsics_vec512_mul64(r54, f140));
+      Lib_IntVector_Intrinsics_vec512
+      a44 =
+        Lib_IntVector_Intrinsics_vec512_add64(a43,
+          Lib_IntVector_Intrinsics_vec512_mul64(r0, f140));
+      Lib_IntVector_Intrinsics_vec512 t01 = a04;
+      Lib_IntVector_Intrinsics_vec512 t1 = a14;
+      Lib_IntVector_Intrinsics_vec512 t2 = a24;
+      Lib_IntVector_Intrinsics_vec512 t3 = a34;
+      Lib_IntVector_Intrinsics_vec512 t4 = a44;
+      Lib_IntVector_Intrinsics_vec512
+      mask26 = Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU);
+      Lib_IntVector_Intrinsics_vec512
+      z0 = Lib_IntVector_Intrinsics_vec512_shift_right64(t01, (uint32_t)26U);
+      Lib_IntVector_Intrinsics_vec512
+      z1 = Lib_IntVector_Intrinsics_vec512_shift_right64(t3, (uint32_t)26U);
+      Lib_IntVector_Intrinsics_vec512 x0 = Lib_IntVector_Intrinsics_vec512_and(t01, mask26);
+      Lib_IntVector_Intrinsics_vec512 x3 = Lib_IntVector_Intrinsics_vec512_and(t3, mask26);
+      Lib_IntVector_Intrinsics_vec512 x1 = Lib_IntVector_Intrinsics_vec512_add64(t1, z0);
+      Lib_IntVector_Intrinsics_vec512 x4 = Lib_IntVector_Intrinsics_vec512_add64(t4, z1);
+      Lib_IntVector_Intrinsics_vec512
+      z01 = Lib_IntVector_Intrinsics_vec512_shift_right64(x1, (uint32_t)26U);
+      Lib_IntVector_Intrinsics_vec512
+      z11 = Lib_IntVector_Intrinsics_vec512_shift_right64(x4, (uint32_t)26U);
+      Lib_IntVector_Intrinsics_vec512
+      t = Lib_IntVector_Intrinsics_vec512_shift_left64(z11, (uint32_t)2U);
+      Lib_IntVector_Intrinsics_vec512 z12 = Lib_IntVector_Intrinsics_vec512_add64(z11, t);
+      Lib_IntVector_Intrinsics_vec512 x11 = Lib_IntVector_Intrinsics_vec512_and(x1, mask26);
+      Lib_IntVector_Intrinsics_vec512 x41 = Lib_IntVector_Intrinsics_vec512_and(x4, mask26);
+      Lib_IntVector_Intrinsics_vec512 x2 = Lib_IntVector_Intrinsics_vec512_add64(t2, z01);
+      Lib_IntVector_Intrinsics_vec512 x01 = Lib_IntVector_Intrinsics_vec512_add64(x0, z12);
+      Lib_IntVector_Intrinsics_vec512
+      z02 = Lib_IntVector_Intrinsics_vec512_shift_right64(x2, (uint32_t)26U);
+      Lib_IntVector_Intrinsics_vec512
+      z13 = Lib_IntVector_Intrinsics_vec512_shift_right64(x01, (uint32_t)26U);
+      Lib_IntVector_Intrinsics_vec512 x21 = Lib_IntVector_Intrinsics_vec512_and(x2, mask26);
+      Lib_IntVector_Intrinsics_vec512 x02 = Lib_IntVector_Intrinsics_vec512_and(x01, mask26);
+      Lib_IntVector_Intrinsics_vec512 x31 = Lib_IntVector_Intrinsics_vec512_add64(x3, z02);
+      Lib_IntVector_Intrinsics_vec512 x12 = Lib_IntVector_Intrinsics_vec512_add64(x11, z13);
+      Lib_IntVector_Intrinsics_vec512
+      z03 = Lib_IntVector_Intrinsics_vec512_shift_right64(x31, (uint32_t)26U);
+      Lib_IntVector_Intrinsics_vec512 x32 = Lib_IntVector_Intrinsics_vec512_and(x31, mask26);
+      Lib_IntVector_Intrinsics_vec512 x42 = Lib_IntVector_Intrinsics_vec512_add64(x41, z03);
+      Lib_IntVector_Intrinsics_vec512 o01 = x02;
+      Lib_IntVector_Intrinsics_vec512 o12 = x12;
+      Lib_IntVector_Intrinsics_vec512 o22 = x21;
+      Lib_IntVector_Intrinsics_vec512 o32 = x32;
+      Lib_IntVector_Intrinsics_vec512 o42 = x42;
+      acc[0U] = o01;
+      acc[1U] = o12;
+      acc[2U] = o22;
+      acc[3U] = o32;
+      acc[4U] = o42;
+      Lib_IntVector_Intrinsics_vec512 f100 = acc[0U];
+      Lib_IntVector_Intrinsics_vec512 f11 = acc[1U];
+      Lib_IntVector_Intrinsics_vec512 f12 = acc[2U];
+      Lib_IntVector_Intrinsics_vec512 f13 = acc[3U];
+      Lib_IntVector_Intrinsics_vec512 f14 = acc[4U];
+      Lib_IntVector_Intrinsics_vec512 f20 = e[0U];
+      Lib_IntVector_Intrinsics_vec512 f21 = e[1U];
+      Lib_IntVector_Intrinsics_vec512 f22 = e[2U];
+      Lib_IntVector_Intrinsics_vec512 f23 = e[3U];
+      Lib_IntVector_Intrinsics_vec512 f24 = e[4U];
+      Lib_IntVector_Intrinsics_vec512 o0 = Lib_IntVector_Intrinsics_vec512_add64(f100, f20);
+      Lib_IntVector_Intrinsics_vec512 o1 = Lib_IntVector_Intrinsics_vec512_add64(f11, f21);
+      Lib_IntVector_Intrinsics_vec512 o2 = Lib_IntVector_Intrinsics_vec512_add64(f12, f22);
+      Lib_IntVector_Intrinsics_vec512 o3 = Lib_IntVector_Intrinsics_vec512_add64(f13, f23);
+      Lib_IntVector_Intrinsics_vec512 o4 = Lib_IntVector_Intrinsics_vec512_add64(f14, f24);
+      acc[0U] = o0;
+      acc[1U] = o1;
+      acc[2U] = o2;
+      acc[3U] = o3;
+      acc[4U] = o4;
+    }
+    Hacl_Impl_Poly1305_Field32xN_512_fmul_r8_normalize(acc, pre);
+  }
+  uint32_t len1 = len - len0;
+  uint8_t *t1 = text + len0;
+  uint32_t nb = len1 / (uint32_t)16U;
+  uint32_t rem = len1 % (uint32_t)16U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    uint8_t *block = t1 + i * (uint32_t)16U;
+    Lib_IntVector_Intrinsics_vec512 e[5U];
+    for (uint32_t _i = 0U; _i < (uint32_t)5U; ++_i)
+      e[_i] = Lib_IntVector_Intrinsics_vec512_zero;
+    uint64_t u0 = load64_le(block);
+    uint64_t lo = u0;
+    uint64_t u = load64_le(block + (uint32_t)8U);
+    uint64_t hi = u;
+    Lib_IntVector_Intrinsics_vec512 f0 = Lib_IntVector_Intrinsics_vec512_load64(lo);
+    Lib_IntVector_Intrinsics_vec512 f1 = Lib_IntVector_Intrinsics_vec512_load64(hi);
+    Lib_IntVector_Intrinsics_vec512
+    f010 =
+      Lib_IntVector_Intrinsics_vec512_and(f0,
+        Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+    Lib_IntVector_Intrinsics_vec512
+    f110 =
+      Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_shift_right64(f0,
+          (uint32_t)26U),
+        Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+    Lib_IntVector_Intrinsics_vec512
+    f20 =
+      Lib_IntVector_Intrinsics_vec512_or(Lib_IntVector_Intrinsics_vec512_shift_right64(f0,
+          (uint32_t)52U),
+        Lib_IntVector_Intrinsics_vec512_shift_left64(Lib_IntVector_Intrinsics_vec512_and(f1,
+            Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3fffU)),
+          (uint32_t)12U));
+    Lib_IntVector_Intrinsics_vec512
+    f30 =
+      Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_shift_right64(f1,
+          (uint32_t)14U),
+        Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+    Lib_IntVector_Intrinsics_vec512
+    f40 = Lib_IntVector_Intrinsics_vec512_shift_right64(f1, (uint32_t)40U);
+    Lib_IntVector_Intrinsics_vec512 f01 = f010;
+    Lib_IntVector_Intrinsics_vec512 f111 = f110;
+    Lib_IntVector_Intrinsics_vec512 f2 = f20;
+    Lib_IntVector_Intrinsics_vec512 f3 = f30;
+    Lib_IntVector_Intrinsics_vec512 f41 = f40;
+    e[0U] = f01;
+    e[1U] = f111;
+    e[2U] = f2;
+    e[3U] = f3;
+    e[4U] = f41;
+    uint64_t b = (uint64_t)0x1000000U;
+    Lib_IntVector_Intrinsics_vec512 mask = Lib_IntVector_Intrinsics_vec512_load64(b);
+    Lib_IntVector_Intrinsics_vec512 f4 = e[4U];
+    e[4U] = Lib_IntVector_Intrinsics_vec512_or(f4, mask);
+    Lib_IntVector_Intrinsics_vec512 *r = pre;
+    Lib_IntVector_Intrinsics_vec512 *r5 = pre + (uint32_t)5U;
+    Lib_IntVector_Intrinsics_vec512 r0 = r[0U];
+    Lib_IntVector_Intrinsics_vec512 r1 = r[1U];
+    Lib_IntVector_Intrinsics_vec512 r2 = r[2U];
+    Lib_IntVector_Intrinsics_vec512 r3 = r[3U];
+    Lib_IntVector_Intrinsics_vec512 r4 = r[4U];
+    Lib_IntVector_Intrinsics_vec512 r51 = r5[1U];
+    Lib_IntVector_Intrinsics_vec512 r52 = r5[2U];
+    Lib_IntVector_Intrinsics_vec512 r53 = r5[3U];
+    Lib_IntVector_Intrinsics_vec512 r54 = r5[4U];
+    Lib_IntVector_Intrinsics_vec512 f10 = e[0U];
+    Lib_IntVector_Intrinsics_vec512 f11 = e[1U];
+    Lib_IntVector_Intrinsics_vec512 f12 = e[2U];
+    Lib_IntVector_Intrinsics_vec512 f13 = e[3U];
+    Lib_IntVector_Intrinsics_vec512 f14 = e[4U];
+    Lib_IntVector_Intrinsics_vec512 a0 = acc[0U];
+    Lib_IntVector_Intrinsics_vec512 a1 = acc[1U];
+    Lib_IntVector_Intrinsics_vec512 a2 = acc[2U];
+    Lib_IntVector_Intrinsics_vec512 a3 = acc[3U];
+    Lib_IntVector_Intrinsics_vec512 a4 = acc[4U];
+    Lib_IntVector_Intrinsics_vec512 a01 = Lib_IntVector_Intrinsics_vec512_add64(a0, f10);
+    Lib_IntVector_Intrinsics_vec512 a11 = Lib_IntVector_Intrinsics_vec512_add64(a1, f11);
+    Lib_IntVector_Intrinsics_vec512 a21 = Lib_IntVector_Intrinsics_vec512_add64(a2, f12);
+    Lib_IntVector_Intrinsics_vec512 a31 = Lib_IntVector_Intrinsics_vec512_add64(a3, f13);
+    Lib_IntVector_Intrinsics_vec512 a41 = Lib_IntVector_Intrinsics_vec512_add64(a4, f14);
+    Lib_IntVector_Intrinsics_vec512 a02 = Lib_IntVector_Intrinsics_vec512_mul64(r0, a01);
+    Lib_IntVector_Intrinsics_vec512 a12 = Lib_IntVector_Intrinsics_vec512_mul64(r1, a01);
+    Lib_IntVector_Intrinsics_vec512 a22 = Lib_IntVector_Intrinsics_vec512_mul64(r2, a01);
+    Lib_IntVector_Intrinsics_vec512 a32 = Lib_IntVector_Intrinsics_vec512_mul64(r3, a01);
+    Lib_IntVector_Intrinsics_vec512 a42 = Lib_IntVector_Intrinsics_vec512_mul64(r4, a01);
+    Lib_IntVector_Intrinsics_vec512
+    a03 =
+      Lib_IntVector_Intrinsics_vec512_add64(a02,
+        Lib_IntVector_Intrinsics_vec512_mul64(r54, a11));
+    Lib_IntVector_Intrinsics_vec512
+    a13 =
+      Lib_IntVector_Intrinsics_vec512_add64(a12,
+        Lib_IntVector_Intrinsics_vec512_mul64(r0, a11));
+    Lib_IntVector_Intrinsics_vec512
+    a23 =
+      Lib_IntVector_Intrinsics_vec512_add64(a22,
+        Lib_IntVector_Intrinsics_vec512_mul64(r1, a11));
+    Lib_IntVector_Intrinsics_vec512
+    a33 =
+      Lib_IntVector_Intrinsics_vec512_add64(a32,
+        Lib_IntVector_Intrinsics_vec512_mul64(r2, a11));
+    Lib_IntVector_Intrinsics_vec512
+    a43 =
+      Lib_IntVector_Intrinsics_vec512_add64(a42,
+        Lib_IntVector_Intrinsics_vec512_mul64(r3, a11));
+    Lib_IntVector_Intrinsics_vec512
+    a04 =
+      Lib_IntVector_Intrinsics_vec512_add64(a03,
+        Lib_IntVector_Intrinsics_vec512_mul64(r53, a21));
+    Lib_IntVector_Intrinsics_vec512
+    a14 =
+      Lib_IntVector_Intrinsics_vec512_add64(a13,
+        Lib_IntVector_Intrinsics_vec512_mul64(r54, a21));
+    Lib_IntVector_Intrinsics_vec512
+    a24 =
+      Lib_IntVector_Intrinsics_vec512_add64(a23,
+        Lib_IntVector_Intrinsics_vec512_mul64(r0, a21));
+    Lib_IntVector_Intrinsics_vec512
+    a34 =
+      Lib_IntVector_Intrinsics_vec512_add64(a33,
+        Lib_IntVector_Intrinsics_vec512_mul64(r1, a21));
+    Lib_IntVector_Intrinsics_vec512
+    a44 =
+      Lib_IntVector_Intrinsics_vec512_add64(a43,
+        Lib_IntVector_Intrinsics_vec512_mul64(r2, a21));
+    Lib_IntVector_Intrinsics_vec512
+    a05 =
+      Lib_IntVector_Intrinsics_vec512_add64(a04,
+        Lib_IntVector_Intrinsics_vec512_mul64(r52, a31));
+    Lib_IntVector_Intrinsics_vec512
+    a15 =
+      Lib_IntVector_Intrinsics_vec512_add64(a14,
+        Lib_IntVector_Intrinsics_vec512_mul64(r53, a31));
+    Lib_IntVector_Intrinsics_vec512
+    a25 =
+      Lib_IntVector_Intrinsics_vec512_add64(a24,
+        Lib_IntVector_Intrinsics_vec512_mul64(r54, a31));
+    Lib_IntVector_Intrinsics_vec512
+    a35 =
+      Lib_IntVector_Intrinsics_vec512_add64(a34,
+        Lib_IntVector_Intrinsics_vec512_mul64(r0, a31));
+    Lib_IntVector_Intrinsics_vec512
+    a45 =
+      Lib_IntVector_Intrinsics_vec512_add64(a44,
+        Lib_IntVector_Intrinsics_vec512_mul64(r1, a31));
+    Lib_IntVector_Intrinsics_vec512
+    a06 =
+      Lib_IntVector_Intrinsics_vec512_add64(a05,
+        Lib_IntVector_Intrinsics_vec512_mul64(r51, a41));
+    Lib_IntVector_Intrinsics_vec512
+    a16 =
+      Lib_IntVector_Intrinsics_vec512_add64(a15,
+        Lib_IntVector_Intrinsics_vec512_mul64(r52, a41));
+    Lib_IntVector_Intrinsics_vec512
+    a26 =
+      Lib_IntVector_Intrinsics_vec512_add64(a25,
+        Lib_IntVector_Intrinsics_vec512_mul64(r53, a41));
+    Lib_IntVector_Intrinsics_vec512
+    a36 =
+      Lib_IntVector_Intrinsics_vec512_add64(a35,
+        Lib_IntVector_Intrinsics_vec512_mul64(r54, a41));
+    Lib_IntVector_Intrinsics_vec512
+    a46 =
+      Lib_IntVector_Intrinsics_vec512_add64(a45,
+        Lib_IntVector_Intrinsics_vec512_mul64(r0, a41));
+    Lib_IntVector_Intrinsics_vec512 t01 = a06;
+    Lib_IntVector_Intrinsics_vec512 t11 = a16;
+    Lib_IntVector_Intrinsics_vec512 t2 = a26;
+    Lib_IntVector_Intrinsics_vec512 t3 = a36;
+    Lib_IntVector_Intrinsics_vec512 t4 = a46;
+    Lib_IntVector_Intrinsics_vec512
+    mask26 = Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU);
+    Lib_IntVector_Intrinsics_vec512
+    z0 = Lib_IntVector_Intrinsics_vec512_shift_right64(t01, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec512
+    z1 = Lib_IntVector_Intrinsics_vec512_shift_right64(t3, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec512 x0 = Lib_IntVector_Intrinsics_vec512_and(t01, mask26);
+    Lib_IntVector_Intrinsics_vec512 x3 = Lib_IntVector_Intrinsics_vec512_and(t3, mask26);
+    Lib_IntVector_Intrinsics_vec512 x1 = Lib_IntVector_Intrinsics_vec512_add64(t11, z0);
+    Lib_IntVector_Intrinsics_vec512 x4 = Lib_IntVector_Intrinsics_vec512_add64(t4, z1);
+    Lib_IntVector_Intrinsics_vec512
+    z01 = Lib_IntVector_Intrinsics_vec512_shift_right64(x1, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec512
+    z11 = Lib_IntVector_Intrinsics_vec512_shift_right64(x4, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec512
+    t = Lib_IntVector_Intrinsics_vec512_shift_left64(z11, (uint32_t)2U);
+    Lib_IntVector_Intrinsics_vec512 z12 = Lib_IntVector_Intrinsics_vec512_add64(z11, t);
+    Lib_IntVector_Intrinsics_vec512 x11 = Lib_IntVector_Intrinsics_vec512_and(x1, mask26);
+    Lib_IntVector_Intrinsics_vec512 x41 = Lib_IntVector_Intrinsics_vec512_and(x4, mask26);
+    Lib_IntVector_Intrinsics_vec512 x2 = Lib_IntVector_Intrinsics_vec512_add64(t2, z01);
+    Lib_IntVector_Intrinsics_vec512 x01 = Lib_IntVector_Intrinsics_vec512_add64(x0, z12);
+    Lib_IntVector_Intrinsics_vec512
+    z02 = Lib_IntVector_Intrinsics_vec512_shift_right64(x2, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec512
+    z13 = Lib_IntVector_Intrinsics_vec512_shift_right64(x01, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec512 x21 = Lib_IntVector_Intrinsics_vec512_and(x2, mask26);
+    Lib_IntVector_Intrinsics_vec512 x02 = Lib_IntVector_Intrinsics_vec512_and(x01, mask26);
+    Lib_IntVector_Intrinsics_vec512 x31 = Lib_IntVector_Intrinsics_vec512_add64(x3, z02);
+    Lib_IntVector_Intrinsics_vec512 x12 = Lib_IntVector_Intrinsics_vec512_add64(x11, z13);
+    Lib_IntVector_Intrinsics_vec512
+    z03 = Lib_IntVector_Intrinsics_vec512_shift_right64(x31, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec512 x32 = Lib_IntVector_Intrinsics_vec512_and(x31, mask26);
+    Lib_IntVector_Intrinsics_vec512 x42 = Lib_IntVector_Intrinsics_vec512_add64(x41, z03);
+    Lib_IntVector_Intrinsics_vec512 o0 = x02;
+    Lib_IntVector_Intrinsics_vec512 o1 = x12;
+    Lib_IntVector_Intrinsics_vec512 o2 = x21;
+    Lib_IntVector_Intrinsics_vec512 o3 = x32;
+    Lib_IntVector_Intrinsics_vec512 o4 = x42;
+    acc[0U] = o0;
+    acc[1U] = o1;
+    acc[2U] = o2;
+    acc[3U] = o3;
+    acc[4U] = o4;
+  }
+  if (rem > (uint32_t)0U)
+  {
+    uint8_t *last = t1 + nb * (uint32_t)16U;
+    Lib_IntVector_Intrinsics_vec512 e[5U];
+    for (uint32_t _i = 0U; _i < (uint32_t)5U; ++_i)
+      e[_i] = Lib_IntVector_Intrinsics_vec512_zero;
+    uint8_t tmp[16U] = { 0U };
+    memcpy(tmp, last, rem * sizeof (uint8_t));
+    uint64_t u0 = load64_le(tmp);
+    uint64_t lo = u0;
+    uint64_t u = load64_le(tmp + (uint32_t)8U);
+    uint64_t hi = u;
+    Lib_IntVector_Intrinsics_vec512 f0 = Lib_IntVector_Intrinsics_vec512_load64(lo);
+    Lib_IntVector_Intrinsics_vec512 f1 = Lib_IntVector_Intrinsics_vec512_load64(hi);
+    Lib_IntVector_Intrinsics_vec512
+    f010 =
+      Lib_IntVector_Intrinsics_vec512_and(f0,
+        Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+    Lib_IntVector_Intrinsics_vec512
+    f110 =
+      Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_shift_right64(f0,
+          (uint32_t)26U),
+        Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+    Lib_IntVector_Intrinsics_vec512
+    f20 =
+      Lib_IntVector_Intrinsics_vec512_or(Lib_IntVector_Intrinsics_vec512_shift_right64(f0,
+          (uint32_t)52U),
+        Lib_IntVector_Intrinsics_vec512_shift_left64(Lib_IntVector_Intrinsics_vec512_and(f1,
+            Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3fffU)),
+          (uint32_t)12U));
+    Lib_IntVector_Intrinsics_vec512
+    f30 =
+      Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_shift_right64(f1,
+          (uint32_t)14U),
+        Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+    Lib_IntVector_Intrinsics_vec512
+    f40 = Lib_IntVector_Intrinsics_vec512_shift_right64(f1, (uint32_t)40U);
+    Lib_IntVector_Intrinsics_vec512 f01 = f010;
+    Lib_IntVector_Intrinsics_vec512 f111 = f110;
+    Lib_IntVector_Intrinsics_vec512 f2 = f20;
+    Lib_IntVector_Intrinsics_vec512 f3 = f30;
+    Lib_IntVector_Intrinsics_vec512 f4 = f40;
+    e[0U] = f01;
+    e[1U] = f111;
+    e[2U] = f2;
+    e[3U] = f3;
+    e[4U] = f4;
+    uint64_t b = (uint64_t)1U << rem * (uint32_t)8U % (uint32_t)26U;
+    Lib_IntVector_Intrinsics_vec512 mask = Lib_IntVector_Intrinsics_vec512_load64(b);
+    Lib_IntVector_Intrinsics_vec512 fi = e[rem * (uint32_t)8U / (uint32_t)26U];
+    e[rem * (uint32_t)8U / (uint32_t)26U] = Lib_IntVector_Intrinsics_vec512_or(fi, mask);
+    Lib_IntVector_Intrinsics_vec512 *r = pre;
+    Lib_IntVector_Intrinsics_vec512 *r5 = pre + (uint32_t)5U;
+    Lib_IntVector_Intrinsics_vec512 r0 = r[0U];
+    Lib_IntVector_Intrinsics_vec512 r1 = r[1U];
+    Lib_IntVector_Intrinsics_vec512 r2 = r[2U];
+    Lib_IntVector_Intrinsics_vec512 r3 = r[3U];
+    Lib_IntVector_Intrinsics_vec512 r4 = r[4U];
+    Lib_IntVector_Intrinsics_vec512 r51 = r5[1U];
+    Lib_IntVector_Intrinsics_vec512 r52 = r5[2U];
+    Lib_IntVector_Intrinsics_vec512 r53 = r5[3U];
+    Lib_IntVector_Intrinsics_vec512 r54 = r5[4U];
+    Lib_IntVector_Intrinsics_vec512 f10 = e[0U];
+    Lib_IntVector_Intrinsics_vec512 f11 = e[1U];
+    Lib_IntVector_Intrinsics_vec512 f12 = e[2U];
+    Lib_IntVector_Intrinsics_vec512 f13 = e[3U];
+    Lib_IntVector_Intrinsics_vec512 f14 = e[4U];
+    Lib_IntVector_Intrinsics_vec512 a0 = acc[0U];
+    Lib_IntVector_Intrinsics_vec512 a1 = acc[1U];
+    Lib_IntVector_Intrinsics_vec512 a2 = acc[2U];
+    Lib_IntVector_Intrinsics_vec512 a3 = acc[3U];
+    Lib_IntVector_Intrinsics_vec512 a4 = acc[4U];
+    Lib_IntVector_Intrinsics_vec512 a01 = Lib_IntVector_Intrinsics_vec512_add64(a0, f10);
+    Lib_IntVector_Intrinsics_vec512 a11 = Lib_IntVector_Intrinsics_vec512_add64(a1, f11);
+    Lib_IntVector_Intrinsics_vec512 a21 = Lib_IntVector_Intrinsics_vec512_add64(a2, f12);
+    Lib_IntVector_Intrinsics_vec512 a31 = Lib_IntVector_Intrinsics_vec512_add64(a3, f13);
+    Lib_IntVector_Intrinsics_vec512 a41 = Lib_IntVector_Intrinsics_vec512_add64(a4, f14);
+    Lib_IntVector_Intrinsics_vec512 a02 = Lib_IntVector_Intrinsics_vec512_mul64(r0, a01);
+    Lib_IntVector_Intrinsics_vec512 a12 = Lib_IntVector_Intrinsics_vec512_mul64(r1, a01);
+    Lib_IntVector_Intrinsics_vec512 a22 = Lib_IntVector_Intrinsics_vec512_mul64(r2, a01);
+    Lib_IntVector_Intrinsics_vec512 a32 = Lib_IntVector_Intrinsics_vec512_mul64(r3, a01);
+    Lib_IntVector_Intrinsics_vec512 a42 = Lib_IntVector_Intrinsics_vec512_mul64(r4, a01);
+    Lib_IntVector_Intrinsics_vec512
+    a03 =
+      Lib_IntVector_Intrinsics_vec512_add64(a02,
+        Lib_IntVector_Intrinsics_vec512_mul64(r54, a11));
+    Lib_IntVector_Intrinsics_vec512
+    a13 =
+      Lib_IntVector_Intrinsics_vec512_add64(a12,
+        Lib_IntVector_Intrinsics_vec512_mul64(r0, a11));
+    Lib_IntVector_Intrinsics_vec512
+    a23 =
+      Lib_IntVector_Intrinsics_vec512_add64(a22,
+        Lib_IntVector_Intrinsics_vec512_mul64(r1, a11));
+    Lib_IntVector_Intrinsics_vec512
+    a33 =
+      Lib_IntVector_Intrinsics_vec512_add64(a32,
+        Lib_IntVector_Intrinsics_vec512_mul64(r2, a11));
+    Lib_IntVector_Intrinsics_vec512
+    a43 =
+      Lib_IntVector_Intrinsics_vec512_add64(a42,
+        Lib_IntVector_Intrinsics_vec512_mul64(r3, a11));
+    Lib_IntVector_Intrinsics_vec512
+    a04 =
+      Lib_IntVector_Intrinsics_vec512_add64(a03,
+        Lib_IntVector_Intrinsics_vec512_mul64(r53, a21));
+    Lib_IntVector_Intrinsics_vec512
+    a14 =
+      Lib_IntVector_Intrinsics_vec512_add64(a13,
+        Lib_IntVector_Intrinsics_vec512_mul64(r54, a21));
+    Lib_IntVector_Intrinsics_vec512
+    a24 =
+      Lib_IntVector_Intrinsics_vec512_add64(a23,
+        Lib_IntVector_Intrinsics_vec512_mul64(r0, a21));
+    Lib_IntVector_Intrinsics_vec512
+    a34 =
+      Lib_IntVector_Intrinsics_vec512_add64(a33,
+        Lib_IntVector_Intrinsics_vec512_mul64(r1, a21));
+    Lib_IntVector_Intrinsics_vec512
+    a44 =
+      Lib_IntVector_Intrinsics_vec512_add64(a43,
+        Lib_IntVector_Intrinsics_vec512_mul64(r2, a21));
+    Lib_IntVector_Intrinsics_vec512
+    a05 =
+      Lib_IntVector_Intrinsics_vec512_add64(a04,
+        Lib_IntVector_Intrinsics_vec512_mul64(r52, a31));
+    Lib_IntVector_Intrinsics_vec512
+    a15 =
+      Lib_IntVector_Intrinsics_vec512_add64(a14,
+        Lib_IntVector_Intrinsics_vec512_mul64(r53, a31));
+    Lib_IntVector_Intrinsics_vec512
+    a25 =
+      Lib_IntVector_Intrinsics_vec512_add64(a24,
+        Lib_IntVector_Intrinsics_vec512_mul64(r54, a31));
+    Lib_IntVector_Intrinsics_vec512
+    a35 =
+      Lib_IntVector_Intrinsics_vec512_add64(a34,
+        Lib_IntVector_Intrinsics_vec512_mul64(r0, a31));
+    Lib_IntVector_Intrinsics_vec512
+    a45 =
+      Lib_IntVector_Intrinsics_vec512_add64(a44,
+        Lib_IntVector_Intrinsics_vec512_mul64(r1, a31));
+    Lib_IntVector_Intrinsics_vec512
+    a06 =
+      Lib_IntVector_Intrinsics_vec512_add64(a05,
+        Lib_IntVector_Intrinsics_vec512_mul64(r51, a41));
+    Lib_IntVector_Intrinsics_vec512
+    a16 =
+      Lib_IntVector_Intrinsics_vec512_add64(a15,
+        Lib_IntVector_Intrinsics_vec512_mul64(r52, a41));
+    Lib_IntVector_Intrinsics_vec512
+    a26 =
+      Lib_IntVector_Intrinsics_vec512_add64(a25,
+        Lib_IntVector_Intrinsics_vec512_mul64(r53, a41));
+    Lib_IntVector_Intrinsics_vec512
+    a36 =
+      Lib_IntVector_Intrinsics_vec512_add64(a35,
+        Lib_IntVector_Intrinsics_vec512_mul64(r54, a41));
+    Lib_IntVector_Intrinsics_vec512
+    a46 =
+      Lib_IntVector_Intrinsics_vec512_add64(a45,
+        Lib_IntVector_Intrinsics_vec512_mul64(r0, a41));
+    Lib_IntVector_Intrinsics_vec512 t01 = a06;
+    Lib_IntVector_Intrinsics_vec512 t11 = a16;
+    Lib_IntVector_Intrinsics_vec512 t2 = a26;
+    Lib_IntVector_Intrinsics_vec512 t3 = a36;
+    Lib_IntVector_Intrinsics_vec512 t4 = a46;
+    Lib_IntVector_Intrinsics_vec512
+    mask26 = Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU);
+    Lib_IntVector_Intrinsics_vec512
+    z0 = Lib_IntVector_Intrinsics_vec512_shift_right64(t01, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec512
+    z1 = Lib_IntVector_Intrinsics_vec512_shift_right64(t3, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec512 x0 = Lib_IntVector_Intrinsics_vec512_and(t01, mask26);
+    Lib_IntVector_Intrinsics_vec512 x3 = Lib_IntVector_Intrinsics_vec512_and(t3, mask26);
+    Lib_IntVector_Intrinsics_vec512 x1 = Lib_IntVector_Intrinsics_vec512_add64(t11, z0);
+    Lib_IntVector_Intrinsics_vec512 x4 = Lib_IntVector_Intrinsics_vec512_add64(t4, z1);
+    Lib_IntVector_Intrinsics_vec512
+    z01 = Lib_IntVector_Intrinsics_vec512_shift_right64(x1, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec512
+    z11 = Lib_IntVector_Intrinsics_vec512_shift_right64(x4, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec512
+    t = Lib_IntVector_Intrinsics_vec512_shift_left64(z11, (uint32_t)2U);
+    Lib_IntVector_Intrinsics_vec512 z12 = Lib_IntVector_Intrinsics_vec512_add64(z11, t);
+    Lib_IntVector_Intrinsics_vec512 x11 = Lib_IntVector_Intrinsics_vec512_and(x1, mask26);
+    Lib_IntVector_Intrinsics_vec512 x41 = Lib_IntVector_Intrinsics_vec512_and(x4, mask26);
+    Lib_IntVector_Intrinsics_vec512 x2 = Lib_IntVector_Intrinsics_vec512_add64(t2, z01);
+    Lib_IntVector_Intrinsics_vec512 x01 = Lib_IntVector_Intrinsics_vec512_add64(x0, z12);
+    Lib_IntVector_Intrinsics_vec512
+    z02 = Lib_IntVector_Intrinsics_vec512_shift_right64(x2, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec512
+    z13 = Lib_IntVector_Intrinsics_vec512_shift_right64(x01, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec512 x21 = Lib_IntVector_Intrinsics_vec512_and(x2, mask26);
+    Lib_IntVector_Intrinsics_vec512 x02 = Lib_IntVector_Intrinsics_vec512_and(x01, mask26);
+    Lib_IntVector_Intrinsics_vec512 x31 = Lib_IntVector_Intrinsics_vec512_add64(x3, z02);
+    Lib_IntVector_Intrinsics_vec512 x12 = Lib_IntVector_Intrinsics_vec512_add64(x11, z13);
+    Lib_IntVector_Intrinsics_vec512
+    z03 = Lib_IntVector_Intrinsics_vec512_shift_right64(x31, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec512 x32 = Lib_IntVector_Intrinsics_vec512_and(x31, mask26);
+    Lib_IntVector_Intrinsics_vec512 x42 = Lib_IntVector_Intrinsics_vec512_add64(x41, z03);
+    Lib_IntVector_Intrinsics_vec512 o0 = x02;
+    Lib_IntVector_Intrinsics_vec512 o1 = x12;
+    Lib_IntVector_Intrinsics_vec512 o2 = x21;
+    Lib_IntVector_Intrinsics_vec512 o3 = x32;
+    Lib_IntVector_Intrinsics_vec512 o4 = x42;
+    acc[0U] = o0;
+    acc[1U] = o1;
+    acc[2U] = o2;
+    acc[3U] = o3;
+    acc[4U] = o4;
+    return;
+  }
+}
+
+void
+Hacl_Poly1305_512_poly1305_finish(
+  uint8_t *tag,
+  uint8_t *key,
+  Lib_IntVector_Intrinsics_vec512 *ctx
+)
+{
+  Lib_IntVector_Intrinsics_vec512 *acc = ctx;
+  uint8_t *ks = key + (uint32_t)16U;
+  Lib_IntVector_Intrinsics_vec512 f0 = acc[0U];
+  Lib_IntVector_Intrinsics_vec512 f13 = acc[1U];
+  Lib_IntVector_Intrinsics_vec512 f23 = acc[2U];
+  Lib_IntVector_Intrinsics_vec512 f33 = acc[3U];
+  Lib_IntVector_Intrinsics_vec512 f40 = acc[4U];
+  Lib_IntVector_Intrinsics_vec512
+  l0 = Lib_IntVector_Intrinsics_vec512_add64(f0, Lib_IntVector_Intrinsics_vec512_zero);
+  Lib_IntVector_Intrinsics_vec512
+  tmp00 =
+    Lib_IntVector_Intrinsics_vec512_and(l0,
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  c00 = Lib_IntVector_Intrinsics_vec512_shift_right64(l0, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 l1 = Lib_IntVector_Intrinsics_vec512_add64(f13, c00);
+  Lib_IntVector_Intrinsics_vec512
+  tmp10 =
+    Lib_IntVector_Intrinsics_vec512_and(l1,
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  c10 = Lib_IntVector_Intrinsics_vec512_shift_right64(l1, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 l2 = Lib_IntVector_Intrinsics_vec512_add64(f23, c10);
+  Lib_IntVector_Intrinsics_vec512
+  tmp20 =
+    Lib_IntVector_Intrinsics_vec512_and(l2,
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  c20 = Lib_IntVector_Intrinsics_vec512_shift_right64(l2, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 l3 = Lib_IntVector_Intrinsics_vec512_add64(f33, c20);
+  Lib_IntVector_Intrinsics_vec512
+  tmp30 =
+    Lib_IntVector_Intrinsics_vec512_and(l3,
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  c30 = Lib_IntVector_Intrinsics_vec512_shift_right64(l3, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 l4 = Lib_IntVector_Intrinsics_vec512_add64(f40, c30);
+  Lib_IntVector_Intrinsics_vec512
+  tmp40 =
+    Lib_IntVector_Intrinsics_vec512_and(l4,
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  c40 = Lib_IntVector_Intrinsics_vec512_shift_right64(l4, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  f010 =
+    Lib_IntVector_Intrinsics_vec512_add64(tmp00,
+      Lib_IntVector_Intrinsics_vec512_smul64(c40, (uint64_t)5U));
+  Lib_IntVector_Intrinsics_vec512 f110 = tmp10;
+  Lib_IntVector_Intrinsics_vec512 f210 = tmp20;
+  Lib_IntVector_Intrinsics_vec512 f310 = tmp30;
+  Lib_IntVector_Intrinsics_vec512 f410 = tmp40;
+  Lib_IntVector_Intrinsics_vec512
+  l = Lib_IntVector_Intrinsics_vec512_add64(f010, Lib_IntVector_Intrinsics_vec512_zero);
+  Lib_IntVector_Intrinsics_vec512
+  tmp0 =
+    Lib_IntVector_Intrinsics_vec512_and(l,
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  c0 = Lib_IntVector_Intrinsics_vec512_shift_right64(l, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 l5 = Lib_IntVector_Intrinsics_vec512_add64(f110, c0);
+  Lib_IntVector_Intrinsics_vec512
+  tmp1 =
+    Lib_IntVector_Intrinsics_vec512_and(l5,
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  c1 = Lib_IntVector_Intrinsics_vec512_shift_right64(l5, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 l6 = Lib_IntVector_Intrinsics_vec512_add64(f210, c1);
+  Lib_IntVector_Intrinsics_vec512
+  tmp2 =
+    Lib_IntVector_Intrinsics_vec512_and(l6,
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  c2 = Lib_IntVector_Intrinsics_vec512_shift_right64(l6, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 l7 = Lib_IntVector_Intrinsics_vec512_add64(f310, c2);
+  Lib_IntVector_Intrinsics_vec512
+  tmp3 =
+    Lib_IntVector_Intrinsics_vec512_and(l7,
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  c3 = Lib_IntVector_Intrinsics_vec512_shift_right64(l7, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 l8 = Lib_IntVector_Intrinsics_vec512_add64(f410, c3);
+  Lib_IntVector_Intrinsics_vec512
+  tmp4 =
+    Lib_IntVector_Intrinsics_vec512_and(l8,
+      Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec512
+  c4 = Lib_IntVector_Intrinsics_vec512_shift_right64(l8, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512
+  f02 =
+    Lib_IntVector_Intrinsics_vec512_add64(tmp0,
+      Lib_IntVector_Intrinsics_vec512_smul64(c4, (uint64_t)5U));
+  Lib_IntVector_Intrinsics_vec512 f12 = tmp1;
+  Lib_IntVector_Intrinsics_vec512 f22 = tmp2;
+  Lib_IntVector_Intrinsics_vec512 f32 = tmp3;
+  Lib_IntVector_Intrinsics_vec512 f42 = tmp4;
+  Lib_IntVector_Intrinsics_vec512
+  mh = Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU);
+  Lib_IntVector_Intrinsics_vec512
+  ml = Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3fffffbU);
+  Lib_IntVector_Intrinsics_vec512 mask = Lib_IntVector_Intrinsics_vec512_eq64(f42, mh);
+  Lib_IntVector_Intrinsics_vec512
+  mask1 =
+    Lib_IntVector_Intrinsics_vec512_and(mask,
+      Lib_IntVector_Intrinsics_vec512_eq64(f32, mh));
+  Lib_IntVector_Intrinsics_vec512
+  mask2 =
+    Lib_IntVector_Intrinsics_vec512_and(mask1,
+      Lib_IntVector_Intrinsics_vec512_eq64(f22, mh));
+  Lib_IntVector_Intrinsics_vec512
+  mask3 =
+    Lib_IntVector_Intrinsics_vec512_and(mask2,
+      Lib_IntVector_Intrinsics_vec512_eq64(f12, mh));
+  Lib_IntVector_Intrinsics_vec512
+  mask4 =
+    Lib_IntVector_Intrinsics_vec512_and(mask3,
+      Lib_IntVector_Intrinsics_vec512_lognot(Lib_IntVector_Intrinsics_vec512_gt64(ml, f02)));
+  Lib_IntVector_Intrinsics_vec512 ph = Lib_IntVector_Intrinsics_vec512_and(mask4, mh);
+  Lib_IntVector_Intrinsics_vec512 pl = Lib_IntVector_Intrinsics_vec512_and(mask4, ml);
+  Lib_IntVector_Intrinsics_vec512 o0 = Lib_IntVector_Intrinsics_vec512_sub64(f02, pl);
+  Lib_IntVector_Intrinsics_vec512 o1 = Lib_IntVector_Intrinsics_vec512_sub64(f12, ph);
+  Lib_IntVector_Intrinsics_vec512 o2 = Lib_IntVector_Intrinsics_vec512_sub64(f22, ph);
+  Lib_IntVector_Intrinsics_vec512 o3 = Lib_IntVector_Intrinsics_vec512_sub64(f32, ph);
+  Lib_IntVector_Intrinsics_vec512 o4 = Lib_IntVector_Intrinsics_vec512_sub64(f42, ph);
+  Lib_IntVector_Intrinsics_vec512 f011 = o0;
+  Lib_IntVector_Intrinsics_vec512 f111 = o1;
+  Lib_IntVector_Intrinsics_vec512 f211 = o2;
+  Lib_IntVector_Intrinsics_vec512 f311 = o3;
+  Lib_IntVector_Intrinsics_vec512 f411 = o4;
+  acc[0U] = f011;
+  acc[1U] = f111;
+  acc[2U] = f211;
+  acc[3U] = f311;
+  acc[4U] = f411;
+  Lib_IntVector_Intrinsics_vec512 f00 = acc[0U];
+  Lib_IntVector_Intrinsics_vec512 f1 = acc[1U];
+  Lib_IntVector_Intrinsics_vec512 f2 = acc[2U];
+  Lib_IntVector_Intrinsics_vec512 f3 = acc[3U];
+  Lib_IntVector_Intrinsics_vec512 f4 = acc[4U];
+  uint64_t f01 = Lib_IntVector_Intrinsics_vec512_extract64(f00, (uint32_t)0U);
+  uint64_t f112 = Lib_IntVector_Intrinsics_vec512_extract64(f1, (uint32_t)0U);
+  uint64_t f212 = Lib_IntVector_Intrinsics_vec512_extract64(f2, (uint32_t)0U);
+  uint64_t f312 = Lib_IntVector_Intrinsics_vec512_extract64(f3, (uint32_t)0U);
+  uint64_t f41 = Lib_IntVector_Intrinsics_vec512_extract64(f4, (uint32_t)0U);
+  uint64_t lo = (f01 | f112 << (uint32_t)26U) | f212 << (uint32_t)52U;
+  uint64_t hi = (f212 >> (uint32_t)12U | f312 << (uint32_t)14U) | f41 << (uint32_t)40U;
+  uint64_t f10 = lo;
+  uint64_t f11 = hi;
+  uint64_t u0 = load64_le(ks);
+  uint64_t lo0 = u0;
+  uint64_t u = load64_le(ks + (uint32_t)8U);
+  uint64_t hi0 = u;
+  uint64_t f20 = lo0;
+  uint64_t f21 = hi0;
+  uint64_t r0 = f10 + f20;
+  uint64_t r1 = f11 + f21;
+  uint64_t c = (r0 ^ ((r0 ^ f20) | ((r0 - f20) ^ f20))) >> (uint32_t)63U;
+  uint64_t r11 = r1 + c;
+  uint64_t f30 = r0;
+  uint64_t f31 = r11;
+  store64_le(tag, f30);
+  store64_le(tag + (uint32_t)8U, f31);
+}
+
+void Hacl_Poly1305_512_poly1305_mac(uint8_t *tag, uint32_t len, uint8_t *text, uint8_t *key)
+{
+  Lib_IntVector_Intrinsics_vec512 ctx[25U];
+  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
+    ctx[_i] = Lib_IntVector_Intrinsics_vec512_zero;
+  Hacl_Poly1305_512_poly1305_init(ctx, key);
+  Hacl_Poly1305_512_poly1305_update(ctx, len, text);
+  Hacl_Poly1305_512_poly1305_finish(tag, key, ctx);
+}
+
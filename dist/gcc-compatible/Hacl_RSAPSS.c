@@ -735,3 +735,344 @@ Hacl_RSAPSS_rsapss_pkey_verify(
   return false;
 }
 
+
+static inline void
+bn_mod_slow_precompr2(uint32_t len, uint64_t *n, uint64_t *a, uint64_t *r2, uint64_t *res)
+{
+  KRML_CHECK_SIZE(sizeof (uint64_t), len);
+  uint64_t a_mod[len];
+  memset(a_mod, 0U, len * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), len + len);
+  uint64_t a1[len + len];
+  memset(a1, 0U, (len + len) * sizeof (uint64_t));
+  memcpy(a1, a, (len + len) * sizeof (uint64_t));
+  uint64_t mu = Hacl_Bignum_ModInvLimb_mod_inv_uint64(n[0U]);
+  Hacl_Bignum_Montgomery_bn_mont_reduction_u64(len, n, mu, a1, a_mod);
+  KRML_CHECK_SIZE(sizeof (uint64_t), len + len);
+  uint64_t c[len + len];
+  memset(c, 0U, (len + len) * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)4U * len);
+  uint64_t tmp[(uint32_t)4U * len];
+  memset(tmp, 0U, (uint32_t)4U * len * sizeof (uint64_t));
+  Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint64(len, a_mod, r2, tmp, c);
+  Hacl_Bignum_Montgomery_bn_mont_reduction_u64(len, n, mu, c, res);
+}
+
+static inline bool
+load_skey_crt(
+  uint32_t modBits,
+  uint32_t eBits,
+  uint32_t pqBits,
+  uint8_t *nb,
+  uint8_t *eb,
+  uint8_t *pb,
+  uint8_t *qb,
+  uint8_t *dpb,
+  uint8_t *dqb,
+  uint8_t *qinvb,
+  uint64_t *skey
+)
+{
+  uint32_t pqbLen = (pqBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t eLen = (eBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t pqLen = (pqBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t pkeyLen = nLen + nLen + eLen;
+  uint64_t *pkey = skey;
+  uint64_t *p = skey + pkeyLen;
+  uint64_t *r2p = skey + pkeyLen + pqLen;
+  uint64_t *q = skey + pkeyLen + (uint32_t)2U * pqLen;
+  uint64_t *r2q = skey + pkeyLen + (uint32_t)3U * pqLen;
+  uint64_t *dp = skey + pkeyLen + (uint32_t)4U * pqLen;
+  uint64_t *dq = skey + pkeyLen + (uint32_t)5U * pqLen;
+  uint64_t *qinv = skey + pkeyLen + (uint32_t)6U * pqLen;
+  bool b = load_pkey(modBits, eBits, nb, eb, pkey);
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pqbLen, pb, p);
+  Hacl_Bignum_Montgomery_bn_precomp_r2_mod_n_u64(pqLen, pqBits - (uint32_t)1U, p, r2p);
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pqbLen, qb, q);
+  Hacl_Bignum_Montgomery_bn_precomp_r2_mod_n_u64(pqLen, pqBits - (uint32_t)1U, q, r2q);
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pqbLen, dpb, dp);
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pqbLen, dqb, dq);
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pqbLen, qinvb, qinv);
+  uint64_t m0 = Hacl_Impl_RSAPSS_Keys_check_modulus_u64(pqBits, p);
+  uint64_t m1 = Hacl_Impl_RSAPSS_Keys_check_modulus_u64(pqBits, q);
+  uint64_t m2 = Hacl_Impl_RSAPSS_Keys_check_exponent_u64(pqBits, dp);
+  uint64_t m3 = Hacl_Impl_RSAPSS_Keys_check_exponent_u64(pqBits, dq);
+  uint64_t m4 = Hacl_Impl_RSAPSS_Keys_check_exponent_u64(pqBits, qinv);
+  uint64_t acc = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < pqLen; i++)
+  {
+    uint64_t beq = FStar_UInt64_eq_mask(qinv[i], p[i]);
+    uint64_t blt = ~FStar_UInt64_gte_mask(qinv[i], p[i]);
+    acc = (beq & acc) | (~beq & ((blt & (uint64_t)0xFFFFFFFFFFFFFFFFU) | (~blt & (uint64_t)0U)));
+  }
+  uint64_t m5 = acc;
+  uint64_t m = m0 & (m1 & (m2 & (m3 & (m4 & m5))));
+  return b && m == (uint64_t)0xFFFFFFFFFFFFFFFFU;
+}
+
+static inline bool
+rsapss_crt_sign_bn(
+  uint32_t modBits,
+  uint32_t eBits,
+  uint32_t pqBits,
+  uint64_t *skey,
+  uint64_t *m,
+  uint64_t *m_,
+  uint64_t *s
+)
+{
+  uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t eLen = (eBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t pqLen = (pqBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t pkeyLen = nLen + nLen + eLen;
+  uint64_t *n = skey;
+  uint64_t *r2 = skey + nLen;
+  uint64_t *e = skey + nLen + nLen;
+  uint64_t *p = skey + pkeyLen;
+  uint64_t *r2p = skey + pkeyLen + pqLen;
+  uint64_t *q = skey + pkeyLen + (uint32_t)2U * pqLen;
+  uint64_t *r2q = skey + pkeyLen + (uint32_t)3U * pqLen;
+  uint64_t *dp = skey + pkeyLen + (uint32_t)4U * pqLen;
+  uint64_t *dq = skey + pkeyLen + (uint32_t)5U * pqLen;
+  uint64_t *qinv = skey + pkeyLen + (uint32_t)6U * pqLen;
+  KRML_CHECK_SIZE(sizeof (uint64_t), pqLen + pqLen);
+  uint64_t m2[pqLen + pqLen];
+  memset(m2, 0U, (pqLen + pqLen) * sizeof (uint64_t));
+  memcpy(m2, m, nLen * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), pqLen);
+  uint64_t mp[pqLen];
+  memset(mp, 0U, pqLen * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), pqLen);
+  uint64_t mq[pqLen];
+  memset(mq, 0U, pqLen * sizeof (uint64_t));
+  bn_mod_slow_precompr2(pqLen, p, m2, r2p, mp);
+  bn_mod_slow_precompr2(pqLen, q, m2, r2q, mq);
+  KRML_CHECK_SIZE(sizeof (uint64_t), pqLen);
+  uint64_t sp[pqLen];
+  memset(sp, 0U, pqLen * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), pqLen + pqLen);
+  uint64_t sq[pqLen + pqLen];
+  memset(sq, 0U, (pqLen + pqLen) * sizeof (uint64_t));
+  Hacl_Bignum_Exponentiation_bn_mod_exp_fw_ct_precompr2_u64(pqLen,
+    p,
+    mp,
+    pqBits,
+    dp,
+    (uint32_t)4U,
+    r2p,
+    sp);
+  Hacl_Bignum_Exponentiation_bn_mod_exp_fw_ct_precompr2_u64(pqLen,
+    q,
+    mq,
+    pqBits,
+    dq,
+    (uint32_t)4U,
+    r2q,
+    sq);
+  KRML_CHECK_SIZE(sizeof (uint64_t), pqLen);
+  uint64_t sq_p[pqLen];
+  memset(sq_p, 0U, pqLen * sizeof (uint64_t));
+  bn_mod_slow_precompr2(pqLen, p, sq, r2p, sq_p);
+  KRML_CHECK_SIZE(sizeof (uint64_t), pqLen);
+  uint64_t diff[pqLen];
+  memset(diff, 0U, pqLen * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), pqLen);
+  uint64_t diff_p[pqLen];
+  memset(diff_p, 0U, pqLen * sizeof (uint64_t));
+  uint64_t c0 = Hacl_Bignum_Addition_bn_sub_eq_len_u64(pqLen, sp, sq_p, diff);
+  uint64_t c1 = Hacl_Bignum_Addition_bn_add_eq_len_u64(pqLen, diff, p, diff_p);
+  uint64_t mask = (uint64_t)0U - c0;
+  for (uint32_t i = (uint32_t)0U; i < pqLen; i++)
+  {
+    uint64_t *os = diff;
+    uint64_t x = (mask & diff_p[i]) | (~mask & diff[i]);
+    os[i] = x;
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), pqLen + pqLen);
+  uint64_t c[pqLen + pqLen];
+  memset(c, 0U, (pqLen + pqLen) * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)4U * pqLen);
+  uint64_t tmp[(uint32_t)4U * pqLen];
+  memset(tmp, 0U, (uint32_t)4U * pqLen * sizeof (uint64_t));
+  Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint64(pqLen, qinv, diff, tmp, c);
+  KRML_CHECK_SIZE(sizeof (uint64_t), pqLen);
+  uint64_t h[pqLen];
+  memset(h, 0U, pqLen * sizeof (uint64_t));
+  bn_mod_slow_precompr2(pqLen, p, c, r2p, h);
+  Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint64(pqLen, q, h, tmp, c);
+  uint64_t c2 = Hacl_Bignum_Addition_bn_add_eq_len_u64(pqLen + pqLen, c, sq, c);
+  memcpy(s, c, nLen * sizeof (uint64_t));
+  Hacl_Bignum_Exponentiation_bn_mod_exp_raw_precompr2_u64(nLen, n, s, eBits, e, r2, m_);
+  uint64_t mask0 = (uint64_t)0xFFFFFFFFFFFFFFFFU;
+  for (uint32_t i = (uint32_t)0U; i < nLen; i++)
+  {
+    uint64_t uu____0 = FStar_UInt64_eq_mask(m[i], m_[i]);
+    mask0 = uu____0 & mask0;
+  }
+  uint64_t mask1 = mask0;
+  uint64_t eq_m = mask1;
+  for (uint32_t i = (uint32_t)0U; i < nLen; i++)
+  {
+    uint64_t *os = s;
+    uint64_t x = s[i];
+    uint64_t x0 = eq_m & x;
+    os[i] = x0;
+  }
+  return eq_m == (uint64_t)0xFFFFFFFFFFFFFFFFU;
+}
+
+bool
+Hacl_RSAPSS_rsapss_crt_sign(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t modBits,
+  uint32_t eBits,
+  uint32_t pqBits,
+  uint64_t *skey,
+  uint32_t sLen,
+  uint8_t *salt,
+  uint32_t msgLen,
+  uint8_t *msg,
+  uint8_t *sgnt
+)
+{
+  uint32_t hLen = Hacl_Impl_RSAPSS_MGF_hash_len(a);
+  bool
+  b =
+    sLen
+    <= (uint32_t)0xffffffffU - hLen - (uint32_t)8U
+    &&
+      sLen
+      + hLen
+      + (uint32_t)2U
+      <= (modBits - (uint32_t)1U - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  if (b)
+  {
+    uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+    KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+    uint64_t m[nLen];
+    memset(m, 0U, nLen * sizeof (uint64_t));
+    uint32_t emBits = modBits - (uint32_t)1U;
+    uint32_t emLen = (emBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+    KRML_CHECK_SIZE(sizeof (uint8_t), emLen);
+    uint8_t em[emLen];
+    memset(em, 0U, emLen * sizeof (uint8_t));
+    Hacl_Impl_RSAPSS_Padding_pss_encode(a, sLen, salt, msgLen, msg, emBits, em);
+    Hacl_Bignum_Convert_bn_from_bytes_be_uint64(emLen, em, m);
+    uint32_t k = (modBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+    KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+    uint64_t s[nLen];
+    memset(s, 0U, nLen * sizeof (uint64_t));
+    KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+    uint64_t m_[nLen];
+    memset(m_, 0U, nLen * sizeof (uint64_t));
+    bool eq_b = rsapss_crt_sign_bn(modBits, eBits, pqBits, skey, m, m_, s);
+    Hacl_Bignum_Convert_bn_to_bytes_be_uint64(k, s, sgnt);
+    return eq_b;
+  }
+  return false;
+}
+
+uint64_t
+*Hacl_RSAPSS_new_rsapss_load_skey_crt(
+  uint32_t modBits,
+  uint32_t eBits,
+  uint32_t pqBits,
+  uint8_t *nb,
+  uint8_t *eb,
+  uint8_t *pb,
+  uint8_t *qb,
+  uint8_t *dpb,
+  uint8_t *dqb,
+  uint8_t *qinvb
+)
+{
+  uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t eLen = (eBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t pqLen = (pqBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  if
+  (
+    !((uint32_t)1U
+    < modBits
+    && (uint32_t)0U < eBits
+    && nLen <= (uint32_t)33554431U
+    && eLen <= (uint32_t)67108863U
+    && nLen + nLen <= (uint32_t)0xffffffffU - eLen
+    && (uint32_t)1U < pqBits
+    && pqLen <= (uint32_t)33554431U
+    && modBits <= (uint32_t)2U * pqBits)
+  )
+  {
+    return NULL;
+  }
+  uint32_t skeyLen = nLen + nLen + eLen + (uint32_t)7U * pqLen;
+  KRML_CHECK_SIZE(sizeof (uint64_t), skeyLen);
+  uint64_t *skey = KRML_HOST_CALLOC(skeyLen, sizeof (uint64_t));
+  if (skey == NULL)
+  {
+    return skey;
+  }
+  uint64_t *skey1 = skey;
+  uint64_t *skey2 = skey1;
+  bool b = load_skey_crt(modBits, eBits, pqBits, nb, eb, pb, qb, dpb, dqb, qinvb, skey2);
+  if (b)
+  {
+    return skey2;
+  }
+  return NULL;
+}
+
+bool
+Hacl_RSAPSS_rsapss_skey_crt_sign(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t modBits,
+  uint32_t eBits,
+  uint32_t pqBits,
+  uint8_t *nb,
+  uint8_t *eb,
+  uint8_t *pb,
+  uint8_t *qb,
+  uint8_t *dpb,
+  uint8_t *dqb,
+  uint8_t *qinvb,
+  uint32_t sLen,
+  uint8_t *salt,
+  uint32_t msgLen,
+  uint8_t *msg,
+  uint8_t *sgnt
+)
+{
+  KRML_CHECK_SIZE(sizeof (uint64_t),
+    (uint32_t)2U
+    * ((modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U)
+    + (eBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U
+    + (uint32_t)7U * ((pqBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U));
+  uint64_t
+  skey[(uint32_t)2U
+  * ((modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U)
+  + (eBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U
+  + (uint32_t)7U * ((pqBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U)];
+  memset(skey,
+    0U,
+    ((uint32_t)2U
+    * ((modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U)
+    + (eBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U
+    + (uint32_t)7U * ((pqBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U))
+    * sizeof (uint64_t));
+  bool b = load_skey_crt(modBits, eBits, pqBits, nb, eb, pb, qb, dpb, dqb, qinvb, skey);
+  if (b)
+  {
+    return
+      Hacl_RSAPSS_rsapss_crt_sign(a,
+        modBits,
+        eBits,
+        pqBits,
+        skey,
+        sLen,
+        salt,
+        msgLen,
+        msg,
+        sgnt);
+  }
+  return false;
+}
@@ -0,0 +1,201 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __Hacl_SHA2_Generic_H
+#define __Hacl_SHA2_Generic_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+
+
+typedef struct Hacl_Impl_SHA2_Types_uint8_2p_s
+{
+  uint8_t *fst;
+  uint8_t *snd;
+}
+Hacl_Impl_SHA2_Types_uint8_2p;
+
+typedef struct Hacl_Impl_SHA2_Types_uint8_3p_s
+{
+  uint8_t *fst;
+  Hacl_Impl_SHA2_Types_uint8_2p snd;
+}
+Hacl_Impl_SHA2_Types_uint8_3p;
+
+typedef struct Hacl_Impl_SHA2_Types_uint8_4p_s
+{
+  uint8_t *fst;
+  Hacl_Impl_SHA2_Types_uint8_3p snd;
+}
+Hacl_Impl_SHA2_Types_uint8_4p;
+
+typedef struct Hacl_Impl_SHA2_Types_uint8_5p_s
+{
+  uint8_t *fst;
+  Hacl_Impl_SHA2_Types_uint8_4p snd;
+}
+Hacl_Impl_SHA2_Types_uint8_5p;
+
+typedef struct Hacl_Impl_SHA2_Types_uint8_6p_s
+{
+  uint8_t *fst;
+  Hacl_Impl_SHA2_Types_uint8_5p snd;
+}
+Hacl_Impl_SHA2_Types_uint8_6p;
+
+typedef struct Hacl_Impl_SHA2_Types_uint8_7p_s
+{
+  uint8_t *fst;
+  Hacl_Impl_SHA2_Types_uint8_6p snd;
+}
+Hacl_Impl_SHA2_Types_uint8_7p;
+
+typedef struct Hacl_Impl_SHA2_Types_uint8_8p_s
+{
+  uint8_t *fst;
+  Hacl_Impl_SHA2_Types_uint8_7p snd;
+}
+Hacl_Impl_SHA2_Types_uint8_8p;
+
+static const
+uint32_t
+Hacl_Impl_SHA2_Generic_h224[8U] =
+  {
+    (uint32_t)0xc1059ed8U, (uint32_t)0x367cd507U, (uint32_t)0x3070dd17U, (uint32_t)0xf70e5939U,
+    (uint32_t)0xffc00b31U, (uint32_t)0x68581511U, (uint32_t)0x64f98fa7U, (uint32_t)0xbefa4fa4U
+  };
+
+static const
+uint32_t
+Hacl_Impl_SHA2_Generic_h256[8U] =
+  {
+    (uint32_t)0x6a09e667U, (uint32_t)0xbb67ae85U, (uint32_t)0x3c6ef372U, (uint32_t)0xa54ff53aU,
+    (uint32_t)0x510e527fU, (uint32_t)0x9b05688cU, (uint32_t)0x1f83d9abU, (uint32_t)0x5be0cd19U
+  };
+
+static const
+uint64_t
+Hacl_Impl_SHA2_Generic_h384[8U] =
+  {
+    (uint64_t)0xcbbb9d5dc1059ed8ULL, (uint64_t)0x629a292a367cd507ULL,
+    (uint64_t)0x9159015a3070dd17ULL, (uint64_t)0x152fecd8f70e5939ULL,
+    (uint64_t)0x67332667ffc00b31ULL, (uint64_t)0x8eb44a8768581511ULL,
+    (uint64_t)0xdb0c2e0d64f98fa7ULL, (uint64_t)0x47b5481dbefa4fa4ULL
+  };
+
+static const
+uint64_t
+Hacl_Impl_SHA2_Generic_h512[8U] =
+  {
+    (uint64_t)0x6a09e667f3bcc908ULL, (uint64_t)0xbb67ae8584caa73bULL,
+    (uint64_t)0x3c6ef372fe94f82bULL, (uint64_t)0xa54ff53a5f1d36f1ULL,
+    (uint64_t)0x510e527fade682d1ULL, (uint64_t)0x9b05688c2b3e6c1fULL,
+    (uint64_t)0x1f83d9abfb41bd6bULL, (uint64_t)0x5be0cd19137e2179ULL
+  };
+
+static const
+uint32_t
+Hacl_Impl_SHA2_Generic_k224_256[64U] =
+  {
+    (uint32_t)0x428a2f98U, (uint32_t)0x71374491U, (uint32_t)0xb5c0fbcfU, (uint32_t)0xe9b5dba5U,
+    (uint32_t)0x3956c25bU, (uint32_t)0x59f111f1U, (uint32_t)0x923f82a4U, (uint32_t)0xab1c5ed5U,
+    (uint32_t)0xd807aa98U, (uint32_t)0x12835b01U, (uint32_t)0x243185beU, (uint32_t)0x550c7dc3U,
+    (uint32_t)0x72be5d74U, (uint32_t)0x80deb1feU, (uint32_t)0x9bdc06a7U, (uint32_t)0xc19bf174U,
+    (uint32_t)0xe49b69c1U, (uint32_t)0xefbe4786U, (uint32_t)0x0fc19dc6U, (uint32_t)0x240ca1ccU,
+    (uint32_t)0x2de92c6fU, (uint32_t)0x4a7484aaU, (uint32_t)0x5cb0a9dcU, (uint32_t)0x76f988daU,
+    (uint32_t)0x983e5152U, (uint32_t)0xa831c66dU, (uint32_t)0xb00327c8U, (uint32_t)0xbf597fc7U,
+    (uint32_t)0xc6e00bf3U, (uint32_t)0xd5a79147U, (uint32_t)0x06ca6351U, (uint32_t)0x14292967U,
+    (uint32_t)0x27b70a85U, (uint32_t)0x2e1b2138U, (uint32_t)0x4d2c6dfcU, (uint32_t)0x53380d13U,
+    (uint32_t)0x650a7354U, (uint32_t)0x766a0abbU, (uint32_t)0x81c2c92eU, (uint32_t)0x92722c85U,
+    (uint32_t)0xa2bfe8a1U, (uint32_t)0xa81a664bU, (uint32_t)0xc24b8b70U, (uint32_t)0xc76c51a3U,
+    (uint32_t)0xd192e819U, (uint32_t)0xd6990624U, (uint32_t)0xf40e3585U, (uint32_t)0x106aa070U,
+    (uint32_t)0x19a4c116U, (uint32_t)0x1e376c08U, (uint32_t)0x2748774cU, (uint32_t)0x34b0bcb5U,
+    (uint32_t)0x391c0cb3U, (uint32_t)0x4ed8aa4aU, (uint32_t)0x5b9cca4fU, (uint32_t)0x682e6ff3U,
+    (uint32_t)0x748f82eeU, (uint32_t)0x78a5636fU, (uint32_t)0x84c87814U, (uint32_t)0x8cc70208U,
+    (uint32_t)0x90befffaU, (uint32_t)0xa4506cebU, (uint32_t)0xbef9a3f7U, (uint32_t)0xc67178f2U
+  };
+
+static const
+uint64_t
+Hacl_Impl_SHA2_Generic_k384_512[80U] =
+  {
+    (uint64_t)0x428a2f98d728ae22ULL, (uint64_t)0x7137449123ef65cdULL,
+    (uint64_t)0xb5c0fbcfec4d3b2fULL, (uint64_t)0xe9b5dba58189dbbcULL,
+    (uint64_t)0x3956c25bf348b538ULL, (uint64_t)0x59f111f1b605d019ULL,
+    (uint64_t)0x923f82a4af194f9bULL, (uint64_t)0xab1c5ed5da6d8118ULL,
+    (uint64_t)0xd807aa98a3030242ULL, (uint64_t)0x12835b0145706fbeULL,
+    (uint64_t)0x243185be4ee4b28cULL, (uint64_t)0x550c7dc3d5ffb4e2ULL,
+    (uint64_t)0x72be5d74f27b896fULL, (uint64_t)0x80deb1fe3b1696b1ULL,
+    (uint64_t)0x9bdc06a725c71235ULL, (uint64_t)0xc19bf174cf692694ULL,
+    (uint64_t)0xe49b69c19ef14ad2ULL, (uint64_t)0xefbe4786384f25e3ULL,
+    (uint64_t)0x0fc19dc68b8cd5b5ULL, (uint64_t)0x240ca1cc77ac9c65ULL,
+    (uint64_t)0x2de92c6f592b0275ULL, (uint64_t)0x4a7484aa6ea6e483ULL,
+    (uint64_t)0x5cb0a9dcbd41fbd4ULL, (uint64_t)0x76f988da831153b5ULL,
+    (uint64_t)0x983e5152ee66dfabULL, (uint64_t)0xa831c66d2db43210ULL,
+    (uint64_t)0xb00327c898fb213fULL, (uint64_t)0xbf597fc7beef0ee4ULL,
+    (uint64_t)0xc6e00bf33da88fc2ULL, (uint64_t)0xd5a79147930aa725ULL,
+    (uint64_t)0x06ca6351e003826fULL, (uint64_t)0x142929670a0e6e70ULL,
+    (uint64_t)0x27b70a8546d22ffcULL, (uint64_t)0x2e1b21385c26c926ULL,
+    (uint64_t)0x4d2c6dfc5ac42aedULL, (uint64_t)0x53380d139d95b3dfULL,
+    (uint64_t)0x650a73548baf63deULL, (uint64_t)0x766a0abb3c77b2a8ULL,
+    (uint64_t)0x81c2c92e47edaee6ULL, (uint64_t)0x92722c851482353bULL,
+    (uint64_t)0xa2bfe8a14cf10364ULL, (uint64_t)0xa81a664bbc423001ULL,
+    (uint64_t)0xc24b8b70d0f89791ULL, (uint64_t)0xc76c51a30654be30ULL,
+    (uint64_t)0xd192e819d6ef5218ULL, (uint64_t)0xd69906245565a910ULL,
+    (uint64_t)0xf40e35855771202aULL, (uint64_t)0x106aa07032bbd1b8ULL,
+    (uint64_t)0x19a4c116b8d2d0c8ULL, (uint64_t)0x1e376c085141ab53ULL,
+    (uint64_t)0x2748774cdf8eeb99ULL, (uint64_t)0x34b0bcb5e19b48a8ULL,
+    (uint64_t)0x391c0cb3c5c95a63ULL, (uint64_t)0x4ed8aa4ae3418acbULL,
+    (uint64_t)0x5b9cca4f7763e373ULL, (uint64_t)0x682e6ff3d6b2b8a3ULL,
+    (uint64_t)0x748f82ee5defb2fcULL, (uint64_t)0x78a5636f43172f60ULL,
+    (uint64_t)0x84c87814a1f0ab72ULL, (uint64_t)0x8cc702081a6439ecULL,
+    (uint64_t)0x90befffa23631e28ULL, (uint64_t)0xa4506cebde82bde9ULL,
+    (uint64_t)0xbef9a3f7b2c67915ULL, (uint64_t)0xc67178f2e372532bULL,
+    (uint64_t)0xca273eceea26619cULL, (uint64_t)0xd186b8c721c0c207ULL,
+    (uint64_t)0xeada7dd6cde0eb1eULL, (uint64_t)0xf57d4f7fee6ed178ULL,
+    (uint64_t)0x06f067aa72176fbaULL, (uint64_t)0x0a637dc5a2c898a6ULL,
+    (uint64_t)0x113f9804bef90daeULL, (uint64_t)0x1b710b35131c471bULL,
+    (uint64_t)0x28db77f523047d84ULL, (uint64_t)0x32caab7b40c72493ULL,
+    (uint64_t)0x3c9ebe0a15c9bebcULL, (uint64_t)0x431d67c49c100d4cULL,
+    (uint64_t)0x4cc5d4becb3e42b6ULL, (uint64_t)0x597f299cfc657e2aULL,
+    (uint64_t)0x5fcb6fab3ad6faecULL, (uint64_t)0x6c44198c4a475817ULL
+  };
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_SHA2_Generic_H_DEFINED
+#endif
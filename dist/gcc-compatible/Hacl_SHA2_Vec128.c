@@ -0,0 +1,742 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Hacl_SHA2_Vec128.h"
+
+static inline void sha224_init4(Lib_IntVector_Intrinsics_vec128 *hash)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128 *os = hash;
+    uint32_t hi = Hacl_Impl_SHA2_Generic_h224[i];
+    Lib_IntVector_Intrinsics_vec128 x = Lib_IntVector_Intrinsics_vec128_load32(hi);
+    os[i] = x;
+  }
+}
+
+static inline void
+sha224_update4(Hacl_Impl_SHA2_Types_uint8_4p block, Lib_IntVector_Intrinsics_vec128 *hash)
+{
+  Lib_IntVector_Intrinsics_vec128 hash_old[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    hash_old[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 ws[16U];
+  for (uint32_t _i = 0U; _i < (uint32_t)16U; ++_i)
+    ws[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  memcpy(hash_old, hash, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec128));
+  uint8_t *b3 = block.snd.snd.snd;
+  uint8_t *b2 = block.snd.snd.fst;
+  uint8_t *b1 = block.snd.fst;
+  uint8_t *b0 = block.fst;
+  ws[0U] = Lib_IntVector_Intrinsics_vec128_load32_be(b0);
+  ws[1U] = Lib_IntVector_Intrinsics_vec128_load32_be(b1);
+  ws[2U] = Lib_IntVector_Intrinsics_vec128_load32_be(b2);
+  ws[3U] = Lib_IntVector_Intrinsics_vec128_load32_be(b3);
+  ws[4U] = Lib_IntVector_Intrinsics_vec128_load32_be(b0 + (uint32_t)16U);
+  ws[5U] = Lib_IntVector_Intrinsics_vec128_load32_be(b1 + (uint32_t)16U);
+  ws[6U] = Lib_IntVector_Intrinsics_vec128_load32_be(b2 + (uint32_t)16U);
+  ws[7U] = Lib_IntVector_Intrinsics_vec128_load32_be(b3 + (uint32_t)16U);
+  ws[8U] = Lib_IntVector_Intrinsics_vec128_load32_be(b0 + (uint32_t)32U);
+  ws[9U] = Lib_IntVector_Intrinsics_vec128_load32_be(b1 + (uint32_t)32U);
+  ws[10U] = Lib_IntVector_Intrinsics_vec128_load32_be(b2 + (uint32_t)32U);
+  ws[11U] = Lib_IntVector_Intrinsics_vec128_load32_be(b3 + (uint32_t)32U);
+  ws[12U] = Lib_IntVector_Intrinsics_vec128_load32_be(b0 + (uint32_t)48U);
+  ws[13U] = Lib_IntVector_Intrinsics_vec128_load32_be(b1 + (uint32_t)48U);
+  ws[14U] = Lib_IntVector_Intrinsics_vec128_load32_be(b2 + (uint32_t)48U);
+  ws[15U] = Lib_IntVector_Intrinsics_vec128_load32_be(b3 + (uint32_t)48U);
+  {
+    Lib_IntVector_Intrinsics_vec128 v0_ = ws[0U];
+    Lib_IntVector_Intrinsics_vec128 v1_ = ws[1U];
+    Lib_IntVector_Intrinsics_vec128 v2_ = ws[2U];
+    Lib_IntVector_Intrinsics_vec128 v3_ = ws[3U];
+    Lib_IntVector_Intrinsics_vec128 v0_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v1_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v2_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v3_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v0_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v1_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v2_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec128 v3_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v1_0, v3_0);
+    ws[0U] = v0_1;
+    ws[1U] = v1_1;
+    ws[2U] = v2_1;
+    ws[3U] = v3_1;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec128 v0_ = ws[4U];
+    Lib_IntVector_Intrinsics_vec128 v1_ = ws[5U];
+    Lib_IntVector_Intrinsics_vec128 v2_ = ws[6U];
+    Lib_IntVector_Intrinsics_vec128 v3_ = ws[7U];
+    Lib_IntVector_Intrinsics_vec128 v0_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v1_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v2_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v3_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v0_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v1_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v2_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec128 v3_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v1_0, v3_0);
+    ws[4U] = v0_1;
+    ws[5U] = v1_1;
+    ws[6U] = v2_1;
+    ws[7U] = v3_1;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec128 v0_ = ws[8U];
+    Lib_IntVector_Intrinsics_vec128 v1_ = ws[9U];
+    Lib_IntVector_Intrinsics_vec128 v2_ = ws[10U];
+    Lib_IntVector_Intrinsics_vec128 v3_ = ws[11U];
+    Lib_IntVector_Intrinsics_vec128 v0_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v1_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v2_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v3_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v0_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v1_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v2_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec128 v3_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v1_0, v3_0);
+    ws[8U] = v0_1;
+    ws[9U] = v1_1;
+    ws[10U] = v2_1;
+    ws[11U] = v3_1;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec128 v0_ = ws[12U];
+    Lib_IntVector_Intrinsics_vec128 v1_ = ws[13U];
+    Lib_IntVector_Intrinsics_vec128 v2_ = ws[14U];
+    Lib_IntVector_Intrinsics_vec128 v3_ = ws[15U];
+    Lib_IntVector_Intrinsics_vec128 v0_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v1_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v2_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v3_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v0_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v1_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v2_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec128 v3_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v1_0, v3_0);
+    ws[12U] = v0_1;
+    ws[13U] = v1_1;
+    ws[14U] = v2_1;
+    ws[15U] = v3_1;
+  }
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)4U; i0++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      uint32_t k_t = Hacl_Impl_SHA2_Generic_k224_256[(uint32_t)16U * i0 + i];
+      Lib_IntVector_Intrinsics_vec128 ws_t = ws[i];
+      Lib_IntVector_Intrinsics_vec128 a0 = hash[0U];
+      Lib_IntVector_Intrinsics_vec128 b0 = hash[1U];
+      Lib_IntVector_Intrinsics_vec128 c0 = hash[2U];
+      Lib_IntVector_Intrinsics_vec128 d0 = hash[3U];
+      Lib_IntVector_Intrinsics_vec128 e0 = hash[4U];
+      Lib_IntVector_Intrinsics_vec128 f0 = hash[5U];
+      Lib_IntVector_Intrinsics_vec128 g0 = hash[6U];
+      Lib_IntVector_Intrinsics_vec128 h02 = hash[7U];
+      Lib_IntVector_Intrinsics_vec128 k_e_t = Lib_IntVector_Intrinsics_vec128_load32(k_t);
+      Lib_IntVector_Intrinsics_vec128
+      t1 =
+        Lib_IntVector_Intrinsics_vec128_add32(Lib_IntVector_Intrinsics_vec128_add32(Lib_IntVector_Intrinsics_vec128_add32(Lib_IntVector_Intrinsics_vec128_add32(h02, Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(e0, (uint32_t)6U), Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(e0, (uint32_t)11U), Lib_IntVector_Intrinsics_vec128_rotate_right32(e0, (uint32_t)25U)))), Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_and(e0, f0), Lib_IntVector_Intrinsics_vec128_and(Lib_IntVector_Intrinsics_vec128_lognot(e0), g0))), k_e_t), ws_t);
+      Lib_IntVector_Intrinsics_vec128
+      t2 =
+        Lib_IntVector_Intrinsics_vec128_add32(Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(a0, (uint32_t)2U), Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(a0, (uint32_t)13U), Lib_IntVector_Intrinsics_vec128_rotate_right32(a0, (uint32_t)22U))), Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_and(a0, b0), Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_and(a0, c0), Lib_IntVector_Intrinsics_vec128_and(b0, c0))));
+      Lib_IntVector_Intrinsics_vec128 a1 = Lib_IntVector_Intrinsics_vec128_add32(t1, t2);
+      Lib_IntVector_Intrinsics_vec128 b1 = a0;
+      Lib_IntVector_Intrinsics_vec128 c1 = b0;
+      Lib_IntVector_Intrinsics_vec128 d1 = c0;
+      Lib_IntVector_Intrinsics_vec128 e1 = Lib_IntVector_Intrinsics_vec128_add32(d0, t1);
+      Lib_IntVector_Intrinsics_vec128 f1 = e0;
+      Lib_IntVector_Intrinsics_vec128 g1 = f0;
+      Lib_IntVector_Intrinsics_vec128 h12 = g0;
+      hash[0U] = a1;
+      hash[1U] = b1;
+      hash[2U] = c1;
+      hash[3U] = d1;
+      hash[4U] = e1;
+      hash[5U] = f1;
+      hash[6U] = g1;
+      hash[7U] = h12;
+    }
+    if (i0 < (uint32_t)3U)
+    {
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+      {
+        Lib_IntVector_Intrinsics_vec128 t16 = ws[i];
+        Lib_IntVector_Intrinsics_vec128 t15 = ws[(i + (uint32_t)1U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec128 t7 = ws[(i + (uint32_t)9U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec128 t2 = ws[(i + (uint32_t)14U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec128
+        s1 =
+          Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(t2, (uint32_t)17U), Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(t2, (uint32_t)19U), Lib_IntVector_Intrinsics_vec128_shift_right32(t2, (uint32_t)10U)));
+        Lib_IntVector_Intrinsics_vec128
+        s0 =
+          Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(t15, (uint32_t)7U), Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(t15, (uint32_t)18U), Lib_IntVector_Intrinsics_vec128_shift_right32(t15, (uint32_t)3U)));
+        ws[i] = Lib_IntVector_Intrinsics_vec128_add32(Lib_IntVector_Intrinsics_vec128_add32(Lib_IntVector_Intrinsics_vec128_add32(s1, t7), s0), t16);
+      }
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128 *os = hash;
+    Lib_IntVector_Intrinsics_vec128 x = Lib_IntVector_Intrinsics_vec128_add32(hash[i], hash_old[i]);
+    os[i] = x;
+  }
+}
+
+static inline void
+sha224_update_nblocks4(uint32_t len, Hacl_Impl_SHA2_Types_uint8_4p b, Lib_IntVector_Intrinsics_vec128 *st)
+{
+  uint32_t blocks = len / (uint32_t)64U;
+  for (uint32_t i = (uint32_t)0U; i < blocks; i++)
+  {
+    uint8_t *b3 = b.snd.snd.snd;
+    uint8_t *b2 = b.snd.snd.fst;
+    uint8_t *b1 = b.snd.fst;
+    uint8_t *b0 = b.fst;
+    uint8_t *bl0 = b0 + i * (uint32_t)64U;
+    uint8_t *bl1 = b1 + i * (uint32_t)64U;
+    uint8_t *bl2 = b2 + i * (uint32_t)64U;
+    uint8_t *bl3 = b3 + i * (uint32_t)64U;
+    Hacl_Impl_SHA2_Types_uint8_4p mb = { .fst = bl0, .snd = { .fst = bl1, .snd = { .fst = bl2, .snd = bl3 } } };
+    sha224_update4(mb, st);
+  }
+}
+
+static inline void
+sha224_update_last4(uint64_t totlen, uint32_t len, Hacl_Impl_SHA2_Types_uint8_4p b, Lib_IntVector_Intrinsics_vec128 *hash)
+{
+  uint32_t blocks;
+  if (len + (uint32_t)8U + (uint32_t)1U <= (uint32_t)64U)
+  {
+    blocks = (uint32_t)1U;
+  }
+  else
+  {
+    blocks = (uint32_t)2U;
+  }
+  uint32_t fin = blocks * (uint32_t)64U;
+  uint8_t last[512U] = { 0U };
+  uint8_t totlen_buf[8U] = { 0U };
+  uint64_t total_len_bits = totlen << (uint32_t)3U;
+  store64_be(totlen_buf, total_len_bits);
+  uint8_t *b3 = b.snd.snd.snd;
+  uint8_t *b2 = b.snd.snd.fst;
+  uint8_t *b1 = b.snd.fst;
+  uint8_t *b0 = b.fst;
+  uint8_t *last0 = last + (uint32_t)0U;
+  memcpy(last0, b0, len * sizeof (uint8_t));
+  last0[len] = (uint8_t)0x80U;
+  memcpy(last0 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last00 = last0;
+  uint8_t *last10 = last0 + (uint32_t)64U;
+  uint8_t *last1 = last + (uint32_t)128U;
+  memcpy(last1, b1, len * sizeof (uint8_t));
+  last1[len] = (uint8_t)0x80U;
+  memcpy(last1 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last01 = last1;
+  uint8_t *last11 = last1 + (uint32_t)64U;
+  uint8_t *last2 = last + (uint32_t)256U;
+  memcpy(last2, b2, len * sizeof (uint8_t));
+  last2[len] = (uint8_t)0x80U;
+  memcpy(last2 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last02 = last2;
+  uint8_t *last12 = last2 + (uint32_t)64U;
+  uint8_t *last3 = last + (uint32_t)384U;
+  memcpy(last3, b3, len * sizeof (uint8_t));
+  last3[len] = (uint8_t)0x80U;
+  memcpy(last3 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last03 = last3;
+  uint8_t *last13 = last3 + (uint32_t)64U;
+  Hacl_Impl_SHA2_Types_uint8_4p mb0 = { .fst = last00, .snd = { .fst = last01, .snd = { .fst = last02, .snd = last03 } } };
+  Hacl_Impl_SHA2_Types_uint8_4p mb1 = { .fst = last10, .snd = { .fst = last11, .snd = { .fst = last12, .snd = last13 } } };
+  sha224_update4(mb0, hash);
+  if (blocks > (uint32_t)1U)
+  {
+    sha224_update4(mb1, hash);
+  }
+}
+
+static inline void
+sha224_finish4(Lib_IntVector_Intrinsics_vec128 *st, Hacl_Impl_SHA2_Types_uint8_4p h)
+{
+  uint8_t hbuf[128U] = { 0U };
+  {
+    Lib_IntVector_Intrinsics_vec128 v0_ = st[0U];
+    Lib_IntVector_Intrinsics_vec128 v1_ = st[1U];
+    Lib_IntVector_Intrinsics_vec128 v2_ = st[2U];
+    Lib_IntVector_Intrinsics_vec128 v3_ = st[3U];
+    Lib_IntVector_Intrinsics_vec128 v0_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v1_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v2_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v3_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v0_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v1_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v2_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec128 v3_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v1_0, v3_0);
+    st[0U] = v0_1;
+    st[1U] = v1_1;
+    st[2U] = v2_1;
+    st[3U] = v3_1;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec128 v0_ = st[4U];
+    Lib_IntVector_Intrinsics_vec128 v1_ = st[5U];
+    Lib_IntVector_Intrinsics_vec128 v2_ = st[6U];
+    Lib_IntVector_Intrinsics_vec128 v3_ = st[7U];
+    Lib_IntVector_Intrinsics_vec128 v0_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v1_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v2_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v3_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v0_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v1_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v2_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec128 v3_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v1_0, v3_0);
+    st[4U] = v0_1;
+    st[5U] = v1_1;
+    st[6U] = v2_1;
+    st[7U] = v3_1;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec128 st0_ = st[0U];
+    Lib_IntVector_Intrinsics_vec128 st1_ = st[1U];
+    Lib_IntVector_Intrinsics_vec128 st2_ = st[2U];
+    Lib_IntVector_Intrinsics_vec128 st3_ = st[3U];
+    Lib_IntVector_Intrinsics_vec128 st4_ = st[4U];
+    Lib_IntVector_Intrinsics_vec128 st5_ = st[5U];
+    Lib_IntVector_Intrinsics_vec128 st6_ = st[6U];
+    Lib_IntVector_Intrinsics_vec128 st7_ = st[7U];
+    st[0U] = st0_;
+    st[1U] = st4_;
+    st[2U] = st1_;
+    st[3U] = st5_;
+    st[4U] = st2_;
+    st[5U] = st6_;
+    st[6U] = st3_;
+    st[7U] = st7_;
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128_store32_be(hbuf + i * (uint32_t)16U, st[i]);
+  }
+  uint8_t *b3 = h.snd.snd.snd;
+  uint8_t *b2 = h.snd.snd.fst;
+  uint8_t *b1 = h.snd.fst;
+  uint8_t *b0 = h.fst;
+  memcpy(b0, hbuf, (uint32_t)28U * sizeof (uint8_t));
+  memcpy(b1, hbuf + (uint32_t)32U, (uint32_t)28U * sizeof (uint8_t));
+  memcpy(b2, hbuf + (uint32_t)64U, (uint32_t)28U * sizeof (uint8_t));
+  memcpy(b3, hbuf + (uint32_t)96U, (uint32_t)28U * sizeof (uint8_t));
+}
+
+void
+Hacl_SHA2_Vec128_sha224_4(
+  uint8_t *dst0,
+  uint8_t *dst1,
+  uint8_t *dst2,
+  uint8_t *dst3,
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3
+)
+{
+  Hacl_Impl_SHA2_Types_uint8_4p ib = { .fst = input0, .snd = { .fst = input1, .snd = { .fst = input2, .snd = input3 } } };
+  Hacl_Impl_SHA2_Types_uint8_4p rb = { .fst = dst0, .snd = { .fst = dst1, .snd = { .fst = dst2, .snd = dst3 } } };
+  Lib_IntVector_Intrinsics_vec128 st[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    st[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  sha224_init4(st);
+  uint32_t rem = input_len % (uint32_t)64U;
+  uint64_t len_ = (uint64_t)input_len;
+  sha224_update_nblocks4(input_len, ib, st);
+  uint32_t rem1 = input_len % (uint32_t)64U;
+  uint8_t *b3 = ib.snd.snd.snd;
+  uint8_t *b2 = ib.snd.snd.fst;
+  uint8_t *b1 = ib.snd.fst;
+  uint8_t *b0 = ib.fst;
+  uint8_t *bl0 = b0 + input_len - rem1;
+  uint8_t *bl1 = b1 + input_len - rem1;
+  uint8_t *bl2 = b2 + input_len - rem1;
+  uint8_t *bl3 = b3 + input_len - rem1;
+  Hacl_Impl_SHA2_Types_uint8_4p lb = { .fst = bl0, .snd = { .fst = bl1, .snd = { .fst = bl2, .snd = bl3 } } };
+  sha224_update_last4(len_, rem, lb, st);
+  sha224_finish4(st, rb);
+}
+
+static inline void sha256_init4(Lib_IntVector_Intrinsics_vec128 *hash)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128 *os = hash;
+    uint32_t hi = Hacl_Impl_SHA2_Generic_h256[i];
+    Lib_IntVector_Intrinsics_vec128 x = Lib_IntVector_Intrinsics_vec128_load32(hi);
+    os[i] = x;
+  }
+}
+
+static inline void
+sha256_update4(Hacl_Impl_SHA2_Types_uint8_4p block, Lib_IntVector_Intrinsics_vec128 *hash)
+{
+  Lib_IntVector_Intrinsics_vec128 hash_old[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    hash_old[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 ws[16U];
+  for (uint32_t _i = 0U; _i < (uint32_t)16U; ++_i)
+    ws[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  memcpy(hash_old, hash, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec128));
+  uint8_t *b3 = block.snd.snd.snd;
+  uint8_t *b2 = block.snd.snd.fst;
+  uint8_t *b1 = block.snd.fst;
+  uint8_t *b0 = block.fst;
+  ws[0U] = Lib_IntVector_Intrinsics_vec128_load32_be(b0);
+  ws[1U] = Lib_IntVector_Intrinsics_vec128_load32_be(b1);
+  ws[2U] = Lib_IntVector_Intrinsics_vec128_load32_be(b2);
+  ws[3U] = Lib_IntVector_Intrinsics_vec128_load32_be(b3);
+  ws[4U] = Lib_IntVector_Intrinsics_vec128_load32_be(b0 + (uint32_t)16U);
+  ws[5U] = Lib_IntVector_Intrinsics_vec128_load32_be(b1 + (uint32_t)16U);
+  ws[6U] = Lib_IntVector_Intrinsics_vec128_load32_be(b2 + (uint32_t)16U);
+  ws[7U] = Lib_IntVector_Intrinsics_vec128_load32_be(b3 + (uint32_t)16U);
+  ws[8U] = Lib_IntVector_Intrinsics_vec128_load32_be(b0 + (uint32_t)32U);
+  ws[9U] = Lib_IntVector_Intrinsics_vec128_load32_be(b1 + (uint32_t)32U);
+  ws[10U] = Lib_IntVector_Intrinsics_vec128_load32_be(b2 + (uint32_t)32U);
+  ws[11U] = Lib_IntVector_Intrinsics_vec128_load32_be(b3 + (uint32_t)32U);
+  ws[12U] = Lib_IntVector_Intrinsics_vec128_load32_be(b0 + (uint32_t)48U);
+  ws[13U] = Lib_IntVector_Intrinsics_vec128_load32_be(b1 + (uint32_t)48U);
+  ws[14U] = Lib_IntVector_Intrinsics_vec128_load32_be(b2 + (uint32_t)48U);
+  ws[15U] = Lib_IntVector_Intrinsics_vec128_load32_be(b3 + (uint32_t)48U);
+  {
+    Lib_IntVector_Intrinsics_vec128 v0_ = ws[0U];
+    Lib_IntVector_Intrinsics_vec128 v1_ = ws[1U];
+    Lib_IntVector_Intrinsics_vec128 v2_ = ws[2U];
+    Lib_IntVector_Intrinsics_vec128 v3_ = ws[3U];
+    Lib_IntVector_Intrinsics_vec128 v0_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v1_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v2_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v3_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v0_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v1_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v2_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec128 v3_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v1_0, v3_0);
+    ws[0U] = v0_1;
+    ws[1U] = v1_1;
+    ws[2U] = v2_1;
+    ws[3U] = v3_1;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec128 v0_ = ws[4U];
+    Lib_IntVector_Intrinsics_vec128 v1_ = ws[5U];
+    Lib_IntVector_Intrinsics_vec128 v2_ = ws[6U];
+    Lib_IntVector_Intrinsics_vec128 v3_ = ws[7U];
+    Lib_IntVector_Intrinsics_vec128 v0_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v1_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v2_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v3_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v0_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v1_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v2_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec128 v3_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v1_0, v3_0);
+    ws[4U] = v0_1;
+    ws[5U] = v1_1;
+    ws[6U] = v2_1;
+    ws[7U] = v3_1;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec128 v0_ = ws[8U];
+    Lib_IntVector_Intrinsics_vec128 v1_ = ws[9U];
+    Lib_IntVector_Intrinsics_vec128 v2_ = ws[10U];
+    Lib_IntVector_Intrinsics_vec128 v3_ = ws[11U];
+    Lib_IntVector_Intrinsics_vec128 v0_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v1_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v2_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v3_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v0_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v1_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v2_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec128 v3_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v1_0, v3_0);
+    ws[8U] = v0_1;
+    ws[9U] = v1_1;
+    ws[10U] = v2_1;
+    ws[11U] = v3_1;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec128 v0_ = ws[12U];
+    Lib_IntVector_Intrinsics_vec128 v1_ = ws[13U];
+    Lib_IntVector_Intrinsics_vec128 v2_ = ws[14U];
+    Lib_IntVector_Intrinsics_vec128 v3_ = ws[15U];
+    Lib_IntVector_Intrinsics_vec128 v0_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v1_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v2_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v3_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v0_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v1_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v2_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec128 v3_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v1_0, v3_0);
+    ws[12U] = v0_1;
+    ws[13U] = v1_1;
+    ws[14U] = v2_1;
+    ws[15U] = v3_1;
+  }
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)4U; i0++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      uint32_t k_t = Hacl_Impl_SHA2_Generic_k224_256[(uint32_t)16U * i0 + i];
+      Lib_IntVector_Intrinsics_vec128 ws_t = ws[i];
+      Lib_IntVector_Intrinsics_vec128 a0 = hash[0U];
+      Lib_IntVector_Intrinsics_vec128 b0 = hash[1U];
+      Lib_IntVector_Intrinsics_vec128 c0 = hash[2U];
+      Lib_IntVector_Intrinsics_vec128 d0 = hash[3U];
+      Lib_IntVector_Intrinsics_vec128 e0 = hash[4U];
+      Lib_IntVector_Intrinsics_vec128 f0 = hash[5U];
+      Lib_IntVector_Intrinsics_vec128 g0 = hash[6U];
+      Lib_IntVector_Intrinsics_vec128 h02 = hash[7U];
+      Lib_IntVector_Intrinsics_vec128 k_e_t = Lib_IntVector_Intrinsics_vec128_load32(k_t);
+      Lib_IntVector_Intrinsics_vec128
+      t1 =
+        Lib_IntVector_Intrinsics_vec128_add32(Lib_IntVector_Intrinsics_vec128_add32(Lib_IntVector_Intrinsics_vec128_add32(Lib_IntVector_Intrinsics_vec128_add32(h02, Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(e0, (uint32_t)6U), Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(e0, (uint32_t)11U), Lib_IntVector_Intrinsics_vec128_rotate_right32(e0, (uint32_t)25U)))), Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_and(e0, f0), Lib_IntVector_Intrinsics_vec128_and(Lib_IntVector_Intrinsics_vec128_lognot(e0), g0))), k_e_t), ws_t);
+      Lib_IntVector_Intrinsics_vec128
+      t2 =
+        Lib_IntVector_Intrinsics_vec128_add32(Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(a0, (uint32_t)2U), Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(a0, (uint32_t)13U), Lib_IntVector_Intrinsics_vec128_rotate_right32(a0, (uint32_t)22U))), Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_and(a0, b0), Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_and(a0, c0), Lib_IntVector_Intrinsics_vec128_and(b0, c0))));
+      Lib_IntVector_Intrinsics_vec128 a1 = Lib_IntVector_Intrinsics_vec128_add32(t1, t2);
+      Lib_IntVector_Intrinsics_vec128 b1 = a0;
+      Lib_IntVector_Intrinsics_vec128 c1 = b0;
+      Lib_IntVector_Intrinsics_vec128 d1 = c0;
+      Lib_IntVector_Intrinsics_vec128 e1 = Lib_IntVector_Intrinsics_vec128_add32(d0, t1);
+      Lib_IntVector_Intrinsics_vec128 f1 = e0;
+      Lib_IntVector_Intrinsics_vec128 g1 = f0;
+      Lib_IntVector_Intrinsics_vec128 h12 = g0;
+      hash[0U] = a1;
+      hash[1U] = b1;
+      hash[2U] = c1;
+      hash[3U] = d1;
+      hash[4U] = e1;
+      hash[5U] = f1;
+      hash[6U] = g1;
+      hash[7U] = h12;
+    }
+    if (i0 < (uint32_t)3U)
+    {
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+      {
+        Lib_IntVector_Intrinsics_vec128 t16 = ws[i];
+        Lib_IntVector_Intrinsics_vec128 t15 = ws[(i + (uint32_t)1U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec128 t7 = ws[(i + (uint32_t)9U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec128 t2 = ws[(i + (uint32_t)14U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec128
+        s1 =
+          Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(t2, (uint32_t)17U), Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(t2, (uint32_t)19U), Lib_IntVector_Intrinsics_vec128_shift_right32(t2, (uint32_t)10U)));
+        Lib_IntVector_Intrinsics_vec128
+        s0 =
+          Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(t15, (uint32_t)7U), Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(t15, (uint32_t)18U), Lib_IntVector_Intrinsics_vec128_shift_right32(t15, (uint32_t)3U)));
+        ws[i] = Lib_IntVector_Intrinsics_vec128_add32(Lib_IntVector_Intrinsics_vec128_add32(Lib_IntVector_Intrinsics_vec128_add32(s1, t7), s0), t16);
+      }
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128 *os = hash;
+    Lib_IntVector_Intrinsics_vec128 x = Lib_IntVector_Intrinsics_vec128_add32(hash[i], hash_old[i]);
+    os[i] = x;
+  }
+}
+
+static inline void
+sha256_update_nblocks4(uint32_t len, Hacl_Impl_SHA2_Types_uint8_4p b, Lib_IntVector_Intrinsics_vec128 *st)
+{
+  uint32_t blocks = len / (uint32_t)64U;
+  for (uint32_t i = (uint32_t)0U; i < blocks; i++)
+  {
+    uint8_t *b3 = b.snd.snd.snd;
+    uint8_t *b2 = b.snd.snd.fst;
+    uint8_t *b1 = b.snd.fst;
+    uint8_t *b0 = b.fst;
+    uint8_t *bl0 = b0 + i * (uint32_t)64U;
+    uint8_t *bl1 = b1 + i * (uint32_t)64U;
+    uint8_t *bl2 = b2 + i * (uint32_t)64U;
+    uint8_t *bl3 = b3 + i * (uint32_t)64U;
+    Hacl_Impl_SHA2_Types_uint8_4p mb = { .fst = bl0, .snd = { .fst = bl1, .snd = { .fst = bl2, .snd = bl3 } } };
+    sha256_update4(mb, st);
+  }
+}
+
+static inline void
+sha256_update_last4(uint64_t totlen, uint32_t len, Hacl_Impl_SHA2_Types_uint8_4p b, Lib_IntVector_Intrinsics_vec128 *hash)
+{
+  uint32_t blocks;
+  if (len + (uint32_t)8U + (uint32_t)1U <= (uint32_t)64U)
+  {
+    blocks = (uint32_t)1U;
+  }
+  else
+  {
+    blocks = (uint32_t)2U;
+  }
+  uint32_t fin = blocks * (uint32_t)64U;
+  uint8_t last[512U] = { 0U };
+  uint8_t totlen_buf[8U] = { 0U };
+  uint64_t total_len_bits = totlen << (uint32_t)3U;
+  store64_be(totlen_buf, total_len_bits);
+  uint8_t *b3 = b.snd.snd.snd;
+  uint8_t *b2 = b.snd.snd.fst;
+  uint8_t *b1 = b.snd.fst;
+  uint8_t *b0 = b.fst;
+  uint8_t *last0 = last + (uint32_t)0U;
+  memcpy(last0, b0, len * sizeof (uint8_t));
+  last0[len] = (uint8_t)0x80U;
+  memcpy(last0 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last00 = last0;
+  uint8_t *last10 = last0 + (uint32_t)64U;
+  uint8_t *last1 = last + (uint32_t)128U;
+  memcpy(last1, b1, len * sizeof (uint8_t));
+  last1[len] = (uint8_t)0x80U;
+  memcpy(last1 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last01 = last1;
+  uint8_t *last11 = last1 + (uint32_t)64U;
+  uint8_t *last2 = last + (uint32_t)256U;
+  memcpy(last2, b2, len * sizeof (uint8_t));
+  last2[len] = (uint8_t)0x80U;
+  memcpy(last2 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last02 = last2;
+  uint8_t *last12 = last2 + (uint32_t)64U;
+  uint8_t *last3 = last + (uint32_t)384U;
+  memcpy(last3, b3, len * sizeof (uint8_t));
+  last3[len] = (uint8_t)0x80U;
+  memcpy(last3 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last03 = last3;
+  uint8_t *last13 = last3 + (uint32_t)64U;
+  Hacl_Impl_SHA2_Types_uint8_4p mb0 = { .fst = last00, .snd = { .fst = last01, .snd = { .fst = last02, .snd = last03 } } };
+  Hacl_Impl_SHA2_Types_uint8_4p mb1 = { .fst = last10, .snd = { .fst = last11, .snd = { .fst = last12, .snd = last13 } } };
+  sha256_update4(mb0, hash);
+  if (blocks > (uint32_t)1U)
+  {
+    sha256_update4(mb1, hash);
+  }
+}
+
+static inline void
+sha256_finish4(Lib_IntVector_Intrinsics_vec128 *st, Hacl_Impl_SHA2_Types_uint8_4p h)
+{
+  uint8_t hbuf[128U] = { 0U };
+  {
+    Lib_IntVector_Intrinsics_vec128 v0_ = st[0U];
+    Lib_IntVector_Intrinsics_vec128 v1_ = st[1U];
+    Lib_IntVector_Intrinsics_vec128 v2_ = st[2U];
+    Lib_IntVector_Intrinsics_vec128 v3_ = st[3U];
+    Lib_IntVector_Intrinsics_vec128 v0_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v1_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v2_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v3_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v0_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v1_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v2_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec128 v3_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v1_0, v3_0);
+    st[0U] = v0_1;
+    st[1U] = v1_1;
+    st[2U] = v2_1;
+    st[3U] = v3_1;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec128 v0_ = st[4U];
+    Lib_IntVector_Intrinsics_vec128 v1_ = st[5U];
+    Lib_IntVector_Intrinsics_vec128 v2_ = st[6U];
+    Lib_IntVector_Intrinsics_vec128 v3_ = st[7U];
+    Lib_IntVector_Intrinsics_vec128 v0_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v1_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec128 v2_0 = Lib_IntVector_Intrinsics_vec128_interleave_low32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v3_0 = Lib_IntVector_Intrinsics_vec128_interleave_high32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec128 v0_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v1_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec128 v2_1 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec128 v3_1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v1_0, v3_0);
+    st[4U] = v0_1;
+    st[5U] = v1_1;
+    st[6U] = v2_1;
+    st[7U] = v3_1;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec128 st0_ = st[0U];
+    Lib_IntVector_Intrinsics_vec128 st1_ = st[1U];
+    Lib_IntVector_Intrinsics_vec128 st2_ = st[2U];
+    Lib_IntVector_Intrinsics_vec128 st3_ = st[3U];
+    Lib_IntVector_Intrinsics_vec128 st4_ = st[4U];
+    Lib_IntVector_Intrinsics_vec128 st5_ = st[5U];
+    Lib_IntVector_Intrinsics_vec128 st6_ = st[6U];
+    Lib_IntVector_Intrinsics_vec128 st7_ = st[7U];
+    st[0U] = st0_;
+    st[1U] = st4_;
+    st[2U] = st1_;
+    st[3U] = st5_;
+    st[4U] = st2_;
+    st[5U] = st6_;
+    st[6U] = st3_;
+    st[7U] = st7_;
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128_store32_be(hbuf + i * (uint32_t)16U, st[i]);
+  }
+  uint8_t *b3 = h.snd.snd.snd;
+  uint8_t *b2 = h.snd.snd.fst;
+  uint8_t *b1 = h.snd.fst;
+  uint8_t *b0 = h.fst;
+  memcpy(b0, hbuf, (uint32_t)32U * sizeof (uint8_t));
+  memcpy(b1, hbuf + (uint32_t)32U, (uint32_t)32U * sizeof (uint8_t));
+  memcpy(b2, hbuf + (uint32_t)64U, (uint32_t)32U * sizeof (uint8_t));
+  memcpy(b3, hbuf + (uint32_t)96U, (uint32_t)32U * sizeof (uint8_t));
+}
+
+void
+Hacl_SHA2_Vec128_sha256_4(
+  uint8_t *dst0,
+  uint8_t *dst1,
+  uint8_t *dst2,
+  uint8_t *dst3,
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3
+)
+{
+  Hacl_Impl_SHA2_Types_uint8_4p ib = { .fst = input0, .snd = { .fst = input1, .snd = { .fst = input2, .snd = input3 } } };
+  Hacl_Impl_SHA2_Types_uint8_4p rb = { .fst = dst0, .snd = { .fst = dst1, .snd = { .fst = dst2, .snd = dst3 } } };
+  Lib_IntVector_Intrinsics_vec128 st[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    st[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  sha256_init4(st);
+  uint32_t rem = input_len % (uint32_t)64U;
+  uint64_t len_ = (uint64_t)input_len;
+  sha256_update_nblocks4(input_len, ib, st);
+  uint32_t rem1 = input_len % (uint32_t)64U;
+  uint8_t *b3 = ib.snd.snd.snd;
+  uint8_t *b2 = ib.snd.snd.fst;
+  uint8_t *b1 = ib.snd.fst;
+  uint8_t *b0 = ib.fst;
+  uint8_t *bl0 = b0 + input_len - rem1;
+  uint8_t *bl1 = b1 + input_len - rem1;
+  uint8_t *bl2 = b2 + input_len - rem1;
+  uint8_t *bl3 = b3 + input_len - rem1;
+  Hacl_Impl_SHA2_Types_uint8_4p lb = { .fst = bl0, .snd = { .fst = bl1, .snd = { .fst = bl2, .snd = bl3 } } };
+  sha256_update_last4(len_, rem, lb, st);
+  sha256_finish4(st, rb);
+}
@@ -0,0 +1,1586 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Hacl_SHA2_Vec256.h"
+
+static inline void sha224_init8(Lib_IntVector_Intrinsics_vec256 *hash)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 *os = hash;
+    uint32_t hi = Hacl_Impl_SHA2_Generic_h224[i];
+    Lib_IntVector_Intrinsics_vec256 x = Lib_IntVector_Intrinsics_vec256_load32(hi);
+    os[i] = x;
+  }
+}
+
+static inline void
+sha224_update8(Hacl_Impl_SHA2_Types_uint8_8p block, Lib_IntVector_Intrinsics_vec256 *hash)
+{
+  Lib_IntVector_Intrinsics_vec256 hash_old[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    hash_old[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  Lib_IntVector_Intrinsics_vec256 ws[16U];
+  for (uint32_t _i = 0U; _i < (uint32_t)16U; ++_i)
+    ws[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  memcpy(hash_old, hash, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  uint8_t *b7 = block.snd.snd.snd.snd.snd.snd.snd;
+  uint8_t *b6 = block.snd.snd.snd.snd.snd.snd.fst;
+  uint8_t *b5 = block.snd.snd.snd.snd.snd.fst;
+  uint8_t *b4 = block.snd.snd.snd.snd.fst;
+  uint8_t *b3 = block.snd.snd.snd.fst;
+  uint8_t *b2 = block.snd.snd.fst;
+  uint8_t *b1 = block.snd.fst;
+  uint8_t *b0 = block.fst;
+  ws[0U] = Lib_IntVector_Intrinsics_vec256_load32_be(b0);
+  ws[1U] = Lib_IntVector_Intrinsics_vec256_load32_be(b1);
+  ws[2U] = Lib_IntVector_Intrinsics_vec256_load32_be(b2);
+  ws[3U] = Lib_IntVector_Intrinsics_vec256_load32_be(b3);
+  ws[4U] = Lib_IntVector_Intrinsics_vec256_load32_be(b4);
+  ws[5U] = Lib_IntVector_Intrinsics_vec256_load32_be(b5);
+  ws[6U] = Lib_IntVector_Intrinsics_vec256_load32_be(b6);
+  ws[7U] = Lib_IntVector_Intrinsics_vec256_load32_be(b7);
+  ws[8U] = Lib_IntVector_Intrinsics_vec256_load32_be(b0 + (uint32_t)32U);
+  ws[9U] = Lib_IntVector_Intrinsics_vec256_load32_be(b1 + (uint32_t)32U);
+  ws[10U] = Lib_IntVector_Intrinsics_vec256_load32_be(b2 + (uint32_t)32U);
+  ws[11U] = Lib_IntVector_Intrinsics_vec256_load32_be(b3 + (uint32_t)32U);
+  ws[12U] = Lib_IntVector_Intrinsics_vec256_load32_be(b4 + (uint32_t)32U);
+  ws[13U] = Lib_IntVector_Intrinsics_vec256_load32_be(b5 + (uint32_t)32U);
+  ws[14U] = Lib_IntVector_Intrinsics_vec256_load32_be(b6 + (uint32_t)32U);
+  ws[15U] = Lib_IntVector_Intrinsics_vec256_load32_be(b7 + (uint32_t)32U);
+  {
+    Lib_IntVector_Intrinsics_vec256 v0_ = ws[0U];
+    Lib_IntVector_Intrinsics_vec256 v1_ = ws[1U];
+    Lib_IntVector_Intrinsics_vec256 v2_ = ws[2U];
+    Lib_IntVector_Intrinsics_vec256 v3_ = ws[3U];
+    Lib_IntVector_Intrinsics_vec256 v4_ = ws[4U];
+    Lib_IntVector_Intrinsics_vec256 v5_ = ws[5U];
+    Lib_IntVector_Intrinsics_vec256 v6_ = ws[6U];
+    Lib_IntVector_Intrinsics_vec256 v7_ = ws[7U];
+    Lib_IntVector_Intrinsics_vec256 v0_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v1_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v2_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v3_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v4_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v4_, v5_);
+    Lib_IntVector_Intrinsics_vec256 v5_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v4_, v5_);
+    Lib_IntVector_Intrinsics_vec256 v6_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v6_, v7_);
+    Lib_IntVector_Intrinsics_vec256 v7_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v6_, v7_);
+    Lib_IntVector_Intrinsics_vec256 v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v4_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v4_0, v6_0);
+    Lib_IntVector_Intrinsics_vec256 v6_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v4_0, v6_0);
+    Lib_IntVector_Intrinsics_vec256 v5_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v5_0, v7_0);
+    Lib_IntVector_Intrinsics_vec256 v7_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v5_0, v7_0);
+    Lib_IntVector_Intrinsics_vec256 v0_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_1, v4_1);
+    Lib_IntVector_Intrinsics_vec256 v4_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_1, v4_1);
+    Lib_IntVector_Intrinsics_vec256 v1_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_1, v5_1);
+    Lib_IntVector_Intrinsics_vec256 v5_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_1, v5_1);
+    Lib_IntVector_Intrinsics_vec256 v2_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v2_1, v6_1);
+    Lib_IntVector_Intrinsics_vec256 v6_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v2_1, v6_1);
+    Lib_IntVector_Intrinsics_vec256 v3_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v3_1, v7_1);
+    Lib_IntVector_Intrinsics_vec256 v7_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v3_1, v7_1);
+    ws[0U] = v0_2;
+    ws[1U] = v2_2;
+    ws[2U] = v1_2;
+    ws[3U] = v3_2;
+    ws[4U] = v4_2;
+    ws[5U] = v6_2;
+    ws[6U] = v5_2;
+    ws[7U] = v7_2;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec256 v0_ = ws[8U];
+    Lib_IntVector_Intrinsics_vec256 v1_ = ws[9U];
+    Lib_IntVector_Intrinsics_vec256 v2_ = ws[10U];
+    Lib_IntVector_Intrinsics_vec256 v3_ = ws[11U];
+    Lib_IntVector_Intrinsics_vec256 v4_ = ws[12U];
+    Lib_IntVector_Intrinsics_vec256 v5_ = ws[13U];
+    Lib_IntVector_Intrinsics_vec256 v6_ = ws[14U];
+    Lib_IntVector_Intrinsics_vec256 v7_ = ws[15U];
+    Lib_IntVector_Intrinsics_vec256 v0_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v1_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v2_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v3_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v4_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v4_, v5_);
+    Lib_IntVector_Intrinsics_vec256 v5_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v4_, v5_);
+    Lib_IntVector_Intrinsics_vec256 v6_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v6_, v7_);
+    Lib_IntVector_Intrinsics_vec256 v7_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v6_, v7_);
+    Lib_IntVector_Intrinsics_vec256 v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v4_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v4_0, v6_0);
+    Lib_IntVector_Intrinsics_vec256 v6_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v4_0, v6_0);
+    Lib_IntVector_Intrinsics_vec256 v5_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v5_0, v7_0);
+    Lib_IntVector_Intrinsics_vec256 v7_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v5_0, v7_0);
+    Lib_IntVector_Intrinsics_vec256 v0_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_1, v4_1);
+    Lib_IntVector_Intrinsics_vec256 v4_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_1, v4_1);
+    Lib_IntVector_Intrinsics_vec256 v1_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_1, v5_1);
+    Lib_IntVector_Intrinsics_vec256 v5_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_1, v5_1);
+    Lib_IntVector_Intrinsics_vec256 v2_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v2_1, v6_1);
+    Lib_IntVector_Intrinsics_vec256 v6_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v2_1, v6_1);
+    Lib_IntVector_Intrinsics_vec256 v3_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v3_1, v7_1);
+    Lib_IntVector_Intrinsics_vec256 v7_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v3_1, v7_1);
+    ws[8U] = v0_2;
+    ws[9U] = v2_2;
+    ws[10U] = v1_2;
+    ws[11U] = v3_2;
+    ws[12U] = v4_2;
+    ws[13U] = v6_2;
+    ws[14U] = v5_2;
+    ws[15U] = v7_2;
+  }
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)4U; i0++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      uint32_t k_t = Hacl_Impl_SHA2_Generic_k224_256[(uint32_t)16U * i0 + i];
+      Lib_IntVector_Intrinsics_vec256 ws_t = ws[i];
+      Lib_IntVector_Intrinsics_vec256 a0 = hash[0U];
+      Lib_IntVector_Intrinsics_vec256 b0 = hash[1U];
+      Lib_IntVector_Intrinsics_vec256 c0 = hash[2U];
+      Lib_IntVector_Intrinsics_vec256 d0 = hash[3U];
+      Lib_IntVector_Intrinsics_vec256 e0 = hash[4U];
+      Lib_IntVector_Intrinsics_vec256 f0 = hash[5U];
+      Lib_IntVector_Intrinsics_vec256 g0 = hash[6U];
+      Lib_IntVector_Intrinsics_vec256 h02 = hash[7U];
+      Lib_IntVector_Intrinsics_vec256 k_e_t = Lib_IntVector_Intrinsics_vec256_load32(k_t);
+      Lib_IntVector_Intrinsics_vec256
+      t1 =
+        Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(h02, Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(e0, (uint32_t)6U), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(e0, (uint32_t)11U), Lib_IntVector_Intrinsics_vec256_rotate_right32(e0, (uint32_t)25U)))), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(e0, f0), Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(e0), g0))), k_e_t), ws_t);
+      Lib_IntVector_Intrinsics_vec256
+      t2 =
+        Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(a0, (uint32_t)2U), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(a0, (uint32_t)13U), Lib_IntVector_Intrinsics_vec256_rotate_right32(a0, (uint32_t)22U))), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, b0), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, c0), Lib_IntVector_Intrinsics_vec256_and(b0, c0))));
+      Lib_IntVector_Intrinsics_vec256 a1 = Lib_IntVector_Intrinsics_vec256_add32(t1, t2);
+      Lib_IntVector_Intrinsics_vec256 b1 = a0;
+      Lib_IntVector_Intrinsics_vec256 c1 = b0;
+      Lib_IntVector_Intrinsics_vec256 d1 = c0;
+      Lib_IntVector_Intrinsics_vec256 e1 = Lib_IntVector_Intrinsics_vec256_add32(d0, t1);
+      Lib_IntVector_Intrinsics_vec256 f1 = e0;
+      Lib_IntVector_Intrinsics_vec256 g1 = f0;
+      Lib_IntVector_Intrinsics_vec256 h12 = g0;
+      hash[0U] = a1;
+      hash[1U] = b1;
+      hash[2U] = c1;
+      hash[3U] = d1;
+      hash[4U] = e1;
+      hash[5U] = f1;
+      hash[6U] = g1;
+      hash[7U] = h12;
+    }
+    if (i0 < (uint32_t)3U)
+    {
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+      {
+        Lib_IntVector_Intrinsics_vec256 t16 = ws[i];
+        Lib_IntVector_Intrinsics_vec256 t15 = ws[(i + (uint32_t)1U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256 t7 = ws[(i + (uint32_t)9U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256 t2 = ws[(i + (uint32_t)14U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256
+        s1 =
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t2, (uint32_t)17U), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t2, (uint32_t)19U), Lib_IntVector_Intrinsics_vec256_shift_right32(t2, (uint32_t)10U)));
+        Lib_IntVector_Intrinsics_vec256
+        s0 =
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t15, (uint32_t)7U), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t15, (uint32_t)18U), Lib_IntVector_Intrinsics_vec256_shift_right32(t15, (uint32_t)3U)));
+        ws[i] = Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(s1, t7), s0), t16);
+      }
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 *os = hash;
+    Lib_IntVector_Intrinsics_vec256 x = Lib_IntVector_Intrinsics_vec256_add32(hash[i], hash_old[i]);
+    os[i] = x;
+  }
+}
+
+static inline void
+sha224_update_nblocks8(uint32_t len, Hacl_Impl_SHA2_Types_uint8_8p b, Lib_IntVector_Intrinsics_vec256 *st)
+{
+  uint32_t blocks = len / (uint32_t)64U;
+  for (uint32_t i = (uint32_t)0U; i < blocks; i++)
+  {
+    uint8_t *b7 = b.snd.snd.snd.snd.snd.snd.snd;
+    uint8_t *b6 = b.snd.snd.snd.snd.snd.snd.fst;
+    uint8_t *b5 = b.snd.snd.snd.snd.snd.fst;
+    uint8_t *b4 = b.snd.snd.snd.snd.fst;
+    uint8_t *b3 = b.snd.snd.snd.fst;
+    uint8_t *b2 = b.snd.snd.fst;
+    uint8_t *b1 = b.snd.fst;
+    uint8_t *b0 = b.fst;
+    uint8_t *bl0 = b0 + i * (uint32_t)64U;
+    uint8_t *bl1 = b1 + i * (uint32_t)64U;
+    uint8_t *bl2 = b2 + i * (uint32_t)64U;
+    uint8_t *bl3 = b3 + i * (uint32_t)64U;
+    uint8_t *bl4 = b4 + i * (uint32_t)64U;
+    uint8_t *bl5 = b5 + i * (uint32_t)64U;
+    uint8_t *bl6 = b6 + i * (uint32_t)64U;
+    uint8_t *bl7 = b7 + i * (uint32_t)64U;
+    Hacl_Impl_SHA2_Types_uint8_8p mb = { .fst = bl0, .snd = { .fst = bl1, .snd = { .fst = bl2, .snd = { .fst = bl3, .snd = { .fst = bl4, .snd = { .fst = bl5, .snd = { .fst = bl6, .snd = bl7 } } } } } } };
+    sha224_update8(mb, st);
+  }
+}
+
+static inline void
+sha224_update_last8(uint64_t totlen, uint32_t len, Hacl_Impl_SHA2_Types_uint8_8p b, Lib_IntVector_Intrinsics_vec256 *hash)
+{
+  uint32_t blocks;
+  if (len + (uint32_t)8U + (uint32_t)1U <= (uint32_t)64U)
+  {
+    blocks = (uint32_t)1U;
+  }
+  else
+  {
+    blocks = (uint32_t)2U;
+  }
+  uint32_t fin = blocks * (uint32_t)64U;
+  uint8_t last[1024U] = { 0U };
+  uint8_t totlen_buf[8U] = { 0U };
+  uint64_t total_len_bits = totlen << (uint32_t)3U;
+  store64_be(totlen_buf, total_len_bits);
+  uint8_t *b7 = b.snd.snd.snd.snd.snd.snd.snd;
+  uint8_t *b6 = b.snd.snd.snd.snd.snd.snd.fst;
+  uint8_t *b5 = b.snd.snd.snd.snd.snd.fst;
+  uint8_t *b4 = b.snd.snd.snd.snd.fst;
+  uint8_t *b3 = b.snd.snd.snd.fst;
+  uint8_t *b2 = b.snd.snd.fst;
+  uint8_t *b1 = b.snd.fst;
+  uint8_t *b0 = b.fst;
+  uint8_t *last0 = last + (uint32_t)0U;
+  memcpy(last0, b0, len * sizeof (uint8_t));
+  last0[len] = (uint8_t)0x80U;
+  memcpy(last0 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last00 = last0;
+  uint8_t *last10 = last0 + (uint32_t)64U;
+  uint8_t *last1 = last + (uint32_t)128U;
+  memcpy(last1, b1, len * sizeof (uint8_t));
+  last1[len] = (uint8_t)0x80U;
+  memcpy(last1 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last01 = last1;
+  uint8_t *last11 = last1 + (uint32_t)64U;
+  uint8_t *last2 = last + (uint32_t)256U;
+  memcpy(last2, b2, len * sizeof (uint8_t));
+  last2[len] = (uint8_t)0x80U;
+  memcpy(last2 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last02 = last2;
+  uint8_t *last12 = last2 + (uint32_t)64U;
+  uint8_t *last3 = last + (uint32_t)384U;
+  memcpy(last3, b3, len * sizeof (uint8_t));
+  last3[len] = (uint8_t)0x80U;
+  memcpy(last3 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last03 = last3;
+  uint8_t *last13 = last3 + (uint32_t)64U;
+  uint8_t *last4 = last + (uint32_t)512U;
+  memcpy(last4, b4, len * sizeof (uint8_t));
+  last4[len] = (uint8_t)0x80U;
+  memcpy(last4 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last04 = last4;
+  uint8_t *last14 = last4 + (uint32_t)64U;
+  uint8_t *last5 = last + (uint32_t)640U;
+  memcpy(last5, b5, len * sizeof (uint8_t));
+  last5[len] = (uint8_t)0x80U;
+  memcpy(last5 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last05 = last5;
+  uint8_t *last15 = last5 + (uint32_t)64U;
+  uint8_t *last6 = last + (uint32_t)768U;
+  memcpy(last6, b6, len * sizeof (uint8_t));
+  last6[len] = (uint8_t)0x80U;
+  memcpy(last6 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last06 = last6;
+  uint8_t *last16 = last6 + (uint32_t)64U;
+  uint8_t *last7 = last + (uint32_t)896U;
+  memcpy(last7, b7, len * sizeof (uint8_t));
+  last7[len] = (uint8_t)0x80U;
+  memcpy(last7 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last07 = last7;
+  uint8_t *last17 = last7 + (uint32_t)64U;
+  Hacl_Impl_SHA2_Types_uint8_8p mb0 = { .fst = last00, .snd = { .fst = last01, .snd = { .fst = last02, .snd = { .fst = last03, .snd = { .fst = last04, .snd = { .fst = last05, .snd = { .fst = last06, .snd = last07 } } } } } } };
+  Hacl_Impl_SHA2_Types_uint8_8p mb1 = { .fst = last10, .snd = { .fst = last11, .snd = { .fst = last12, .snd = { .fst = last13, .snd = { .fst = last14, .snd = { .fst = last15, .snd = { .fst = last16, .snd = last17 } } } } } } };
+  sha224_update8(mb0, hash);
+  if (blocks > (uint32_t)1U)
+  {
+    sha224_update8(mb1, hash);
+  }
+}
+
+static inline void
+sha224_finish8(Lib_IntVector_Intrinsics_vec256 *st, Hacl_Impl_SHA2_Types_uint8_8p h)
+{
+  uint8_t hbuf[256U] = { 0U };
+  {
+    Lib_IntVector_Intrinsics_vec256 v0_ = st[0U];
+    Lib_IntVector_Intrinsics_vec256 v1_ = st[1U];
+    Lib_IntVector_Intrinsics_vec256 v2_ = st[2U];
+    Lib_IntVector_Intrinsics_vec256 v3_ = st[3U];
+    Lib_IntVector_Intrinsics_vec256 v4_ = st[4U];
+    Lib_IntVector_Intrinsics_vec256 v5_ = st[5U];
+    Lib_IntVector_Intrinsics_vec256 v6_ = st[6U];
+    Lib_IntVector_Intrinsics_vec256 v7_ = st[7U];
+    Lib_IntVector_Intrinsics_vec256 v0_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v1_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v2_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v3_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v4_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v4_, v5_);
+    Lib_IntVector_Intrinsics_vec256 v5_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v4_, v5_);
+    Lib_IntVector_Intrinsics_vec256 v6_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v6_, v7_);
+    Lib_IntVector_Intrinsics_vec256 v7_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v6_, v7_);
+    Lib_IntVector_Intrinsics_vec256 v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v4_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v4_0, v6_0);
+    Lib_IntVector_Intrinsics_vec256 v6_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v4_0, v6_0);
+    Lib_IntVector_Intrinsics_vec256 v5_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v5_0, v7_0);
+    Lib_IntVector_Intrinsics_vec256 v7_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v5_0, v7_0);
+    Lib_IntVector_Intrinsics_vec256 v0_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_1, v4_1);
+    Lib_IntVector_Intrinsics_vec256 v4_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_1, v4_1);
+    Lib_IntVector_Intrinsics_vec256 v1_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_1, v5_1);
+    Lib_IntVector_Intrinsics_vec256 v5_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_1, v5_1);
+    Lib_IntVector_Intrinsics_vec256 v2_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v2_1, v6_1);
+    Lib_IntVector_Intrinsics_vec256 v6_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v2_1, v6_1);
+    Lib_IntVector_Intrinsics_vec256 v3_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v3_1, v7_1);
+    Lib_IntVector_Intrinsics_vec256 v7_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v3_1, v7_1);
+    st[0U] = v0_2;
+    st[1U] = v2_2;
+    st[2U] = v1_2;
+    st[3U] = v3_2;
+    st[4U] = v4_2;
+    st[5U] = v6_2;
+    st[6U] = v5_2;
+    st[7U] = v7_2;
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256_store32_be(hbuf + i * (uint32_t)32U, st[i]);
+  }
+  uint8_t *b7 = h.snd.snd.snd.snd.snd.snd.snd;
+  uint8_t *b6 = h.snd.snd.snd.snd.snd.snd.fst;
+  uint8_t *b5 = h.snd.snd.snd.snd.snd.fst;
+  uint8_t *b4 = h.snd.snd.snd.snd.fst;
+  uint8_t *b3 = h.snd.snd.snd.fst;
+  uint8_t *b2 = h.snd.snd.fst;
+  uint8_t *b1 = h.snd.fst;
+  uint8_t *b0 = h.fst;
+  memcpy(b0, hbuf, (uint32_t)28U * sizeof (uint8_t));
+  memcpy(b1, hbuf + (uint32_t)32U, (uint32_t)28U * sizeof (uint8_t));
+  memcpy(b2, hbuf + (uint32_t)64U, (uint32_t)28U * sizeof (uint8_t));
+  memcpy(b3, hbuf + (uint32_t)96U, (uint32_t)28U * sizeof (uint8_t));
+  memcpy(b4, hbuf + (uint32_t)128U, (uint32_t)28U * sizeof (uint8_t));
+  memcpy(b5, hbuf + (uint32_t)160U, (uint32_t)28U * sizeof (uint8_t));
+  memcpy(b6, hbuf + (uint32_t)192U, (uint32_t)28U * sizeof (uint8_t));
+  memcpy(b7, hbuf + (uint32_t)224U, (uint32_t)28U * sizeof (uint8_t));
+}
+
+void
+Hacl_SHA2_Vec256_sha224_8(
+  uint8_t *dst0,
+  uint8_t *dst1,
+  uint8_t *dst2,
+  uint8_t *dst3,
+  uint8_t *dst4,
+  uint8_t *dst5,
+  uint8_t *dst6,
+  uint8_t *dst7,
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t *input4,
+  uint8_t *input5,
+  uint8_t *input6,
+  uint8_t *input7
+)
+{
+  Hacl_Impl_SHA2_Types_uint8_8p ib = { .fst = input0, .snd = { .fst = input1, .snd = { .fst = input2, .snd = { .fst = input3, .snd = { .fst = input4, .snd = { .fst = input5, .snd = { .fst = input6, .snd = input7 } } } } } } };
+  Hacl_Impl_SHA2_Types_uint8_8p rb = { .fst = dst0, .snd = { .fst = dst1, .snd = { .fst = dst2, .snd = { .fst = dst3, .snd = { .fst = dst4, .snd = { .fst = dst5, .snd = { .fst = dst6, .snd = dst7 } } } } } } };
+  Lib_IntVector_Intrinsics_vec256 st[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    st[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  sha224_init8(st);
+  uint32_t rem = input_len % (uint32_t)64U;
+  uint64_t len_ = (uint64_t)input_len;
+  sha224_update_nblocks8(input_len, ib, st);
+  uint32_t rem1 = input_len % (uint32_t)64U;
+  uint8_t *b7 = ib.snd.snd.snd.snd.snd.snd.snd;
+  uint8_t *b6 = ib.snd.snd.snd.snd.snd.snd.fst;
+  uint8_t *b5 = ib.snd.snd.snd.snd.snd.fst;
+  uint8_t *b4 = ib.snd.snd.snd.snd.fst;
+  uint8_t *b3 = ib.snd.snd.snd.fst;
+  uint8_t *b2 = ib.snd.snd.fst;
+  uint8_t *b1 = ib.snd.fst;
+  uint8_t *b0 = ib.fst;
+  uint8_t *bl0 = b0 + input_len - rem1;
+  uint8_t *bl1 = b1 + input_len - rem1;
+  uint8_t *bl2 = b2 + input_len - rem1;
+  uint8_t *bl3 = b3 + input_len - rem1;
+  uint8_t *bl4 = b4 + input_len - rem1;
+  uint8_t *bl5 = b5 + input_len - rem1;
+  uint8_t *bl6 = b6 + input_len - rem1;
+  uint8_t *bl7 = b7 + input_len - rem1;
+  Hacl_Impl_SHA2_Types_uint8_8p lb = { .fst = bl0, .snd = { .fst = bl1, .snd = { .fst = bl2, .snd = { .fst = bl3, .snd = { .fst = bl4, .snd = { .fst = bl5, .snd = { .fst = bl6, .snd = bl7 } } } } } } };
+  sha224_update_last8(len_, rem, lb, st);
+  sha224_finish8(st, rb);
+}
+
+static inline void sha256_init8(Lib_IntVector_Intrinsics_vec256 *hash)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 *os = hash;
+    uint32_t hi = Hacl_Impl_SHA2_Generic_h256[i];
+    Lib_IntVector_Intrinsics_vec256 x = Lib_IntVector_Intrinsics_vec256_load32(hi);
+    os[i] = x;
+  }
+}
+
+static inline void
+sha256_update8(Hacl_Impl_SHA2_Types_uint8_8p block, Lib_IntVector_Intrinsics_vec256 *hash)
+{
+  Lib_IntVector_Intrinsics_vec256 hash_old[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    hash_old[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  Lib_IntVector_Intrinsics_vec256 ws[16U];
+  for (uint32_t _i = 0U; _i < (uint32_t)16U; ++_i)
+    ws[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  memcpy(hash_old, hash, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  uint8_t *b7 = block.snd.snd.snd.snd.snd.snd.snd;
+  uint8_t *b6 = block.snd.snd.snd.snd.snd.snd.fst;
+  uint8_t *b5 = block.snd.snd.snd.snd.snd.fst;
+  uint8_t *b4 = block.snd.snd.snd.snd.fst;
+  uint8_t *b3 = block.snd.snd.snd.fst;
+  uint8_t *b2 = block.snd.snd.fst;
+  uint8_t *b1 = block.snd.fst;
+  uint8_t *b0 = block.fst;
+  ws[0U] = Lib_IntVector_Intrinsics_vec256_load32_be(b0);
+  ws[1U] = Lib_IntVector_Intrinsics_vec256_load32_be(b1);
+  ws[2U] = Lib_IntVector_Intrinsics_vec256_load32_be(b2);
+  ws[3U] = Lib_IntVector_Intrinsics_vec256_load32_be(b3);
+  ws[4U] = Lib_IntVector_Intrinsics_vec256_load32_be(b4);
+  ws[5U] = Lib_IntVector_Intrinsics_vec256_load32_be(b5);
+  ws[6U] = Lib_IntVector_Intrinsics_vec256_load32_be(b6);
+  ws[7U] = Lib_IntVector_Intrinsics_vec256_load32_be(b7);
+  ws[8U] = Lib_IntVector_Intrinsics_vec256_load32_be(b0 + (uint32_t)32U);
+  ws[9U] = Lib_IntVector_Intrinsics_vec256_load32_be(b1 + (uint32_t)32U);
+  ws[10U] = Lib_IntVector_Intrinsics_vec256_load32_be(b2 + (uint32_t)32U);
+  ws[11U] = Lib_IntVector_Intrinsics_vec256_load32_be(b3 + (uint32_t)32U);
+  ws[12U] = Lib_IntVector_Intrinsics_vec256_load32_be(b4 + (uint32_t)32U);
+  ws[13U] = Lib_IntVector_Intrinsics_vec256_load32_be(b5 + (uint32_t)32U);
+  ws[14U] = Lib_IntVector_Intrinsics_vec256_load32_be(b6 + (uint32_t)32U);
+  ws[15U] = Lib_IntVector_Intrinsics_vec256_load32_be(b7 + (uint32_t)32U);
+  {
+    Lib_IntVector_Intrinsics_vec256 v0_ = ws[0U];
+    Lib_IntVector_Intrinsics_vec256 v1_ = ws[1U];
+    Lib_IntVector_Intrinsics_vec256 v2_ = ws[2U];
+    Lib_IntVector_Intrinsics_vec256 v3_ = ws[3U];
+    Lib_IntVector_Intrinsics_vec256 v4_ = ws[4U];
+    Lib_IntVector_Intrinsics_vec256 v5_ = ws[5U];
+    Lib_IntVector_Intrinsics_vec256 v6_ = ws[6U];
+    Lib_IntVector_Intrinsics_vec256 v7_ = ws[7U];
+    Lib_IntVector_Intrinsics_vec256 v0_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v1_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v2_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v3_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v4_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v4_, v5_);
+    Lib_IntVector_Intrinsics_vec256 v5_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v4_, v5_);
+    Lib_IntVector_Intrinsics_vec256 v6_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v6_, v7_);
+    Lib_IntVector_Intrinsics_vec256 v7_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v6_, v7_);
+    Lib_IntVector_Intrinsics_vec256 v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v4_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v4_0, v6_0);
+    Lib_IntVector_Intrinsics_vec256 v6_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v4_0, v6_0);
+    Lib_IntVector_Intrinsics_vec256 v5_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v5_0, v7_0);
+    Lib_IntVector_Intrinsics_vec256 v7_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v5_0, v7_0);
+    Lib_IntVector_Intrinsics_vec256 v0_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_1, v4_1);
+    Lib_IntVector_Intrinsics_vec256 v4_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_1, v4_1);
+    Lib_IntVector_Intrinsics_vec256 v1_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_1, v5_1);
+    Lib_IntVector_Intrinsics_vec256 v5_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_1, v5_1);
+    Lib_IntVector_Intrinsics_vec256 v2_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v2_1, v6_1);
+    Lib_IntVector_Intrinsics_vec256 v6_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v2_1, v6_1);
+    Lib_IntVector_Intrinsics_vec256 v3_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v3_1, v7_1);
+    Lib_IntVector_Intrinsics_vec256 v7_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v3_1, v7_1);
+    ws[0U] = v0_2;
+    ws[1U] = v2_2;
+    ws[2U] = v1_2;
+    ws[3U] = v3_2;
+    ws[4U] = v4_2;
+    ws[5U] = v6_2;
+    ws[6U] = v5_2;
+    ws[7U] = v7_2;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec256 v0_ = ws[8U];
+    Lib_IntVector_Intrinsics_vec256 v1_ = ws[9U];
+    Lib_IntVector_Intrinsics_vec256 v2_ = ws[10U];
+    Lib_IntVector_Intrinsics_vec256 v3_ = ws[11U];
+    Lib_IntVector_Intrinsics_vec256 v4_ = ws[12U];
+    Lib_IntVector_Intrinsics_vec256 v5_ = ws[13U];
+    Lib_IntVector_Intrinsics_vec256 v6_ = ws[14U];
+    Lib_IntVector_Intrinsics_vec256 v7_ = ws[15U];
+    Lib_IntVector_Intrinsics_vec256 v0_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v1_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v2_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v3_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v4_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v4_, v5_);
+    Lib_IntVector_Intrinsics_vec256 v5_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v4_, v5_);
+    Lib_IntVector_Intrinsics_vec256 v6_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v6_, v7_);
+    Lib_IntVector_Intrinsics_vec256 v7_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v6_, v7_);
+    Lib_IntVector_Intrinsics_vec256 v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v4_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v4_0, v6_0);
+    Lib_IntVector_Intrinsics_vec256 v6_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v4_0, v6_0);
+    Lib_IntVector_Intrinsics_vec256 v5_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v5_0, v7_0);
+    Lib_IntVector_Intrinsics_vec256 v7_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v5_0, v7_0);
+    Lib_IntVector_Intrinsics_vec256 v0_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_1, v4_1);
+    Lib_IntVector_Intrinsics_vec256 v4_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_1, v4_1);
+    Lib_IntVector_Intrinsics_vec256 v1_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_1, v5_1);
+    Lib_IntVector_Intrinsics_vec256 v5_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_1, v5_1);
+    Lib_IntVector_Intrinsics_vec256 v2_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v2_1, v6_1);
+    Lib_IntVector_Intrinsics_vec256 v6_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v2_1, v6_1);
+    Lib_IntVector_Intrinsics_vec256 v3_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v3_1, v7_1);
+    Lib_IntVector_Intrinsics_vec256 v7_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v3_1, v7_1);
+    ws[8U] = v0_2;
+    ws[9U] = v2_2;
+    ws[10U] = v1_2;
+    ws[11U] = v3_2;
+    ws[12U] = v4_2;
+    ws[13U] = v6_2;
+    ws[14U] = v5_2;
+    ws[15U] = v7_2;
+  }
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)4U; i0++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      uint32_t k_t = Hacl_Impl_SHA2_Generic_k224_256[(uint32_t)16U * i0 + i];
+      Lib_IntVector_Intrinsics_vec256 ws_t = ws[i];
+      Lib_IntVector_Intrinsics_vec256 a0 = hash[0U];
+      Lib_IntVector_Intrinsics_vec256 b0 = hash[1U];
+      Lib_IntVector_Intrinsics_vec256 c0 = hash[2U];
+      Lib_IntVector_Intrinsics_vec256 d0 = hash[3U];
+      Lib_IntVector_Intrinsics_vec256 e0 = hash[4U];
+      Lib_IntVector_Intrinsics_vec256 f0 = hash[5U];
+      Lib_IntVector_Intrinsics_vec256 g0 = hash[6U];
+      Lib_IntVector_Intrinsics_vec256 h02 = hash[7U];
+      Lib_IntVector_Intrinsics_vec256 k_e_t = Lib_IntVector_Intrinsics_vec256_load32(k_t);
+      Lib_IntVector_Intrinsics_vec256
+      t1 =
+        Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(h02, Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(e0, (uint32_t)6U), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(e0, (uint32_t)11U), Lib_IntVector_Intrinsics_vec256_rotate_right32(e0, (uint32_t)25U)))), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(e0, f0), Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(e0), g0))), k_e_t), ws_t);
+      Lib_IntVector_Intrinsics_vec256
+      t2 =
+        Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(a0, (uint32_t)2U), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(a0, (uint32_t)13U), Lib_IntVector_Intrinsics_vec256_rotate_right32(a0, (uint32_t)22U))), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, b0), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, c0), Lib_IntVector_Intrinsics_vec256_and(b0, c0))));
+      Lib_IntVector_Intrinsics_vec256 a1 = Lib_IntVector_Intrinsics_vec256_add32(t1, t2);
+      Lib_IntVector_Intrinsics_vec256 b1 = a0;
+      Lib_IntVector_Intrinsics_vec256 c1 = b0;
+      Lib_IntVector_Intrinsics_vec256 d1 = c0;
+      Lib_IntVector_Intrinsics_vec256 e1 = Lib_IntVector_Intrinsics_vec256_add32(d0, t1);
+      Lib_IntVector_Intrinsics_vec256 f1 = e0;
+      Lib_IntVector_Intrinsics_vec256 g1 = f0;
+      Lib_IntVector_Intrinsics_vec256 h12 = g0;
+      hash[0U] = a1;
+      hash[1U] = b1;
+      hash[2U] = c1;
+      hash[3U] = d1;
+      hash[4U] = e1;
+      hash[5U] = f1;
+      hash[6U] = g1;
+      hash[7U] = h12;
+    }
+    if (i0 < (uint32_t)3U)
+    {
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+      {
+        Lib_IntVector_Intrinsics_vec256 t16 = ws[i];
+        Lib_IntVector_Intrinsics_vec256 t15 = ws[(i + (uint32_t)1U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256 t7 = ws[(i + (uint32_t)9U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256 t2 = ws[(i + (uint32_t)14U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256
+        s1 =
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t2, (uint32_t)17U), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t2, (uint32_t)19U), Lib_IntVector_Intrinsics_vec256_shift_right32(t2, (uint32_t)10U)));
+        Lib_IntVector_Intrinsics_vec256
+        s0 =
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t15, (uint32_t)7U), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t15, (uint32_t)18U), Lib_IntVector_Intrinsics_vec256_shift_right32(t15, (uint32_t)3U)));
+        ws[i] = Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(s1, t7), s0), t16);
+      }
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 *os = hash;
+    Lib_IntVector_Intrinsics_vec256 x = Lib_IntVector_Intrinsics_vec256_add32(hash[i], hash_old[i]);
+    os[i] = x;
+  }
+}
+
+static inline void
+sha256_update_nblocks8(uint32_t len, Hacl_Impl_SHA2_Types_uint8_8p b, Lib_IntVector_Intrinsics_vec256 *st)
+{
+  uint32_t blocks = len / (uint32_t)64U;
+  for (uint32_t i = (uint32_t)0U; i < blocks; i++)
+  {
+    uint8_t *b7 = b.snd.snd.snd.snd.snd.snd.snd;
+    uint8_t *b6 = b.snd.snd.snd.snd.snd.snd.fst;
+    uint8_t *b5 = b.snd.snd.snd.snd.snd.fst;
+    uint8_t *b4 = b.snd.snd.snd.snd.fst;
+    uint8_t *b3 = b.snd.snd.snd.fst;
+    uint8_t *b2 = b.snd.snd.fst;
+    uint8_t *b1 = b.snd.fst;
+    uint8_t *b0 = b.fst;
+    uint8_t *bl0 = b0 + i * (uint32_t)64U;
+    uint8_t *bl1 = b1 + i * (uint32_t)64U;
+    uint8_t *bl2 = b2 + i * (uint32_t)64U;
+    uint8_t *bl3 = b3 + i * (uint32_t)64U;
+    uint8_t *bl4 = b4 + i * (uint32_t)64U;
+    uint8_t *bl5 = b5 + i * (uint32_t)64U;
+    uint8_t *bl6 = b6 + i * (uint32_t)64U;
+    uint8_t *bl7 = b7 + i * (uint32_t)64U;
+    Hacl_Impl_SHA2_Types_uint8_8p mb = { .fst = bl0, .snd = { .fst = bl1, .snd = { .fst = bl2, .snd = { .fst = bl3, .snd = { .fst = bl4, .snd = { .fst = bl5, .snd = { .fst = bl6, .snd = bl7 } } } } } } };
+    sha256_update8(mb, st);
+  }
+}
+
+static inline void
+sha256_update_last8(uint64_t totlen, uint32_t len, Hacl_Impl_SHA2_Types_uint8_8p b, Lib_IntVector_Intrinsics_vec256 *hash)
+{
+  uint32_t blocks;
+  if (len + (uint32_t)8U + (uint32_t)1U <= (uint32_t)64U)
+  {
+    blocks = (uint32_t)1U;
+  }
+  else
+  {
+    blocks = (uint32_t)2U;
+  }
+  uint32_t fin = blocks * (uint32_t)64U;
+  uint8_t last[1024U] = { 0U };
+  uint8_t totlen_buf[8U] = { 0U };
+  uint64_t total_len_bits = totlen << (uint32_t)3U;
+  store64_be(totlen_buf, total_len_bits);
+  uint8_t *b7 = b.snd.snd.snd.snd.snd.snd.snd;
+  uint8_t *b6 = b.snd.snd.snd.snd.snd.snd.fst;
+  uint8_t *b5 = b.snd.snd.snd.snd.snd.fst;
+  uint8_t *b4 = b.snd.snd.snd.snd.fst;
+  uint8_t *b3 = b.snd.snd.snd.fst;
+  uint8_t *b2 = b.snd.snd.fst;
+  uint8_t *b1 = b.snd.fst;
+  uint8_t *b0 = b.fst;
+  uint8_t *last0 = last + (uint32_t)0U;
+  memcpy(last0, b0, len * sizeof (uint8_t));
+  last0[len] = (uint8_t)0x80U;
+  memcpy(last0 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last00 = last0;
+  uint8_t *last10 = last0 + (uint32_t)64U;
+  uint8_t *last1 = last + (uint32_t)128U;
+  memcpy(last1, b1, len * sizeof (uint8_t));
+  last1[len] = (uint8_t)0x80U;
+  memcpy(last1 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last01 = last1;
+  uint8_t *last11 = last1 + (uint32_t)64U;
+  uint8_t *last2 = last + (uint32_t)256U;
+  memcpy(last2, b2, len * sizeof (uint8_t));
+  last2[len] = (uint8_t)0x80U;
+  memcpy(last2 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last02 = last2;
+  uint8_t *last12 = last2 + (uint32_t)64U;
+  uint8_t *last3 = last + (uint32_t)384U;
+  memcpy(last3, b3, len * sizeof (uint8_t));
+  last3[len] = (uint8_t)0x80U;
+  memcpy(last3 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last03 = last3;
+  uint8_t *last13 = last3 + (uint32_t)64U;
+  uint8_t *last4 = last + (uint32_t)512U;
+  memcpy(last4, b4, len * sizeof (uint8_t));
+  last4[len] = (uint8_t)0x80U;
+  memcpy(last4 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last04 = last4;
+  uint8_t *last14 = last4 + (uint32_t)64U;
+  uint8_t *last5 = last + (uint32_t)640U;
+  memcpy(last5, b5, len * sizeof (uint8_t));
+  last5[len] = (uint8_t)0x80U;
+  memcpy(last5 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last05 = last5;
+  uint8_t *last15 = last5 + (uint32_t)64U;
+  uint8_t *last6 = last + (uint32_t)768U;
+  memcpy(last6, b6, len * sizeof (uint8_t));
+  last6[len] = (uint8_t)0x80U;
+  memcpy(last6 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last06 = last6;
+  uint8_t *last16 = last6 + (uint32_t)64U;
+  uint8_t *last7 = last + (uint32_t)896U;
+  memcpy(last7, b7, len * sizeof (uint8_t));
+  last7[len] = (uint8_t)0x80U;
+  memcpy(last7 + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+  uint8_t *last07 = last7;
+  uint8_t *last17 = last7 + (uint32_t)64U;
+  Hacl_Impl_SHA2_Types_uint8_8p mb0 = { .fst = last00, .snd = { .fst = last01, .snd = { .fst = last02, .snd = { .fst = last03, .snd = { .fst = last04, .snd = { .fst = last05, .snd = { .fst = last06, .snd = last07 } } } } } } };
+  Hacl_Impl_SHA2_Types_uint8_8p mb1 = { .fst = last10, .snd = { .fst = last11, .snd = { .fst = last12, .snd = { .fst = last13, .snd = { .fst = last14, .snd = { .fst = last15, .snd = { .fst = last16, .snd = last17 } } } } } } };
+  sha256_update8(mb0, hash);
+  if (blocks > (uint32_t)1U)
+  {
+    sha256_update8(mb1, hash);
+  }
+}
+
+static inline void
+sha256_finish8(Lib_IntVector_Intrinsics_vec256 *st, Hacl_Impl_SHA2_Types_uint8_8p h)
+{
+  uint8_t hbuf[256U] = { 0U };
+  {
+    Lib_IntVector_Intrinsics_vec256 v0_ = st[0U];
+    Lib_IntVector_Intrinsics_vec256 v1_ = st[1U];
+    Lib_IntVector_Intrinsics_vec256 v2_ = st[2U];
+    Lib_IntVector_Intrinsics_vec256 v3_ = st[3U];
+    Lib_IntVector_Intrinsics_vec256 v4_ = st[4U];
+    Lib_IntVector_Intrinsics_vec256 v5_ = st[5U];
+    Lib_IntVector_Intrinsics_vec256 v6_ = st[6U];
+    Lib_IntVector_Intrinsics_vec256 v7_ = st[7U];
+    Lib_IntVector_Intrinsics_vec256 v0_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v1_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v2_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v3_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v4_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v4_, v5_);
+    Lib_IntVector_Intrinsics_vec256 v5_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v4_, v5_);
+    Lib_IntVector_Intrinsics_vec256 v6_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v6_, v7_);
+    Lib_IntVector_Intrinsics_vec256 v7_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v6_, v7_);
+    Lib_IntVector_Intrinsics_vec256 v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v4_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v4_0, v6_0);
+    Lib_IntVector_Intrinsics_vec256 v6_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v4_0, v6_0);
+    Lib_IntVector_Intrinsics_vec256 v5_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v5_0, v7_0);
+    Lib_IntVector_Intrinsics_vec256 v7_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v5_0, v7_0);
+    Lib_IntVector_Intrinsics_vec256 v0_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_1, v4_1);
+    Lib_IntVector_Intrinsics_vec256 v4_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_1, v4_1);
+    Lib_IntVector_Intrinsics_vec256 v1_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_1, v5_1);
+    Lib_IntVector_Intrinsics_vec256 v5_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_1, v5_1);
+    Lib_IntVector_Intrinsics_vec256 v2_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v2_1, v6_1);
+    Lib_IntVector_Intrinsics_vec256 v6_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v2_1, v6_1);
+    Lib_IntVector_Intrinsics_vec256 v3_2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v3_1, v7_1);
+    Lib_IntVector_Intrinsics_vec256 v7_2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v3_1, v7_1);
+    st[0U] = v0_2;
+    st[1U] = v2_2;
+    st[2U] = v1_2;
+    st[3U] = v3_2;
+    st[4U] = v4_2;
+    st[5U] = v6_2;
+    st[6U] = v5_2;
+    st[7U] = v7_2;
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256_store32_be(hbuf + i * (uint32_t)32U, st[i]);
+  }
+  uint8_t *b7 = h.snd.snd.snd.snd.snd.snd.snd;
+  uint8_t *b6 = h.snd.snd.snd.snd.snd.snd.fst;
+  uint8_t *b5 = h.snd.snd.snd.snd.snd.fst;
+  uint8_t *b4 = h.snd.snd.snd.snd.fst;
+  uint8_t *b3 = h.snd.snd.snd.fst;
+  uint8_t *b2 = h.snd.snd.fst;
+  uint8_t *b1 = h.snd.fst;
+  uint8_t *b0 = h.fst;
+  memcpy(b0, hbuf, (uint32_t)32U * sizeof (uint8_t));
+  memcpy(b1, hbuf + (uint32_t)32U, (uint32_t)32U * sizeof (uint8_t));
+  memcpy(b2, hbuf + (uint32_t)64U, (uint32_t)32U * sizeof (uint8_t));
+  memcpy(b3, hbuf + (uint32_t)96U, (uint32_t)32U * sizeof (uint8_t));
+  memcpy(b4, hbuf + (uint32_t)128U, (uint32_t)32U * sizeof (uint8_t));
+  memcpy(b5, hbuf + (uint32_t)160U, (uint32_t)32U * sizeof (uint8_t));
+  memcpy(b6, hbuf + (uint32_t)192U, (uint32_t)32U * sizeof (uint8_t));
+  memcpy(b7, hbuf + (uint32_t)224U, (uint32_t)32U * sizeof (uint8_t));
+}
+
+void
+Hacl_SHA2_Vec256_sha256_8(
+  uint8_t *dst0,
+  uint8_t *dst1,
+  uint8_t *dst2,
+  uint8_t *dst3,
+  uint8_t *dst4,
+  uint8_t *dst5,
+  uint8_t *dst6,
+  uint8_t *dst7,
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t *input4,
+  uint8_t *input5,
+  uint8_t *input6,
+  uint8_t *input7
+)
+{
+  Hacl_Impl_SHA2_Types_uint8_8p ib = { .fst = input0, .snd = { .fst = input1, .snd = { .fst = input2, .snd = { .fst = input3, .snd = { .fst = input4, .snd = { .fst = input5, .snd = { .fst = input6, .snd = input7 } } } } } } };
+  Hacl_Impl_SHA2_Types_uint8_8p rb = { .fst = dst0, .snd = { .fst = dst1, .snd = { .fst = dst2, .snd = { .fst = dst3, .snd = { .fst = dst4, .snd = { .fst = dst5, .snd = { .fst = dst6, .snd = dst7 } } } } } } };
+  Lib_IntVector_Intrinsics_vec256 st[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    st[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  sha256_init8(st);
+  uint32_t rem = input_len % (uint32_t)64U;
+  uint64_t len_ = (uint64_t)input_len;
+  sha256_update_nblocks8(input_len, ib, st);
+  uint32_t rem1 = input_len % (uint32_t)64U;
+  uint8_t *b7 = ib.snd.snd.snd.snd.snd.snd.snd;
+  uint8_t *b6 = ib.snd.snd.snd.snd.snd.snd.fst;
+  uint8_t *b5 = ib.snd.snd.snd.snd.snd.fst;
+  uint8_t *b4 = ib.snd.snd.snd.snd.fst;
+  uint8_t *b3 = ib.snd.snd.snd.fst;
+  uint8_t *b2 = ib.snd.snd.fst;
+  uint8_t *b1 = ib.snd.fst;
+  uint8_t *b0 = ib.fst;
+  uint8_t *bl0 = b0 + input_len - rem1;
+  uint8_t *bl1 = b1 + input_len - rem1;
+  uint8_t *bl2 = b2 + input_len - rem1;
+  uint8_t *bl3 = b3 + input_len - rem1;
+  uint8_t *bl4 = b4 + input_len - rem1;
+  uint8_t *bl5 = b5 + input_len - rem1;
+  uint8_t *bl6 = b6 + input_len - rem1;
+  uint8_t *bl7 = b7 + input_len - rem1;
+  Hacl_Impl_SHA2_Types_uint8_8p lb = { .fst = bl0, .snd = { .fst = bl1, .snd = { .fst = bl2, .snd = { .fst = bl3, .snd = { .fst = bl4, .snd = { .fst = bl5, .snd = { .fst = bl6, .snd = bl7 } } } } } } };
+  sha256_update_last8(len_, rem, lb, st);
+  sha256_finish8(st, rb);
+}
+
+static inline void sha384_init4(Lib_IntVector_Intrinsics_vec256 *hash)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 *os = hash;
+    uint64_t hi = Hacl_Impl_SHA2_Generic_h384[i];
+    Lib_IntVector_Intrinsics_vec256 x = Lib_IntVector_Intrinsics_vec256_load64(hi);
+    os[i] = x;
+  }
+}
+
+static inline void
+sha384_update4(Hacl_Impl_SHA2_Types_uint8_4p block, Lib_IntVector_Intrinsics_vec256 *hash)
+{
+  Lib_IntVector_Intrinsics_vec256 hash_old[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    hash_old[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  Lib_IntVector_Intrinsics_vec256 ws[16U];
+  for (uint32_t _i = 0U; _i < (uint32_t)16U; ++_i)
+    ws[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  memcpy(hash_old, hash, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  uint8_t *b3 = block.snd.snd.snd;
+  uint8_t *b2 = block.snd.snd.fst;
+  uint8_t *b1 = block.snd.fst;
+  uint8_t *b0 = block.fst;
+  ws[0U] = Lib_IntVector_Intrinsics_vec256_load64_be(b0);
+  ws[1U] = Lib_IntVector_Intrinsics_vec256_load64_be(b1);
+  ws[2U] = Lib_IntVector_Intrinsics_vec256_load64_be(b2);
+  ws[3U] = Lib_IntVector_Intrinsics_vec256_load64_be(b3);
+  ws[4U] = Lib_IntVector_Intrinsics_vec256_load64_be(b0 + (uint32_t)32U);
+  ws[5U] = Lib_IntVector_Intrinsics_vec256_load64_be(b1 + (uint32_t)32U);
+  ws[6U] = Lib_IntVector_Intrinsics_vec256_load64_be(b2 + (uint32_t)32U);
+  ws[7U] = Lib_IntVector_Intrinsics_vec256_load64_be(b3 + (uint32_t)32U);
+  ws[8U] = Lib_IntVector_Intrinsics_vec256_load64_be(b0 + (uint32_t)64U);
+  ws[9U] = Lib_IntVector_Intrinsics_vec256_load64_be(b1 + (uint32_t)64U);
+  ws[10U] = Lib_IntVector_Intrinsics_vec256_load64_be(b2 + (uint32_t)64U);
+  ws[11U] = Lib_IntVector_Intrinsics_vec256_load64_be(b3 + (uint32_t)64U);
+  ws[12U] = Lib_IntVector_Intrinsics_vec256_load64_be(b0 + (uint32_t)96U);
+  ws[13U] = Lib_IntVector_Intrinsics_vec256_load64_be(b1 + (uint32_t)96U);
+  ws[14U] = Lib_IntVector_Intrinsics_vec256_load64_be(b2 + (uint32_t)96U);
+  ws[15U] = Lib_IntVector_Intrinsics_vec256_load64_be(b3 + (uint32_t)96U);
+  {
+    Lib_IntVector_Intrinsics_vec256 v0_ = ws[0U];
+    Lib_IntVector_Intrinsics_vec256 v1_ = ws[1U];
+    Lib_IntVector_Intrinsics_vec256 v2_ = ws[2U];
+    Lib_IntVector_Intrinsics_vec256 v3_ = ws[3U];
+    Lib_IntVector_Intrinsics_vec256 v0_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v1_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v2_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v3_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_0, v3_0);
+    ws[0U] = v0_1;
+    ws[1U] = v2_1;
+    ws[2U] = v1_1;
+    ws[3U] = v3_1;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec256 v0_ = ws[4U];
+    Lib_IntVector_Intrinsics_vec256 v1_ = ws[5U];
+    Lib_IntVector_Intrinsics_vec256 v2_ = ws[6U];
+    Lib_IntVector_Intrinsics_vec256 v3_ = ws[7U];
+    Lib_IntVector_Intrinsics_vec256 v0_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v1_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v2_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v3_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_0, v3_0);
+    ws[4U] = v0_1;
+    ws[5U] = v2_1;
+    ws[6U] = v1_1;
+    ws[7U] = v3_1;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec256 v0_ = ws[8U];
+    Lib_IntVector_Intrinsics_vec256 v1_ = ws[9U];
+    Lib_IntVector_Intrinsics_vec256 v2_ = ws[10U];
+    Lib_IntVector_Intrinsics_vec256 v3_ = ws[11U];
+    Lib_IntVector_Intrinsics_vec256 v0_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v1_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v2_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v3_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_0, v3_0);
+    ws[8U] = v0_1;
+    ws[9U] = v2_1;
+    ws[10U] = v1_1;
+    ws[11U] = v3_1;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec256 v0_ = ws[12U];
+    Lib_IntVector_Intrinsics_vec256 v1_ = ws[13U];
+    Lib_IntVector_Intrinsics_vec256 v2_ = ws[14U];
+    Lib_IntVector_Intrinsics_vec256 v3_ = ws[15U];
+    Lib_IntVector_Intrinsics_vec256 v0_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v1_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v2_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v3_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_0, v3_0);
+    ws[12U] = v0_1;
+    ws[13U] = v2_1;
+    ws[14U] = v1_1;
+    ws[15U] = v3_1;
+  }
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)5U; i0++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      uint64_t k_t = Hacl_Impl_SHA2_Generic_k384_512[(uint32_t)16U * i0 + i];
+      Lib_IntVector_Intrinsics_vec256 ws_t = ws[i];
+      Lib_IntVector_Intrinsics_vec256 a0 = hash[0U];
+      Lib_IntVector_Intrinsics_vec256 b0 = hash[1U];
+      Lib_IntVector_Intrinsics_vec256 c0 = hash[2U];
+      Lib_IntVector_Intrinsics_vec256 d0 = hash[3U];
+      Lib_IntVector_Intrinsics_vec256 e0 = hash[4U];
+      Lib_IntVector_Intrinsics_vec256 f0 = hash[5U];
+      Lib_IntVector_Intrinsics_vec256 g0 = hash[6U];
+      Lib_IntVector_Intrinsics_vec256 h02 = hash[7U];
+      Lib_IntVector_Intrinsics_vec256 k_e_t = Lib_IntVector_Intrinsics_vec256_load64(k_t);
+      Lib_IntVector_Intrinsics_vec256
+      t1 =
+        Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(h02, Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(e0, (uint32_t)14U), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(e0, (uint32_t)18U), Lib_IntVector_Intrinsics_vec256_rotate_right64(e0, (uint32_t)41U)))), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(e0, f0), Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(e0), g0))), k_e_t), ws_t);
+      Lib_IntVector_Intrinsics_vec256
+      t2 =
+        Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(a0, (uint32_t)28U), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(a0, (uint32_t)34U), Lib_IntVector_Intrinsics_vec256_rotate_right64(a0, (uint32_t)39U))), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, b0), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, c0), Lib_IntVector_Intrinsics_vec256_and(b0, c0))));
+      Lib_IntVector_Intrinsics_vec256 a1 = Lib_IntVector_Intrinsics_vec256_add64(t1, t2);
+      Lib_IntVector_Intrinsics_vec256 b1 = a0;
+      Lib_IntVector_Intrinsics_vec256 c1 = b0;
+      Lib_IntVector_Intrinsics_vec256 d1 = c0;
+      Lib_IntVector_Intrinsics_vec256 e1 = Lib_IntVector_Intrinsics_vec256_add64(d0, t1);
+      Lib_IntVector_Intrinsics_vec256 f1 = e0;
+      Lib_IntVector_Intrinsics_vec256 g1 = f0;
+      Lib_IntVector_Intrinsics_vec256 h12 = g0;
+      hash[0U] = a1;
+      hash[1U] = b1;
+      hash[2U] = c1;
+      hash[3U] = d1;
+      hash[4U] = e1;
+      hash[5U] = f1;
+      hash[6U] = g1;
+      hash[7U] = h12;
+    }
+    if (i0 < (uint32_t)4U)
+    {
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+      {
+        Lib_IntVector_Intrinsics_vec256 t16 = ws[i];
+        Lib_IntVector_Intrinsics_vec256 t15 = ws[(i + (uint32_t)1U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256 t7 = ws[(i + (uint32_t)9U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256 t2 = ws[(i + (uint32_t)14U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256
+        s1 =
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t2, (uint32_t)19U), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t2, (uint32_t)61U), Lib_IntVector_Intrinsics_vec256_shift_right64(t2, (uint32_t)6U)));
+        Lib_IntVector_Intrinsics_vec256
+        s0 =
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t15, (uint32_t)1U), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t15, (uint32_t)8U), Lib_IntVector_Intrinsics_vec256_shift_right64(t15, (uint32_t)7U)));
+        ws[i] = Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(s1, t7), s0), t16);
+      }
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 *os = hash;
+    Lib_IntVector_Intrinsics_vec256 x = Lib_IntVector_Intrinsics_vec256_add64(hash[i], hash_old[i]);
+    os[i] = x;
+  }
+}
+
+static inline void
+sha384_update_nblocks4(uint32_t len, Hacl_Impl_SHA2_Types_uint8_4p b, Lib_IntVector_Intrinsics_vec256 *st)
+{
+  uint32_t blocks = len / (uint32_t)128U;
+  for (uint32_t i = (uint32_t)0U; i < blocks; i++)
+  {
+    uint8_t *b3 = b.snd.snd.snd;
+    uint8_t *b2 = b.snd.snd.fst;
+    uint8_t *b1 = b.snd.fst;
+    uint8_t *b0 = b.fst;
+    uint8_t *bl0 = b0 + i * (uint32_t)128U;
+    uint8_t *bl1 = b1 + i * (uint32_t)128U;
+    uint8_t *bl2 = b2 + i * (uint32_t)128U;
+    uint8_t *bl3 = b3 + i * (uint32_t)128U;
+    Hacl_Impl_SHA2_Types_uint8_4p mb = { .fst = bl0, .snd = { .fst = bl1, .snd = { .fst = bl2, .snd = bl3 } } };
+    sha384_update4(mb, st);
+  }
+}
+
+static inline void
+sha384_update_last4(FStar_UInt128_uint128 totlen, uint32_t len, Hacl_Impl_SHA2_Types_uint8_4p b, Lib_IntVector_Intrinsics_vec256 *hash)
+{
+  uint32_t blocks;
+  if (len + (uint32_t)16U + (uint32_t)1U <= (uint32_t)128U)
+  {
+    blocks = (uint32_t)1U;
+  }
+  else
+  {
+    blocks = (uint32_t)2U;
+  }
+  uint32_t fin = blocks * (uint32_t)128U;
+  uint8_t last[1024U] = { 0U };
+  uint8_t totlen_buf[16U] = { 0U };
+  FStar_UInt128_uint128 total_len_bits = FStar_UInt128_shift_left(totlen, (uint32_t)3U);
+  store128_be(totlen_buf, total_len_bits);
+  uint8_t *b3 = b.snd.snd.snd;
+  uint8_t *b2 = b.snd.snd.fst;
+  uint8_t *b1 = b.snd.fst;
+  uint8_t *b0 = b.fst;
+  uint8_t *last0 = last + (uint32_t)0U;
+  memcpy(last0, b0, len * sizeof (uint8_t));
+  last0[len] = (uint8_t)0x80U;
+  memcpy(last0 + fin - (uint32_t)16U, totlen_buf, (uint32_t)16U * sizeof (uint8_t));
+  uint8_t *last00 = last0;
+  uint8_t *last10 = last0 + (uint32_t)128U;
+  uint8_t *last1 = last + (uint32_t)256U;
+  memcpy(last1, b1, len * sizeof (uint8_t));
+  last1[len] = (uint8_t)0x80U;
+  memcpy(last1 + fin - (uint32_t)16U, totlen_buf, (uint32_t)16U * sizeof (uint8_t));
+  uint8_t *last01 = last1;
+  uint8_t *last11 = last1 + (uint32_t)128U;
+  uint8_t *last2 = last + (uint32_t)512U;
+  memcpy(last2, b2, len * sizeof (uint8_t));
+  last2[len] = (uint8_t)0x80U;
+  memcpy(last2 + fin - (uint32_t)16U, totlen_buf, (uint32_t)16U * sizeof (uint8_t));
+  uint8_t *last02 = last2;
+  uint8_t *last12 = last2 + (uint32_t)128U;
+  uint8_t *last3 = last + (uint32_t)768U;
+  memcpy(last3, b3, len * sizeof (uint8_t));
+  last3[len] = (uint8_t)0x80U;
+  memcpy(last3 + fin - (uint32_t)16U, totlen_buf, (uint32_t)16U * sizeof (uint8_t));
+  uint8_t *last03 = last3;
+  uint8_t *last13 = last3 + (uint32_t)128U;
+  Hacl_Impl_SHA2_Types_uint8_4p mb0 = { .fst = last00, .snd = { .fst = last01, .snd = { .fst = last02, .snd = last03 } } };
+  Hacl_Impl_SHA2_Types_uint8_4p mb1 = { .fst = last10, .snd = { .fst = last11, .snd = { .fst = last12, .snd = last13 } } };
+  sha384_update4(mb0, hash);
+  if (blocks > (uint32_t)1U)
+  {
+    sha384_update4(mb1, hash);
+  }
+}
+
+static inline void
+sha384_finish4(Lib_IntVector_Intrinsics_vec256 *st, Hacl_Impl_SHA2_Types_uint8_4p h)
+{
+  uint8_t hbuf[256U] = { 0U };
+  {
+    Lib_IntVector_Intrinsics_vec256 v0_ = st[0U];
+    Lib_IntVector_Intrinsics_vec256 v1_ = st[1U];
+    Lib_IntVector_Intrinsics_vec256 v2_ = st[2U];
+    Lib_IntVector_Intrinsics_vec256 v3_ = st[3U];
+    Lib_IntVector_Intrinsics_vec256 v0_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v1_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v2_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v3_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_0, v3_0);
+    st[0U] = v0_1;
+    st[1U] = v2_1;
+    st[2U] = v1_1;
+    st[3U] = v3_1;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec256 v0_ = st[4U];
+    Lib_IntVector_Intrinsics_vec256 v1_ = st[5U];
+    Lib_IntVector_Intrinsics_vec256 v2_ = st[6U];
+    Lib_IntVector_Intrinsics_vec256 v3_ = st[7U];
+    Lib_IntVector_Intrinsics_vec256 v0_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v1_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v2_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v3_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_0, v3_0);
+    st[4U] = v0_1;
+    st[5U] = v2_1;
+    st[6U] = v1_1;
+    st[7U] = v3_1;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec256 st0_ = st[0U];
+    Lib_IntVector_Intrinsics_vec256 st1_ = st[1U];
+    Lib_IntVector_Intrinsics_vec256 st2_ = st[2U];
+    Lib_IntVector_Intrinsics_vec256 st3_ = st[3U];
+    Lib_IntVector_Intrinsics_vec256 st4_ = st[4U];
+    Lib_IntVector_Intrinsics_vec256 st5_ = st[5U];
+    Lib_IntVector_Intrinsics_vec256 st6_ = st[6U];
+    Lib_IntVector_Intrinsics_vec256 st7_ = st[7U];
+    st[0U] = st0_;
+    st[1U] = st4_;
+    st[2U] = st1_;
+    st[3U] = st5_;
+    st[4U] = st2_;
+    st[5U] = st6_;
+    st[6U] = st3_;
+    st[7U] = st7_;
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256_store64_be(hbuf + i * (uint32_t)32U, st[i]);
+  }
+  uint8_t *b3 = h.snd.snd.snd;
+  uint8_t *b2 = h.snd.snd.fst;
+  uint8_t *b1 = h.snd.fst;
+  uint8_t *b0 = h.fst;
+  memcpy(b0, hbuf, (uint32_t)48U * sizeof (uint8_t));
+  memcpy(b1, hbuf + (uint32_t)64U, (uint32_t)48U * sizeof (uint8_t));
+  memcpy(b2, hbuf + (uint32_t)128U, (uint32_t)48U * sizeof (uint8_t));
+  memcpy(b3, hbuf + (uint32_t)192U, (uint32_t)48U * sizeof (uint8_t));
+}
+
+void
+Hacl_SHA2_Vec256_sha384_4(
+  uint8_t *dst0,
+  uint8_t *dst1,
+  uint8_t *dst2,
+  uint8_t *dst3,
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3
+)
+{
+  Hacl_Impl_SHA2_Types_uint8_4p ib = { .fst = input0, .snd = { .fst = input1, .snd = { .fst = input2, .snd = input3 } } };
+  Hacl_Impl_SHA2_Types_uint8_4p rb = { .fst = dst0, .snd = { .fst = dst1, .snd = { .fst = dst2, .snd = dst3 } } };
+  Lib_IntVector_Intrinsics_vec256 st[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    st[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  sha384_init4(st);
+  uint32_t rem = input_len % (uint32_t)128U;
+  FStar_UInt128_uint128 len_ = FStar_UInt128_uint64_to_uint128((uint64_t)input_len);
+  sha384_update_nblocks4(input_len, ib, st);
+  uint32_t rem1 = input_len % (uint32_t)128U;
+  uint8_t *b3 = ib.snd.snd.snd;
+  uint8_t *b2 = ib.snd.snd.fst;
+  uint8_t *b1 = ib.snd.fst;
+  uint8_t *b0 = ib.fst;
+  uint8_t *bl0 = b0 + input_len - rem1;
+  uint8_t *bl1 = b1 + input_len - rem1;
+  uint8_t *bl2 = b2 + input_len - rem1;
+  uint8_t *bl3 = b3 + input_len - rem1;
+  Hacl_Impl_SHA2_Types_uint8_4p lb = { .fst = bl0, .snd = { .fst = bl1, .snd = { .fst = bl2, .snd = bl3 } } };
+  sha384_update_last4(len_, rem, lb, st);
+  sha384_finish4(st, rb);
+}
+
+static inline void sha512_init4(Lib_IntVector_Intrinsics_vec256 *hash)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 *os = hash;
+    uint64_t hi = Hacl_Impl_SHA2_Generic_h512[i];
+    Lib_IntVector_Intrinsics_vec256 x = Lib_IntVector_Intrinsics_vec256_load64(hi);
+    os[i] = x;
+  }
+}
+
+static inline void
+sha512_update4(Hacl_Impl_SHA2_Types_uint8_4p block, Lib_IntVector_Intrinsics_vec256 *hash)
+{
+  Lib_IntVector_Intrinsics_vec256 hash_old[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    hash_old[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  Lib_IntVector_Intrinsics_vec256 ws[16U];
+  for (uint32_t _i = 0U; _i < (uint32_t)16U; ++_i)
+    ws[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  memcpy(hash_old, hash, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  uint8_t *b3 = block.snd.snd.snd;
+  uint8_t *b2 = block.snd.snd.fst;
+  uint8_t *b1 = block.snd.fst;
+  uint8_t *b0 = block.fst;
+  ws[0U] = Lib_IntVector_Intrinsics_vec256_load64_be(b0);
+  ws[1U] = Lib_IntVector_Intrinsics_vec256_load64_be(b1);
+  ws[2U] = Lib_IntVector_Intrinsics_vec256_load64_be(b2);
+  ws[3U] = Lib_IntVector_Intrinsics_vec256_load64_be(b3);
+  ws[4U] = Lib_IntVector_Intrinsics_vec256_load64_be(b0 + (uint32_t)32U);
+  ws[5U] = Lib_IntVector_Intrinsics_vec256_load64_be(b1 + (uint32_t)32U);
+  ws[6U] = Lib_IntVector_Intrinsics_vec256_load64_be(b2 + (uint32_t)32U);
+  ws[7U] = Lib_IntVector_Intrinsics_vec256_load64_be(b3 + (uint32_t)32U);
+  ws[8U] = Lib_IntVector_Intrinsics_vec256_load64_be(b0 + (uint32_t)64U);
+  ws[9U] = Lib_IntVector_Intrinsics_vec256_load64_be(b1 + (uint32_t)64U);
+  ws[10U] = Lib_IntVector_Intrinsics_vec256_load64_be(b2 + (uint32_t)64U);
+  ws[11U] = Lib_IntVector_Intrinsics_vec256_load64_be(b3 + (uint32_t)64U);
+  ws[12U] = Lib_IntVector_Intrinsics_vec256_load64_be(b0 + (uint32_t)96U);
+  ws[13U] = Lib_IntVector_Intrinsics_vec256_load64_be(b1 + (uint32_t)96U);
+  ws[14U] = Lib_IntVector_Intrinsics_vec256_load64_be(b2 + (uint32_t)96U);
+  ws[15U] = Lib_IntVector_Intrinsics_vec256_load64_be(b3 + (uint32_t)96U);
+  {
+    Lib_IntVector_Intrinsics_vec256 v0_ = ws[0U];
+    Lib_IntVector_Intrinsics_vec256 v1_ = ws[1U];
+    Lib_IntVector_Intrinsics_vec256 v2_ = ws[2U];
+    Lib_IntVector_Intrinsics_vec256 v3_ = ws[3U];
+    Lib_IntVector_Intrinsics_vec256 v0_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v1_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v2_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v3_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_0, v3_0);
+    ws[0U] = v0_1;
+    ws[1U] = v2_1;
+    ws[2U] = v1_1;
+    ws[3U] = v3_1;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec256 v0_ = ws[4U];
+    Lib_IntVector_Intrinsics_vec256 v1_ = ws[5U];
+    Lib_IntVector_Intrinsics_vec256 v2_ = ws[6U];
+    Lib_IntVector_Intrinsics_vec256 v3_ = ws[7U];
+    Lib_IntVector_Intrinsics_vec256 v0_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v1_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v2_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v3_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_0, v3_0);
+    ws[4U] = v0_1;
+    ws[5U] = v2_1;
+    ws[6U] = v1_1;
+    ws[7U] = v3_1;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec256 v0_ = ws[8U];
+    Lib_IntVector_Intrinsics_vec256 v1_ = ws[9U];
+    Lib_IntVector_Intrinsics_vec256 v2_ = ws[10U];
+    Lib_IntVector_Intrinsics_vec256 v3_ = ws[11U];
+    Lib_IntVector_Intrinsics_vec256 v0_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v1_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v2_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v3_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_0, v3_0);
+    ws[8U] = v0_1;
+    ws[9U] = v2_1;
+    ws[10U] = v1_1;
+    ws[11U] = v3_1;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec256 v0_ = ws[12U];
+    Lib_IntVector_Intrinsics_vec256 v1_ = ws[13U];
+    Lib_IntVector_Intrinsics_vec256 v2_ = ws[14U];
+    Lib_IntVector_Intrinsics_vec256 v3_ = ws[15U];
+    Lib_IntVector_Intrinsics_vec256 v0_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v1_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v2_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v3_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_0, v3_0);
+    ws[12U] = v0_1;
+    ws[13U] = v2_1;
+    ws[14U] = v1_1;
+    ws[15U] = v3_1;
+  }
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)5U; i0++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      uint64_t k_t = Hacl_Impl_SHA2_Generic_k384_512[(uint32_t)16U * i0 + i];
+      Lib_IntVector_Intrinsics_vec256 ws_t = ws[i];
+      Lib_IntVector_Intrinsics_vec256 a0 = hash[0U];
+      Lib_IntVector_Intrinsics_vec256 b0 = hash[1U];
+      Lib_IntVector_Intrinsics_vec256 c0 = hash[2U];
+      Lib_IntVector_Intrinsics_vec256 d0 = hash[3U];
+      Lib_IntVector_Intrinsics_vec256 e0 = hash[4U];
+      Lib_IntVector_Intrinsics_vec256 f0 = hash[5U];
+      Lib_IntVector_Intrinsics_vec256 g0 = hash[6U];
+      Lib_IntVector_Intrinsics_vec256 h02 = hash[7U];
+      Lib_IntVector_Intrinsics_vec256 k_e_t = Lib_IntVector_Intrinsics_vec256_load64(k_t);
+      Lib_IntVector_Intrinsics_vec256
+      t1 =
+        Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(h02, Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(e0, (uint32_t)14U), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(e0, (uint32_t)18U), Lib_IntVector_Intrinsics_vec256_rotate_right64(e0, (uint32_t)41U)))), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(e0, f0), Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(e0), g0))), k_e_t), ws_t);
+      Lib_IntVector_Intrinsics_vec256
+      t2 =
+        Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(a0, (uint32_t)28U), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(a0, (uint32_t)34U), Lib_IntVector_Intrinsics_vec256_rotate_right64(a0, (uint32_t)39U))), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, b0), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, c0), Lib_IntVector_Intrinsics_vec256_and(b0, c0))));
+      Lib_IntVector_Intrinsics_vec256 a1 = Lib_IntVector_Intrinsics_vec256_add64(t1, t2);
+      Lib_IntVector_Intrinsics_vec256 b1 = a0;
+      Lib_IntVector_Intrinsics_vec256 c1 = b0;
+      Lib_IntVector_Intrinsics_vec256 d1 = c0;
+      Lib_IntVector_Intrinsics_vec256 e1 = Lib_IntVector_Intrinsics_vec256_add64(d0, t1);
+      Lib_IntVector_Intrinsics_vec256 f1 = e0;
+      Lib_IntVector_Intrinsics_vec256 g1 = f0;
+      Lib_IntVector_Intrinsics_vec256 h12 = g0;
+      hash[0U] = a1;
+      hash[1U] = b1;
+      hash[2U] = c1;
+      hash[3U] = d1;
+      hash[4U] = e1;
+      hash[5U] = f1;
+      hash[6U] = g1;
+      hash[7U] = h12;
+    }
+    if (i0 < (uint32_t)4U)
+    {
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+      {
+        Lib_IntVector_Intrinsics_vec256 t16 = ws[i];
+        Lib_IntVector_Intrinsics_vec256 t15 = ws[(i + (uint32_t)1U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256 t7 = ws[(i + (uint32_t)9U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256 t2 = ws[(i + (uint32_t)14U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256
+        s1 =
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t2, (uint32_t)19U), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t2, (uint32_t)61U), Lib_IntVector_Intrinsics_vec256_shift_right64(t2, (uint32_t)6U)));
+        Lib_IntVector_Intrinsics_vec256
+        s0 =
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t15, (uint32_t)1U), Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t15, (uint32_t)8U), Lib_IntVector_Intrinsics_vec256_shift_right64(t15, (uint32_t)7U)));
+        ws[i] = Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(s1, t7), s0), t16);
+      }
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 *os = hash;
+    Lib_IntVector_Intrinsics_vec256 x = Lib_IntVector_Intrinsics_vec256_add64(hash[i], hash_old[i]);
+    os[i] = x;
+  }
+}
+
+static inline void
+sha512_update_nblocks4(uint32_t len, Hacl_Impl_SHA2_Types_uint8_4p b, Lib_IntVector_Intrinsics_vec256 *st)
+{
+  uint32_t blocks = len / (uint32_t)128U;
+  for (uint32_t i = (uint32_t)0U; i < blocks; i++)
+  {
+    uint8_t *b3 = b.snd.snd.snd;
+    uint8_t *b2 = b.snd.snd.fst;
+    uint8_t *b1 = b.snd.fst;
+    uint8_t *b0 = b.fst;
+    uint8_t *bl0 = b0 + i * (uint32_t)128U;
+    uint8_t *bl1 = b1 + i * (uint32_t)128U;
+    uint8_t *bl2 = b2 + i * (uint32_t)128U;
+    uint8_t *bl3 = b3 + i * (uint32_t)128U;
+    Hacl_Impl_SHA2_Types_uint8_4p mb = { .fst = bl0, .snd = { .fst = bl1, .snd = { .fst = bl2, .snd = bl3 } } };
+    sha512_update4(mb, st);
+  }
+}
+
+static inline void
+sha512_update_last4(FStar_UInt128_uint128 totlen, uint32_t len, Hacl_Impl_SHA2_Types_uint8_4p b, Lib_IntVector_Intrinsics_vec256 *hash)
+{
+  uint32_t blocks;
+  if (len + (uint32_t)16U + (uint32_t)1U <= (uint32_t)128U)
+  {
+    blocks = (uint32_t)1U;
+  }
+  else
+  {
+    blocks = (uint32_t)2U;
+  }
+  uint32_t fin = blocks * (uint32_t)128U;
+  uint8_t last[1024U] = { 0U };
+  uint8_t totlen_buf[16U] = { 0U };
+  FStar_UInt128_uint128 total_len_bits = FStar_UInt128_shift_left(totlen, (uint32_t)3U);
+  store128_be(totlen_buf, total_len_bits);
+  uint8_t *b3 = b.snd.snd.snd;
+  uint8_t *b2 = b.snd.snd.fst;
+  uint8_t *b1 = b.snd.fst;
+  uint8_t *b0 = b.fst;
+  uint8_t *last0 = last + (uint32_t)0U;
+  memcpy(last0, b0, len * sizeof (uint8_t));
+  last0[len] = (uint8_t)0x80U;
+  memcpy(last0 + fin - (uint32_t)16U, totlen_buf, (uint32_t)16U * sizeof (uint8_t));
+  uint8_t *last00 = last0;
+  uint8_t *last10 = last0 + (uint32_t)128U;
+  uint8_t *last1 = last + (uint32_t)256U;
+  memcpy(last1, b1, len * sizeof (uint8_t));
+  last1[len] = (uint8_t)0x80U;
+  memcpy(last1 + fin - (uint32_t)16U, totlen_buf, (uint32_t)16U * sizeof (uint8_t));
+  uint8_t *last01 = last1;
+  uint8_t *last11 = last1 + (uint32_t)128U;
+  uint8_t *last2 = last + (uint32_t)512U;
+  memcpy(last2, b2, len * sizeof (uint8_t));
+  last2[len] = (uint8_t)0x80U;
+  memcpy(last2 + fin - (uint32_t)16U, totlen_buf, (uint32_t)16U * sizeof (uint8_t));
+  uint8_t *last02 = last2;
+  uint8_t *last12 = last2 + (uint32_t)128U;
+  uint8_t *last3 = last + (uint32_t)768U;
+  memcpy(last3, b3, len * sizeof (uint8_t));
+  last3[len] = (uint8_t)0x80U;
+  memcpy(last3 + fin - (uint32_t)16U, totlen_buf, (uint32_t)16U * sizeof (uint8_t));
+  uint8_t *last03 = last3;
+  uint8_t *last13 = last3 + (uint32_t)128U;
+  Hacl_Impl_SHA2_Types_uint8_4p mb0 = { .fst = last00, .snd = { .fst = last01, .snd = { .fst = last02, .snd = last03 } } };
+  Hacl_Impl_SHA2_Types_uint8_4p mb1 = { .fst = last10, .snd = { .fst = last11, .snd = { .fst = last12, .snd = last13 } } };
+  sha512_update4(mb0, hash);
+  if (blocks > (uint32_t)1U)
+  {
+    sha512_update4(mb1, hash);
+  }
+}
+
+static inline void
+sha512_finish4(Lib_IntVector_Intrinsics_vec256 *st, Hacl_Impl_SHA2_Types_uint8_4p h)
+{
+  uint8_t hbuf[256U] = { 0U };
+  {
+    Lib_IntVector_Intrinsics_vec256 v0_ = st[0U];
+    Lib_IntVector_Intrinsics_vec256 v1_ = st[1U];
+    Lib_IntVector_Intrinsics_vec256 v2_ = st[2U];
+    Lib_IntVector_Intrinsics_vec256 v3_ = st[3U];
+    Lib_IntVector_Intrinsics_vec256 v0_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v1_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v2_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v3_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_0, v3_0);
+    st[0U] = v0_1;
+    st[1U] = v2_1;
+    st[2U] = v1_1;
+    st[3U] = v3_1;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec256 v0_ = st[4U];
+    Lib_IntVector_Intrinsics_vec256 v1_ = st[5U];
+    Lib_IntVector_Intrinsics_vec256 v2_ = st[6U];
+    Lib_IntVector_Intrinsics_vec256 v3_ = st[7U];
+    Lib_IntVector_Intrinsics_vec256 v0_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v1_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_, v1_);
+    Lib_IntVector_Intrinsics_vec256 v2_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v3_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v2_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_0, v2_0);
+    Lib_IntVector_Intrinsics_vec256 v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_0, v3_0);
+    Lib_IntVector_Intrinsics_vec256 v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_0, v3_0);
+    st[4U] = v0_1;
+    st[5U] = v2_1;
+    st[6U] = v1_1;
+    st[7U] = v3_1;
+  }
+  {
+    Lib_IntVector_Intrinsics_vec256 st0_ = st[0U];
+    Lib_IntVector_Intrinsics_vec256 st1_ = st[1U];
+    Lib_IntVector_Intrinsics_vec256 st2_ = st[2U];
+    Lib_IntVector_Intrinsics_vec256 st3_ = st[3U];
+    Lib_IntVector_Intrinsics_vec256 st4_ = st[4U];
+    Lib_IntVector_Intrinsics_vec256 st5_ = st[5U];
+    Lib_IntVector_Intrinsics_vec256 st6_ = st[6U];
+    Lib_IntVector_Intrinsics_vec256 st7_ = st[7U];
+    st[0U] = st0_;
+    st[1U] = st4_;
+    st[2U] = st1_;
+    st[3U] = st5_;
+    st[4U] = st2_;
+    st[5U] = st6_;
+    st[6U] = st3_;
+    st[7U] = st7_;
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256_store64_be(hbuf + i * (uint32_t)32U, st[i]);
+  }
+  uint8_t *b3 = h.snd.snd.snd;
+  uint8_t *b2 = h.snd.snd.fst;
+  uint8_t *b1 = h.snd.fst;
+  uint8_t *b0 = h.fst;
+  memcpy(b0, hbuf, (uint32_t)64U * sizeof (uint8_t));
+  memcpy(b1, hbuf + (uint32_t)64U, (uint32_t)64U * sizeof (uint8_t));
+  memcpy(b2, hbuf + (uint32_t)128U, (uint32_t)64U * sizeof (uint8_t));
+  memcpy(b3, hbuf + (uint32_t)192U, (uint32_t)64U * sizeof (uint8_t));
+}
+
+void
+Hacl_SHA2_Vec256_sha512_4(
+  uint8_t *dst0,
+  uint8_t *dst1,
+  uint8_t *dst2,
+  uint8_t *dst3,
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3
+)
+{
+  Hacl_Impl_SHA2_Types_uint8_4p ib = { .fst = input0, .snd = { .fst = input1, .snd = { .fst = input2, .snd = input3 } } };
+  Hacl_Impl_SHA2_Types_uint8_4p rb = { .fst = dst0, .snd = { .fst = dst1, .snd = { .fst = dst2, .snd = dst3 } } };
+  Lib_IntVector_Intrinsics_vec256 st[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    st[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  sha512_init4(st);
+  uint32_t rem = input_len % (uint32_t)128U;
+  FStar_UInt128_uint128 len_ = FStar_UInt128_uint64_to_uint128((uint64_t)input_len);
+  sha512_update_nblocks4(input_len, ib, st);
+  uint32_t rem1 = input_len % (uint32_t)128U;
+  uint8_t *b3 = ib.snd.snd.snd;
+  uint8_t *b2 = ib.snd.snd.fst;
+  uint8_t *b1 = ib.snd.fst;
+  uint8_t *b0 = ib.fst;
+  uint8_t *bl0 = b0 + input_len - rem1;
+  uint8_t *bl1 = b1 + input_len - rem1;
+  uint8_t *bl2 = b2 + input_len - rem1;
+  uint8_t *bl3 = b3 + input_len - rem1;
+  Hacl_Impl_SHA2_Types_uint8_4p lb = { .fst = bl0, .snd = { .fst = bl1, .snd = { .fst = bl2, .snd = bl3 } } };
+  sha512_update_last4(len_, rem, lb, st);
+  sha512_finish4(st, rb);
+}
@@ -148,27 +148,18 @@ void Hacl_Impl_SHA3_storeState(uint32_t rateInBytes, uint64_t *s, uint8_t *res)
 }
 
 void
-Hacl_Impl_SHA3_absorb(
-  uint64_t *s,
+Hacl_Impl_SHA3_absorb_last(
+  uint8_t delimitedSuffix,
   uint32_t rateInBytes,
-  uint32_t inputByteLen,
+  uint32_t rem,
   uint8_t *input,
-  uint8_t delimitedSuffix
+  uint64_t *s
 )
 {
-  uint32_t nb = inputByteLen / rateInBytes;
-  uint32_t rem = inputByteLen % rateInBytes;
-  for (uint32_t i = (uint32_t)0U; i < nb; i++)
-  {
-    uint8_t *block = input + i * rateInBytes;
-    Hacl_Impl_SHA3_loadState(rateInBytes, block, s);
-    Hacl_Impl_SHA3_state_permute(s);
-  }
-  uint8_t *last = input + nb * rateInBytes;
   KRML_CHECK_SIZE(sizeof (uint8_t), rateInBytes);
   uint8_t b[rateInBytes];
   memset(b, 0U, rateInBytes * sizeof (uint8_t));
-  memcpy(b, last, rem * sizeof (uint8_t));
+  memcpy(b, input, rem * sizeof (uint8_t));
   b[rem] = delimitedSuffix;
   Hacl_Impl_SHA3_loadState(rateInBytes, b, s);
   if (!((delimitedSuffix & (uint8_t)0x80U) == (uint8_t)0U) && rem == rateInBytes - (uint32_t)1U)
@@ -185,6 +176,32 @@ Hacl_Impl_SHA3_absorb(
   Lib_Memzero0_memzero(b, rateInBytes * sizeof (b[0U]));
 }
 
+void Hacl_Impl_SHA3_absorb_inner(uint32_t rateInBytes, uint8_t *block, uint64_t *s)
+{
+  Hacl_Impl_SHA3_loadState(rateInBytes, block, s);
+  Hacl_Impl_SHA3_state_permute(s);
+}
+
+void
+Hacl_Impl_SHA3_absorb(
+  uint64_t *s,
+  uint32_t rateInBytes,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint8_t delimitedSuffix
+)
+{
+  uint32_t nb = inputByteLen / rateInBytes;
+  uint32_t rem = inputByteLen % rateInBytes;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    uint8_t *block = input + i * rateInBytes;
+    Hacl_Impl_SHA3_absorb_inner(rateInBytes, block, s);
+  }
+  uint8_t *last = input + nb * rateInBytes;
+  Hacl_Impl_SHA3_absorb_last(delimitedSuffix, rateInBytes, rem, last, s);
+}
+
 void
 Hacl_Impl_SHA3_squeeze(
   uint64_t *s,
@@ -300,3 +317,40 @@ void Hacl_SHA3_sha3_512(uint32_t inputByteLen, uint8_t *input, uint8_t *output)
     output);
 }
 
+void
+Hacl_SHA3_update_multi_sha3(
+  uint64_t *s,
+  uint32_t rateInBytes,
+  uint8_t *blocks,
+  uint32_t n_blocks
+)
+{
+  for (uint32_t i = (uint32_t)0U; i < n_blocks; i++)
+  {
+    uint8_t *block = blocks + i * rateInBytes;
+    Hacl_Impl_SHA3_absorb_inner(rateInBytes, block, s);
+  }
+}
+
+void
+Hacl_SHA3_update_last_sha3(
+  uint64_t *s,
+  uint32_t rateInBytes,
+  uint8_t delimitedSuffix,
+  uint8_t *input,
+  uint32_t input_len
+)
+{
+  if (input_len == rateInBytes)
+  {
+    Hacl_Impl_SHA3_absorb_inner(rateInBytes, input, s);
+    Hacl_Impl_SHA3_absorb_last(delimitedSuffix,
+      rateInBytes,
+      (uint32_t)0U,
+      input + rateInBytes,
+      s);
+    return;
+  }
+  Hacl_Impl_SHA3_absorb_last(delimitedSuffix, rateInBytes, input_len, input, s);
+}
+
@@ -54,6 +54,17 @@ void Hacl_Impl_SHA3_loadState(uint32_t rateInBytes, uint8_t *input, uint64_t *s)
 
 void Hacl_Impl_SHA3_storeState(uint32_t rateInBytes, uint64_t *s, uint8_t *res);
 
+void
+Hacl_Impl_SHA3_absorb_last(
+  uint8_t delimitedSuffix,
+  uint32_t rateInBytes,
+  uint32_t rem,
+  uint8_t *input,
+  uint64_t *s
+);
+
+void Hacl_Impl_SHA3_absorb_inner(uint32_t rateInBytes, uint8_t *block, uint64_t *s);
+
 void
 Hacl_Impl_SHA3_absorb(
   uint64_t *s,
@@ -106,6 +117,23 @@ void Hacl_SHA3_sha3_384(uint32_t inputByteLen, uint8_t *input, uint8_t *output);
 
 void Hacl_SHA3_sha3_512(uint32_t inputByteLen, uint8_t *input, uint8_t *output);
 
+void
+Hacl_SHA3_update_multi_sha3(
+  uint64_t *s,
+  uint32_t rateInBytes,
+  uint8_t *blocks,
+  uint32_t n_blocks
+);
+
+void
+Hacl_SHA3_update_last_sha3(
+  uint64_t *s,
+  uint32_t rateInBytes,
+  uint8_t delimitedSuffix,
+  uint8_t *input,
+  uint32_t input_len
+);
+
 #if defined(__cplusplus)
 }
 #endif
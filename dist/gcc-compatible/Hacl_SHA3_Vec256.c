@@ -0,0 +1,397 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Hacl_SHA3_Vec256.h"
+
+void Hacl_SHA3_Vec256_state_permute(Lib_IntVector_Intrinsics_vec256 *s)
+{
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)24U; i0++)
+  {
+    Lib_IntVector_Intrinsics_vec256 _C[5U];
+    for (uint32_t _i = 0U; _i < (uint32_t)5U; ++_i)
+      _C[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+    {
+      _C[i] =
+        Lib_IntVector_Intrinsics_vec256_xor(s[i + (uint32_t)0U],
+          Lib_IntVector_Intrinsics_vec256_xor(s[i + (uint32_t)5U],
+            Lib_IntVector_Intrinsics_vec256_xor(s[i + (uint32_t)10U],
+              Lib_IntVector_Intrinsics_vec256_xor(s[i + (uint32_t)15U], s[i + (uint32_t)20U]))));
+    }
+    for (uint32_t i1 = (uint32_t)0U; i1 < (uint32_t)5U; i1++)
+    {
+      Lib_IntVector_Intrinsics_vec256 uu____0 = _C[(i1 + (uint32_t)4U) % (uint32_t)5U];
+      Lib_IntVector_Intrinsics_vec256
+      _D =
+        Lib_IntVector_Intrinsics_vec256_xor(uu____0,
+          Lib_IntVector_Intrinsics_vec256_rotate_left64(_C[(i1 + (uint32_t)1U) % (uint32_t)5U],
+            (uint32_t)1U));
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+      {
+        s[i1 + (uint32_t)5U * i] =
+          Lib_IntVector_Intrinsics_vec256_xor(s[i1 + (uint32_t)5U * i],
+            _D);
+      }
+    }
+    Lib_IntVector_Intrinsics_vec256 current = s[1U];
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)24U; i++)
+    {
+      uint32_t _Y = Hacl_Impl_SHA3_keccak_piln[i];
+      uint32_t r = Hacl_Impl_SHA3_keccak_rotc[i];
+      Lib_IntVector_Intrinsics_vec256 temp = s[_Y];
+      s[_Y] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, r);
+      current = temp;
+    }
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+    {
+      Lib_IntVector_Intrinsics_vec256 v0 = s[(uint32_t)0U + (uint32_t)5U * i];
+      Lib_IntVector_Intrinsics_vec256 v1 = s[(uint32_t)1U + (uint32_t)5U * i];
+      Lib_IntVector_Intrinsics_vec256 v2 = s[(uint32_t)2U + (uint32_t)5U * i];
+      Lib_IntVector_Intrinsics_vec256 v3 = s[(uint32_t)3U + (uint32_t)5U * i];
+      Lib_IntVector_Intrinsics_vec256 v4 = s[(uint32_t)4U + (uint32_t)5U * i];
+      s[(uint32_t)0U + (uint32_t)5U * i] =
+        Lib_IntVector_Intrinsics_vec256_xor(v0,
+          Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(v1), v2));
+      s[(uint32_t)1U + (uint32_t)5U * i] =
+        Lib_IntVector_Intrinsics_vec256_xor(v1,
+          Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(v2), v3));
+      s[(uint32_t)2U + (uint32_t)5U * i] =
+        Lib_IntVector_Intrinsics_vec256_xor(v2,
+          Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(v3), v4));
+      s[(uint32_t)3U + (uint32_t)5U * i] =
+        Lib_IntVector_Intrinsics_vec256_xor(v3,
+          Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(v4), v0));
+      s[(uint32_t)4U + (uint32_t)5U * i] =
+        Lib_IntVector_Intrinsics_vec256_xor(v4,
+          Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(v0), v1));
+    }
+    uint64_t c = Hacl_Impl_SHA3_keccak_rndc[i0];
+    s[0U] = Lib_IntVector_Intrinsics_vec256_xor(s[0U], Lib_IntVector_Intrinsics_vec256_load64(c));
+  }
+}
+
+void
+Hacl_SHA3_Vec256_loadState(
+  uint32_t rateInBytes,
+  uint8_t *b0,
+  uint8_t *b1,
+  uint8_t *b2,
+  uint8_t *b3,
+  Lib_IntVector_Intrinsics_vec256 *s
+)
+{
+  uint8_t block[768U] = { 0U };
+  memcpy(block, b0, rateInBytes * sizeof (uint8_t));
+  memcpy(block + (uint32_t)192U, b1, rateInBytes * sizeof (uint8_t));
+  memcpy(block + (uint32_t)384U, b2, rateInBytes * sizeof (uint8_t));
+  memcpy(block + (uint32_t)576U, b3, rateInBytes * sizeof (uint8_t));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)6U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    v0 = Lib_IntVector_Intrinsics_vec256_load_le(block + i * (uint32_t)32U);
+    Lib_IntVector_Intrinsics_vec256
+    v1 = Lib_IntVector_Intrinsics_vec256_load_le(block + (uint32_t)192U + i * (uint32_t)32U);
+    Lib_IntVector_Intrinsics_vec256
+    v2 = Lib_IntVector_Intrinsics_vec256_load_le(block + (uint32_t)384U + i * (uint32_t)32U);
+    Lib_IntVector_Intrinsics_vec256
+    v3 = Lib_IntVector_Intrinsics_vec256_load_le(block + (uint32_t)576U + i * (uint32_t)32U);
+    Lib_IntVector_Intrinsics_vec256 v0_ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0, v1);
+    Lib_IntVector_Intrinsics_vec256 v1_ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0, v1);
+    Lib_IntVector_Intrinsics_vec256 v2_ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v2, v3);
+    Lib_IntVector_Intrinsics_vec256 v3_ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v2, v3);
+    Lib_IntVector_Intrinsics_vec256
+    v0__ = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_, v2_);
+    Lib_IntVector_Intrinsics_vec256
+    v1__ = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_, v3_);
+    Lib_IntVector_Intrinsics_vec256
+    v2__ = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_, v2_);
+    Lib_IntVector_Intrinsics_vec256
+    v3__ = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_, v3_);
+    s[(uint32_t)4U * i + (uint32_t)0U] =
+      Lib_IntVector_Intrinsics_vec256_xor(s[(uint32_t)4U * i + (uint32_t)0U], v0__);
+    s[(uint32_t)4U * i + (uint32_t)1U] =
+      Lib_IntVector_Intrinsics_vec256_xor(s[(uint32_t)4U * i + (uint32_t)1U], v1__);
+    s[(uint32_t)4U * i + (uint32_t)2U] =
+      Lib_IntVector_Intrinsics_vec256_xor(s[(uint32_t)4U * i + (uint32_t)2U], v2__);
+    s[(uint32_t)4U * i + (uint32_t)3U] =
+      Lib_IntVector_Intrinsics_vec256_xor(s[(uint32_t)4U * i + (uint32_t)3U], v3__);
+  }
+}
+
+void
+Hacl_SHA3_Vec256_storeState(
+  uint32_t rateInBytes,
+  Lib_IntVector_Intrinsics_vec256 *s,
+  uint8_t *b0,
+  uint8_t *b1,
+  uint8_t *b2,
+  uint8_t *b3
+)
+{
+  uint8_t block[768U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)6U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 v0 = s[(uint32_t)4U * i + (uint32_t)0U];
+    Lib_IntVector_Intrinsics_vec256 v1 = s[(uint32_t)4U * i + (uint32_t)1U];
+    Lib_IntVector_Intrinsics_vec256 v2 = s[(uint32_t)4U * i + (uint32_t)2U];
+    Lib_IntVector_Intrinsics_vec256 v3 = s[(uint32_t)4U * i + (uint32_t)3U];
+    Lib_IntVector_Intrinsics_vec256 v0_ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0, v1);
+    Lib_IntVector_Intrinsics_vec256 v1_ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0, v1);
+    Lib_IntVector_Intrinsics_vec256 v2_ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v2, v3);
+    Lib_IntVector_Intrinsics_vec256 v3_ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v2, v3);
+    Lib_IntVector_Intrinsics_vec256
+    v0__ = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_, v2_);
+    Lib_IntVector_Intrinsics_vec256
+    v1__ = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_, v3_);
+    Lib_IntVector_Intrinsics_vec256
+    v2__ = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_, v2_);
+    Lib_IntVector_Intrinsics_vec256
+    v3__ = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_, v3_);
+    Lib_IntVector_Intrinsics_vec256_store_le(block + i * (uint32_t)32U, v0__);
+    Lib_IntVector_Intrinsics_vec256_store_le(block + (uint32_t)192U + i * (uint32_t)32U, v1__);
+    Lib_IntVector_Intrinsics_vec256_store_le(block + (uint32_t)384U + i * (uint32_t)32U, v2__);
+    Lib_IntVector_Intrinsics_vec256_store_le(block + (uint32_t)576U + i * (uint32_t)32U, v3__);
+  }
+  memcpy(b0, block, rateInBytes * sizeof (uint8_t));
+  memcpy(b1, block + (uint32_t)192U, rateInBytes * sizeof (uint8_t));
+  memcpy(b2, block + (uint32_t)384U, rateInBytes * sizeof (uint8_t));
+  memcpy(b3, block + (uint32_t)576U, rateInBytes * sizeof (uint8_t));
+}
+
+void
+Hacl_SHA3_Vec256_absorb_last(
+  uint8_t delimitedSuffix,
+  uint32_t rateInBytes,
+  uint32_t rem,
+  uint8_t *b0,
+  uint8_t *b1,
+  uint8_t *b2,
+  uint8_t *b3,
+  Lib_IntVector_Intrinsics_vec256 *s
+)
+{
+  KRML_CHECK_SIZE(sizeof (uint8_t), (uint32_t)4U * rateInBytes);
+  uint8_t lastBlock[(uint32_t)4U * rateInBytes];
+  memset(lastBlock, 0U, (uint32_t)4U * rateInBytes * sizeof (uint8_t));
+  uint8_t *l0 = lastBlock;
+  uint8_t *l1 = lastBlock + rateInBytes;
+  uint8_t *l2 = lastBlock + (uint32_t)2U * rateInBytes;
+  uint8_t *l3 = lastBlock + (uint32_t)3U * rateInBytes;
+  memcpy(l0, b0, rem * sizeof (uint8_t));
+  memcpy(l1, b1, rem * sizeof (uint8_t));
+  memcpy(l2, b2, rem * sizeof (uint8_t));
+  memcpy(l3, b3, rem * sizeof (uint8_t));
+  l0[rem] = delimitedSuffix;
+  l1[rem] = delimitedSuffix;
+  l2[rem] = delimitedSuffix;
+  l3[rem] = delimitedSuffix;
+  Hacl_SHA3_Vec256_loadState(rateInBytes, l0, l1, l2, l3, s);
+  if (!((delimitedSuffix & (uint8_t)0x80U) == (uint8_t)0U) && rem == rateInBytes - (uint32_t)1U)
+  {
+    Hacl_SHA3_Vec256_state_permute(s);
+  }
+  uint32_t j = rateInBytes / (uint32_t)8U - (uint32_t)1U;
+  s[j] =
+    Lib_IntVector_Intrinsics_vec256_xor(s[j],
+      Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x8000000000000000U));
+  Hacl_SHA3_Vec256_state_permute(s);
+}
+
+void
+Hacl_SHA3_Vec256_absorb(
+  Lib_IntVector_Intrinsics_vec256 *s,
+  uint32_t rateInBytes,
+  uint32_t inputByteLen,
+  uint8_t *b0,
+  uint8_t *b1,
+  uint8_t *b2,
+  uint8_t *b3,
+  uint8_t delimitedSuffix
+)
+{
+  uint32_t n_blocks = inputByteLen / rateInBytes;
+  uint32_t rem = inputByteLen % rateInBytes;
+  for (uint32_t i = (uint32_t)0U; i < n_blocks; i++)
+  {
+    Hacl_SHA3_Vec256_loadState(rateInBytes,
+      b0 + i * rateInBytes,
+      b1 + i * rateInBytes,
+      b2 + i * rateInBytes,
+      b3 + i * rateInBytes,
+      s);
+    Hacl_SHA3_Vec256_state_permute(s);
+  }
+  uint32_t off = inputByteLen - rem;
+  Hacl_SHA3_Vec256_absorb_last(delimitedSuffix,
+    rateInBytes,
+    rem,
+    b0 + off,
+    b1 + off,
+    b2 + off,
+    b3 + off,
+    s);
+}
+
+void
+Hacl_SHA3_Vec256_squeeze(
+  Lib_IntVector_Intrinsics_vec256 *s,
+  uint32_t rateInBytes,
+  uint32_t outputByteLen,
+  uint8_t *b0,
+  uint8_t *b1,
+  uint8_t *b2,
+  uint8_t *b3
+)
+{
+  uint32_t outBlocks = outputByteLen / rateInBytes;
+  uint32_t remOut = outputByteLen % rateInBytes;
+  for (uint32_t i = (uint32_t)0U; i < outBlocks; i++)
+  {
+    Hacl_SHA3_Vec256_storeState(rateInBytes,
+      s,
+      b0 + i * rateInBytes,
+      b1 + i * rateInBytes,
+      b2 + i * rateInBytes,
+      b3 + i * rateInBytes);
+    Hacl_SHA3_Vec256_state_permute(s);
+  }
+  uint32_t off = outputByteLen - remOut;
+  Hacl_SHA3_Vec256_storeState(remOut, s, b0 + off, b1 + off, b2 + off, b3 + off);
+}
+
+void
+Hacl_SHA3_Vec256_shake128_vec256(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  Lib_IntVector_Intrinsics_vec256 s[25U];
+  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
+    s[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  Hacl_SHA3_Vec256_absorb(s,
+    (uint32_t)168U,
+    inputByteLen,
+    input0,
+    input1,
+    input2,
+    input3,
+    (uint8_t)0x1FU);
+  Hacl_SHA3_Vec256_squeeze(s, (uint32_t)168U, outputByteLen, output0, output1, output2, output3);
+}
+
+void
+Hacl_SHA3_Vec256_shake256_vec256(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  Lib_IntVector_Intrinsics_vec256 s[25U];
+  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
+    s[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  Hacl_SHA3_Vec256_absorb(s,
+    (uint32_t)136U,
+    inputByteLen,
+    input0,
+    input1,
+    input2,
+    input3,
+    (uint8_t)0x1FU);
+  Hacl_SHA3_Vec256_squeeze(s, (uint32_t)136U, outputByteLen, output0, output1, output2, output3);
+}
+
+void
+Hacl_SHA3_Vec256_cshake128_frodo_vec256(
+  uint32_t input_len,
+  uint8_t *input,
+  uint16_t cstm0,
+  uint16_t cstm1,
+  uint16_t cstm2,
+  uint16_t cstm3,
+  uint32_t output_len,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  Lib_IntVector_Intrinsics_vec256 s[25U];
+  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
+    s[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  s[0U] =
+    Lib_IntVector_Intrinsics_vec256_load64s((uint64_t)0x10010001a801U
+      | (uint64_t)cstm0 << (uint32_t)48U,
+      (uint64_t)0x10010001a801U | (uint64_t)cstm1 << (uint32_t)48U,
+      (uint64_t)0x10010001a801U | (uint64_t)cstm2 << (uint32_t)48U,
+      (uint64_t)0x10010001a801U | (uint64_t)cstm3 << (uint32_t)48U);
+  Hacl_SHA3_Vec256_state_permute(s);
+  Hacl_SHA3_Vec256_absorb(s, (uint32_t)168U, input_len, input, input, input, input, (uint8_t)0x04U);
+  Hacl_SHA3_Vec256_squeeze(s, (uint32_t)168U, output_len, output0, output1, output2, output3);
+}
+
+void
+Hacl_SHA3_Vec256_cshake256_frodo_vec256(
+  uint32_t input_len,
+  uint8_t *input,
+  uint16_t cstm0,
+  uint16_t cstm1,
+  uint16_t cstm2,
+  uint16_t cstm3,
+  uint32_t output_len,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  Lib_IntVector_Intrinsics_vec256 s[25U];
+  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
+    s[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  s[0U] =
+    Lib_IntVector_Intrinsics_vec256_load64s((uint64_t)0x100100018801U
+      | (uint64_t)cstm0 << (uint32_t)48U,
+      (uint64_t)0x100100018801U | (uint64_t)cstm1 << (uint32_t)48U,
+      (uint64_t)0x100100018801U | (uint64_t)cstm2 << (uint32_t)48U,
+      (uint64_t)0x100100018801U | (uint64_t)cstm3 << (uint32_t)48U);
+  Hacl_SHA3_Vec256_state_permute(s);
+  Hacl_SHA3_Vec256_absorb(s, (uint32_t)136U, input_len, input, input, input, input, (uint8_t)0x04U);
+  Hacl_SHA3_Vec256_squeeze(s, (uint32_t)136U, output_len, output0, output1, output2, output3);
+}
+
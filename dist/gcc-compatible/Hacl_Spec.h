@@ -52,6 +52,10 @@ typedef uint8_t Spec_Blake2_alg;
 #define Spec_Hash_Definitions_MD5 5
 #define Spec_Hash_Definitions_Blake2S 6
 #define Spec_Hash_Definitions_Blake2B 7
+#define Spec_Hash_Definitions_SHA3_224 8
+#define Spec_Hash_Definitions_SHA3_256 9
+#define Spec_Hash_Definitions_SHA3_384 10
+#define Spec_Hash_Definitions_SHA3_512 11
 
 typedef uint8_t Spec_Hash_Definitions_hash_alg;
 
@@ -84,6 +88,8 @@ typedef uint8_t Spec_Agile_Cipher_cipher_alg;
 #define Spec_Cipher_Expansion_Hacl_CHACHA20 0
 #define Spec_Cipher_Expansion_Vale_AES128 1
 #define Spec_Cipher_Expansion_Vale_AES256 2
+#define Spec_Cipher_Expansion_Hacl_AES128 3
+#define Spec_Cipher_Expansion_Hacl_AES256 4
 
 typedef uint8_t Spec_Cipher_Expansion_impl;
 
@@ -97,6 +103,9 @@ Spec_Cipher_Expansion_cipher_alg_of_impl(Spec_Cipher_Expansion_impl i);
 #define Spec_Agile_AEAD_AES256_CCM 4
 #define Spec_Agile_AEAD_AES128_CCM8 5
 #define Spec_Agile_AEAD_AES256_CCM8 6
+#define Spec_Agile_AEAD_AES128_GCM_SIV 7
+#define Spec_Agile_AEAD_AES256_GCM_SIV 8
+#define Spec_Agile_AEAD_XCHACHA20_POLY1305 9
 
 typedef uint8_t Spec_Agile_AEAD_alg;
 
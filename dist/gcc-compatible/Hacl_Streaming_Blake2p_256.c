@@ -0,0 +1,534 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Streaming_Blake2p_256.h"
+
+/*
+  State allocation function when there is no key
+*/
+Hacl_Streaming_Blake2p_256_blake2bp_256_state
+*Hacl_Streaming_Blake2p_256_blake2bp_256_no_key_create_in()
+{
+  return Hacl_Streaming_Blake2p_256_blake2bp_256_with_key_create_in((uint32_t)0U, NULL);
+}
+
+/*
+  (Re-)initialization function when there is no key
+*/
+void
+Hacl_Streaming_Blake2p_256_blake2bp_256_no_key_init(
+  Hacl_Streaming_Blake2p_256_blake2bp_256_state *s
+)
+{
+  Hacl_Streaming_Blake2p_256_blake2bp_256_with_key_init((uint32_t)0U, NULL, s);
+}
+
+/*
+  Update function when there is no key
+*/
+void
+Hacl_Streaming_Blake2p_256_blake2bp_256_no_key_update(
+  Hacl_Streaming_Blake2p_256_blake2bp_256_state *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  Hacl_Streaming_Blake2p_256_blake2bp_256_with_key_update((uint32_t)0U, p, data, len);
+}
+
+/*
+  Finish function when there is no key
+*/
+void
+Hacl_Streaming_Blake2p_256_blake2bp_256_no_key_finish(
+  Hacl_Streaming_Blake2p_256_blake2bp_256_state *p,
+  uint8_t *dst
+)
+{
+  Hacl_Streaming_Blake2p_256_blake2bp_256_with_key_finish((uint32_t)0U, p, dst);
+}
+
+/*
+  Free state function when there is no key
+*/
+void
+Hacl_Streaming_Blake2p_256_blake2bp_256_no_key_free(
+  Hacl_Streaming_Blake2p_256_blake2bp_256_state *s
+)
+{
+  Hacl_Streaming_Blake2p_256_blake2bp_256_with_key_free((uint32_t)0U, s);
+}
+
+/*
+  State allocation function when using a (potentially null) key
+*/
+Hacl_Streaming_Blake2p_256_blake2bp_256_state
+*Hacl_Streaming_Blake2p_256_blake2bp_256_with_key_create_in(uint32_t key_size, uint8_t *k)
+{
+  uint8_t *buf = KRML_HOST_CALLOC((uint32_t)1024U, sizeof (uint8_t));
+  uint8_t *block_state = KRML_HOST_CALLOC((uint32_t)256U, sizeof (uint8_t));
+  Hacl_Streaming_Blake2p_256_blake2bp_256_state
+  s = { .block_state = block_state, .buf = buf, .total_len = (uint64_t)0U };
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_Blake2p_256_blake2bp_256_state), (uint32_t)1U);
+  Hacl_Streaming_Blake2p_256_blake2bp_256_state
+  *p = KRML_HOST_MALLOC(sizeof (Hacl_Streaming_Blake2p_256_blake2bp_256_state));
+  p[0U] = s;
+  Hacl_Streaming_Blake2p_256_blake2bp_256_with_key_init(key_size, k, p);
+  return p;
+}
+
+/*
+  (Re-)initialization function when using a (potentially null) key
+*/
+void
+Hacl_Streaming_Blake2p_256_blake2bp_256_with_key_init(
+  uint32_t key_size,
+  uint8_t *k,
+  Hacl_Streaming_Blake2p_256_blake2bp_256_state *s
+)
+{
+  Hacl_Streaming_Blake2p_256_blake2bp_256_state scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint8_t *block_state = scrut.block_state;
+  Lib_IntVector_Intrinsics_vec256 st[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    st[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  Hacl_Blake2bp_256_blake2bp_init(st, key_size, (uint32_t)64U);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256_store_le(block_state + i * (uint32_t)32U, st[i]);
+  }
+  uint64_t total_len;
+  if (key_size == (uint32_t)0U)
+  {
+    total_len = (uint64_t)0U;
+  }
+  else
+  {
+    memset(buf, 0U, (uint32_t)512U * sizeof (uint8_t));
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      memcpy(buf + i * (uint32_t)128U, k, key_size * sizeof (uint8_t));
+    }
+    total_len = (uint64_t)(uint32_t)512U;
+  }
+  s[0U] =
+    (
+      (Hacl_Streaming_Blake2p_256_blake2bp_256_state){
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = total_len
+      }
+    );
+}
+
+/*
+  Update function when using a (potentially null) key
+*/
+void
+Hacl_Streaming_Blake2p_256_blake2bp_256_with_key_update(
+  uint32_t key_size,
+  Hacl_Streaming_Blake2p_256_blake2bp_256_state *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  Hacl_Streaming_Blake2p_256_blake2bp_256_state s = *p;
+  uint8_t *block_state = s.block_state;
+  uint8_t *buf = s.buf;
+  uint64_t total_len = s.total_len;
+  uint32_t sz;
+  uint64_t prev;
+  if (total_len < (uint64_t)(uint32_t)512U)
+  {
+    sz = (uint32_t)total_len;
+    prev = (uint64_t)0U;
+  }
+  else
+  {
+    sz = (uint32_t)512U + (uint32_t)(total_len % (uint64_t)(uint32_t)512U);
+    prev = (total_len / (uint64_t)(uint32_t)512U - (uint64_t)1U) * (uint64_t)(uint32_t)128U;
+  }
+  if (len < (uint32_t)1024U - sz)
+  {
+    memcpy(buf + sz, data, len * sizeof (uint8_t));
+  }
+  else
+  {
+    uint32_t diff = (uint32_t)1024U - sz;
+    uint8_t *data1 = data + diff;
+    uint32_t len1 = len - diff;
+    memcpy(buf + sz, data, diff * sizeof (uint8_t));
+    Lib_IntVector_Intrinsics_vec256 st[8U];
+    for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+      st[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      Lib_IntVector_Intrinsics_vec256
+      x = Lib_IntVector_Intrinsics_vec256_load_le(block_state + i * (uint32_t)32U);
+      st[i] = x;
+    }
+    Hacl_Blake2bp_256_blake2bp_update_multi(st, prev, buf, (uint32_t)1U);
+    if (len1 < (uint32_t)512U)
+    {
+      memcpy(buf, buf + (uint32_t)512U, (uint32_t)512U * sizeof (uint8_t));
+      memcpy(buf + (uint32_t)512U, data1, len1 * sizeof (uint8_t));
+    }
+    else
+    {
+      Hacl_Blake2bp_256_blake2bp_update_multi(st,
+        prev + (uint64_t)(uint32_t)128U,
+        buf + (uint32_t)512U,
+        (uint32_t)1U);
+      uint32_t nb = len1 / (uint32_t)512U - (uint32_t)1U;
+      Hacl_Blake2bp_256_blake2bp_update_multi(st, prev + (uint64_t)(uint32_t)256U, data1, nb);
+      memcpy(buf,
+        data1 + nb * (uint32_t)512U,
+        (len1 - nb * (uint32_t)512U) * sizeof (uint8_t));
+    }
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      Lib_IntVector_Intrinsics_vec256_store_le(block_state + i * (uint32_t)32U, st[i]);
+    }
+  }
+  p[0U] =
+    (
+      (Hacl_Streaming_Blake2p_256_blake2bp_256_state){
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = total_len + (uint64_t)len
+      }
+    );
+}
+
+/*
+  Finish function when using a (potentially null) key
+*/
+void
+Hacl_Streaming_Blake2p_256_blake2bp_256_with_key_finish(
+  uint32_t key_size,
+  Hacl_Streaming_Blake2p_256_blake2bp_256_state *p,
+  uint8_t *dst
+)
+{
+  Hacl_Streaming_Blake2p_256_blake2bp_256_state scrut = *p;
+  uint8_t *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  uint64_t prev;
+  if (total_len < (uint64_t)(uint32_t)512U)
+  {
+    r = (uint32_t)total_len;
+    prev = (uint64_t)0U;
+  }
+  else
+  {
+    r = (uint32_t)512U + (uint32_t)(total_len % (uint64_t)(uint32_t)512U);
+    prev = (total_len / (uint64_t)(uint32_t)512U - (uint64_t)1U) * (uint64_t)(uint32_t)128U;
+  }
+  Lib_IntVector_Intrinsics_vec256 st[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    st[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    x = Lib_IntVector_Intrinsics_vec256_load_le(block_state + i * (uint32_t)32U);
+    st[i] = x;
+  }
+  Hacl_Blake2bp_256_blake2bp_update_last(st, prev, r, buf_);
+  Hacl_Blake2bp_256_blake2bp_finish((uint32_t)64U, dst, key_size, st);
+}
+
+/*
+  Free state function when using a (potentially null) key
+*/
+void
+Hacl_Streaming_Blake2p_256_blake2bp_256_with_key_free(
+  uint32_t key_size,
+  Hacl_Streaming_Blake2p_256_blake2bp_256_state *s
+)
+{
+  Hacl_Streaming_Blake2p_256_blake2bp_256_state scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint8_t *block_state = scrut.block_state;
+  KRML_HOST_FREE(block_state);
+  KRML_HOST_FREE(buf);
+  KRML_HOST_FREE(s);
+}
+
+/*
+  State allocation function when there is no key
+*/
+Hacl_Streaming_Blake2p_256_blake2sp_256_state
+*Hacl_Streaming_Blake2p_256_blake2sp_256_no_key_create_in()
+{
+  return Hacl_Streaming_Blake2p_256_blake2sp_256_with_key_create_in((uint32_t)0U, NULL);
+}
+
+/*
+  (Re-)initialization function when there is no key
+*/
+void
+Hacl_Streaming_Blake2p_256_blake2sp_256_no_key_init(
+  Hacl_Streaming_Blake2p_256_blake2sp_256_state *s
+)
+{
+  Hacl_Streaming_Blake2p_256_blake2sp_256_with_key_init((uint32_t)0U, NULL, s);
+}
+
+/*
+  Update function when there is no key
+*/
+void
+Hacl_Streaming_Blake2p_256_blake2sp_256_no_key_update(
+  Hacl_Streaming_Blake2p_256_blake2sp_256_state *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  Hacl_Streaming_Blake2p_256_blake2sp_256_with_key_update((uint32_t)0U, p, data, len);
+}
+
+/*
+  Finish function when there is no key
+*/
+void
+Hacl_Streaming_Blake2p_256_blake2sp_256_no_key_finish(
+  Hacl_Streaming_Blake2p_256_blake2sp_256_state *p,
+  uint8_t *dst
+)
+{
+  Hacl_Streaming_Blake2p_256_blake2sp_256_with_key_finish((uint32_t)0U, p, dst);
+}
+
+/*
+  Free state function when there is no key
+*/
+void
+Hacl_Streaming_Blake2p_256_blake2sp_256_no_key_free(
+  Hacl_Streaming_Blake2p_256_blake2sp_256_state *s
+)
+{
+  Hacl_Streaming_Blake2p_256_blake2sp_256_with_key_free((uint32_t)0U, s);
+}
+
+/*
+  State allocation function when using a (potentially null) key
+*/
+Hacl_Streaming_Blake2p_256_blake2sp_256_state
+*Hacl_Streaming_Blake2p_256_blake2sp_256_with_key_create_in(uint32_t key_size, uint8_t *k)
+{
+  uint8_t *buf = KRML_HOST_CALLOC((uint32_t)1024U, sizeof (uint8_t));
+  uint8_t *block_state = KRML_HOST_CALLOC((uint32_t)256U, sizeof (uint8_t));
+  Hacl_Streaming_Blake2p_256_blake2sp_256_state
+  s = { .block_state = block_state, .buf = buf, .total_len = (uint64_t)0U };
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_Blake2p_256_blake2sp_256_state), (uint32_t)1U);
+  Hacl_Streaming_Blake2p_256_blake2sp_256_state
+  *p = KRML_HOST_MALLOC(sizeof (Hacl_Streaming_Blake2p_256_blake2sp_256_state));
+  p[0U] = s;
+  Hacl_Streaming_Blake2p_256_blake2sp_256_with_key_init(key_size, k, p);
+  return p;
+}
+
+/*
+  (Re-)initialization function when using a (potentially null) key
+*/
+void
+Hacl_Streaming_Blake2p_256_blake2sp_256_with_key_init(
+  uint32_t key_size,
+  uint8_t *k,
+  Hacl_Streaming_Blake2p_256_blake2sp_256_state *s
+)
+{
+  Hacl_Streaming_Blake2p_256_blake2sp_256_state scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint8_t *block_state = scrut.block_state;
+  Lib_IntVector_Intrinsics_vec256 st[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    st[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  Hacl_Blake2sp_256_blake2sp_init(st, key_size, (uint32_t)32U);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256_store_le(block_state + i * (uint32_t)32U, st[i]);
+  }
+  uint64_t total_len;
+  if (key_size == (uint32_t)0U)
+  {
+    total_len = (uint64_t)0U;
+  }
+  else
+  {
+    memset(buf, 0U, (uint32_t)512U * sizeof (uint8_t));
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      memcpy(buf + i * (uint32_t)64U, k, key_size * sizeof (uint8_t));
+    }
+    total_len = (uint64_t)(uint32_t)512U;
+  }
+  s[0U] =
+    (
+      (Hacl_Streaming_Blake2p_256_blake2sp_256_state){
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = total_len
+      }
+    );
+}
+
+/*
+  Update function when using a (potentially null) key
+*/
+void
+Hacl_Streaming_Blake2p_256_blake2sp_256_with_key_update(
+  uint32_t key_size,
+  Hacl_Streaming_Blake2p_256_blake2sp_256_state *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  Hacl_Streaming_Blake2p_256_blake2sp_256_state s = *p;
+  uint8_t *block_state = s.block_state;
+  uint8_t *buf = s.buf;
+  uint64_t total_len = s.total_len;
+  uint32_t sz;
+  uint64_t prev;
+  if (total_len < (uint64_t)(uint32_t)512U)
+  {
+    sz = (uint32_t)total_len;
+    prev = (uint64_t)0U;
+  }
+  else
+  {
+    sz = (uint32_t)512U + (uint32_t)(total_len % (uint64_t)(uint32_t)512U);
+    prev = (total_len / (uint64_t)(uint32_t)512U - (uint64_t)1U) * (uint64_t)(uint32_t)64U;
+  }
+  if (len < (uint32_t)1024U - sz)
+  {
+    memcpy(buf + sz, data, len * sizeof (uint8_t));
+  }
+  else
+  {
+    uint32_t diff = (uint32_t)1024U - sz;
+    uint8_t *data1 = data + diff;
+    uint32_t len1 = len - diff;
+    memcpy(buf + sz, data, diff * sizeof (uint8_t));
+    Lib_IntVector_Intrinsics_vec256 st[8U];
+    for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+      st[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      Lib_IntVector_Intrinsics_vec256
+      x = Lib_IntVector_Intrinsics_vec256_load_le(block_state + i * (uint32_t)32U);
+      st[i] = x;
+    }
+    Hacl_Blake2sp_256_blake2sp_update_multi(st, prev, buf, (uint32_t)1U);
+    if (len1 < (uint32_t)512U)
+    {
+      memcpy(buf, buf + (uint32_t)512U, (uint32_t)512U * sizeof (uint8_t));
+      memcpy(buf + (uint32_t)512U, data1, len1 * sizeof (uint8_t));
+    }
+    else
+    {
+      Hacl_Blake2sp_256_blake2sp_update_multi(st,
+        prev + (uint64_t)(uint32_t)64U,
+        buf + (uint32_t)512U,
+        (uint32_t)1U);
+      uint32_t nb = len1 / (uint32_t)512U - (uint32_t)1U;
+      Hacl_Blake2sp_256_blake2sp_update_multi(st, prev + (uint64_t)(uint32_t)128U, data1, nb);
+      memcpy(buf,
+        data1 + nb * (uint32_t)512U,
+        (len1 - nb * (uint32_t)512U) * sizeof (uint8_t));
+    }
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      Lib_IntVector_Intrinsics_vec256_store_le(block_state + i * (uint32_t)32U, st[i]);
+    }
+  }
+  p[0U] =
+    (
+      (Hacl_Streaming_Blake2p_256_blake2sp_256_state){
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = total_len + (uint64_t)len
+      }
+    );
+}
+
+/*
+  Finish function when using a (potentially null) key
+*/
+void
+Hacl_Streaming_Blake2p_256_blake2sp_256_with_key_finish(
+  uint32_t key_size,
+  Hacl_Streaming_Blake2p_256_blake2sp_256_state *p,
+  uint8_t *dst
+)
+{
+  Hacl_Streaming_Blake2p_256_blake2sp_256_state scrut = *p;
+  uint8_t *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  uint64_t prev;
+  if (total_len < (uint64_t)(uint32_t)512U)
+  {
+    r = (uint32_t)total_len;
+    prev = (uint64_t)0U;
+  }
+  else
+  {
+    r = (uint32_t)512U + (uint32_t)(total_len % (uint64_t)(uint32_t)512U);
+    prev = (total_len / (uint64_t)(uint32_t)512U - (uint64_t)1U) * (uint64_t)(uint32_t)64U;
+  }
+  Lib_IntVector_Intrinsics_vec256 st[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    st[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    x = Lib_IntVector_Intrinsics_vec256_load_le(block_state + i * (uint32_t)32U);
+    st[i] = x;
+  }
+  Hacl_Blake2sp_256_blake2sp_update_last(st, prev, r, buf_);
+  Hacl_Blake2sp_256_blake2sp_finish((uint32_t)32U, dst, key_size, st);
+}
+
+/*
+  Free state function when using a (potentially null) key
+*/
+void
+Hacl_Streaming_Blake2p_256_blake2sp_256_with_key_free(
+  uint32_t key_size,
+  Hacl_Streaming_Blake2p_256_blake2sp_256_state *s
+)
+{
+  Hacl_Streaming_Blake2p_256_blake2sp_256_state scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint8_t *block_state = scrut.block_state;
+  KRML_HOST_FREE(block_state);
+  KRML_HOST_FREE(buf);
+  KRML_HOST_FREE(s);
+}
+
@@ -0,0 +1,516 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Streaming_Blake3.h"
+
+static void blake3_chunk_output(Hacl_Streaming_Blake3_blake3_state s, uint32_t *node, uint8_t *block)
+{
+  memcpy(node, s.cv, (uint32_t)8U * sizeof (uint32_t));
+  memcpy(block, s.buf, (uint32_t)64U * sizeof (uint8_t));
+  uint32_t start;
+  if (s.blocks_compressed == (uint32_t)0U)
+  {
+    start = (uint32_t)1U;
+  }
+  else
+  {
+    start = (uint32_t)0U;
+  }
+  node[8U] = (uint32_t)s.chunk_counter;
+  node[9U] = (uint32_t)(s.chunk_counter >> (uint32_t)32U);
+  node[10U] = s.buf_len;
+  node[11U] = s.flags | start | (uint32_t)2U;
+}
+
+static void blake3_push_cv(Hacl_Streaming_Blake3_blake3_state *p, uint8_t *cv, uint64_t chunk_counter)
+{
+  Hacl_Streaming_Blake3_blake3_state s = *p;
+  uint32_t post_merge[1U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+  {
+    uint64_t bit = chunk_counter >> i & (uint64_t)1U;
+    post_merge[0U] = post_merge[0U] + (uint32_t)bit;
+  }
+  uint32_t pm = post_merge[0U];
+  uint32_t len[1U] = { s.cv_stack_len };
+  while (len[0U] > pm && len[0U] >= (uint32_t)2U)
+  {
+    uint32_t l = len[0U];
+    uint32_t node[12U] = { 0U };
+    uint8_t block[64U] = { 0U };
+    uint8_t *top = s.cv_stack + (l - (uint32_t)2U) * (uint32_t)32U;
+    Hacl_Blake3_32_parent_node(s.key, s.flags, top, node, block);
+    Hacl_Blake3_32_node_cv(node, block, top);
+    len[0U] = l - (uint32_t)1U;
+  }
+  uint32_t l = len[0U];
+  if (!(cv == NULL) && l < (uint32_t)55U)
+  {
+    memcpy(s.cv_stack + l * (uint32_t)32U, cv, (uint32_t)32U * sizeof (uint8_t));
+    p->cv_stack_len = l + (uint32_t)1U;
+  }
+  else
+  {
+    p->cv_stack_len = l;
+  }
+}
+
+static void blake3_chunk_update(Hacl_Streaming_Blake3_blake3_state *p, uint8_t *data, uint32_t len)
+{
+  Hacl_Streaming_Blake3_blake3_state s = *p;
+  uint32_t bl = s.buf_len;
+  uint32_t take;
+  if (bl > (uint32_t)0U)
+  {
+    if ((uint32_t)64U - bl < len)
+    {
+      take = (uint32_t)64U - bl;
+    }
+    else
+    {
+      take = len;
+    }
+  }
+  else
+  {
+    take = (uint32_t)0U;
+  }
+  memcpy(s.buf + bl, data, take * sizeof (uint8_t));
+  uint32_t rest = len - take;
+  bool flush = bl > (uint32_t)0U && rest > (uint32_t)0U;
+  if (flush)
+  {
+    uint32_t start;
+    if (s.blocks_compressed == (uint32_t)0U)
+    {
+      start = (uint32_t)1U;
+    }
+    else
+    {
+      start = (uint32_t)0U;
+    }
+    Hacl_Blake3_32_compress_in_place(s.cv, s.buf, (uint32_t)64U, s.chunk_counter, s.flags | start);
+    memset(s.buf, 0U, (uint32_t)64U * sizeof (uint8_t));
+  }
+  uint32_t bc;
+  if (flush)
+  {
+    bc = s.blocks_compressed + (uint32_t)1U;
+  }
+  else
+  {
+    bc = s.blocks_compressed;
+  }
+  uint32_t bl1;
+  if (flush)
+  {
+    bl1 = (uint32_t)0U;
+  }
+  else
+  {
+    bl1 = bl + take;
+  }
+  uint32_t nb;
+  if (rest == (uint32_t)0U)
+  {
+    nb = (uint32_t)0U;
+  }
+  else
+  {
+    nb = (rest - (uint32_t)1U) / (uint32_t)64U;
+  }
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    uint32_t start;
+    if (bc + i == (uint32_t)0U)
+    {
+      start = (uint32_t)1U;
+    }
+    else
+    {
+      start = (uint32_t)0U;
+    }
+    Hacl_Blake3_32_compress_in_place(s.cv,
+      data + take + i * (uint32_t)64U,
+      (uint32_t)64U,
+      s.chunk_counter,
+      s.flags | start);
+  }
+  uint32_t l = rest - nb * (uint32_t)64U;
+  memcpy(s.buf + bl1, data + take + nb * (uint32_t)64U, l * sizeof (uint8_t));
+  p->buf_len = bl1 + l;
+  p->blocks_compressed = bc + nb;
+}
+
+static void blake3_chunk_reset(Hacl_Streaming_Blake3_blake3_state *p, uint64_t chunk_counter)
+{
+  Hacl_Streaming_Blake3_blake3_state s = *p;
+  memcpy(s.cv, s.key, (uint32_t)8U * sizeof (uint32_t));
+  memset(s.buf, 0U, (uint32_t)64U * sizeof (uint8_t));
+  p->chunk_counter = chunk_counter;
+  p->buf_len = (uint32_t)0U;
+  p->blocks_compressed = (uint32_t)0U;
+}
+
+static Hacl_Streaming_Blake3_blake3_state *blake3_alloc(uint32_t *key, uint32_t flags)
+{
+  uint32_t *k = (uint32_t *)KRML_HOST_CALLOC((uint32_t)8U, sizeof (uint32_t));
+  memcpy(k, key, (uint32_t)8U * sizeof (uint32_t));
+  uint32_t *cv = (uint32_t *)KRML_HOST_CALLOC((uint32_t)8U, sizeof (uint32_t));
+  memcpy(cv, key, (uint32_t)8U * sizeof (uint32_t));
+  uint8_t *buf = (uint8_t *)KRML_HOST_CALLOC((uint32_t)64U, sizeof (uint8_t));
+  uint8_t *cv_stack = (uint8_t *)KRML_HOST_CALLOC((uint32_t)1760U, sizeof (uint8_t));
+  Hacl_Streaming_Blake3_blake3_state
+  s =
+    {
+      .key = k, .cv = cv, .buf = buf, .cv_stack = cv_stack, .flags = flags,
+      .chunk_counter = (uint64_t)0U, .buf_len = (uint32_t)0U, .blocks_compressed = (uint32_t)0U,
+      .cv_stack_len = (uint32_t)0U
+    };
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_Blake3_blake3_state), (uint32_t)1U);
+  Hacl_Streaming_Blake3_blake3_state *p = (Hacl_Streaming_Blake3_blake3_state *)KRML_HOST_MALLOC(sizeof (Hacl_Streaming_Blake3_blake3_state));
+  p[0U] = s;
+  return p;
+}
+
+void
+Hacl_Streaming_Blake3_update_with(
+  void
+  (*subtree)(
+    uint32_t x0,
+    uint8_t *x1,
+    uint32_t *x2,
+    uint64_t x3,
+    uint32_t x4,
+    uint8_t *x5
+  ),
+  Hacl_Streaming_Blake3_blake3_state *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  uint32_t pos[1U] = { 0U };
+  Hacl_Streaming_Blake3_blake3_state s0 = *p;
+  uint32_t chunk_len = s0.blocks_compressed * (uint32_t)64U + s0.buf_len;
+  if (chunk_len > (uint32_t)0U)
+  {
+    uint32_t take;
+    if ((uint32_t)1024U - chunk_len < len)
+    {
+      take = (uint32_t)1024U - chunk_len;
+    }
+    else
+    {
+      take = len;
+    }
+    blake3_chunk_update(p, data, take);
+    pos[0U] = take;
+    if (take < len)
+    {
+      Hacl_Streaming_Blake3_blake3_state s = *p;
+      uint32_t node[12U] = { 0U };
+      uint8_t block[64U] = { 0U };
+      uint8_t cv[32U] = { 0U };
+      blake3_chunk_output(s, node, block);
+      Hacl_Blake3_32_node_cv(node, block, cv);
+      blake3_push_cv(p, cv, s.chunk_counter);
+      blake3_chunk_reset(p, s.chunk_counter + (uint64_t)1U);
+    }
+  }
+  while (len - pos[0U] > (uint32_t)1024U)
+  {
+    Hacl_Streaming_Blake3_blake3_state s = *p;
+    uint32_t l = len - pos[0U];
+    uint8_t *d = data + pos[0U];
+    uint32_t subtree_len[1U] = { 1024U };
+    while (subtree_len[0U] <= l / (uint32_t)2U)
+    {
+      subtree_len[0U] = subtree_len[0U] * (uint32_t)2U;
+    }
+    uint64_t count_so_far = s.chunk_counter * (uint64_t)1024U;
+    while
+    (
+      subtree_len[0U]
+      > (uint32_t)1024U
+      && ((uint64_t)(subtree_len[0U] - (uint32_t)1U) & count_so_far) != (uint64_t)0U
+    )
+    {
+      subtree_len[0U] = subtree_len[0U] / (uint32_t)2U;
+    }
+    uint32_t sl = subtree_len[0U];
+    uint64_t subtree_chunks = (uint64_t)(sl / (uint32_t)1024U);
+    if (sl <= (uint32_t)1024U)
+    {
+      uint32_t node[12U] = { 0U };
+      uint8_t block[64U] = { 0U };
+      uint8_t cv[32U] = { 0U };
+      Hacl_Blake3_32_chunk_node(s.key, s.chunk_counter, s.flags, sl, d, node, block);
+      Hacl_Blake3_32_node_cv(node, block, cv);
+      blake3_push_cv(p, cv, s.chunk_counter);
+    }
+    else
+    {
+      uint8_t cvs[64U] = { 0U };
+      subtree(sl, d, s.key, s.chunk_counter, s.flags, cvs);
+      blake3_push_cv(p, cvs, s.chunk_counter);
+      blake3_push_cv(p, cvs + (uint32_t)32U, s.chunk_counter + (subtree_chunks >> (uint32_t)1U));
+    }
+    p->chunk_counter = s.chunk_counter + subtree_chunks;
+    pos[0U] = pos[0U] + sl;
+  }
+  uint32_t l = len - pos[0U];
+  if (l > (uint32_t)0U)
+  {
+    blake3_chunk_update(p, data + pos[0U], l);
+    Hacl_Streaming_Blake3_blake3_state s = *p;
+    blake3_push_cv(p, NULL, s.chunk_counter);
+  }
+}
+
+void
+Hacl_Streaming_Blake3_update_mt_with(
+  void
+  (*subtree_mt)(
+    void (*x0)(void *x0, void (*x1)(void *x0), void *x2, void *x3),
+    void *x1,
+    uint32_t x2,
+    uint8_t *x3,
+    uint32_t *x4,
+    uint64_t x5,
+    uint32_t x6,
+    uint8_t *x7
+  ),
+  void (*join)(void *x0, void (*x1)(void *x0), void *x2, void *x3),
+  void *pool,
+  Hacl_Streaming_Blake3_blake3_state *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  uint32_t pos[1U] = { 0U };
+  Hacl_Streaming_Blake3_blake3_state s0 = *p;
+  uint32_t chunk_len = s0.blocks_compressed * (uint32_t)64U + s0.buf_len;
+  if (chunk_len > (uint32_t)0U)
+  {
+    uint32_t take;
+    if ((uint32_t)1024U - chunk_len < len)
+    {
+      take = (uint32_t)1024U - chunk_len;
+    }
+    else
+    {
+      take = len;
+    }
+    blake3_chunk_update(p, data, take);
+    pos[0U] = take;
+    if (take < len)
+    {
+      Hacl_Streaming_Blake3_blake3_state s = *p;
+      uint32_t node[12U] = { 0U };
+      uint8_t block[64U] = { 0U };
+      uint8_t cv[32U] = { 0U };
+      blake3_chunk_output(s, node, block);
+      Hacl_Blake3_32_node_cv(node, block, cv);
+      blake3_push_cv(p, cv, s.chunk_counter);
+      blake3_chunk_reset(p, s.chunk_counter + (uint64_t)1U);
+    }
+  }
+  while (len - pos[0U] > (uint32_t)1024U)
+  {
+    Hacl_Streaming_Blake3_blake3_state s = *p;
+    uint32_t l = len - pos[0U];
+    uint8_t *d = data + pos[0U];
+    uint32_t subtree_len[1U] = { 1024U };
+    while (subtree_len[0U] <= l / (uint32_t)2U)
+    {
+      subtree_len[0U] = subtree_len[0U] * (uint32_t)2U;
+    }
+    uint64_t count_so_far = s.chunk_counter * (uint64_t)1024U;
+    while
+    (
+      subtree_len[0U]
+      > (uint32_t)1024U
+      && ((uint64_t)(subtree_len[0U] - (uint32_t)1U) & count_so_far) != (uint64_t)0U
+    )
+    {
+      subtree_len[0U] = subtree_len[0U] / (uint32_t)2U;
+    }
+    uint32_t sl = subtree_len[0U];
+    uint64_t subtree_chunks = (uint64_t)(sl / (uint32_t)1024U);
+    if (sl <= (uint32_t)1024U)
+    {
+      uint32_t node[12U] = { 0U };
+      uint8_t block[64U] = { 0U };
+      uint8_t cv[32U] = { 0U };
+      Hacl_Blake3_32_chunk_node(s.key, s.chunk_counter, s.flags, sl, d, node, block);
+      Hacl_Blake3_32_node_cv(node, block, cv);
+      blake3_push_cv(p, cv, s.chunk_counter);
+    }
+    else
+    {
+      uint8_t cvs[64U] = { 0U };
+      subtree_mt(join, pool, sl, d, s.key, s.chunk_counter, s.flags, cvs);
+      blake3_push_cv(p, cvs, s.chunk_counter);
+      blake3_push_cv(p, cvs + (uint32_t)32U, s.chunk_counter + (subtree_chunks >> (uint32_t)1U));
+    }
+    p->chunk_counter = s.chunk_counter + subtree_chunks;
+    pos[0U] = pos[0U] + sl;
+  }
+  uint32_t l = len - pos[0U];
+  if (l > (uint32_t)0U)
+  {
+    blake3_chunk_update(p, data + pos[0U], l);
+    Hacl_Streaming_Blake3_blake3_state s = *p;
+    blake3_push_cv(p, NULL, s.chunk_counter);
+  }
+}
+
+void Hacl_Streaming_Blake3_blake3_32_finish(Hacl_Streaming_Blake3_blake3_state *p, uint8_t *dst, uint32_t dst_len)
+{
+  Hacl_Streaming_Blake3_blake3_state s = *p;
+  uint32_t node[12U] = { 0U };
+  uint8_t block[64U] = { 0U };
+  uint32_t chunk_len = s.blocks_compressed * (uint32_t)64U + s.buf_len;
+  uint32_t remaining;
+  if (chunk_len > (uint32_t)0U || s.cv_stack_len < (uint32_t)2U)
+  {
+    blake3_chunk_output(s, node, block);
+    remaining = s.cv_stack_len;
+  }
+  else
+  {
+    uint32_t r = s.cv_stack_len - (uint32_t)2U;
+    Hacl_Blake3_32_parent_node(s.key, s.flags, s.cv_stack + r * (uint32_t)32U, node, block);
+    remaining = r;
+  }
+  for (uint32_t i = (uint32_t)0U; i < remaining; i++)
+  {
+    uint8_t cvs[64U] = { 0U };
+    memcpy(cvs,
+      s.cv_stack + (remaining - i - (uint32_t)1U) * (uint32_t)32U,
+      (uint32_t)32U * sizeof (uint8_t));
+    Hacl_Blake3_32_node_cv(node, block, cvs + (uint32_t)32U);
+    Hacl_Blake3_32_parent_node(s.key, s.flags, cvs, node, block);
+  }
+  Hacl_Blake3_32_node_root(node, block, dst_len, dst);
+}
+
+Hacl_Streaming_Blake3_blake3_state
+*Hacl_Streaming_Blake3_blake3_32_derive_key_create_in(uint32_t context_len, uint8_t *context)
+{
+  uint32_t iv[8U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    iv[i] = Hacl_Impl_Blake2_Constants_ivTable_S[i];
+  }
+  uint8_t context_key[32U] = { 0U };
+  Hacl_Streaming_Blake3_blake3_state *p = blake3_alloc(iv, (uint32_t)32U);
+  Hacl_Streaming_Blake3_update_with(Hacl_Blake3_32_compress_subtree_to_parent_node, p, context, context_len);
+  Hacl_Streaming_Blake3_blake3_32_finish(p, context_key, (uint32_t)32U);
+  Hacl_Streaming_Blake3_blake3_state s = *p;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint32_t *os = s.key;
+    uint8_t *bj = context_key + i * (uint32_t)4U;
+    uint32_t u = load32_le(bj);
+    uint32_t r = u;
+    uint32_t x = r;
+    os[i] = x;
+  }
+  Lib_Memzero0_memzero(context_key, (uint32_t)32U * sizeof (context_key[0U]));
+  p->flags = (uint32_t)64U;
+  p->cv_stack_len = (uint32_t)0U;
+  blake3_chunk_reset(p, (uint64_t)0U);
+  return p;
+}
+
+Hacl_Streaming_Blake3_blake3_state *Hacl_Streaming_Blake3_blake3_32_keyed_create_in(uint8_t *key)
+{
+  uint32_t k[8U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint32_t *os = k;
+    uint8_t *bj = key + i * (uint32_t)4U;
+    uint32_t u = load32_le(bj);
+    uint32_t r = u;
+    uint32_t x = r;
+    os[i] = x;
+  }
+  Hacl_Streaming_Blake3_blake3_state *p = blake3_alloc(k, (uint32_t)16U);
+  Lib_Memzero0_memzero(k, (uint32_t)8U * sizeof (k[0U]));
+  return p;
+}
+
+void Hacl_Streaming_Blake3_blake3_32_init(Hacl_Streaming_Blake3_blake3_state *s)
+{
+  s->cv_stack_len = (uint32_t)0U;
+  blake3_chunk_reset(s, (uint64_t)0U);
+}
+
+void Hacl_Streaming_Blake3_blake3_32_free(Hacl_Streaming_Blake3_blake3_state *s)
+{
+  Hacl_Streaming_Blake3_blake3_state scrut = *s;
+  Lib_Memzero0_memzero(scrut.key, (uint32_t)8U * sizeof (scrut.key[0U]));
+  Lib_Memzero0_memzero(scrut.cv, (uint32_t)8U * sizeof (scrut.cv[0U]));
+  Lib_Memzero0_memzero(scrut.buf, (uint32_t)64U * sizeof (scrut.buf[0U]));
+  Lib_Memzero0_memzero(scrut.cv_stack, (uint32_t)1760U * sizeof (scrut.cv_stack[0U]));
+  KRML_HOST_FREE(scrut.key);
+  KRML_HOST_FREE(scrut.cv);
+  KRML_HOST_FREE(scrut.buf);
+  KRML_HOST_FREE(scrut.cv_stack);
+  KRML_HOST_FREE(s);
+}
+
+Hacl_Streaming_Blake3_blake3_state *Hacl_Streaming_Blake3_blake3_32_create_in()
+{
+  uint32_t iv[8U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    iv[i] = Hacl_Impl_Blake2_Constants_ivTable_S[i];
+  }
+  Hacl_Streaming_Blake3_blake3_state *p = blake3_alloc(iv, (uint32_t)0U);
+  return p;
+}
+
+void Hacl_Streaming_Blake3_blake3_32_update(Hacl_Streaming_Blake3_blake3_state *p, uint8_t *data, uint32_t len)
+{
+  Hacl_Streaming_Blake3_update_with(Hacl_Blake3_32_compress_subtree_to_parent_node, p, data, len);
+}
+
+void
+Hacl_Streaming_Blake3_blake3_32_update_mt(
+  void (*join)(void *x0, void (*x1)(void *x0), void *x2, void *x3),
+  void *pool,
+  Hacl_Streaming_Blake3_blake3_state *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  Hacl_Streaming_Blake3_update_mt_with(Hacl_Blake3_32_compress_subtree_to_parent_node_mt,
+    join,
+    pool,
+    p,
+    data,
+    len);
+}
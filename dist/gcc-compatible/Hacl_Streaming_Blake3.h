@@ -0,0 +1,171 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_Streaming_Blake3_H
+#define __Hacl_Streaming_Blake3_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Blake3_32.h"
+#include "Lib_Memzero0.h"
+#include "Hacl_Impl_Blake2_Constants.h"
+
+typedef struct Hacl_Streaming_Blake3_blake3_state_s
+{
+  uint32_t *key;
+  uint32_t *cv;
+  uint8_t *buf;
+  uint8_t *cv_stack;
+  uint32_t flags;
+  uint64_t chunk_counter;
+  uint32_t buf_len;
+  uint32_t blocks_compressed;
+  uint32_t cv_stack_len;
+}
+Hacl_Streaming_Blake3_blake3_state;
+
+/*
+  Update function, with the subtree reduction of one of the Hacl_Blake3_*
+    modules (their compress_subtree_to_parent_node function)
+*/
+void
+Hacl_Streaming_Blake3_update_with(
+  void
+  (*subtree)(
+    uint32_t x0,
+    uint8_t *x1,
+    uint32_t *x2,
+    uint64_t x3,
+    uint32_t x4,
+    uint8_t *x5
+  ),
+  Hacl_Streaming_Blake3_blake3_state *p,
+  uint8_t *data,
+  uint32_t len
+);
+
+/*
+  Update function, with the multithreaded subtree reduction of one of the
+    Hacl_Blake3_* modules (their compress_subtree_to_parent_node_mt function)
+    and the pool that it hands the subtrees to
+*/
+void
+Hacl_Streaming_Blake3_update_mt_with(
+  void
+  (*subtree_mt)(
+    void (*x0)(void *x0, void (*x1)(void *x0), void *x2, void *x3),
+    void *x1,
+    uint32_t x2,
+    uint8_t *x3,
+    uint32_t *x4,
+    uint64_t x5,
+    uint32_t x6,
+    uint8_t *x7
+  ),
+  void (*join)(void *x0, void (*x1)(void *x0), void *x2, void *x3),
+  void *pool,
+  Hacl_Streaming_Blake3_blake3_state *p,
+  uint8_t *data,
+  uint32_t len
+);
+
+/*
+  State allocation function for the default hashing mode
+*/
+Hacl_Streaming_Blake3_blake3_state
+*Hacl_Streaming_Blake3_blake3_32_create_in();
+
+/*
+  State allocation function for the keyed hashing mode, with a 32-byte key
+*/
+Hacl_Streaming_Blake3_blake3_state
+*Hacl_Streaming_Blake3_blake3_32_keyed_create_in(uint8_t *key);
+
+/*
+  State allocation function for the key derivation mode, for the given context string
+*/
+Hacl_Streaming_Blake3_blake3_state
+*Hacl_Streaming_Blake3_blake3_32_derive_key_create_in(uint32_t context_len, uint8_t *context);
+
+/*
+  (Re-)initialization function, keeping the mode and key of the state
+*/
+void Hacl_Streaming_Blake3_blake3_32_init(Hacl_Streaming_Blake3_blake3_state *s);
+
+/*
+  Update function
+*/
+void
+Hacl_Streaming_Blake3_blake3_32_update(
+  Hacl_Streaming_Blake3_blake3_state *p,
+  uint8_t *data,
+  uint32_t len
+);
+
+/*
+  Update function, hashing the subtrees above 128 KiB on the threads of
+    pool; see Hacl_Blake3_32_hash_mt for the contract of join
+*/
+void
+Hacl_Streaming_Blake3_blake3_32_update_mt(
+  void (*join)(void *x0, void (*x1)(void *x0), void *x2, void *x3),
+  void *pool,
+  Hacl_Streaming_Blake3_blake3_state *p,
+  uint8_t *data,
+  uint32_t len
+);
+
+/*
+  Finish function: writes dst_len bytes of extendable output; the state is left
+    unchanged and can be updated further
+*/
+void
+Hacl_Streaming_Blake3_blake3_32_finish(
+  Hacl_Streaming_Blake3_blake3_state *p,
+  uint8_t *dst,
+  uint32_t dst_len
+);
+
+/*
+  Free state function
+*/
+void Hacl_Streaming_Blake3_blake3_32_free(Hacl_Streaming_Blake3_blake3_state *s);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Streaming_Blake3_H_DEFINED
+#endif
@@ -0,0 +1,111 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_Streaming_Blake3_128_H
+#define __Hacl_Streaming_Blake3_128_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Streaming_Blake3.h"
+#include "Hacl_Blake3_128.h"
+
+/*
+  State allocation function for the default hashing mode
+*/
+Hacl_Streaming_Blake3_blake3_state
+*Hacl_Streaming_Blake3_128_blake3_128_create_in();
+
+/*
+  State allocation function for the keyed hashing mode, with a 32-byte key
+*/
+Hacl_Streaming_Blake3_blake3_state
+*Hacl_Streaming_Blake3_128_blake3_128_keyed_create_in(uint8_t *key);
+
+/*
+  State allocation function for the key derivation mode, for the given context string
+*/
+Hacl_Streaming_Blake3_blake3_state
+*Hacl_Streaming_Blake3_128_blake3_128_derive_key_create_in(uint32_t context_len, uint8_t *context);
+
+/*
+  (Re-)initialization function, keeping the mode and key of the state
+*/
+void Hacl_Streaming_Blake3_128_blake3_128_init(Hacl_Streaming_Blake3_blake3_state *s);
+
+/*
+  Update function
+*/
+void
+Hacl_Streaming_Blake3_128_blake3_128_update(
+  Hacl_Streaming_Blake3_blake3_state *p,
+  uint8_t *data,
+  uint32_t len
+);
+
+/*
+  Update function, hashing the subtrees above 128 KiB on the threads of
+    pool; see Hacl_Blake3_128_hash_mt for the contract of join
+*/
+void
+Hacl_Streaming_Blake3_128_blake3_128_update_mt(
+  void (*join)(void *x0, void (*x1)(void *x0), void *x2, void *x3),
+  void *pool,
+  Hacl_Streaming_Blake3_blake3_state *p,
+  uint8_t *data,
+  uint32_t len
+);
+
+/*
+  Finish function: writes dst_len bytes of extendable output; the state is left
+    unchanged and can be updated further
+*/
+void
+Hacl_Streaming_Blake3_128_blake3_128_finish(
+  Hacl_Streaming_Blake3_blake3_state *p,
+  uint8_t *dst,
+  uint32_t dst_len
+);
+
+/*
+  Free state function
+*/
+void Hacl_Streaming_Blake3_128_blake3_128_free(Hacl_Streaming_Blake3_blake3_state *s);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Streaming_Blake3_128_H_DEFINED
+#endif
@@ -0,0 +1,78 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Streaming_Blake3_256.h"
+
+Hacl_Streaming_Blake3_blake3_state *Hacl_Streaming_Blake3_256_blake3_256_create_in()
+{
+  return Hacl_Streaming_Blake3_blake3_32_create_in();
+}
+
+Hacl_Streaming_Blake3_blake3_state *Hacl_Streaming_Blake3_256_blake3_256_keyed_create_in(uint8_t *key)
+{
+  return Hacl_Streaming_Blake3_blake3_32_keyed_create_in(key);
+}
+
+Hacl_Streaming_Blake3_blake3_state
+*Hacl_Streaming_Blake3_256_blake3_256_derive_key_create_in(uint32_t context_len, uint8_t *context)
+{
+  return Hacl_Streaming_Blake3_blake3_32_derive_key_create_in(context_len, context);
+}
+
+void Hacl_Streaming_Blake3_256_blake3_256_init(Hacl_Streaming_Blake3_blake3_state *s)
+{
+  Hacl_Streaming_Blake3_blake3_32_init(s);
+}
+
+void Hacl_Streaming_Blake3_256_blake3_256_update(Hacl_Streaming_Blake3_blake3_state *p, uint8_t *data, uint32_t len)
+{
+  Hacl_Streaming_Blake3_update_with(Hacl_Blake3_256_compress_subtree_to_parent_node, p, data, len);
+}
+
+void
+Hacl_Streaming_Blake3_256_blake3_256_update_mt(
+  void (*join)(void *x0, void (*x1)(void *x0), void *x2, void *x3),
+  void *pool,
+  Hacl_Streaming_Blake3_blake3_state *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  Hacl_Streaming_Blake3_update_mt_with(Hacl_Blake3_256_compress_subtree_to_parent_node_mt,
+    join,
+    pool,
+    p,
+    data,
+    len);
+}
+
+void Hacl_Streaming_Blake3_256_blake3_256_finish(Hacl_Streaming_Blake3_blake3_state *p, uint8_t *dst, uint32_t dst_len)
+{
+  Hacl_Streaming_Blake3_blake3_32_finish(p, dst, dst_len);
+}
+
+void Hacl_Streaming_Blake3_256_blake3_256_free(Hacl_Streaming_Blake3_blake3_state *s)
+{
+  Hacl_Streaming_Blake3_blake3_32_free(s);
+}
@@ -0,0 +1,1668 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Streaming_SHA3.h"
+
+Hacl_Streaming_SHA3_state_sha3_224 *Hacl_Streaming_SHA3_create_in_224()
+{
+  uint8_t *buf = KRML_HOST_CALLOC((uint32_t)144U, sizeof (uint8_t));
+  uint64_t *block_state = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+  Hacl_Streaming_SHA3_state_sha3_224
+  s = { .block_state = block_state, .buf = buf, .total_len = (uint64_t)0U };
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_SHA3_state_sha3_224), (uint32_t)1U);
+  Hacl_Streaming_SHA3_state_sha3_224
+  *p = KRML_HOST_MALLOC(sizeof (Hacl_Streaming_SHA3_state_sha3_224));
+  p[0U] = s;
+  memset(block_state, 0U, (uint32_t)25U * sizeof (uint64_t));
+  return p;
+}
+
+void Hacl_Streaming_SHA3_init_224(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint64_t *block_state = scrut.block_state;
+  memset(block_state, 0U, (uint32_t)25U * sizeof (uint64_t));
+  s[0U] =
+    (
+      (Hacl_Streaming_SHA3_state_sha3_224){
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = (uint64_t)0U
+      }
+    );
+}
+
+void
+Hacl_Streaming_SHA3_update_224(
+  Hacl_Streaming_SHA3_state_sha3_224 *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 s = *p;
+  uint64_t total_len = s.total_len;
+  uint32_t sz;
+  if (total_len % (uint64_t)(uint32_t)144U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    sz = (uint32_t)144U;
+  }
+  else
+  {
+    sz = (uint32_t)(total_len % (uint64_t)(uint32_t)144U);
+  }
+  if (len <= (uint32_t)144U - sz)
+  {
+    Hacl_Streaming_SHA3_state_sha3_224 s1 = *p;
+    uint64_t *block_state1 = s1.block_state;
+    uint8_t *buf = s1.buf;
+    uint64_t total_len1 = s1.total_len;
+    uint32_t sz1;
+    if (total_len1 % (uint64_t)(uint32_t)144U == (uint64_t)0U && total_len1 > (uint64_t)0U)
+    {
+      sz1 = (uint32_t)144U;
+    }
+    else
+    {
+      sz1 = (uint32_t)(total_len1 % (uint64_t)(uint32_t)144U);
+    }
+    uint8_t *buf2 = buf + sz1;
+    memcpy(buf2, data, len * sizeof (uint8_t));
+    uint64_t total_len2 = total_len1 + (uint64_t)len;
+    *p
+    =
+      (
+        (Hacl_Streaming_SHA3_state_sha3_224){
+          .block_state = block_state1,
+          .buf = buf,
+          .total_len = total_len2
+        }
+      );
+    return;
+  }
+  if (sz == (uint32_t)0U)
+  {
+    Hacl_Streaming_SHA3_state_sha3_224 s1 = *p;
+    uint64_t *block_state1 = s1.block_state;
+    uint8_t *buf = s1.buf;
+    uint64_t total_len1 = s1.total_len;
+    uint32_t sz1;
+    if (total_len1 % (uint64_t)(uint32_t)144U == (uint64_t)0U && total_len1 > (uint64_t)0U)
+    {
+      sz1 = (uint32_t)144U;
+    }
+    else
+    {
+      sz1 = (uint32_t)(total_len1 % (uint64_t)(uint32_t)144U);
+    }
+    if (!(sz1 == (uint32_t)0U))
+    {
+      Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)144U, buf, (uint32_t)1U);
+    }
+    uint32_t ite;
+    if ((uint64_t)len % (uint64_t)(uint32_t)144U == (uint64_t)0U && (uint64_t)len > (uint64_t)0U)
+    {
+      ite = (uint32_t)144U;
+    }
+    else
+    {
+      ite = (uint32_t)((uint64_t)len % (uint64_t)(uint32_t)144U);
+    }
+    uint32_t n_blocks = (len - ite) / (uint32_t)144U;
+    uint32_t data1_len = n_blocks * (uint32_t)144U;
+    uint32_t data2_len = len - data1_len;
+    uint8_t *data1 = data;
+    uint8_t *data2 = data + data1_len;
+    Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)144U, data1, data1_len / (uint32_t)144U);
+    uint8_t *dst = buf;
+    memcpy(dst, data2, data2_len * sizeof (uint8_t));
+    *p
+    =
+      (
+        (Hacl_Streaming_SHA3_state_sha3_224){
+          .block_state = block_state1,
+          .buf = buf,
+          .total_len = total_len1 + (uint64_t)len
+        }
+      );
+    return;
+  }
+  uint32_t diff = (uint32_t)144U - sz;
+  uint8_t *data1 = data;
+  uint8_t *data2 = data + diff;
+  Hacl_Streaming_SHA3_state_sha3_224 s1 = *p;
+  uint64_t *block_state10 = s1.block_state;
+  uint8_t *buf0 = s1.buf;
+  uint64_t total_len10 = s1.total_len;
+  uint32_t sz10;
+  if (total_len10 % (uint64_t)(uint32_t)144U == (uint64_t)0U && total_len10 > (uint64_t)0U)
+  {
+    sz10 = (uint32_t)144U;
+  }
+  else
+  {
+    sz10 = (uint32_t)(total_len10 % (uint64_t)(uint32_t)144U);
+  }
+  uint8_t *buf2 = buf0 + sz10;
+  memcpy(buf2, data1, diff * sizeof (uint8_t));
+  uint64_t total_len2 = total_len10 + (uint64_t)diff;
+  *p
+  =
+    (
+      (Hacl_Streaming_SHA3_state_sha3_224){
+        .block_state = block_state10,
+        .buf = buf0,
+        .total_len = total_len2
+      }
+    );
+  Hacl_Streaming_SHA3_state_sha3_224 s10 = *p;
+  uint64_t *block_state1 = s10.block_state;
+  uint8_t *buf = s10.buf;
+  uint64_t total_len1 = s10.total_len;
+  uint32_t sz1;
+  if (total_len1 % (uint64_t)(uint32_t)144U == (uint64_t)0U && total_len1 > (uint64_t)0U)
+  {
+    sz1 = (uint32_t)144U;
+  }
+  else
+  {
+    sz1 = (uint32_t)(total_len1 % (uint64_t)(uint32_t)144U);
+  }
+  if (!(sz1 == (uint32_t)0U))
+  {
+    Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)144U, buf, (uint32_t)1U);
+  }
+  uint32_t ite;
+  if
+  (
+    (uint64_t)(len - diff)
+    % (uint64_t)(uint32_t)144U
+    == (uint64_t)0U
+    && (uint64_t)(len - diff) > (uint64_t)0U
+  )
+  {
+    ite = (uint32_t)144U;
+  }
+  else
+  {
+    ite = (uint32_t)((uint64_t)(len - diff) % (uint64_t)(uint32_t)144U);
+  }
+  uint32_t n_blocks = (len - diff - ite) / (uint32_t)144U;
+  uint32_t data1_len = n_blocks * (uint32_t)144U;
+  uint32_t data2_len = len - diff - data1_len;
+  uint8_t *data11 = data2;
+  uint8_t *data21 = data2 + data1_len;
+  Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)144U, data11, data1_len / (uint32_t)144U);
+  uint8_t *dst = buf;
+  memcpy(dst, data21, data2_len * sizeof (uint8_t));
+  *p
+  =
+    (
+      (Hacl_Streaming_SHA3_state_sha3_224){
+        .block_state = block_state1,
+        .buf = buf,
+        .total_len = total_len1 + (uint64_t)(len - diff)
+      }
+    );
+}
+
+void Hacl_Streaming_SHA3_finish_224(Hacl_Streaming_SHA3_state_sha3_224 *p, uint8_t *dst)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *p;
+  uint64_t *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if (total_len % (uint64_t)(uint32_t)144U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    r = (uint32_t)144U;
+  }
+  else
+  {
+    r = (uint32_t)(total_len % (uint64_t)(uint32_t)144U);
+  }
+  uint8_t *buf_1 = buf_;
+  uint64_t tmp_block_state[25U] = { 0U };
+  memcpy(tmp_block_state, block_state, (uint32_t)25U * sizeof (uint64_t));
+  uint32_t ite;
+  if (r % (uint32_t)144U == (uint32_t)0U && r > (uint32_t)0U)
+  {
+    ite = (uint32_t)144U;
+  }
+  else
+  {
+    ite = r % (uint32_t)144U;
+  }
+  uint8_t *buf_last = buf_1 + r - ite;
+  uint8_t *buf_multi = buf_1;
+  Hacl_SHA3_update_multi_sha3(tmp_block_state, (uint32_t)144U, buf_multi, (uint32_t)0U);
+  Hacl_SHA3_update_last_sha3(tmp_block_state, (uint32_t)144U, (uint8_t)0x06U, buf_last, r);
+  Hacl_Impl_SHA3_squeeze(tmp_block_state, (uint32_t)144U, (uint32_t)28U, dst);
+}
+
+void Hacl_Streaming_SHA3_free_224(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint64_t *block_state = scrut.block_state;
+  KRML_HOST_FREE(block_state);
+  KRML_HOST_FREE(buf);
+  KRML_HOST_FREE(s);
+}
+
+Hacl_Streaming_SHA3_state_sha3_224 *Hacl_Streaming_SHA3_create_in_256()
+{
+  uint8_t *buf = KRML_HOST_CALLOC((uint32_t)136U, sizeof (uint8_t));
+  uint64_t *block_state = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+  Hacl_Streaming_SHA3_state_sha3_224
+  s = { .block_state = block_state, .buf = buf, .total_len = (uint64_t)0U };
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_SHA3_state_sha3_224), (uint32_t)1U);
+  Hacl_Streaming_SHA3_state_sha3_224
+  *p = KRML_HOST_MALLOC(sizeof (Hacl_Streaming_SHA3_state_sha3_224));
+  p[0U] = s;
+  memset(block_state, 0U, (uint32_t)25U * sizeof (uint64_t));
+  return p;
+}
+
+void Hacl_Streaming_SHA3_init_256(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint64_t *block_state = scrut.block_state;
+  memset(block_state, 0U, (uint32_t)25U * sizeof (uint64_t));
+  s[0U] =
+    (
+      (Hacl_Streaming_SHA3_state_sha3_224){
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = (uint64_t)0U
+      }
+    );
+}
+
+void
+Hacl_Streaming_SHA3_update_256(
+  Hacl_Streaming_SHA3_state_sha3_224 *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 s = *p;
+  uint64_t total_len = s.total_len;
+  uint32_t sz;
+  if (total_len % (uint64_t)(uint32_t)136U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    sz = (uint32_t)136U;
+  }
+  else
+  {
+    sz = (uint32_t)(total_len % (uint64_t)(uint32_t)136U);
+  }
+  if (len <= (uint32_t)136U - sz)
+  {
+    Hacl_Streaming_SHA3_state_sha3_224 s1 = *p;
+    uint64_t *block_state1 = s1.block_state;
+    uint8_t *buf = s1.buf;
+    uint64_t total_len1 = s1.total_len;
+    uint32_t sz1;
+    if (total_len1 % (uint64_t)(uint32_t)136U == (uint64_t)0U && total_len1 > (uint64_t)0U)
+    {
+      sz1 = (uint32_t)136U;
+    }
+    else
+    {
+      sz1 = (uint32_t)(total_len1 % (uint64_t)(uint32_t)136U);
+    }
+    uint8_t *buf2 = buf + sz1;
+    memcpy(buf2, data, len * sizeof (uint8_t));
+    uint64_t total_len2 = total_len1 + (uint64_t)len;
+    *p
+    =
+      (
+        (Hacl_Streaming_SHA3_state_sha3_224){
+          .block_state = block_state1,
+          .buf = buf,
+          .total_len = total_len2
+        }
+      );
+    return;
+  }
+  if (sz == (uint32_t)0U)
+  {
+    Hacl_Streaming_SHA3_state_sha3_224 s1 = *p;
+    uint64_t *block_state1 = s1.block_state;
+    uint8_t *buf = s1.buf;
+    uint64_t total_len1 = s1.total_len;
+    uint32_t sz1;
+    if (total_len1 % (uint64_t)(uint32_t)136U == (uint64_t)0U && total_len1 > (uint64_t)0U)
+    {
+      sz1 = (uint32_t)136U;
+    }
+    else
+    {
+      sz1 = (uint32_t)(total_len1 % (uint64_t)(uint32_t)136U);
+    }
+    if (!(sz1 == (uint32_t)0U))
+    {
+      Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)136U, buf, (uint32_t)1U);
+    }
+    uint32_t ite;
+    if ((uint64_t)len % (uint64_t)(uint32_t)136U == (uint64_t)0U && (uint64_t)len > (uint64_t)0U)
+    {
+      ite = (uint32_t)136U;
+    }
+    else
+    {
+      ite = (uint32_t)((uint64_t)len % (uint64_t)(uint32_t)136U);
+    }
+    uint32_t n_blocks = (len - ite) / (uint32_t)136U;
+    uint32_t data1_len = n_blocks * (uint32_t)136U;
+    uint32_t data2_len = len - data1_len;
+    uint8_t *data1 = data;
+    uint8_t *data2 = data + data1_len;
+    Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)136U, data1, data1_len / (uint32_t)136U);
+    uint8_t *dst = buf;
+    memcpy(dst, data2, data2_len * sizeof (uint8_t));
+    *p
+    =
+      (
+        (Hacl_Streaming_SHA3_state_sha3_224){
+          .block_state = block_state1,
+          .buf = buf,
+          .total_len = total_len1 + (uint64_t)len
+        }
+      );
+    return;
+  }
+  uint32_t diff = (uint32_t)136U - sz;
+  uint8_t *data1 = data;
+  uint8_t *data2 = data + diff;
+  Hacl_Streaming_SHA3_state_sha3_224 s1 = *p;
+  uint64_t *block_state10 = s1.block_state;
+  uint8_t *buf0 = s1.buf;
+  uint64_t total_len10 = s1.total_len;
+  uint32_t sz10;
+  if (total_len10 % (uint64_t)(uint32_t)136U == (uint64_t)0U && total_len10 > (uint64_t)0U)
+  {
+    sz10 = (uint32_t)136U;
+  }
+  else
+  {
+    sz10 = (uint32_t)(total_len10 % (uint64_t)(uint32_t)136U);
+  }
+  uint8_t *buf2 = buf0 + sz10;
+  memcpy(buf2, data1, diff * sizeof (uint8_t));
+  uint64_t total_len2 = total_len10 + (uint64_t)diff;
+  *p
+  =
+    (
+      (Hacl_Streaming_SHA3_state_sha3_224){
+        .block_state = block_state10,
+        .buf = buf0,
+        .total_len = total_len2
+      }
+    );
+  Hacl_Streaming_SHA3_state_sha3_224 s10 = *p;
+  uint64_t *block_state1 = s10.block_state;
+  uint8_t *buf = s10.buf;
+  uint64_t total_len1 = s10.total_len;
+  uint32_t sz1;
+  if (total_len1 % (uint64_t)(uint32_t)136U == (uint64_t)0U && total_len1 > (uint64_t)0U)
+  {
+    sz1 = (uint32_t)136U;
+  }
+  else
+  {
+    sz1 = (uint32_t)(total_len1 % (uint64_t)(uint32_t)136U);
+  }
+  if (!(sz1 == (uint32_t)0U))
+  {
+    Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)136U, buf, (uint32_t)1U);
+  }
+  uint32_t ite;
+  if
+  (
+    (uint64_t)(len - diff)
+    % (uint64_t)(uint32_t)136U
+    == (uint64_t)0U
+    && (uint64_t)(len - diff) > (uint64_t)0U
+  )
+  {
+    ite = (uint32_t)136U;
+  }
+  else
+  {
+    ite = (uint32_t)((uint64_t)(len - diff) % (uint64_t)(uint32_t)136U);
+  }
+  uint32_t n_blocks = (len - diff - ite) / (uint32_t)136U;
+  uint32_t data1_len = n_blocks * (uint32_t)136U;
+  uint32_t data2_len = len - diff - data1_len;
+  uint8_t *data11 = data2;
+  uint8_t *data21 = data2 + data1_len;
+  Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)136U, data11, data1_len / (uint32_t)136U);
+  uint8_t *dst = buf;
+  memcpy(dst, data21, data2_len * sizeof (uint8_t));
+  *p
+  =
+    (
+      (Hacl_Streaming_SHA3_state_sha3_224){
+        .block_state = block_state1,
+        .buf = buf,
+        .total_len = total_len1 + (uint64_t)(len - diff)
+      }
+    );
+}
+
+void Hacl_Streaming_SHA3_finish_256(Hacl_Streaming_SHA3_state_sha3_224 *p, uint8_t *dst)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *p;
+  uint64_t *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if (total_len % (uint64_t)(uint32_t)136U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    r = (uint32_t)136U;
+  }
+  else
+  {
+    r = (uint32_t)(total_len % (uint64_t)(uint32_t)136U);
+  }
+  uint8_t *buf_1 = buf_;
+  uint64_t tmp_block_state[25U] = { 0U };
+  memcpy(tmp_block_state, block_state, (uint32_t)25U * sizeof (uint64_t));
+  uint32_t ite;
+  if (r % (uint32_t)136U == (uint32_t)0U && r > (uint32_t)0U)
+  {
+    ite = (uint32_t)136U;
+  }
+  else
+  {
+    ite = r % (uint32_t)136U;
+  }
+  uint8_t *buf_last = buf_1 + r - ite;
+  uint8_t *buf_multi = buf_1;
+  Hacl_SHA3_update_multi_sha3(tmp_block_state, (uint32_t)136U, buf_multi, (uint32_t)0U);
+  Hacl_SHA3_update_last_sha3(tmp_block_state, (uint32_t)136U, (uint8_t)0x06U, buf_last, r);
+  Hacl_Impl_SHA3_squeeze(tmp_block_state, (uint32_t)136U, (uint32_t)32U, dst);
+}
+
+void Hacl_Streaming_SHA3_free_256(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint64_t *block_state = scrut.block_state;
+  KRML_HOST_FREE(block_state);
+  KRML_HOST_FREE(buf);
+  KRML_HOST_FREE(s);
+}
+
+Hacl_Streaming_SHA3_state_sha3_224 *Hacl_Streaming_SHA3_create_in_384()
+{
+  uint8_t *buf = KRML_HOST_CALLOC((uint32_t)104U, sizeof (uint8_t));
+  uint64_t *block_state = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+  Hacl_Streaming_SHA3_state_sha3_224
+  s = { .block_state = block_state, .buf = buf, .total_len = (uint64_t)0U };
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_SHA3_state_sha3_224), (uint32_t)1U);
+  Hacl_Streaming_SHA3_state_sha3_224
+  *p = KRML_HOST_MALLOC(sizeof (Hacl_Streaming_SHA3_state_sha3_224));
+  p[0U] = s;
+  memset(block_state, 0U, (uint32_t)25U * sizeof (uint64_t));
+  return p;
+}
+
+void Hacl_Streaming_SHA3_init_384(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint64_t *block_state = scrut.block_state;
+  memset(block_state, 0U, (uint32_t)25U * sizeof (uint64_t));
+  s[0U] =
+    (
+      (Hacl_Streaming_SHA3_state_sha3_224){
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = (uint64_t)0U
+      }
+    );
+}
+
+void
+Hacl_Streaming_SHA3_update_384(
+  Hacl_Streaming_SHA3_state_sha3_224 *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 s = *p;
+  uint64_t total_len = s.total_len;
+  uint32_t sz;
+  if (total_len % (uint64_t)(uint32_t)104U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    sz = (uint32_t)104U;
+  }
+  else
+  {
+    sz = (uint32_t)(total_len % (uint64_t)(uint32_t)104U);
+  }
+  if (len <= (uint32_t)104U - sz)
+  {
+    Hacl_Streaming_SHA3_state_sha3_224 s1 = *p;
+    uint64_t *block_state1 = s1.block_state;
+    uint8_t *buf = s1.buf;
+    uint64_t total_len1 = s1.total_len;
+    uint32_t sz1;
+    if (total_len1 % (uint64_t)(uint32_t)104U == (uint64_t)0U && total_len1 > (uint64_t)0U)
+    {
+      sz1 = (uint32_t)104U;
+    }
+    else
+    {
+      sz1 = (uint32_t)(total_len1 % (uint64_t)(uint32_t)104U);
+    }
+    uint8_t *buf2 = buf + sz1;
+    memcpy(buf2, data, len * sizeof (uint8_t));
+    uint64_t total_len2 = total_len1 + (uint64_t)len;
+    *p
+    =
+      (
+        (Hacl_Streaming_SHA3_state_sha3_224){
+          .block_state = block_state1,
+          .buf = buf,
+          .total_len = total_len2
+        }
+      );
+    return;
+  }
+  if (sz == (uint32_t)0U)
+  {
+    Hacl_Streaming_SHA3_state_sha3_224 s1 = *p;
+    uint64_t *block_state1 = s1.block_state;
+    uint8_t *buf = s1.buf;
+    uint64_t total_len1 = s1.total_len;
+    uint32_t sz1;
+    if (total_len1 % (uint64_t)(uint32_t)104U == (uint64_t)0U && total_len1 > (uint64_t)0U)
+    {
+      sz1 = (uint32_t)104U;
+    }
+    else
+    {
+      sz1 = (uint32_t)(total_len1 % (uint64_t)(uint32_t)104U);
+    }
+    if (!(sz1 == (uint32_t)0U))
+    {
+      Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)104U, buf, (uint32_t)1U);
+    }
+    uint32_t ite;
+    if ((uint64_t)len % (uint64_t)(uint32_t)104U == (uint64_t)0U && (uint64_t)len > (uint64_t)0U)
+    {
+      ite = (uint32_t)104U;
+    }
+    else
+    {
+      ite = (uint32_t)((uint64_t)len % (uint64_t)(uint32_t)104U);
+    }
+    uint32_t n_blocks = (len - ite) / (uint32_t)104U;
+    uint32_t data1_len = n_blocks * (uint32_t)104U;
+    uint32_t data2_len = len - data1_len;
+    uint8_t *data1 = data;
+    uint8_t *data2 = data + data1_len;
+    Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)104U, data1, data1_len / (uint32_t)104U);
+    uint8_t *dst = buf;
+    memcpy(dst, data2, data2_len * sizeof (uint8_t));
+    *p
+    =
+      (
+        (Hacl_Streaming_SHA3_state_sha3_224){
+          .block_state = block_state1,
+          .buf = buf,
+          .total_len = total_len1 + (uint64_t)len
+        }
+      );
+    return;
+  }
+  uint32_t diff = (uint32_t)104U - sz;
+  uint8_t *data1 = data;
+  uint8_t *data2 = data + diff;
+  Hacl_Streaming_SHA3_state_sha3_224 s1 = *p;
+  uint64_t *block_state10 = s1.block_state;
+  uint8_t *buf0 = s1.buf;
+  uint64_t total_len10 = s1.total_len;
+  uint32_t sz10;
+  if (total_len10 % (uint64_t)(uint32_t)104U == (uint64_t)0U && total_len10 > (uint64_t)0U)
+  {
+    sz10 = (uint32_t)104U;
+  }
+  else
+  {
+    sz10 = (uint32_t)(total_len10 % (uint64_t)(uint32_t)104U);
+  }
+  uint8_t *buf2 = buf0 + sz10;
+  memcpy(buf2, data1, diff * sizeof (uint8_t));
+  uint64_t total_len2 = total_len10 + (uint64_t)diff;
+  *p
+  =
+    (
+      (Hacl_Streaming_SHA3_state_sha3_224){
+        .block_state = block_state10,
+        .buf = buf0,
+        .total_len = total_len2
+      }
+    );
+  Hacl_Streaming_SHA3_state_sha3_224 s10 = *p;
+  uint64_t *block_state1 = s10.block_state;
+  uint8_t *buf = s10.buf;
+  uint64_t total_len1 = s10.total_len;
+  uint32_t sz1;
+  if (total_len1 % (uint64_t)(uint32_t)104U == (uint64_t)0U && total_len1 > (uint64_t)0U)
+  {
+    sz1 = (uint32_t)104U;
+  }
+  else
+  {
+    sz1 = (uint32_t)(total_len1 % (uint64_t)(uint32_t)104U);
+  }
+  if (!(sz1 == (uint32_t)0U))
+  {
+    Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)104U, buf, (uint32_t)1U);
+  }
+  uint32_t ite;
+  if
+  (
+    (uint64_t)(len - diff)
+    % (uint64_t)(uint32_t)104U
+    == (uint64_t)0U
+    && (uint64_t)(len - diff) > (uint64_t)0U
+  )
+  {
+    ite = (uint32_t)104U;
+  }
+  else
+  {
+    ite = (uint32_t)((uint64_t)(len - diff) % (uint64_t)(uint32_t)104U);
+  }
+  uint32_t n_blocks = (len - diff - ite) / (uint32_t)104U;
+  uint32_t data1_len = n_blocks * (uint32_t)104U;
+  uint32_t data2_len = len - diff - data1_len;
+  uint8_t *data11 = data2;
+  uint8_t *data21 = data2 + data1_len;
+  Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)104U, data11, data1_len / (uint32_t)104U);
+  uint8_t *dst = buf;
+  memcpy(dst, data21, data2_len * sizeof (uint8_t));
+  *p
+  =
+    (
+      (Hacl_Streaming_SHA3_state_sha3_224){
+        .block_state = block_state1,
+        .buf = buf,
+        .total_len = total_len1 + (uint64_t)(len - diff)
+      }
+    );
+}
+
+void Hacl_Streaming_SHA3_finish_384(Hacl_Streaming_SHA3_state_sha3_224 *p, uint8_t *dst)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *p;
+  uint64_t *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if (total_len % (uint64_t)(uint32_t)104U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    r = (uint32_t)104U;
+  }
+  else
+  {
+    r = (uint32_t)(total_len % (uint64_t)(uint32_t)104U);
+  }
+  uint8_t *buf_1 = buf_;
+  uint64_t tmp_block_state[25U] = { 0U };
+  memcpy(tmp_block_state, block_state, (uint32_t)25U * sizeof (uint64_t));
+  uint32_t ite;
+  if (r % (uint32_t)104U == (uint32_t)0U && r > (uint32_t)0U)
+  {
+    ite = (uint32_t)104U;
+  }
+  else
+  {
+    ite = r % (uint32_t)104U;
+  }
+  uint8_t *buf_last = buf_1 + r - ite;
+  uint8_t *buf_multi = buf_1;
+  Hacl_SHA3_update_multi_sha3(tmp_block_state, (uint32_t)104U, buf_multi, (uint32_t)0U);
+  Hacl_SHA3_update_last_sha3(tmp_block_state, (uint32_t)104U, (uint8_t)0x06U, buf_last, r);
+  Hacl_Impl_SHA3_squeeze(tmp_block_state, (uint32_t)104U, (uint32_t)48U, dst);
+}
+
+void Hacl_Streaming_SHA3_free_384(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint64_t *block_state = scrut.block_state;
+  KRML_HOST_FREE(block_state);
+  KRML_HOST_FREE(buf);
+  KRML_HOST_FREE(s);
+}
+
+Hacl_Streaming_SHA3_state_sha3_224 *Hacl_Streaming_SHA3_create_in_512()
+{
+  uint8_t *buf = KRML_HOST_CALLOC((uint32_t)72U, sizeof (uint8_t));
+  uint64_t *block_state = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+  Hacl_Streaming_SHA3_state_sha3_224
+  s = { .block_state = block_state, .buf = buf, .total_len = (uint64_t)0U };
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_SHA3_state_sha3_224), (uint32_t)1U);
+  Hacl_Streaming_SHA3_state_sha3_224
+  *p = KRML_HOST_MALLOC(sizeof (Hacl_Streaming_SHA3_state_sha3_224));
+  p[0U] = s;
+  memset(block_state, 0U, (uint32_t)25U * sizeof (uint64_t));
+  return p;
+}
+
+void Hacl_Streaming_SHA3_init_512(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint64_t *block_state = scrut.block_state;
+  memset(block_state, 0U, (uint32_t)25U * sizeof (uint64_t));
+  s[0U] =
+    (
+      (Hacl_Streaming_SHA3_state_sha3_224){
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = (uint64_t)0U
+      }
+    );
+}
+
+void
+Hacl_Streaming_SHA3_update_512(
+  Hacl_Streaming_SHA3_state_sha3_224 *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 s = *p;
+  uint64_t total_len = s.total_len;
+  uint32_t sz;
+  if (total_len % (uint64_t)(uint32_t)72U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    sz = (uint32_t)72U;
+  }
+  else
+  {
+    sz = (uint32_t)(total_len % (uint64_t)(uint32_t)72U);
+  }
+  if (len <= (uint32_t)72U - sz)
+  {
+    Hacl_Streaming_SHA3_state_sha3_224 s1 = *p;
+    uint64_t *block_state1 = s1.block_state;
+    uint8_t *buf = s1.buf;
+    uint64_t total_len1 = s1.total_len;
+    uint32_t sz1;
+    if (total_len1 % (uint64_t)(uint32_t)72U == (uint64_t)0U && total_len1 > (uint64_t)0U)
+    {
+      sz1 = (uint32_t)72U;
+    }
+    else
+    {
+      sz1 = (uint32_t)(total_len1 % (uint64_t)(uint32_t)72U);
+    }
+    uint8_t *buf2 = buf + sz1;
+    memcpy(buf2, data, len * sizeof (uint8_t));
+    uint64_t total_len2 = total_len1 + (uint64_t)len;
+    *p
+    =
+      (
+        (Hacl_Streaming_SHA3_state_sha3_224){
+          .block_state = block_state1,
+          .buf = buf,
+          .total_len = total_len2
+        }
+      );
+    return;
+  }
+  if (sz == (uint32_t)0U)
+  {
+    Hacl_Streaming_SHA3_state_sha3_224 s1 = *p;
+    uint64_t *block_state1 = s1.block_state;
+    uint8_t *buf = s1.buf;
+    uint64_t total_len1 = s1.total_len;
+    uint32_t sz1;
+    if (total_len1 % (uint64_t)(uint32_t)72U == (uint64_t)0U && total_len1 > (uint64_t)0U)
+    {
+      sz1 = (uint32_t)72U;
+    }
+    else
+    {
+      sz1 = (uint32_t)(total_len1 % (uint64_t)(uint32_t)72U);
+    }
+    if (!(sz1 == (uint32_t)0U))
+    {
+      Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)72U, buf, (uint32_t)1U);
+    }
+    uint32_t ite;
+    if ((uint64_t)len % (uint64_t)(uint32_t)72U == (uint64_t)0U && (uint64_t)len > (uint64_t)0U)
+    {
+      ite = (uint32_t)72U;
+    }
+    else
+    {
+      ite = (uint32_t)((uint64_t)len % (uint64_t)(uint32_t)72U);
+    }
+    uint32_t n_blocks = (len - ite) / (uint32_t)72U;
+    uint32_t data1_len = n_blocks * (uint32_t)72U;
+    uint32_t data2_len = len - data1_len;
+    uint8_t *data1 = data;
+    uint8_t *data2 = data + data1_len;
+    Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)72U, data1, data1_len / (uint32_t)72U);
+    uint8_t *dst = buf;
+    memcpy(dst, data2, data2_len * sizeof (uint8_t));
+    *p
+    =
+      (
+        (Hacl_Streaming_SHA3_state_sha3_224){
+          .block_state = block_state1,
+          .buf = buf,
+          .total_len = total_len1 + (uint64_t)len
+        }
+      );
+    return;
+  }
+  uint32_t diff = (uint32_t)72U - sz;
+  uint8_t *data1 = data;
+  uint8_t *data2 = data + diff;
+  Hacl_Streaming_SHA3_state_sha3_224 s1 = *p;
+  uint64_t *block_state10 = s1.block_state;
+  uint8_t *buf0 = s1.buf;
+  uint64_t total_len10 = s1.total_len;
+  uint32_t sz10;
+  if (total_len10 % (uint64_t)(uint32_t)72U == (uint64_t)0U && total_len10 > (uint64_t)0U)
+  {
+    sz10 = (uint32_t)72U;
+  }
+  else
+  {
+    sz10 = (uint32_t)(total_len10 % (uint64_t)(uint32_t)72U);
+  }
+  uint8_t *buf2 = buf0 + sz10;
+  memcpy(buf2, data1, diff * sizeof (uint8_t));
+  uint64_t total_len2 = total_len10 + (uint64_t)diff;
+  *p
+  =
+    (
+      (Hacl_Streaming_SHA3_state_sha3_224){
+        .block_state = block_state10,
+        .buf = buf0,
+        .total_len = total_len2
+      }
+    );
+  Hacl_Streaming_SHA3_state_sha3_224 s10 = *p;
+  uint64_t *block_state1 = s10.block_state;
+  uint8_t *buf = s10.buf;
+  uint64_t total_len1 = s10.total_len;
+  uint32_t sz1;
+  if (total_len1 % (uint64_t)(uint32_t)72U == (uint64_t)0U && total_len1 > (uint64_t)0U)
+  {
+    sz1 = (uint32_t)72U;
+  }
+  else
+  {
+    sz1 = (uint32_t)(total_len1 % (uint64_t)(uint32_t)72U);
+  }
+  if (!(sz1 == (uint32_t)0U))
+  {
+    Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)72U, buf, (uint32_t)1U);
+  }
+  uint32_t ite;
+  if
+  (
+    (uint64_t)(len - diff)
+    % (uint64_t)(uint32_t)72U
+    == (uint64_t)0U
+    && (uint64_t)(len - diff) > (uint64_t)0U
+  )
+  {
+    ite = (uint32_t)72U;
+  }
+  else
+  {
+    ite = (uint32_t)((uint64_t)(len - diff) % (uint64_t)(uint32_t)72U);
+  }
+  uint32_t n_blocks = (len - diff - ite) / (uint32_t)72U;
+  uint32_t data1_len = n_blocks * (uint32_t)72U;
+  uint32_t data2_len = len - diff - data1_len;
+  uint8_t *data11 = data2;
+  uint8_t *data21 = data2 + data1_len;
+  Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)72U, data11, data1_len / (uint32_t)72U);
+  uint8_t *dst = buf;
+  memcpy(dst, data21, data2_len * sizeof (uint8_t));
+  *p
+  =
+    (
+      (Hacl_Streaming_SHA3_state_sha3_224){
+        .block_state = block_state1,
+        .buf = buf,
+        .total_len = total_len1 + (uint64_t)(len - diff)
+      }
+    );
+}
+
+void Hacl_Streaming_SHA3_finish_512(Hacl_Streaming_SHA3_state_sha3_224 *p, uint8_t *dst)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *p;
+  uint64_t *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if (total_len % (uint64_t)(uint32_t)72U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    r = (uint32_t)72U;
+  }
+  else
+  {
+    r = (uint32_t)(total_len % (uint64_t)(uint32_t)72U);
+  }
+  uint8_t *buf_1 = buf_;
+  uint64_t tmp_block_state[25U] = { 0U };
+  memcpy(tmp_block_state, block_state, (uint32_t)25U * sizeof (uint64_t));
+  uint32_t ite;
+  if (r % (uint32_t)72U == (uint32_t)0U && r > (uint32_t)0U)
+  {
+    ite = (uint32_t)72U;
+  }
+  else
+  {
+    ite = r % (uint32_t)72U;
+  }
+  uint8_t *buf_last = buf_1 + r - ite;
+  uint8_t *buf_multi = buf_1;
+  Hacl_SHA3_update_multi_sha3(tmp_block_state, (uint32_t)72U, buf_multi, (uint32_t)0U);
+  Hacl_SHA3_update_last_sha3(tmp_block_state, (uint32_t)72U, (uint8_t)0x06U, buf_last, r);
+  Hacl_Impl_SHA3_squeeze(tmp_block_state, (uint32_t)72U, (uint32_t)64U, dst);
+}
+
+void Hacl_Streaming_SHA3_free_512(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint64_t *block_state = scrut.block_state;
+  KRML_HOST_FREE(block_state);
+  KRML_HOST_FREE(buf);
+  KRML_HOST_FREE(s);
+}
+
+Hacl_Streaming_SHA3_state_sha3_224 *Hacl_Streaming_SHA3_create_in_shake128()
+{
+  uint8_t *buf = KRML_HOST_CALLOC((uint32_t)168U, sizeof (uint8_t));
+  uint64_t *block_state = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+  Hacl_Streaming_SHA3_state_sha3_224
+  s = { .block_state = block_state, .buf = buf, .total_len = (uint64_t)0U };
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_SHA3_state_sha3_224), (uint32_t)1U);
+  Hacl_Streaming_SHA3_state_sha3_224
+  *p = KRML_HOST_MALLOC(sizeof (Hacl_Streaming_SHA3_state_sha3_224));
+  p[0U] = s;
+  memset(block_state, 0U, (uint32_t)25U * sizeof (uint64_t));
+  return p;
+}
+
+void Hacl_Streaming_SHA3_init_shake128(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint64_t *block_state = scrut.block_state;
+  memset(block_state, 0U, (uint32_t)25U * sizeof (uint64_t));
+  s[0U] =
+    (
+      (Hacl_Streaming_SHA3_state_sha3_224){
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = (uint64_t)0U
+      }
+    );
+}
+
+void
+Hacl_Streaming_SHA3_update_shake128(
+  Hacl_Streaming_SHA3_state_sha3_224 *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 s = *p;
+  uint64_t total_len = s.total_len;
+  uint32_t sz;
+  if (total_len % (uint64_t)(uint32_t)168U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    sz = (uint32_t)168U;
+  }
+  else
+  {
+    sz = (uint32_t)(total_len % (uint64_t)(uint32_t)168U);
+  }
+  if (len <= (uint32_t)168U - sz)
+  {
+    Hacl_Streaming_SHA3_state_sha3_224 s1 = *p;
+    uint64_t *block_state1 = s1.block_state;
+    uint8_t *buf = s1.buf;
+    uint64_t total_len1 = s1.total_len;
+    uint32_t sz1;
+    if (total_len1 % (uint64_t)(uint32_t)168U == (uint64_t)0U && total_len1 > (uint64_t)0U)
+    {
+      sz1 = (uint32_t)168U;
+    }
+    else
+    {
+      sz1 = (uint32_t)(total_len1 % (uint64_t)(uint32_t)168U);
+    }
+    uint8_t *buf2 = buf + sz1;
+    memcpy(buf2, data, len * sizeof (uint8_t));
+    uint64_t total_len2 = total_len1 + (uint64_t)len;
+    *p
+    =
+      (
+        (Hacl_Streaming_SHA3_state_sha3_224){
+          .block_state = block_state1,
+          .buf = buf,
+          .total_len = total_len2
+        }
+      );
+    return;
+  }
+  if (sz == (uint32_t)0U)
+  {
+    Hacl_Streaming_SHA3_state_sha3_224 s1 = *p;
+    uint64_t *block_state1 = s1.block_state;
+    uint8_t *buf = s1.buf;
+    uint64_t total_len1 = s1.total_len;
+    uint32_t sz1;
+    if (total_len1 % (uint64_t)(uint32_t)168U == (uint64_t)0U && total_len1 > (uint64_t)0U)
+    {
+      sz1 = (uint32_t)168U;
+    }
+    else
+    {
+      sz1 = (uint32_t)(total_len1 % (uint64_t)(uint32_t)168U);
+    }
+    if (!(sz1 == (uint32_t)0U))
+    {
+      Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)168U, buf, (uint32_t)1U);
+    }
+    uint32_t ite;
+    if ((uint64_t)len % (uint64_t)(uint32_t)168U == (uint64_t)0U && (uint64_t)len > (uint64_t)0U)
+    {
+      ite = (uint32_t)168U;
+    }
+    else
+    {
+      ite = (uint32_t)((uint64_t)len % (uint64_t)(uint32_t)168U);
+    }
+    uint32_t n_blocks = (len - ite) / (uint32_t)168U;
+    uint32_t data1_len = n_blocks * (uint32_t)168U;
+    uint32_t data2_len = len - data1_len;
+    uint8_t *data1 = data;
+    uint8_t *data2 = data + data1_len;
+    Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)168U, data1, data1_len / (uint32_t)168U);
+    uint8_t *dst = buf;
+    memcpy(dst, data2, data2_len * sizeof (uint8_t));
+    *p
+    =
+      (
+        (Hacl_Streaming_SHA3_state_sha3_224){
+          .block_state = block_state1,
+          .buf = buf,
+          .total_len = total_len1 + (uint64_t)len
+        }
+      );
+    return;
+  }
+  uint32_t diff = (uint32_t)168U - sz;
+  uint8_t *data1 = data;
+  uint8_t *data2 = data + diff;
+  Hacl_Streaming_SHA3_state_sha3_224 s1 = *p;
+  uint64_t *block_state10 = s1.block_state;
+  uint8_t *buf0 = s1.buf;
+  uint64_t total_len10 = s1.total_len;
+  uint32_t sz10;
+  if (total_len10 % (uint64_t)(uint32_t)168U == (uint64_t)0U && total_len10 > (uint64_t)0U)
+  {
+    sz10 = (uint32_t)168U;
+  }
+  else
+  {
+    sz10 = (uint32_t)(total_len10 % (uint64_t)(uint32_t)168U);
+  }
+  uint8_t *buf2 = buf0 + sz10;
+  memcpy(buf2, data1, diff * sizeof (uint8_t));
+  uint64_t total_len2 = total_len10 + (uint64_t)diff;
+  *p
+  =
+    (
+      (Hacl_Streaming_SHA3_state_sha3_224){
+        .block_state = block_state10,
+        .buf = buf0,
+        .total_len = total_len2
+      }
+    );
+  Hacl_Streaming_SHA3_state_sha3_224 s10 = *p;
+  uint64_t *block_state1 = s10.block_state;
+  uint8_t *buf = s10.buf;
+  uint64_t total_len1 = s10.total_len;
+  uint32_t sz1;
+  if (total_len1 % (uint64_t)(uint32_t)168U == (uint64_t)0U && total_len1 > (uint64_t)0U)
+  {
+    sz1 = (uint32_t)168U;
+  }
+  else
+  {
+    sz1 = (uint32_t)(total_len1 % (uint64_t)(uint32_t)168U);
+  }
+  if (!(sz1 == (uint32_t)0U))
+  {
+    Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)168U, buf, (uint32_t)1U);
+  }
+  uint32_t ite;
+  if
+  (
+    (uint64_t)(len - diff)
+    % (uint64_t)(uint32_t)168U
+    == (uint64_t)0U
+    && (uint64_t)(len - diff) > (uint64_t)0U
+  )
+  {
+    ite = (uint32_t)168U;
+  }
+  else
+  {
+    ite = (uint32_t)((uint64_t)(len - diff) % (uint64_t)(uint32_t)168U);
+  }
+  uint32_t n_blocks = (len - diff - ite) / (uint32_t)168U;
+  uint32_t data1_len = n_blocks * (uint32_t)168U;
+  uint32_t data2_len = len - diff - data1_len;
+  uint8_t *data11 = data2;
+  uint8_t *data21 = data2 + data1_len;
+  Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)168U, data11, data1_len / (uint32_t)168U);
+  uint8_t *dst = buf;
+  memcpy(dst, data21, data2_len * sizeof (uint8_t));
+  *p
+  =
+    (
+      (Hacl_Streaming_SHA3_state_sha3_224){
+        .block_state = block_state1,
+        .buf = buf,
+        .total_len = total_len1 + (uint64_t)(len - diff)
+      }
+    );
+}
+
+
+void Hacl_Streaming_SHA3_free_shake128(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint64_t *block_state = scrut.block_state;
+  KRML_HOST_FREE(block_state);
+  KRML_HOST_FREE(buf);
+  KRML_HOST_FREE(s);
+}
+
+Hacl_Streaming_SHA3_state_sha3_224 *Hacl_Streaming_SHA3_create_in_shake256()
+{
+  uint8_t *buf = KRML_HOST_CALLOC((uint32_t)136U, sizeof (uint8_t));
+  uint64_t *block_state = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+  Hacl_Streaming_SHA3_state_sha3_224
+  s = { .block_state = block_state, .buf = buf, .total_len = (uint64_t)0U };
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_SHA3_state_sha3_224), (uint32_t)1U);
+  Hacl_Streaming_SHA3_state_sha3_224
+  *p = KRML_HOST_MALLOC(sizeof (Hacl_Streaming_SHA3_state_sha3_224));
+  p[0U] = s;
+  memset(block_state, 0U, (uint32_t)25U * sizeof (uint64_t));
+  return p;
+}
+
+void Hacl_Streaming_SHA3_init_shake256(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint64_t *block_state = scrut.block_state;
+  memset(block_state, 0U, (uint32_t)25U * sizeof (uint64_t));
+  s[0U] =
+    (
+      (Hacl_Streaming_SHA3_state_sha3_224){
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = (uint64_t)0U
+      }
+    );
+}
+
+void
+Hacl_Streaming_SHA3_update_shake256(
+  Hacl_Streaming_SHA3_state_sha3_224 *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 s = *p;
+  uint64_t total_len = s.total_len;
+  uint32_t sz;
+  if (total_len % (uint64_t)(uint32_t)136U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    sz = (uint32_t)136U;
+  }
+  else
+  {
+    sz = (uint32_t)(total_len % (uint64_t)(uint32_t)136U);
+  }
+  if (len <= (uint32_t)136U - sz)
+  {
+    Hacl_Streaming_SHA3_state_sha3_224 s1 = *p;
+    uint64_t *block_state1 = s1.block_state;
+    uint8_t *buf = s1.buf;
+    uint64_t total_len1 = s1.total_len;
+    uint32_t sz1;
+    if (total_len1 % (uint64_t)(uint32_t)136U == (uint64_t)0U && total_len1 > (uint64_t)0U)
+    {
+      sz1 = (uint32_t)136U;
+    }
+    else
+    {
+      sz1 = (uint32_t)(total_len1 % (uint64_t)(uint32_t)136U);
+    }
+    uint8_t *buf2 = buf + sz1;
+    memcpy(buf2, data, len * sizeof (uint8_t));
+    uint64_t total_len2 = total_len1 + (uint64_t)len;
+    *p
+    =
+      (
+        (Hacl_Streaming_SHA3_state_sha3_224){
+          .block_state = block_state1,
+          .buf = buf,
+          .total_len = total_len2
+        }
+      );
+    return;
+  }
+  if (sz == (uint32_t)0U)
+  {
+    Hacl_Streaming_SHA3_state_sha3_224 s1 = *p;
+    uint64_t *block_state1 = s1.block_state;
+    uint8_t *buf = s1.buf;
+    uint64_t total_len1 = s1.total_len;
+    uint32_t sz1;
+    if (total_len1 % (uint64_t)(uint32_t)136U == (uint64_t)0U && total_len1 > (uint64_t)0U)
+    {
+      sz1 = (uint32_t)136U;
+    }
+    else
+    {
+      sz1 = (uint32_t)(total_len1 % (uint64_t)(uint32_t)136U);
+    }
+    if (!(sz1 == (uint32_t)0U))
+    {
+      Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)136U, buf, (uint32_t)1U);
+    }
+    uint32_t ite;
+    if ((uint64_t)len % (uint64_t)(uint32_t)136U == (uint64_t)0U && (uint64_t)len > (uint64_t)0U)
+    {
+      ite = (uint32_t)136U;
+    }
+    else
+    {
+      ite = (uint32_t)((uint64_t)len % (uint64_t)(uint32_t)136U);
+    }
+    uint32_t n_blocks = (len - ite) / (uint32_t)136U;
+    uint32_t data1_len = n_blocks * (uint32_t)136U;
+    uint32_t data2_len = len - data1_len;
+    uint8_t *data1 = data;
+    uint8_t *data2 = data + data1_len;
+    Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)136U, data1, data1_len / (uint32_t)136U);
+    uint8_t *dst = buf;
+    memcpy(dst, data2, data2_len * sizeof (uint8_t));
+    *p
+    =
+      (
+        (Hacl_Streaming_SHA3_state_sha3_224){
+          .block_state = block_state1,
+          .buf = buf,
+          .total_len = total_len1 + (uint64_t)len
+        }
+      );
+    return;
+  }
+  uint32_t diff = (uint32_t)136U - sz;
+  uint8_t *data1 = data;
+  uint8_t *data2 = data + diff;
+  Hacl_Streaming_SHA3_state_sha3_224 s1 = *p;
+  uint64_t *block_state10 = s1.block_state;
+  uint8_t *buf0 = s1.buf;
+  uint64_t total_len10 = s1.total_len;
+  uint32_t sz10;
+  if (total_len10 % (uint64_t)(uint32_t)136U == (uint64_t)0U && total_len10 > (uint64_t)0U)
+  {
+    sz10 = (uint32_t)136U;
+  }
+  else
+  {
+    sz10 = (uint32_t)(total_len10 % (uint64_t)(uint32_t)136U);
+  }
+  uint8_t *buf2 = buf0 + sz10;
+  memcpy(buf2, data1, diff * sizeof (uint8_t));
+  uint64_t total_len2 = total_len10 + (uint64_t)diff;
+  *p
+  =
+    (
+      (Hacl_Streaming_SHA3_state_sha3_224){
+        .block_state = block_state10,
+        .buf = buf0,
+        .total_len = total_len2
+      }
+    );
+  Hacl_Streaming_SHA3_state_sha3_224 s10 = *p;
+  uint64_t *block_state1 = s10.block_state;
+  uint8_t *buf = s10.buf;
+  uint64_t total_len1 = s10.total_len;
+  uint32_t sz1;
+  if (total_len1 % (uint64_t)(uint32_t)136U == (uint64_t)0U && total_len1 > (uint64_t)0U)
+  {
+    sz1 = (uint32_t)136U;
+  }
+  else
+  {
+    sz1 = (uint32_t)(total_len1 % (uint64_t)(uint32_t)136U);
+  }
+  if (!(sz1 == (uint32_t)0U))
+  {
+    Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)136U, buf, (uint32_t)1U);
+  }
+  uint32_t ite;
+  if
+  (
+    (uint64_t)(len - diff)
+    % (uint64_t)(uint32_t)136U
+    == (uint64_t)0U
+    && (uint64_t)(len - diff) > (uint64_t)0U
+  )
+  {
+    ite = (uint32_t)136U;
+  }
+  else
+  {
+    ite = (uint32_t)((uint64_t)(len - diff) % (uint64_t)(uint32_t)136U);
+  }
+  uint32_t n_blocks = (len - diff - ite) / (uint32_t)136U;
+  uint32_t data1_len = n_blocks * (uint32_t)136U;
+  uint32_t data2_len = len - diff - data1_len;
+  uint8_t *data11 = data2;
+  uint8_t *data21 = data2 + data1_len;
+  Hacl_SHA3_update_multi_sha3(block_state1, (uint32_t)136U, data11, data1_len / (uint32_t)136U);
+  uint8_t *dst = buf;
+  memcpy(dst, data21, data2_len * sizeof (uint8_t));
+  *p
+  =
+    (
+      (Hacl_Streaming_SHA3_state_sha3_224){
+        .block_state = block_state1,
+        .buf = buf,
+        .total_len = total_len1 + (uint64_t)(len - diff)
+      }
+    );
+}
+
+
+void Hacl_Streaming_SHA3_free_shake256(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint64_t *block_state = scrut.block_state;
+  KRML_HOST_FREE(block_state);
+  KRML_HOST_FREE(buf);
+  KRML_HOST_FREE(s);
+}
+
+void
+Hacl_Streaming_SHA3_finish_shake128(
+  Hacl_Streaming_SHA3_state_sha3_224 *s,
+  uint8_t *dst,
+  uint32_t len
+)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *s;
+  uint64_t *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if (total_len % (uint64_t)(uint32_t)168U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    r = (uint32_t)168U;
+  }
+  else
+  {
+    r = (uint32_t)(total_len % (uint64_t)(uint32_t)168U);
+  }
+  uint64_t tmp_block_state[25U] = { 0U };
+  memcpy(tmp_block_state, block_state, (uint32_t)25U * sizeof (uint64_t));
+  Hacl_SHA3_update_last_sha3(tmp_block_state, (uint32_t)168U, (uint8_t)0x1FU, buf_, r);
+  Hacl_Impl_SHA3_squeeze(tmp_block_state, (uint32_t)168U, len, dst);
+}
+
+void
+Hacl_Streaming_SHA3_finish_shake256(
+  Hacl_Streaming_SHA3_state_sha3_224 *s,
+  uint8_t *dst,
+  uint32_t len
+)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *s;
+  uint64_t *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if (total_len % (uint64_t)(uint32_t)136U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    r = (uint32_t)136U;
+  }
+  else
+  {
+    r = (uint32_t)(total_len % (uint64_t)(uint32_t)136U);
+  }
+  uint64_t tmp_block_state[25U] = { 0U };
+  memcpy(tmp_block_state, block_state, (uint32_t)25U * sizeof (uint64_t));
+  Hacl_SHA3_update_last_sha3(tmp_block_state, (uint32_t)136U, (uint8_t)0x1FU, buf_, r);
+  Hacl_Impl_SHA3_squeeze(tmp_block_state, (uint32_t)136U, len, dst);
+}
+
+Hacl_Streaming_SHA3_xof_state
+*Hacl_Streaming_SHA3_create_xof_shake128(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *s;
+  uint64_t *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if (total_len % (uint64_t)(uint32_t)168U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    r = (uint32_t)168U;
+  }
+  else
+  {
+    r = (uint32_t)(total_len % (uint64_t)(uint32_t)168U);
+  }
+  uint64_t *st = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+  memcpy(st, block_state, (uint32_t)25U * sizeof (uint64_t));
+  Hacl_SHA3_update_last_sha3(st, (uint32_t)168U, (uint8_t)0x1FU, buf_, r);
+  uint8_t *buf = KRML_HOST_CALLOC((uint32_t)168U, sizeof (uint8_t));
+  Hacl_Impl_SHA3_storeState((uint32_t)168U, st, buf);
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_SHA3_xof_state), (uint32_t)1U);
+  Hacl_Streaming_SHA3_xof_state
+  *buf1 = KRML_HOST_MALLOC(sizeof (Hacl_Streaming_SHA3_xof_state));
+  buf1[0U] =
+    ((Hacl_Streaming_SHA3_xof_state){ .block_state = st, .buf = buf, .pos = (uint32_t)0U });
+  return buf1;
+}
+
+Hacl_Streaming_SHA3_xof_state
+*Hacl_Streaming_SHA3_create_xof_shake256(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *s;
+  uint64_t *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if (total_len % (uint64_t)(uint32_t)136U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    r = (uint32_t)136U;
+  }
+  else
+  {
+    r = (uint32_t)(total_len % (uint64_t)(uint32_t)136U);
+  }
+  uint64_t *st = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+  memcpy(st, block_state, (uint32_t)25U * sizeof (uint64_t));
+  Hacl_SHA3_update_last_sha3(st, (uint32_t)136U, (uint8_t)0x1FU, buf_, r);
+  uint8_t *buf = KRML_HOST_CALLOC((uint32_t)136U, sizeof (uint8_t));
+  Hacl_Impl_SHA3_storeState((uint32_t)136U, st, buf);
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_SHA3_xof_state), (uint32_t)1U);
+  Hacl_Streaming_SHA3_xof_state
+  *buf1 = KRML_HOST_MALLOC(sizeof (Hacl_Streaming_SHA3_xof_state));
+  buf1[0U] =
+    ((Hacl_Streaming_SHA3_xof_state){ .block_state = st, .buf = buf, .pos = (uint32_t)0U });
+  return buf1;
+}
+
+void
+Hacl_Streaming_SHA3_squeeze_shake128(
+  Hacl_Streaming_SHA3_xof_state *x,
+  uint8_t *dst,
+  uint32_t len
+)
+{
+  Hacl_Streaming_SHA3_xof_state scrut = *x;
+  uint64_t *block_state = scrut.block_state;
+  uint8_t *buf = scrut.buf;
+  uint32_t pos = scrut.pos;
+  uint32_t n;
+  if (len < (uint32_t)168U - pos)
+  {
+    n = len;
+  }
+  else
+  {
+    n = (uint32_t)168U - pos;
+  }
+  memcpy(dst, buf + pos, n * sizeof (uint8_t));
+  uint32_t len1 = len - n;
+  uint8_t *dst1 = dst + n;
+  uint32_t nb = len1 / (uint32_t)168U;
+  uint32_t rem = len1 % (uint32_t)168U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    Hacl_Impl_SHA3_state_permute(block_state);
+    Hacl_Impl_SHA3_storeState((uint32_t)168U, block_state, dst1 + i * (uint32_t)168U);
+  }
+  uint32_t pos1;
+  if (rem == (uint32_t)0U)
+  {
+    if (nb == (uint32_t)0U)
+    {
+      pos1 = pos + n;
+    }
+    else
+    {
+      pos1 = (uint32_t)168U;
+    }
+  }
+  else
+  {
+    Hacl_Impl_SHA3_state_permute(block_state);
+    Hacl_Impl_SHA3_storeState((uint32_t)168U, block_state, buf);
+    memcpy(dst1 + nb * (uint32_t)168U, buf, rem * sizeof (uint8_t));
+    pos1 = rem;
+  }
+  x[0U] =
+    ((Hacl_Streaming_SHA3_xof_state){ .block_state = block_state, .buf = buf, .pos = pos1 });
+}
+
+void
+Hacl_Streaming_SHA3_squeeze_shake256(
+  Hacl_Streaming_SHA3_xof_state *x,
+  uint8_t *dst,
+  uint32_t len
+)
+{
+  Hacl_Streaming_SHA3_xof_state scrut = *x;
+  uint64_t *block_state = scrut.block_state;
+  uint8_t *buf = scrut.buf;
+  uint32_t pos = scrut.pos;
+  uint32_t n;
+  if (len < (uint32_t)136U - pos)
+  {
+    n = len;
+  }
+  else
+  {
+    n = (uint32_t)136U - pos;
+  }
+  memcpy(dst, buf + pos, n * sizeof (uint8_t));
+  uint32_t len1 = len - n;
+  uint8_t *dst1 = dst + n;
+  uint32_t nb = len1 / (uint32_t)136U;
+  uint32_t rem = len1 % (uint32_t)136U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    Hacl_Impl_SHA3_state_permute(block_state);
+    Hacl_Impl_SHA3_storeState((uint32_t)136U, block_state, dst1 + i * (uint32_t)136U);
+  }
+  uint32_t pos1;
+  if (rem == (uint32_t)0U)
+  {
+    if (nb == (uint32_t)0U)
+    {
+      pos1 = pos + n;
+    }
+    else
+    {
+      pos1 = (uint32_t)136U;
+    }
+  }
+  else
+  {
+    Hacl_Impl_SHA3_state_permute(block_state);
+    Hacl_Impl_SHA3_storeState((uint32_t)136U, block_state, buf);
+    memcpy(dst1 + nb * (uint32_t)136U, buf, rem * sizeof (uint8_t));
+    pos1 = rem;
+  }
+  x[0U] =
+    ((Hacl_Streaming_SHA3_xof_state){ .block_state = block_state, .buf = buf, .pos = pos1 });
+}
+
+void Hacl_Streaming_SHA3_free_xof(Hacl_Streaming_SHA3_xof_state *x)
+{
+  Hacl_Streaming_SHA3_xof_state scrut = *x;
+  uint64_t *block_state = scrut.block_state;
+  uint8_t *buf = scrut.buf;
+  KRML_HOST_FREE(block_state);
+  KRML_HOST_FREE(buf);
+  KRML_HOST_FREE(x);
+}
+
@@ -0,0 +1,7 @@
+#include "Lib_Buffer64.h"
+
+/* See Lib.Buffer64.fsti. The caller guarantees that the memory pointed to by b
+   is at least i bytes long. */
+uint8_t *Lib_Buffer64_offset(uint8_t *b, uint64_t i) {
+  return b + i;
+}
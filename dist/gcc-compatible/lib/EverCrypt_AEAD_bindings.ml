@@ -66,6 +66,42 @@ module Bindings(F:Cstubs.FOREIGN) =
                              (ocaml_bytes @->
                                 (ocaml_bytes @->
                                    (returning everCrypt_Error_error_code))))))))))
+    let everCrypt_AEAD_encrypt_expand_aes128_gcm_siv =
+      foreign "EverCrypt_AEAD_encrypt_expand_aes128_gcm_siv"
+        (ocaml_bytes @->
+           (ocaml_bytes @->
+              (uint32_t @->
+                 (ocaml_bytes @->
+                    (uint32_t @->
+                       (ocaml_bytes @->
+                          (uint32_t @->
+                             (ocaml_bytes @->
+                                (ocaml_bytes @->
+                                   (returning everCrypt_Error_error_code))))))))))
+    let everCrypt_AEAD_encrypt_expand_aes256_gcm_siv =
+      foreign "EverCrypt_AEAD_encrypt_expand_aes256_gcm_siv"
+        (ocaml_bytes @->
+           (ocaml_bytes @->
+              (uint32_t @->
+                 (ocaml_bytes @->
+                    (uint32_t @->
+                       (ocaml_bytes @->
+                          (uint32_t @->
+                             (ocaml_bytes @->
+                                (ocaml_bytes @->
+                                   (returning everCrypt_Error_error_code))))))))))
+    let everCrypt_AEAD_encrypt_expand_xchacha20_poly1305 =
+      foreign "EverCrypt_AEAD_encrypt_expand_xchacha20_poly1305"
+        (ocaml_bytes @->
+           (ocaml_bytes @->
+              (uint32_t @->
+                 (ocaml_bytes @->
+                    (uint32_t @->
+                       (ocaml_bytes @->
+                          (uint32_t @->
+                             (ocaml_bytes @->
+                                (ocaml_bytes @->
+                                   (returning everCrypt_Error_error_code))))))))))
     let everCrypt_AEAD_encrypt_expand =
       foreign "EverCrypt_AEAD_encrypt_expand"
         (spec_Agile_AEAD_alg @->
@@ -127,6 +163,42 @@ module Bindings(F:Cstubs.FOREIGN) =
                              (ocaml_bytes @->
                                 (ocaml_bytes @->
                                    (returning everCrypt_Error_error_code))))))))))
+    let everCrypt_AEAD_decrypt_expand_aes128_gcm_siv =
+      foreign "EverCrypt_AEAD_decrypt_expand_aes128_gcm_siv"
+        (ocaml_bytes @->
+           (ocaml_bytes @->
+              (uint32_t @->
+                 (ocaml_bytes @->
+                    (uint32_t @->
+                       (ocaml_bytes @->
+                          (uint32_t @->
+                             (ocaml_bytes @->
+                                (ocaml_bytes @->
+                                   (returning everCrypt_Error_error_code))))))))))
+    let everCrypt_AEAD_decrypt_expand_aes256_gcm_siv =
+      foreign "EverCrypt_AEAD_decrypt_expand_aes256_gcm_siv"
+        (ocaml_bytes @->
+           (ocaml_bytes @->
+              (uint32_t @->
+                 (ocaml_bytes @->
+                    (uint32_t @->
+                       (ocaml_bytes @->
+                          (uint32_t @->
+                             (ocaml_bytes @->
+                                (ocaml_bytes @->
+                                   (returning everCrypt_Error_error_code))))))))))
+    let everCrypt_AEAD_decrypt_expand_xchacha20_poly1305 =
+      foreign "EverCrypt_AEAD_decrypt_expand_xchacha20_poly1305"
+        (ocaml_bytes @->
+           (ocaml_bytes @->
+              (uint32_t @->
+                 (ocaml_bytes @->
+                    (uint32_t @->
+                       (ocaml_bytes @->
+                          (uint32_t @->
+                             (ocaml_bytes @->
+                                (ocaml_bytes @->
+                                   (returning everCrypt_Error_error_code))))))))))
     let everCrypt_AEAD_decrypt_expand =
       foreign "EverCrypt_AEAD_decrypt_expand"
         (spec_Agile_AEAD_alg @->
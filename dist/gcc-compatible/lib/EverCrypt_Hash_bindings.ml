@@ -35,6 +35,14 @@ module Bindings(F:Cstubs.FOREIGN) =
       Unsigned.UInt8.of_int 6
     let everCrypt_Hash_state_s_tags_EverCrypt_Hash_Blake2B_s =
       Unsigned.UInt8.of_int 7
+    let everCrypt_Hash_state_s_tags_EverCrypt_Hash_SHA3_224_s =
+      Unsigned.UInt8.of_int 8
+    let everCrypt_Hash_state_s_tags_EverCrypt_Hash_SHA3_256_s =
+      Unsigned.UInt8.of_int 9
+    let everCrypt_Hash_state_s_tags_EverCrypt_Hash_SHA3_384_s =
+      Unsigned.UInt8.of_int 10
+    let everCrypt_Hash_state_s_tags_EverCrypt_Hash_SHA3_512_s =
+      Unsigned.UInt8.of_int 11
     type everCrypt_Hash_state_s = [ `everCrypt_Hash_state_s ] structure
     let (everCrypt_Hash_state_s : [ `everCrypt_Hash_state_s ] structure typ)
       = structure "EverCrypt_Hash_state_s_s"
@@ -58,6 +66,14 @@ module Bindings(F:Cstubs.FOREIGN) =
       field everCrypt_Hash_state_s_val "case_Blake2S_s" (ptr uint32_t)
     let everCrypt_Hash_state_s_val_case_Blake2B_s =
       field everCrypt_Hash_state_s_val "case_Blake2B_s" (ptr uint64_t)
+    let everCrypt_Hash_state_s_val_case_SHA3_224_s =
+      field everCrypt_Hash_state_s_val "case_SHA3_224_s" (ptr uint64_t)
+    let everCrypt_Hash_state_s_val_case_SHA3_256_s =
+      field everCrypt_Hash_state_s_val "case_SHA3_256_s" (ptr uint64_t)
+    let everCrypt_Hash_state_s_val_case_SHA3_384_s =
+      field everCrypt_Hash_state_s_val "case_SHA3_384_s" (ptr uint64_t)
+    let everCrypt_Hash_state_s_val_case_SHA3_512_s =
+      field everCrypt_Hash_state_s_val "case_SHA3_512_s" (ptr uint64_t)
     let _ = seal everCrypt_Hash_state_s_val
     let everCrypt_Hash_state_s_u =
       field everCrypt_Hash_state_s "" everCrypt_Hash_state_s_val
@@ -200,6 +216,22 @@ module Bindings(F:Cstubs.FOREIGN) =
       foreign "EverCrypt_Hash_Incremental_finish_blake2b"
         ((ptr hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____)
            @-> (ocaml_bytes @-> (returning void)))
+    let everCrypt_Hash_Incremental_finish_sha3_224 =
+      foreign "EverCrypt_Hash_Incremental_finish_sha3_224"
+        ((ptr hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____)
+           @-> (ocaml_bytes @-> (returning void)))
+    let everCrypt_Hash_Incremental_finish_sha3_256 =
+      foreign "EverCrypt_Hash_Incremental_finish_sha3_256"
+        ((ptr hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____)
+           @-> (ocaml_bytes @-> (returning void)))
+    let everCrypt_Hash_Incremental_finish_sha3_384 =
+      foreign "EverCrypt_Hash_Incremental_finish_sha3_384"
+        ((ptr hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____)
+           @-> (ocaml_bytes @-> (returning void)))
+    let everCrypt_Hash_Incremental_finish_sha3_512 =
+      foreign "EverCrypt_Hash_Incremental_finish_sha3_512"
+        ((ptr hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____)
+           @-> (ocaml_bytes @-> (returning void)))
     let everCrypt_Hash_Incremental_alg_of_state =
       foreign "EverCrypt_Hash_Incremental_alg_of_state"
         ((ptr hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____)
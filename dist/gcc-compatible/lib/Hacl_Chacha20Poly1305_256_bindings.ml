@@ -21,4 +21,23 @@ module Bindings(F:Cstubs.FOREIGN) =
                        (ocaml_bytes @->
                           (ocaml_bytes @->
                              (ocaml_bytes @-> (returning uint32_t)))))))))
+    let hacl_Chacha20Poly1305_256_xaead_encrypt =
+      foreign "Hacl_Chacha20Poly1305_256_xaead_encrypt"
+        (ocaml_bytes @->
+           (ocaml_bytes @->
+              (uint32_t @->
+                 (ocaml_bytes @->
+                    (uint32_t @->
+                       (ocaml_bytes @->
+                          (ocaml_bytes @-> (ocaml_bytes @-> (returning void)))))))))
+    let hacl_Chacha20Poly1305_256_xaead_decrypt =
+      foreign "Hacl_Chacha20Poly1305_256_xaead_decrypt"
+        (ocaml_bytes @->
+           (ocaml_bytes @->
+              (uint32_t @->
+                 (ocaml_bytes @->
+                    (uint32_t @->
+                       (ocaml_bytes @->
+                          (ocaml_bytes @->
+                             (ocaml_bytes @-> (returning uint32_t)))))))))
   end
\ No newline at end of file
@@ -28,4 +28,7 @@ module Bindings(F:Cstubs.FOREIGN) =
               (ocaml_bytes @->
                  (ocaml_bytes @->
                     (ocaml_bytes @-> (uint32_t @-> (returning void)))))))
+    let hacl_Chacha20_hchacha20 =
+      foreign "Hacl_Chacha20_hchacha20"
+        (ocaml_bytes @-> (ocaml_bytes @-> (ocaml_bytes @-> (returning void))))
   end
\ No newline at end of file
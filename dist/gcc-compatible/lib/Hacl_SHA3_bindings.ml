@@ -14,6 +14,14 @@ module Bindings(F:Cstubs.FOREIGN) =
     let hacl_Impl_SHA3_storeState =
       foreign "Hacl_Impl_SHA3_storeState"
         (uint32_t @-> ((ptr uint64_t) @-> (ocaml_bytes @-> (returning void))))
+    let hacl_Impl_SHA3_absorb_last =
+      foreign "Hacl_Impl_SHA3_absorb_last"
+        (uint8_t @->
+           (uint32_t @->
+              (uint32_t @-> (ocaml_bytes @-> ((ptr uint64_t) @-> (returning void))))))
+    let hacl_Impl_SHA3_absorb_inner =
+      foreign "Hacl_Impl_SHA3_absorb_inner"
+        (uint32_t @-> (ocaml_bytes @-> ((ptr uint64_t) @-> (returning void))))
     let hacl_Impl_SHA3_absorb =
       foreign "Hacl_Impl_SHA3_absorb"
         ((ptr uint64_t) @->
@@ -51,4 +59,13 @@ module Bindings(F:Cstubs.FOREIGN) =
     let hacl_SHA3_sha3_512 =
       foreign "Hacl_SHA3_sha3_512"
         (uint32_t @-> (ocaml_bytes @-> (ocaml_bytes @-> (returning void))))
+    let hacl_SHA3_update_multi_sha3 =
+      foreign "Hacl_SHA3_update_multi_sha3"
+        ((ptr uint64_t) @->
+           (uint32_t @-> (ocaml_bytes @-> (uint32_t @-> (returning void)))))
+    let hacl_SHA3_update_last_sha3 =
+      foreign "Hacl_SHA3_update_last_sha3"
+        ((ptr uint64_t) @->
+           (uint32_t @->
+              (uint8_t @-> (ocaml_bytes @-> (uint32_t @-> (returning void))))))
   end
\ No newline at end of file
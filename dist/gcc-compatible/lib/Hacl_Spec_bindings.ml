@@ -21,6 +21,14 @@ module Bindings(F:Cstubs.FOREIGN) =
       Unsigned.UInt8.of_int 6
     let spec_Hash_Definitions_hash_alg_Spec_Hash_Definitions_Blake2B =
       Unsigned.UInt8.of_int 7
+    let spec_Hash_Definitions_hash_alg_Spec_Hash_Definitions_SHA3_224 =
+      Unsigned.UInt8.of_int 8
+    let spec_Hash_Definitions_hash_alg_Spec_Hash_Definitions_SHA3_256 =
+      Unsigned.UInt8.of_int 9
+    let spec_Hash_Definitions_hash_alg_Spec_Hash_Definitions_SHA3_384 =
+      Unsigned.UInt8.of_int 10
+    let spec_Hash_Definitions_hash_alg_Spec_Hash_Definitions_SHA3_512 =
+      Unsigned.UInt8.of_int 11
     type spec_Cipher_Expansion_impl = Unsigned.UInt8.t
     let spec_Cipher_Expansion_impl =
       typedef uint8_t "Spec_Cipher_Expansion_impl"
@@ -30,6 +38,10 @@ module Bindings(F:Cstubs.FOREIGN) =
       Unsigned.UInt8.of_int 1
     let spec_Cipher_Expansion_impl_Spec_Cipher_Expansion_Vale_AES256 =
       Unsigned.UInt8.of_int 2
+    let spec_Cipher_Expansion_impl_Spec_Cipher_Expansion_Hacl_AES128 =
+      Unsigned.UInt8.of_int 3
+    let spec_Cipher_Expansion_impl_Spec_Cipher_Expansion_Hacl_AES256 =
+      Unsigned.UInt8.of_int 4
     type spec_Agile_Cipher_cipher_alg = Unsigned.UInt8.t
     let spec_Agile_Cipher_cipher_alg =
       typedef uint8_t "Spec_Agile_Cipher_cipher_alg"
@@ -66,4 +78,10 @@ module Bindings(F:Cstubs.FOREIGN) =
       Unsigned.UInt8.of_int 5
     let spec_Agile_AEAD_alg_Spec_Agile_AEAD_AES256_CCM8 =
       Unsigned.UInt8.of_int 6
+    let spec_Agile_AEAD_alg_Spec_Agile_AEAD_AES128_GCM_SIV =
+      Unsigned.UInt8.of_int 7
+    let spec_Agile_AEAD_alg_Spec_Agile_AEAD_AES256_GCM_SIV =
+      Unsigned.UInt8.of_int 8
+    let spec_Agile_AEAD_alg_Spec_Agile_AEAD_XCHACHA20_POLY1305 =
+      Unsigned.UInt8.of_int 9
   end
\ No newline at end of file
@@ -0,0 +1,74 @@
+#ifdef __GNUC__
+#if defined(__x86_64__) || defined(_M_X64)
+#pragma once
+#include <inttypes.h>
+
+// Computes res <- res + a * b, where a and res are len-limb bignums, and
+// returns the carry limb. This is the row of the schoolbook multiplication
+// and of the Montgomery reduction in Hacl_Bignum.h, with two carry chains:
+// CF (adcx) adds the high half of the previous product, and OF (adox) adds
+// the limb of res. Requires BMI2 and ADX; a and res must be disjoint.
+static inline uint64_t bn_mul1_add_adx (uint32_t len, uint64_t *a, uint64_t b, uint64_t *res)
+{
+  uint64_t carry_r;
+  uint64_t len4 = (uint64_t)(len / 4U);
+  uint64_t len1 = (uint64_t)(len % 4U);
+
+  asm volatile(
+    // Clear the previous high half, CF and OF
+    "  xor %k0, %k0;"
+
+    // Four limbs per iteration; lea and jrcxz preserve CF and OF
+    "1:"
+    "  jrcxz 2f;"
+    "  mulxq 0(%1), %%r8, %%r9;"
+    "  adcx %0, %%r8;"
+    "  adoxq 0(%2), %%r8;"
+    "  movq %%r8, 0(%2);"
+    "  mulxq 8(%1), %%r8, %0;"
+    "  adcx %%r9, %%r8;"
+    "  adoxq 8(%2), %%r8;"
+    "  movq %%r8, 8(%2);"
+    "  mulxq 16(%1), %%r8, %%r9;"
+    "  adcx %0, %%r8;"
+    "  adoxq 16(%2), %%r8;"
+    "  movq %%r8, 16(%2);"
+    "  mulxq 24(%1), %%r8, %0;"
+    "  adcx %%r9, %%r8;"
+    "  adoxq 24(%2), %%r8;"
+    "  movq %%r8, 24(%2);"
+    "  lea 32(%1), %1;"
+    "  lea 32(%2), %2;"
+    "  lea -1(%%rcx), %%rcx;"
+    "  jmp 1b;"
+
+    // The remaining len % 4 limbs, one per iteration
+    "2:"
+    "  mov %4, %%rcx;"
+    "3:"
+    "  jrcxz 4f;"
+    "  mulxq 0(%1), %%r8, %%r9;"
+    "  adcx %0, %%r8;"
+    "  adoxq 0(%2), %%r8;"
+    "  movq %%r8, 0(%2);"
+    "  mov %%r9, %0;"
+    "  lea 8(%1), %1;"
+    "  lea 8(%2), %2;"
+    "  lea -1(%%rcx), %%rcx;"
+    "  jmp 3b;"
+
+    // Fold CF and OF into the carry limb; guaranteed not to overflow
+    "4:"
+    "  mov $0, %%r8d;"
+    "  adcx %%r8, %0;"
+    "  adox %%r8, %0;"
+  : "=&r" (carry_r), "+&r" (a), "+&r" (res), "+&c" (len4)
+  : "r" (len1), "d" (b)
+  : "%r8", "%r9", "memory", "cc"
+  );
+
+  return carry_r;
+}
+
+#endif /* defined(__x86_64__) || defined(_M_X64) */
+#endif /* __GNUC__ */
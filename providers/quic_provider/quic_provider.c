@@ -11,6 +11,7 @@
 
 #include "kremlib.h"
 #include "EverCrypt.h"
+#include "EverCrypt_AEAD.h"
 #include "quic_provider.h"
 
 typedef struct quic_key {
@@ -256,6 +257,16 @@ int MITLS_CALLCONV quic_crypto_derive_key(quic_key **k, const quic_secret *secre
   return 1;
 }
 
+static inline Spec_Agile_AEAD_alg aead_alg(mitls_aead alg)
+{
+  if(alg == TLS_aead_AES_128_GCM)
+    return Spec_Agile_AEAD_AES128_GCM;
+  else if(alg == TLS_aead_AES_256_GCM)
+    return Spec_Agile_AEAD_AES256_GCM;
+  else
+    return Spec_Agile_AEAD_CHACHA20_POLY1305;
+}
+
 static inline void sn_to_iv(unsigned char *iv, uint64_t sn)
 {
   for(int i = 4; i < 12; i++)
@@ -290,19 +301,10 @@ int MITLS_CALLCONV quic_crypto_encrypt(quic_key *key, unsigned char *cipher, uin
   memcpy(iv, key->static_iv, 12);
   sn_to_iv(iv, sn);
 
-  if(key->alg == TLS_aead_AES_128_GCM)
-  {
-    EverCrypt_aes128_gcm_encrypt(key->key, iv, (uint8_t*)ad, ad_len, (uint8_t*)plain, plain_len, cipher, (cipher+plain_len));
-  }
-  else if(key->alg == TLS_aead_AES_256_GCM)
-  {
-    EverCrypt_aes256_gcm_encrypt(key->key, iv, (uint8_t*)ad, ad_len, (uint8_t*)plain, plain_len, cipher, (cipher+plain_len));
-  }
-  else if(key->alg == TLS_aead_CHACHA20_POLY1305)
-  {
-    EverCrypt_Chacha20Poly1305_aead_encrypt(key->key, iv, ad_len, (uint8_t*)ad,
-        plain_len, (uint8_t*)plain, cipher, cipher + plain_len);
-  }
+  // plain == cipher is allowed by EverCrypt_AEAD
+  EverCrypt_Error_error_code e = EverCrypt_AEAD_encrypt_expand(aead_alg(key->alg), key->key, iv, 12,
+    (uint8_t*)ad, ad_len, (uint8_t*)plain, plain_len, cipher, cipher + plain_len);
+  if (e != EverCrypt_Error_Success) return 0;
 
 #if DEBUG
   printf("ENCRYPT %s\n", key->alg == TLS_aead_AES_128_GCM ? "AES128-GCM" : (key->alg == TLS_aead_AES_256_GCM ? "AES256-GCM" : "CHACHA20-POLY1305"));
@@ -327,21 +329,13 @@ int MITLS_CALLCONV quic_crypto_decrypt(quic_key *key, unsigned char *plain, uint
   if(cipher_len < quic_crypto_tag_length(key))
     return 0;
 
-  uint32_t r = 0, plain_len = cipher_len - quic_crypto_tag_length(key);
+  uint32_t plain_len = cipher_len - quic_crypto_tag_length(key);
 
-  if(key->alg == TLS_aead_AES_128_GCM)
-  {
-    r = EverCrypt_aes128_gcm_decrypt(key->key, iv, (uint8_t*)ad, ad_len, plain, plain_len, (uint8_t*)cipher, (uint8_t*)(cipher+plain_len));
-  }
-  else if(key->alg == TLS_aead_AES_256_GCM)
-  {
-    r = EverCrypt_aes256_gcm_decrypt(key->key, iv, (uint8_t*)ad, ad_len, plain, plain_len, (uint8_t*)cipher, (uint8_t*)(cipher+plain_len));
-  }
-  else if(key->alg == TLS_aead_CHACHA20_POLY1305)
-  {
-    r = 1 - EverCrypt_Chacha20Poly1305_aead_decrypt(key->key, iv, ad_len, (uint8_t*)ad,
-        plain_len, (uint8_t*)plain, cipher, (uint8_t*)(cipher+plain_len));
-  }
+  // In place (plain == cipher) is allowed; on failure, plain is zeroed
+  // before returning, so no unauthenticated plaintext is released.
+  EverCrypt_Error_error_code e = EverCrypt_AEAD_decrypt_expand(aead_alg(key->alg), key->key, iv, 12,
+    (uint8_t*)ad, ad_len, (uint8_t*)cipher, plain_len, (uint8_t*)(cipher+plain_len), plain);
+  int r = (e == EverCrypt_Error_Success);
 
 #if DEBUG
   printf("DECRYPT %X->%X %s\n", cipher, plain, r?"OK":"BAD");
@@ -55,7 +55,8 @@ int MITLS_CALLCONV quic_crypto_create(quic_key **key, mitls_aead alg, const unsi
 
 // AEAD-encrypts plain with additional data ad, using counter sn,
 // writing plain_len + 16 bytes to the output cipher. The input and
-// output buffer must not overlap.
+// output buffers must either be the same (in-place encryption) or not
+// overlap.
 //
 // The packet number sn is internally combined with the static IV
 // to form the 12-byte AEAD IV
@@ -65,7 +66,9 @@ int MITLS_CALLCONV quic_crypto_encrypt(quic_key *key, /*out*/ unsigned char *cip
 
 // AEAD-decrypts cipher and authenticate additional data ad, using
 // counter; when successful, writes cipher_len - 16 bytes to the
-// output plain. The input and output buffers must not overlap.
+// output plain. The input and output buffers must either be the same
+// (in-place decryption) or not overlap. On failure, the cipher_len - 16
+// bytes of plain are zeroed: no unauthenticated plaintext is released.
 int MITLS_CALLCONV quic_crypto_decrypt(quic_key *key, /*out*/ unsigned char *plain, uint64_t sn, const unsigned char *ad, uint32_t ad_len, const unsigned char *cipher, uint32_t cipher_len);
 
 // Compute a one time pad to obfuscate the packet number from the encrypted packet contents
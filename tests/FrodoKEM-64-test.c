@@ -1,9 +1,18 @@
 #include "Hacl_Frodo_KEM.h"
+#include "Hacl_Frodo_KEM_Vec256.h"
+#include "EverCrypt_Frodo_KEM.h"
+#include "EverCrypt_AutoConfig2.h"
 #include <stdio.h>
 #include <stdbool.h>
 
+typedef uint32_t (*keypair_t)(uint8_t *pk, uint8_t *sk);
+typedef uint32_t (*enc_t)(uint8_t *ct, uint8_t *ss, uint8_t *pk);
+typedef uint32_t (*dec_t)(uint8_t *ss, uint8_t *ct, uint8_t *sk);
+
+// Key generation and encapsulation use the first instance, decapsulation the
+// second; the shared secrets only match if both expand the same matrix A.
 bool
-test_frodo()
+test_frodo(keypair_t keypair, enc_t enc, dec_t dec)
 {
   uint8_t pk[976U];
   uint8_t sk[2016U];
@@ -11,9 +20,9 @@ test_frodo()
   uint8_t ss1[16U];
   uint8_t ss2[16U];
  
-  Hacl_Frodo_KEM_crypto_kem_keypair(pk, sk);
-  Hacl_Frodo_KEM_crypto_kem_enc(ct, ss1, pk);
-  Hacl_Frodo_KEM_crypto_kem_dec(ss2, ct, sk);
+  keypair(pk, sk);
+  enc(ct, ss1, pk);
+  dec(ss2, ct, sk);
   
   for (int i = 0; i < 16; i++) {
       if (ss1[i] != ss2[i]) {
@@ -26,7 +35,25 @@ test_frodo()
 
 int main()
 {
-  bool pass = test_frodo();
+  EverCrypt_AutoConfig2_init();
+  bool pass = test_frodo(Hacl_Frodo_KEM_crypto_kem_keypair,
+                         Hacl_Frodo_KEM_crypto_kem_enc,
+                         Hacl_Frodo_KEM_crypto_kem_dec);
+  pass = test_frodo(EverCrypt_Frodo_KEM_crypto_kem_keypair,
+                    EverCrypt_Frodo_KEM_crypto_kem_enc,
+                    EverCrypt_Frodo_KEM_crypto_kem_dec) && pass;
+  pass = test_frodo(EverCrypt_Frodo_KEM_crypto_kem_keypair,
+                    EverCrypt_Frodo_KEM_crypto_kem_enc,
+                    Hacl_Frodo_KEM_crypto_kem_dec) && pass;
+  if (EverCrypt_AutoConfig2_has_avx2())
+    {
+      pass = test_frodo(Hacl_Frodo_KEM_Vec256_crypto_kem_keypair,
+                        Hacl_Frodo_KEM_Vec256_crypto_kem_enc,
+                        Hacl_Frodo_KEM_crypto_kem_dec) && pass;
+      pass = test_frodo(Hacl_Frodo_KEM_crypto_kem_keypair,
+                        Hacl_Frodo_KEM_crypto_kem_enc,
+                        Hacl_Frodo_KEM_Vec256_crypto_kem_dec) && pass;
+    }
   if (pass)
     {
       printf("[FrodoKEM] Self-test: PASS\n");
@@ -0,0 +1,332 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_AEAD_Streaming.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+#include "chacha20poly1305_vectors.h"
+
+#define ROUNDS 20000
+#define SIZE   16384
+#define MANY   300
+#define MAXLEN 1500
+
+static const char *alg_name(Spec_Agile_AEAD_alg a) {
+  switch (a) {
+    case Spec_Agile_AEAD_AES128_GCM: return "AES128-GCM";
+    case Spec_Agile_AEAD_AES256_GCM: return "AES256-GCM";
+    default: return "Chacha20-Poly1305";
+  }
+}
+
+// Feeds `len` bytes in chunks of random sizes, some of them empty.
+typedef EverCrypt_Error_error_code (*update_t)(EverCrypt_AEAD_Streaming_state_s*,uint8_t*,uint32_t,uint8_t*);
+
+static bool update_chunks(EverCrypt_AEAD_Streaming_state_s* s, update_t f, uint8_t* in, uint32_t len, uint8_t* out) {
+  uint32_t off = 0;
+  while (off < len) {
+    uint32_t n = rand() % 4 == 0 ? rand() % 3 : rand() % 200;
+    if (n > len - off) n = len - off;
+    if (f(s, in + off, n, out + off) != EverCrypt_Error_Success) return false;
+    off += n;
+  }
+  return true;
+}
+
+static bool aad_chunks(EverCrypt_AEAD_Streaming_state_s* s, uint8_t* ad, uint32_t len) {
+  uint32_t off = 0;
+  while (off < len) {
+    uint32_t n = rand() % 40;
+    if (n > len - off) n = len - off;
+    if (EverCrypt_AEAD_Streaming_update_aad(s, ad + off, n) != EverCrypt_Error_Success) return false;
+    off += n;
+  }
+  return true;
+}
+
+// Compares random splits of random messages against the one-shot API.
+bool test_alg(Spec_Agile_AEAD_alg a) {
+  uint8_t key[32], iv[40], ad[256];
+  uint8_t plain[MAXLEN], cipher[MAXLEN], cipher1[MAXLEN], plain1[MAXLEN];
+  uint8_t tag[16], tag1[16];
+  EverCrypt_AEAD_state_s *s0 = NULL;
+  EverCrypt_AEAD_Streaming_state_s *s = NULL;
+  bool ok = true;
+
+  for (int i = 0; i < 32; i++) key[i] = (uint8_t)rand();
+  if (EverCrypt_AEAD_create_in(a, &s0, key) != EverCrypt_Error_Success ||
+      EverCrypt_AEAD_Streaming_create_in(a, &s, key) != EverCrypt_Error_Success) {
+    printf("%s not supported, skipping\n", alg_name(a));
+    return true;
+  }
+  ok = ok && EverCrypt_AEAD_Streaming_alg_of_state(s) == a;
+
+  for (int j = 0; j < MANY; j++) {
+    uint32_t iv_len = a == Spec_Agile_AEAD_CHACHA20_POLY1305 || j % 2 ? 12 : 1 + rand() % 40;
+    uint32_t ad_len = rand() % 256;
+    uint32_t len = j < 64 ? j : rand() % MAXLEN;
+    for (int i = 0; i < 40; i++) iv[i] = (uint8_t)rand();
+    for (int i = 0; i < 256; i++) ad[i] = (uint8_t)rand();
+    for (int i = 0; i < len; i++) plain[i] = (uint8_t)rand();
+
+    EverCrypt_AEAD_encrypt(s0, iv, iv_len, ad, ad_len, plain, len, cipher, tag);
+
+    ok = ok && EverCrypt_AEAD_Streaming_init(s, iv, iv_len) == EverCrypt_Error_Success;
+    ok = ok && aad_chunks(s, ad, ad_len);
+    if (j % 3 == 0) {
+      // In-place
+      memcpy(cipher1, plain, len);
+      ok = ok && update_chunks(s, EverCrypt_AEAD_Streaming_encrypt_update, cipher1, len, cipher1);
+    } else {
+      ok = ok && update_chunks(s, EverCrypt_AEAD_Streaming_encrypt_update, plain, len, cipher1);
+    }
+    ok = ok && EverCrypt_AEAD_Streaming_encrypt_finish(s, tag1) == EverCrypt_Error_Success;
+    ok = ok && memcmp(cipher, cipher1, len) == 0 && memcmp(tag, tag1, 16) == 0;
+
+    ok = ok && EverCrypt_AEAD_Streaming_init(s, iv, iv_len) == EverCrypt_Error_Success;
+    ok = ok && aad_chunks(s, ad, ad_len);
+    if (j % 3 == 1) {
+      memcpy(plain1, cipher, len);
+      ok = ok && update_chunks(s, EverCrypt_AEAD_Streaming_decrypt_update, plain1, len, plain1);
+    } else {
+      ok = ok && update_chunks(s, EverCrypt_AEAD_Streaming_decrypt_update, cipher, len, plain1);
+    }
+    ok = ok && EverCrypt_AEAD_Streaming_decrypt_finish(s, tag) == EverCrypt_Error_Success;
+    ok = ok && memcmp(plain, plain1, len) == 0;
+
+    // A modified tag must be rejected
+    ok = ok && EverCrypt_AEAD_Streaming_init(s, iv, iv_len) == EverCrypt_Error_Success;
+    ok = ok && aad_chunks(s, ad, ad_len);
+    ok = ok && update_chunks(s, EverCrypt_AEAD_Streaming_decrypt_update, cipher, len, plain1);
+    tag[j % 16] ^= 1 << (j % 8);
+    ok = ok && EverCrypt_AEAD_Streaming_decrypt_finish(s, tag) == EverCrypt_Error_AuthenticationFailure;
+  }
+
+  // Calls out of order are rejected
+  ok = ok && EverCrypt_AEAD_Streaming_encrypt_update(s, plain, 16, cipher) == EverCrypt_Error_InvalidState;
+  ok = ok && EverCrypt_AEAD_Streaming_init(s, iv, 12) == EverCrypt_Error_Success;
+  ok = ok && EverCrypt_AEAD_Streaming_encrypt_update(s, plain, 16, cipher) == EverCrypt_Error_Success;
+  ok = ok && EverCrypt_AEAD_Streaming_update_aad(s, ad, 16) == EverCrypt_Error_InvalidState;
+  ok = ok && EverCrypt_AEAD_Streaming_encrypt_finish(s, tag) == EverCrypt_Error_Success;
+  ok = ok && EverCrypt_AEAD_Streaming_encrypt_finish(s, tag) == EverCrypt_Error_InvalidState;
+  ok = ok && EverCrypt_AEAD_Streaming_init(s, iv, a == Spec_Agile_AEAD_CHACHA20_POLY1305 ? 16 : 0)
+    == EverCrypt_Error_InvalidIVLength;
+
+  printf("AEAD streaming (%s) Result:\n", alg_name(a));
+  if (ok) printf("Success!\n");
+  else printf("**FAILED**\n");
+
+  EverCrypt_AEAD_free(s0);
+  EverCrypt_AEAD_Streaming_free(s);
+  return ok;
+}
+
+// Splits buf into at most 8 fragments of random sizes.
+static uint32_t fragment(EverCrypt_AEAD_Streaming_iovec* v, uint8_t* buf, uint32_t len) {
+  uint32_t n = 0, off = 0;
+  while (off < len || n == 0) {
+    uint32_t l = n == 7 ? len - off : rand() % (len - off + 1);
+    v[n].iov_base = buf + off;
+    v[n].iov_len = l;
+    off += l;
+    n++;
+  }
+  return n;
+}
+
+bool test_iov(Spec_Agile_AEAD_alg a) {
+  uint8_t key[32], iv[12], ad[256];
+  uint8_t plain[MAXLEN], cipher[MAXLEN], cipher1[MAXLEN], plain1[MAXLEN];
+  uint8_t tag[16], tag1[16];
+  EverCrypt_AEAD_Streaming_iovec ad_v[8], in_v[8];
+  EverCrypt_AEAD_state_s *s0 = NULL;
+  EverCrypt_AEAD_Streaming_state_s *s = NULL;
+  bool ok = true;
+
+  for (int i = 0; i < 32; i++) key[i] = (uint8_t)rand();
+  if (EverCrypt_AEAD_create_in(a, &s0, key) != EverCrypt_Error_Success) return true;
+  EverCrypt_AEAD_Streaming_create_in(a, &s, key);
+
+  for (int j = 0; j < MANY; j++) {
+    uint32_t ad_len = rand() % 256;
+    uint32_t len = rand() % MAXLEN;
+    for (int i = 0; i < 12; i++) iv[i] = (uint8_t)rand();
+    for (int i = 0; i < 256; i++) ad[i] = (uint8_t)rand();
+    for (int i = 0; i < len; i++) plain[i] = (uint8_t)rand();
+
+    EverCrypt_AEAD_encrypt(s0, iv, 12, ad, ad_len, plain, len, cipher, tag);
+
+    uint32_t ad_n = fragment(ad_v, ad, ad_len);
+    uint32_t in_n = fragment(in_v, plain, len);
+    ok = ok && EverCrypt_AEAD_Streaming_encrypt_iov(s, iv, 12, ad_v, ad_n, in_v, in_n, cipher1, tag1)
+      == EverCrypt_Error_Success;
+    ok = ok && memcmp(cipher, cipher1, len) == 0 && memcmp(tag, tag1, 16) == 0;
+
+    in_n = fragment(in_v, cipher, len);
+    ok = ok && EverCrypt_AEAD_Streaming_decrypt_iov(s, iv, 12, ad_v, ad_n, in_v, in_n, plain1, tag)
+      == EverCrypt_Error_Success;
+    ok = ok && memcmp(plain, plain1, len) == 0;
+
+    // The output is zeroed on failure
+    tag[j % 16] ^= 1;
+    ok = ok && EverCrypt_AEAD_Streaming_decrypt_iov(s, iv, 12, ad_v, ad_n, in_v, in_n, plain1, tag)
+      == EverCrypt_Error_AuthenticationFailure;
+    for (int i = 0; i < len; i++) ok = ok && plain1[i] == 0;
+  }
+
+  printf("AEAD iovec (%s) Result:\n", alg_name(a));
+  if (ok) printf("Success!\n");
+  else printf("**FAILED**\n");
+
+  EverCrypt_AEAD_free(s0);
+  EverCrypt_AEAD_Streaming_free(s);
+  return ok;
+}
+
+// RFC 8439 vectors, one byte at a time.
+bool test_vectors() {
+  bool ok = true;
+  for (int i = 0; i < sizeof(vectors)/sizeof(chacha20poly1305_test_vector); ++i) {
+    chacha20poly1305_test_vector *v = &vectors[i];
+    EverCrypt_AEAD_Streaming_state_s *s = NULL;
+    uint8_t out[v->input_len + 1];
+    uint8_t tag[16];
+    EverCrypt_AEAD_Streaming_create_in(Spec_Agile_AEAD_CHACHA20_POLY1305, &s, v->key);
+    EverCrypt_AEAD_Streaming_init(s, v->nonce, 12);
+    for (int j = 0; j < v->aad_len; j++) EverCrypt_AEAD_Streaming_update_aad(s, v->aad + j, 1);
+    for (int j = 0; j < v->input_len; j++) EverCrypt_AEAD_Streaming_encrypt_update(s, v->input + j, 1, out + j);
+    EverCrypt_AEAD_Streaming_encrypt_finish(s, tag);
+    printf("AEAD streaming (Chacha20-Poly1305) Result (RFC 8439):\n");
+    ok = compare_and_print(v->input_len, out, v->cipher) && ok;
+    ok = compare_and_print(16, tag, v->tag) && ok;
+    EverCrypt_AEAD_Streaming_free(s);
+  }
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  srand(0xae4d);
+
+  bool ok = test_vectors();
+  ok = test_alg(Spec_Agile_AEAD_AES128_GCM) && ok;
+  ok = test_alg(Spec_Agile_AEAD_AES256_GCM) && ok;
+  ok = test_alg(Spec_Agile_AEAD_CHACHA20_POLY1305) && ok;
+  ok = test_iov(Spec_Agile_AEAD_AES128_GCM) && ok;
+  ok = test_iov(Spec_Agile_AEAD_AES256_GCM) && ok;
+  ok = test_iov(Spec_Agile_AEAD_CHACHA20_POLY1305) && ok;
+
+  uint8_t *plain = malloc(SIZE);
+  uint8_t *cipher = malloc(SIZE);
+  uint8_t key[32], iv[12], ad[16], tag[16];
+  memset(plain, 'P', SIZE);
+  memset(key, 'K', 32);
+  memset(iv, 'N', 12);
+  memset(ad, 'A', 16);
+  Spec_Agile_AEAD_alg algs[3] = { Spec_Agile_AEAD_AES128_GCM, Spec_Agile_AEAD_AES256_GCM, Spec_Agile_AEAD_CHACHA20_POLY1305 };
+  for (int k = 0; k < 3; k++) {
+    EverCrypt_AEAD_state_s *s0 = NULL;
+    EverCrypt_AEAD_Streaming_state_s *s = NULL;
+    if (EverCrypt_AEAD_create_in(algs[k], &s0, key) != EverCrypt_Error_Success) continue;
+    EverCrypt_AEAD_Streaming_create_in(algs[k], &s, key);
+    uint64_t res = 0;
+    cycles a, b;
+    clock_t t1, t2;
+
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      EverCrypt_AEAD_encrypt(s0, iv, 12, ad, 16, plain, SIZE, cipher, tag);
+      res ^= tag[0];
+    }
+    b = cpucycles_end();
+    t2 = clock();
+    clock_t tdiff1 = t2 - t1;
+    cycles cdiff1 = b - a;
+
+    // One message of ROUNDS * SIZE bytes
+    t1 = clock();
+    a = cpucycles_begin();
+    EverCrypt_AEAD_Streaming_init(s, iv, 12);
+    EverCrypt_AEAD_Streaming_update_aad(s, ad, 16);
+    for (int j = 0; j < ROUNDS; j++) {
+      EverCrypt_AEAD_Streaming_encrypt_update(s, plain, SIZE, cipher);
+      res ^= cipher[0];
+    }
+    EverCrypt_AEAD_Streaming_encrypt_finish(s, tag);
+    b = cpucycles_end();
+    t2 = clock();
+    clock_t tdiff2 = t2 - t1;
+    cycles cdiff2 = b - a;
+
+    uint64_t count = ROUNDS * SIZE;
+    printf("%s (one-shot) PERF: %d\n", alg_name(algs[k]), (int)res); print_time(count, tdiff1, cdiff1);
+    printf("%s (streaming) PERF:\n", alg_name(algs[k])); print_time(count, tdiff2, cdiff2);
+    EverCrypt_AEAD_free(s0);
+    EverCrypt_AEAD_Streaming_free(s);
+  }
+
+  // 1500-byte packets: 20-byte header, two payload fragments, 12-byte trailer
+  // and a 13-byte AAD in two pieces, against a copy into a linear buffer
+  uint8_t hdr[20], frag1[700], frag2[768], trailer[12], ad1[5], ad2[8], lin[1500], lin_ad[13];
+  memset(hdr, 'H', 20); memset(frag1, '1', 700); memset(frag2, '2', 768);
+  memset(trailer, 'T', 12); memset(ad1, 'A', 5); memset(ad2, 'B', 8);
+  EverCrypt_AEAD_Streaming_iovec pv[4] = { { hdr, 20 }, { frag1, 700 }, { frag2, 768 }, { trailer, 12 } };
+  EverCrypt_AEAD_Streaming_iovec av[2] = { { ad1, 5 }, { ad2, 8 } };
+  for (int k = 0; k < 3; k++) {
+    EverCrypt_AEAD_state_s *s0 = NULL;
+    EverCrypt_AEAD_Streaming_state_s *s = NULL;
+    if (EverCrypt_AEAD_create_in(algs[k], &s0, key) != EverCrypt_Error_Success) continue;
+    EverCrypt_AEAD_Streaming_create_in(algs[k], &s, key);
+    uint64_t res = 0;
+    cycles a, b;
+    clock_t t1, t2;
+
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS * 10; j++) {
+      memcpy(lin, hdr, 20); memcpy(lin + 20, frag1, 700);
+      memcpy(lin + 720, frag2, 768); memcpy(lin + 1488, trailer, 12);
+      memcpy(lin_ad, ad1, 5); memcpy(lin_ad + 5, ad2, 8);
+      EverCrypt_AEAD_encrypt(s0, iv, 12, lin_ad, 13, lin, 1500, cipher, tag);
+      res ^= tag[0];
+    }
+    b = cpucycles_end();
+    t2 = clock();
+    clock_t tdiff1 = t2 - t1;
+    cycles cdiff1 = b - a;
+
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS * 10; j++) {
+      EverCrypt_AEAD_Streaming_encrypt_iov(s, iv, 12, av, 2, pv, 4, cipher, tag);
+      res ^= tag[0];
+    }
+    b = cpucycles_end();
+    t2 = clock();
+    clock_t tdiff2 = t2 - t1;
+    cycles cdiff2 = b - a;
+
+    uint64_t count = ROUNDS * 10 * 1500;
+    printf("%s (copy + one-shot, 1500 bytes) PERF: %d\n", alg_name(algs[k]), (int)res); print_time(count, tdiff1, cdiff1);
+    printf("%s (iovec, 1500 bytes) PERF:\n", alg_name(algs[k])); print_time(count, tdiff2, cdiff2);
+    EverCrypt_AEAD_free(s0);
+    EverCrypt_AEAD_Streaming_free(s);
+  }
+
+  free(plain);
+  free(cipher);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,121 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+#include "chacha20poly1305_vectors.h"
+
+#define MANY   300
+#define MAXLEN 1500
+
+
+static const char *alg_name(Spec_Agile_AEAD_alg a) {
+  switch (a) {
+    case Spec_Agile_AEAD_AES128_GCM: return "AES128-GCM";
+    case Spec_Agile_AEAD_AES256_GCM: return "AES256-GCM";
+    case Spec_Agile_AEAD_AES128_GCM_SIV: return "AES128-GCM-SIV";
+    case Spec_Agile_AEAD_AES256_GCM_SIV: return "AES256-GCM-SIV";
+    default: return "Chacha20-Poly1305";
+  }
+}
+
+// RFC 8439 vectors, encrypted and decrypted in place.
+bool test_vectors() {
+  bool ok = true;
+  for (int i = 0; i < sizeof(vectors)/sizeof(chacha20poly1305_test_vector); ++i) {
+    chacha20poly1305_test_vector *v = &vectors[i];
+    uint8_t buf[v->input_len + 1];
+    uint8_t tag[16];
+    memcpy(buf, v->input, v->input_len);
+    EverCrypt_AEAD_encrypt_expand(Spec_Agile_AEAD_CHACHA20_POLY1305, v->key, v->nonce, 12,
+      v->aad, v->aad_len, buf, v->input_len, buf, tag);
+    printf("AEAD in-place (Chacha20-Poly1305) Result (RFC 8439):\n");
+    ok = compare_and_print(v->input_len, buf, v->cipher) && ok;
+    ok = compare_and_print(16, tag, v->tag) && ok;
+    EverCrypt_Error_error_code r = EverCrypt_AEAD_decrypt_expand(Spec_Agile_AEAD_CHACHA20_POLY1305,
+      v->key, v->nonce, 12, v->aad, v->aad_len, buf, v->input_len, tag, buf);
+    ok = r == EverCrypt_Error_Success && compare_and_print(v->input_len, buf, v->input) && ok;
+  }
+  return ok;
+}
+
+// In-place encryption and decryption agree with the out-of-place ones, and a
+// failed decryption releases nothing.
+bool test_in_place(Spec_Agile_AEAD_alg a) {
+  uint8_t key[32], iv[12], ad[64];
+  uint8_t plain[MAXLEN], cipher[MAXLEN], buf[MAXLEN];
+  uint8_t tag[16], tag1[16];
+  EverCrypt_AEAD_state_s *s = NULL;
+  bool ok = true;
+
+  for (int i = 0; i < 32; i++) key[i] = (uint8_t)rand();
+  if (EverCrypt_AEAD_create_in(a, &s, key) != EverCrypt_Error_Success) {
+    printf("%s not available, skipping in-place tests\n", alg_name(a));
+    return true;
+  }
+
+  for (int j = 0; j < MANY; j++) {
+    uint32_t ad_len = rand() % 64;
+    uint32_t len = rand() % MAXLEN;
+    for (int i = 0; i < 12; i++) iv[i] = (uint8_t)rand();
+    for (int i = 0; i < 64; i++) ad[i] = (uint8_t)rand();
+    for (int i = 0; i < len; i++) plain[i] = (uint8_t)rand();
+
+    EverCrypt_AEAD_encrypt(s, iv, 12, ad, ad_len, plain, len, cipher, tag);
+    memcpy(buf, plain, len);
+    ok = ok && EverCrypt_AEAD_encrypt(s, iv, 12, ad, ad_len, buf, len, buf, tag1)
+      == EverCrypt_Error_Success;
+    ok = ok && memcmp(buf, cipher, len) == 0 && memcmp(tag, tag1, 16) == 0;
+
+    ok = ok && EverCrypt_AEAD_decrypt(s, iv, 12, ad, ad_len, buf, len, tag, buf)
+      == EverCrypt_Error_Success;
+    ok = ok && memcmp(buf, plain, len) == 0;
+
+    // Out of place, then in place: the output is zeroed on failure
+    tag[j % 16] ^= 1;
+    memset(buf, 0xff, len);
+    ok = ok && EverCrypt_AEAD_decrypt(s, iv, 12, ad, ad_len, cipher, len, tag, buf)
+      == EverCrypt_Error_AuthenticationFailure;
+    for (int i = 0; i < len; i++) ok = ok && buf[i] == 0;
+    memcpy(buf, cipher, len);
+    ok = ok && EverCrypt_AEAD_decrypt(s, iv, 12, ad, ad_len, buf, len, tag, buf)
+      == EverCrypt_Error_AuthenticationFailure;
+    for (int i = 0; i < len; i++) ok = ok && buf[i] == 0;
+    memcpy(buf, cipher, len);
+    ok = ok && EverCrypt_AEAD_decrypt_expand(a, key, iv, 12, ad, ad_len, buf, len, tag, buf)
+      == EverCrypt_Error_AuthenticationFailure;
+    for (int i = 0; i < len; i++) ok = ok && buf[i] == 0;
+  }
+
+  printf("AEAD in-place (%s) Result:\n", alg_name(a));
+  if (ok) printf("Success!\n");
+  else printf("**FAILED**\n");
+
+  EverCrypt_AEAD_free(s);
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  srand(0xae4d);
+
+  bool ok = test_vectors();
+  ok = test_in_place(Spec_Agile_AEAD_AES128_GCM) && ok;
+  ok = test_in_place(Spec_Agile_AEAD_AES256_GCM) && ok;
+  ok = test_in_place(Spec_Agile_AEAD_CHACHA20_POLY1305) && ok;
+  ok = test_in_place(Spec_Agile_AEAD_AES128_GCM_SIV) && ok;
+  ok = test_in_place(Spec_Agile_AEAD_AES256_GCM_SIV) && ok;
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
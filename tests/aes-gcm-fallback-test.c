@@ -0,0 +1,225 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_CTR.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+
+#define MANY   200
+#define MAXLEN 1100
+#define MAXIV  40
+#define ROUNDS 2000
+#define SIZE   16384
+
+
+static const char *alg_name(Spec_Agile_AEAD_alg a) {
+  switch (a) {
+    case Spec_Agile_AEAD_AES128_GCM: return "AES128-GCM";
+    default: return "AES256-GCM";
+  }
+}
+
+// NIST GCM test cases 1 and 2 (zero key, zero IV).
+bool test_vectors() {
+  uint8_t key[16] = { 0 }, iv[12] = { 0 }, plain[16] = { 0 };
+  uint8_t cipher[16], tag[16];
+  uint8_t tag1[16] = {
+    0x58, 0xe2, 0xfc, 0xce, 0xfa, 0x7e, 0x30, 0x61, 0x36, 0x7f, 0x1d, 0x57, 0xa4, 0xe7, 0x45, 0x5a
+  };
+  uint8_t cipher2[16] = {
+    0x03, 0x88, 0xda, 0xce, 0x60, 0xb6, 0xa3, 0x92, 0xf3, 0x28, 0xc2, 0xb9, 0x71, 0xb2, 0xfe, 0x78
+  };
+  uint8_t tag2[16] = {
+    0xab, 0x6e, 0x47, 0xd4, 0x2c, 0xec, 0x13, 0xbd, 0xf5, 0x3a, 0x67, 0xb2, 0x12, 0x57, 0xbd, 0xdf
+  };
+  bool ok = true;
+
+  printf("AES128-GCM fallback Result (NIST test case 1):\n");
+  EverCrypt_AEAD_encrypt_expand(Spec_Agile_AEAD_AES128_GCM, key, iv, 12, NULL, 0, NULL, 0, NULL, tag);
+  ok = compare_and_print(16, tag, tag1) && ok;
+
+  printf("AES128-GCM fallback Result (NIST test case 2):\n");
+  EverCrypt_AEAD_encrypt_expand(Spec_Agile_AEAD_AES128_GCM, key, iv, 12, NULL, 0, plain, 16, cipher, tag);
+  ok = compare_and_print(16, cipher, cipher2) && ok;
+  ok = compare_and_print(16, tag, tag2) && ok;
+  return ok;
+}
+
+typedef struct {
+  uint32_t iv_len, ad_len, len;
+  uint8_t key[32], iv[MAXIV], ad[64], plain[MAXLEN], cipher[MAXLEN], tag[16];
+} gcm_case;
+
+static gcm_case cases[MANY];
+
+// Reference results, computed with AES-NI and PCLMULQDQ when available.
+static bool reference(Spec_Agile_AEAD_alg a) {
+  for (int j = 0; j < MANY; j++) {
+    gcm_case *c = &cases[j];
+    c->iv_len = j % 4 == 0 ? 12 : 1 + rand() % MAXIV;
+    c->ad_len = rand() % 64;
+    c->len = j < 4 ? j * 8 : rand() % MAXLEN;
+    for (int i = 0; i < 32; i++) c->key[i] = (uint8_t)rand();
+    for (int i = 0; i < MAXIV; i++) c->iv[i] = (uint8_t)rand();
+    for (int i = 0; i < 64; i++) c->ad[i] = (uint8_t)rand();
+    for (int i = 0; i < c->len; i++) c->plain[i] = (uint8_t)rand();
+    if (EverCrypt_AEAD_encrypt_expand(a, c->key, c->iv, c->iv_len, c->ad, c->ad_len,
+        c->plain, c->len, c->cipher, c->tag) != EverCrypt_Error_Success)
+      return false;
+  }
+  return true;
+}
+
+// The fallback agrees with the reference, through a state and through the
+// expand functions, in place, and zeroes the output of a failed decryption.
+bool test_fallback(Spec_Agile_AEAD_alg a, bool has_reference) {
+  uint8_t buf[MAXLEN], tag[16];
+  bool ok = true;
+
+  for (int j = 0; j < MANY; j++) {
+    gcm_case *c = &cases[j];
+    EverCrypt_AEAD_state_s *s = NULL;
+    ok = ok && EverCrypt_AEAD_create_in(a, &s, c->key) == EverCrypt_Error_Success;
+    if (!ok) break;
+    ok = ok && EverCrypt_AEAD_alg_of_state(s) == a;
+
+    memcpy(buf, c->plain, c->len);
+    ok = ok && EverCrypt_AEAD_encrypt(s, c->iv, c->iv_len, c->ad, c->ad_len, buf, c->len, buf, tag)
+      == EverCrypt_Error_Success;
+    if (has_reference) {
+      ok = ok && memcmp(buf, c->cipher, c->len) == 0 && memcmp(tag, c->tag, 16) == 0;
+    } else {
+      memcpy(c->cipher, buf, c->len);
+      memcpy(c->tag, tag, 16);
+    }
+    ok = ok && EverCrypt_AEAD_decrypt(s, c->iv, c->iv_len, c->ad, c->ad_len, buf, c->len, tag, buf)
+      == EverCrypt_Error_Success;
+    ok = ok && memcmp(buf, c->plain, c->len) == 0;
+
+    ok = ok && EverCrypt_AEAD_encrypt_expand(a, c->key, c->iv, c->iv_len, c->ad, c->ad_len,
+      c->plain, c->len, buf, tag) == EverCrypt_Error_Success;
+    ok = ok && memcmp(buf, c->cipher, c->len) == 0 && memcmp(tag, c->tag, 16) == 0;
+    ok = ok && EverCrypt_AEAD_decrypt_expand(a, c->key, c->iv, c->iv_len, c->ad, c->ad_len,
+      c->cipher, c->len, c->tag, buf) == EverCrypt_Error_Success;
+    ok = ok && memcmp(buf, c->plain, c->len) == 0;
+
+    tag[j % 16] ^= 1;
+    memset(buf, 0xff, c->len);
+    ok = ok && EverCrypt_AEAD_decrypt(s, c->iv, c->iv_len, c->ad, c->ad_len, c->cipher, c->len, tag, buf)
+      == EverCrypt_Error_AuthenticationFailure;
+    for (int i = 0; i < c->len; i++) ok = ok && buf[i] == 0;
+
+    ok = ok && EverCrypt_AEAD_encrypt(s, c->iv, 0, c->ad, c->ad_len, c->plain, c->len, buf, tag)
+      == EverCrypt_Error_InvalidIVLength;
+    EverCrypt_AEAD_free(s);
+  }
+
+  printf("%s fallback (%s) Result:\n", alg_name(a), has_reference ? "against AES-NI" : "round trip");
+  if (ok) printf("Success!\n");
+  else printf("**FAILED**\n");
+  return ok;
+}
+
+// EverCrypt_CTR falls back as well; with a 16-byte IV, the low 32 bits of the
+// counter block wrap around in the middle of a call.
+static uint8_t ctr_ref[MAXLEN];
+
+bool test_ctr(Spec_Agile_Cipher_cipher_alg a, uint32_t iv_len, bool reference) {
+  uint8_t key[32], iv[16], plain[MAXLEN], cipher[MAXLEN], block[16];
+  EverCrypt_CTR_state_s *s = NULL;
+  bool ok = true;
+
+  memset(key, 'K', 32);
+  memset(iv, 0xff, 16);
+  memset(plain, 'P', MAXLEN);
+  if (EverCrypt_CTR_create_in(a, &s, key, iv, iv_len, 3) != EverCrypt_Error_Success)
+    return !reference;
+  EverCrypt_CTR_update_block(s, block, plain);
+  EverCrypt_CTR_update_blocks(s, cipher, plain, MAXLEN - 16);
+  memmove(cipher + 16, cipher, MAXLEN - 16);
+  memcpy(cipher, block, 16);
+  EverCrypt_CTR_free(s);
+
+  if (reference) {
+    memcpy(ctr_ref, cipher, MAXLEN);
+    return true;
+  }
+  ok = memcmp(ctr_ref, cipher, MAXLEN) == 0;
+  printf("%s fallback (IV length %u) Result:\n", a == Spec_Agile_Cipher_AES128 ? "AES128-CTR" : "AES256-CTR", iv_len);
+  if (ok) printf("Success!\n");
+  else printf("**FAILED**\n");
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  srand(0x6c3);
+
+  bool has_reference = EverCrypt_AutoConfig2_has_aesni() && EverCrypt_AutoConfig2_has_pclmulqdq();
+  Spec_Agile_AEAD_alg algs[2] = { Spec_Agile_AEAD_AES128_GCM, Spec_Agile_AEAD_AES256_GCM };
+  Spec_Agile_Cipher_cipher_alg ciphers[2] = { Spec_Agile_Cipher_AES128, Spec_Agile_Cipher_AES256 };
+  bool ok = true;
+
+  for (int k = 0; k < 2; k++) {
+    EverCrypt_AutoConfig2_init();
+    bool r = has_reference && reference(algs[k]);
+    EverCrypt_AutoConfig2_disable_aesni();
+    EverCrypt_AutoConfig2_disable_pclmulqdq();
+    ok = test_fallback(algs[k], r) && ok;
+  }
+  ok = test_vectors() && ok;
+
+  for (int k = 0; k < 2; k++) {
+    for (uint32_t iv_len = 12; iv_len <= 16; iv_len += 4) {
+      EverCrypt_AutoConfig2_init();
+      bool r = test_ctr(ciphers[k], iv_len, true);
+      EverCrypt_AutoConfig2_disable_aesni();
+      EverCrypt_AutoConfig2_disable_pclmulqdq();
+      if (r && has_reference) ok = test_ctr(ciphers[k], iv_len, false) && ok;
+    }
+  }
+
+  uint8_t *plain = malloc(SIZE);
+  uint8_t *cipher = malloc(SIZE);
+  uint8_t key[32], iv[12], ad[16], tag[16];
+  memset(plain, 'P', SIZE);
+  memset(key, 'K', 32);
+  memset(iv, 'N', 12);
+  memset(ad, 'A', 16);
+  for (int k = 0; k < 2; k++) {
+    EverCrypt_AEAD_state_s *s = NULL;
+    if (EverCrypt_AEAD_create_in(algs[k], &s, key) != EverCrypt_Error_Success) continue;
+    uint64_t res = 0;
+    cycles c1, c2;
+    clock_t t1, t2;
+
+    t1 = clock();
+    c1 = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      EverCrypt_AEAD_encrypt(s, iv, 12, ad, 16, plain, SIZE, cipher, tag);
+      res ^= tag[0] ^ tag[15];
+    }
+    c2 = cpucycles_end();
+    t2 = clock();
+
+    uint64_t count = ROUNDS * SIZE;
+    printf("%s fallback (16384 bytes) PERF: %d\n", alg_name(algs[k]), (int)res);
+    print_time(count, t2 - t1, c2 - c1);
+    EverCrypt_AEAD_free(s);
+  }
+  free(plain);
+  free(cipher);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,121 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+#include "aes_gcm_siv_vectors.h"
+
+#define ROUNDS 2000
+#define SIZE   16384
+
+
+static const char *alg_name(Spec_Agile_AEAD_alg a) {
+  switch (a) {
+    case Spec_Agile_AEAD_AES128_GCM: return "AES128-GCM";
+    case Spec_Agile_AEAD_AES256_GCM: return "AES256-GCM";
+    case Spec_Agile_AEAD_AES128_GCM_SIV: return "AES128-GCM-SIV";
+    default: return "AES256-GCM-SIV";
+  }
+}
+
+// Through a state, then through the expand variants in place; a corrupted tag
+// is rejected and zeroes the output.
+bool test_vector(aes_gcm_siv_test_vector *v) {
+  Spec_Agile_AEAD_alg a =
+    v->key_len == 16 ? Spec_Agile_AEAD_AES128_GCM_SIV : Spec_Agile_AEAD_AES256_GCM_SIV;
+  EverCrypt_AEAD_state_s *s = NULL;
+  uint8_t cipher[v->input_len + 1], buf[v->input_len + 1];
+  uint8_t tag[16];
+  bool ok = true;
+
+  if (EverCrypt_AEAD_create_in(a, &s, v->key) != EverCrypt_Error_Success) {
+    printf("%s not available, skipping\n", alg_name(a));
+    return true;
+  }
+  ok = ok && EverCrypt_AEAD_alg_of_state(s) == a;
+
+  printf("%s Result (%zu bytes, %zu bytes of AAD):\n", alg_name(a), v->input_len, v->aad_len);
+  EverCrypt_AEAD_encrypt(s, v->nonce, 12, v->aad, v->aad_len, v->input, v->input_len, cipher, tag);
+  ok = compare_and_print(v->input_len, cipher, v->cipher) && ok;
+  ok = compare_and_print(16, tag, v->tag) && ok;
+  ok = EverCrypt_AEAD_decrypt(s, v->nonce, 12, v->aad, v->aad_len, cipher, v->input_len, tag, buf)
+    == EverCrypt_Error_Success && ok;
+  ok = compare_and_print(v->input_len, buf, v->input) && ok;
+
+  memcpy(buf, v->input, v->input_len);
+  ok = EverCrypt_AEAD_encrypt_expand(a, v->key, v->nonce, 12, v->aad, v->aad_len,
+    buf, v->input_len, buf, tag) == EverCrypt_Error_Success && ok;
+  ok = compare_and_print(v->input_len, buf, v->cipher) && ok;
+  ok = compare_and_print(16, tag, v->tag) && ok;
+  ok = EverCrypt_AEAD_decrypt_expand(a, v->key, v->nonce, 12, v->aad, v->aad_len,
+    buf, v->input_len, tag, buf) == EverCrypt_Error_Success && ok;
+  ok = compare_and_print(v->input_len, buf, v->input) && ok;
+
+  tag[0] ^= 1;
+  ok = EverCrypt_AEAD_decrypt(s, v->nonce, 12, v->aad, v->aad_len, cipher, v->input_len, tag, buf)
+    == EverCrypt_Error_AuthenticationFailure && ok;
+  for (int i = 0; i < v->input_len; i++) ok = ok && buf[i] == 0;
+
+  ok = EverCrypt_AEAD_encrypt(s, v->nonce, 16, v->aad, v->aad_len, v->input, v->input_len, cipher, tag)
+    == EverCrypt_Error_InvalidIVLength && ok;
+
+  EverCrypt_AEAD_free(s);
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+
+  bool ok = true;
+  for (int i = 0; i < sizeof(vectors)/sizeof(aes_gcm_siv_test_vector); ++i) {
+    ok = test_vector(&vectors[i]) && ok;
+  }
+
+  uint8_t *plain = malloc(SIZE);
+  uint8_t *cipher = malloc(SIZE);
+  uint8_t key[32], iv[12], ad[16], tag[16];
+  memset(plain, 'P', SIZE);
+  memset(key, 'K', 32);
+  memset(iv, 'N', 12);
+  memset(ad, 'A', 16);
+  Spec_Agile_AEAD_alg algs[4] = {
+    Spec_Agile_AEAD_AES128_GCM, Spec_Agile_AEAD_AES128_GCM_SIV,
+    Spec_Agile_AEAD_AES256_GCM, Spec_Agile_AEAD_AES256_GCM_SIV
+  };
+  for (int k = 0; k < 4; k++) {
+    EverCrypt_AEAD_state_s *s = NULL;
+    if (EverCrypt_AEAD_create_in(algs[k], &s, key) != EverCrypt_Error_Success) continue;
+    uint64_t res = 0;
+    cycles c1, c2;
+    clock_t t1, t2;
+
+    t1 = clock();
+    c1 = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      EverCrypt_AEAD_encrypt(s, iv, 12, ad, 16, plain, SIZE, cipher, tag);
+      res ^= tag[0] ^ tag[15];
+    }
+    c2 = cpucycles_end();
+    t2 = clock();
+
+    uint64_t count = ROUNDS * SIZE;
+    printf("%s (16384 bytes) PERF: %d\n", alg_name(algs[k]), (int)res);
+    print_time(count, t2 - t1, c2 - c1);
+    EverCrypt_AEAD_free(s);
+  }
+  free(plain);
+  free(cipher);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,742 @@
+#pragma once
+
+typedef struct {
+  uint32_t key_len;
+  uint8_t key[32];
+  uint8_t nonce[12];
+  uint8_t *input;
+  size_t input_len;
+  uint8_t *aad;
+  size_t aad_len;
+  uint8_t *cipher;
+  uint8_t tag[16];
+} aes_gcm_siv_test_vector;
+
+static uint8_t input1[1] = { 0 };
+
+static uint8_t aad1[1] = { 0 };
+
+static uint8_t cipher1[1] = { 0 };
+
+static uint8_t input2[8] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+static uint8_t aad2[1] = { 0 };
+
+static uint8_t cipher2[8] = {
+  0xb5, 0xd8, 0x39, 0x33, 0x0a, 0xc7, 0xb7, 0x86 };
+
+static uint8_t input3[12] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+static uint8_t aad3[1] = { 0 };
+
+static uint8_t cipher3[12] = {
+  0x73, 0x23, 0xea, 0x61, 0xd0, 0x59, 0x32, 0x26, 0x00, 0x47, 0xd9, 0x42 };
+
+static uint8_t input4[16] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+static uint8_t aad4[1] = { 0 };
+
+static uint8_t cipher4[16] = {
+  0x74, 0x3f, 0x7c, 0x80, 0x77, 0xab, 0x25, 0xf8, 0x62, 0x4e, 0x2e, 0x94, 0x85, 0x79, 0xcf, 0x77 };
+
+static uint8_t input5[32] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+static uint8_t aad5[1] = { 0 };
+
+static uint8_t cipher5[32] = {
+  0x84, 0xe0, 0x7e, 0x62, 0xba, 0x83, 0xa6, 0x58, 0x54, 0x17, 0x24, 0x5d, 0x7e, 0xc4, 0x13, 0xa9,
+  0xfe, 0x42, 0x7d, 0x63, 0x15, 0xc0, 0x9b, 0x57, 0xce, 0x45, 0xf2, 0xe3, 0x93, 0x6a, 0x94, 0x45 };
+
+static uint8_t input6[8] = {
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+static uint8_t aad6[1] = {
+  0x01 };
+
+static uint8_t cipher6[8] = {
+  0x1e, 0x6d, 0xab, 0xa3, 0x56, 0x69, 0xf4, 0x27 };
+
+static uint8_t input7[1] = { 0 };
+
+static uint8_t aad7[1] = { 0 };
+
+static uint8_t cipher7[1] = { 0 };
+
+static uint8_t input8[32] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+static uint8_t aad8[1] = { 0 };
+
+static uint8_t cipher8[32] = {
+  0x4a, 0x6a, 0x9d, 0xb4, 0xc8, 0xc6, 0x54, 0x92, 0x01, 0xb9, 0xed, 0xb5, 0x30, 0x06, 0xcb, 0xa8,
+  0x21, 0xec, 0x9c, 0xf8, 0x50, 0x94, 0x8a, 0x7c, 0x86, 0xc6, 0x8a, 0xc7, 0x53, 0x9d, 0x02, 0x7f };
+
+static uint8_t input9[32] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4d, 0xb9, 0x23, 0xdc, 0x79, 0x3e, 0xe6, 0x49, 0x7c, 0x76, 0xdc, 0xc0, 0x3a, 0x98, 0xe1, 0x08 };
+
+static uint8_t aad9[1] = { 0 };
+
+static uint8_t cipher9[32] = {
+  0xf3, 0xf8, 0x0f, 0x2c, 0xf0, 0xcb, 0x2d, 0xd9, 0xc5, 0x98, 0x4f, 0xcd, 0xa9, 0x08, 0x45, 0x6c,
+  0xc5, 0x37, 0x70, 0x3b, 0x5b, 0xa7, 0x03, 0x24, 0xa6, 0x79, 0x3a, 0x7b, 0xf2, 0x18, 0xd3, 0xea };
+
+static uint8_t input10[24] = {
+  0xeb, 0x36, 0x40, 0x27, 0x7c, 0x7f, 0xfd, 0x13, 0x03, 0xc7, 0xa5, 0x42, 0xd0, 0x2d, 0x3e, 0x4c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+static uint8_t aad10[1] = { 0 };
+
+static uint8_t cipher10[24] = {
+  0x18, 0xce, 0x4f, 0x0b, 0x8c, 0xb4, 0xd0, 0xca, 0xc6, 0x5f, 0xea, 0x8f, 0x79, 0x25, 0x7b, 0x20,
+  0x88, 0x8e, 0x53, 0xe7, 0x22, 0x99, 0xe5, 0x6d };
+
+static uint8_t input11[300] = {
+  0x76, 0xd4, 0x84, 0x39, 0x8d, 0xd8, 0xfe, 0x81, 0x92, 0xe7, 0x4b, 0xff, 0x2d, 0x96, 0x3f, 0x9c,
+  0xdc, 0x94, 0x4f, 0xb2, 0xb7, 0xbb, 0x55, 0x4b, 0x9d, 0x7e, 0x0d, 0xc9, 0x08, 0x9e, 0x84, 0xe2,
+  0x7e, 0x26, 0xc0, 0x26, 0x93, 0x96, 0xb2, 0x06, 0xb9, 0x37, 0xef, 0xc0, 0x82, 0x8f, 0x31, 0xc0,
+  0x10, 0x46, 0x31, 0xe3, 0xe8, 0x36, 0x0b, 0x1f, 0x20, 0xd5, 0x5b, 0x69, 0x0a, 0x93, 0xcf, 0x18,
+  0xff, 0xa0, 0x9b, 0x8a, 0x65, 0xa2, 0x9b, 0x77, 0xc7, 0x5a, 0xaa, 0xca, 0xcb, 0xc5, 0xfa, 0xc8,
+  0x75, 0x84, 0xef, 0x4e, 0x82, 0xd8, 0xfd, 0x21, 0x5a, 0x26, 0x56, 0x05, 0x4a, 0x31, 0x73, 0xe8,
+  0x39, 0x02, 0xa8, 0x0d, 0x74, 0x80, 0x0a, 0x40, 0xf4, 0x13, 0x5f, 0xc9, 0xf0, 0x56, 0x53, 0x68,
+  0xb1, 0x8a, 0x8f, 0x08, 0xbb, 0xbf, 0x30, 0xd6, 0x60, 0xea, 0x5c, 0x30, 0xa0, 0xce, 0x21, 0x5a,
+  0x82, 0xb5, 0x52, 0x7b, 0x0f, 0x6d, 0x7d, 0x74, 0x48, 0xcf, 0xb1, 0xbb, 0x35, 0xff, 0x3f, 0xb4,
+  0x85, 0x3e, 0x54, 0x13, 0x10, 0x83, 0x66, 0x7b, 0xea, 0x43, 0x7e, 0x45, 0x79, 0x84, 0xc7, 0xf9,
+  0xf2, 0xe9, 0x84, 0x07, 0xa5, 0xd7, 0x86, 0x64, 0xbd, 0xb1, 0xf0, 0x00, 0x80, 0xff, 0x92, 0xb9,
+  0xe4, 0xa1, 0x9b, 0x52, 0x74, 0x1d, 0xe9, 0x2c, 0x1f, 0x98, 0xba, 0xe7, 0xb3, 0xbc, 0xbd, 0xea,
+  0x4a, 0x05, 0x93, 0x8d, 0xdb, 0xbd, 0xcb, 0x14, 0xde, 0x78, 0x06, 0x8d, 0xdd, 0xd0, 0x66, 0xe4,
+  0xc0, 0x4c, 0x44, 0xd0, 0x77, 0x01, 0x11, 0x73, 0x84, 0xbd, 0x5f, 0x6c, 0x0c, 0xeb, 0x14, 0x9c,
+  0x7b, 0xdf, 0x4b, 0xdf, 0x67, 0xd1, 0x4a, 0xe5, 0x04, 0x8f, 0x69, 0x06, 0x7b, 0xef, 0xf4, 0x85,
+  0x67, 0x79, 0xc9, 0x81, 0xee, 0xbf, 0x3e, 0xb5, 0x6a, 0x7e, 0x21, 0x40, 0xec, 0xa6, 0xae, 0x0f,
+  0xf9, 0x36, 0x4d, 0xd2, 0x06, 0xab, 0xe6, 0x37, 0xff, 0x80, 0x05, 0x6f, 0xda, 0x9f, 0x86, 0x66,
+  0xfa, 0x9a, 0x24, 0x74, 0xdc, 0x45, 0x67, 0x97, 0x60, 0xf2, 0x8f, 0x63, 0x53, 0xbc, 0x09, 0x78,
+  0xff, 0x62, 0xfa, 0xa1, 0x62, 0x9a, 0xf0, 0x9d, 0x0e, 0x5d, 0x8e, 0x08 };
+
+static uint8_t aad11[37] = {
+  0x32, 0x0f, 0x8b, 0xa0, 0x3d, 0xf0, 0x19, 0xd5, 0x41, 0x26, 0x4f, 0xed, 0xf6, 0xe1, 0x2d, 0x64,
+  0x9f, 0x7f, 0x4d, 0x6c, 0x1c, 0xbb, 0xa7, 0xea, 0xa6, 0x8c, 0xb8, 0x0f, 0x6e, 0x7d, 0x93, 0x7f,
+  0xb8, 0xb2, 0xb5, 0x3a, 0x1e };
+
+static uint8_t cipher11[300] = {
+  0x90, 0x5f, 0x2e, 0x16, 0x3b, 0x81, 0x3e, 0x83, 0x0d, 0x40, 0xbe, 0xcc, 0x45, 0x12, 0xd6, 0x53,
+  0xbf, 0x87, 0xf2, 0x46, 0x05, 0xc0, 0x40, 0xa9, 0xb8, 0x84, 0x29, 0xfd, 0xa5, 0xb3, 0x50, 0xd7,
+  0x19, 0x57, 0xce, 0x32, 0x45, 0xb8, 0x9a, 0xdf, 0x9b, 0x0a, 0xc6, 0x87, 0xfc, 0x57, 0x95, 0x90,
+  0x18, 0x88, 0x05, 0xe9, 0xc9, 0x7b, 0xe3, 0x98, 0x4f, 0xe8, 0x63, 0x82, 0x5e, 0xbc, 0x56, 0x28,
+  0x86, 0x2e, 0xd5, 0x73, 0x94, 0x42, 0x1e, 0x24, 0x3f, 0x7f, 0x3f, 0x96, 0x61, 0xc9, 0x43, 0x93,
+  0x23, 0xa9, 0xd1, 0x19, 0xd9, 0x48, 0x1b, 0xd3, 0x44, 0x70, 0xb9, 0x02, 0xdb, 0x47, 0x11, 0x70,
+  0xf6, 0x38, 0x52, 0x8e, 0x22, 0x47, 0xba, 0xb6, 0x0a, 0xe4, 0x33, 0x1d, 0x40, 0x9f, 0x25, 0x05,
+  0xe5, 0xa6, 0x17, 0x8a, 0x31, 0x12, 0xfa, 0xbe, 0xc3, 0x29, 0xb3, 0x1c, 0x2d, 0xc2, 0x97, 0x45,
+  0x69, 0x6b, 0xc0, 0x90, 0x49, 0x23, 0xbf, 0x8c, 0xb6, 0x9a, 0xff, 0x2b, 0xa7, 0x16, 0x67, 0x09,
+  0x0a, 0x63, 0x7c, 0x6d, 0x55, 0x20, 0xcc, 0x77, 0x2d, 0x68, 0x06, 0x5e, 0x3c, 0xa9, 0x80, 0x69,
+  0x16, 0x4e, 0xea, 0x97, 0xfa, 0xc6, 0xd5, 0xea, 0x4f, 0x4f, 0xf2, 0xe5, 0xff, 0x4d, 0x94, 0x72,
+  0x29, 0xa2, 0x72, 0xd1, 0x77, 0x62, 0x94, 0x61, 0x04, 0xd2, 0x16, 0xe1, 0x12, 0x8f, 0x6d, 0x94,
+  0x2a, 0x8e, 0x87, 0xf8, 0xb0, 0x0e, 0x54, 0x56, 0x76, 0x5c, 0x96, 0x97, 0x56, 0xa1, 0x6e, 0x14,
+  0xc8, 0xeb, 0x57, 0xa5, 0x38, 0xcf, 0x0d, 0x4a, 0xb5, 0x34, 0x23, 0xd1, 0xff, 0xd9, 0x39, 0x64,
+  0x8b, 0x28, 0xdd, 0x51, 0x87, 0xec, 0x18, 0x21, 0x46, 0x9f, 0x9a, 0x42, 0x3b, 0xd6, 0x14, 0x1e,
+  0x72, 0x49, 0x0a, 0x21, 0xe5, 0x9b, 0x83, 0xd8, 0xb0, 0xf9, 0x63, 0x09, 0xed, 0x4d, 0x2d, 0x5a,
+  0x80, 0x1b, 0xa1, 0x11, 0x60, 0x2d, 0xb3, 0x58, 0xfe, 0x63, 0x43, 0xad, 0xb6, 0xbf, 0xdd, 0x5a,
+  0xf0, 0x93, 0x8b, 0x90, 0x40, 0x25, 0xef, 0x16, 0xf6, 0xe0, 0x48, 0x70, 0x56, 0xb8, 0x6e, 0xa1,
+  0x68, 0x09, 0xf0, 0x76, 0xd1, 0x52, 0xd3, 0xe7, 0xb0, 0xde, 0x78, 0x7a };
+
+static uint8_t input12[300] = {
+  0x90, 0x4f, 0x66, 0xc3, 0x72, 0x2b, 0x5d, 0x61, 0x04, 0xd0, 0x3f, 0x2f, 0xe5, 0x2c, 0xec, 0x7f,
+  0xd3, 0xcb, 0x3d, 0xae, 0x79, 0xff, 0xe6, 0x8d, 0x2f, 0xed, 0x98, 0x19, 0x01, 0x23, 0x72, 0x02,
+  0xd1, 0x72, 0xba, 0x39, 0x39, 0xff, 0xf5, 0xe0, 0x60, 0x61, 0x4c, 0xfc, 0x76, 0x61, 0x88, 0xf2,
+  0x0c, 0x3f, 0x7e, 0x48, 0xde, 0xa6, 0xdc, 0xef, 0x97, 0xd0, 0xbc, 0x8c, 0x50, 0xef, 0xae, 0x5f,
+  0x9c, 0x6b, 0x90, 0x6a, 0x84, 0xca, 0x39, 0x4f, 0xdf, 0x73, 0x46, 0xbb, 0xcb, 0x54, 0xdc, 0x57,
+  0x75, 0x9c, 0x3c, 0x4f, 0x60, 0x9d, 0x3f, 0x95, 0xcc, 0x89, 0x3b, 0xcb, 0x8b, 0x0d, 0x36, 0xb5,
+  0xcc, 0xc1, 0x9a, 0xde, 0x78, 0x30, 0x53, 0x1d, 0xfa, 0xa8, 0xd6, 0x8b, 0x8c, 0x63, 0xe5, 0x51,
+  0xd6, 0x47, 0xc9, 0x63, 0x3c, 0x92, 0x8c, 0x95, 0x8e, 0x45, 0x25, 0x87, 0xac, 0x5f, 0x88, 0xb8,
+  0x11, 0xe0, 0xda, 0x34, 0xa8, 0x9e, 0xfd, 0x50, 0x9f, 0xfa, 0xa1, 0xdd, 0xa9, 0xc3, 0xb3, 0x26,
+  0x6a, 0x89, 0x7e, 0x6c, 0x90, 0x67, 0xea, 0x20, 0x28, 0xf2, 0x2e, 0x42, 0x62, 0xd2, 0x09, 0xa8,
+  0x1d, 0x9e, 0xdc, 0xcf, 0xd4, 0x8f, 0x0c, 0xe2, 0x69, 0x69, 0xde, 0xa0, 0x2e, 0xa3, 0x8b, 0xac,
+  0x79, 0x63, 0x44, 0x77, 0x72, 0x94, 0xb8, 0x42, 0x54, 0x9d, 0x95, 0xb9, 0x94, 0x99, 0xa6, 0xee,
+  0x03, 0xd9, 0x8c, 0x97, 0xfb, 0x98, 0x48, 0xcd, 0x49, 0x28, 0x1b, 0x2c, 0xe2, 0x2f, 0x55, 0x38,
+  0xc0, 0xd0, 0x53, 0xea, 0x8b, 0x15, 0x31, 0xa9, 0x71, 0x71, 0x34, 0x63, 0xad, 0xf2, 0x36, 0xf0,
+  0x6d, 0xd0, 0x33, 0x0e, 0x03, 0x50, 0xd1, 0x0c, 0xd3, 0xd3, 0xca, 0x26, 0x26, 0xeb, 0x1a, 0xe8,
+  0x29, 0x6c, 0x2d, 0xcb, 0xe5, 0xa6, 0xc7, 0xfc, 0xb0, 0x96, 0xc0, 0xc6, 0x64, 0x4c, 0xa5, 0xeb,
+  0xcd, 0xa7, 0x37, 0x3d, 0x39, 0x07, 0x36, 0xf3, 0xba, 0x31, 0x43, 0x85, 0xc1, 0xf8, 0x86, 0x81,
+  0xe7, 0xca, 0x32, 0xc3, 0xa4, 0x23, 0x0c, 0xf8, 0x79, 0x3a, 0xd7, 0x53, 0x9f, 0xc7, 0x11, 0x26,
+  0x26, 0xe9, 0x82, 0x3a, 0xb9, 0x35, 0x49, 0x75, 0x5f, 0x38, 0x4f, 0xeb };
+
+static uint8_t aad12[37] = {
+  0x3a, 0xd3, 0x8f, 0xf9, 0xb1, 0xa7, 0xc2, 0x85, 0xdd, 0xa3, 0x6e, 0xcd, 0xf7, 0x9c, 0x2c, 0xf7,
+  0x40, 0x88, 0xa1, 0x80, 0x26, 0xbd, 0xa9, 0xde, 0xfa, 0x90, 0x31, 0x37, 0x0d, 0xfd, 0x04, 0x68,
+  0x97, 0x16, 0x5e, 0xc1, 0x24 };
+
+static uint8_t cipher12[300] = {
+  0xf3, 0xdc, 0x8d, 0x9e, 0xbb, 0xbc, 0xa4, 0xe6, 0x26, 0x05, 0x34, 0xe0, 0x29, 0xc7, 0x93, 0xe5,
+  0xe2, 0x02, 0x0a, 0x6c, 0xb1, 0x1b, 0x4e, 0x0b, 0x96, 0x9d, 0x03, 0x3f, 0xbf, 0xc0, 0x45, 0x3a,
+  0x32, 0x61, 0xb4, 0xe1, 0x6d, 0x6c, 0xba, 0x29, 0x7f, 0x62, 0x3c, 0xd5, 0x26, 0xfa, 0x3d, 0x7a,
+  0x3b, 0x7e, 0x9d, 0x1b, 0x22, 0xfd, 0x5b, 0x84, 0x58, 0x18, 0x16, 0xa7, 0x7c, 0x1f, 0x6a, 0x3d,
+  0x8f, 0xc9, 0xc5, 0xb6, 0x07, 0x43, 0x7a, 0x48, 0xe6, 0x6f, 0xf8, 0xb6, 0x03, 0x5e, 0x14, 0xb2,
+  0x5e, 0xab, 0xc8, 0x61, 0x4f, 0x32, 0x0b, 0x1f, 0x89, 0x1d, 0xab, 0x99, 0xc3, 0xed, 0xcb, 0x32,
+  0x34, 0xf3, 0xf8, 0x89, 0x14, 0xe4, 0xc0, 0x6b, 0xe9, 0x0c, 0xb8, 0x0d, 0x7a, 0x87, 0x28, 0x5e,
+  0x15, 0x51, 0xaa, 0xd2, 0x38, 0x20, 0x62, 0x72, 0x9e, 0xfe, 0xda, 0xee, 0xfc, 0xf2, 0x80, 0x1a,
+  0xa5, 0x4f, 0x0b, 0x0f, 0x91, 0xe2, 0xff, 0x14, 0x86, 0x88, 0x6e, 0x98, 0xdd, 0x94, 0xad, 0x57,
+  0xdb, 0x8b, 0x12, 0x01, 0x3a, 0xb6, 0x33, 0x5f, 0x75, 0x94, 0xe9, 0xf0, 0xe5, 0x5f, 0xd4, 0x6a,
+  0xea, 0x89, 0xb9, 0x8a, 0x4c, 0x4a, 0x71, 0x77, 0x3d, 0xa7, 0x1b, 0x42, 0x13, 0xf2, 0x77, 0x38,
+  0x71, 0x30, 0xca, 0x5f, 0x9a, 0xcd, 0x94, 0x1e, 0x95, 0xa3, 0xfb, 0x60, 0xee, 0x47, 0x21, 0x9f,
+  0xb5, 0xe0, 0xdd, 0x18, 0xc8, 0x13, 0xc3, 0x52, 0xb2, 0xfb, 0x28, 0x73, 0x95, 0x6c, 0x12, 0xde,
+  0xdf, 0x42, 0x40, 0x5d, 0x54, 0x4b, 0xd4, 0x05, 0xd6, 0x27, 0x81, 0x15, 0x90, 0x22, 0x18, 0x79,
+  0x1e, 0x97, 0x25, 0x04, 0xc5, 0x77, 0xd9, 0x3a, 0xb8, 0x47, 0x67, 0xb0, 0xc9, 0xcd, 0x6e, 0x14,
+  0xa1, 0x8b, 0x61, 0xf7, 0x86, 0xe4, 0x2e, 0xf6, 0x0e, 0x7e, 0x96, 0x55, 0x2e, 0x2b, 0x08, 0xd9,
+  0x0f, 0xd7, 0xa3, 0xdd, 0x5b, 0xb2, 0x47, 0xae, 0x09, 0x4d, 0x99, 0x3d, 0x9f, 0xa5, 0x5b, 0xad,
+  0xab, 0x9a, 0x38, 0x64, 0x9c, 0x99, 0x7d, 0x4c, 0xb1, 0x2d, 0x06, 0x51, 0xfc, 0xec, 0x8f, 0x02,
+  0x62, 0xa0, 0xb8, 0x36, 0x74, 0xf6, 0xfc, 0xb6, 0xa5, 0x9b, 0x17, 0x07 };
+
+static uint8_t input13[1029] = {
+  0xe5, 0x93, 0xce, 0x93, 0xbe, 0x7a, 0xf2, 0xe5, 0x2a, 0x5f, 0x04, 0x0a, 0xb8, 0x59, 0x27, 0xf1,
+  0xb4, 0x52, 0xa3, 0x25, 0xc9, 0x09, 0xb5, 0x52, 0x0b, 0xb3, 0xed, 0x86, 0x72, 0x97, 0x41, 0x6c,
+  0xcb, 0x26, 0xce, 0x6c, 0xf8, 0xc6, 0x99, 0x74, 0x58, 0x53, 0xdc, 0x22, 0x3b, 0xae, 0xd2, 0xd3,
+  0xd5, 0xf5, 0xf1, 0x9a, 0x23, 0x7a, 0xac, 0x3b, 0xb6, 0x91, 0xba, 0x6a, 0x9a, 0xab, 0xd0, 0x78,
+  0x71, 0x0b, 0x4f, 0xf2, 0x6a, 0x68, 0x98, 0x10, 0x2b, 0xba, 0x15, 0x3a, 0x34, 0xd7, 0xfe, 0xab,
+  0x7e, 0xa3, 0x7a, 0xdf, 0xb7, 0xa2, 0x7d, 0x5d, 0xa6, 0x7d, 0xba, 0x46, 0x19, 0xbe, 0x0e, 0x87,
+  0xc7, 0x81, 0x63, 0x06, 0x42, 0xe4, 0x28, 0xe1, 0x7a, 0xf6, 0x30, 0x6e, 0xbc, 0x0c, 0x9d, 0x8a,
+  0x01, 0x1c, 0xf0, 0x5b, 0x43, 0x12, 0xfa, 0x22, 0x2f, 0x54, 0xdb, 0x99, 0x50, 0xca, 0x2a, 0x26,
+  0x84, 0xd8, 0x0b, 0xb8, 0x48, 0x0a, 0x76, 0xe3, 0x24, 0x99, 0xba, 0xbb, 0x0d, 0x54, 0xab, 0x3c,
+  0xb5, 0x55, 0xf3, 0xb3, 0x1d, 0x45, 0x29, 0x4f, 0x7d, 0x6a, 0x16, 0xe9, 0x47, 0xce, 0x17, 0xcf,
+  0xd8, 0x84, 0xa4, 0x60, 0x3f, 0x1d, 0xca, 0xec, 0xa0, 0x75, 0xc6, 0x19, 0x04, 0xb4, 0x71, 0x83,
+  0x57, 0x23, 0xbb, 0xd9, 0xa6, 0x20, 0x0d, 0xb0, 0x4a, 0x20, 0x8e, 0x07, 0xd6, 0xc0, 0xbe, 0x77,
+  0xba, 0xc5, 0xd2, 0xca, 0x46, 0x6d, 0x63, 0xac, 0x43, 0x67, 0x7e, 0xcc, 0xe6, 0xff, 0xba, 0x3e,
+  0x05, 0xed, 0x27, 0xa6, 0x5c, 0xa1, 0x16, 0x6a, 0x6d, 0x06, 0xc7, 0x88, 0x46, 0x2c, 0x5d, 0xa5,
+  0xb4, 0xb5, 0xe7, 0x3f, 0xa6, 0x15, 0x71, 0x01, 0xe5, 0x4e, 0x08, 0x9f, 0x0c, 0x17, 0x08, 0x7d,
+  0xa8, 0x43, 0xd9, 0xdb, 0xae, 0x92, 0xac, 0x7f, 0xa8, 0xc2, 0xf8, 0x28, 0x99, 0x83, 0xb3, 0x1b,
+  0x24, 0xcf, 0xd3, 0xa5, 0x4c, 0x72, 0x9b, 0x91, 0x8f, 0x77, 0x5e, 0xbc, 0x4d, 0xe2, 0x2f, 0x14,
+  0x08, 0x3d, 0xa4, 0xdc, 0x54, 0x12, 0xf7, 0x44, 0x83, 0x8b, 0xa6, 0x5f, 0x26, 0x20, 0xb3, 0xc3,
+  0x8b, 0x82, 0x8a, 0x09, 0xbd, 0x70, 0x08, 0x50, 0xeb, 0x9a, 0x5a, 0x56, 0x32, 0xb1, 0xcf, 0x98,
+  0x23, 0x6b, 0x9f, 0xe3, 0x86, 0x0e, 0x31, 0x80, 0x84, 0xd4, 0x8a, 0xc5, 0xc2, 0x31, 0x05, 0xa2,
+  0xd6, 0xd6, 0xd8, 0xf5, 0x4c, 0x11, 0x78, 0x6b, 0xf1, 0xf1, 0xba, 0xe7, 0xa6, 0x1c, 0x00, 0x09,
+  0xc8, 0x08, 0x5b, 0x89, 0x6a, 0x6b, 0x8c, 0xc5, 0x94, 0x29, 0xd9, 0x0f, 0x00, 0xcf, 0xa4, 0x3e,
+  0xbd, 0x55, 0x88, 0x9c, 0x0d, 0x7e, 0xf8, 0xcc, 0x0f, 0x9d, 0x73, 0x9e, 0x55, 0x13, 0xe5, 0x81,
+  0xa9, 0x8c, 0xef, 0x04, 0x93, 0xde, 0x1b, 0xe8, 0x2a, 0xe5, 0xc9, 0x72, 0x20, 0x08, 0x43, 0x04,
+  0x25, 0xc0, 0xc1, 0x52, 0x65, 0xd2, 0x68, 0xf4, 0x9a, 0x91, 0x28, 0x57, 0x05, 0x72, 0x03, 0x8d,
+  0xcc, 0xaf, 0x46, 0x7f, 0x67, 0xa5, 0xab, 0xaa, 0xfb, 0x11, 0x09, 0x22, 0xf2, 0xa1, 0x4a, 0xe6,
+  0x9a, 0xd4, 0x11, 0x2a, 0xb1, 0x74, 0xc8, 0x7b, 0x3b, 0x9b, 0x54, 0xeb, 0x4c, 0xc8, 0x33, 0x4f,
+  0x6a, 0x1d, 0xc8, 0x03, 0x7e, 0xc1, 0x5e, 0x9e, 0x54, 0xfc, 0x45, 0x6c, 0x4f, 0x17, 0xef, 0x69,
+  0x9a, 0x99, 0xcf, 0x07, 0x26, 0x23, 0x33, 0x34, 0x12, 0xb0, 0x8d, 0x4e, 0xda, 0x7a, 0x4c, 0xf5,
+  0x4b, 0xc0, 0xb1, 0x79, 0xe2, 0xb7, 0x68, 0xdd, 0xa9, 0xab, 0x73, 0xcf, 0x43, 0x9c, 0xf0, 0x8f,
+  0x10, 0xea, 0xe2, 0x0d, 0x0e, 0x6c, 0x14, 0x5c, 0x93, 0xd0, 0xe0, 0x05, 0xbf, 0x1b, 0x4d, 0x0d,
+  0xd8, 0xfb, 0x94, 0x80, 0x61, 0xf9, 0xa4, 0x72, 0x67, 0xf6, 0xe7, 0x67, 0xf3, 0x4c, 0x97, 0xef,
+  0x95, 0x5d, 0xef, 0x6c, 0x12, 0xc7, 0x9c, 0x56, 0x34, 0x98, 0x0d, 0x51, 0xf7, 0x19, 0xca, 0x75,
+  0xa3, 0xf5, 0x0c, 0x9b, 0xda, 0xfc, 0xdd, 0x5e, 0x76, 0x50, 0x89, 0x2f, 0x0e, 0xa4, 0x4b, 0x0f,
+  0x93, 0xb7, 0xc4, 0xda, 0x57, 0xe9, 0xa0, 0x66, 0x71, 0x00, 0xca, 0xe1, 0xe4, 0x15, 0x8b, 0x8e,
+  0xf6, 0x09, 0x7b, 0x5a, 0x3d, 0xcb, 0xc7, 0x6d, 0x70, 0xb0, 0x3f, 0x7b, 0x94, 0x74, 0x9a, 0xcd,
+  0x13, 0x9d, 0x81, 0xc3, 0x10, 0x1b, 0x45, 0xd4, 0x15, 0x72, 0xf0, 0x08, 0xbd, 0x57, 0xa1, 0x91,
+  0x67, 0xaf, 0xc1, 0x73, 0xa9, 0x28, 0xb8, 0xdd, 0xb7, 0x95, 0x7f, 0x35, 0x1e, 0x1f, 0x3f, 0x75,
+  0x01, 0x8a, 0x89, 0xe5, 0xc7, 0x08, 0xd2, 0xad, 0x76, 0xdd, 0xa3, 0xf5, 0x29, 0x62, 0xfb, 0x95,
+  0x20, 0x4b, 0x1b, 0xd1, 0x0a, 0x4a, 0xff, 0x44, 0xce, 0xc0, 0x93, 0x03, 0x59, 0xdf, 0x50, 0x9c,
+  0x78, 0x95, 0xca, 0x14, 0x2f, 0xa7, 0x2a, 0x9b, 0x8a, 0x93, 0xd2, 0xfa, 0xdf, 0xeb, 0x5f, 0x01,
+  0x81, 0x60, 0x14, 0x55, 0xdd, 0x34, 0xca, 0x3a, 0xbd, 0x34, 0x3a, 0x9c, 0xf7, 0x4a, 0x69, 0xe4,
+  0x4d, 0x00, 0x1b, 0xc2, 0x28, 0x9e, 0x79, 0xf1, 0x43, 0x1e, 0x65, 0x92, 0x1b, 0x3e, 0x3b, 0x32,
+  0xb6, 0xe3, 0x93, 0x38, 0xd3, 0xdc, 0xf3, 0x54, 0xd0, 0x00, 0xf3, 0xd2, 0x7b, 0x27, 0x76, 0x99,
+  0x92, 0x8d, 0xab, 0xda, 0xa3, 0x9f, 0xb7, 0x8e, 0x30, 0x93, 0x89, 0xd5, 0x1c, 0x7d, 0x75, 0xdc,
+  0x7a, 0xaa, 0x14, 0x32, 0xc9, 0xe1, 0x8f, 0xb8, 0x4b, 0x22, 0x1a, 0x91, 0xb6, 0x97, 0x24, 0x20,
+  0xca, 0x19, 0xbe, 0x65, 0xe4, 0xf6, 0x25, 0x96, 0x71, 0x38, 0x78, 0x57, 0x17, 0xc5, 0x56, 0x14,
+  0x7d, 0x90, 0xf8, 0x58, 0x04, 0xce, 0x37, 0xa4, 0xf8, 0x3c, 0xe9, 0x2f, 0xd8, 0xb1, 0x3f, 0xc3,
+  0x6c, 0x08, 0xb2, 0xb1, 0x19, 0xac, 0x3e, 0x09, 0x8c, 0x17, 0xf9, 0xc7, 0x94, 0x5f, 0xd8, 0x0b,
+  0x18, 0x4c, 0x45, 0x67, 0x3c, 0x1f, 0x06, 0xb3, 0x5d, 0xb2, 0x4a, 0x9f, 0x3b, 0x85, 0xdc, 0x8c,
+  0x65, 0xfc, 0x46, 0x20, 0x75, 0x90, 0x9d, 0x4f, 0x1b, 0x58, 0x20, 0x91, 0xf8, 0xc2, 0x03, 0x3f,
+  0xbe, 0x73, 0xcc, 0x21, 0x2f, 0x7e, 0x51, 0xab, 0xd4, 0x84, 0x0b, 0xde, 0x6f, 0x13, 0xf0, 0x0b,
+  0x4d, 0x2b, 0x73, 0x4f, 0x71, 0x86, 0xea, 0xa9, 0xf1, 0x99, 0x6c, 0xfb, 0x28, 0x1e, 0xee, 0x4d,
+  0xe8, 0xc6, 0xbc, 0x97, 0x3b, 0xa9, 0xa2, 0xee, 0xcf, 0x1f, 0x6f, 0xd0, 0x4d, 0xad, 0x8e, 0x0a,
+  0x6b, 0x97, 0x11, 0x77, 0xb8, 0xa2, 0x03, 0x4d, 0x45, 0x40, 0xb0, 0x0f, 0xad, 0x28, 0xe5, 0x8c,
+  0x4e, 0xeb, 0x2e, 0x1a, 0x80, 0xd1, 0x13, 0x5b, 0xb2, 0x93, 0x25, 0xf1, 0x94, 0xed, 0xd1, 0x39,
+  0x35, 0x2f, 0x9d, 0xa6, 0x98, 0xf0, 0xa8, 0x92, 0x9c, 0x3a, 0xe2, 0x2f, 0x58, 0xfd, 0x6c, 0xec,
+  0xd6, 0x45, 0x99, 0xdb, 0xb6, 0x62, 0x2b, 0x58, 0x0b, 0xf8, 0x38, 0xb6, 0x22, 0x8e, 0xc3, 0x1f,
+  0x9e, 0x6f, 0xa8, 0xed, 0x9c, 0x28, 0x9b, 0xec, 0xb5, 0x6a, 0x0c, 0xbf, 0x3a, 0x1d, 0x74, 0x8f,
+  0x2e, 0xed, 0xee, 0x96, 0x4a, 0x69, 0x96, 0x4d, 0x8a, 0x8d, 0xfb, 0x9f, 0x17, 0x49, 0x7b, 0xba,
+  0xdb, 0xdf, 0xce, 0x4e, 0x9c, 0x23, 0xd9, 0xfb, 0xe5, 0x55, 0x13, 0x78, 0xa5, 0x71, 0xc5, 0x9d,
+  0x38, 0xff, 0xf9, 0x54, 0x2c, 0x08, 0x80, 0x27, 0x51, 0x8e, 0x51, 0xc7, 0x56, 0xc9, 0x53, 0xde,
+  0x5d, 0x57, 0x9d, 0x15, 0xce, 0x6b, 0x66, 0x4e, 0x3a, 0x4d, 0x34, 0x44, 0x5d, 0xe3, 0xc0, 0x22,
+  0xff, 0xba, 0x95, 0x11, 0xd5, 0x49, 0xfe, 0x94, 0xea, 0xc4, 0xd7, 0xf3, 0x52, 0xe7, 0x94, 0x1e,
+  0x70, 0x88, 0x2c, 0xaa, 0x5a };
+
+static uint8_t aad13[200] = {
+  0xc2, 0x73, 0x12, 0xeb, 0x75, 0x4a, 0x13, 0x15, 0x93, 0xa7, 0x5a, 0x7d, 0x57, 0x30, 0x4c, 0x06,
+  0xe5, 0x24, 0xa8, 0xac, 0x12, 0x94, 0xa6, 0x1e, 0x02, 0xf1, 0x7c, 0x6b, 0xe8, 0x17, 0x32, 0x5c,
+  0x00, 0xa1, 0x5a, 0x0c, 0x64, 0x48, 0xa4, 0x23, 0x7f, 0xe2, 0x6b, 0x7d, 0x91, 0x03, 0x48, 0x64,
+  0x93, 0xb7, 0xb1, 0x81, 0x66, 0xeb, 0x11, 0x14, 0xd5, 0xd9, 0xea, 0x0d, 0xc1, 0x64, 0xd5, 0x06,
+  0x4b, 0x15, 0x48, 0x37, 0x49, 0x98, 0xbd, 0xf0, 0x56, 0xf3, 0x18, 0x5a, 0x45, 0xe4, 0x64, 0x88,
+  0xed, 0x97, 0xd3, 0x91, 0x60, 0x70, 0xee, 0x33, 0x21, 0x90, 0x57, 0xfd, 0x05, 0x83, 0xc1, 0x42,
+  0x82, 0x99, 0x76, 0xec, 0xe2, 0x06, 0xcd, 0x08, 0x5a, 0x08, 0xfb, 0x59, 0xb5, 0x84, 0xca, 0x05,
+  0x8d, 0x85, 0x15, 0xf6, 0x6c, 0x2d, 0x60, 0x5b, 0x83, 0x78, 0xd3, 0xb7, 0x55, 0x2b, 0xb3, 0x41,
+  0x35, 0xe2, 0x84, 0xeb, 0x58, 0x07, 0xf0, 0x01, 0x8a, 0x54, 0xd6, 0xec, 0x33, 0xf4, 0x13, 0x84,
+  0x14, 0x04, 0xfa, 0xba, 0x42, 0x1f, 0x30, 0xcf, 0x05, 0xca, 0x32, 0xaf, 0xf1, 0xb4, 0xe1, 0x7a,
+  0xb7, 0x02, 0x43, 0xfc, 0x50, 0x15, 0xaa, 0x13, 0x00, 0x63, 0xe6, 0x2e, 0x2c, 0x4d, 0xfe, 0xcd,
+  0x48, 0x06, 0xc2, 0xdf, 0x5a, 0xf3, 0x11, 0x13, 0xd5, 0x90, 0x82, 0x9d, 0x3c, 0x17, 0xb7, 0x1c,
+  0x1d, 0x1d, 0xa9, 0xcf, 0x4e, 0xc7, 0xcb, 0x92 };
+
+static uint8_t cipher13[1029] = {
+  0x08, 0xc3, 0x89, 0x8d, 0x3d, 0x1c, 0x27, 0x3d, 0x87, 0x42, 0x7c, 0x2d, 0xe8, 0x3d, 0x10, 0x4e,
+  0x51, 0xae, 0xb1, 0x46, 0xa2, 0x1b, 0xd8, 0x28, 0xd4, 0x6e, 0x8a, 0x94, 0x90, 0xb5, 0x9b, 0x7f,
+  0xa4, 0xf9, 0x55, 0xdd, 0x44, 0xce, 0x88, 0xc7, 0xfc, 0x5b, 0xa0, 0xfd, 0x68, 0xe7, 0x20, 0x13,
+  0x9b, 0x1d, 0x73, 0x84, 0x6e, 0x36, 0x38, 0xa9, 0x17, 0x96, 0x10, 0x25, 0x8e, 0xc4, 0xa0, 0x8b,
+  0x6e, 0x9c, 0x3d, 0x86, 0xef, 0x57, 0x99, 0xfb, 0x35, 0xea, 0x2f, 0x4b, 0x99, 0xa3, 0xf4, 0xb6,
+  0xcb, 0x33, 0x2f, 0x6f, 0x60, 0x89, 0xe0, 0xcb, 0x2b, 0x2e, 0x5a, 0x85, 0xed, 0x17, 0x71, 0x71,
+  0x41, 0xec, 0x8f, 0x9c, 0xb4, 0xf6, 0xba, 0xb4, 0x14, 0x13, 0xe8, 0x80, 0x81, 0xf9, 0xe0, 0x7f,
+  0xda, 0x19, 0xbe, 0xc9, 0x18, 0x99, 0x8d, 0x1e, 0xba, 0xb6, 0x38, 0xd0, 0x1d, 0x86, 0x02, 0x93,
+  0xcb, 0x4e, 0xdf, 0x40, 0x8b, 0xf7, 0xed, 0x47, 0x4d, 0x81, 0x8d, 0xf3, 0xd5, 0x05, 0x8c, 0x49,
+  0x16, 0x5b, 0x26, 0x5f, 0x48, 0xa2, 0x82, 0xc5, 0xf8, 0x57, 0xfe, 0x5a, 0xe2, 0xc6, 0xa2, 0xc9,
+  0x5d, 0x06, 0xfe, 0x66, 0x9d, 0xbd, 0x46, 0xbe, 0x3d, 0x54, 0x42, 0x08, 0x96, 0x5e, 0xf5, 0x5f,
+  0xbb, 0x1b, 0x0e, 0x97, 0x82, 0x61, 0x8f, 0xaf, 0x39, 0xe6, 0xfc, 0xc2, 0x03, 0x20, 0x9e, 0x1f,
+  0x67, 0x66, 0xdb, 0x82, 0xd9, 0xce, 0x79, 0x0a, 0xa3, 0x7c, 0x6c, 0x35, 0xf5, 0x9e, 0xf9, 0xc0,
+  0xa4, 0x65, 0xfd, 0x97, 0x3a, 0x0c, 0x85, 0xc8, 0xbb, 0xb0, 0xaa, 0x4a, 0xcc, 0x31, 0x58, 0x00,
+  0xea, 0x6c, 0x19, 0x2e, 0xd9, 0x83, 0xc3, 0x9d, 0x3b, 0x25, 0x33, 0x61, 0x28, 0x55, 0x71, 0xf4,
+  0x81, 0x6d, 0xb0, 0x27, 0x3f, 0xa9, 0xa8, 0x9d, 0x55, 0x1d, 0x98, 0x87, 0xce, 0xb4, 0x67, 0x20,
+  0xed, 0xca, 0x89, 0x59, 0x15, 0x7c, 0x20, 0x91, 0xee, 0x5d, 0x7b, 0x1f, 0x8c, 0x12, 0xe2, 0x1e,
+  0x87, 0x44, 0xaf, 0x0f, 0xf4, 0xee, 0xc2, 0x28, 0xe3, 0x5d, 0xa5, 0x97, 0x92, 0x9f, 0x73, 0x6a,
+  0x59, 0xc0, 0xbf, 0x1c, 0x4c, 0x7a, 0x7c, 0x35, 0x83, 0xcd, 0xe1, 0xce, 0x6d, 0xa3, 0xdf, 0x09,
+  0xeb, 0xb1, 0xbd, 0xd1, 0x1b, 0x5c, 0x50, 0xb6, 0xa2, 0x6e, 0xf1, 0x68, 0x0f, 0x25, 0xc6, 0x08,
+  0x34, 0x47, 0xd1, 0x81, 0xef, 0x5c, 0xf6, 0x09, 0xd4, 0x15, 0x68, 0x9d, 0x7b, 0xef, 0x44, 0xcb,
+  0x1e, 0xca, 0x77, 0x81, 0xb5, 0xb8, 0x8b, 0x3c, 0xca, 0xd1, 0xab, 0xa7, 0x90, 0x79, 0xbf, 0x77,
+  0xb5, 0xf3, 0x07, 0x38, 0xe7, 0xef, 0xfc, 0xee, 0xbf, 0xe9, 0xcd, 0x39, 0x11, 0x4f, 0xf2, 0x4b,
+  0x5d, 0x59, 0x7a, 0xd7, 0xda, 0x72, 0xef, 0xd6, 0x5a, 0x0f, 0xe1, 0x63, 0xe6, 0xe3, 0xd5, 0x3f,
+  0x51, 0x21, 0x94, 0x7b, 0x69, 0x8c, 0x93, 0xd4, 0xa7, 0xbd, 0xfc, 0xd9, 0x52, 0xf7, 0x27, 0x1a,
+  0x10, 0xcb, 0x80, 0xb3, 0x17, 0x21, 0x33, 0xc2, 0xd2, 0xad, 0x29, 0x85, 0xec, 0x51, 0x02, 0xe7,
+  0xa6, 0xf4, 0xb3, 0x0c, 0xc3, 0xf9, 0x5e, 0x3a, 0xdb, 0x0e, 0x79, 0x9c, 0xd7, 0x3f, 0x8c, 0x98,
+  0x87, 0x98, 0xe9, 0xa3, 0xf9, 0x1e, 0x5b, 0x19, 0xee, 0x9c, 0xff, 0x6f, 0x5f, 0xd1, 0xff, 0x94,
+  0xd6, 0x92, 0x6e, 0xec, 0x24, 0x80, 0xbd, 0x38, 0xc8, 0x99, 0x5b, 0x2e, 0xb7, 0xab, 0x3b, 0x06,
+  0x78, 0x84, 0x64, 0x40, 0xf1, 0xb2, 0x50, 0x41, 0x54, 0xfe, 0x44, 0xa5, 0x9d, 0xcc, 0x2d, 0x94,
+  0x3c, 0xd0, 0xb0, 0xab, 0xfc, 0x6c, 0xfd, 0xbe, 0x7c, 0x3a, 0xe8, 0xbe, 0x6d, 0x89, 0xe2, 0xe4,
+  0x23, 0xf7, 0xbd, 0xac, 0xe2, 0x92, 0xbb, 0x5a, 0xda, 0x02, 0xd9, 0xd7, 0x4e, 0xbc, 0x27, 0x90,
+  0x57, 0x1e, 0x55, 0x52, 0xe1, 0x9b, 0x1e, 0x3a, 0xba, 0x6f, 0x1d, 0x9f, 0x57, 0x66, 0xd9, 0x7a,
+  0x75, 0x0a, 0x7d, 0x04, 0xbc, 0x62, 0xd0, 0x23, 0xb8, 0x71, 0x4d, 0x82, 0x9e, 0x4d, 0x99, 0x08,
+  0xfb, 0x15, 0x91, 0x96, 0x64, 0xcf, 0x1f, 0x20, 0x0b, 0xee, 0x4e, 0x1f, 0xcb, 0x27, 0xf7, 0x63,
+  0x02, 0x2e, 0x13, 0x32, 0x51, 0x0f, 0xe9, 0x1a, 0x29, 0xd6, 0x86, 0x84, 0x86, 0x16, 0x1e, 0x21,
+  0x24, 0x1e, 0xea, 0x2e, 0x85, 0xd3, 0x88, 0x18, 0x3c, 0xef, 0x13, 0x38, 0x46, 0xe8, 0x11, 0x5d,
+  0x6a, 0xce, 0xd1, 0xa1, 0xe4, 0x4f, 0x22, 0x26, 0xb8, 0xa3, 0xed, 0x26, 0xd6, 0xba, 0x3a, 0xa1,
+  0x54, 0x4f, 0x45, 0xb0, 0xc1, 0xf0, 0x53, 0x2e, 0x53, 0xa8, 0xd6, 0xb4, 0x30, 0xf2, 0x04, 0xd4,
+  0xae, 0x7e, 0xd7, 0xe0, 0x70, 0x6a, 0x57, 0xbf, 0x8b, 0x42, 0x0e, 0x84, 0xdf, 0x49, 0xaf, 0xfc,
+  0x06, 0xd3, 0x07, 0x66, 0xc6, 0x6a, 0x34, 0x66, 0x43, 0xc0, 0x5a, 0xa9, 0xc0, 0x1f, 0x6b, 0x21,
+  0x62, 0xb5, 0xa2, 0xdf, 0xd6, 0x2e, 0x0c, 0x77, 0x06, 0xb9, 0x09, 0x22, 0xa2, 0x07, 0xc3, 0x5b,
+  0x60, 0xd3, 0x93, 0x2b, 0xa7, 0x28, 0xed, 0xbc, 0x32, 0x8d, 0x41, 0xc8, 0x9b, 0xfc, 0xd9, 0x56,
+  0x82, 0x33, 0x62, 0xcb, 0x4d, 0x5b, 0xab, 0x32, 0x5b, 0x52, 0xae, 0x21, 0xa6, 0x8e, 0xa2, 0x85,
+  0x64, 0x27, 0x05, 0x20, 0x46, 0x08, 0xf9, 0xd8, 0x02, 0xd8, 0x48, 0xf8, 0x3a, 0x05, 0xe0, 0x03,
+  0x67, 0xe1, 0x4c, 0xe3, 0x69, 0xf4, 0xf2, 0xf5, 0x16, 0x10, 0x00, 0x71, 0x3d, 0x20, 0x93, 0x6e,
+  0x9c, 0x02, 0x36, 0x58, 0x90, 0x68, 0xd2, 0xf9, 0xf1, 0xad, 0x0b, 0x5f, 0x5a, 0x30, 0x32, 0x1d,
+  0x71, 0x14, 0xc9, 0x2a, 0x69, 0x11, 0xef, 0x6e, 0xcb, 0x5c, 0x7e, 0xd6, 0x2d, 0x0b, 0x88, 0x6a,
+  0x3d, 0x1d, 0x60, 0xc2, 0x3e, 0x50, 0x16, 0x51, 0x6d, 0xd2, 0xb7, 0xa1, 0x31, 0xb7, 0xd3, 0xca,
+  0x72, 0xe7, 0x6f, 0x9f, 0x63, 0xd4, 0x5d, 0xfd, 0x10, 0x91, 0xde, 0xee, 0x33, 0x3c, 0x35, 0x87,
+  0x26, 0x35, 0xf4, 0x85, 0xc8, 0x8c, 0x05, 0xef, 0x08, 0x25, 0x15, 0x9a, 0xc1, 0x87, 0x00, 0x6e,
+  0x72, 0x3d, 0x78, 0x41, 0xca, 0x17, 0xb0, 0x4a, 0x92, 0x49, 0x54, 0xb3, 0xb8, 0x3a, 0xdd, 0xc8,
+  0x07, 0x34, 0x9f, 0x78, 0x34, 0x36, 0x2a, 0x29, 0xae, 0x8f, 0x43, 0x46, 0x02, 0x65, 0x2e, 0x70,
+  0x97, 0x93, 0x80, 0x01, 0xbc, 0x9a, 0xdb, 0x5d, 0x15, 0xb2, 0xde, 0xda, 0x2d, 0xf1, 0xa0, 0xb0,
+  0x78, 0xef, 0xdf, 0x52, 0x43, 0xda, 0x3b, 0x03, 0x68, 0x25, 0x65, 0xd2, 0x0b, 0xe1, 0x84, 0xa8,
+  0x7b, 0x13, 0x44, 0x9f, 0x02, 0x49, 0x6d, 0xb9, 0xf5, 0x0f, 0x5a, 0x7f, 0xfd, 0x1f, 0x94, 0x9a,
+  0x96, 0x26, 0xa4, 0xf3, 0x2b, 0xaa, 0xfd, 0x21, 0xf9, 0x72, 0x25, 0x7f, 0x72, 0xff, 0x53, 0xf0,
+  0xf8, 0xfb, 0xd0, 0x68, 0x12, 0xf6, 0xcc, 0x31, 0x10, 0xf8, 0x4d, 0x30, 0xf7, 0x64, 0x43, 0x1d,
+  0xfd, 0x6a, 0x84, 0xf7, 0xf3, 0xf9, 0x3f, 0x19, 0xfa, 0x35, 0x62, 0x4f, 0x14, 0x68, 0x97, 0x20,
+  0xac, 0x1c, 0x78, 0xa0, 0x2c, 0xca, 0x5e, 0x0a, 0x8c, 0xb2, 0xf6, 0xc7, 0x7f, 0xc8, 0xda, 0x58,
+  0x32, 0xad, 0x85, 0x65, 0xb0, 0xd4, 0xfc, 0x8b, 0x16, 0x88, 0x20, 0x0c, 0x91, 0xdd, 0x8f, 0x20,
+  0x1b, 0x57, 0x51, 0x8b, 0x42, 0xb1, 0xd9, 0x18, 0x8e, 0xa5, 0xf5, 0xb3, 0x76, 0xd6, 0x30, 0xe4,
+  0x4e, 0x83, 0x69, 0xda, 0x30, 0x71, 0xd7, 0x9d, 0xaf, 0x57, 0x9f, 0x27, 0xf0, 0x98, 0xe2, 0x7c,
+  0xd2, 0xd5, 0x5e, 0xda, 0x42, 0xee, 0x78, 0xd1, 0x00, 0x5f, 0x51, 0x7b, 0x37, 0x90, 0xbc, 0xd6,
+  0x98, 0x49, 0x09, 0x32, 0x63 };
+
+static uint8_t input14[1029] = {
+  0xc9, 0x50, 0xf0, 0x6f, 0x70, 0xb1, 0x1c, 0xd4, 0xf4, 0x43, 0x6b, 0x30, 0xec, 0x40, 0x81, 0x70,
+  0xb5, 0x47, 0xf4, 0xe0, 0x9c, 0xb4, 0xf1, 0x7a, 0x22, 0xb1, 0x5f, 0xf1, 0xff, 0xa4, 0x26, 0xf3,
+  0x1a, 0x34, 0xbd, 0x36, 0xbb, 0xbb, 0x10, 0x26, 0x02, 0xe4, 0xed, 0x7f, 0x75, 0xe9, 0xbc, 0xad,
+  0x8a, 0x6a, 0x44, 0x4f, 0xa7, 0xdd, 0xe6, 0x52, 0x01, 0x88, 0x23, 0x90, 0x50, 0xda, 0xcc, 0x9e,
+  0x8a, 0x7f, 0xbc, 0x21, 0x05, 0x1f, 0x3b, 0x79, 0x37, 0xa4, 0x16, 0x17, 0xea, 0x80, 0xc5, 0x71,
+  0xcf, 0x34, 0x35, 0x82, 0x36, 0x0f, 0xaf, 0xee, 0x4e, 0x4d, 0x12, 0x38, 0x69, 0x15, 0xf7, 0x8c,
+  0x38, 0x4c, 0x08, 0x4d, 0x8e, 0x5a, 0x21, 0x55, 0x33, 0x89, 0xc7, 0x0b, 0x04, 0xb4, 0x4f, 0x70,
+  0x4b, 0xea, 0x97, 0xb9, 0x81, 0xe6, 0x78, 0x90, 0x62, 0xe0, 0x3b, 0x94, 0xc5, 0x94, 0x44, 0x35,
+  0x1e, 0xf7, 0xf9, 0x7b, 0x0e, 0x45, 0x70, 0xb9, 0x19, 0x10, 0x78, 0xec, 0x1e, 0xaa, 0xe5, 0xb2,
+  0xa0, 0xd6, 0xf0, 0xe7, 0x39, 0xab, 0x5d, 0x45, 0x2b, 0xcc, 0x5b, 0x74, 0xfc, 0x2f, 0x41, 0xe6,
+  0x42, 0x2f, 0x4b, 0xb3, 0x4e, 0x34, 0x78, 0xfb, 0x7c, 0xbf, 0xe1, 0x37, 0xe9, 0x4a, 0x4b, 0x99,
+  0xe1, 0x62, 0x20, 0x80, 0x8f, 0xe3, 0x65, 0x5e, 0x3d, 0xd1, 0x03, 0x0c, 0xbb, 0x3d, 0x69, 0x09,
+  0x8b, 0x82, 0x45, 0x53, 0xc8, 0x2c, 0x32, 0xbf, 0x98, 0xde, 0x8d, 0x00, 0x5d, 0xff, 0xd6, 0x0e,
+  0x1d, 0x2f, 0xf9, 0x96, 0xe5, 0x2c, 0x04, 0xb7, 0x8e, 0x45, 0xa6, 0x1e, 0x91, 0x3c, 0xba, 0xc2,
+  0xff, 0x25, 0x2c, 0x25, 0xb4, 0xc8, 0x89, 0x8f, 0x92, 0x0e, 0x8c, 0x65, 0xe5, 0xc5, 0x9b, 0x9a,
+  0x2b, 0x7e, 0x14, 0x34, 0x4b, 0x6e, 0xac, 0x35, 0x3b, 0xa7, 0x21, 0x45, 0xc1, 0x59, 0x29, 0xef,
+  0x60, 0xc0, 0x65, 0x62, 0x1d, 0xe3, 0xe7, 0xbb, 0x5e, 0x4f, 0xa6, 0xdd, 0xfd, 0xe9, 0x9e, 0x56,
+  0xfa, 0xe3, 0x70, 0x2d, 0x58, 0xc9, 0xb0, 0x0d, 0x6e, 0xe0, 0x76, 0x68, 0x65, 0x16, 0xf9, 0x1e,
+  0x34, 0x02, 0x39, 0x99, 0xf3, 0x18, 0x54, 0x58, 0xa0, 0x13, 0x34, 0xac, 0x9f, 0xa1, 0x67, 0x09,
+  0x9f, 0x51, 0xc4, 0xc6, 0x65, 0x4b, 0xea, 0xb4, 0x92, 0xcd, 0xf8, 0x44, 0x1e, 0x0c, 0x93, 0xe4,
+  0x6a, 0x48, 0x96, 0x72, 0x37, 0x5f, 0xc3, 0x7d, 0xeb, 0xa1, 0x4a, 0x88, 0xa6, 0x1d, 0x71, 0xee,
+  0x11, 0x43, 0x28, 0x45, 0xd2, 0x6e, 0x40, 0x9b, 0xe7, 0x74, 0x12, 0x2a, 0x18, 0x37, 0x04, 0x18,
+  0x50, 0x97, 0xd4, 0xc0, 0xaf, 0x85, 0x2f, 0xa8, 0x17, 0xd8, 0x11, 0x85, 0x39, 0x75, 0xc6, 0x06,
+  0x08, 0x12, 0x61, 0x7c, 0x44, 0xd3, 0x97, 0x8f, 0xb4, 0x51, 0xc7, 0x9d, 0x74, 0xab, 0x7d, 0x43,
+  0xb9, 0xe1, 0xf9, 0x46, 0x22, 0x78, 0xe0, 0x2c, 0x21, 0x58, 0xd8, 0x09, 0x41, 0x38, 0x4f, 0xb0,
+  0xb3, 0xe0, 0xdc, 0xe6, 0xd2, 0x8c, 0x88, 0x02, 0x05, 0x75, 0x39, 0xd6, 0x1c, 0xef, 0xfe, 0x26,
+  0x4d, 0xc7, 0x2b, 0x6d, 0x53, 0x36, 0x88, 0x05, 0x0f, 0xc7, 0x5c, 0x57, 0x2b, 0x21, 0xc5, 0x42,
+  0xe9, 0xe5, 0x5a, 0xc7, 0x16, 0x9b, 0x60, 0x9f, 0xfd, 0x20, 0x49, 0x5d, 0x93, 0x07, 0xcf, 0x18,
+  0xdd, 0x31, 0xce, 0x8b, 0x78, 0x24, 0x0b, 0xb5, 0x1d, 0x0c, 0x42, 0x24, 0xd0, 0x49, 0xb1, 0x66,
+  0x90, 0x1b, 0xe7, 0xfa, 0xe7, 0xfd, 0xf0, 0x1c, 0x28, 0x59, 0x25, 0x3e, 0x10, 0x8f, 0x9c, 0x2b,
+  0x7c, 0xd8, 0xa6, 0x29, 0x60, 0x84, 0xff, 0xeb, 0x97, 0x0d, 0x8d, 0x20, 0x11, 0x08, 0x99, 0x71,
+  0xd7, 0x1d, 0x5b, 0x8c, 0x53, 0x17, 0xc5, 0x21, 0xf6, 0x4a, 0xa0, 0x7e, 0x4a, 0xfd, 0x1f, 0xb2,
+  0x2c, 0x99, 0x09, 0x8f, 0xba, 0xd6, 0x5b, 0x79, 0xf4, 0x12, 0x18, 0x2b, 0x98, 0xa0, 0x8a, 0x50,
+  0xa4, 0xcf, 0x86, 0xab, 0x1f, 0xbe, 0x96, 0x62, 0x94, 0xf3, 0x4d, 0x2d, 0xbb, 0x3f, 0x0d, 0x86,
+  0xe5, 0xb1, 0xcb, 0x67, 0x2e, 0x00, 0xcb, 0xa9, 0xb8, 0xb3, 0x92, 0x81, 0xbb, 0x2d, 0xdc, 0x6c,
+  0xfe, 0x10, 0x40, 0x5e, 0x34, 0x79, 0x93, 0xd9, 0xe4, 0x82, 0x70, 0x57, 0xc7, 0x98, 0xad, 0xb1,
+  0xb0, 0x23, 0xc2, 0x30, 0x6e, 0x7a, 0xc9, 0xee, 0xe0, 0xae, 0x26, 0x3b, 0xb0, 0x2a, 0x73, 0xb1,
+  0x9a, 0xc8, 0x0c, 0x7e, 0xeb, 0x85, 0x7a, 0x30, 0x02, 0xe4, 0x42, 0x4d, 0xb6, 0x9d, 0x19, 0x07,
+  0xd1, 0x8f, 0x72, 0x46, 0x68, 0xa3, 0xd8, 0xe4, 0x13, 0xe6, 0x93, 0xb5, 0x2d, 0x1d, 0x51, 0xfd,
+  0x5e, 0xff, 0x53, 0xf9, 0x4d, 0xfc, 0x95, 0x67, 0xec, 0xcb, 0xf0, 0xf5, 0xe6, 0x6f, 0xec, 0xfa,
+  0xff, 0x92, 0x2f, 0x0f, 0x92, 0x25, 0x25, 0x00, 0xba, 0xf5, 0xb1, 0x0e, 0xb8, 0x6a, 0xea, 0xb5,
+  0x95, 0xb6, 0x61, 0x8a, 0x05, 0x4b, 0x88, 0x34, 0x03, 0x5c, 0x44, 0x92, 0x60, 0xe6, 0xde, 0xd1,
+  0x2e, 0xdf, 0xa3, 0x86, 0x8e, 0x93, 0x28, 0x92, 0x80, 0x9c, 0xbe, 0xf7, 0x32, 0xcc, 0xdb, 0xd3,
+  0x07, 0x08, 0x65, 0x84, 0xbf, 0xdb, 0xcd, 0xe2, 0xf6, 0x6d, 0x6c, 0x7b, 0x1f, 0xfc, 0x54, 0x60,
+  0x9f, 0x95, 0xbd, 0x9d, 0x79, 0xe4, 0x30, 0xad, 0x76, 0xff, 0xce, 0x16, 0x89, 0x3d, 0x4b, 0xba,
+  0x59, 0x62, 0x42, 0xf9, 0xd8, 0x29, 0xfc, 0xf7, 0x1d, 0xa7, 0xe7, 0xca, 0x36, 0x50, 0x58, 0x7a,
+  0xdd, 0x30, 0xac, 0x8f, 0x41, 0x4c, 0xcb, 0xc1, 0x27, 0x1b, 0xb0, 0x11, 0xf7, 0xb0, 0xe1, 0x28,
+  0x48, 0x77, 0x7e, 0xe9, 0xf1, 0x95, 0xb0, 0x27, 0xcf, 0xc6, 0x47, 0x50, 0x55, 0x4b, 0x01, 0xaa,
+  0xb1, 0x25, 0x39, 0x27, 0xb1, 0xd8, 0xe2, 0xa4, 0x63, 0x15, 0x88, 0xca, 0x07, 0xd8, 0x96, 0x89,
+  0xff, 0x14, 0x30, 0x5b, 0xf4, 0x28, 0x3a, 0x35, 0xc4, 0x1a, 0x57, 0xfe, 0x94, 0xa6, 0x4b, 0x8f,
+  0x92, 0x3d, 0x20, 0xbc, 0x31, 0x9a, 0xff, 0x6a, 0xc7, 0x7a, 0x3c, 0x8d, 0xad, 0xb4, 0xfd, 0xcf,
+  0x67, 0xc8, 0xa6, 0x07, 0xcd, 0x80, 0x6d, 0x8a, 0xae, 0x26, 0xd2, 0xa8, 0xc8, 0xb9, 0xaa, 0x3a,
+  0xf8, 0x58, 0x5e, 0x79, 0x55, 0xdf, 0x50, 0xfe, 0x60, 0x85, 0x27, 0xb0, 0xfb, 0x1f, 0x78, 0xfa,
+  0xad, 0xe1, 0x3c, 0x3d, 0xf7, 0x42, 0x1d, 0x41, 0x19, 0xd4, 0xa1, 0x87, 0xe8, 0x51, 0xd0, 0x2f,
+  0x10, 0xad, 0x33, 0x0b, 0x47, 0xde, 0x44, 0x96, 0x8e, 0x1e, 0xf6, 0x03, 0xd3, 0x1f, 0x04, 0xdc,
+  0x76, 0x21, 0x19, 0x30, 0xd5, 0x3f, 0x3c, 0xe8, 0x58, 0x01, 0x02, 0x2d, 0x9f, 0x58, 0x6a, 0xdd,
+  0x34, 0xf8, 0x68, 0x35, 0xb9, 0x14, 0x18, 0x6e, 0xd3, 0xee, 0x0c, 0xbb, 0xf0, 0x38, 0xb5, 0xff,
+  0x50, 0xe8, 0x68, 0x1f, 0x6b, 0x4a, 0x14, 0x2a, 0x02, 0x80, 0xc7, 0xaf, 0x88, 0xb8, 0x15, 0x2b,
+  0x2d, 0xc5, 0x31, 0xeb, 0x2c, 0xde, 0x6d, 0xd0, 0xa5, 0x27, 0xab, 0x02, 0xe4, 0xff, 0x6f, 0x80,
+  0x37, 0x27, 0x3e, 0xb1, 0xf9, 0xbd, 0xeb, 0xb6, 0xd2, 0xa9, 0x36, 0xfe, 0x71, 0x73, 0xd3, 0x75,
+  0x55, 0xf9, 0xbf, 0xbb, 0xb8, 0x3e, 0x91, 0xeb, 0xc6, 0xf0, 0x4f, 0xda, 0x53, 0x14, 0x1f, 0x1e,
+  0xdf, 0x80, 0xe2, 0x1d, 0x14, 0x53, 0x9d, 0x6f, 0x26, 0xa4, 0x04, 0x57, 0x3e, 0x88, 0x44, 0xdf,
+  0xac, 0xf6, 0x57, 0x76, 0x38, 0x1f, 0x00, 0x12, 0x08, 0x04, 0x04, 0xdd, 0x5b, 0x26, 0xf1, 0x89,
+  0xd6, 0x56, 0xd4, 0x83, 0xf0, 0x9f, 0x42, 0x89, 0x96, 0x18, 0xde, 0x7f, 0x71, 0x6d, 0x7b, 0x0f,
+  0x97, 0xea, 0x3f, 0x12, 0x3a };
+
+static uint8_t aad14[200] = {
+  0xb6, 0xf0, 0x9f, 0x01, 0x37, 0x22, 0x04, 0x8b, 0x57, 0x57, 0x17, 0xe4, 0x4d, 0x90, 0x3d, 0x91,
+  0x58, 0xdd, 0x73, 0x1b, 0xcb, 0xa4, 0x46, 0xc8, 0x02, 0x72, 0xc0, 0xb6, 0xf9, 0x83, 0x7d, 0x58,
+  0xa8, 0x55, 0xe6, 0x18, 0xa5, 0xfb, 0x39, 0xa5, 0xc0, 0x04, 0x1a, 0xb2, 0xe9, 0xf7, 0x99, 0x0f,
+  0xcf, 0x1e, 0x57, 0x2a, 0xe5, 0x9e, 0x34, 0x73, 0x71, 0x68, 0x6a, 0x82, 0xf6, 0xb4, 0x95, 0x5c,
+  0x8a, 0x3d, 0x2b, 0xb6, 0x6e, 0xab, 0xe7, 0x1a, 0x2b, 0xd4, 0xf0, 0xeb, 0x2b, 0x53, 0x74, 0xcc,
+  0xcc, 0xa1, 0xdb, 0xf1, 0x9d, 0xed, 0xf8, 0x4e, 0x99, 0xf7, 0x6e, 0xf8, 0x94, 0x85, 0x7a, 0xc5,
+  0x84, 0xfe, 0xca, 0x0e, 0x24, 0x12, 0x80, 0xf2, 0x8b, 0x8d, 0x5a, 0xa9, 0xe4, 0xac, 0xbb, 0x0c,
+  0x98, 0x40, 0xdf, 0x20, 0xed, 0xc9, 0x92, 0x31, 0x6c, 0x0a, 0x87, 0xf3, 0x96, 0xf0, 0xed, 0xa9,
+  0x73, 0x3f, 0x7e, 0x3b, 0x5e, 0x3f, 0x37, 0x8b, 0xea, 0xc2, 0x32, 0xc3, 0x0c, 0x10, 0x67, 0xd4,
+  0xcf, 0xa2, 0xe4, 0x18, 0x58, 0xda, 0xd3, 0xe2, 0x6f, 0x22, 0xdc, 0xd7, 0x4e, 0x4b, 0x1b, 0x3e,
+  0x48, 0xe7, 0x3e, 0x0e, 0x3a, 0x61, 0xa5, 0x86, 0xad, 0xae, 0xb4, 0xd7, 0x92, 0x39, 0x30, 0x6e,
+  0xba, 0xeb, 0xb6, 0x6f, 0x81, 0x85, 0xb3, 0x9b, 0x91, 0x50, 0x45, 0x5e, 0x22, 0x0b, 0x33, 0xb4,
+  0x8f, 0x9f, 0x3e, 0x76, 0xe5, 0x0d, 0xeb, 0x10 };
+
+static uint8_t cipher14[1029] = {
+  0x57, 0x9a, 0x76, 0xf5, 0xe3, 0x93, 0x3e, 0x55, 0x9e, 0xd0, 0x88, 0x94, 0x2c, 0x1c, 0xd9, 0xa6,
+  0xba, 0xc9, 0x1a, 0x1f, 0x3c, 0x98, 0x95, 0x47, 0xc0, 0xba, 0xdc, 0x10, 0x4b, 0x10, 0x9c, 0x63,
+  0x82, 0x1f, 0x2f, 0x0b, 0xbd, 0xca, 0xf2, 0x13, 0xeb, 0xbb, 0xd8, 0x73, 0xf7, 0x73, 0xed, 0xb7,
+  0x43, 0x69, 0x6f, 0x91, 0xa0, 0xa4, 0xa8, 0x1d, 0x59, 0x96, 0xb8, 0x49, 0x2c, 0xd5, 0x99, 0x0a,
+  0x3e, 0x35, 0xeb, 0xab, 0x8b, 0x65, 0x47, 0x76, 0x26, 0x06, 0x1e, 0x0a, 0xf8, 0xd9, 0x62, 0x0d,
+  0xc9, 0x70, 0xbe, 0xc1, 0x28, 0x7d, 0x42, 0x6c, 0x9b, 0x2e, 0x1f, 0x62, 0xc7, 0x00, 0xcd, 0x10,
+  0x30, 0xe8, 0x6b, 0x5f, 0x9b, 0x33, 0xa6, 0xf0, 0xf7, 0x36, 0xcb, 0xb8, 0x06, 0xc1, 0xdb, 0xc1,
+  0x58, 0x54, 0xaf, 0xad, 0x06, 0xbb, 0x0f, 0xe2, 0xf7, 0xa1, 0x4d, 0x0c, 0x47, 0x05, 0x1a, 0xac,
+  0x41, 0xac, 0xd0, 0x64, 0x54, 0xe1, 0xd0, 0xcd, 0x81, 0xb0, 0xb1, 0x8c, 0x3b, 0x74, 0x7e, 0x03,
+  0x17, 0xf0, 0x8d, 0x04, 0x85, 0xa9, 0x5a, 0xeb, 0xf5, 0x94, 0xbb, 0xe8, 0x1e, 0xd7, 0x5e, 0xa1,
+  0x9d, 0x7a, 0x0e, 0x19, 0xaa, 0x85, 0x39, 0x00, 0x4a, 0x6c, 0x05, 0xb2, 0x6f, 0x13, 0x69, 0x06,
+  0xb7, 0xbc, 0xf9, 0xba, 0xbe, 0x60, 0x79, 0xeb, 0x68, 0x0b, 0xc9, 0x36, 0xab, 0xe3, 0xc6, 0x1a,
+  0xba, 0x2c, 0x6f, 0x1c, 0x35, 0xaa, 0x4d, 0x78, 0xfa, 0xf6, 0x85, 0x5a, 0x3a, 0xd0, 0x94, 0xde,
+  0x41, 0x9c, 0xe8, 0xa3, 0x17, 0xe9, 0x7a, 0x80, 0x98, 0xb0, 0x8a, 0xbc, 0x2a, 0xc5, 0x36, 0xb4,
+  0x63, 0x28, 0x10, 0x35, 0xd2, 0x9d, 0x83, 0x5a, 0xa8, 0x55, 0xb9, 0xf8, 0x01, 0x82, 0x11, 0x80,
+  0x56, 0x1d, 0x31, 0x37, 0xcc, 0xf6, 0x91, 0x46, 0x20, 0x2d, 0x2c, 0x3c, 0x8d, 0x49, 0xda, 0x10,
+  0x4b, 0x26, 0xd1, 0xb5, 0x3e, 0xf3, 0xd6, 0x0f, 0xfb, 0x46, 0x08, 0x45, 0xa7, 0xcb, 0x20, 0xa9,
+  0x98, 0xc5, 0x79, 0x4a, 0x44, 0xe7, 0x06, 0xac, 0x63, 0x33, 0x13, 0x5f, 0xf6, 0x10, 0x79, 0x64,
+  0x75, 0x38, 0x8f, 0x21, 0xe6, 0x39, 0x0b, 0x6f, 0x11, 0x26, 0x97, 0x63, 0x31, 0x71, 0xd5, 0x75,
+  0x24, 0xd7, 0x14, 0xb5, 0x01, 0x0b, 0x4a, 0x09, 0x25, 0x0c, 0xc5, 0x09, 0x9a, 0xfd, 0x1c, 0x8c,
+  0x4f, 0x35, 0x5d, 0xc5, 0x71, 0x7d, 0x19, 0xc5, 0x5a, 0x21, 0xa9, 0xc2, 0x22, 0x7c, 0xc9, 0x57,
+  0x60, 0xaa, 0x38, 0xe2, 0x2d, 0x38, 0x81, 0x88, 0xb7, 0xc6, 0x7d, 0x26, 0x7a, 0x32, 0x30, 0x15,
+  0x54, 0x3d, 0x16, 0xc1, 0x2e, 0x53, 0xb3, 0x1d, 0x80, 0x2e, 0x4a, 0x14, 0x12, 0x19, 0xda, 0xdb,
+  0x4b, 0xfa, 0x33, 0xdd, 0xd4, 0xf9, 0xec, 0xb2, 0xb5, 0xd9, 0x65, 0xf0, 0xa0, 0x10, 0xb3, 0xac,
+  0x8a, 0x66, 0x2f, 0xa5, 0x28, 0x12, 0x07, 0x15, 0x9f, 0x21, 0x49, 0x4b, 0xb9, 0xdf, 0xe0, 0xe4,
+  0x38, 0x50, 0xd4, 0x8b, 0x8a, 0x1b, 0xf9, 0x88, 0x05, 0x6e, 0xa8, 0x73, 0x29, 0x3d, 0x72, 0xf3,
+  0x3f, 0x89, 0x7d, 0xc8, 0xce, 0x3c, 0x96, 0x4c, 0x51, 0x65, 0xd6, 0xf9, 0x86, 0xed, 0xfb, 0xc6,
+  0x29, 0xc1, 0xba, 0x75, 0x05, 0xb6, 0x7b, 0x7d, 0x8e, 0x02, 0x21, 0xf2, 0xf9, 0x8e, 0xd2, 0x83,
+  0x8d, 0xf2, 0x1c, 0x2e, 0xf6, 0xdf, 0x29, 0xb7, 0xa3, 0x78, 0xf4, 0xee, 0xe0, 0xec, 0x52, 0xe8,
+  0x94, 0xbe, 0x2f, 0xd8, 0xd9, 0x5b, 0x98, 0xb5, 0x41, 0xd9, 0x6a, 0xc6, 0x7e, 0x5b, 0x0c, 0xea,
+  0x88, 0x35, 0x0a, 0xa6, 0x8e, 0x7b, 0xc9, 0xfe, 0x15, 0xf6, 0x8d, 0x1f, 0xed, 0x88, 0xa9, 0xe8,
+  0xa3, 0xde, 0x9b, 0x8a, 0x61, 0xd5, 0x1d, 0x53, 0x3b, 0x88, 0x29, 0x37, 0x1b, 0xdf, 0x93, 0x80,
+  0x17, 0xdd, 0xd5, 0x0e, 0xec, 0x2f, 0x6b, 0xde, 0x83, 0x9f, 0x42, 0x0c, 0x9d, 0x27, 0xe1, 0xd2,
+  0x43, 0x09, 0x67, 0x65, 0x12, 0xae, 0x92, 0x60, 0xde, 0xc0, 0x4c, 0x4a, 0x64, 0x88, 0xe4, 0x5a,
+  0x03, 0xa0, 0xfe, 0x66, 0x8f, 0x40, 0x80, 0x3f, 0xab, 0x02, 0x12, 0xf3, 0x17, 0x21, 0x59, 0x45,
+  0xf8, 0xc0, 0x35, 0x74, 0xf4, 0xcb, 0x77, 0x5d, 0x04, 0x08, 0x4f, 0x21, 0x44, 0x8d, 0x6a, 0xc3,
+  0xa2, 0x27, 0x55, 0x5d, 0xb4, 0xe0, 0x4c, 0xc1, 0xac, 0xc3, 0x89, 0xba, 0xb4, 0x0c, 0xf6, 0x83,
+  0x2e, 0x0b, 0x9e, 0x68, 0xf2, 0x7a, 0x07, 0xee, 0xef, 0x24, 0x47, 0xf0, 0x31, 0x4a, 0xb2, 0x38,
+  0xbf, 0x60, 0xe6, 0x7d, 0x85, 0x4f, 0x59, 0xe8, 0x7f, 0x8a, 0x02, 0xae, 0x41, 0xe0, 0x86, 0xcf,
+  0xd9, 0x80, 0xc2, 0xfd, 0x2c, 0x05, 0x5b, 0xe0, 0xe6, 0xea, 0x59, 0x87, 0x9f, 0x5a, 0xb9, 0x5f,
+  0x5b, 0xa3, 0x45, 0x38, 0xfa, 0x6d, 0xdb, 0x7f, 0x43, 0x30, 0xdc, 0x4f, 0x89, 0x2d, 0x26, 0xdc,
+  0xf8, 0xda, 0x50, 0xf6, 0x1b, 0xa1, 0xa8, 0x99, 0x46, 0xd5, 0x18, 0xdd, 0x92, 0x26, 0xcb, 0x6c,
+  0x2d, 0x30, 0x74, 0x25, 0x20, 0x83, 0x5d, 0xf7, 0xf5, 0xb7, 0x26, 0x6a, 0x25, 0x8f, 0x3f, 0x79,
+  0xd7, 0xe0, 0xb8, 0xbc, 0xdb, 0xcd, 0x48, 0x01, 0x66, 0xf0, 0x62, 0x9c, 0xfa, 0x6c, 0x28, 0x78,
+  0x9c, 0xb1, 0x3a, 0xaa, 0x78, 0xe9, 0x2f, 0xb2, 0xc9, 0x11, 0x9a, 0x4e, 0x8a, 0x48, 0xf5, 0x1a,
+  0x32, 0xee, 0xe4, 0xfc, 0x10, 0xaa, 0x79, 0x15, 0x53, 0x11, 0x60, 0xd1, 0x13, 0x34, 0x86, 0xb6,
+  0xb2, 0xe8, 0xc2, 0xb7, 0xa5, 0xad, 0x28, 0x34, 0x40, 0x5f, 0xc2, 0x45, 0xcf, 0x70, 0x7e, 0x7f,
+  0xf5, 0xee, 0x77, 0xc5, 0xb1, 0xed, 0x51, 0x0f, 0x36, 0x95, 0x89, 0x8f, 0x21, 0xed, 0x95, 0xd1,
+  0x75, 0x05, 0xd8, 0xd3, 0x9d, 0x27, 0x2d, 0x25, 0xd0, 0xac, 0x9c, 0x40, 0x31, 0xf3, 0xf2, 0xc1,
+  0x08, 0x36, 0xf9, 0x91, 0x2b, 0x2a, 0x66, 0xe8, 0x1b, 0x60, 0x72, 0x14, 0x34, 0x5c, 0x6c, 0x8c,
+  0xe1, 0x74, 0xc2, 0x91, 0xe6, 0x51, 0xee, 0x67, 0xb3, 0xeb, 0xf8, 0x3e, 0x0a, 0xda, 0x15, 0xb1,
+  0x52, 0xbf, 0x7c, 0x23, 0x0d, 0xb4, 0x21, 0x90, 0x9e, 0x2a, 0x72, 0x9b, 0xcc, 0xec, 0x92, 0xd3,
+  0x26, 0xb1, 0xcf, 0x7b, 0x5f, 0xcc, 0xe4, 0xb9, 0x41, 0x0f, 0x95, 0x7b, 0x19, 0x98, 0xc4, 0x12,
+  0xc9, 0xfe, 0xb5, 0x3f, 0x37, 0x24, 0x42, 0x53, 0x33, 0xa6, 0x8b, 0xc3, 0x3a, 0x5c, 0xc1, 0x2d,
+  0x9c, 0x02, 0xf0, 0x59, 0xfa, 0xfc, 0xa5, 0x8a, 0x0c, 0xa8, 0x93, 0xa0, 0x4b, 0xd5, 0x03, 0x4b,
+  0xbb, 0xd5, 0xa9, 0x02, 0xc4, 0xe5, 0x19, 0x5d, 0xe4, 0x0a, 0x69, 0x48, 0x45, 0xbd, 0xb4, 0x1d,
+  0x98, 0x17, 0x02, 0xd6, 0x74, 0x89, 0x66, 0x56, 0x7c, 0x18, 0x1f, 0x75, 0x9c, 0xd5, 0x3c, 0x5a,
+  0x87, 0xfc, 0x57, 0x43, 0x30, 0x81, 0x12, 0xc5, 0x2a, 0xdc, 0x52, 0x21, 0x06, 0x09, 0x2d, 0x3e,
+  0x9a, 0x33, 0x88, 0x20, 0xbf, 0xee, 0x16, 0xe1, 0xa5, 0x7f, 0x18, 0xa8, 0x75, 0x73, 0xa7, 0xd2,
+  0xeb, 0x74, 0xd4, 0xd7, 0x71, 0x1a, 0x0e, 0x51, 0x95, 0x9a, 0x4f, 0x78, 0xed, 0x24, 0xe1, 0x74,
+  0x69, 0x2a, 0x69, 0x6a, 0x4e, 0x6c, 0x3b, 0x81, 0x03, 0x77, 0x57, 0x69, 0x6f, 0x66, 0xb3, 0x92,
+  0x2a, 0x6a, 0x05, 0x5e, 0xd8, 0xb0, 0xfa, 0xba, 0xa5, 0x34, 0xd2, 0xfe, 0xdf, 0xa3, 0xc7, 0xcb,
+  0x15, 0x5c, 0xba, 0xd3, 0xbd, 0x77, 0x8f, 0x11, 0x68, 0x7e, 0xec, 0x34, 0x05, 0xc1, 0x8c, 0xdf,
+  0xfd, 0xe8, 0x69, 0xec, 0x8f, 0xd3, 0x13, 0xb5, 0x67, 0xcf, 0xd1, 0x6c, 0x1c, 0x45, 0xde, 0xa9,
+  0x23, 0x4a, 0x73, 0x69, 0x73 };
+
+static aes_gcm_siv_test_vector vectors[] = {
+  /* RFC 8452, Appendix C.1 */
+  {
+    .key_len = 16,
+    .key = {
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    .nonce = {
+      0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    .input = input1,
+    .input_len = 0,
+    .aad = aad1,
+    .aad_len = 0,
+    .cipher = cipher1,
+    .tag = {
+      0xdc, 0x20, 0xe2, 0xd8, 0x3f, 0x25, 0x70, 0x5b, 0xb4, 0x9e, 0x43, 0x9e, 0xca, 0x56, 0xde, 0x25
+    }
+  },
+  {
+    .key_len = 16,
+    .key = {
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    .nonce = {
+      0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    .input = input2,
+    .input_len = 8,
+    .aad = aad2,
+    .aad_len = 0,
+    .cipher = cipher2,
+    .tag = {
+      0x57, 0x87, 0x82, 0xff, 0xf6, 0x01, 0x3b, 0x81, 0x5b, 0x28, 0x7c, 0x22, 0x49, 0x3a, 0x36, 0x4c
+    }
+  },
+  {
+    .key_len = 16,
+    .key = {
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    .nonce = {
+      0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    .input = input3,
+    .input_len = 12,
+    .aad = aad3,
+    .aad_len = 0,
+    .cipher = cipher3,
+    .tag = {
+      0xa4, 0x97, 0x8d, 0xb3, 0x57, 0x39, 0x1a, 0x0b, 0xc4, 0xfd, 0xec, 0x8b, 0x0d, 0x10, 0x66, 0x39
+    }
+  },
+  {
+    .key_len = 16,
+    .key = {
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    .nonce = {
+      0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    .input = input4,
+    .input_len = 16,
+    .aad = aad4,
+    .aad_len = 0,
+    .cipher = cipher4,
+    .tag = {
+      0x30, 0x3a, 0xaf, 0x90, 0xf6, 0xfe, 0x21, 0x19, 0x9c, 0x60, 0x68, 0x57, 0x74, 0x37, 0xa0, 0xc4
+    }
+  },
+  {
+    .key_len = 16,
+    .key = {
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    .nonce = {
+      0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    .input = input5,
+    .input_len = 32,
+    .aad = aad5,
+    .aad_len = 0,
+    .cipher = cipher5,
+    .tag = {
+      0x1a, 0x8e, 0x45, 0xdc, 0xd4, 0x57, 0x8c, 0x66, 0x7c, 0xd8, 0x68, 0x47, 0xbf, 0x61, 0x55, 0xff
+    }
+  },
+  {
+    .key_len = 16,
+    .key = {
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    .nonce = {
+      0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    .input = input6,
+    .input_len = 8,
+    .aad = aad6,
+    .aad_len = 1,
+    .cipher = cipher6,
+    .tag = {
+      0x3b, 0x0a, 0x1a, 0x25, 0x60, 0x96, 0x9c, 0xdf, 0x79, 0x0d, 0x99, 0x75, 0x9a, 0xbd, 0x15, 0x08
+    }
+  },
+  /* RFC 8452, Appendix C.2 */
+  {
+    .key_len = 32,
+    .key = {
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    .nonce = {
+      0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    .input = input7,
+    .input_len = 0,
+    .aad = aad7,
+    .aad_len = 0,
+    .cipher = cipher7,
+    .tag = {
+      0x07, 0xf5, 0xf4, 0x16, 0x9b, 0xbf, 0x55, 0xa8, 0x40, 0x0c, 0xd4, 0x7e, 0xa6, 0xfd, 0x40, 0x0f
+    }
+  },
+  {
+    .key_len = 32,
+    .key = {
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    .nonce = {
+      0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    .input = input8,
+    .input_len = 32,
+    .aad = aad8,
+    .aad_len = 0,
+    .cipher = cipher8,
+    .tag = {
+      0xe8, 0x19, 0xe6, 0x3a, 0xbc, 0xd0, 0x20, 0xb0, 0x06, 0xa9, 0x76, 0x39, 0x76, 0x32, 0xeb, 0x5d
+    }
+  },
+  /* RFC 8452, Appendix C.3: the 32-bit counter wraps around */
+  {
+    .key_len = 32,
+    .key = {
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    .nonce = {
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    .input = input9,
+    .input_len = 32,
+    .aad = aad9,
+    .aad_len = 0,
+    .cipher = cipher9,
+    .tag = {
+      0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    }
+  },
+  {
+    .key_len = 32,
+    .key = {
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    .nonce = {
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    .input = input10,
+    .input_len = 24,
+    .aad = aad10,
+    .aad_len = 0,
+    .cipher = cipher10,
+    .tag = {
+      0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    }
+  },
+  /* Longer messages, through the 8-block paths; computed with an independent
+     implementation that agrees with the RFC vectors above */
+  {
+    .key_len = 16,
+    .key = {
+      0xe6, 0x8b, 0x85, 0xfd, 0xbb, 0x9b, 0x94, 0x9e, 0xff, 0x28, 0x49, 0x1b, 0xa7, 0xf7, 0x83, 0x0b
+    },
+    .nonce = {
+      0x09, 0x71, 0x82, 0xc4, 0x33, 0xfa, 0x06, 0x79, 0x1a, 0xab, 0xc1, 0xd8
+    },
+    .input = input11,
+    .input_len = 300,
+    .aad = aad11,
+    .aad_len = 37,
+    .cipher = cipher11,
+    .tag = {
+      0xce, 0x62, 0x6e, 0x3a, 0x9d, 0xfc, 0x4c, 0xd3, 0xd2, 0xff, 0xda, 0xfa, 0x83, 0x44, 0xf7, 0xcc
+    }
+  },
+  {
+    .key_len = 32,
+    .key = {
+      0x2a, 0x43, 0xcf, 0x1b, 0x22, 0xba, 0xad, 0x89, 0x28, 0x5d, 0xf6, 0x5f, 0x4a, 0x77, 0x51, 0x3f,
+      0x61, 0x3e, 0x06, 0x3c, 0x2b, 0xe5, 0x7c, 0xf0, 0xc1, 0xa0, 0xd5, 0x70, 0x78, 0x90, 0x4c, 0xf8
+    },
+    .nonce = {
+      0x4d, 0x06, 0xa5, 0x27, 0x8b, 0xce, 0xd6, 0x1a, 0x24, 0xc7, 0x3b, 0xe3
+    },
+    .input = input12,
+    .input_len = 300,
+    .aad = aad12,
+    .aad_len = 37,
+    .cipher = cipher12,
+    .tag = {
+      0x88, 0x3f, 0x6a, 0x43, 0x64, 0xfa, 0xf2, 0x12, 0x67, 0xb1, 0x13, 0xbe, 0x16, 0x1f, 0x10, 0xa2
+    }
+  },
+  {
+    .key_len = 16,
+    .key = {
+      0x3a, 0xe6, 0x65, 0x0d, 0xb2, 0x67, 0x0f, 0x99, 0xb0, 0xdd, 0x99, 0xed, 0x74, 0xe3, 0x74, 0xe9
+    },
+    .nonce = {
+      0x3a, 0xf8, 0x38, 0xe8, 0x24, 0xbf, 0x60, 0x13, 0x2d, 0x67, 0xb5, 0x27
+    },
+    .input = input13,
+    .input_len = 1029,
+    .aad = aad13,
+    .aad_len = 200,
+    .cipher = cipher13,
+    .tag = {
+      0xce, 0x69, 0xcd, 0x4e, 0xb0, 0x9a, 0xe9, 0x60, 0x29, 0x87, 0x3c, 0xb4, 0x2e, 0x25, 0xde, 0x4c
+    }
+  },
+  {
+    .key_len = 32,
+    .key = {
+      0xc6, 0x4b, 0x21, 0xbc, 0xf9, 0xfb, 0x35, 0x91, 0x86, 0x6c, 0x3e, 0xc3, 0xd6, 0xa9, 0xba, 0xca,
+      0xa0, 0xdd, 0x2e, 0x4e, 0x4a, 0x5c, 0x70, 0x2e, 0x8e, 0x0f, 0x3a, 0x0e, 0x14, 0x4b, 0xf5, 0x7c
+    },
+    .nonce = {
+      0xd4, 0x22, 0x32, 0x79, 0x0d, 0x58, 0x41, 0x66, 0xc9, 0x71, 0xa3, 0x38
+    },
+    .input = input14,
+    .input_len = 1029,
+    .aad = aad14,
+    .aad_len = 200,
+    .cipher = cipher14,
+    .tag = {
+      0xdc, 0x98, 0x3f, 0xd1, 0x0e, 0x4d, 0x74, 0xd9, 0x8c, 0x5e, 0x28, 0x5d, 0x7c, 0x61, 0x4c, 0xa1
+    }
+  }
+};
@@ -0,0 +1,184 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "Hacl_Chacha20_Vec256.h"
+#include "Hacl_Chacha20_Vec512.h"
+#include "Hacl_Poly1305_256.h"
+#include "Hacl_Poly1305_512.h"
+#include "Hacl_Chacha20Poly1305_256.h"
+#include "Hacl_Chacha20Poly1305_512.h"
+#include "EverCrypt_Chacha20Poly1305.h"
+#include "EverCrypt_Poly1305.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+#include "chacha20poly1305_vectors.h"
+
+#define MANY   400
+#define MAXLEN 2100
+#define ROUNDS 100000
+#define SIZE   16384
+
+
+// RFC 8439 vectors, with the 512-bit implementation.
+bool test_vectors() {
+  bool ok = true;
+  for (int i = 0; i < sizeof(vectors)/sizeof(chacha20poly1305_test_vector); ++i) {
+    chacha20poly1305_test_vector *v = &vectors[i];
+    uint8_t cipher[v->input_len + 1], plain[v->input_len + 1];
+    uint8_t tag[16];
+    Hacl_Chacha20Poly1305_512_aead_encrypt(v->key, v->nonce, v->aad_len, v->aad,
+      v->input_len, v->input, cipher, tag);
+    printf("Chacha20Poly1305 (512-bit) Result (RFC 8439):\n");
+    ok = compare_and_print(v->input_len, cipher, v->cipher) && ok;
+    ok = compare_and_print(16, tag, v->tag) && ok;
+    uint32_t r = Hacl_Chacha20Poly1305_512_aead_decrypt(v->key, v->nonce, v->aad_len, v->aad,
+      v->input_len, plain, cipher, tag);
+    ok = r == 0 && compare_and_print(v->input_len, plain, v->input) && ok;
+  }
+  return ok;
+}
+
+// The 512-bit implementations agree with the 256-bit ones on lengths that
+// cover partial vectors, partial blocks and the scalar tail.
+bool test_against_256() {
+  uint8_t key[32], nonce[12], aad[300];
+  uint8_t plain[MAXLEN], c0[MAXLEN], c1[MAXLEN];
+  uint8_t tag0[16], tag1[16];
+  bool ok = true;
+
+  for (int j = 0; j < MANY; j++) {
+    uint32_t len = j < 300 ? j * 7 : rand() % MAXLEN;
+    uint32_t aad_len = rand() % 300;
+    uint32_t ctr = rand();
+    for (int i = 0; i < 32; i++) key[i] = (uint8_t)rand();
+    for (int i = 0; i < 12; i++) nonce[i] = (uint8_t)rand();
+    for (int i = 0; i < aad_len; i++) aad[i] = (uint8_t)rand();
+    for (int i = 0; i < len; i++) plain[i] = (uint8_t)rand();
+
+    Hacl_Chacha20_Vec256_chacha20_encrypt_256(len, c0, plain, key, nonce, ctr);
+    Hacl_Chacha20_Vec512_chacha20_encrypt_512(len, c1, plain, key, nonce, ctr);
+    ok = ok && memcmp(c0, c1, len) == 0;
+
+    Hacl_Poly1305_256_poly1305_mac(tag0, len, plain, key);
+    Hacl_Poly1305_512_poly1305_mac(tag1, len, plain, key);
+    ok = ok && memcmp(tag0, tag1, 16) == 0;
+
+    Hacl_Chacha20Poly1305_256_aead_encrypt(key, nonce, aad_len, aad, len, plain, c0, tag0);
+    Hacl_Chacha20Poly1305_512_aead_encrypt(key, nonce, aad_len, aad, len, plain, c1, tag1);
+    ok = ok && memcmp(c0, c1, len) == 0 && memcmp(tag0, tag1, 16) == 0;
+    ok = ok && Hacl_Chacha20Poly1305_512_aead_decrypt(key, nonce, aad_len, aad, len, c0, c1, tag1) == 0;
+    ok = ok && memcmp(c0, plain, len) == 0;
+    tag1[j % 16] ^= 1;
+    ok = ok && Hacl_Chacha20Poly1305_512_aead_decrypt(key, nonce, aad_len, aad, len, c0, c1, tag1) == 1;
+  }
+
+  printf("Chacha20, Poly1305, Chacha20Poly1305 (512-bit against 256-bit) Result:\n");
+  if (ok) printf("Success!\n");
+  else printf("**FAILED**\n");
+  return ok;
+}
+
+// EverCrypt picks the 512-bit code when it can, and falls back to the 256-bit
+// code once AVX-512 is disabled; both give the same results.
+bool test_dispatch() {
+  uint8_t key[32], nonce[12], aad[16];
+  uint8_t plain[MAXLEN], c0[MAXLEN], c1[MAXLEN];
+  uint8_t tag0[16], tag1[16], mac0[16], mac1[16];
+  bool ok = true;
+
+  memset(key, 'K', 32);
+  memset(nonce, 'N', 12);
+  memset(aad, 'A', 16);
+  for (int i = 0; i < MAXLEN; i++) plain[i] = (uint8_t)i;
+
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Chacha20Poly1305_aead_encrypt(key, nonce, 16, aad, MAXLEN, plain, c0, tag0);
+  EverCrypt_Poly1305_poly1305(mac0, plain, MAXLEN, key);
+  EverCrypt_AutoConfig2_disable_avx512();
+  EverCrypt_Chacha20Poly1305_aead_encrypt(key, nonce, 16, aad, MAXLEN, plain, c1, tag1);
+  EverCrypt_Poly1305_poly1305(mac1, plain, MAXLEN, key);
+  EverCrypt_AutoConfig2_init();
+
+  ok = memcmp(c0, c1, MAXLEN) == 0 && memcmp(tag0, tag1, 16) == 0 && memcmp(mac0, mac1, 16) == 0;
+  printf("EverCrypt Chacha20Poly1305, Poly1305 (with and without AVX-512) Result:\n");
+  if (ok) printf("Success!\n");
+  else printf("**FAILED**\n");
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  srand(0x512);
+
+  if (!EverCrypt_AutoConfig2_has_avx512()) {
+    printf("AVX-512 not available, skipping\n");
+    return EXIT_SUCCESS;
+  }
+
+  bool ok = test_vectors();
+  ok = test_against_256() && ok;
+  ok = test_dispatch() && ok;
+
+  uint8_t *plain = malloc(SIZE);
+  uint8_t *cipher = malloc(SIZE);
+  uint8_t key[32], nonce[12], aad[16], tag[16];
+  memset(plain, 'P', SIZE);
+  memset(key, 'K', 32);
+  memset(nonce, 'N', 12);
+  memset(aad, 'A', 16);
+  uint64_t res = 0;
+  cycles a, b;
+  clock_t t1, t2;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Chacha20_Vec512_chacha20_encrypt_512(SIZE, plain, plain, key, nonce, 1);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff1 = t2 - t1;
+  cycles cdiff1 = b - a;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Poly1305_512_poly1305_mac(tag, SIZE, plain, key);
+    res ^= tag[0] ^ tag[15];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff2 = t2 - t1;
+  cycles cdiff2 = b - a;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Chacha20Poly1305_512_aead_encrypt(key, nonce, 16, aad, SIZE, plain, cipher, tag);
+    res ^= tag[0] ^ tag[15];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff3 = t2 - t1;
+  cycles cdiff3 = b - a;
+
+  uint64_t count = ROUNDS * SIZE;
+  printf("\n res: %d \n", (int)res);
+  printf("Chacha20 (512-bit) PERF:\n"); print_time(count, tdiff1, cdiff1);
+  printf("Poly1305 (512-bit) PERF:\n"); print_time(count, tdiff2, cdiff2);
+  printf("Chacha20Poly1305 Encrypt (512-bit) PERF:\n"); print_time(count, tdiff3, cdiff3);
+  free(plain);
+  free(cipher);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
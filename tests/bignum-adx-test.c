@@ -0,0 +1,239 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#define OPENSSL_SUPPRESS_DEPRECATED
+#include <openssl/bn.h>
+#include <openssl/rsa.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Bignum256.h"
+#include "EverCrypt_Bignum4096.h"
+#include "Hacl_Bignum256.h"
+#include "Hacl_Bignum256_ADX.h"
+#include "Hacl_Bignum4096.h"
+#include "Hacl_Bignum4096_ADX.h"
+
+#include "test_helpers.h"
+
+#define ROUNDS 20
+#define MAX_LEN 70
+
+// Little-endian limbs <-> OpenSSL
+static void to_limbs(const BIGNUM *x, uint64_t *r, uint32_t len) {
+  uint8_t b[8 * 2 * MAX_LEN];
+  BN_bn2lebinpad(x, b, len * 8);
+  memcpy(r, b, len * 8);
+}
+
+static bool eq_bn(const uint64_t *r, const BIGNUM *x, uint32_t len) {
+  uint64_t e[2 * MAX_LEN] = { 0 };
+  to_limbs(x, e, len);
+  return memcmp(r, e, len * 8) == 0;
+}
+
+static void rand_limbs(BIGNUM *x, uint64_t *r, uint32_t len, bool ones) {
+  if (ones) {
+    memset(r, 0xff, len * 8);
+    BN_lebin2bn((uint8_t *)r, len * 8, x);
+  } else {
+    BN_rand(x, len * 64, BN_RAND_TOP_ANY, BN_RAND_BOTTOM_ANY);
+    to_limbs(x, r, len);
+  }
+}
+
+// Runtime-length products and squares against OpenSSL, for every length up to
+// MAX_LEN. These only use the C rows.
+static bool test_rows(BN_CTX *ctx) {
+  bool ok = true;
+  BIGNUM *a = BN_new(), *b = BN_new(), *r = BN_new();
+  uint64_t a1[MAX_LEN], b1[MAX_LEN], res[2 * MAX_LEN];
+
+  for (uint32_t len = 1; len <= MAX_LEN; len++) {
+    for (int it = 0; it < 3; it++) {
+      uint32_t bLen = it == 2 ? len : (len + 3 * it) % MAX_LEN + 1;
+      rand_limbs(a, a1, len, it == 1);
+      rand_limbs(b, b1, bLen, it == 1);
+
+      Hacl_Bignum_Multiplication_bn_mul_u64(len, a1, bLen, b1, res);
+      BN_mul(r, a, b, ctx);
+      ok = ok && eq_bn(res, r, len + bLen);
+
+      Hacl_Bignum_Multiplication_bn_sqr_u64(len, a1, res);
+      BN_sqr(r, a, ctx);
+      ok = ok && eq_bn(res, r, len + len);
+    }
+  }
+
+  BN_free(a); BN_free(b); BN_free(r);
+  printf("Bignum runtime-length mul and sqr Result:\n");
+  if (ok) printf("Success!\n");
+  else printf("**FAILED**\n");
+  return ok;
+}
+
+typedef void (*mod_mul_ctx)(Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k, uint64_t *a,
+  uint64_t *b, uint64_t *res);
+typedef void (*mont_sqr_ctx)(Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k, uint64_t *aM,
+  uint64_t *resM);
+typedef void (*to_mont_ctx)(Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k, uint64_t *a,
+  uint64_t *aM);
+typedef void (*mod_exp_ctx)(Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k, uint64_t *a,
+  uint32_t bBits, uint64_t *b, uint64_t *res);
+
+typedef struct {
+  const char *name;
+  uint32_t limbs;
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *(*init)(uint64_t *n);
+  void (*free)(Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k);
+  to_mont_ctx to_mont;
+  to_mont_ctx from_mont;
+  mont_sqr_ctx mont_sqr;
+  mod_mul_ctx mod_mul;
+  mod_exp_ctx mod_exp_raw;
+  mod_exp_ctx mod_exp_ct;
+} impl;
+
+// The context functions of one instance against OpenSSL
+static bool test_ctx(BN_CTX *ctx, impl f) {
+  bool ok = true;
+  uint32_t limbs = f.limbs;
+  BIGNUM *a = BN_new(), *b = BN_new(), *n = BN_new(), *r = BN_new(), *rr = BN_new();
+  uint64_t a1[64], b1[64], n1[64], res[64], aM[64];
+
+  for (int it = 0; it < 8; it++) {
+    BN_rand(n, limbs * 64, BN_RAND_TOP_ONE, BN_RAND_BOTTOM_ODD);
+    if (it == 0) {
+      // n = 2^(64 * limbs) - 1, so that every limb of n is all ones
+      BN_zero(n);
+      BN_set_bit(n, limbs * 64);
+      BN_sub_word(n, 1);
+    }
+    BN_rand_range(a, n);
+    BN_rand_range(b, n);
+    to_limbs(n, n1, limbs);
+    to_limbs(a, a1, limbs);
+    to_limbs(b, b1, limbs);
+    Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k = f.init(n1);
+
+    f.mod_mul(k, a1, b1, res);
+    BN_mod_mul(r, a, b, n, ctx);
+    ok = ok && eq_bn(res, r, limbs);
+
+    BN_one(rr);
+    BN_lshift(rr, rr, limbs * 64);
+    f.to_mont(k, a1, aM);
+    BN_mod_mul(r, a, rr, n, ctx);
+    ok = ok && eq_bn(aM, r, limbs);
+    f.mont_sqr(k, aM, aM);
+    f.from_mont(k, aM, res);
+    BN_mod_sqr(r, a, n, ctx);
+    ok = ok && eq_bn(res, r, limbs);
+
+    BN_rand(b, limbs * 64, BN_RAND_TOP_ANY, BN_RAND_BOTTOM_ANY);
+    to_limbs(b, b1, limbs);
+    BN_mod_exp(r, a, b, n, ctx);
+    f.mod_exp_raw(k, a1, limbs * 64, b1, res);
+    ok = ok && eq_bn(res, r, limbs);
+    f.mod_exp_ct(k, a1, limbs * 64, b1, res);
+    ok = ok && eq_bn(res, r, limbs);
+
+    f.free(k);
+  }
+
+  BN_free(a); BN_free(b); BN_free(n); BN_free(r); BN_free(rr);
+  printf("%s mod_mul, to/from_mont, mont_sqr and mod_exp Result:\n", f.name);
+  if (ok) printf("Success!\n");
+  else printf("**FAILED**\n");
+  return ok;
+}
+
+int main() {
+  BN_CTX *ctx = BN_CTX_new();
+  EverCrypt_AutoConfig2_init();
+  bool has_adx = EverCrypt_AutoConfig2_has_bmi2() && EverCrypt_AutoConfig2_has_adx();
+  if (!has_adx)
+    printf("BMI2/ADX not available, not testing Hacl_Bignum4096_ADX and Hacl_Bignum256_ADX\n");
+
+  impl impls[6] = {
+    { "Hacl_Bignum4096", 64, Hacl_Bignum4096_mont_ctx_init, Hacl_Bignum4096_mont_ctx_free,
+      Hacl_Bignum4096_to_mont_ctx, Hacl_Bignum4096_from_mont_ctx, Hacl_Bignum4096_mont_sqr_ctx,
+      Hacl_Bignum4096_mod_mul_ctx, Hacl_Bignum4096_mod_exp_raw_ctx, Hacl_Bignum4096_mod_exp_ct_ctx },
+    { "Hacl_Bignum256", 4, Hacl_Bignum256_mont_ctx_init, Hacl_Bignum256_mont_ctx_free,
+      Hacl_Bignum256_to_mont_ctx, Hacl_Bignum256_from_mont_ctx, Hacl_Bignum256_mont_sqr_ctx,
+      Hacl_Bignum256_mod_mul_ctx, Hacl_Bignum256_mod_exp_raw_ctx, Hacl_Bignum256_mod_exp_ct_ctx },
+    { "EverCrypt_Bignum4096", 64, Hacl_Bignum4096_mont_ctx_init, Hacl_Bignum4096_mont_ctx_free,
+      EverCrypt_Bignum4096_to_mont_ctx, EverCrypt_Bignum4096_from_mont_ctx,
+      EverCrypt_Bignum4096_mont_sqr_ctx, EverCrypt_Bignum4096_mod_mul_ctx,
+      EverCrypt_Bignum4096_mod_exp_raw_ctx, EverCrypt_Bignum4096_mod_exp_ct_ctx },
+    { "EverCrypt_Bignum256", 4, Hacl_Bignum256_mont_ctx_init, Hacl_Bignum256_mont_ctx_free,
+      EverCrypt_Bignum256_to_mont_ctx, EverCrypt_Bignum256_from_mont_ctx,
+      EverCrypt_Bignum256_mont_sqr_ctx, EverCrypt_Bignum256_mod_mul_ctx,
+      EverCrypt_Bignum256_mod_exp_raw_ctx, EverCrypt_Bignum256_mod_exp_ct_ctx },
+    { "Hacl_Bignum4096_ADX", 64, Hacl_Bignum4096_mont_ctx_init, Hacl_Bignum4096_mont_ctx_free,
+      Hacl_Bignum4096_ADX_to_mont_ctx, Hacl_Bignum4096_ADX_from_mont_ctx,
+      Hacl_Bignum4096_ADX_mont_sqr_ctx, Hacl_Bignum4096_ADX_mod_mul_ctx,
+      Hacl_Bignum4096_ADX_mod_exp_raw_ctx, Hacl_Bignum4096_ADX_mod_exp_ct_ctx },
+    { "Hacl_Bignum256_ADX", 4, Hacl_Bignum256_mont_ctx_init, Hacl_Bignum256_mont_ctx_free,
+      Hacl_Bignum256_ADX_to_mont_ctx, Hacl_Bignum256_ADX_from_mont_ctx,
+      Hacl_Bignum256_ADX_mont_sqr_ctx, Hacl_Bignum256_ADX_mod_mul_ctx,
+      Hacl_Bignum256_ADX_mod_exp_raw_ctx, Hacl_Bignum256_ADX_mod_exp_ct_ctx },
+  };
+
+  bool ok = test_rows(ctx);
+  int n_impls = has_adx ? 6 : 4;
+  for (int i = 0; i < n_impls; i++)
+    ok = test_ctx(ctx, impls[i]) && ok;
+
+  // Montgomery multiplications in Bignum4096 and Bignum256
+  typedef void (*mont_mul_ctx)(Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k, uint64_t *aM,
+    uint64_t *bM, uint64_t *resM);
+  mont_mul_ctx mul4096[3] = {
+    Hacl_Bignum4096_mont_mul_ctx, EverCrypt_Bignum4096_mont_mul_ctx, Hacl_Bignum4096_ADX_mont_mul_ctx
+  };
+  mont_mul_ctx mul256[3] = {
+    Hacl_Bignum256_mont_mul_ctx, EverCrypt_Bignum256_mont_mul_ctx, Hacl_Bignum256_ADX_mont_mul_ctx
+  };
+  const char *names[3] = { "C", "EverCrypt", "ADX" };
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k[2];
+  uint64_t n1[64], aM[64];
+  BIGNUM *n = BN_new();
+  for (int i = 0; i < 2; i++) {
+    BN_rand(n, i == 0 ? 4096 : 256, BN_RAND_TOP_ONE, BN_RAND_BOTTOM_ODD);
+    to_limbs(n, n1, i == 0 ? 64 : 4);
+    k[i] = i == 0 ? Hacl_Bignum4096_mont_ctx_init(n1) : Hacl_Bignum256_mont_ctx_init(n1);
+  }
+  memcpy(aM, n1, sizeof aM);
+  aM[0] ^= 1;
+  for (int f = 0; f < (has_adx ? 3 : 2); f++) {
+    clock_t t1 = clock();
+    cycles c1 = cpucycles_begin();
+    for (int j = 0; j < ROUNDS * 1000; j++)
+      mul4096[f](k[0], aM, aM, aM);
+    cycles c2 = cpucycles_end();
+    clock_t t2 = clock();
+    printf("\n res: %d \n", (int)aM[0]);
+    printf("Bignum4096 mont_mul_ctx (%s) PERF:\n", names[f]);
+    print_time(ROUNDS * 1000, t2 - t1, c2 - c1);
+
+    t1 = clock();
+    c1 = cpucycles_begin();
+    for (int j = 0; j < ROUNDS * 100000; j++)
+      mul256[f](k[1], aM, aM, aM);
+    c2 = cpucycles_end();
+    t2 = clock();
+    printf("\n res: %d \n", (int)aM[0]);
+    printf("Bignum256 mont_mul_ctx (%s) PERF:\n", names[f]);
+    print_time(ROUNDS * 100000, t2 - t1, c2 - c1);
+  }
+  Hacl_Bignum4096_mont_ctx_free(k[0]);
+  Hacl_Bignum256_mont_ctx_free(k[1]);
+  BN_free(n);
+  BN_CTX_free(ctx);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,218 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include <openssl/bn.h>
+
+#include "Hacl_Bignum4096.h"
+#include "Hacl_FFDHE.h"
+
+#include "test_helpers.h"
+
+#define ROUNDS 200
+
+// Little-endian limbs <-> OpenSSL
+static void to_limbs(const BIGNUM *x, uint64_t *r, uint32_t len) {
+  uint8_t b[512];
+  BN_bn2lebinpad(x, b, len * 8);
+  memcpy(r, b, len * 8);
+}
+
+static bool eq_bn(const uint64_t *r, const BIGNUM *x, uint32_t len) {
+  uint64_t e[64] = { 0 };
+  to_limbs(x, e, len);
+  return memcmp(r, e, len * 8) == 0;
+}
+
+// Random odd moduli and bases, tables for short and full-size exponents, and
+// exponents of several sizes up to the bound of the table, including sizes
+// that are not a multiple of the number of teeth of the comb.
+static bool test_bignum4096(BN_CTX *ctx) {
+  uint32_t tbits[] = { 256, 4096 };
+  uint32_t ebits[] = { 1, 2, 7, 8, 9, 64, 255, 256, 1000, 4095, 4096 };
+  bool ok = true;
+
+  for (int it = 0; it < 4; it++) {
+    BIGNUM *n = BN_new(), *a = BN_new(), *e = BN_new(), *r = BN_new();
+    BN_rand(n, it == 3 ? 4096 - 67 : 4096, BN_RAND_TOP_ONE, BN_RAND_BOTTOM_ODD);
+    BN_rand_range(a, n);
+    uint64_t n1[64] = { 0 }, a1[64] = { 0 }, e1[64] = { 0 }, res[64] = { 0 };
+    to_limbs(n, n1, 64);
+    to_limbs(a, a1, 64);
+    Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k = Hacl_Bignum4096_mont_ctx_init(n1);
+
+    for (int t = 0; t < 2; t++) {
+      Hacl_Bignum_ExpFixedBase_bn_fb_table_u64 *tb =
+        Hacl_Bignum4096_mod_exp_fb_table_init(k, a1, tbits[t]);
+      ok = ok && tb != NULL;
+      if (tb == NULL)
+        continue;
+      for (size_t i = 0; i < sizeof ebits / sizeof ebits[0]; i++) {
+        if (ebits[i] > tbits[t])
+          continue;
+        BN_rand(e, ebits[i], BN_RAND_TOP_ONE, BN_RAND_BOTTOM_ANY);
+        memset(e1, 0, sizeof e1);
+        to_limbs(e, e1, 64);
+        BN_mod_exp(r, a, e, n, ctx);
+        Hacl_Bignum4096_mod_exp_fb_raw_ctx(k, tb, ebits[i], e1, res);
+        ok = ok && eq_bn(res, r, 64);
+        Hacl_Bignum4096_mod_exp_fb_ct_ctx(k, tb, ebits[i], e1, res);
+        ok = ok && eq_bn(res, r, 64);
+        // A loose bound on the number of bits of the exponent
+        Hacl_Bignum4096_mod_exp_fb_ct_ctx(k, tb, tbits[t], e1, res);
+        ok = ok && eq_bn(res, r, 64);
+      }
+      Hacl_Bignum4096_mod_exp_fb_table_free(tb);
+    }
+
+    // Out-of-range bases and bounds are rejected
+    ok = ok && Hacl_Bignum4096_mod_exp_fb_table_init(k, a1, 0) == NULL;
+    ok = ok && Hacl_Bignum4096_mod_exp_fb_table_init(k, a1, 4097) == NULL;
+    to_limbs(n, a1, 64);
+    ok = ok && Hacl_Bignum4096_mod_exp_fb_table_init(k, a1, 4096) == NULL;
+
+    Hacl_Bignum4096_mont_ctx_free(k);
+    BN_free(n); BN_free(a); BN_free(e); BN_free(r);
+  }
+
+  printf("Bignum4096 fixed-base exponentiation (against OpenSSL) Result:\n");
+  if (ok) printf("Success!\n");
+  else printf("**FAILED**\n");
+  return ok;
+}
+
+static Spec_FFDHE_ffdhe_alg groups[] = {
+  Spec_FFDHE_FFDHE2048, Spec_FFDHE_FFDHE3072, Spec_FFDHE_FFDHE4096,
+  Spec_FFDHE_FFDHE6144, Spec_FFDHE_FFDHE8192
+};
+
+static bool test_ffdhe() {
+  bool ok = true;
+  uint8_t sk[1024], pk0[1024], pk1[1024];
+
+  for (size_t i = 0; i < sizeof groups / sizeof groups[0]; i++) {
+    uint32_t len = Hacl_FFDHE_ffdhe_len(groups[i]);
+    uint64_t *p_r2_g_n = Hacl_FFDHE_new_ffdhe_precomp_p_g(groups[i]);
+    ok = ok && p_r2_g_n != NULL;
+    if (p_r2_g_n == NULL)
+      continue;
+    for (int it = 0; it < 4; it++) {
+      for (uint32_t j = 0; j < len; j++)
+        sk[j] = (uint8_t)rand();
+      // A short secret key, as used with the FFDHE groups of RFC 7919
+      if (it == 0) {
+        memset(sk, 0, len - 32);
+        sk[len - 32] |= 0x80;
+      }
+      sk[0] &= 0x7f;
+      Hacl_FFDHE_ffdhe_secret_to_public(groups[i], sk, pk0);
+      Hacl_FFDHE_ffdhe_secret_to_public_precomp_g(groups[i], p_r2_g_n, sk, pk1);
+      ok = ok && memcmp(pk0, pk1, len) == 0;
+    }
+    free(p_r2_g_n);
+  }
+
+  printf("FFDHE secret_to_public_precomp_g (against secret_to_public) Result:\n");
+  if (ok) printf("Success!\n");
+  else printf("**FAILED**\n");
+  return ok;
+}
+
+int main() {
+  BN_CTX *ctx = BN_CTX_new();
+  bool ok = test_bignum4096(ctx);
+  ok = test_ffdhe() && ok;
+
+  BIGNUM *n = BN_new(), *a = BN_new(), *e = BN_new();
+  BN_rand(n, 4096, BN_RAND_TOP_ONE, BN_RAND_BOTTOM_ODD);
+  BN_rand_range(a, n);
+  uint64_t n1[64] = { 0 }, a1[64] = { 0 }, res[64] = { 0 };
+  to_limbs(n, n1, 64);
+  to_limbs(a, a1, 64);
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k = Hacl_Bignum4096_mont_ctx_init(n1);
+
+  uint32_t ebits[] = { 256, 4096 };
+  for (int i = 0; i < 2; i++) {
+    uint64_t e1[64] = { 0 };
+    BN_rand(e, ebits[i], BN_RAND_TOP_ONE, BN_RAND_BOTTOM_ANY);
+    to_limbs(e, e1, 64);
+    Hacl_Bignum_ExpFixedBase_bn_fb_table_u64 *tb =
+      Hacl_Bignum4096_mod_exp_fb_table_init(k, a1, ebits[i]);
+    int rounds = ebits[i] == 256 ? ROUNDS * 4 : ROUNDS / 4;
+    uint64_t acc = 0;
+    cycles a0, b0;
+    clock_t t1, t2;
+    clock_t tdiff[4];
+    cycles cdiff[4];
+    for (int f = 0; f < 4; f++) {
+      t1 = clock();
+      a0 = cpucycles_begin();
+      for (int j = 0; j < rounds; j++) {
+        switch (f) {
+          case 0: Hacl_Bignum4096_mod_exp_ct_ctx(k, a1, ebits[i], e1, res); break;
+          case 1: Hacl_Bignum4096_mod_exp_fb_ct_ctx(k, tb, ebits[i], e1, res); break;
+          case 2: Hacl_Bignum4096_mod_exp_fb_raw_ctx(k, tb, ebits[i], e1, res); break;
+          default:
+            Hacl_Bignum4096_mod_exp_fb_table_free(tb);
+            tb = Hacl_Bignum4096_mod_exp_fb_table_init(k, a1, ebits[i]);
+            break;
+        }
+        acc ^= res[0];
+      }
+      b0 = cpucycles_end();
+      t2 = clock();
+      tdiff[f] = t2 - t1;
+      cdiff[f] = b0 - a0;
+    }
+    Hacl_Bignum4096_mod_exp_fb_table_free(tb);
+    printf("\n res: %d \n", (int)acc);
+    printf("Bignum4096 mod_exp_ct_ctx, %u-bit exponent PERF:\n", ebits[i]);
+    print_time(rounds, tdiff[0], cdiff[0]);
+    printf("Bignum4096 mod_exp_fb_ct_ctx, %u-bit exponent PERF:\n", ebits[i]);
+    print_time(rounds, tdiff[1], cdiff[1]);
+    printf("Bignum4096 mod_exp_fb_raw_ctx, %u-bit exponent PERF:\n", ebits[i]);
+    print_time(rounds, tdiff[2], cdiff[2]);
+    printf("Bignum4096 mod_exp_fb_table_init, %u-bit exponent PERF:\n", ebits[i]);
+    print_time(rounds, tdiff[3], cdiff[3]);
+  }
+
+  Hacl_Bignum4096_mont_ctx_free(k);
+  BN_free(n); BN_free(a); BN_free(e);
+  BN_CTX_free(ctx);
+
+  uint8_t sk[512], pk[512];
+  for (int j = 0; j < 512; j++)
+    sk[j] = (uint8_t)rand();
+  sk[0] &= 0x7f;
+  uint64_t *p_r2_g_n = Hacl_FFDHE_new_ffdhe_precomp_p_g(Spec_FFDHE_FFDHE4096);
+  int rounds = ROUNDS / 4;
+  cycles a0, b0;
+  clock_t t1, t2;
+  clock_t tdiff[2];
+  cycles cdiff[2];
+  for (int f = 0; f < 2; f++) {
+    t1 = clock();
+    a0 = cpucycles_begin();
+    for (int j = 0; j < rounds; j++) {
+      if (f == 0) Hacl_FFDHE_ffdhe_secret_to_public(Spec_FFDHE_FFDHE4096, sk, pk);
+      else Hacl_FFDHE_ffdhe_secret_to_public_precomp_g(Spec_FFDHE_FFDHE4096, p_r2_g_n, sk, pk);
+      sk[511] ^= pk[0];
+    }
+    b0 = cpucycles_end();
+    t2 = clock();
+    tdiff[f] = t2 - t1;
+    cdiff[f] = b0 - a0;
+  }
+  free(p_r2_g_n);
+  printf("\n res: %d \n", (int)pk[0]);
+  printf("FFDHE4096 ffdhe_secret_to_public PERF:\n");
+  print_time(rounds, tdiff[0], cdiff[0]);
+  printf("FFDHE4096 ffdhe_secret_to_public_precomp_g PERF:\n");
+  print_time(rounds, tdiff[1], cdiff[1]);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,196 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include <openssl/bn.h>
+
+#include "Hacl_Bignum256.h"
+#include "Hacl_Bignum4096.h"
+
+#include "test_helpers.h"
+
+#define ROUNDS 200
+
+typedef struct {
+  const char *name;
+  uint32_t bits;
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *(*mont_ctx_init)(uint64_t *n);
+  void (*mont_ctx_free)(Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k);
+  void (*to_mont_ctx)(Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k, uint64_t *a, uint64_t *aM);
+  void (*from_mont_ctx)(Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k, uint64_t *aM, uint64_t *a);
+  void (*mont_mul_ctx)(Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k, uint64_t *aM, uint64_t *bM, uint64_t *resM);
+  void (*mont_sqr_ctx)(Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k, uint64_t *aM, uint64_t *resM);
+  void (*mod_mul_ctx)(Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k, uint64_t *a, uint64_t *b, uint64_t *res);
+  void (*mod_exp_raw_ctx)(Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k, uint64_t *a, uint32_t bBits, uint64_t *b, uint64_t *res);
+  void (*mod_exp_ct_ctx)(Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k, uint64_t *a, uint32_t bBits, uint64_t *b, uint64_t *res);
+} bn_impl;
+
+static bn_impl impls[] = {
+  { "Bignum256", 256, Hacl_Bignum256_mont_ctx_init, Hacl_Bignum256_mont_ctx_free,
+    Hacl_Bignum256_to_mont_ctx, Hacl_Bignum256_from_mont_ctx, Hacl_Bignum256_mont_mul_ctx,
+    Hacl_Bignum256_mont_sqr_ctx, Hacl_Bignum256_mod_mul_ctx, Hacl_Bignum256_mod_exp_raw_ctx,
+    Hacl_Bignum256_mod_exp_ct_ctx },
+  { "Bignum4096", 4096, Hacl_Bignum4096_mont_ctx_init, Hacl_Bignum4096_mont_ctx_free,
+    Hacl_Bignum4096_to_mont_ctx, Hacl_Bignum4096_from_mont_ctx, Hacl_Bignum4096_mont_mul_ctx,
+    Hacl_Bignum4096_mont_sqr_ctx, Hacl_Bignum4096_mod_mul_ctx, Hacl_Bignum4096_mod_exp_raw_ctx,
+    Hacl_Bignum4096_mod_exp_ct_ctx }
+};
+
+// Little-endian limbs <-> OpenSSL
+static void to_limbs(const BIGNUM *x, uint64_t *r, uint32_t len) {
+  uint8_t b[512];
+  BN_bn2lebinpad(x, b, len * 8);
+  memcpy(r, b, len * 8);
+}
+
+static BIGNUM *of_limbs(const uint64_t *r, uint32_t len) {
+  return BN_lebin2bn((const uint8_t *)r, len * 8, NULL);
+}
+
+static bool eq_bn(const uint64_t *r, const BIGNUM *x, uint32_t len) {
+  uint64_t e[64] = { 0 };
+  to_limbs(x, e, len);
+  return memcmp(r, e, len * 8) == 0;
+}
+
+// Random odd moduli of full size and of a smaller size (the context must not
+// assume that the top limb is used), random bases and exponents of several
+// sizes, including the full size and lengths that are not a multiple of the
+// window size.
+static bool test_impl(bn_impl *impl, BN_CTX *ctx) {
+  uint32_t len = impl->bits / 64;
+  uint32_t nbits[] = { impl->bits, impl->bits - 67 };
+  uint32_t ebits[] = { 1, 3, 64, 255, 256, impl->bits - 1, impl->bits };
+  bool ok = true;
+
+  for (int t = 0; t < 2; t++)
+    for (int it = 0; it < 8; it++) {
+      BIGNUM *n = BN_new(), *a = BN_new(), *b = BN_new(), *e = BN_new(), *r = BN_new();
+      BN_rand(n, nbits[t], BN_RAND_TOP_ONE, BN_RAND_BOTTOM_ODD);
+      uint64_t n1[64] = { 0 }, a1[64] = { 0 }, b1[64] = { 0 }, e1[64] = { 0 };
+      uint64_t res[64] = { 0 }, aM[64] = { 0 }, bM[64] = { 0 };
+      to_limbs(n, n1, len);
+      Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k = impl->mont_ctx_init(n1);
+      ok = ok && k != NULL;
+      if (k == NULL) {
+        BN_free(n); BN_free(a); BN_free(b); BN_free(e); BN_free(r);
+        continue;
+      }
+      // The context keeps its own copy of the modulus
+      memset(n1, 0xff, len * 8);
+
+      BN_rand_range(a, n);
+      BN_rand_range(b, n);
+      to_limbs(a, a1, len);
+      to_limbs(b, b1, len);
+
+      impl->mod_mul_ctx(k, a1, b1, res);
+      BN_mod_mul(r, a, b, n, ctx);
+      ok = ok && eq_bn(res, r, len);
+
+      impl->to_mont_ctx(k, a1, aM);
+      impl->to_mont_ctx(k, b1, bM);
+      impl->mont_mul_ctx(k, aM, bM, aM);
+      impl->mont_sqr_ctx(k, aM, aM);
+      impl->from_mont_ctx(k, aM, res);
+      BN_mod_mul(r, a, b, n, ctx);
+      BN_mod_sqr(r, r, n, ctx);
+      ok = ok && eq_bn(res, r, len);
+
+      for (size_t i = 0; i < sizeof ebits / sizeof ebits[0]; i++) {
+        BN_rand(e, ebits[i], BN_RAND_TOP_ONE, BN_RAND_BOTTOM_ANY);
+        memset(e1, 0, sizeof e1);
+        to_limbs(e, e1, len);
+        BN_mod_exp(r, a, e, n, ctx);
+        impl->mod_exp_raw_ctx(k, a1, ebits[i], e1, res);
+        ok = ok && eq_bn(res, r, len);
+        impl->mod_exp_ct_ctx(k, a1, ebits[i], e1, res);
+        ok = ok && eq_bn(res, r, len);
+        // A loose bound on the number of bits of the exponent
+        impl->mod_exp_ct_ctx(k, a1, impl->bits, e1, res);
+        ok = ok && eq_bn(res, r, len);
+      }
+
+      impl->mont_ctx_free(k);
+      BN_free(n); BN_free(a); BN_free(b); BN_free(e); BN_free(r);
+    }
+
+  // Even moduli and 1 are rejected
+  uint64_t bad[64] = { 0 };
+  bad[0] = 1;
+  ok = ok && impl->mont_ctx_init(bad) == NULL;
+  bad[0] = 0x10;
+  bad[len - 1] = 0x8000000000000000ULL;
+  ok = ok && impl->mont_ctx_init(bad) == NULL;
+
+  printf("%s Montgomery context (against OpenSSL) Result:\n", impl->name);
+  if (ok) printf("Success!\n");
+  else printf("**FAILED**\n");
+  return ok;
+}
+
+int main() {
+  BN_CTX *ctx = BN_CTX_new();
+  bool ok = true;
+  for (size_t i = 0; i < sizeof impls / sizeof impls[0]; i++)
+    ok = test_impl(&impls[i], ctx) && ok;
+
+  BIGNUM *n = BN_new(), *a = BN_new(), *e = BN_new();
+  BN_rand(n, 4096, BN_RAND_TOP_ONE, BN_RAND_BOTTOM_ODD);
+  BN_rand_range(a, n);
+  uint64_t n1[64] = { 0 }, a1[64] = { 0 }, res[64] = { 0 };
+  to_limbs(n, n1, 64);
+  to_limbs(a, a1, 64);
+  uint64_t *r2 = Hacl_Bignum4096_new_precompr2(n1);
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k = Hacl_Bignum4096_mont_ctx_init(n1);
+
+  uint32_t ebits[] = { 256, 4096 };
+  for (int i = 0; i < 2; i++) {
+    uint64_t e1[64] = { 0 };
+    BN_rand(e, ebits[i], BN_RAND_TOP_ONE, BN_RAND_BOTTOM_ANY);
+    to_limbs(e, e1, 64);
+    int rounds = ebits[i] == 256 ? ROUNDS * 4 : ROUNDS / 4;
+    uint64_t acc = 0;
+    cycles a0, b0;
+    clock_t t1, t2;
+    clock_t tdiff[4];
+    cycles cdiff[4];
+    for (int f = 0; f < 4; f++) {
+      t1 = clock();
+      a0 = cpucycles_begin();
+      for (int j = 0; j < rounds; j++) {
+        switch (f) {
+          case 0: Hacl_Bignum4096_mod_exp_raw_precompr2(n1, a1, ebits[i], e1, r2, res); break;
+          case 1: Hacl_Bignum4096_mod_exp_raw_ctx(k, a1, ebits[i], e1, res); break;
+          case 2: Hacl_Bignum4096_mod_exp_ct_precompr2(n1, a1, ebits[i], e1, r2, res); break;
+          default: Hacl_Bignum4096_mod_exp_ct_ctx(k, a1, ebits[i], e1, res); break;
+        }
+        acc ^= res[0];
+      }
+      b0 = cpucycles_end();
+      t2 = clock();
+      tdiff[f] = t2 - t1;
+      cdiff[f] = b0 - a0;
+    }
+    printf("\n res: %d \n", (int)acc);
+    printf("Bignum4096 mod_exp_raw_precompr2, %u-bit exponent PERF:\n", ebits[i]);
+    print_time(rounds, tdiff[0], cdiff[0]);
+    printf("Bignum4096 mod_exp_raw_ctx, %u-bit exponent PERF:\n", ebits[i]);
+    print_time(rounds, tdiff[1], cdiff[1]);
+    printf("Bignum4096 mod_exp_ct_precompr2, %u-bit exponent PERF:\n", ebits[i]);
+    print_time(rounds, tdiff[2], cdiff[2]);
+    printf("Bignum4096 mod_exp_ct_ctx, %u-bit exponent PERF:\n", ebits[i]);
+    print_time(rounds, tdiff[3], cdiff[3]);
+  }
+
+  free(r2);
+  Hacl_Bignum4096_mont_ctx_free(k);
+  BN_free(n); BN_free(a); BN_free(e);
+  BN_CTX_free(ctx);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
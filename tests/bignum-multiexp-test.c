@@ -0,0 +1,153 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include <openssl/bn.h>
+
+#include "Hacl_Bignum4096.h"
+
+#include "test_helpers.h"
+
+#define ROUNDS 200
+#define MAX_BASES 8
+
+// Little-endian limbs <-> OpenSSL
+static void to_limbs(const BIGNUM *x, uint64_t *r, uint32_t len) {
+  uint8_t b[512];
+  BN_bn2lebinpad(x, b, len * 8);
+  memcpy(r, b, len * 8);
+}
+
+static bool eq_bn(const uint64_t *r, const BIGNUM *x, uint32_t len) {
+  uint64_t e[64] = { 0 };
+  to_limbs(x, e, len);
+  return memcmp(r, e, len * 8) == 0;
+}
+
+// Random odd moduli, one to MAX_BASES random bases, and exponents of several
+// sizes, including zero exponents, exponents that are shorter than the bound
+// bBits and bounds that are not a multiple of the window size.
+static bool test_bignum4096(BN_CTX *ctx) {
+  uint32_t ebits[] = { 1, 3, 64, 255, 256, 1000, 4096 };
+  bool ok = true;
+
+  for (int it = 0; it < 4; it++) {
+    BIGNUM *n = BN_new(), *e = BN_new(), *r = BN_new(), *p = BN_new();
+    BIGNUM *a[MAX_BASES];
+    BN_rand(n, it == 3 ? 4096 - 67 : 4096, BN_RAND_TOP_ONE, BN_RAND_BOTTOM_ODD);
+    uint64_t n1[64] = { 0 }, res[64] = { 0 };
+    uint64_t a1[64 * MAX_BASES] = { 0 };
+    uint64_t e1[64 * MAX_BASES];
+    to_limbs(n, n1, 64);
+    for (int i = 0; i < MAX_BASES; i++) {
+      a[i] = BN_new();
+      BN_rand_range(a[i], n);
+      to_limbs(a[i], a1 + 64 * i, 64);
+    }
+    Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k = Hacl_Bignum4096_mont_ctx_init(n1);
+
+    for (uint32_t nBases = 1; nBases <= MAX_BASES; nBases++)
+      for (size_t i = 0; i < sizeof ebits / sizeof ebits[0]; i++) {
+        uint32_t bLen = (ebits[i] - 1) / 64 + 1;
+        memset(e1, 0, sizeof e1);
+        BN_one(r);
+        for (uint32_t j = 0; j < nBases; j++) {
+          uint32_t bits = j == 1 ? ebits[i] / 2 + 1 : ebits[i];
+          if (j == 2 && nBases > 3)
+            BN_zero(e);
+          else
+            BN_rand(e, bits, BN_RAND_TOP_ANY, BN_RAND_BOTTOM_ANY);
+          to_limbs(e, e1 + bLen * j, bLen);
+          BN_mod_exp(p, a[j], e, n, ctx);
+          BN_mod_mul(r, r, p, n, ctx);
+        }
+        ok = ok && Hacl_Bignum4096_mod_exp_multi_raw_ctx(k, nBases, a1, ebits[i], e1, res);
+        ok = ok && eq_bn(res, r, 64);
+      }
+
+    // No base, or more bases than the tables on the stack allow: res is untouched
+    memset(res, 0xff, sizeof res);
+    ok = ok && !Hacl_Bignum4096_mod_exp_multi_raw_ctx(k, 0, a1, 64, e1, res);
+    ok = ok && !Hacl_Bignum4096_mod_exp_multi_raw_ctx(k, 9, a1, 64, e1, res);
+    ok = ok && !Hacl_Bignum4096_mod_exp_multi_raw_ctx(k, 0x80000000U, a1, 64, e1, res);
+    for (int i = 0; i < 64; i++) ok = ok && res[i] == ~(uint64_t)0;
+
+    Hacl_Bignum4096_mont_ctx_free(k);
+    for (int i = 0; i < MAX_BASES; i++)
+      BN_free(a[i]);
+    BN_free(n); BN_free(e); BN_free(r); BN_free(p);
+  }
+
+  printf("Bignum4096 multi-exponentiation (against OpenSSL) Result:\n");
+  if (ok) printf("Success!\n");
+  else printf("**FAILED**\n");
+  return ok;
+}
+
+int main() {
+  BN_CTX *ctx = BN_CTX_new();
+  bool ok = test_bignum4096(ctx);
+
+  BIGNUM *n = BN_new(), *a = BN_new(), *e = BN_new();
+  BN_rand(n, 4096, BN_RAND_TOP_ONE, BN_RAND_BOTTOM_ODD);
+  uint64_t n1[64] = { 0 }, res[64] = { 0 }, tmp[64] = { 0 };
+  uint64_t a1[64 * 3] = { 0 };
+  to_limbs(n, n1, 64);
+  for (int i = 0; i < 3; i++) {
+    BN_rand_range(a, n);
+    to_limbs(a, a1 + 64 * i, 64);
+  }
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k = Hacl_Bignum4096_mont_ctx_init(n1);
+
+  // g ^ a * h ^ b * K ^ c, with exponents modulo a 256-bit group order and
+  // with full-size exponents
+  uint32_t ebits[] = { 256, 4096 };
+  for (int i = 0; i < 2; i++) {
+    uint32_t bLen = ebits[i] / 64;
+    uint64_t e1[64 * 3] = { 0 };
+    for (int j = 0; j < 3; j++) {
+      BN_rand(e, ebits[i], BN_RAND_TOP_ONE, BN_RAND_BOTTOM_ANY);
+      to_limbs(e, e1 + bLen * j, bLen);
+    }
+    int rounds = ebits[i] == 256 ? ROUNDS * 4 : ROUNDS / 4;
+    uint64_t acc = 0;
+    cycles a0, b0;
+    clock_t t1, t2;
+    clock_t tdiff[2];
+    cycles cdiff[2];
+    for (int f = 0; f < 2; f++) {
+      t1 = clock();
+      a0 = cpucycles_begin();
+      for (int j = 0; j < rounds; j++) {
+        if (f == 0) {
+          Hacl_Bignum4096_mod_exp_raw_ctx(k, a1, ebits[i], e1, res);
+          Hacl_Bignum4096_mod_exp_raw_ctx(k, a1 + 64, ebits[i], e1 + bLen, tmp);
+          Hacl_Bignum4096_mod_mul_ctx(k, res, tmp, res);
+          Hacl_Bignum4096_mod_exp_raw_ctx(k, a1 + 128, ebits[i], e1 + 2 * bLen, tmp);
+          Hacl_Bignum4096_mod_mul_ctx(k, res, tmp, res);
+        } else
+          Hacl_Bignum4096_mod_exp_multi_raw_ctx(k, 3, a1, ebits[i], e1, res);
+        acc ^= res[0];
+      }
+      b0 = cpucycles_end();
+      t2 = clock();
+      tdiff[f] = t2 - t1;
+      cdiff[f] = b0 - a0;
+    }
+    printf("\n res: %d \n", (int)acc);
+    printf("Bignum4096 3 x mod_exp_raw_ctx + 2 x mod_mul_ctx, %u-bit exponents PERF:\n", ebits[i]);
+    print_time(rounds, tdiff[0], cdiff[0]);
+    printf("Bignum4096 mod_exp_multi_raw_ctx, 3 bases, %u-bit exponents PERF:\n", ebits[i]);
+    print_time(rounds, tdiff[1], cdiff[1]);
+  }
+
+  Hacl_Bignum4096_mont_ctx_free(k);
+  BN_free(n); BN_free(a); BN_free(e);
+  BN_CTX_free(ctx);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
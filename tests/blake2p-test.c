@@ -0,0 +1,289 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "Hacl_Blake2b_32.h"
+#include "Hacl_Blake2b_256.h"
+#include "Hacl_Blake2s_128.h"
+#include "Hacl_Blake2bp_256.h"
+#include "Hacl_Blake2sp_256.h"
+#include "Hacl_Streaming_Blake2p_256.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+
+#define MANY   300
+#define MAXLEN 3000
+#define SWEEP  1101
+#define ROUNDS 4096
+#define SIZE   16384
+
+// The first entries of the reference blake2bp-kat.txt and blake2sp-kat.txt
+// (empty input, key 00 01 02 ...).
+static uint8_t kat_blake2bp[64] = {
+  0x9d, 0x94, 0x61, 0x07, 0x3e, 0x4e, 0xb6, 0x40, 0xa2, 0x55, 0x35, 0x7b, 0x83, 0x9f, 0x39, 0x4b,
+  0x83, 0x8c, 0x6f, 0xf5, 0x7c, 0x9b, 0x68, 0x6a, 0x3f, 0x76, 0x10, 0x7c, 0x10, 0x66, 0x72, 0x8f,
+  0x3c, 0x99, 0x56, 0xbd, 0x78, 0x5c, 0xbc, 0x3b, 0xf7, 0x9d, 0xc2, 0xab, 0x57, 0x8c, 0x5a, 0x0c,
+  0x06, 0x3b, 0x9d, 0x9c, 0x40, 0x58, 0x48, 0xde, 0x1d, 0xbe, 0x82, 0x1c, 0xd0, 0x5c, 0x94, 0x0a
+};
+
+static uint8_t kat_blake2sp[32] = {
+  0x71, 0x5c, 0xb1, 0x38, 0x95, 0xae, 0xb6, 0x78, 0xf6, 0x12, 0x41, 0x60, 0xbf, 0xf2, 0x14, 0x65,
+  0xb3, 0x0f, 0x4f, 0x68, 0x74, 0x19, 0x3f, 0xc8, 0x51, 0xb4, 0x62, 0x10, 0x43, 0xf0, 0x9c, 0xc6
+};
+
+// Unkeyed digests of the 1000-byte input 00 01 02 ... ff 00 01 ...
+static uint8_t unkeyed_blake2bp[64] = {
+  0x1c, 0xe5, 0xb8, 0xd6, 0xf6, 0xfc, 0xc8, 0x9f, 0xcb, 0x6e, 0xd2, 0x9f, 0x12, 0x79, 0x6c, 0xc2,
+  0x10, 0xa0, 0x3f, 0x47, 0x63, 0xe5, 0x28, 0xcb, 0x2c, 0x0e, 0x1b, 0x4b, 0x12, 0x55, 0xd6, 0xae,
+  0x86, 0xc7, 0x93, 0x32, 0x52, 0x9f, 0x63, 0x68, 0xd0, 0xbc, 0xfe, 0x9d, 0x31, 0x6a, 0x5f, 0x99,
+  0x9a, 0x53, 0xaf, 0x47, 0xa8, 0xf0, 0xec, 0x44, 0x12, 0xce, 0x19, 0x15, 0x6b, 0xba, 0xfd, 0x04
+};
+
+static uint8_t unkeyed_blake2sp[32] = {
+  0x7e, 0x28, 0x30, 0xf7, 0x4f, 0xc7, 0xc4, 0xd2, 0x24, 0xa2, 0x01, 0xb4, 0x6f, 0x95, 0xe3, 0x7e,
+  0xbb, 0xfb, 0x56, 0xdd, 0xdc, 0x49, 0x2f, 0x82, 0x27, 0xe4, 0xd9, 0x05, 0x20, 0x17, 0x34, 0xb8
+};
+
+// BLAKE2b-512 of the concatenated digests of the sweep below, for lengths
+// 0 .. SWEEP - 1 with key length len % (max_key + 1) and digest length
+// 1 + (7 * len) % max_out. This covers every key and digest length, partial
+// and complete stripes, and both sides of the 512-byte hold-back.
+static uint8_t sweep_blake2bp[64] = {
+  0x6c, 0xae, 0x26, 0x8f, 0x06, 0xe2, 0x66, 0x83, 0x8d, 0xaf, 0x74, 0xaa, 0xa2, 0x7f, 0xf8, 0x3d,
+  0xc3, 0x5b, 0xd9, 0x70, 0xda, 0x3d, 0xa8, 0xcc, 0x02, 0x4e, 0x42, 0x68, 0x0a, 0xab, 0x5b, 0x01,
+  0x05, 0xd2, 0x1f, 0x1b, 0x8f, 0x94, 0xba, 0xf4, 0xee, 0x95, 0x33, 0xd8, 0x7f, 0x5f, 0xb9, 0xd0,
+  0xb3, 0x65, 0x1f, 0xff, 0xfe, 0x16, 0xe9, 0x33, 0x14, 0x07, 0xe0, 0x33, 0x46, 0x85, 0x59, 0xf0
+};
+
+static uint8_t sweep_blake2sp[64] = {
+  0x55, 0xba, 0x9b, 0x32, 0x7b, 0x72, 0xd2, 0x91, 0x7a, 0xca, 0xaa, 0x62, 0x15, 0x82, 0x2f, 0xdc,
+  0xe0, 0x4f, 0x14, 0x31, 0x70, 0x0e, 0xe5, 0xb2, 0x31, 0x12, 0x05, 0x9b, 0x6e, 0x0a, 0x62, 0x2c,
+  0xd7, 0x65, 0xc2, 0x52, 0x4c, 0x71, 0x7d, 0xe5, 0xef, 0x8a, 0xd5, 0x54, 0x7d, 0x46, 0x74, 0x80,
+  0x13, 0x16, 0xec, 0x39, 0xc8, 0x7f, 0x5c, 0x06, 0x3b, 0x2d, 0xc4, 0x50, 0x89, 0xfd, 0x41, 0x53
+};
+
+typedef void (*blake2p_hash)(uint32_t, uint8_t *, uint32_t, uint8_t *, uint32_t, uint8_t *);
+
+typedef struct {
+  const char *name;
+  uint32_t max_len;
+  blake2p_hash hash;
+  uint8_t *kat;
+  uint8_t *unkeyed;
+  uint8_t *sweep;
+} blake2p_impl;
+
+static blake2p_impl impls[] = {
+  { "BLAKE2bp", 64, Hacl_Blake2bp_256_blake2bp, kat_blake2bp, unkeyed_blake2bp, sweep_blake2bp },
+  { "BLAKE2sp", 32, Hacl_Blake2sp_256_blake2sp, kat_blake2sp, unkeyed_blake2sp, sweep_blake2sp },
+};
+
+bool test_known_answer() {
+  uint8_t in[MAXLEN], key[64], out[64];
+  uint8_t *cat = malloc(SWEEP * 64);
+  bool ok = true;
+  for (int i = 0; i < MAXLEN; i++) in[i] = (uint8_t)i;
+  for (int i = 0; i < 64; i++) key[i] = (uint8_t)i;
+
+  for (int k = 0; k < sizeof(impls)/sizeof(blake2p_impl); k++) {
+    blake2p_impl *impl = &impls[k];
+    uint32_t m = impl->max_len;
+
+    impl->hash(m, out, 0, in, m, key);
+    printf("%s (KAT) Result:\n", impl->name);
+    ok = compare_and_print(m, out, impl->kat) && ok;
+
+    impl->hash(m, out, 1000, in, 0, NULL);
+    printf("%s (no key) Result:\n", impl->name);
+    ok = compare_and_print(m, out, impl->unkeyed) && ok;
+
+    uint32_t off = 0;
+    for (uint32_t len = 0; len < SWEEP; len++) {
+      uint32_t kk = len % (m + 1);
+      uint32_t nn = 1 + (7 * len) % m;
+      impl->hash(nn, cat + off, len, in, kk, key);
+      off += nn;
+    }
+    Hacl_Blake2b_32_blake2b(64, out, off, cat, 0, NULL);
+    printf("%s (key and digest length sweep) Result:\n", impl->name);
+    ok = compare_and_print(64, out, impl->sweep) && ok;
+  }
+  free(cat);
+  return ok;
+}
+
+// Feeds msg in random chunks, including empty ones and chunks that end exactly
+// on a stripe boundary.
+#define FEED(update, key_size, s, msg, len)                                   \
+  do {                                                                        \
+    uint32_t off = 0;                                                         \
+    while (off < len) {                                                       \
+      uint32_t c = rand() % 4 == 0 ? 0 : rand() % (len - off + 1);            \
+      if (rand() % 4 == 0 && len - off >= 512) c = 512;                       \
+      update(key_size, s, msg + off, c);                                      \
+      off += c;                                                               \
+    }                                                                         \
+  } while (0)
+
+// The streaming APIs agree with the one-shot functions, however the input is
+// split, with and without a key.
+bool test_streaming() {
+  uint8_t msg[MAXLEN], key[64];
+  uint8_t h0[64], h1[64], h2[64];
+  bool ok = true;
+
+  bool ok1 = true;
+  for (int j = 0; j < MANY; j++) {
+    uint32_t len = j < 100 ? j * 13 : rand() % MAXLEN;
+    uint32_t kk = j % 3 == 0 ? 0 : 1 + rand() % 64;
+    for (int i = 0; i < len; i++) msg[i] = (uint8_t)rand();
+    for (int i = 0; i < kk; i++) key[i] = (uint8_t)rand();
+
+    Hacl_Blake2bp_256_blake2bp(64, h0, len, msg, kk, key);
+    Hacl_Streaming_Blake2p_256_blake2bp_256_state *s =
+      Hacl_Streaming_Blake2p_256_blake2bp_256_with_key_create_in(kk, key);
+    FEED(Hacl_Streaming_Blake2p_256_blake2bp_256_with_key_update, kk, s, msg, len);
+    Hacl_Streaming_Blake2p_256_blake2bp_256_with_key_finish(kk, s, h1);
+    // finish does not consume the state
+    Hacl_Streaming_Blake2p_256_blake2bp_256_with_key_finish(kk, s, h2);
+    ok1 = ok1 && memcmp(h0, h1, 64) == 0 && memcmp(h0, h2, 64) == 0;
+    Hacl_Streaming_Blake2p_256_blake2bp_256_with_key_init(kk, key, s);
+    Hacl_Streaming_Blake2p_256_blake2bp_256_with_key_update(kk, s, msg, len);
+    Hacl_Streaming_Blake2p_256_blake2bp_256_with_key_finish(kk, s, h1);
+    ok1 = ok1 && memcmp(h0, h1, 64) == 0;
+    Hacl_Streaming_Blake2p_256_blake2bp_256_with_key_free(kk, s);
+  }
+  printf("BLAKE2bp (streaming against one-shot) Result:\n");
+  if (ok1) printf("Success!\n");
+  else printf("**FAILED**\n");
+  ok = ok && ok1;
+
+  ok1 = true;
+  for (int j = 0; j < MANY; j++) {
+    uint32_t len = j < 100 ? j * 13 : rand() % MAXLEN;
+    uint32_t kk = j % 3 == 0 ? 0 : 1 + rand() % 32;
+    for (int i = 0; i < len; i++) msg[i] = (uint8_t)rand();
+    for (int i = 0; i < kk; i++) key[i] = (uint8_t)rand();
+
+    Hacl_Blake2sp_256_blake2sp(32, h0, len, msg, kk, key);
+    Hacl_Streaming_Blake2p_256_blake2sp_256_state *s =
+      Hacl_Streaming_Blake2p_256_blake2sp_256_with_key_create_in(kk, key);
+    FEED(Hacl_Streaming_Blake2p_256_blake2sp_256_with_key_update, kk, s, msg, len);
+    Hacl_Streaming_Blake2p_256_blake2sp_256_with_key_finish(kk, s, h1);
+    Hacl_Streaming_Blake2p_256_blake2sp_256_with_key_finish(kk, s, h2);
+    ok1 = ok1 && memcmp(h0, h1, 32) == 0 && memcmp(h0, h2, 32) == 0;
+    Hacl_Streaming_Blake2p_256_blake2sp_256_with_key_init(kk, key, s);
+    Hacl_Streaming_Blake2p_256_blake2sp_256_with_key_update(kk, s, msg, len);
+    Hacl_Streaming_Blake2p_256_blake2sp_256_with_key_finish(kk, s, h1);
+    ok1 = ok1 && memcmp(h0, h1, 32) == 0;
+    Hacl_Streaming_Blake2p_256_blake2sp_256_with_key_free(kk, s);
+  }
+  printf("BLAKE2sp (streaming against one-shot) Result:\n");
+  if (ok1) printf("Success!\n");
+  else printf("**FAILED**\n");
+  ok = ok && ok1;
+
+  // The no_key variants
+  for (int i = 0; i < MAXLEN; i++) msg[i] = (uint8_t)i;
+  Hacl_Streaming_Blake2p_256_blake2bp_256_state *sb =
+    Hacl_Streaming_Blake2p_256_blake2bp_256_no_key_create_in();
+  Hacl_Streaming_Blake2p_256_blake2bp_256_no_key_update(sb, msg, 600);
+  Hacl_Streaming_Blake2p_256_blake2bp_256_no_key_update(sb, msg + 600, 400);
+  Hacl_Streaming_Blake2p_256_blake2bp_256_no_key_finish(sb, h0);
+  Hacl_Streaming_Blake2p_256_blake2bp_256_no_key_free(sb);
+  printf("BLAKE2bp (streaming, no key) Result:\n");
+  ok = compare_and_print(64, h0, unkeyed_blake2bp) && ok;
+
+  Hacl_Streaming_Blake2p_256_blake2sp_256_state *ss =
+    Hacl_Streaming_Blake2p_256_blake2sp_256_no_key_create_in();
+  Hacl_Streaming_Blake2p_256_blake2sp_256_no_key_update(ss, msg, 1);
+  Hacl_Streaming_Blake2p_256_blake2sp_256_no_key_update(ss, msg + 1, 999);
+  Hacl_Streaming_Blake2p_256_blake2sp_256_no_key_finish(ss, h0);
+  Hacl_Streaming_Blake2p_256_blake2sp_256_no_key_free(ss);
+  printf("BLAKE2sp (streaming, no key) Result:\n");
+  ok = compare_and_print(32, h0, unkeyed_blake2sp) && ok;
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  srand(0xb2b2);
+
+  if (!EverCrypt_AutoConfig2_has_avx2()) {
+    printf("AVX2 not available, skipping\n");
+    return EXIT_SUCCESS;
+  }
+
+  bool ok = test_known_answer();
+  ok = test_streaming() && ok;
+
+  uint8_t *plain = malloc(SIZE);
+  uint8_t out[64];
+  memset(plain, 'P', SIZE);
+  uint64_t res = 0;
+  cycles a, b;
+  clock_t t1, t2;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Blake2b_256_blake2b(64, out, SIZE, plain, 0, NULL);
+    res ^= out[0] ^ out[63];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff1 = t2 - t1;
+  cycles cdiff1 = b - a;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Blake2bp_256_blake2bp(64, out, SIZE, plain, 0, NULL);
+    res ^= out[0] ^ out[63];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff2 = t2 - t1;
+  cycles cdiff2 = b - a;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Blake2s_128_blake2s(32, out, SIZE, plain, 0, NULL);
+    res ^= out[0] ^ out[31];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff3 = t2 - t1;
+  cycles cdiff3 = b - a;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Blake2sp_256_blake2sp(32, out, SIZE, plain, 0, NULL);
+    res ^= out[0] ^ out[31];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff4 = t2 - t1;
+  cycles cdiff4 = b - a;
+
+  uint64_t count = ROUNDS * SIZE;
+  printf("\n res: %d \n", (int)res);
+  printf("BLAKE2b (vec256) PERF:\n"); print_time(count, tdiff1, cdiff1);
+  printf("BLAKE2bp (vec256) PERF:\n"); print_time(count, tdiff2, cdiff2);
+  printf("BLAKE2s (vec128) PERF:\n"); print_time(count, tdiff3, cdiff3);
+  printf("BLAKE2sp (vec256) PERF:\n"); print_time(count, tdiff4, cdiff4);
+  free(plain);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,346 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "Hacl_Blake2b_32.h"
+#include "Hacl_Blake2b_256.h"
+#include "Hacl_Blake2s_128.h"
+#include "Hacl_Blake3_32.h"
+#include "Hacl_Blake3_128.h"
+#include "Hacl_Blake3_256.h"
+#include "Hacl_Streaming_Blake3.h"
+#include "Hacl_Streaming_Blake3_128.h"
+#include "Hacl_Streaming_Blake3_256.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+
+#define MANY   200
+#define SWEEP  2200
+#define MAXLEN (2100 + 99 * 997 + 1)
+#define MTLEN  (8 * 1024 * 1024 + 4321)
+#define ROUNDS 4096
+#define SIZE   16384
+
+// The key and context strings of the official test_vectors.json
+static uint8_t key[32] = "whats the Elvish word for friend";
+static char *context = "BLAKE3 2019-12-27 16:29:52 test vectors context";
+
+static uint8_t kat_abc[32] = {
+  0x64, 0x37, 0xb3, 0xac, 0x38, 0x46, 0x51, 0x33, 0xff, 0xb6, 0x3b, 0x75, 0x27, 0x3a, 0x8d, 0xb5,
+  0x48, 0xc5, 0x58, 0x46, 0x5d, 0x79, 0xdb, 0x03, 0xfd, 0x35, 0x9c, 0x6c, 0xd5, 0xbd, 0x9d, 0x85
+};
+
+// The first 131 bytes of extended output for the empty input
+static uint8_t kat_empty[131] = {
+  0xaf, 0x13, 0x49, 0xb9, 0xf5, 0xf9, 0xa1, 0xa6, 0xa0, 0x40, 0x4d, 0xea, 0x36, 0xdc, 0xc9, 0x49,
+  0x9b, 0xcb, 0x25, 0xc9, 0xad, 0xc1, 0x12, 0xb7, 0xcc, 0x9a, 0x93, 0xca, 0xe4, 0x1f, 0x32, 0x62,
+  0xe0, 0x0f, 0x03, 0xe7, 0xb6, 0x9a, 0xf2, 0x6b, 0x7f, 0xaa, 0xf0, 0x9f, 0xcd, 0x33, 0x30, 0x50,
+  0x33, 0x8d, 0xdf, 0xe0, 0x85, 0xb8, 0xcc, 0x86, 0x9c, 0xa9, 0x8b, 0x20, 0x6c, 0x08, 0x24, 0x3a,
+  0x26, 0xf5, 0x48, 0x77, 0x89, 0xe8, 0xf6, 0x60, 0xaf, 0xe6, 0xc9, 0x9e, 0xf9, 0xe0, 0xc5, 0x2b,
+  0x92, 0xe7, 0x39, 0x30, 0x24, 0xa8, 0x04, 0x59, 0xcf, 0x91, 0xf4, 0x76, 0xf9, 0xff, 0xdb, 0xda,
+  0x70, 0x01, 0xc2, 0x2e, 0x15, 0x9b, 0x40, 0x26, 0x31, 0xf2, 0x77, 0xca, 0x96, 0xf2, 0xde, 0xfd,
+  0xf1, 0x07, 0x82, 0x82, 0x31, 0x4e, 0x76, 0x36, 0x99, 0xa3, 0x1c, 0x53, 0x63, 0x16, 0x54, 0x21,
+  0xcc, 0xe1, 0x4d
+};
+
+// Digest of the first MiB of the input i % 251 used below
+static uint8_t kat_mib[32] = {
+  0x74, 0xcb, 0x44, 0x1f, 0xd0, 0x87, 0x76, 0x4c, 0xa9, 0xc3, 0x69, 0x4d, 0xa7, 0x42, 0xeb, 0xe3,
+  0x0c, 0xbe, 0xb3, 0x06, 0x0a, 0x17, 0x00, 0x9c, 0xa8, 0x18, 0x25, 0xc7, 0xa8, 0xd1, 0x03, 0x43
+};
+
+// BLAKE2b-512 of the concatenated outputs of the sweep below, over the inputs
+// i % 251 of every length up to 2100 bytes and then in steps of 997 bytes.
+// Each length is hashed with 1 + (7 * len) % 131 bytes of output, in keyed
+// mode with 32 bytes, and in key derivation mode with 1 + (3 * len) % 67 bytes.
+static uint8_t sweep[64] = {
+  0xe6, 0x67, 0x67, 0x9a, 0x5a, 0x75, 0xd1, 0x0d, 0x7c, 0xdc, 0xc9, 0x3f, 0xc8, 0xdf, 0x9b, 0xb2,
+  0x35, 0x3a, 0x63, 0x0b, 0xa0, 0x7b, 0x11, 0x94, 0x6f, 0x06, 0xe9, 0x52, 0x19, 0xda, 0x6a, 0x08,
+  0xe3, 0x47, 0x37, 0x53, 0xe6, 0xcf, 0x8e, 0xec, 0x36, 0xf6, 0xc7, 0xe5, 0xf1, 0x4a, 0x81, 0x84,
+  0xaa, 0xd3, 0x1a, 0x1c, 0x34, 0xbd, 0x5b, 0xff, 0xba, 0xbc, 0x94, 0x5b, 0xeb, 0x1d, 0xab, 0x51
+};
+
+typedef void (*blake3_hash)(uint32_t, uint8_t *, uint32_t, uint8_t *);
+typedef void (*blake3_keyed)(uint32_t, uint8_t *, uint32_t, uint8_t *, uint8_t *);
+typedef void (*blake3_derive)(uint32_t, uint8_t *, uint32_t, uint8_t *, uint32_t, uint8_t *);
+typedef void (*blake3_mt)(void (*)(void *, void (*)(void *), void *, void *), void *,
+  uint32_t, uint8_t *, uint64_t, uint8_t *);
+typedef void (*blake3_update)(Hacl_Streaming_Blake3_blake3_state *, uint8_t *, uint32_t);
+typedef void (*blake3_update_mt)(void (*)(void *, void (*)(void *), void *, void *), void *,
+  Hacl_Streaming_Blake3_blake3_state *, uint8_t *, uint32_t);
+
+typedef struct {
+  const char *name;
+  bool avx2;
+  blake3_hash hash;
+  blake3_keyed keyed_hash;
+  blake3_derive derive_key;
+  blake3_mt hash_mt;
+  blake3_update update;
+  blake3_update_mt update_mt;
+} blake3_impl;
+
+static blake3_impl impls[] = {
+  { "BLAKE3 (32)", false, Hacl_Blake3_32_hash, Hacl_Blake3_32_keyed_hash,
+    Hacl_Blake3_32_derive_key, Hacl_Blake3_32_hash_mt,
+    Hacl_Streaming_Blake3_blake3_32_update, Hacl_Streaming_Blake3_blake3_32_update_mt },
+  { "BLAKE3 (vec128)", false, Hacl_Blake3_128_hash, Hacl_Blake3_128_keyed_hash,
+    Hacl_Blake3_128_derive_key, Hacl_Blake3_128_hash_mt,
+    Hacl_Streaming_Blake3_128_blake3_128_update, Hacl_Streaming_Blake3_128_blake3_128_update_mt },
+  { "BLAKE3 (vec256)", true, Hacl_Blake3_256_hash, Hacl_Blake3_256_keyed_hash,
+    Hacl_Blake3_256_derive_key, Hacl_Blake3_256_hash_mt,
+    Hacl_Streaming_Blake3_256_blake3_256_update, Hacl_Streaming_Blake3_256_blake3_256_update_mt },
+};
+
+#define NUM_IMPLS (sizeof(impls)/sizeof(blake3_impl))
+
+static uint32_t sweep_len(uint32_t j) {
+  return j < 2100 ? j : 2100 + (j - 2100) * 997;
+}
+
+bool test_known_answer(blake3_impl *impl, uint8_t *in) {
+  uint8_t out[131];
+  uint8_t *cat = malloc(SWEEP * (131 + 32 + 67));
+  bool ok = true;
+
+  impl->hash(32, out, 3, (uint8_t *)"abc");
+  printf("%s (abc) Result:\n", impl->name);
+  ok = compare_and_print(32, out, kat_abc) && ok;
+
+  impl->hash(131, out, 0, in);
+  printf("%s (empty, extended output) Result:\n", impl->name);
+  ok = compare_and_print(131, out, kat_empty) && ok;
+
+  impl->hash(32, out, 1024 * 1024, in);
+  printf("%s (1 MiB) Result:\n", impl->name);
+  ok = compare_and_print(32, out, kat_mib) && ok;
+
+  uint32_t off = 0;
+  for (uint32_t j = 0; j < SWEEP; j++) {
+    uint32_t len = sweep_len(j);
+    uint32_t nn = 1 + (7 * len) % 131;
+    impl->hash(nn, cat + off, len, in);
+    off += nn;
+    impl->keyed_hash(32, cat + off, len, in, key);
+    off += 32;
+    nn = 1 + (3 * len) % 67;
+    impl->derive_key(nn, cat + off, strlen(context), (uint8_t *)context, len, in);
+    off += nn;
+  }
+  Hacl_Blake2b_32_blake2b(64, out, off, cat, 0, NULL);
+  printf("%s (length sweep, all modes) Result:\n", impl->name);
+  ok = compare_and_print(64, out, sweep) && ok;
+  free(cat);
+  return ok;
+}
+
+// Feeds msg in random chunks, including empty ones and whole aligned subtrees.
+static void feed(blake3_update update, Hacl_Streaming_Blake3_blake3_state *s,
+  uint8_t *msg, uint32_t len)
+{
+  uint32_t off = 0;
+  while (off < len) {
+    uint32_t c = rand() % 4 == 0 ? 0 : rand() % (len - off + 1);
+    if (rand() % 4 == 0 && len - off >= 4096) c = 1024 << (rand() % 3);
+    if (rand() % 4 == 0) c = c % 100;
+    update(s, msg + off, c);
+    off += c;
+  }
+}
+
+// The streaming API agrees with the one-shot functions in all three modes,
+// however the input is split.
+bool test_streaming(blake3_impl *impl) {
+  uint8_t *msg = malloc(MAXLEN);
+  uint8_t h0[100], h1[100], h2[100];
+  bool ok = true;
+  for (int j = 0; j < MANY; j++) {
+    uint32_t len = j < 50 ? j * 97 : rand() % (j < 150 ? 20000 : MAXLEN);
+    uint32_t nn = 1 + rand() % 100;
+    int mode = j % 3;
+    for (int i = 0; i < len; i++) msg[i] = (uint8_t)rand();
+
+    Hacl_Streaming_Blake3_blake3_state *s;
+    if (mode == 0) {
+      impl->hash(nn, h0, len, msg);
+      s = Hacl_Streaming_Blake3_blake3_32_create_in();
+    } else if (mode == 1) {
+      impl->keyed_hash(nn, h0, len, msg, key);
+      s = Hacl_Streaming_Blake3_blake3_32_keyed_create_in(key);
+    } else {
+      impl->derive_key(nn, h0, strlen(context), (uint8_t *)context, len, msg);
+      s = Hacl_Streaming_Blake3_blake3_32_derive_key_create_in(strlen(context), (uint8_t *)context);
+    }
+    feed(impl->update, s, msg, len);
+    Hacl_Streaming_Blake3_blake3_32_finish(s, h1, nn);
+    // finish does not consume the state
+    Hacl_Streaming_Blake3_blake3_32_finish(s, h2, nn);
+    ok = ok && memcmp(h0, h1, nn) == 0 && memcmp(h0, h2, nn) == 0;
+    Hacl_Streaming_Blake3_blake3_32_init(s);
+    impl->update(s, msg, len);
+    Hacl_Streaming_Blake3_blake3_32_finish(s, h1, nn);
+    ok = ok && memcmp(h0, h1, nn) == 0;
+    Hacl_Streaming_Blake3_blake3_32_free(s);
+  }
+  printf("%s (streaming against one-shot) Result:\n", impl->name);
+  if (ok) printf("Success!\n");
+  else printf("**FAILED**\n");
+  free(msg);
+  return ok;
+}
+
+// A join for hash_mt that runs the left task on a new thread while fewer than
+// eight are live, and both tasks on the calling thread otherwise.
+static void *run_task(void *arg) {
+  void **t = arg;
+  ((void (*)(void *))t[0])(t[1]);
+  return NULL;
+}
+
+static void join_pthread(void *pool, void (*task)(void *), void *left, void *right) {
+  int *live = pool;
+  pthread_t th;
+  void *t[2] = { (void *)task, left };
+  if (__atomic_add_fetch(live, 1, __ATOMIC_SEQ_CST) <= 8 &&
+      pthread_create(&th, NULL, run_task, t) == 0) {
+    task(right);
+    pthread_join(th, NULL);
+  } else {
+    task(left);
+    task(right);
+  }
+  __atomic_sub_fetch(live, 1, __ATOMIC_SEQ_CST);
+}
+
+static void join_serial(void *pool, void (*task)(void *), void *left, void *right) {
+  (*(int *)pool)++;
+  task(right);
+  task(left);
+}
+
+bool test_mt(blake3_impl *impl, uint8_t *in) {
+  uint8_t h0[64], h1[64];
+  bool ok = true;
+  int joins = 0;
+  int live = 0;
+  uint32_t lens[] = { 0, 1024, 131072, 131073, 262144, 1000000, MTLEN };
+  for (int i = 0; i < sizeof(lens)/sizeof(uint32_t); i++) {
+    impl->hash(64, h0, lens[i], in);
+    impl->hash_mt(join_serial, &joins, 64, h1, lens[i], in);
+    ok = ok && memcmp(h0, h1, 64) == 0;
+    impl->hash_mt(join_pthread, &live, 64, h1, lens[i], in);
+    ok = ok && memcmp(h0, h1, 64) == 0;
+    // Same for the streaming API, in two updates that are not chunk-aligned
+    Hacl_Streaming_Blake3_blake3_state *s = Hacl_Streaming_Blake3_blake3_32_create_in();
+    impl->update_mt(join_pthread, &live, s, in, lens[i] / 3);
+    impl->update_mt(join_serial, &joins, s, in + lens[i] / 3, lens[i] - lens[i] / 3);
+    Hacl_Streaming_Blake3_blake3_32_finish(s, h1, 64);
+    ok = ok && memcmp(h0, h1, 64) == 0;
+    Hacl_Streaming_Blake3_blake3_32_free(s);
+  }
+  // Inputs above the threshold are actually split
+  ok = ok && joins > 0;
+  printf("%s (multithreaded against one-shot) Result:\n", impl->name);
+  if (ok) printf("Success!\n");
+  else printf("**FAILED**\n");
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  srand(0xb3b3);
+
+  uint8_t *in = malloc(MTLEN);
+  for (int i = 0; i < MTLEN; i++) in[i] = (uint8_t)(i % 251);
+
+  bool has_avx2 = EverCrypt_AutoConfig2_has_avx2();
+  bool ok = true;
+  for (int k = 0; k < NUM_IMPLS; k++) {
+    blake3_impl *impl = &impls[k];
+    if (impl->avx2 && !has_avx2) {
+      printf("AVX2 not available, skipping %s\n", impl->name);
+      continue;
+    }
+    ok = test_known_answer(impl, in) && ok;
+    ok = test_streaming(impl) && ok;
+    ok = test_mt(impl, in) && ok;
+  }
+
+  uint8_t *plain = malloc(SIZE);
+  uint8_t out[64];
+  memset(plain, 'P', SIZE);
+  uint64_t res = 0;
+  cycles a, b;
+  clock_t t1, t2;
+  uint64_t count = ROUNDS * SIZE;
+  printf("\n");
+
+  if (has_avx2) {
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_Blake2b_256_blake2b(64, out, SIZE, plain, 0, NULL);
+      res ^= out[0] ^ out[63];
+    }
+    b = cpucycles_end();
+    t2 = clock();
+    printf("BLAKE2b (vec256) PERF:\n"); print_time(count, t2 - t1, b - a);
+  }
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Blake2s_128_blake2s(32, out, SIZE, plain, 0, NULL);
+    res ^= out[0] ^ out[31];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  printf("BLAKE2s (vec128) PERF:\n"); print_time(count, t2 - t1, b - a);
+
+  for (int k = 0; k < NUM_IMPLS; k++) {
+    blake3_impl *impl = &impls[k];
+    if (impl->avx2 && !has_avx2) continue;
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      impl->hash(32, out, SIZE, plain);
+      res ^= out[0] ^ out[31];
+    }
+    b = cpucycles_end();
+    t2 = clock();
+    printf("%s PERF:\n", impl->name); print_time(count, t2 - t1, b - a);
+  }
+
+  // Wall-clock time of the multithreaded entry point on the large input
+  blake3_impl *impl = &impls[has_avx2 ? 2 : 1];
+  for (int k = 0; k < 2; k++) {
+    int live = 0;
+    struct timespec ts1, ts2;
+    clock_gettime(CLOCK_MONOTONIC, &ts1);
+    for (int j = 0; j < 16; j++) {
+      if (k == 0) impl->hash(32, out, MTLEN, in);
+      else impl->hash_mt(join_pthread, &live, 32, out, MTLEN, in);
+      res ^= out[0] ^ out[31];
+    }
+    clock_gettime(CLOCK_MONOTONIC, &ts2);
+    double secs = (ts2.tv_sec - ts1.tv_sec) + (ts2.tv_nsec - ts1.tv_nsec) / 1e9;
+    printf("%s%s on %d bytes: %8.2f MB/s\n", impl->name, k == 0 ? "" : " (threads)",
+      MTLEN, 16.0 * MTLEN / secs / 1e6);
+  }
+  printf("\n res: %d \n", (int)res);
+
+  free(plain);
+  free(in);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,174 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "EverCrypt_CTR.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+
+#define ROUNDS 20000
+#define SIZE   4096
+#define MANY   200
+#define MAXLEN 2100
+
+
+static const char *alg_name(Spec_Agile_Cipher_cipher_alg a) {
+  switch (a) {
+    case Spec_Agile_Cipher_AES128: return "AES128-CTR";
+    case Spec_Agile_Cipher_AES256: return "AES256-CTR";
+    default: return "Chacha20";
+  }
+}
+
+static uint32_t block_len(Spec_Agile_Cipher_cipher_alg a) {
+  return a == Spec_Agile_Cipher_CHACHA20 ? 64 : 16;
+}
+
+// Reference: one block at a time, the last one zero-padded. Each block gets a
+// fresh state, since the ChaCha20 update_block does not advance the counter.
+static void ref_blocks(Spec_Agile_Cipher_cipher_alg a, uint8_t *key, uint8_t *iv, uint32_t iv_len,
+  uint32_t *c, uint8_t *dst, uint8_t *src, uint32_t len)
+{
+  uint8_t in[64], out[64];
+  uint32_t bl = block_len(a);
+  for (uint32_t off = 0; off < len; off += bl) {
+    EverCrypt_CTR_state_s *s = NULL;
+    uint32_t n = len - off < bl ? len - off : bl;
+    memset(in, 0, bl);
+    memcpy(in, src + off, n);
+    EverCrypt_CTR_create_in(a, &s, key, iv, iv_len, *c);
+    EverCrypt_CTR_update_block(s, out, in);
+    EverCrypt_CTR_free(s);
+    memcpy(dst + off, out, n);
+    (*c)++;
+  }
+}
+
+// update_blocks agrees with block-by-block encryption, including across calls:
+// a partial block consumes a whole counter value.
+bool test_alg(Spec_Agile_Cipher_cipher_alg a, uint32_t iv_len, uint8_t iv_fill, uint32_t c0) {
+  uint8_t key[32], iv[16];
+  uint8_t plain[MAXLEN], cipher[MAXLEN], cipher1[MAXLEN];
+  EverCrypt_CTR_state_s *s1 = NULL;
+  uint32_t c = c0;
+  bool ok = true;
+
+  for (int i = 0; i < 32; i++) key[i] = (uint8_t)rand();
+  for (int i = 0; i < 16; i++) iv[i] = iv_fill ? iv_fill : (uint8_t)rand();
+  if (EverCrypt_CTR_create_in(a, &s1, key, iv, iv_len, c0) != EverCrypt_Error_Success) {
+    printf("%s not available, skipping\n", alg_name(a));
+    return true;
+  }
+
+  for (int j = 0; j < MANY; j++) {
+    uint32_t len = j < 4 ? j * 8 : rand() % MAXLEN;
+    for (int i = 0; i < len; i++) plain[i] = (uint8_t)rand();
+    ref_blocks(a, key, iv, iv_len, &c, cipher, plain, len);
+    EverCrypt_CTR_update_blocks(s1, cipher1, plain, len);
+    ok = ok && memcmp(cipher, cipher1, len) == 0;
+  }
+
+  printf("%s (update_blocks, IV length %u, counter %" PRIu32 ") Result:\n", alg_name(a), iv_len, c0);
+  if (ok) printf("Success!\n");
+  else printf("**FAILED**\n");
+
+  EverCrypt_CTR_free(s1);
+  return ok;
+}
+
+// The ChaCha20 update_block leaves the counter unchanged.
+bool test_chacha20_update_block() {
+  uint8_t key[32], iv[12], in[64], out[64], out1[64];
+  EverCrypt_CTR_state_s *s = NULL;
+  for (int i = 0; i < 32; i++) key[i] = (uint8_t)rand();
+  for (int i = 0; i < 12; i++) iv[i] = (uint8_t)rand();
+  for (int i = 0; i < 64; i++) in[i] = (uint8_t)rand();
+  EverCrypt_CTR_create_in(Spec_Agile_Cipher_CHACHA20, &s, key, iv, 12, 7);
+  EverCrypt_CTR_update_block(s, out, in);
+  EverCrypt_CTR_update_block(s, out1, in);
+  bool ok = memcmp(out, out1, 64) == 0;
+  EverCrypt_CTR_update_blocks(s, out1, in, 64);
+  ok = ok && memcmp(out, out1, 64) == 0;
+  EverCrypt_CTR_update_blocks(s, out1, in, 64);
+  ok = ok && memcmp(out, out1, 64) != 0;
+  EverCrypt_CTR_free(s);
+
+  printf("Chacha20 (update_block is stateless) Result:\n");
+  if (ok) printf("Success!\n");
+  else printf("**FAILED**\n");
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  srand(0xc7);
+
+  bool ok = true;
+  Spec_Agile_Cipher_cipher_alg algs[3] = { Spec_Agile_Cipher_AES128, Spec_Agile_Cipher_AES256, Spec_Agile_Cipher_CHACHA20 };
+  for (int k = 0; k < 3; k++) {
+    ok = test_alg(algs[k], 12, 0, 0) && ok;
+    ok = test_alg(algs[k], 12, 0, 1) && ok;
+  }
+  // With a 16-byte IV, the low 32 bits of the counter block wrap around in
+  // the middle of a call.
+  ok = test_alg(Spec_Agile_Cipher_AES128, 16, 0xff, 0) && ok;
+  ok = test_alg(Spec_Agile_Cipher_AES256, 16, 0xff, 0) && ok;
+  ok = test_chacha20_update_block() && ok;
+
+  uint8_t *plain = malloc(SIZE);
+  uint8_t *cipher = malloc(SIZE);
+  uint8_t key[32], iv[12];
+  memset(plain, 'P', SIZE);
+  memset(key, 'K', 32);
+  memset(iv, 'N', 12);
+  for (int k = 0; k < 3; k++) {
+    Spec_Agile_Cipher_cipher_alg a = algs[k];
+    uint32_t bl = block_len(a);
+    EverCrypt_CTR_state_s *s = NULL;
+    if (EverCrypt_CTR_create_in(a, &s, key, iv, 12, 0) != EverCrypt_Error_Success) continue;
+    uint64_t res = 0;
+    cycles c1, c2;
+    clock_t t1, t2;
+
+    t1 = clock();
+    c1 = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      for (uint32_t off = 0; off < SIZE; off += bl)
+        EverCrypt_CTR_update_block(s, cipher + off, plain + off);
+      res ^= cipher[0] ^ cipher[SIZE - 1];
+    }
+    c2 = cpucycles_end();
+    t2 = clock();
+    clock_t tdiff1 = t2 - t1;
+    cycles cdiff1 = c2 - c1;
+
+    t1 = clock();
+    c1 = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      EverCrypt_CTR_update_blocks(s, cipher, plain, SIZE);
+      res ^= cipher[0] ^ cipher[SIZE - 1];
+    }
+    c2 = cpucycles_end();
+    t2 = clock();
+    clock_t tdiff2 = t2 - t1;
+    cycles cdiff2 = c2 - c1;
+
+    uint64_t count = ROUNDS * SIZE;
+    printf("%s (update_block, 4096 bytes) PERF: %d\n", alg_name(a), (int)res); print_time(count, tdiff1, cdiff1);
+    printf("%s (update_blocks, 4096 bytes) PERF:\n", alg_name(a)); print_time(count, tdiff2, cdiff2);
+    EverCrypt_CTR_free(s);
+  }
+  free(plain);
+  free(cipher);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,164 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "Hacl_Curve25519_51.h"
+#include "Hacl_Curve25519_256.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+#include "curve25519_vectors.h"
+
+#define ROUNDS 20000
+#define SIZE   1
+#define MANY   256
+
+
+bool print_result(int in_len, uint8_t* comp, uint8_t* exp) {
+  return compare_and_print(in_len, comp, exp);
+}
+
+bool print_test(uint8_t* scalar, uint8_t* pub, uint8_t* exp){
+  uint8_t comp[32] = {0};
+  uint8_t comp4[128] = {0};
+  uint8_t scalar4[128];
+  uint8_t pub4[128];
+  bool res4[4];
+
+  Hacl_Curve25519_256_ecdh(comp,scalar,pub);
+  printf("Curve25519 (256-bit) Result:\n");
+  bool ok = print_result(32,comp,exp);
+
+  for (int l = 0; l < 4; l++) {
+    memcpy(scalar4 + 32 * l,scalar,32);
+    memcpy(pub4 + 32 * l,pub,32);
+  }
+  Hacl_Curve25519_256_ecdh4(res4,comp4,scalar4,pub4);
+  printf("Curve25519 (4x256-bit) Result:\n");
+  for (int l = 0; l < 4; l++) ok = print_result(32,comp4 + 32 * l,exp) && res4[l] && ok;
+  return ok;
+}
+
+// Every lane gets a different key and point; the results are checked against
+// the 51-bit implementation. Some points are non-canonical (>= p, or with the
+// top bit set) and some are low-order, so that ecdh returns false.
+bool test_lanes() {
+  uint8_t priv[128];
+  uint8_t pub[128];
+  uint8_t comp[128];
+  uint8_t comp1[32];
+  uint8_t exp[32];
+  bool res[4];
+  bool ok = true;
+  srand(0x25519);
+  for (int j = 0; j < MANY; j++) {
+    for (int i = 0; i < 128; i++) {
+      priv[i] = (uint8_t)rand();
+      pub[i] = (uint8_t)rand();
+    }
+    if (j % 8 == 1) memset(pub + 32 * (j % 4),0xff,32);
+    if (j % 8 == 3) memset(pub + 32 * (j % 4),0,32);
+    if (j % 8 == 5) pub[31 + 32 * (j % 4)] |= 0x80;
+    if (j % 8 == 7) {
+      memset(pub + 32 * (j % 4),0,32);
+      pub[32 * (j % 4)] = 1;
+    }
+    Hacl_Curve25519_256_ecdh4(res,comp,priv,pub);
+    for (int l = 0; l < 4; l++) {
+      bool r = Hacl_Curve25519_51_ecdh(exp,priv + 32 * l,pub + 32 * l);
+      bool r1 = Hacl_Curve25519_256_ecdh(comp1,priv + 32 * l,pub + 32 * l);
+      ok = ok && (r == res[l]) && (r == r1);
+      ok = ok && (memcmp(comp + 32 * l,exp,32) == 0) && (memcmp(comp1,exp,32) == 0);
+    }
+    Hacl_Curve25519_256_secret_to_public4(comp,priv);
+    for (int l = 0; l < 4; l++) {
+      Hacl_Curve25519_51_secret_to_public(exp,priv + 32 * l);
+      Hacl_Curve25519_256_secret_to_public(comp1,priv + 32 * l);
+      ok = ok && (memcmp(comp + 32 * l,exp,32) == 0) && (memcmp(comp1,exp,32) == 0);
+    }
+  }
+  return ok;
+}
+
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  if (!EverCrypt_AutoConfig2_has_avx2()) {
+    printf("AVX2 not available, skipping Curve25519 (256-bit) tests\n");
+    return EXIT_SUCCESS;
+  }
+
+  bool ok = true;
+  for (int i = 0; i < sizeof(vectors)/sizeof(curve25519_test_vector); ++i) {
+    ok &= print_test(vectors[i].scalar,vectors[i].public,vectors[i].secret);
+  }
+
+  printf("Curve25519 (256-bit, all lanes distinct) Result:\n");
+  bool ok_many = test_lanes();
+  if (ok_many) printf("Success!\n");
+  else printf("**FAILED**\n");
+  ok = ok && ok_many;
+
+  uint8_t pub[128];
+  uint8_t priv[128];
+  uint8_t key[128];
+  bool r[4];
+  uint64_t res = 0;
+  cycles a,b;
+  clock_t t1,t2;
+
+  memset(pub,'P',128);
+  memset(priv,'S',128);
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Curve25519_51_ecdh(key,priv,pub);
+    res ^= key[0] ^ key[15];
+  }
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Curve25519_51_ecdh(key,priv,pub);
+    res ^= key[0] ^ key[15];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff1 = t2 - t1;
+  cycles cdiff1 = b - a;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Curve25519_256_ecdh(key,priv,pub);
+    res ^= key[0] ^ key[15];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff2 = t2 - t1;
+  cycles cdiff2 = b - a;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS / 4; j++) {
+    Hacl_Curve25519_256_ecdh4(r,key,priv,pub);
+    res ^= key[0] ^ key[111];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff3 = t2 - t1;
+  cycles cdiff3 = b - a;
+
+  uint64_t count = ROUNDS * SIZE;
+  printf("Curve25519 (51-bit) PERF: %d\n",(int)res); print_time(count,tdiff1,cdiff1);
+  printf("Curve25519 (256-bit) PERF:\n"); print_time(count,tdiff2,cdiff2);
+  printf("Curve25519 (4x256-bit) PERF:\n"); print_time(count,tdiff3,cdiff3);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,174 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "Hacl_Ed25519.h"
+
+#include "test_helpers.h"
+#include "ed25519_vectors.h"
+
+#define ROUNDS 64
+#define BATCH  100
+#define MSG    128
+
+bool print_test(uint8_t* secret, uint8_t* pub, size_t msg_len, uint8_t* msg, uint8_t* exp_sig){
+  uint8_t comp_pub[32] = {0};
+  uint8_t comp_sig[64] = {0};
+  Hacl_Ed25519_secret_to_public(comp_pub, secret);
+  printf("Ed25519 secret_to_public Result:\n");
+  bool ok = compare_and_print(32, comp_pub, pub);
+
+  Hacl_Ed25519_sign(comp_sig, secret, msg_len, msg);
+  printf("Ed25519 sign Result:\n");
+  ok = compare_and_print(64, comp_sig, exp_sig) && ok;
+
+  bool valid = Hacl_Ed25519_verify(pub, msg_len, msg, exp_sig);
+  printf("Ed25519 verify Result: %s\n", valid ? "Success!" : "**FAILED**");
+  return ok && valid;
+}
+
+static uint8_t pubs[BATCH * 32];
+static uint8_t sigs[BATCH * 64];
+static uint8_t msgs_buf[BATCH * MSG];
+static uint8_t* msgs[BATCH];
+static uint32_t lens[BATCH];
+
+// Every signature in the batch is checked against the one-signature verifier.
+bool check_batch(uint32_t n, bool expected) {
+  bool res[BATCH];
+  bool all = Hacl_Ed25519_verify_batch(n, pubs, lens, msgs, sigs, res);
+  bool ok = (all == expected);
+  for (uint32_t i = 0; i < n; i++)
+    ok = ok && (res[i] == Hacl_Ed25519_verify(pubs + 32 * i, lens[i], msgs[i], sigs + 64 * i));
+  return ok;
+}
+
+bool test_batch() {
+  uint8_t secret[32];
+  for (uint32_t i = 0; i < BATCH; i++) {
+    for (uint32_t j = 0; j < 32; j++) secret[j] = (uint8_t)(i * 7 + j * 13);
+    msgs[i] = msgs_buf + MSG * i;
+    lens[i] = (i * 37) % MSG;
+    for (uint32_t j = 0; j < lens[i]; j++) msgs[i][j] = (uint8_t)(i + j * 3);
+    Hacl_Ed25519_secret_to_public(pubs + 32 * i, secret);
+    Hacl_Ed25519_sign(sigs + 64 * i, secret, lens[i], msgs[i]);
+  }
+  bool ok = true;
+  // Batch sizes around the internal chunk size, including the empty batch.
+  uint32_t sizes[] = { 0, 1, 2, 7, 63, 64, 65, BATCH };
+  for (int i = 0; i < sizeof(sizes)/sizeof(uint32_t); i++)
+    ok = check_batch(sizes[i], true) && ok;
+
+  // One bad signature of each kind: modified message, wrong R, s out of range,
+  // and a public key that does not decompress.
+  msgs[3][0] ^= 1;
+  ok = check_batch(BATCH, false) && ok;
+  ok = check_batch(16, false) && ok;
+  msgs[3][0] ^= 1;
+  sigs[64 * 70] ^= 4;
+  ok = check_batch(BATCH, false) && ok;
+  sigs[64 * 70] ^= 4;
+  sigs[64 * 10 + 63] |= 0xf0;
+  ok = check_batch(BATCH, false) && ok;
+  ok = check_batch(16, false) && ok;
+  sigs[64 * 10 + 63] &= 0x0f;
+  uint8_t pub_save[32];
+  memcpy(pub_save, pubs + 32 * 99, 32);
+  memset(pubs + 32 * 99, 0xff, 32);
+  ok = check_batch(BATCH, false) && ok;
+  memcpy(pubs + 32 * 99, pub_save, 32);
+  ok = check_batch(BATCH, true) && ok;
+
+  // Signatures on the public key (0, -1) of order 2 with secret scalar 0:
+  // (R, s) = ([r]B, r) is valid iff h is even. When h is odd, the error term
+  // has order 2 and cancels from a cofactorless combination whenever its
+  // weight is even, so these must be caught before the batch equation.
+  uint8_t ks[96];
+  uint8_t sig_save[16 * 64];
+  uint8_t pub_save16[16 * 32];
+  memcpy(sig_save, sigs + 64 * 20, 16 * 64);
+  memcpy(pub_save16, pubs + 32 * 20, 16 * 32);
+  Hacl_Ed25519_expand_keys(ks, secret);
+  memset(ks, 0xff, 32);
+  ks[0] = 0xec;
+  ks[31] = 0x7f;
+  memset(ks + 32, 0, 32);
+  uint32_t valid = 0;
+  for (uint32_t i = 20; i < 36; i++) {
+    memcpy(pubs + 32 * i, ks, 32);
+    Hacl_Ed25519_sign_expanded(sigs + 64 * i, ks, lens[i], msgs[i]);
+    valid += Hacl_Ed25519_verify(pubs + 32 * i, lens[i], msgs[i], sigs + 64 * i);
+  }
+  ok = ok && 0 < valid && valid < 16;
+  ok = check_batch(BATCH, false) && ok;
+  ok = check_batch(64, false) && ok;
+  memcpy(sigs + 64 * 20, sig_save, 16 * 64);
+  memcpy(pubs + 32 * 20, pub_save16, 16 * 32);
+  ok = check_batch(BATCH, true) && ok;
+  return ok;
+}
+
+int main(){
+  bool ok = true;
+  for (int i = 0; i < sizeof(vectors)/sizeof(ed25519_test_vector); ++i) {
+    ok &= print_test(vectors[i].secret,vectors[i].pub,vectors[i].msg_len,vectors[i].msg,vectors[i].sig);
+  }
+
+  printf("Ed25519 verify_batch Result:\n");
+  bool ok_batch = test_batch();
+  if (ok_batch) printf("Success!\n");
+  else printf("**FAILED**\n");
+  ok = ok && ok_batch;
+
+  bool res[BATCH];
+  bool r = true;
+  cycles a,b;
+  clock_t t1,t2;
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    for (int i = 0; i < 64; i++)
+      r = Hacl_Ed25519_verify(pubs + 32 * i, lens[i], msgs[i], sigs + 64 * i) && r;
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    r = Hacl_Ed25519_verify_batch(64, pubs, lens, msgs, sigs, res) && r;
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+
+  uint8_t secret[32] = {0};
+  uint8_t sig[64];
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS * 64; j++) {
+    Hacl_Ed25519_sign(sig, secret, MSG, msgs_buf);
+    secret[0] ^= sig[0];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff3 = b - a;
+  double tdiff3 = t2 - t1;
+
+  uint64_t count = ROUNDS * 64;
+  printf("Ed25519 sign (%d-byte messages) PERF: %d\n", MSG, (int)sig[0]);
+  printf("cycles per signature: %.0f, time: %.2fus\n", cdiff3 / count, tdiff3 * 1000000.0 / CLOCKS_PER_SEC / count);
+  printf("Ed25519 verify (64 signatures) PERF: %d\n", (int)r);
+  printf("cycles per signature: %.0f, time: %.2fus\n", cdiff1 / count, tdiff1 * 1000000.0 / CLOCKS_PER_SEC / count);
+  printf("Ed25519 verify_batch (64 signatures) PERF: %d\n", (int)r);
+  printf("cycles per signature: %.0f, time: %.2fus\n", cdiff2 / count, tdiff2 * 1000000.0 / CLOCKS_PER_SEC / count);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,151 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#define OPENSSL_SUPPRESS_DEPRECATED
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
+#include "EverCrypt_HMAC.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+
+#define MAXLEN 700
+#define ROUNDS 1000000
+#define SIZE   32
+
+typedef struct {
+  Spec_Hash_Definitions_hash_alg alg;
+  const char *name;
+  const char *openssl_name;
+} alg_t;
+
+static alg_t algs[] = {
+  { Spec_Hash_Definitions_MD5, "MD5", "md5" },
+  { Spec_Hash_Definitions_SHA1, "SHA1", "sha1" },
+  { Spec_Hash_Definitions_SHA2_224, "SHA2_224", "sha224" },
+  { Spec_Hash_Definitions_SHA2_256, "SHA2_256", "sha256" },
+  { Spec_Hash_Definitions_SHA2_384, "SHA2_384", "sha384" },
+  { Spec_Hash_Definitions_SHA2_512, "SHA2_512", "sha512" },
+  { Spec_Hash_Definitions_Blake2S, "Blake2S", "blake2s256" },
+  { Spec_Hash_Definitions_Blake2B, "Blake2B", "blake2b512" },
+  { Spec_Hash_Definitions_SHA3_224, "SHA3_224", "sha3-224" },
+  { Spec_Hash_Definitions_SHA3_256, "SHA3_256", "sha3-256" },
+  { Spec_Hash_Definitions_SHA3_384, "SHA3_384", "sha3-384" },
+  { Spec_Hash_Definitions_SHA3_512, "SHA3_512", "sha3-512" }
+};
+
+static void fill(uint8_t *b, uint32_t len) {
+  for (uint32_t i = 0; i < len; i++)
+    b[i] = rand();
+}
+
+// Message lengths 0 .. MAXLEN - 1 (every partial and complete block for all
+// block sizes), with keys shorter than, as long as, and longer than a block.
+// Each MAC is computed with a precomputed key, with the streaming API (on
+// random splits, with a finish in the middle), and with OpenSSL.
+static bool test_alg(alg_t *a) {
+  const EVP_MD *md = EVP_get_digestbyname(a->openssl_name);
+  if (md == NULL) {
+    printf("%s: not available in OpenSSL, skipping\n", a->name);
+    return true;
+  }
+  uint32_t block_len = EverCrypt_Hash_Incremental_block_len(a->alg);
+  uint32_t hash_len = EverCrypt_Hash_Incremental_hash_len(a->alg);
+  uint32_t key_lens[] = { 0, 1, hash_len, block_len - 1, block_len, block_len + 1, 3 * block_len };
+  uint8_t key[512], data[MAXLEN], expected[64], tag[64], tag2[64], tag3[64];
+  bool ok = true;
+
+  for (size_t k = 0; k < sizeof key_lens / sizeof key_lens[0]; k++) {
+    uint32_t key_len = key_lens[k];
+    fill(key, key_len);
+    EverCrypt_HMAC_key_s *hk = EverCrypt_HMAC_create_key(a->alg, key, key_len);
+    EverCrypt_HMAC_state_s *st = EverCrypt_HMAC_create_in(hk);
+    for (uint32_t len = 0; len < MAXLEN; len++) {
+      fill(data, len);
+      unsigned int out_len = 0;
+      HMAC(md, key, key_len, data, len, expected, &out_len);
+
+      EverCrypt_HMAC_compute_with_key(hk, tag, data, len);
+
+      EverCrypt_HMAC_init(st);
+      uint32_t done = 0;
+      while (done < len) {
+        uint32_t n = rand() % (len - done + 1);
+        EverCrypt_HMAC_update(st, data + done, n);
+        done += n;
+        if (rand() % 4 == 0)
+          EverCrypt_HMAC_finish(st, tag3);
+      }
+      EverCrypt_HMAC_finish(st, tag2);
+
+      bool ok1 = out_len == hash_len &&
+        memcmp(tag, expected, hash_len) == 0 && memcmp(tag2, expected, hash_len) == 0;
+      if (ok1 && EverCrypt_HMAC_is_supported_alg(a->alg)) {
+        EverCrypt_HMAC_compute(a->alg, tag3, key, key_len, data, len);
+        ok1 = memcmp(tag3, expected, hash_len) == 0;
+      }
+      if (!ok1 && ok)
+        printf("%s: mismatch for key length %u, data length %u\n", a->name, key_len, len);
+      ok = ok && ok1;
+    }
+    EverCrypt_HMAC_free(st);
+    EverCrypt_HMAC_free_key(hk);
+  }
+  printf("HMAC-%s (precomputed key and streaming, against OpenSSL) Result:\n", a->name);
+  if (ok) printf("Success!\n");
+  else printf("**FAILED**\n");
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  srand(0x4d4143);
+
+  bool ok = true;
+  for (size_t i = 0; i < sizeof algs / sizeof algs[0]; i++)
+    ok = test_alg(&algs[i]) && ok;
+
+  uint8_t key[32], plain[SIZE], tag[32];
+  fill(key, 32);
+  memset(plain, 'P', SIZE);
+  uint64_t res = 0;
+  cycles a, b;
+  clock_t t1, t2;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_HMAC_compute(Spec_Hash_Definitions_SHA2_256, tag, key, 32, plain, SIZE);
+    res ^= tag[0] ^ tag[31];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff1 = t2 - t1;
+  cycles cdiff1 = b - a;
+
+  EverCrypt_HMAC_key_s *hk = EverCrypt_HMAC_create_key(Spec_Hash_Definitions_SHA2_256, key, 32);
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_HMAC_compute_with_key(hk, tag, plain, SIZE);
+    res ^= tag[0] ^ tag[31];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff2 = t2 - t1;
+  cycles cdiff2 = b - a;
+  EverCrypt_HMAC_free_key(hk);
+
+  uint64_t count = (uint64_t)ROUNDS * SIZE;
+  printf("\n res: %d \n", (int)res);
+  printf("HMAC-SHA2-256 of %d bytes, compute PERF:\n", SIZE); print_time(count, tdiff1, cdiff1);
+  printf("HMAC-SHA2-256 of %d bytes, compute_with_key PERF:\n", SIZE); print_time(count, tdiff2, cdiff2);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -103,6 +103,54 @@ bool testImplementationHacl()
 	return s0 && s1 && flag;
 }
 
+static uint8_t basePoint[64] = {
+0x6b, 0x17, 0xd1, 0xf2, 0xe1, 0x2c, 0x42, 0x47, 0xf8, 0xbc, 0xe6, 0xe5, 0x63, 0xa4, 0x40, 0xf2,
+0x77, 0x03, 0x7d, 0x81, 0x2d, 0xeb, 0x33, 0xa0, 0xf4, 0xa1, 0x39, 0x45, 0xd8, 0x98, 0xc2, 0x96,
+0x4f, 0xe3, 0x42, 0xe2, 0xfe, 0x1a, 0x7f, 0x9b, 0x8e, 0xe7, 0xeb, 0x4a, 0x7c, 0x0f, 0x9e, 0x16,
+0x2b, 0xce, 0x33, 0x57, 0x6b, 0x31, 0x5e, 0xce, 0xcb, 0xb6, 0x40, 0x68, 0x37, 0xbf, 0x51, 0xf5
+};
+
+static uint8_t orderMinusOne[32] = {
+0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xbc, 0xe6, 0xfa, 0xad, 0xa7, 0x17, 0x9e, 0x84, 0xf3, 0xb9, 0xca, 0xc2, 0xfc, 0x63, 0x25, 0x50
+};
+
+// The fixed-base multiplication (ecp256dh_i) must agree with the Montgomery
+// ladder over the base point (ecp256dh_r), including for all-zero and
+// all-one nibbles, scalars above the group order and the point at infinity.
+bool testFixedBase()
+{
+	uint8_t scalar[32];
+	uint8_t r0[64];
+	uint8_t r1[64];
+	bool ok = true;
+	for (int i = 0; i < 40; i++)
+	{
+		switch (i)
+		{
+			case 0: memset(scalar, 0, 32); break;
+			case 1: memset(scalar, 0, 32); scalar[31] = 1; break;
+			case 2: memset(scalar, 0, 32); scalar[31] = 0x10; break;
+			case 3: memset(scalar, 0xff, 32); break;
+			case 4: memset(scalar, 0xf0, 32); break;
+			case 5: memset(scalar, 0x0f, 32); break;
+			case 6: memcpy(scalar, orderMinusOne, 32); break;
+			case 7: memcpy(scalar, orderMinusOne, 32); scalar[31] = 0x51; break;
+			default:
+				for (int j = 0; j < 32; j++)
+					scalar[j] = (uint8_t)(i * 37 + j * 101 + (j * i) / 7);
+		}
+		bool b0 = Hacl_P256_ecp256dh_i(r0, scalar);
+		bool b1 = Hacl_P256_ecp256dh_r(r1, basePoint, scalar);
+		if (b0 != b1 || (b0 && memcmp(r0, r1, 64) != 0))
+		{
+			printf("Fixed-base multiplication mismatch for scalar %d\n", i);
+			ok = false;
+		}
+	}
+	return ok;
+}
+
 void handleErrors()
 {
 	printf("%s\n", "OpenSSl exception");
@@ -115,6 +163,11 @@ int main()
 		printf("%s\n", "Test Implementation failed for Hacl* ECDSA");
 		return -1;
 	}
+	if (!testFixedBase())
+	{
+		printf("%s\n", "Test Implementation failed for Hacl* fixed-base multiplication");
+		return -1;
+	}
 
 
   	cycles a,b;
@@ -141,6 +194,28 @@ int main()
 	cycles cdiff1 = b - a;
 
 
+	uint8_t* pub = (uint8_t*) malloc (sizeof (uint8_t) * 64);
+	uint8_t* sig = (uint8_t*) malloc (sizeof (uint8_t) * 64);
+	bool ok = Hacl_P256_ecp256dh_i(pub, prKey);
+	ok = ok && Hacl_P256_ecdsa_sign_p256_without_hash(sig, 32, digest, prKey, nonce);
+	ok = ok && Hacl_P256_ecdsa_verif_without_hash(32, digest, pub, sig, sig + 32);
+	if (!ok)
+	{
+		printf("%s\n", "Test Implementation failed for Hacl* ECDSA verification");
+		return -1;
+	}
+
+	for (int j = 0; j < ROUNDS; j++)
+		ok = ok && Hacl_P256_ecdsa_verif_without_hash(32, digest, pub, sig, sig + 32);
+	t1 = clock();
+  	a = cpucycles_begin();
+  	for (int j = 0; j < ROUNDS; j++)
+		ok = ok && Hacl_P256_ecdsa_verif_without_hash(32, digest, pub, sig, sig + 32);
+	b = cpucycles_end();
+	t2 = clock();
+	clock_t tdiff2 = t2 - t1;
+	cycles cdiff2 = b - a;
+
 	uint8_t* pk = (uint8_t*) malloc (sizeof (uint8_t) * 64);
 	memcpy(pk, px0_0,  32);
 	memcpy(pk+32, py0_0,  32);
@@ -172,6 +247,8 @@ int main()
 	printf("Hacl ECDSA (without hashing) PERF: %d\n"); 
 	print_time(count,tdiff1,cdiff1);
 
+	printf("Hacl ECDSA verification (without hashing) PERF: %d\n", ok); 
+	print_time(count,tdiff2,cdiff2);
 	printf("Hacl ECDH PERF: %d\n"); 
 	print_time(count,tdiff3,cdiff3);  
 }
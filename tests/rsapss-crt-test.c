@@ -0,0 +1,188 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#define OPENSSL_SUPPRESS_DEPRECATED
+#include <openssl/bn.h>
+#include <openssl/rsa.h>
+
+#include "Hacl_RSAPSS.h"
+
+#include "test_helpers.h"
+
+#define ROUNDS 50
+#define SALTLEN 32
+
+typedef struct {
+  uint32_t modBits, eBits, dBits, pqBits;
+  uint8_t *n, *e, *d, *p, *q, *dp, *dq, *qinv;
+} crt_key;
+
+static uint8_t *bn_bytes(const BIGNUM *b, uint32_t bits) {
+  uint32_t len = (bits - 1) / 8 + 1;
+  uint8_t *r = malloc(len);
+  BN_bn2binpad(b, r, len);
+  return r;
+}
+
+// A fresh OpenSSL key, with the CRT components padded to the size of p
+static crt_key gen_key(uint32_t modBits) {
+  crt_key k;
+  RSA *rsa = RSA_new();
+  BIGNUM *e = BN_new();
+  BN_set_word(e, RSA_F4);
+  RSA_generate_key_ex(rsa, modBits, e, NULL);
+  const BIGNUM *n, *e1, *d, *p, *q, *dp, *dq, *qinv;
+  RSA_get0_key(rsa, &n, &e1, &d);
+  RSA_get0_factors(rsa, &p, &q);
+  RSA_get0_crt_params(rsa, &dp, &dq, &qinv);
+  k.modBits = modBits;
+  k.eBits = BN_num_bits(e1);
+  k.dBits = BN_num_bits(d);
+  k.pqBits = BN_num_bits(p);
+  k.n = bn_bytes(n, k.modBits);
+  k.e = bn_bytes(e1, k.eBits);
+  k.d = bn_bytes(d, k.dBits);
+  k.p = bn_bytes(p, k.pqBits);
+  k.q = bn_bytes(q, k.pqBits);
+  k.dp = bn_bytes(dp, k.pqBits);
+  k.dq = bn_bytes(dq, k.pqBits);
+  k.qinv = bn_bytes(qinv, k.pqBits);
+  BN_free(e);
+  RSA_free(rsa);
+  return k;
+}
+
+static void free_key(crt_key *k) {
+  free(k->n); free(k->e); free(k->d); free(k->p);
+  free(k->q); free(k->dp); free(k->dq); free(k->qinv);
+}
+
+static uint64_t *load_crt(crt_key *k) {
+  return Hacl_RSAPSS_new_rsapss_load_skey_crt(k->modBits, k->eBits, k->pqBits,
+    k->n, k->e, k->p, k->q, k->dp, k->dq, k->qinv);
+}
+
+// CRT signatures must be equal to the signatures with d for the same salt
+static bool test_sign(crt_key *k) {
+  uint32_t nbLen = (k->modBits - 1) / 8 + 1;
+  uint8_t msg[100], salt[SALTLEN], sgnt[nbLen], sgnt2[nbLen], sgnt3[nbLen];
+  for (int i = 0; i < 100; i++) msg[i] = rand();
+  for (int i = 0; i < SALTLEN; i++) salt[i] = rand();
+
+  uint64_t *pkey = Hacl_RSAPSS_new_rsapss_load_pkey(k->modBits, k->eBits, k->n, k->e);
+  uint64_t *skey = Hacl_RSAPSS_new_rsapss_load_skey(k->modBits, k->eBits, k->dBits, k->n, k->e, k->d);
+  uint64_t *ckey = load_crt(k);
+  bool ok = pkey != NULL && skey != NULL && ckey != NULL;
+  if (ok) {
+    bool b0 = Hacl_RSAPSS_rsapss_sign(Spec_Hash_Definitions_SHA2_256, k->modBits, k->eBits,
+      k->dBits, skey, SALTLEN, salt, 100, msg, sgnt);
+    bool b1 = Hacl_RSAPSS_rsapss_crt_sign(Spec_Hash_Definitions_SHA2_256, k->modBits, k->eBits,
+      k->pqBits, ckey, SALTLEN, salt, 100, msg, sgnt2);
+    bool b2 = Hacl_RSAPSS_rsapss_skey_crt_sign(Spec_Hash_Definitions_SHA2_256, k->modBits,
+      k->eBits, k->pqBits, k->n, k->e, k->p, k->q, k->dp, k->dq, k->qinv,
+      SALTLEN, salt, 100, msg, sgnt3);
+    bool ver = Hacl_RSAPSS_rsapss_verify(Spec_Hash_Definitions_SHA2_256, k->modBits, k->eBits,
+      pkey, SALTLEN, nbLen, sgnt2, 100, msg);
+    ok = b0 && b1 && b2 && ver &&
+      memcmp(sgnt, sgnt2, nbLen) == 0 && memcmp(sgnt, sgnt3, nbLen) == 0;
+  }
+  free(pkey); free(skey); free(ckey);
+  printf("RSAPSS-%u CRT sign (against sign with d) Result:\n", k->modBits);
+  if (ok) printf("Success!\n");
+  else printf("**FAILED**\n");
+  return ok;
+}
+
+// A fault in a half-size exponentiation must be caught by the final check,
+// and keys with an inconsistent qinv must be rejected on load
+static bool test_faults(crt_key *k) {
+  uint32_t nbLen = (k->modBits - 1) / 8 + 1;
+  uint32_t pqbLen = (k->pqBits - 1) / 8 + 1;
+  uint8_t msg[32] = { 0 }, zero[nbLen], sgnt[nbLen];
+  memset(zero, 0, nbLen);
+  memset(sgnt, 0xff, nbLen);
+
+  k->dp[pqbLen - 1] ^= 2;
+  uint64_t *ckey = load_crt(k);
+  bool ok = ckey != NULL;
+  if (ok) {
+    bool b = Hacl_RSAPSS_rsapss_crt_sign(Spec_Hash_Definitions_SHA2_256, k->modBits, k->eBits,
+      k->pqBits, ckey, SALTLEN, msg, 32, msg, sgnt);
+    ok = !b && memcmp(sgnt, zero, nbLen) == 0;
+  }
+  free(ckey);
+  k->dp[pqbLen - 1] ^= 2;
+
+  uint8_t *qinv = k->qinv;
+  k->qinv = k->p;
+  ckey = load_crt(k);
+  ok = ok && ckey == NULL;
+  k->qinv = qinv;
+
+  printf("RSAPSS-%u CRT fault check and key validation Result:\n", k->modBits);
+  if (ok) printf("Success!\n");
+  else printf("**FAILED**\n");
+  return ok;
+}
+
+int main() {
+  srand(0x525341);
+  bool ok = true;
+  uint32_t sizes[] = { 1024, 2048, 3072, 4096 };
+  crt_key keys[4];
+  for (int i = 0; i < 4; i++) {
+    keys[i] = gen_key(sizes[i]);
+    for (int j = 0; j < 4; j++)
+      ok = test_sign(&keys[i]) && ok;
+    ok = test_faults(&keys[i]) && ok;
+  }
+
+  uint8_t msg[32] = { 0 }, salt[SALTLEN] = { 0 }, sgnt[512];
+  for (int i = 1; i < 4; i++) {
+    crt_key *k = &keys[i];
+    uint64_t *skey = Hacl_RSAPSS_new_rsapss_load_skey(k->modBits, k->eBits, k->dBits, k->n, k->e, k->d);
+    uint64_t *ckey = load_crt(k);
+    uint64_t res = 0;
+    cycles a, b;
+    clock_t t1, t2;
+
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_RSAPSS_rsapss_sign(Spec_Hash_Definitions_SHA2_256, k->modBits, k->eBits, k->dBits,
+        skey, SALTLEN, salt, 32, msg, sgnt);
+      res ^= sgnt[0];
+    }
+    b = cpucycles_end();
+    t2 = clock();
+    clock_t tdiff1 = t2 - t1;
+    cycles cdiff1 = b - a;
+
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_RSAPSS_rsapss_crt_sign(Spec_Hash_Definitions_SHA2_256, k->modBits, k->eBits, k->pqBits,
+        ckey, SALTLEN, salt, 32, msg, sgnt);
+      res ^= sgnt[0];
+    }
+    b = cpucycles_end();
+    t2 = clock();
+    clock_t tdiff2 = t2 - t1;
+    cycles cdiff2 = b - a;
+
+    printf("\n res: %d \n", (int)res);
+    printf("RSAPSS-%u sign PERF:\n", k->modBits); print_time(ROUNDS, tdiff1, cdiff1);
+    printf("RSAPSS-%u CRT sign PERF:\n", k->modBits); print_time(ROUNDS, tdiff2, cdiff2);
+    free(skey); free(ckey);
+  }
+
+  for (int i = 0; i < 4; i++)
+    free_key(&keys[i]);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,166 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "Hacl_Hash.h"
+#include "Hacl_SHA2_Vec128.h"
+#include "Hacl_SHA2_Vec256.h"
+#include "EverCrypt_Hash.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+#include "sha2_vectors.h"
+
+#define ROUNDS 65536
+#define SIZE   64
+#define MANY   64
+
+
+bool print_result(uint8_t* comp, uint8_t* exp, int len) {
+  return compare_and_print(len, comp, exp);
+}
+
+bool print_test(uint8_t* in, int in_len, uint8_t* exp224, uint8_t* exp256, uint8_t* exp384, uint8_t* exp512){
+  uint8_t comp[8][64] = {0};
+  bool ok = true;
+
+  Hacl_SHA2_Vec128_sha224_4(comp[0],comp[1],comp[2],comp[3],in_len,in,in,in,in);
+  printf("SHA2-224 (4x128-bit) Result:\n");
+  for (int l = 0; l < 4; l++) ok = print_result(comp[l],exp224,28) && ok;
+
+  Hacl_SHA2_Vec128_sha256_4(comp[0],comp[1],comp[2],comp[3],in_len,in,in,in,in);
+  printf("SHA2-256 (4x128-bit) Result:\n");
+  for (int l = 0; l < 4; l++) ok = print_result(comp[l],exp256,32) && ok;
+
+  if (EverCrypt_AutoConfig2_has_avx2()) {
+    Hacl_SHA2_Vec256_sha224_8(comp[0],comp[1],comp[2],comp[3],comp[4],comp[5],comp[6],comp[7],
+      in_len,in,in,in,in,in,in,in,in);
+    printf("SHA2-224 (8x256-bit) Result:\n");
+    for (int l = 0; l < 8; l++) ok = print_result(comp[l],exp224,28) && ok;
+
+    Hacl_SHA2_Vec256_sha256_8(comp[0],comp[1],comp[2],comp[3],comp[4],comp[5],comp[6],comp[7],
+      in_len,in,in,in,in,in,in,in,in);
+    printf("SHA2-256 (8x256-bit) Result:\n");
+    for (int l = 0; l < 8; l++) ok = print_result(comp[l],exp256,32) && ok;
+
+    Hacl_SHA2_Vec256_sha384_4(comp[0],comp[1],comp[2],comp[3],in_len,in,in,in,in);
+    printf("SHA2-384 (4x256-bit) Result:\n");
+    for (int l = 0; l < 4; l++) ok = print_result(comp[l],exp384,48) && ok;
+
+    Hacl_SHA2_Vec256_sha512_4(comp[0],comp[1],comp[2],comp[3],in_len,in,in,in,in);
+    printf("SHA2-512 (4x256-bit) Result:\n");
+    for (int l = 0; l < 4; l++) ok = print_result(comp[l],exp512,64) && ok;
+  }
+  return ok;
+}
+
+// Every lane gets different contents; the results are checked against the
+// one-message implementation, for all lengths around the padding boundaries.
+bool test_lanes(Spec_Hash_Definitions_hash_alg a, uint32_t hash_len) {
+  uint8_t input[MANY * 300];
+  uint8_t comp[MANY * 64];
+  uint8_t exp[64];
+  bool ok = true;
+  for (uint32_t len = 0; len < 300; len++) {
+    for (uint32_t i = 0; i < MANY * len; i++)
+      input[i] = (uint8_t)(i * 31 + len);
+    // An odd count exercises the scalar tail after the vectorized groups.
+    uint32_t n = MANY - 3;
+    EverCrypt_Hash_hash_many(a, n, comp, input, len);
+    for (uint32_t l = 0; l < n; l++) {
+      EverCrypt_Hash_hash(a, exp, input + l * len, len);
+      for (uint32_t j = 0; j < hash_len; j++)
+        ok = ok && (comp[l * hash_len + j] == exp[j]);
+    }
+  }
+  return ok;
+}
+
+int main(){
+  EverCrypt_AutoConfig2_init();
+  bool ok = true;
+  for (int i = 0; i < sizeof(vectors)/sizeof(sha2_test_vector); ++i) {
+    ok &= print_test(vectors[i].input,vectors[i].input_len,vectors[i].tag_224,vectors[i].tag_256,vectors[i].tag_384,vectors[i].tag_512);
+  }
+
+  printf("EverCrypt_Hash_hash_many (all lanes distinct) Result:\n");
+  bool ok_many = test_lanes(Spec_Hash_Definitions_SHA2_224, 28);
+  ok_many = test_lanes(Spec_Hash_Definitions_SHA2_256, 32) && ok_many;
+  ok_many = test_lanes(Spec_Hash_Definitions_SHA2_384, 48) && ok_many;
+  ok_many = test_lanes(Spec_Hash_Definitions_SHA2_512, 64) && ok_many;
+  ok_many = test_lanes(Spec_Hash_Definitions_Blake2S, 32) && ok_many;
+  if (ok_many) printf("Success!\n");
+  else printf("**FAILED**\n");
+  ok = ok && ok_many;
+
+  uint8_t plain[8][SIZE];
+  uint8_t hash[8][32];
+  cycles a,b;
+  clock_t t1,t2;
+  for (int l = 0; l < 8; l++) memset(plain[l],'P' + l,SIZE);
+
+  for (int j = 0; j < ROUNDS; j++) {
+    for (int l = 0; l < 8; l++) Hacl_Hash_SHA2_hash_256(plain[l],SIZE,hash[l]);
+  }
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    for (int l = 0; l < 8; l++) Hacl_Hash_SHA2_hash_256(plain[l],SIZE,hash[l]);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_SHA2_Vec128_sha256_4(hash[0],hash[1],hash[2],hash[3],SIZE,plain[0],plain[1],plain[2],plain[3]);
+    Hacl_SHA2_Vec128_sha256_4(hash[4],hash[5],hash[6],hash[7],SIZE,plain[4],plain[5],plain[6],plain[7]);
+  }
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_SHA2_Vec128_sha256_4(hash[0],hash[1],hash[2],hash[3],SIZE,plain[0],plain[1],plain[2],plain[3]);
+    Hacl_SHA2_Vec128_sha256_4(hash[4],hash[5],hash[6],hash[7],SIZE,plain[4],plain[5],plain[6],plain[7]);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+
+  double cdiff3 = 0;
+  double tdiff3 = 0;
+  if (EverCrypt_AutoConfig2_has_avx2()) {
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_SHA2_Vec256_sha256_8(hash[0],hash[1],hash[2],hash[3],hash[4],hash[5],hash[6],hash[7],
+        SIZE,plain[0],plain[1],plain[2],plain[3],plain[4],plain[5],plain[6],plain[7]);
+    }
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_SHA2_Vec256_sha256_8(hash[0],hash[1],hash[2],hash[3],hash[4],hash[5],hash[6],hash[7],
+        SIZE,plain[0],plain[1],plain[2],plain[3],plain[4],plain[5],plain[6],plain[7]);
+    }
+    b = cpucycles_end();
+    t2 = clock();
+    cdiff3 = b - a;
+    tdiff3 = t2 - t1;
+  }
+
+  uint8_t res = hash[7][0];
+  uint64_t count = ROUNDS * 8 * SIZE;
+  printf("SHA2-256 (32-bit, 8 x 64-byte messages) PERF: %d\n",(int)res); print_time(count,tdiff1,cdiff1);
+  printf("SHA2-256 (2 x 4x128-bit, 8 x 64-byte messages) PERF: %d\n",(int)res); print_time(count,tdiff2,cdiff2);
+  if (EverCrypt_AutoConfig2_has_avx2()) {
+    printf("SHA2-256 (8x256-bit, 8 x 64-byte messages) PERF: %d\n",(int)res); print_time(count,tdiff3,cdiff3);
+  }
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,255 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "Hacl_SHA3.h"
+#include "Hacl_Streaming_SHA3.h"
+#include "EverCrypt_Hash.h"
+
+#include "test_helpers.h"
+
+#define MANY   500
+#define MAXLEN 1000
+#define ROUNDS 4096
+#define SIZE   16384
+
+typedef Hacl_Streaming_SHA3_state_sha3_224 sha3_state;
+
+typedef struct {
+  const char *name;
+  uint32_t hash_len;
+  sha3_state *(*create_in)();
+  void (*init)(sha3_state *);
+  void (*update)(sha3_state *, uint8_t *, uint32_t);
+  void (*finish)(sha3_state *, uint8_t *);
+  void (*free)(sha3_state *);
+  void (*hash)(uint32_t, uint8_t *, uint8_t *);
+  Spec_Hash_Definitions_hash_alg alg;
+} sha3_impl;
+
+static sha3_impl impls[] = {
+  { "SHA3-224", 28, Hacl_Streaming_SHA3_create_in_224, Hacl_Streaming_SHA3_init_224,
+    Hacl_Streaming_SHA3_update_224, Hacl_Streaming_SHA3_finish_224, Hacl_Streaming_SHA3_free_224,
+    Hacl_SHA3_sha3_224, Spec_Hash_Definitions_SHA3_224 },
+  { "SHA3-256", 32, Hacl_Streaming_SHA3_create_in_256, Hacl_Streaming_SHA3_init_256,
+    Hacl_Streaming_SHA3_update_256, Hacl_Streaming_SHA3_finish_256, Hacl_Streaming_SHA3_free_256,
+    Hacl_SHA3_sha3_256, Spec_Hash_Definitions_SHA3_256 },
+  { "SHA3-384", 48, Hacl_Streaming_SHA3_create_in_384, Hacl_Streaming_SHA3_init_384,
+    Hacl_Streaming_SHA3_update_384, Hacl_Streaming_SHA3_finish_384, Hacl_Streaming_SHA3_free_384,
+    Hacl_SHA3_sha3_384, Spec_Hash_Definitions_SHA3_384 },
+  { "SHA3-512", 64, Hacl_Streaming_SHA3_create_in_512, Hacl_Streaming_SHA3_init_512,
+    Hacl_Streaming_SHA3_update_512, Hacl_Streaming_SHA3_finish_512, Hacl_Streaming_SHA3_free_512,
+    Hacl_SHA3_sha3_512, Spec_Hash_Definitions_SHA3_512 },
+};
+
+typedef struct {
+  const char *name;
+  sha3_state *(*create_in)();
+  void (*init)(sha3_state *);
+  void (*update)(sha3_state *, uint8_t *, uint32_t);
+  void (*finish)(sha3_state *, uint8_t *, uint32_t);
+  Hacl_Streaming_SHA3_xof_state *(*create_xof)(sha3_state *);
+  void (*squeeze)(Hacl_Streaming_SHA3_xof_state *, uint8_t *, uint32_t);
+  void (*free)(sha3_state *);
+  void (*hash)(uint32_t, uint8_t *, uint32_t, uint8_t *);
+} shake_impl;
+
+static shake_impl shakes[] = {
+  { "SHAKE128", Hacl_Streaming_SHA3_create_in_shake128, Hacl_Streaming_SHA3_init_shake128,
+    Hacl_Streaming_SHA3_update_shake128, Hacl_Streaming_SHA3_finish_shake128,
+    Hacl_Streaming_SHA3_create_xof_shake128, Hacl_Streaming_SHA3_squeeze_shake128,
+    Hacl_Streaming_SHA3_free_shake128, Hacl_SHA3_shake128_hacl },
+  { "SHAKE256", Hacl_Streaming_SHA3_create_in_shake256, Hacl_Streaming_SHA3_init_shake256,
+    Hacl_Streaming_SHA3_update_shake256, Hacl_Streaming_SHA3_finish_shake256,
+    Hacl_Streaming_SHA3_create_xof_shake256, Hacl_Streaming_SHA3_squeeze_shake256,
+    Hacl_Streaming_SHA3_free_shake256, Hacl_SHA3_shake256_hacl },
+};
+
+// Feeds msg to update in random chunks, including empty ones and chunks that
+// end exactly on a block boundary.
+static void
+feed(void (*update)(sha3_state *, uint8_t *, uint32_t), sha3_state *s, uint8_t *msg, uint32_t len)
+{
+  uint32_t off = 0;
+  while (off < len) {
+    uint32_t c = rand() % 4 == 0 ? 0 : rand() % (len - off + 1);
+    if (rand() % 4 == 0 && len - off >= 136) c = 136;
+    update(s, msg + off, c);
+    off += c;
+  }
+}
+
+// SHA3-256("abc"), FIPS 202 examples.
+static uint8_t abc_sha3_256[32] = {
+  0x3a, 0x98, 0x5d, 0xa7, 0x4f, 0xe2, 0x25, 0xb2, 0x04, 0x5c, 0x17, 0x2d, 0x6b, 0xd3, 0x90, 0xbd,
+  0x85, 0x5f, 0x08, 0x6e, 0x3e, 0x9d, 0x52, 0x5b, 0x46, 0xbf, 0xe2, 0x45, 0x11, 0x43, 0x15, 0x32
+};
+
+bool test_known_answer() {
+  uint8_t tag[32];
+  bool ok = true;
+  sha3_state *s = Hacl_Streaming_SHA3_create_in_256();
+  Hacl_Streaming_SHA3_update_256(s, (uint8_t *)"a", 1);
+  Hacl_Streaming_SHA3_update_256(s, NULL, 0);
+  Hacl_Streaming_SHA3_update_256(s, (uint8_t *)"bc", 2);
+  Hacl_Streaming_SHA3_finish_256(s, tag);
+  printf("SHA3-256 (streaming) Result:\n");
+  ok = compare_and_print(32, tag, abc_sha3_256) && ok;
+  Hacl_Streaming_SHA3_free_256(s);
+
+  EverCrypt_Hash_hash(Spec_Hash_Definitions_SHA3_256, tag, (uint8_t *)"abc", 3);
+  printf("SHA3-256 (EverCrypt_Hash) Result:\n");
+  ok = compare_and_print(32, tag, abc_sha3_256) && ok;
+  return ok;
+}
+
+// Streaming SHA-3 and EverCrypt_Hash_Incremental agree with the one-shot
+// functions, however the input is split.
+bool test_sha3() {
+  uint8_t msg[MAXLEN];
+  uint8_t h0[64], h1[64], h2[64], h3[64];
+  bool ok = true;
+
+  for (int k = 0; k < sizeof(impls)/sizeof(sha3_impl); k++) {
+    sha3_impl *impl = &impls[k];
+    sha3_state *s = impl->create_in();
+    Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *e =
+      EverCrypt_Hash_Incremental_create_in(impl->alg);
+    bool ok1 = true;
+    for (int j = 0; j < MANY; j++) {
+      uint32_t len = j < 300 ? j : rand() % MAXLEN;
+      for (int i = 0; i < len; i++) msg[i] = (uint8_t)rand();
+
+      impl->hash(len, msg, h0);
+
+      impl->init(s);
+      feed(impl->update, s, msg, len);
+      impl->finish(s, h1);
+      // finish does not consume the state
+      impl->finish(s, h2);
+
+      EverCrypt_Hash_Incremental_init(e);
+      uint32_t off = 0;
+      while (off < len) {
+        uint32_t c = rand() % (len - off + 1);
+        EverCrypt_Hash_Incremental_update(e, msg + off, c);
+        off += c;
+      }
+      EverCrypt_Hash_Incremental_finish(e, h3);
+
+      ok1 = ok1 && memcmp(h0, h1, impl->hash_len) == 0 && memcmp(h0, h2, impl->hash_len) == 0;
+      ok1 = ok1 && memcmp(h0, h3, impl->hash_len) == 0;
+      EverCrypt_Hash_hash(impl->alg, h3, msg, len);
+      ok1 = ok1 && memcmp(h0, h3, impl->hash_len) == 0;
+    }
+    impl->free(s);
+    EverCrypt_Hash_Incremental_free(e);
+    printf("%s (streaming, EverCrypt_Hash_Incremental against one-shot) Result:\n", impl->name);
+    if (ok1) printf("Success!\n");
+    else printf("**FAILED**\n");
+    ok = ok && ok1;
+  }
+  return ok;
+}
+
+// SHAKE output, whether produced at once by finish or squeezed in pieces
+// through the XOF reader, agrees with the one-shot functions.
+bool test_shake() {
+  uint8_t msg[MAXLEN];
+  uint8_t o0[MAXLEN], o1[MAXLEN], o2[MAXLEN];
+  bool ok = true;
+
+  for (int k = 0; k < sizeof(shakes)/sizeof(shake_impl); k++) {
+    shake_impl *impl = &shakes[k];
+    sha3_state *s = impl->create_in();
+    bool ok1 = true;
+    for (int j = 0; j < MANY; j++) {
+      uint32_t len = rand() % MAXLEN;
+      uint32_t out_len = j < 350 ? j : rand() % MAXLEN;
+      for (int i = 0; i < len; i++) msg[i] = (uint8_t)rand();
+
+      impl->hash(len, msg, out_len, o0);
+
+      impl->init(s);
+      feed(impl->update, s, msg, len);
+      impl->finish(s, o1, out_len);
+
+      Hacl_Streaming_SHA3_xof_state *x = impl->create_xof(s);
+      uint32_t off = 0;
+      while (off < out_len) {
+        uint32_t c = rand() % 3 == 0 ? 0 : rand() % (out_len - off + 1);
+        impl->squeeze(x, o2 + off, c);
+        off += c;
+      }
+      Hacl_Streaming_SHA3_free_xof(x);
+
+      ok1 = ok1 && memcmp(o0, o1, out_len) == 0 && memcmp(o0, o2, out_len) == 0;
+    }
+    impl->free(s);
+    printf("%s (streaming, XOF reader against one-shot) Result:\n", impl->name);
+    if (ok1) printf("Success!\n");
+    else printf("**FAILED**\n");
+    ok = ok && ok1;
+  }
+  return ok;
+}
+
+int main() {
+  srand(0x5a3);
+  bool ok = test_known_answer();
+  ok = test_sha3() && ok;
+  ok = test_shake() && ok;
+
+  uint8_t *plain = malloc(SIZE);
+  uint8_t out[64];
+  memset(plain, 'P', SIZE);
+  uint64_t res = 0;
+  cycles a, b;
+  clock_t t1, t2;
+
+  sha3_state *s = Hacl_Streaming_SHA3_create_in_256();
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Streaming_SHA3_update_256(s, plain, SIZE);
+  }
+  Hacl_Streaming_SHA3_finish_256(s, out);
+  res ^= out[0] ^ out[31];
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff1 = t2 - t1;
+  cycles cdiff1 = b - a;
+  Hacl_Streaming_SHA3_free_256(s);
+
+  sha3_state *s128 = Hacl_Streaming_SHA3_create_in_shake128();
+  Hacl_Streaming_SHA3_update_shake128(s128, plain, 32);
+  Hacl_Streaming_SHA3_xof_state *x = Hacl_Streaming_SHA3_create_xof_shake128(s128);
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Streaming_SHA3_squeeze_shake128(x, plain, SIZE);
+    res ^= plain[0] ^ plain[SIZE - 1];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff2 = t2 - t1;
+  cycles cdiff2 = b - a;
+  Hacl_Streaming_SHA3_free_xof(x);
+  Hacl_Streaming_SHA3_free_shake128(s128);
+
+  uint64_t count = ROUNDS * SIZE;
+  printf("\n res: %d \n", (int)res);
+  printf("SHA3-256 Streaming PERF:\n"); print_time(count, tdiff1, cdiff1);
+  printf("SHAKE128 Squeeze PERF:\n"); print_time(count, tdiff2, cdiff2);
+  free(plain);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,163 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "Hacl_SHA3.h"
+#include "Hacl_SHA3_Vec256.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+
+#define MANY   300
+#define MAXLEN 1000
+#define ROUNDS 4096
+#define SIZE   4096
+
+// The scalar cSHAKE of FrodoKEM (Spec.SHA3.cshake128_frodo and
+// cshake256_frodo), from the exported Keccak building blocks.
+static void
+cshake_frodo(uint32_t rate, uint64_t s0, uint32_t len, uint8_t *in, uint16_t cstm,
+  uint32_t out_len, uint8_t *out)
+{
+  uint64_t s[25] = { 0 };
+  s[0] = s0 | (uint64_t)cstm << 48;
+  Hacl_Impl_SHA3_state_permute(s);
+  Hacl_Impl_SHA3_absorb(s, rate, len, in, 0x04);
+  Hacl_Impl_SHA3_squeeze(s, rate, out_len, out);
+}
+
+// Each lane of the 4-way SHAKE agrees with the scalar SHAKE on lengths that
+// cover empty inputs, partial blocks and exact multiples of the rate.
+bool test_shake() {
+  uint8_t in[4][MAXLEN];
+  uint8_t out[4][MAXLEN], expected[MAXLEN];
+  bool ok = true;
+
+  for (int k = 0; k < 2; k++) {
+    bool ok1 = true;
+    uint32_t rate = k == 0 ? 168 : 136;
+    for (int j = 0; j < MANY; j++) {
+      uint32_t len = j < 3 ? j * rate : (j < 200 ? j : rand() % MAXLEN);
+      uint32_t out_len = j < 3 ? (j + 1) * rate : rand() % MAXLEN;
+      for (int l = 0; l < 4; l++)
+        for (int i = 0; i < len; i++) in[l][i] = (uint8_t)rand();
+
+      if (k == 0)
+        Hacl_SHA3_Vec256_shake128_vec256(len, in[0], in[1], in[2], in[3],
+          out_len, out[0], out[1], out[2], out[3]);
+      else
+        Hacl_SHA3_Vec256_shake256_vec256(len, in[0], in[1], in[2], in[3],
+          out_len, out[0], out[1], out[2], out[3]);
+
+      for (int l = 0; l < 4; l++) {
+        if (k == 0) Hacl_SHA3_shake128_hacl(len, in[l], out_len, expected);
+        else Hacl_SHA3_shake256_hacl(len, in[l], out_len, expected);
+        ok1 = ok1 && memcmp(out[l], expected, out_len) == 0;
+      }
+    }
+    printf("%s (4-way against scalar) Result:\n", k == 0 ? "SHAKE128" : "SHAKE256");
+    if (ok1) printf("Success!\n");
+    else printf("**FAILED**\n");
+    ok = ok && ok1;
+  }
+  return ok;
+}
+
+// The FrodoKEM cSHAKE instances, four customizations at a time, as used for
+// the rows of the matrix A.
+bool test_cshake_frodo() {
+  uint8_t seed[MAXLEN];
+  uint8_t out[4][MAXLEN], expected[MAXLEN];
+  bool ok = true;
+
+  for (int k = 0; k < 2; k++) {
+    bool ok1 = true;
+    uint32_t rate = k == 0 ? 168 : 136;
+    uint64_t s0 = k == 0 ? 0x10010001a801ULL : 0x100100018801ULL;
+    for (int j = 0; j < MANY; j++) {
+      uint32_t len = j < 100 ? 16 : rand() % MAXLEN;
+      uint32_t out_len = j < 100 ? 2 * 64 : rand() % MAXLEN;
+      uint16_t cstm[4];
+      for (int i = 0; i < len; i++) seed[i] = (uint8_t)rand();
+      for (int l = 0; l < 4; l++) cstm[l] = (uint16_t)(256 + 4 * j + l);
+
+      if (k == 0)
+        Hacl_SHA3_Vec256_cshake128_frodo_vec256(len, seed, cstm[0], cstm[1], cstm[2], cstm[3],
+          out_len, out[0], out[1], out[2], out[3]);
+      else
+        Hacl_SHA3_Vec256_cshake256_frodo_vec256(len, seed, cstm[0], cstm[1], cstm[2], cstm[3],
+          out_len, out[0], out[1], out[2], out[3]);
+
+      for (int l = 0; l < 4; l++) {
+        cshake_frodo(rate, s0, len, seed, cstm[l], out_len, expected);
+        ok1 = ok1 && memcmp(out[l], expected, out_len) == 0;
+      }
+    }
+    printf("%s Frodo (4-way against scalar) Result:\n", k == 0 ? "cSHAKE128" : "cSHAKE256");
+    if (ok1) printf("Success!\n");
+    else printf("**FAILED**\n");
+    ok = ok && ok1;
+  }
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  srand(0x5a34);
+
+  if (!EverCrypt_AutoConfig2_has_avx2()) {
+    printf("AVX2 not available, skipping\n");
+    return EXIT_SUCCESS;
+  }
+
+  bool ok = test_shake();
+  ok = test_cshake_frodo() && ok;
+
+  uint8_t *in = malloc(4 * SIZE);
+  uint8_t *out = malloc(4 * SIZE);
+  memset(in, 'P', 4 * SIZE);
+  uint64_t res = 0;
+  cycles a, b;
+  clock_t t1, t2;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    for (int l = 0; l < 4; l++)
+      Hacl_SHA3_shake128_hacl(SIZE, in + l * SIZE, SIZE, out + l * SIZE);
+    res ^= out[0] ^ out[4 * SIZE - 1];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff1 = t2 - t1;
+  cycles cdiff1 = b - a;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_SHA3_Vec256_shake128_vec256(SIZE, in, in + SIZE, in + 2 * SIZE, in + 3 * SIZE,
+      SIZE, out, out + SIZE, out + 2 * SIZE, out + 3 * SIZE);
+    res ^= out[0] ^ out[4 * SIZE - 1];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff2 = t2 - t1;
+  cycles cdiff2 = b - a;
+
+  uint64_t count = ROUNDS * 8 * SIZE;
+  printf("\n res: %d \n", (int)res);
+  printf("SHAKE128 (scalar, 4 inputs) PERF:\n"); print_time(count, tdiff1, cdiff1);
+  printf("SHAKE128 (4-way vec256) PERF:\n"); print_time(count, tdiff2, cdiff2);
+  free(in);
+  free(out);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,230 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "Hacl_Chacha20.h"
+#include "Hacl_Chacha20Poly1305_32.h"
+#include "Hacl_Chacha20Poly1305_128.h"
+#include "Hacl_Chacha20Poly1305_256.h"
+#include "Hacl_Chacha20Poly1305_512.h"
+#include "EverCrypt_Chacha20Poly1305.h"
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+
+#define MANY   200
+#define MAXLEN 1100
+#define ROUNDS 100000
+#define SIZE   16384
+
+typedef void (*xaead_encrypt_t)(uint8_t *, uint8_t *, uint32_t, uint8_t *, uint32_t, uint8_t *,
+  uint8_t *, uint8_t *);
+typedef uint32_t (*xaead_decrypt_t)(uint8_t *, uint8_t *, uint32_t, uint8_t *, uint32_t, uint8_t *,
+  uint8_t *, uint8_t *);
+
+// draft-irtf-cfrg-xchacha-03, section 2.2.1
+static uint8_t hkey[32] = {
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+  0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
+};
+static uint8_t hnonce[16] = {
+  0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x31, 0x41, 0x59, 0x27
+};
+static uint8_t hsubkey[32] = {
+  0x82, 0x41, 0x3b, 0x42, 0x27, 0xb2, 0x7b, 0xfe, 0xd3, 0x0e, 0x42, 0x50, 0x8a, 0x87, 0x7d, 0x73,
+  0xa0, 0xf9, 0xe4, 0xd5, 0x8a, 0x74, 0xa8, 0x53, 0xc1, 0x2e, 0xc4, 0x13, 0x26, 0xd3, 0xec, 0xdc
+};
+
+// draft-irtf-cfrg-xchacha-03, appendix A.3.1
+static uint8_t xplain[114] =
+  "Ladies and Gentlemen of the class of '99: If I could offer you only one tip for the future, "
+  "sunscreen would be it.";
+static uint8_t xaad[12] = {
+  0x50, 0x51, 0x52, 0x53, 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7
+};
+static uint8_t xkey[32] = {
+  0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+  0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f
+};
+static uint8_t xnonce[24] = {
+  0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b,
+  0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57
+};
+static uint8_t xcipher[114] = {
+  0xbd, 0x6d, 0x17, 0x9d, 0x3e, 0x83, 0xd4, 0x3b, 0x95, 0x76, 0x57, 0x94, 0x93, 0xc0, 0xe9, 0x39,
+  0x57, 0x2a, 0x17, 0x00, 0x25, 0x2b, 0xfa, 0xcc, 0xbe, 0xd2, 0x90, 0x2c, 0x21, 0x39, 0x6c, 0xbb,
+  0x73, 0x1c, 0x7f, 0x1b, 0x0b, 0x4a, 0xa6, 0x44, 0x0b, 0xf3, 0xa8, 0x2f, 0x4e, 0xda, 0x7e, 0x39,
+  0xae, 0x64, 0xc6, 0x70, 0x8c, 0x54, 0xc2, 0x16, 0xcb, 0x96, 0xb7, 0x2e, 0x12, 0x13, 0xb4, 0x52,
+  0x2f, 0x8c, 0x9b, 0xa4, 0x0d, 0xb5, 0xd9, 0x45, 0xb1, 0x1b, 0x69, 0xb9, 0x82, 0xc1, 0xbb, 0x9e,
+  0x3f, 0x3f, 0xac, 0x2b, 0xc3, 0x69, 0x48, 0x8f, 0x76, 0xb2, 0x38, 0x35, 0x65, 0xd3, 0xff, 0xf9,
+  0x21, 0xf9, 0x66, 0x4c, 0x97, 0x63, 0x7d, 0xa9, 0x76, 0x88, 0x12, 0xf6, 0x15, 0xc6, 0x8b, 0x13,
+  0xb5, 0x2e
+};
+static uint8_t xtag[16] = {
+  0xc0, 0x87, 0x59, 0x24, 0xc1, 0xc7, 0x98, 0x79, 0x47, 0xde, 0xaf, 0xd8, 0x78, 0x0a, 0xcf, 0x49
+};
+
+bool test_vector(const char *name, xaead_encrypt_t enc, xaead_decrypt_t dec) {
+  uint8_t cipher[114], plain[114], tag[16];
+  bool ok = true;
+
+  enc(xkey, xnonce, 12, xaad, 114, xplain, cipher, tag);
+  printf("XChacha20Poly1305 (%s) Result:\n", name);
+  ok = compare_and_print(114, cipher, xcipher) && ok;
+  ok = compare_and_print(16, tag, xtag) && ok;
+  ok = dec(xkey, xnonce, 12, xaad, 114, plain, cipher, tag) == 0
+    && compare_and_print(114, plain, xplain) && ok;
+  tag[0] ^= 1;
+  ok = dec(xkey, xnonce, 12, xaad, 114, plain, cipher, tag) == 1 && ok;
+  return ok;
+}
+
+// EverCrypt_AEAD, through a state and through the expand functions; only
+// 24-byte nonces are accepted, and a failed decryption zeroes the output.
+bool test_aead() {
+  uint8_t key[32], nonce[24], ad[64];
+  uint8_t plain[MAXLEN], cipher[MAXLEN], buf[MAXLEN];
+  uint8_t tag[16], tag1[16];
+  EverCrypt_AEAD_state_s *s = NULL;
+  bool ok = true;
+
+  ok = EverCrypt_AEAD_create_in(Spec_Agile_AEAD_XCHACHA20_POLY1305, &s, xkey) == EverCrypt_Error_Success;
+  if (!ok) return false;
+  ok = ok && EverCrypt_AEAD_alg_of_state(s) == Spec_Agile_AEAD_XCHACHA20_POLY1305;
+  ok = ok && EverCrypt_AEAD_encrypt(s, xnonce, 24, xaad, 12, xplain, 114, cipher, tag)
+    == EverCrypt_Error_Success;
+  ok = ok && memcmp(cipher, xcipher, 114) == 0 && memcmp(tag, xtag, 16) == 0;
+  ok = ok && EverCrypt_AEAD_encrypt(s, xnonce, 12, xaad, 12, xplain, 114, cipher, tag)
+    == EverCrypt_Error_InvalidIVLength;
+  ok = ok && EverCrypt_AEAD_decrypt(s, xnonce, 12, xaad, 12, xcipher, 114, xtag, buf)
+    == EverCrypt_Error_InvalidIVLength;
+  EverCrypt_AEAD_free(s);
+
+  for (int i = 0; i < 32; i++) key[i] = (uint8_t)rand();
+  EverCrypt_AEAD_create_in(Spec_Agile_AEAD_XCHACHA20_POLY1305, &s, key);
+  for (int j = 0; j < MANY; j++) {
+    uint32_t ad_len = rand() % 64;
+    uint32_t len = rand() % MAXLEN;
+    for (int i = 0; i < 24; i++) nonce[i] = (uint8_t)rand();
+    for (int i = 0; i < 64; i++) ad[i] = (uint8_t)rand();
+    for (int i = 0; i < len; i++) plain[i] = (uint8_t)rand();
+
+    // Every implementation agrees with the portable one
+    Hacl_Chacha20Poly1305_32_xaead_encrypt(key, nonce, ad_len, ad, len, plain, cipher, tag);
+    if (EverCrypt_AutoConfig2_has_avx()) {
+      Hacl_Chacha20Poly1305_128_xaead_encrypt(key, nonce, ad_len, ad, len, plain, buf, tag1);
+      ok = ok && memcmp(buf, cipher, len) == 0 && memcmp(tag1, tag, 16) == 0;
+    }
+    if (EverCrypt_AutoConfig2_has_avx2()) {
+      Hacl_Chacha20Poly1305_256_xaead_encrypt(key, nonce, ad_len, ad, len, plain, buf, tag1);
+      ok = ok && memcmp(buf, cipher, len) == 0 && memcmp(tag1, tag, 16) == 0;
+    }
+    if (EverCrypt_AutoConfig2_has_avx512()) {
+      Hacl_Chacha20Poly1305_512_xaead_encrypt(key, nonce, ad_len, ad, len, plain, buf, tag1);
+      ok = ok && memcmp(buf, cipher, len) == 0 && memcmp(tag1, tag, 16) == 0;
+    }
+
+    memcpy(buf, plain, len);
+    ok = ok && EverCrypt_AEAD_encrypt(s, nonce, 24, ad, ad_len, buf, len, buf, tag1)
+      == EverCrypt_Error_Success;
+    ok = ok && memcmp(buf, cipher, len) == 0 && memcmp(tag1, tag, 16) == 0;
+    ok = ok && EverCrypt_AEAD_decrypt(s, nonce, 24, ad, ad_len, buf, len, tag, buf)
+      == EverCrypt_Error_Success;
+    ok = ok && memcmp(buf, plain, len) == 0;
+
+    ok = ok && EverCrypt_AEAD_encrypt_expand(Spec_Agile_AEAD_XCHACHA20_POLY1305, key, nonce, 24,
+      ad, ad_len, plain, len, buf, tag1) == EverCrypt_Error_Success;
+    ok = ok && memcmp(buf, cipher, len) == 0 && memcmp(tag1, tag, 16) == 0;
+    ok = ok && EverCrypt_AEAD_decrypt_expand(Spec_Agile_AEAD_XCHACHA20_POLY1305, key, nonce, 24,
+      ad, ad_len, cipher, len, tag, buf) == EverCrypt_Error_Success;
+    ok = ok && memcmp(buf, plain, len) == 0;
+
+    tag[j % 16] ^= 1;
+    memset(buf, 0xff, len);
+    ok = ok && EverCrypt_AEAD_decrypt(s, nonce, 24, ad, ad_len, cipher, len, tag, buf)
+      == EverCrypt_Error_AuthenticationFailure;
+    for (int i = 0; i < len; i++) ok = ok && buf[i] == 0;
+  }
+  EverCrypt_AEAD_free(s);
+
+  printf("XChacha20Poly1305 (EverCrypt_AEAD) Result:\n");
+  if (ok) printf("Success!\n");
+  else printf("**FAILED**\n");
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  srand(0x24);
+
+  uint8_t subkey[32];
+  Hacl_Chacha20_hchacha20(subkey, hkey, hnonce);
+  printf("HChacha20 Result:\n");
+  bool ok = compare_and_print(32, subkey, hsubkey);
+
+  ok = test_vector("32-bit", Hacl_Chacha20Poly1305_32_xaead_encrypt,
+    Hacl_Chacha20Poly1305_32_xaead_decrypt) && ok;
+  if (EverCrypt_AutoConfig2_has_avx())
+    ok = test_vector("128-bit", Hacl_Chacha20Poly1305_128_xaead_encrypt,
+      Hacl_Chacha20Poly1305_128_xaead_decrypt) && ok;
+  if (EverCrypt_AutoConfig2_has_avx2())
+    ok = test_vector("256-bit", Hacl_Chacha20Poly1305_256_xaead_encrypt,
+      Hacl_Chacha20Poly1305_256_xaead_decrypt) && ok;
+  if (EverCrypt_AutoConfig2_has_avx512())
+    ok = test_vector("512-bit", Hacl_Chacha20Poly1305_512_xaead_encrypt,
+      Hacl_Chacha20Poly1305_512_xaead_decrypt) && ok;
+  ok = test_vector("EverCrypt", EverCrypt_Chacha20Poly1305_xaead_encrypt,
+    EverCrypt_Chacha20Poly1305_xaead_decrypt) && ok;
+  ok = test_aead() && ok;
+
+  uint8_t *plain = malloc(SIZE);
+  uint8_t *cipher = malloc(SIZE);
+  uint8_t key[32], nonce[24], aad[16], tag[16];
+  memset(plain, 'P', SIZE);
+  memset(key, 'K', 32);
+  memset(nonce, 'N', 24);
+  memset(aad, 'A', 16);
+  uint64_t res = 0;
+  cycles a, b;
+  clock_t t1, t2;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_Chacha20Poly1305_xaead_encrypt(key, nonce, 16, aad, SIZE, plain, cipher, tag);
+    res ^= tag[0] ^ tag[15];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff1 = t2 - t1;
+  cycles cdiff1 = b - a;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_Chacha20Poly1305_aead_encrypt(key, nonce, 16, aad, SIZE, plain, cipher, tag);
+    res ^= tag[0] ^ tag[15];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff2 = t2 - t1;
+  cycles cdiff2 = b - a;
+
+  uint64_t count = ROUNDS * SIZE;
+  printf("\n res: %d \n", (int)res);
+  printf("XChacha20Poly1305 Encrypt (EverCrypt) PERF:\n"); print_time(count, tdiff1, cdiff1);
+  printf("Chacha20Poly1305 Encrypt (EverCrypt) PERF:\n"); print_time(count, tdiff2, cdiff2);
+  free(plain);
+  free(cipher);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}